@@ -0,0 +1,4 @@
+#define AUTHORS_FOUNDERS {0}
+#define AUTHORS_LEAD_DEVELOPERS {0}
+#define AUTHORS_PROJECT_MANAGERS {0}
+#define AUTHORS_DEVELOPERS {0}
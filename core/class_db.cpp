@@ -263,6 +263,8 @@ ClassDB::ClassInfo::ClassInfo() {
 	api = API_NONE;
 	creation_func = NULL;
 	inherits_ptr = NULL;
+	full_method_cache_version = 0;
+	full_property_cache_version = 0;
 	disabled = false;
 	exposed = false;
 }
@@ -660,18 +662,46 @@ void ClassDB::get_method_list(StringName p_class, List<MethodInfo> *p_methods, b
 
 MethodBind *ClassDB::get_method(StringName p_class, StringName p_name) {
 
-	OBJTYPE_RLOCK;
+	//resolution goes through a flattened per-class table, rebuilt whenever a
+	//method has been bound since, so both hits and misses are a single probe
+
+	{
+		OBJTYPE_RLOCK;
+
+		ClassInfo *type = classes.getptr(p_class);
+		if (!type)
+			return NULL;
+		if (type->full_method_cache_version == method_cache_version) {
+			MethodBind **method = type->full_method_cache.getptr(p_name);
+			return method ? *method : NULL;
+		}
+	}
+
+	OBJTYPE_WLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
+	if (!type)
+		return NULL;
 
-	while (type) {
+	if (type->full_method_cache_version != method_cache_version) {
 
-		MethodBind **method = type->method_map.getptr(p_name);
-		if (method && *method)
-			return *method;
-		type = type->inherits_ptr;
+		type->full_method_cache.clear();
+		ClassInfo *check = type;
+		while (check) {
+			const StringName *K = NULL;
+			while ((K = check->method_map.next(K))) {
+				MethodBind *mb = check->method_map[*K];
+				if (mb && !type->full_method_cache.has(*K)) { //closest class wins
+					type->full_method_cache[*K] = mb;
+				}
+			}
+			check = check->inherits_ptr;
+		}
+		type->full_method_cache_version = method_cache_version;
 	}
-	return NULL;
+
+	MethodBind **method = type->full_method_cache.getptr(p_name);
+	return method ? *method : NULL;
 }
 
 void ClassDB::bind_integer_constant(const StringName &p_class, const StringName &p_enum, const StringName &p_name, int p_constant) {
@@ -914,6 +944,7 @@ void ClassDB::add_property_group(StringName p_class, const String &p_name, const
 	ERR_FAIL_COND(!type);
 
 	type->property_list.push_back(PropertyInfo(Variant::NIL, p_name, PROPERTY_HINT_NONE, p_prefix, PROPERTY_USAGE_GROUP));
+	property_cache_version++;
 }
 
 void ClassDB::add_property(StringName p_class, const PropertyInfo &p_pinfo, const StringName &p_setter, const StringName &p_getter, int p_index) {
@@ -956,6 +987,7 @@ void ClassDB::add_property(StringName p_class, const PropertyInfo &p_pinfo, cons
 	OBJTYPE_WLOCK
 
 	type->property_list.push_back(p_pinfo);
+	property_cache_version++;
 #ifdef DEBUG_METHODS_ENABLED
 	if (mb_get) {
 		type->methods_in_properties.insert(p_getter);
@@ -982,15 +1014,67 @@ void ClassDB::set_property_default_value(StringName p_class, const StringName &p
 	default_values[p_class][p_name] = p_default;
 }
 
+void ClassDB::_copy_property_list(const ClassInfo *p_type, List<PropertyInfo> *p_list, const Object *p_validator) {
+
+	for (int i = 0; i < p_type->full_property_cache.size(); i++) {
+
+		if (p_validator) {
+			PropertyInfo pi = p_type->full_property_cache[i];
+			p_validator->_validate_property(pi);
+			p_list->push_back(pi);
+		} else {
+			p_list->push_back(p_type->full_property_cache[i]);
+		}
+	}
+}
+
 void ClassDB::get_property_list(StringName p_class, List<PropertyInfo> *p_list, bool p_no_inheritance, const Object *p_validator) {
 
+	if (!p_no_inheritance) {
+		//full-chain enumeration is served from a flattened per-class cache,
+		//rebuilt whenever a property has been registered since
+
+		{
+			OBJTYPE_RLOCK;
+
+			ClassInfo *type = classes.getptr(p_class);
+			if (!type)
+				return;
+			if (type->full_property_cache_version == property_cache_version) {
+				_copy_property_list(type, p_list, p_validator);
+				return;
+			}
+		}
+
+		OBJTYPE_WLOCK;
+
+		ClassInfo *type = classes.getptr(p_class);
+		if (!type)
+			return;
+
+		if (type->full_property_cache_version != property_cache_version) {
+
+			type->full_property_cache.clear();
+			ClassInfo *check = type;
+			while (check) {
+				for (List<PropertyInfo>::Element *E = check->property_list.front(); E; E = E->next()) {
+					type->full_property_cache.push_back(E->get());
+				}
+				check = check->inherits_ptr;
+			}
+			type->full_property_cache_version = property_cache_version;
+		}
+
+		_copy_property_list(type, p_list, p_validator);
+		return;
+	}
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
-	ClassInfo *check = type;
-	while (check) {
+	if (type) {
 
-		for (List<PropertyInfo>::Element *E = check->property_list.front(); E; E = E->next()) {
+		for (List<PropertyInfo>::Element *E = type->property_list.front(); E; E = E->next()) {
 
 			if (p_validator) {
 				PropertyInfo pi = E->get();
@@ -1000,10 +1084,6 @@ void ClassDB::get_property_list(StringName p_class, List<PropertyInfo> *p_list,
 				p_list->push_back(E->get());
 			}
 		}
-
-		if (p_no_inheritance)
-			return;
-		check = check->inherits_ptr;
 	}
 }
 bool ClassDB::set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid) {
@@ -1257,6 +1337,7 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, const c
 #endif
 
 	type->method_map[mdname] = p_bind;
+	method_cache_version++;
 
 	Vector<Variant> defvals;
 
@@ -1437,6 +1518,8 @@ Variant ClassDB::class_get_default_property_value(const StringName &p_class, con
 }
 
 RWLock *ClassDB::lock = NULL;
+uint64_t ClassDB::property_cache_version = 1; //caches start at 0, so they are stale until first built
+uint64_t ClassDB::method_cache_version = 1;
 
 void ClassDB::init() {
 
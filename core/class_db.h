@@ -116,10 +116,14 @@ public:
 		ClassInfo *inherits_ptr;
 		void *class_ptr;
 		HashMap<StringName, MethodBind *> method_map;
+		HashMap<StringName, MethodBind *> full_method_cache; //whole inheritance chain flattened, built lazily by get_method()
+		uint64_t full_method_cache_version;
 		HashMap<StringName, int> constant_map;
 		HashMap<StringName, List<StringName> > enum_map;
 		HashMap<StringName, MethodInfo> signal_map;
 		List<PropertyInfo> property_list;
+		Vector<PropertyInfo> full_property_cache; //whole inheritance chain flattened, built lazily by get_property_list()
+		uint64_t full_property_cache_version;
 #ifdef DEBUG_METHODS_ENABLED
 		List<StringName> constant_order;
 		List<StringName> method_order;
@@ -158,6 +162,10 @@ public:
 
 	static void _add_class2(const StringName &p_class, const StringName &p_inherits);
 
+	static uint64_t property_cache_version;
+	static void _copy_property_list(const ClassInfo *p_type, List<PropertyInfo> *p_list, const Object *p_validator);
+	static uint64_t method_cache_version;
+
 	static HashMap<StringName, HashMap<StringName, Variant> > default_values;
 	static Set<StringName> default_values_cached;
 
@@ -331,6 +339,7 @@ public:
 			ERR_FAIL_V_MSG(NULL, "Method already bound: " + instance_type + "::" + p_name + ".");
 		}
 		type->method_map[p_name] = bind;
+		method_cache_version++;
 #ifdef DEBUG_METHODS_ENABLED
 		// FIXME: <reduz> set_return_type is no longer in MethodBind, so I guess it should be moved to vararg method bind
 		//bind->set_return_type("Variant");
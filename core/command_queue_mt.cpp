@@ -77,37 +77,43 @@ CommandQueueMT::SyncSemaphore *CommandQueueMT::_alloc_sync_sem() {
 	return &sync_sems[idx];
 }
 
-bool CommandQueueMT::dealloc_one() {
-tryagain:
-	if (dealloc_ptr == write_ptr) {
-		// The queue is empty
-		return false;
-	}
+CommandQueueMT::CommandPage *CommandQueueMT::_alloc_page() {
 
-	uint32_t size = *(uint32_t *)&command_mem[dealloc_ptr];
+	CommandPage *page;
 
-	if (size == 0) {
-		// End of command buffer wrap down
-		dealloc_ptr = 0;
-		goto tryagain;
+	if (free_pages) {
+		page = free_pages;
+		free_pages = page->next;
+		free_page_count--;
+	} else {
+		page = (CommandPage *)memalloc(sizeof(CommandPage));
 	}
 
-	if (size & 1) {
-		// Still used, nothing can be deallocated
-		return false;
+	page->next = NULL;
+	page->write_ptr = 0;
+	page->read_ptr = 0;
+	return page;
+}
+
+void CommandQueueMT::_recycle_page(CommandPage *p_page) {
+
+	if (free_page_count == MAX_FREE_PAGES) {
+		memfree(p_page);
+		return;
 	}
 
-	dealloc_ptr += (size >> 1) + 8;
-	return true;
+	p_page->next = free_pages;
+	free_pages = p_page;
+	free_page_count++;
 }
 
 CommandQueueMT::CommandQueueMT(bool p_sync) {
 
-	read_ptr = 0;
-	write_ptr = 0;
-	dealloc_ptr = 0;
 	mutex = Mutex::create();
-	command_mem = (uint8_t *)memalloc(COMMAND_MEM_SIZE);
+	free_pages = NULL;
+	free_page_count = 0;
+	read_page = _alloc_page();
+	write_page = read_page;
 
 	for (int i = 0; i < SYNC_SEMAPHORES; i++) {
 
@@ -129,5 +135,15 @@ CommandQueueMT::~CommandQueueMT() {
 
 		memdelete(sync_sems[i].sem);
 	}
-	memfree(command_mem);
+
+	while (read_page) {
+		CommandPage *next = read_page->next;
+		memfree(read_page);
+		read_page = next;
+	}
+	while (free_pages) {
+		CommandPage *next = free_pages->next;
+		memfree(free_pages);
+		free_pages = next;
+	}
 }
@@ -297,6 +297,11 @@ class CommandQueueMT {
 		}
 	};
 
+	struct FenceCommand : public SyncCommand {
+
+		virtual void call() {}
+	};
+
 	DECL_CMD(0)
 	SPACE_SEP_LIST(DECL_CMD, 13)
 
@@ -311,15 +316,29 @@ class CommandQueueMT {
 	/***** BASE *******/
 
 	enum {
-		COMMAND_MEM_SIZE_KB = 256,
-		COMMAND_MEM_SIZE = COMMAND_MEM_SIZE_KB * 1024,
+		COMMAND_PAGE_SIZE_KB = 64,
+		COMMAND_PAGE_SIZE = COMMAND_PAGE_SIZE_KB * 1024,
+		MAX_FREE_PAGES = 8, // pages kept around for reuse before being freed
 		SYNC_SEMAPHORES = 8
 	};
 
-	uint8_t *command_mem;
-	uint32_t read_ptr;
-	uint32_t write_ptr;
-	uint32_t dealloc_ptr;
+	// Commands live in a chain of fixed-size pages: the producer appends to
+	// the tail page (grabbing a fresh one when it fills, instead of spinning
+	// until the consumer makes room) and the consumer drains from the head,
+	// recycling pages as it finishes them. Commands never move, so execution
+	// can run with the queue unlocked.
+	struct CommandPage {
+
+		CommandPage *next;
+		uint32_t write_ptr;
+		uint32_t read_ptr;
+		uint8_t data[COMMAND_PAGE_SIZE];
+	};
+
+	CommandPage *read_page; // head; consumer drains from here
+	CommandPage *write_page; // tail; producer appends here
+	CommandPage *free_pages;
+	int free_page_count;
 	SyncSemaphore sync_sems[SYNC_SEMAPHORES];
 	Mutex *mutex;
 	Semaphore *sync;
@@ -327,56 +346,21 @@ class CommandQueueMT {
 	template <class T>
 	T *allocate() {
 
-		// alloc size is size+T+safeguard
-		uint32_t alloc_size = ((sizeof(T) + 8 - 1) & ~(8 - 1)) + 8;
-
-	tryagain:
-
-		if (write_ptr < dealloc_ptr) {
-			// behind dealloc_ptr, check that there is room
-			if ((dealloc_ptr - write_ptr) <= alloc_size) {
-
-				// There is no more room, try to deallocate something
-				if (dealloc_one()) {
-					goto tryagain;
-				}
-				return NULL;
-			}
-		} else {
-			// ahead of dealloc_ptr, check that there is room
-
-			if ((COMMAND_MEM_SIZE - write_ptr) < alloc_size + sizeof(uint32_t)) {
-				// no room at the end, wrap down;
-
-				if (dealloc_ptr == 0) { // don't want write_ptr to become dealloc_ptr
-
-					// There is no more room, try to deallocate something
-					if (dealloc_one()) {
-						goto tryagain;
-					}
-					return NULL;
-				}
-
-				// if this happens, it's a bug
-				ERR_FAIL_COND_V((COMMAND_MEM_SIZE - write_ptr) < 8, NULL);
-				// zero means, wrap to beginning
+		uint32_t alloc_size = (sizeof(T) + 8 - 1) & ~(8 - 1);
+		CRASH_COND(alloc_size + 8 > (uint32_t)COMMAND_PAGE_SIZE);
 
-				uint32_t *p = (uint32_t *)&command_mem[write_ptr];
-				*p = 0;
-				write_ptr = 0;
-				goto tryagain;
-			}
+		if (write_page->write_ptr + alloc_size + 8 > (uint32_t)COMMAND_PAGE_SIZE) {
+			// tail page is full; link a fresh one and keep going
+			CommandPage *page = _alloc_page();
+			write_page->next = page;
+			write_page = page;
 		}
-		// Allocate the size and the 'in use' bit.
-		// First bit used to mark if command is still in use (1)
-		// or if it has been destroyed and can be deallocated (0).
-		uint32_t size = (sizeof(T) + 8 - 1) & ~(8 - 1);
-		uint32_t *p = (uint32_t *)&command_mem[write_ptr];
-		*p = (size << 1) | 1;
-		write_ptr += 8;
-		// allocate the command
-		T *cmd = memnew_placement(&command_mem[write_ptr], T);
-		write_ptr += size;
+
+		uint32_t *p = (uint32_t *)&write_page->data[write_page->write_ptr];
+		*p = alloc_size;
+		write_page->write_ptr += 8;
+		T *cmd = memnew_placement(&write_page->data[write_page->write_ptr], T);
+		write_page->write_ptr += alloc_size;
 		return cmd;
 	}
 
@@ -384,43 +368,37 @@ class CommandQueueMT {
 	T *allocate_and_lock() {
 
 		lock();
-		T *ret;
-
-		while ((ret = allocate<T>()) == NULL) {
-
-			unlock();
-			// sleep a little until fetch happened and some room is made
-			wait_for_flush();
-			lock();
-		}
-
-		return ret;
+		return allocate<T>();
 	}
 
 	bool flush_one(bool p_lock = true) {
 		if (p_lock) lock();
 	tryagain:
 
-		// tried to read an empty queue
-		if (read_ptr == write_ptr) {
-			if (p_lock) unlock();
-			return false;
-		}
+		if (read_page->read_ptr == read_page->write_ptr) {
 
-		uint32_t size_ptr = read_ptr;
-		uint32_t size = *(uint32_t *)&command_mem[read_ptr] >> 1;
+			if (read_page != write_page) {
+				// head page fully drained; recycle it and move on
+				CommandPage *page = read_page;
+				read_page = page->next;
+				_recycle_page(page);
+				goto tryagain;
+			}
 
-		if (size == 0) {
-			//end of ringbuffer, wrap
-			read_ptr = 0;
-			goto tryagain;
-		}
+			// single page and drained; rewind so the space gets reused
+			read_page->read_ptr = 0;
+			read_page->write_ptr = 0;
 
-		read_ptr += 8;
+			if (p_lock) unlock();
+			return false;
+		}
 
-		CommandBase *cmd = reinterpret_cast<CommandBase *>(&command_mem[read_ptr]);
+		CommandPage *page = read_page;
+		uint32_t size = *(uint32_t *)&page->data[page->read_ptr];
+		page->read_ptr += 8;
 
-		read_ptr += size;
+		CommandBase *cmd = reinterpret_cast<CommandBase *>(&page->data[page->read_ptr]);
+		page->read_ptr += size;
 
 		if (p_lock) unlock();
 		cmd->call();
@@ -428,17 +406,18 @@ class CommandQueueMT {
 
 		cmd->post();
 		cmd->~CommandBase();
-		*(uint32_t *)&command_mem[size_ptr] &= ~1;
 
 		if (p_lock) unlock();
 		return true;
 	}
 
+	CommandPage *_alloc_page();
+	void _recycle_page(CommandPage *p_page);
+
 	void lock();
 	void unlock();
 	void wait_for_flush();
 	SyncSemaphore *_alloc_sync_sem();
-	bool dealloc_one();
 
 public:
 	/* NORMAL PUSH COMMANDS */
@@ -453,6 +432,19 @@ public:
 	DECL_PUSH_AND_SYNC(0)
 	SPACE_SEP_LIST(DECL_PUSH_AND_SYNC, 13)
 
+	// Blocks the calling thread until every command pushed before this call
+	// has been executed by the consumer.
+	void fence() {
+
+		SyncSemaphore *ss = _alloc_sync_sem();
+		FenceCommand *cmd = allocate_and_lock<FenceCommand>();
+		cmd->sync_sem = ss;
+		unlock();
+		if (sync) sync->post();
+		ss->sem->wait();
+		ss->in_use = false;
+	}
+
 	void wait_and_flush_one() {
 		ERR_FAIL_COND(!sync);
 		sync->wait();
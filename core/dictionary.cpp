@@ -38,6 +38,7 @@ struct DictionaryPrivate {
 
 	SafeRefCount refcount;
 	OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator> variant_map;
+	uint64_t version; //bumped whenever an element is erased, invalidating cursors
 };
 
 void Dictionary::get_key_list(List<Variant> *p_keys) const {
@@ -146,7 +147,10 @@ bool Dictionary::has_all(const Array &p_keys) const {
 
 bool Dictionary::erase(const Variant &p_key) {
 
-	return _p->variant_map.erase(p_key);
+	bool erased = _p->variant_map.erase(p_key);
+	if (erased)
+		_p->version++;
+	return erased;
 }
 
 bool Dictionary::operator==(const Dictionary &p_dictionary) const {
@@ -178,6 +182,7 @@ void Dictionary::_ref(const Dictionary &p_from) const {
 void Dictionary::clear() {
 
 	_p->variant_map.clear();
+	_p->version++;
 }
 
 void Dictionary::_unref() const {
@@ -249,6 +254,29 @@ const Variant *Dictionary::next(const Variant *p_key) const {
 	return NULL;
 }
 
+uint64_t Dictionary::get_version() const {
+
+	return _p->version;
+}
+
+const void *Dictionary::cursor_front() const {
+
+	const OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator> *cmap = &_p->variant_map;
+	return cmap->front().cursor();
+}
+
+const void *Dictionary::cursor_next(const void *p_cursor) const {
+
+	const OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator> *cmap = &_p->variant_map;
+	return cmap->element_for_cursor(p_cursor).next().cursor();
+}
+
+const Variant &Dictionary::cursor_key(const void *p_cursor) const {
+
+	const OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator> *cmap = &_p->variant_map;
+	return cmap->element_for_cursor(p_cursor).key();
+}
+
 Dictionary Dictionary::duplicate(bool p_deep) const {
 
 	Dictionary n;
@@ -278,6 +306,7 @@ Dictionary::Dictionary() {
 
 	_p = memnew(DictionaryPrivate);
 	_p->refcount.init();
+	_p->version = 1;
 }
 Dictionary::~Dictionary() {
 
@@ -77,6 +77,13 @@ public:
 
 	const Variant *next(const Variant *p_key = NULL) const;
 
+	// Cursor-style in-order iteration; avoids the per-step key lookup done by
+	// next(). Cursors are only valid while get_version() is unchanged.
+	uint64_t get_version() const;
+	const void *cursor_front() const;
+	const void *cursor_next(const void *p_cursor) const;
+	const Variant &cursor_key(const void *p_cursor) const;
+
 	Array keys() const;
 	Array values() const;
 
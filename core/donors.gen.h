@@ -0,0 +1,6 @@
+#define DONORS_SPONSOR_PLAT {0}
+#define DONORS_SPONSOR_GOLD {0}
+#define DONORS_SPONSOR_MINI {0}
+#define DONORS_GOLD {0}
+#define DONORS_SILVER {0}
+#define DONORS_BRONZE {0}
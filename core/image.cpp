@@ -413,6 +413,85 @@ static void _convert(int p_width, int p_height, const uint8_t *p_src, uint8_t *p
 	}
 }
 
+static void _convert_bytes(int p_conversion_type, int p_width, int p_height, const uint8_t *p_src, uint8_t *p_dst) {
+
+	switch (p_conversion_type) {
+
+		case Image::FORMAT_L8 | (Image::FORMAT_LA8 << 8): _convert<1, false, 1, true, true, true>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_L8 | (Image::FORMAT_R8 << 8): _convert<1, false, 1, false, true, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_L8 | (Image::FORMAT_RG8 << 8): _convert<1, false, 2, false, true, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_L8 | (Image::FORMAT_RGB8 << 8): _convert<1, false, 3, false, true, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_L8 | (Image::FORMAT_RGBA8 << 8): _convert<1, false, 3, true, true, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_LA8 | (Image::FORMAT_L8 << 8): _convert<1, true, 1, false, true, true>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_LA8 | (Image::FORMAT_R8 << 8): _convert<1, true, 1, false, true, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_LA8 | (Image::FORMAT_RG8 << 8): _convert<1, true, 2, false, true, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_LA8 | (Image::FORMAT_RGB8 << 8): _convert<1, true, 3, false, true, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_LA8 | (Image::FORMAT_RGBA8 << 8): _convert<1, true, 3, true, true, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_R8 | (Image::FORMAT_L8 << 8): _convert<1, false, 1, false, false, true>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_R8 | (Image::FORMAT_LA8 << 8): _convert<1, false, 1, true, false, true>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_R8 | (Image::FORMAT_RG8 << 8): _convert<1, false, 2, false, false, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_R8 | (Image::FORMAT_RGB8 << 8): _convert<1, false, 3, false, false, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_R8 | (Image::FORMAT_RGBA8 << 8): _convert<1, false, 3, true, false, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_RG8 | (Image::FORMAT_L8 << 8): _convert<2, false, 1, false, false, true>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_RG8 | (Image::FORMAT_LA8 << 8): _convert<2, false, 1, true, false, true>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_RG8 | (Image::FORMAT_R8 << 8): _convert<2, false, 1, false, false, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_RG8 | (Image::FORMAT_RGB8 << 8): _convert<2, false, 3, false, false, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_RG8 | (Image::FORMAT_RGBA8 << 8): _convert<2, false, 3, true, false, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_RGB8 | (Image::FORMAT_L8 << 8): _convert<3, false, 1, false, false, true>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_RGB8 | (Image::FORMAT_LA8 << 8): _convert<3, false, 1, true, false, true>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_RGB8 | (Image::FORMAT_R8 << 8): _convert<3, false, 1, false, false, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_RGB8 | (Image::FORMAT_RG8 << 8): _convert<3, false, 2, false, false, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_RGB8 | (Image::FORMAT_RGBA8 << 8): _convert<3, false, 3, true, false, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_RGBA8 | (Image::FORMAT_L8 << 8): _convert<3, true, 1, false, false, true>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_RGBA8 | (Image::FORMAT_LA8 << 8): _convert<3, true, 1, true, false, true>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_RGBA8 | (Image::FORMAT_R8 << 8): _convert<3, true, 1, false, false, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_RGBA8 | (Image::FORMAT_RG8 << 8): _convert<3, true, 2, false, false, false>(p_width, p_height, p_src, p_dst); break;
+		case Image::FORMAT_RGBA8 | (Image::FORMAT_RGB8 << 8): _convert<3, true, 3, false, false, false>(p_width, p_height, p_src, p_dst); break;
+	}
+}
+
+//direct kernels for unorm8 <-> float32 conversions with the same channel
+//layout, which otherwise take the generic get_pixel/set_pixel path below.
+//plain contiguous multiply/clamp loops, which compilers auto-vectorize with
+//each platform's baseline SIMD (SSE2 on x86, NEON on arm64)
+static bool _convert_fast(int p_conversion_type, const uint8_t *p_src, uint8_t *p_dst, int64_t p_pixels) {
+
+	uint32_t channels = 0;
+	bool to_float = false;
+
+	switch (p_conversion_type) {
+
+		case Image::FORMAT_R8 | (Image::FORMAT_RF << 8): channels = 1; to_float = true; break;
+		case Image::FORMAT_RG8 | (Image::FORMAT_RGF << 8): channels = 2; to_float = true; break;
+		case Image::FORMAT_RGB8 | (Image::FORMAT_RGBF << 8): channels = 3; to_float = true; break;
+		case Image::FORMAT_RGBA8 | (Image::FORMAT_RGBAF << 8): channels = 4; to_float = true; break;
+		case Image::FORMAT_RF | (Image::FORMAT_R8 << 8): channels = 1; break;
+		case Image::FORMAT_RGF | (Image::FORMAT_RG8 << 8): channels = 2; break;
+		case Image::FORMAT_RGBF | (Image::FORMAT_RGB8 << 8): channels = 3; break;
+		case Image::FORMAT_RGBAF | (Image::FORMAT_RGBA8 << 8): channels = 4; break;
+		default: return false;
+	}
+
+	int64_t count = p_pixels * channels;
+
+	if (to_float) {
+
+		float *dst = (float *)p_dst;
+		for (int64_t i = 0; i < count; i++) {
+			dst[i] = p_src[i] * (1.0f / 255.0f);
+		}
+	} else {
+
+		const float *src = (const float *)p_src;
+		for (int64_t i = 0; i < count; i++) {
+			float c = src[i] < 0.0f ? 0.0f : (src[i] > 1.0f ? 1.0f : src[i]);
+			p_dst[i] = (uint8_t)(c * 255.0f + 0.5f);
+		}
+	}
+
+	return true;
+}
+
 void Image::convert(Format p_new_format) {
 
 	if (data.size() == 0)
@@ -429,20 +508,31 @@ void Image::convert(Format p_new_format) {
 
 	} else if (format > FORMAT_RGBA8 || p_new_format > FORMAT_RGBA8) {
 
-		//use put/set pixel which is slower but works with non byte formats
-		Image new_img(width, height, 0, p_new_format);
-		lock();
-		new_img.lock();
+		Image new_img;
+		new_img._create_uninitialized(width, height, false, p_new_format); //all pixels are written below
 
-		for (int i = 0; i < width; i++) {
-			for (int j = 0; j < height; j++) {
+		bool converted = false;
+		{
+			PoolVector<uint8_t>::Read r = data.read();
+			PoolVector<uint8_t>::Write w = new_img.data.write();
+			converted = _convert_fast(format | p_new_format << 8, r.ptr(), w.ptr(), (int64_t)width * height);
+		}
 
-				new_img.set_pixel(i, j, get_pixel(i, j));
+		if (!converted) {
+			//use put/set pixel which is slower but works with any non byte format
+			lock();
+			new_img.lock();
+
+			for (int i = 0; i < width; i++) {
+				for (int j = 0; j < height; j++) {
+
+					new_img.set_pixel(i, j, get_pixel(i, j));
+				}
 			}
-		}
 
-		unlock();
-		new_img.unlock();
+			unlock();
+			new_img.unlock();
+		}
 
 		if (has_mipmaps()) {
 			new_img.generate_mipmaps();
@@ -453,50 +543,36 @@ void Image::convert(Format p_new_format) {
 		return;
 	}
 
-	Image new_img(width, height, 0, p_new_format);
+	int conversion_type = format | p_new_format << 8;
 
-	PoolVector<uint8_t>::Read r = data.read();
-	PoolVector<uint8_t>::Write w = new_img.data.write();
+	if (get_format_pixel_size(p_new_format) <= get_format_pixel_size(format)) {
+
+		//every converter reads a pixel from at or ahead of where it writes it, so
+		//conversions that do not grow the pixel can run in place on the same buffer
+		{
+			PoolVector<uint8_t>::Write w = data.write();
+			_convert_bytes(conversion_type, width, height, w.ptr(), w.ptr());
+		}
 
-	const uint8_t *rptr = r.ptr();
-	uint8_t *wptr = w.ptr();
+		bool gen_mipmaps = mipmaps;
+		mipmaps = false;
+		format = p_new_format;
+		data.resize(width * height * get_format_pixel_size(p_new_format)); //also drops any stale mipmap tail
 
-	int conversion_type = format | p_new_format << 8;
+		if (gen_mipmaps)
+			generate_mipmaps();
 
-	switch (conversion_type) {
-
-		case FORMAT_L8 | (FORMAT_LA8 << 8): _convert<1, false, 1, true, true, true>(width, height, rptr, wptr); break;
-		case FORMAT_L8 | (FORMAT_R8 << 8): _convert<1, false, 1, false, true, false>(width, height, rptr, wptr); break;
-		case FORMAT_L8 | (FORMAT_RG8 << 8): _convert<1, false, 2, false, true, false>(width, height, rptr, wptr); break;
-		case FORMAT_L8 | (FORMAT_RGB8 << 8): _convert<1, false, 3, false, true, false>(width, height, rptr, wptr); break;
-		case FORMAT_L8 | (FORMAT_RGBA8 << 8): _convert<1, false, 3, true, true, false>(width, height, rptr, wptr); break;
-		case FORMAT_LA8 | (FORMAT_L8 << 8): _convert<1, true, 1, false, true, true>(width, height, rptr, wptr); break;
-		case FORMAT_LA8 | (FORMAT_R8 << 8): _convert<1, true, 1, false, true, false>(width, height, rptr, wptr); break;
-		case FORMAT_LA8 | (FORMAT_RG8 << 8): _convert<1, true, 2, false, true, false>(width, height, rptr, wptr); break;
-		case FORMAT_LA8 | (FORMAT_RGB8 << 8): _convert<1, true, 3, false, true, false>(width, height, rptr, wptr); break;
-		case FORMAT_LA8 | (FORMAT_RGBA8 << 8): _convert<1, true, 3, true, true, false>(width, height, rptr, wptr); break;
-		case FORMAT_R8 | (FORMAT_L8 << 8): _convert<1, false, 1, false, false, true>(width, height, rptr, wptr); break;
-		case FORMAT_R8 | (FORMAT_LA8 << 8): _convert<1, false, 1, true, false, true>(width, height, rptr, wptr); break;
-		case FORMAT_R8 | (FORMAT_RG8 << 8): _convert<1, false, 2, false, false, false>(width, height, rptr, wptr); break;
-		case FORMAT_R8 | (FORMAT_RGB8 << 8): _convert<1, false, 3, false, false, false>(width, height, rptr, wptr); break;
-		case FORMAT_R8 | (FORMAT_RGBA8 << 8): _convert<1, false, 3, true, false, false>(width, height, rptr, wptr); break;
-		case FORMAT_RG8 | (FORMAT_L8 << 8): _convert<2, false, 1, false, false, true>(width, height, rptr, wptr); break;
-		case FORMAT_RG8 | (FORMAT_LA8 << 8): _convert<2, false, 1, true, false, true>(width, height, rptr, wptr); break;
-		case FORMAT_RG8 | (FORMAT_R8 << 8): _convert<2, false, 1, false, false, false>(width, height, rptr, wptr); break;
-		case FORMAT_RG8 | (FORMAT_RGB8 << 8): _convert<2, false, 3, false, false, false>(width, height, rptr, wptr); break;
-		case FORMAT_RG8 | (FORMAT_RGBA8 << 8): _convert<2, false, 3, true, false, false>(width, height, rptr, wptr); break;
-		case FORMAT_RGB8 | (FORMAT_L8 << 8): _convert<3, false, 1, false, false, true>(width, height, rptr, wptr); break;
-		case FORMAT_RGB8 | (FORMAT_LA8 << 8): _convert<3, false, 1, true, false, true>(width, height, rptr, wptr); break;
-		case FORMAT_RGB8 | (FORMAT_R8 << 8): _convert<3, false, 1, false, false, false>(width, height, rptr, wptr); break;
-		case FORMAT_RGB8 | (FORMAT_RG8 << 8): _convert<3, false, 2, false, false, false>(width, height, rptr, wptr); break;
-		case FORMAT_RGB8 | (FORMAT_RGBA8 << 8): _convert<3, false, 3, true, false, false>(width, height, rptr, wptr); break;
-		case FORMAT_RGBA8 | (FORMAT_L8 << 8): _convert<3, true, 1, false, false, true>(width, height, rptr, wptr); break;
-		case FORMAT_RGBA8 | (FORMAT_LA8 << 8): _convert<3, true, 1, true, false, true>(width, height, rptr, wptr); break;
-		case FORMAT_RGBA8 | (FORMAT_R8 << 8): _convert<3, true, 1, false, false, false>(width, height, rptr, wptr); break;
-		case FORMAT_RGBA8 | (FORMAT_RG8 << 8): _convert<3, true, 2, false, false, false>(width, height, rptr, wptr); break;
-		case FORMAT_RGBA8 | (FORMAT_RGB8 << 8): _convert<3, true, 3, false, false, false>(width, height, rptr, wptr); break;
+		return;
 	}
 
+	Image new_img;
+	new_img._create_uninitialized(width, height, false, p_new_format); //all pixels are written below
+
+	PoolVector<uint8_t>::Read r = data.read();
+	PoolVector<uint8_t>::Write w = new_img.data.write();
+
+	_convert_bytes(conversion_type, width, height, r.ptr(), w.ptr());
+
 	r.release();
 	w.release();
 
@@ -895,7 +971,8 @@ void Image::resize(int p_width, int p_height, Interpolation p_interpolation) {
 	if (p_width == width && p_height == height)
 		return;
 
-	Image dst(p_width, p_height, 0, format);
+	Image dst;
+	dst._create_uninitialized(p_width, p_height, false, format); //all pixels are written below
 
 	// Setup mipmap-aware scaling
 	Image dst2;
@@ -915,7 +992,7 @@ void Image::resize(int p_width, int p_height, Interpolation p_interpolation) {
 	}
 	bool interpolate_mipmaps = mipmap_aware && mip1 != mip2;
 	if (interpolate_mipmaps) {
-		dst2.create(p_width, p_height, 0, format);
+		dst2._create_uninitialized(p_width, p_height, false, format);
 	}
 
 	bool had_mipmaps = mipmaps;
@@ -1591,6 +1668,21 @@ void Image::create(int p_width, int p_height, bool p_use_mipmaps, Format p_forma
 	format = p_format;
 }
 
+void Image::_create_uninitialized(int p_width, int p_height, bool p_use_mipmaps, Format p_format) {
+
+	ERR_FAIL_INDEX(p_width - 1, MAX_WIDTH);
+	ERR_FAIL_INDEX(p_height - 1, MAX_HEIGHT);
+
+	int mm = 0;
+	int size = _get_dst_image_size(p_width, p_height, p_format, mm, p_use_mipmaps ? -1 : 0);
+	data.resize(size);
+
+	width = p_width;
+	height = p_height;
+	mipmaps = p_use_mipmaps;
+	format = p_format;
+}
+
 void Image::create(int p_width, int p_height, bool p_use_mipmaps, Format p_format, const PoolVector<uint8_t> &p_data) {
 
 	ERR_FAIL_INDEX(p_width - 1, MAX_WIDTH);
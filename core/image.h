@@ -162,6 +162,8 @@ private:
 		create(p_width, p_height, p_use_mipmaps, p_format, p_data);
 	}
 
+	void _create_uninitialized(int p_width, int p_height, bool p_use_mipmaps, Format p_format); //only for callers that write every byte, skips the initial clear
+
 	Format format;
 	PoolVector<uint8_t> data;
 	int width, height;
@@ -39,6 +39,90 @@
 #include <zlib.h>
 #include <zstd.h>
 
+#include "core/os/mutex.h"
+#include "core/vector.h"
+
+// Reusable zstd contexts. Creating a context costs more than (de)compressing a
+// small resource, so finished contexts go back to a pool instead of being freed.
+static Vector<ZSTD_CCtx *> zstd_cctx_pool;
+static Vector<ZSTD_DCtx *> zstd_dctx_pool;
+static ZSTD_CDict *zstd_cdict = NULL;
+static ZSTD_DDict *zstd_ddict = NULL;
+
+enum {
+	ZSTD_CTX_POOL_MAX = 8
+};
+
+static Mutex *_zstd_ctx_mutex() {
+
+	static Mutex *mutex = Mutex::create();
+	return mutex;
+}
+
+static ZSTD_CCtx *_zstd_acquire_cctx() {
+
+	ZSTD_CCtx *ctx = NULL;
+	Mutex *mutex = _zstd_ctx_mutex();
+	if (mutex)
+		mutex->lock();
+	if (zstd_cctx_pool.size()) {
+		ctx = zstd_cctx_pool[zstd_cctx_pool.size() - 1];
+		zstd_cctx_pool.resize(zstd_cctx_pool.size() - 1);
+	}
+	if (mutex)
+		mutex->unlock();
+	if (!ctx)
+		ctx = ZSTD_createCCtx();
+	return ctx;
+}
+
+static void _zstd_release_cctx(ZSTD_CCtx *p_ctx) {
+
+	Mutex *mutex = _zstd_ctx_mutex();
+	if (mutex)
+		mutex->lock();
+	if (zstd_cctx_pool.size() < ZSTD_CTX_POOL_MAX) {
+		zstd_cctx_pool.push_back(p_ctx);
+		p_ctx = NULL;
+	}
+	if (mutex)
+		mutex->unlock();
+	if (p_ctx)
+		ZSTD_freeCCtx(p_ctx);
+}
+
+static ZSTD_DCtx *_zstd_acquire_dctx() {
+
+	ZSTD_DCtx *ctx = NULL;
+	Mutex *mutex = _zstd_ctx_mutex();
+	if (mutex)
+		mutex->lock();
+	if (zstd_dctx_pool.size()) {
+		ctx = zstd_dctx_pool[zstd_dctx_pool.size() - 1];
+		zstd_dctx_pool.resize(zstd_dctx_pool.size() - 1);
+	}
+	if (mutex)
+		mutex->unlock();
+	if (!ctx)
+		ctx = ZSTD_createDCtx();
+	return ctx;
+}
+
+static void _zstd_release_dctx(ZSTD_DCtx *p_ctx) {
+
+	Mutex *mutex = _zstd_ctx_mutex();
+	if (mutex)
+		mutex->lock();
+	if (zstd_dctx_pool.size() < ZSTD_CTX_POOL_MAX) {
+		zstd_dctx_pool.push_back(p_ctx);
+		p_ctx = NULL;
+	}
+	if (mutex)
+		mutex->unlock();
+	if (p_ctx)
+		ZSTD_freeDCtx(p_ctx);
+}
+
 int Compression::compress(uint8_t *p_dst, const uint8_t *p_src, int p_src_size, Mode p_mode) {
 
 	switch (p_mode) {
@@ -80,15 +164,18 @@ int Compression::compress(uint8_t *p_dst, const uint8_t *p_src, int p_src_size,
 
 		} break;
 		case MODE_ZSTD: {
-			ZSTD_CCtx *cctx = ZSTD_createCCtx();
+			ZSTD_CCtx *cctx = _zstd_acquire_cctx();
 			ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, zstd_level);
-			if (zstd_long_distance_matching) {
-				ZSTD_CCtx_setParameter(cctx, ZSTD_c_enableLongDistanceMatching, 1);
-				ZSTD_CCtx_setParameter(cctx, ZSTD_c_windowLog, zstd_window_log_size);
-			}
+			ZSTD_CCtx_setParameter(cctx, ZSTD_c_enableLongDistanceMatching, zstd_long_distance_matching ? 1 : 0);
+			ZSTD_CCtx_setParameter(cctx, ZSTD_c_windowLog, zstd_long_distance_matching ? zstd_window_log_size : 0);
 			int max_dst_size = get_max_compressed_buffer_size(p_src_size, MODE_ZSTD);
-			int ret = ZSTD_compressCCtx(cctx, p_dst, max_dst_size, p_src, p_src_size, zstd_level);
-			ZSTD_freeCCtx(cctx);
+			int ret;
+			if (zstd_cdict) {
+				ret = ZSTD_compress_usingCDict(cctx, p_dst, max_dst_size, p_src, p_src_size, zstd_cdict);
+			} else {
+				ret = ZSTD_compressCCtx(cctx, p_dst, max_dst_size, p_src, p_src_size, zstd_level);
+			}
+			_zstd_release_cctx(cctx);
 			return ret;
 		} break;
 	}
@@ -174,12 +261,17 @@ int Compression::decompress(uint8_t *p_dst, int p_dst_max_size, const uint8_t *p
 			return total;
 		} break;
 		case MODE_ZSTD: {
-			ZSTD_DCtx *dctx = ZSTD_createDCtx();
-			if (zstd_long_distance_matching) {
-				ZSTD_DCtx_setParameter(dctx, ZSTD_d_windowLogMax, zstd_window_log_size);
+			ZSTD_DCtx *dctx = _zstd_acquire_dctx();
+			ZSTD_DCtx_setParameter(dctx, ZSTD_d_windowLogMax, zstd_long_distance_matching ? zstd_window_log_size : 0);
+			int ret;
+			// Only frames that declare the loaded dictionary need it, anything else (older
+			// packs, files saved without a dictionary) keeps decompressing as before.
+			if (zstd_ddict && ZSTD_getDictID_fromFrame(p_src, p_src_size) == ZSTD_getDictID_fromDDict(zstd_ddict)) {
+				ret = ZSTD_decompress_usingDDict(dctx, p_dst, p_dst_max_size, p_src, p_src_size, zstd_ddict);
+			} else {
+				ret = ZSTD_decompressDCtx(dctx, p_dst, p_dst_max_size, p_src, p_src_size);
 			}
-			int ret = ZSTD_decompressDCtx(dctx, p_dst, p_dst_max_size, p_src, p_src_size);
-			ZSTD_freeDCtx(dctx);
+			_zstd_release_dctx(dctx);
 			return ret;
 		} break;
 	}
@@ -187,6 +279,69 @@ int Compression::decompress(uint8_t *p_dst, int p_dst_max_size, const uint8_t *p
 	ERR_FAIL_V(-1);
 }
 
+Error Compression::set_zstd_dictionary(const uint8_t *p_dict, int p_dict_size) {
+
+	Mutex *mutex = _zstd_ctx_mutex();
+	if (mutex)
+		mutex->lock();
+
+	if (zstd_cdict) {
+		ZSTD_freeCDict(zstd_cdict);
+		zstd_cdict = NULL;
+	}
+	if (zstd_ddict) {
+		ZSTD_freeDDict(zstd_ddict);
+		zstd_ddict = NULL;
+	}
+
+	Error err = OK;
+	if (p_dict && p_dict_size > 0) {
+		zstd_cdict = ZSTD_createCDict(p_dict, p_dict_size, zstd_level);
+		zstd_ddict = ZSTD_createDDict(p_dict, p_dict_size);
+		if (!zstd_cdict || !zstd_ddict) {
+			if (zstd_cdict) {
+				ZSTD_freeCDict(zstd_cdict);
+				zstd_cdict = NULL;
+			}
+			if (zstd_ddict) {
+				ZSTD_freeDDict(zstd_ddict);
+				zstd_ddict = NULL;
+			}
+			err = ERR_INVALID_DATA;
+		}
+	}
+
+	if (mutex)
+		mutex->unlock();
+
+	return err;
+}
+
+bool Compression::has_zstd_dictionary() {
+
+	return zstd_ddict != NULL;
+}
+
+void Compression::cleanup() {
+
+	for (int i = 0; i < zstd_cctx_pool.size(); i++) {
+		ZSTD_freeCCtx(zstd_cctx_pool[i]);
+	}
+	zstd_cctx_pool.clear();
+	for (int i = 0; i < zstd_dctx_pool.size(); i++) {
+		ZSTD_freeDCtx(zstd_dctx_pool[i]);
+	}
+	zstd_dctx_pool.clear();
+	if (zstd_cdict) {
+		ZSTD_freeCDict(zstd_cdict);
+		zstd_cdict = NULL;
+	}
+	if (zstd_ddict) {
+		ZSTD_freeDDict(zstd_ddict);
+		zstd_ddict = NULL;
+	}
+}
+
 int Compression::zlib_level = Z_DEFAULT_COMPRESSION;
 int Compression::gzip_level = Z_DEFAULT_COMPRESSION;
 int Compression::zstd_level = 3;
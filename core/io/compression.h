@@ -53,6 +53,10 @@ public:
 	static int get_max_compressed_buffer_size(int p_src_size, Mode p_mode = MODE_ZSTD);
 	static int decompress(uint8_t *p_dst, int p_dst_max_size, const uint8_t *p_src, int p_src_size, Mode p_mode = MODE_ZSTD);
 
+	static Error set_zstd_dictionary(const uint8_t *p_dict, int p_dict_size); //digested once, empty clears
+	static bool has_zstd_dictionary();
+	static void cleanup();
+
 	Compression();
 };
 
@@ -0,0 +1,269 @@
+/*************************************************************************/
+/*  file_access_async.cpp                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "file_access_async.h"
+
+#include "core/os/file_access.h"
+#include "core/project_settings.h"
+
+Mutex *FileAccessAsync::mutex = NULL;
+Semaphore *FileAccessAsync::request_semaphore = NULL;
+Vector<Thread *> FileAccessAsync::threads;
+volatile bool FileAccessAsync::exit_threads = false;
+Map<FileAccessAsync::RequestID, FileAccessAsync::Request *> FileAccessAsync::requests;
+List<FileAccessAsync::RequestID> FileAccessAsync::queue;
+uint64_t FileAccessAsync::last_request_id = 0;
+
+void FileAccessAsync::_process_request(Request *p_request) {
+
+	Error err;
+	FileAccess *f = FileAccess::open(p_request->path, FileAccess::READ, &err);
+	if (!f) {
+		p_request->error = err;
+		return;
+	}
+
+	uint64_t len = f->get_len();
+	if (p_request->offset > len) {
+		memdelete(f);
+		p_request->error = ERR_INVALID_PARAMETER;
+		return;
+	}
+
+	int64_t to_read = p_request->bytes;
+	if (to_read == READ_WHOLE_FILE || p_request->offset + to_read > len) {
+		to_read = len - p_request->offset;
+	}
+
+	if (p_request->offset > 0) {
+		f->seek(p_request->offset);
+	}
+
+	p_request->data.resize(to_read);
+	int read = to_read > 0 ? f->get_buffer(p_request->data.ptrw(), to_read) : 0;
+	memdelete(f);
+
+	if (read != to_read) {
+		p_request->data.resize(read > 0 ? read : 0);
+		p_request->error = ERR_FILE_CANT_READ;
+		return;
+	}
+
+	p_request->error = OK;
+}
+
+void FileAccessAsync::_thread_func(void *p_userdata) {
+
+	while (true) {
+
+		request_semaphore->wait();
+
+		mutex->lock();
+		if (exit_threads) {
+			mutex->unlock();
+			break;
+		}
+
+		if (queue.empty()) {
+			mutex->unlock();
+			continue;
+		}
+
+		RequestID id = queue.front()->get();
+		queue.pop_front();
+		Request *r = requests[id];
+		mutex->unlock();
+
+		_process_request(r);
+
+		if (r->callback) {
+			//fire and forget, the request is freed once the callback returns
+			r->callback(r->userdata, r->id, r->error, r->data);
+			mutex->lock();
+			requests.erase(r->id);
+			mutex->unlock();
+			memdelete(r);
+		} else {
+			mutex->lock();
+			r->done = true;
+			if (r->waiter) {
+				r->waiter->post();
+			}
+			mutex->unlock();
+		}
+	}
+}
+
+FileAccessAsync::RequestID FileAccessAsync::submit_read(const String &p_path, uint64_t p_offset, int64_t p_bytes, CompletionFunc p_callback, void *p_userdata) {
+
+	Request *r = memnew(Request);
+	r->path = p_path;
+	r->offset = p_offset;
+	r->bytes = p_bytes;
+	r->callback = p_callback;
+	r->userdata = p_userdata;
+
+	if (mutex)
+		mutex->lock();
+	r->id = ++last_request_id;
+	requests[r->id] = r;
+
+#ifdef NO_THREADS
+	RequestID id = r->id;
+	if (mutex)
+		mutex->unlock();
+	_process_request(r);
+	if (r->callback) {
+		r->callback(r->userdata, r->id, r->error, r->data);
+		requests.erase(r->id);
+		memdelete(r);
+	} else {
+		r->done = true;
+	}
+	return id;
+#else
+
+	if (threads.empty()) {
+		//started lazily so short-lived tools runs that never read asynchronously don't pay for the pool
+		int thread_count = 4;
+		if (ProjectSettings::get_singleton()) {
+			static int cached_count = -1;
+			if (cached_count < 0) {
+				cached_count = GLOBAL_DEF("core/async_file_io/thread_count", 4);
+				ProjectSettings::get_singleton()->set_custom_property_info("core/async_file_io/thread_count", PropertyInfo(Variant::INT, "core/async_file_io/thread_count", PROPERTY_HINT_RANGE, "1,16,1"));
+			}
+			thread_count = cached_count;
+		}
+		for (int i = 0; i < thread_count; i++) {
+			threads.push_back(Thread::create(_thread_func, NULL));
+		}
+	}
+
+	queue.push_back(r->id);
+	RequestID id = r->id;
+	mutex->unlock();
+
+	request_semaphore->post();
+	return id;
+#endif
+}
+
+Error FileAccessAsync::wait(RequestID p_request, Vector<uint8_t> *r_data) {
+
+	if (mutex)
+		mutex->lock();
+
+	Map<RequestID, Request *>::Element *E = requests.find(p_request);
+	if (!E) {
+		if (mutex)
+			mutex->unlock();
+		ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, "Invalid async read request ID (already collected, or submitted with a callback?).");
+	}
+
+	Request *r = E->get();
+	if (r->callback != NULL) {
+		if (mutex)
+			mutex->unlock();
+		ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, "Async read requests with a completion callback can't be waited on.");
+	}
+
+	if (!r->done) {
+		if (!r->waiter) {
+			r->waiter = Semaphore::create();
+		}
+		if (mutex)
+			mutex->unlock();
+		r->waiter->wait();
+		if (mutex)
+			mutex->lock();
+	}
+
+	Error err = r->error;
+	if (r_data) {
+		*r_data = r->data;
+	}
+	requests.erase(p_request);
+	if (mutex)
+		mutex->unlock();
+
+	if (r->waiter) {
+		memdelete(r->waiter);
+	}
+	memdelete(r);
+
+	return err;
+}
+
+void FileAccessAsync::initialize() {
+
+#ifndef NO_THREADS
+	mutex = Mutex::create();
+	request_semaphore = Semaphore::create();
+#endif
+}
+
+void FileAccessAsync::finalize() {
+
+#ifndef NO_THREADS
+	if (mutex) {
+		mutex->lock();
+		exit_threads = true;
+		mutex->unlock();
+	}
+
+	for (int i = 0; i < threads.size(); i++) {
+		request_semaphore->post();
+	}
+	for (int i = 0; i < threads.size(); i++) {
+		Thread::wait_to_finish(threads[i]);
+		memdelete(threads[i]);
+	}
+	threads.clear();
+#endif
+
+	while (requests.front()) {
+		WARN_PRINTS("Exited while async file read is pending: " + requests.front()->get()->path);
+		if (requests.front()->get()->waiter) {
+			memdelete(requests.front()->get()->waiter);
+		}
+		memdelete(requests.front()->get());
+		requests.erase(requests.front());
+	}
+	queue.clear();
+
+	if (request_semaphore) {
+		memdelete(request_semaphore);
+		request_semaphore = NULL;
+	}
+	if (mutex) {
+		memdelete(mutex);
+		mutex = NULL;
+	}
+}
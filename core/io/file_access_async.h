@@ -0,0 +1,105 @@
+/*************************************************************************/
+/*  file_access_async.h                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef FILE_ACCESS_ASYNC_H
+#define FILE_ACCESS_ASYNC_H
+
+#include "core/list.h"
+#include "core/map.h"
+#include "core/os/mutex.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+#include "core/ustring.h"
+#include "core/vector.h"
+
+// Asynchronous file read service. Reads are submitted as requests and run
+// on a small pool of dedicated I/O threads, each with its own FileAccess,
+// so many requests can be in flight at once and the OS can reorder the
+// underlying seeks instead of serializing them behind a single thread.
+//
+// A request is either waited on (submit without callback, then wait()),
+// or fire-and-forget (submit with callback); callback requests are freed
+// after the callback returns and must not be waited on. Callbacks run on
+// an I/O thread.
+
+class FileAccessAsync {
+public:
+	typedef uint64_t RequestID;
+	typedef void (*CompletionFunc)(void *p_userdata, RequestID p_request, Error p_error, const Vector<uint8_t> &p_data);
+
+	enum {
+		READ_WHOLE_FILE = -1
+	};
+
+private:
+	struct Request {
+		RequestID id;
+		String path;
+		uint64_t offset;
+		int64_t bytes; // READ_WHOLE_FILE reads from offset to the end
+		CompletionFunc callback;
+		void *userdata;
+		Error error;
+		Vector<uint8_t> data;
+		bool done;
+		Semaphore *waiter; // created on demand by wait()
+
+		Request() {
+			id = 0;
+			offset = 0;
+			bytes = READ_WHOLE_FILE;
+			callback = NULL;
+			userdata = NULL;
+			error = OK;
+			done = false;
+			waiter = NULL;
+		}
+	};
+
+	static Mutex *mutex;
+	static Semaphore *request_semaphore;
+	static Vector<Thread *> threads;
+	static volatile bool exit_threads;
+	static Map<RequestID, Request *> requests;
+	static List<RequestID> queue;
+	static uint64_t last_request_id;
+
+	static void _thread_func(void *p_userdata);
+	static void _process_request(Request *p_request);
+
+public:
+	static RequestID submit_read(const String &p_path, uint64_t p_offset = 0, int64_t p_bytes = READ_WHOLE_FILE, CompletionFunc p_callback = NULL, void *p_userdata = NULL);
+	static Error wait(RequestID p_request, Vector<uint8_t> *r_data = NULL);
+
+	static void initialize();
+	static void finalize();
+};
+
+#endif // FILE_ACCESS_ASYNC_H
@@ -30,6 +30,8 @@
 
 #include "file_access_pack.h"
 
+#include "core/os/os.h"
+#include "core/project_settings.h"
 #include "core/version.h"
 
 #include <stdio.h>
@@ -65,6 +67,24 @@ void PackedData::add_path(const String &pkg_path, const String &path, uint64_t o
 	if (!exists || p_replace_files)
 		files[pmd5] = pf;
 
+	if (ofs != 0) {
+		//index by content MD5 (when the pack stored one) so patch packs can reference it
+		bool has_md5 = false;
+		for (int i = 0; i < 16; i++) {
+			if (p_md5[i] != 0) {
+				has_md5 = true;
+				break;
+			}
+		}
+		if (has_md5) {
+			PathMD5 cmd5;
+			copymem(&cmd5.a, p_md5, 8);
+			copymem(&cmd5.b, p_md5 + 8, 8);
+			if (!content_index.has(cmd5)) //first wins, so references resolve to the base pack
+				content_index[cmd5] = pf;
+		}
+	}
+
 	if (!exists) {
 		//search for dir
 		String p = path.replace_first("res://", "");
@@ -96,6 +116,40 @@ void PackedData::add_path(const String &pkg_path, const String &path, uint64_t o
 	}
 }
 
+void PackedData::map_pack(const String &pkg_path) {
+
+	if (mapped_packs.has(pkg_path))
+		return;
+
+	String path = pkg_path;
+	if (ProjectSettings::get_singleton())
+		path = ProjectSettings::get_singleton()->globalize_path(path);
+
+	uint64_t size = 0;
+	const uint8_t *base = OS::get_singleton()->map_file(path, size);
+	if (!base)
+		return; //platform has no mapping support or the file can't be mapped, readers go through FileAccess
+
+	MappedPack mp;
+	mp.base = base;
+	mp.size = size;
+	mapped_packs[pkg_path] = mp;
+}
+
+bool PackedData::find_content(const uint8_t *p_md5, PackedFile &r_file) const {
+
+	PathMD5 cmd5;
+	copymem(&cmd5.a, p_md5, 8);
+	copymem(&cmd5.b, p_md5 + 8, 8);
+
+	const Map<PathMD5, PackedFile>::Element *E = content_index.find(cmd5);
+	if (!E)
+		return false;
+
+	r_file = E->get();
+	return true;
+}
+
 void PackedData::add_pack_source(PackSource *p_source) {
 
 	if (p_source != NULL) {
@@ -127,6 +181,11 @@ PackedData::~PackedData() {
 	for (int i = 0; i < sources.size(); i++) {
 		memdelete(sources[i]);
 	}
+	if (OS::get_singleton()) {
+		for (Map<String, MappedPack>::Element *E = mapped_packs.front(); E; E = E->next()) {
+			OS::get_singleton()->unmap_file(E->get().base, E->get().size);
+		}
+	}
 	_free_packed_dirs(root);
 }
 
@@ -170,11 +229,12 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files)
 	uint32_t ver_minor = f->get_32();
 	f->get_32(); // patch number, not used for validation.
 
-	if (version != PACK_FORMAT_VERSION) {
+	if (version != PACK_FORMAT_VERSION && version != PACK_FORMAT_VERSION_PATCH) {
 		f->close();
 		memdelete(f);
 		ERR_FAIL_V_MSG(false, "Pack version unsupported: " + itos(version) + ".");
 	}
+	bool patch = version == PACK_FORMAT_VERSION_PATCH;
 	if (ver_major > VERSION_MAJOR || (ver_major == VERSION_MAJOR && ver_minor > VERSION_MINOR)) {
 		f->close();
 		memdelete(f);
@@ -199,15 +259,31 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files)
 		String path;
 		path.parse_utf8(cs.ptr());
 
+		uint32_t flags = patch ? f->get_32() : 0;
 		uint64_t ofs = f->get_64();
 		uint64_t size = f->get_64();
 		uint8_t md5[16];
 		f->get_buffer(md5, 16);
+
+		if (flags & PACK_FILE_REFERENCE) {
+			//data lives in a previously added pack, resolve by content MD5
+			PackedData::PackedFile content;
+			if (!PackedData::get_singleton()->find_content(md5, content)) {
+				ERR_PRINTS("Patch pack '" + p_path + "' references content not found in any base pack: " + path + ". Add the base pack first.");
+				continue;
+			}
+			PackedData::get_singleton()->add_path(content.pack, path, content.offset, content.size, md5, content.src, p_replace_files);
+			continue;
+		}
+
 		PackedData::get_singleton()->add_path(p_path, path, ofs, size, md5, this, p_replace_files);
 	};
 
 	f->close();
 	memdelete(f);
+
+	// Map the whole pack once so readers can skip FileAccess entirely.
+	PackedData::get_singleton()->map_pack(p_path);
 	return true;
 };
 
@@ -226,11 +302,14 @@ Error FileAccessPack::_open(const String &p_path, int p_mode_flags) {
 
 void FileAccessPack::close() {
 
-	f->close();
+	if (f)
+		f->close();
 }
 
 bool FileAccessPack::is_open() const {
 
+	if (map_base)
+		return true;
 	return f->is_open();
 }
 
@@ -242,7 +321,8 @@ void FileAccessPack::seek(size_t p_position) {
 		eof = false;
 	}
 
-	f->seek(pf.offset + p_position);
+	if (f)
+		f->seek(pf.offset + p_position);
 	pos = p_position;
 }
 void FileAccessPack::seek_end(int64_t p_position) {
@@ -270,6 +350,9 @@ uint8_t FileAccessPack::get_8() const {
 		return 0;
 	}
 
+	if (map_base)
+		return map_base[pf.offset + pos++];
+
 	pos++;
 	return f->get_8();
 }
@@ -285,18 +368,25 @@ int FileAccessPack::get_buffer(uint8_t *p_dst, int p_length) const {
 		to_read = int64_t(pf.size) - int64_t(pos);
 	}
 
+	uint64_t from = pos;
 	pos += p_length;
 
 	if (to_read <= 0)
 		return 0;
-	f->get_buffer(p_dst, to_read);
+
+	if (map_base) {
+		copymem(p_dst, map_base + pf.offset + from, to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
 
 	return to_read;
 }
 
 void FileAccessPack::set_endian_swap(bool p_swap) {
 	FileAccess::set_endian_swap(p_swap);
-	f->set_endian_swap(p_swap);
+	if (f)
+		f->set_endian_swap(p_swap);
 }
 
 Error FileAccessPack::get_error() const {
@@ -328,11 +418,19 @@ bool FileAccessPack::file_exists(const String &p_name) {
 
 FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file) :
 		pf(p_file),
-		f(FileAccess::open(pf.pack, FileAccess::READ)) {
+		f(NULL) {
 
-	ERR_FAIL_COND_MSG(!f, "Can't open pack-referenced file '" + String(pf.pack) + "'.");
+	uint64_t map_size = 0;
+	map_base = PackedData::get_singleton()->get_pack_mapping(pf.pack, map_size);
+	if (map_base && pf.offset + pf.size > map_size) {
+		map_base = NULL; //don't trust a mapping that can't cover the file
+	}
 
-	f->seek(pf.offset);
+	if (!map_base) {
+		f = FileAccess::open(pf.pack, FileAccess::READ);
+		ERR_FAIL_COND_MSG(!f, "Can't open pack-referenced file '" + String(pf.pack) + "'.");
+		f->seek(pf.offset);
+	}
 	pos = 0;
 	eof = false;
 }
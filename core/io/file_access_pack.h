@@ -41,6 +41,12 @@
 #define PACK_HEADER_MAGIC 0x43504447
 // The current packed file format version number.
 #define PACK_FORMAT_VERSION 1
+// Patch pack format; entries carry a flags field and may reference content
+// stored in a previously added pack instead of carrying data themselves.
+#define PACK_FORMAT_VERSION_PATCH 2
+
+// Patch pack entry flags.
+#define PACK_FILE_REFERENCE 1 // data lives in the base pack entry with the same content MD5
 
 class PackSource;
 
@@ -93,7 +99,15 @@ private:
 		};
 	};
 
+	//whole-pack memory mappings, pages are shared by every reader of the pack
+	struct MappedPack {
+		const uint8_t *base;
+		uint64_t size;
+	};
+
 	Map<PathMD5, PackedFile> files;
+	Map<PathMD5, PackedFile> content_index; //keyed by content MD5, resolves patch pack references
+	Map<String, MappedPack> mapped_packs;
 
 	Vector<PackSource *> sources;
 
@@ -108,6 +122,9 @@ private:
 public:
 	void add_pack_source(PackSource *p_source);
 	void add_path(const String &pkg_path, const String &path, uint64_t ofs, uint64_t size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files); // for PackSource
+	void map_pack(const String &pkg_path); // for PackSource, best effort
+	bool find_content(const uint8_t *p_md5, PackedFile &r_file) const; // for PackSource, O(1) by content MD5
+	_FORCE_INLINE_ const uint8_t *get_pack_mapping(const String &pkg_path, uint64_t &r_size) const;
 
 	void set_disabled(bool p_disabled) { disabled = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled() const { return disabled; }
@@ -144,7 +161,8 @@ class FileAccessPack : public FileAccess {
 	mutable size_t pos;
 	mutable bool eof;
 
-	FileAccess *f;
+	FileAccess *f; //NULL when reading from a mapped pack
+	const uint8_t *map_base;
 	virtual Error _open(const String &p_path, int p_mode_flags);
 	virtual uint64_t _get_modified_time(const String &p_file) { return 0; }
 	virtual uint32_t _get_unix_permissions(const String &p_file) { return 0; }
@@ -197,6 +215,15 @@ bool PackedData::has_path(const String &p_path) {
 	return files.has(PathMD5(p_path.md5_buffer()));
 }
 
+const uint8_t *PackedData::get_pack_mapping(const String &pkg_path, uint64_t &r_size) const {
+
+	const Map<String, MappedPack>::Element *E = mapped_packs.find(pkg_path);
+	if (!E)
+		return NULL;
+	r_size = E->get().size;
+	return E->get().base;
+}
+
 class DirAccessPack : public DirAccess {
 
 	PackedData::PackedDir *current;
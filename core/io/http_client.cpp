@@ -282,8 +282,10 @@ void HTTPClient::close() {
 	response_str.clear();
 	body_size = -1;
 	body_left = 0;
+	chunk.clear();
 	chunk_left = 0;
 	chunk_trailer_part = 0;
+	chunk_consumed = false;
 	read_until_eof = false;
 	response_num = 0;
 	handshaking = false;
@@ -517,15 +519,21 @@ int HTTPClient::get_response_body_length() const {
 	return body_size;
 }
 
-PoolByteArray HTTPClient::read_response_body_chunk() {
+Error HTTPClient::_read_response_body(const uint8_t **r_data, int &r_size) {
 
-	ERR_FAIL_COND_V(status != STATUS_BODY, PoolByteArray());
+	*r_data = NULL;
+	r_size = 0;
 
-	PoolByteArray ret;
 	Error err = OK;
 
 	if (chunked) {
 
+		if (chunk_consumed) {
+			// The previous call handed out a pointer into 'chunk', reclaim it now
+			chunk.clear();
+			chunk_consumed = false;
+		}
+
 		while (true) {
 
 			if (chunk_trailer_part) {
@@ -621,10 +629,10 @@ PoolByteArray HTTPClient::read_response_body_chunk() {
 						break;
 					}
 
-					ret.resize(chunk.size() - 2);
-					PoolByteArray::Write w = ret.write();
-					copymem(w.ptr(), chunk.ptr(), chunk.size() - 2);
-					chunk.clear();
+					// Hand out the payload without copying; reclaimed on the next call
+					*r_data = chunk.ptr();
+					r_size = chunk.size() - 2;
+					chunk_consumed = true;
 				}
 
 				break;
@@ -634,16 +642,14 @@ PoolByteArray HTTPClient::read_response_body_chunk() {
 	} else {
 
 		int to_read = !read_until_eof ? MIN(body_left, read_chunk_size) : read_chunk_size;
-		ret.resize(to_read);
+		if (body_read_buffer.size() < to_read) {
+			body_read_buffer.resize(to_read); // Grown once, then reused across calls
+		}
 		int _offset = 0;
 		while (to_read > 0) {
 			int rec = 0;
-			{
-				PoolByteArray::Write w = ret.write();
-				err = _get_http_data(w.ptr() + _offset, to_read, rec);
-			}
+			err = _get_http_data(body_read_buffer.ptrw() + _offset, to_read, rec);
 			if (rec <= 0) { // Ended up reading less
-				ret.resize(_offset);
 				break;
 			} else {
 				_offset += rec;
@@ -655,6 +661,9 @@ PoolByteArray HTTPClient::read_response_body_chunk() {
 			if (err != OK)
 				break;
 		}
+
+		*r_data = body_read_buffer.ptr();
+		r_size = _offset;
 	}
 
 	if (err != OK) {
@@ -673,9 +682,46 @@ PoolByteArray HTTPClient::read_response_body_chunk() {
 		status = STATUS_CONNECTED;
 	}
 
+	return err;
+}
+
+PoolByteArray HTTPClient::read_response_body_chunk() {
+
+	ERR_FAIL_COND_V(status != STATUS_BODY, PoolByteArray());
+
+	const uint8_t *data = NULL;
+	int size = 0;
+	_read_response_body(&data, size);
+
+	PoolByteArray ret;
+
+	if (size > 0) {
+		ret.resize(size);
+		PoolByteArray::Write w = ret.write();
+		copymem(w.ptr(), data, size);
+	}
+
 	return ret;
 }
 
+Error HTTPClient::read_response_body_stream(ReadBodyChunkCallback p_callback, void *p_userdata, int &r_size) {
+
+	ERR_FAIL_COND_V(status != STATUS_BODY, ERR_UNCONFIGURED);
+
+	const uint8_t *data = NULL;
+	r_size = 0;
+	_read_response_body(&data, r_size);
+
+	if (r_size > 0) {
+		Error cb_err = p_callback(p_userdata, data, r_size);
+		if (cb_err != OK) {
+			return cb_err;
+		}
+	}
+
+	return OK;
+}
+
 HTTPClient::Status HTTPClient::get_status() const {
 
 	return status;
@@ -741,6 +787,7 @@ HTTPClient::HTTPClient() {
 	read_until_eof = false;
 	chunk_left = 0;
 	chunk_trailer_part = false;
+	chunk_consumed = false;
 	response_num = 0;
 	ssl = false;
 	blocking = false;
@@ -174,6 +174,8 @@ private:
 	Vector<uint8_t> chunk;
 	int chunk_left;
 	bool chunk_trailer_part;
+	bool chunk_consumed; // Last chunk was handed out zero-copy, reclaim before reading on
+	Vector<uint8_t> body_read_buffer; // Reused across reads in the non-chunked path
 	int body_size;
 	int body_left;
 	bool read_until_eof;
@@ -186,6 +188,7 @@ private:
 	int read_chunk_size;
 
 	Error _get_http_data(uint8_t *p_buffer, int p_bytes, int &r_received);
+	Error _read_response_body(const uint8_t **r_data, int &r_size);
 
 #else
 #include "platform/javascript/http_client.h.inc"
@@ -217,6 +220,12 @@ public:
 
 	PoolByteArray read_response_body_chunk(); // Can't get body as partial text because of most encodings UTF8, gzip, etc.
 
+	// Streaming sink: the next body chunk is handed to the callback straight from
+	// the client's internal buffer, with no PoolByteArray allocation or
+	// concatenation. The pointer is only valid for the duration of the call.
+	typedef Error (*ReadBodyChunkCallback)(void *p_userdata, const uint8_t *p_data, int p_size);
+	Error read_response_body_stream(ReadBodyChunkCallback p_callback, void *p_userdata, int &r_size);
+
 	void set_blocking_mode(bool p_enable); // Useful mostly if running in a thread
 	bool is_blocking_mode_enabled() const;
 
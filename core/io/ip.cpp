@@ -43,12 +43,14 @@ struct _IP_ResolverPrivate {
 	struct QueueItem {
 
 		volatile IP::ResolverStatus status;
+		bool in_progress; // Claimed by a worker thread.
 		IP_Address response;
 		String hostname;
 		IP::Type type;
 
 		void clear() {
 			status = IP::RESOLVER_STATUS_NONE;
+			in_progress = false;
 			response = IP_Address();
 			type = IP::TYPE_NONE;
 			hostname = "";
@@ -70,25 +72,60 @@ struct _IP_ResolverPrivate {
 		return IP::RESOLVER_INVALID_ID;
 	}
 
+	enum {
+		RESOLVER_THREAD_COUNT = 4
+	};
+
 	Mutex *mutex;
 	Semaphore *sem;
 
-	Thread *thread;
-	//Semaphore* semaphore;
+	Thread *threads[RESOLVER_THREAD_COUNT];
+	int thread_count;
 	bool thread_abort;
 
-	void resolve_queues() {
+	// Must be called with the mutex held. Claims one waiting request for
+	// the calling thread, so multiple workers resolve different hostnames
+	// in parallel.
+	bool find_next_request(String &r_hostname, IP::Type &r_type) {
 
 		for (int i = 0; i < IP::RESOLVER_MAX_QUERIES; i++) {
 
-			if (queue[i].status != IP::RESOLVER_STATUS_WAITING)
+			if (queue[i].status != IP::RESOLVER_STATUS_WAITING || queue[i].in_progress)
 				continue;
-			queue[i].response = IP::get_singleton()->resolve_hostname(queue[i].hostname, queue[i].type);
+			queue[i].in_progress = true;
+			r_hostname = queue[i].hostname;
+			r_type = queue[i].type;
+			return true;
+		}
+		return false;
+	}
+
+	// Must be called with the mutex held. Completes every claimed request
+	// for the given hostname, so duplicate queries issued while one was in
+	// flight are answered by a single OS lookup.
+	void complete_requests(const String &p_hostname, IP::Type p_type, const IP_Address &p_response) {
 
-			if (!queue[i].response.is_valid())
-				queue[i].status = IP::RESOLVER_STATUS_ERROR;
-			else
-				queue[i].status = IP::RESOLVER_STATUS_DONE;
+		for (int i = 0; i < IP::RESOLVER_MAX_QUERIES; i++) {
+
+			if (!queue[i].in_progress || queue[i].status != IP::RESOLVER_STATUS_WAITING)
+				continue;
+			if (queue[i].hostname != p_hostname || queue[i].type != p_type)
+				continue;
+
+			queue[i].in_progress = false;
+			queue[i].response = p_response;
+			queue[i].status = p_response.is_valid() ? IP::RESOLVER_STATUS_DONE : IP::RESOLVER_STATUS_ERROR;
+			IP::get_singleton()->call_deferred("emit_signal", "resolve_completed", i, String(p_response), queue[i].status);
+		}
+	}
+
+	void resolve_queues() {
+
+		// Synchronous fallback when no worker threads are available.
+		String hostname;
+		IP::Type type = IP::TYPE_NONE;
+		while (find_next_request(hostname, type)) {
+			complete_requests(hostname, type, IP::get_singleton()->resolve_hostname(hostname, type));
 		}
 	}
 
@@ -100,13 +137,51 @@ struct _IP_ResolverPrivate {
 
 			ipr->sem->wait();
 
-			ipr->mutex->lock();
-			ipr->resolve_queues();
-			ipr->mutex->unlock();
+			while (true) {
+
+				ipr->mutex->lock();
+				String hostname;
+				IP::Type type = IP::TYPE_NONE;
+				if (!ipr->find_next_request(hostname, type)) {
+					ipr->mutex->unlock();
+					break;
+				}
+				ipr->mutex->unlock();
+
+				// The blocking OS query runs outside the lock, so status
+				// polls and other lookups never stall behind it.
+				IP_Address response = IP::get_singleton()->resolve_hostname(hostname, type);
+
+				ipr->mutex->lock();
+				ipr->complete_requests(hostname, type, response);
+				ipr->mutex->unlock();
+			}
 		}
 	}
 
-	HashMap<String, IP_Address> cache;
+	struct CacheEntry {
+
+		IP_Address address;
+		uint64_t expiry_msec; // 0 means the entry never expires.
+	};
+
+	HashMap<String, CacheEntry> cache;
+	int cache_ttl;
+
+	bool cache_entry_valid(const CacheEntry &p_entry) const {
+
+		if (!p_entry.address.is_valid())
+			return false;
+		return p_entry.expiry_msec == 0 || OS::get_singleton()->get_ticks_msec() < p_entry.expiry_msec;
+	}
+
+	void cache_store(const String &p_key, const IP_Address &p_address) {
+
+		CacheEntry entry;
+		entry.address = p_address;
+		entry.expiry_msec = cache_ttl > 0 ? OS::get_singleton()->get_ticks_msec() + (uint64_t)cache_ttl * 1000 : 0;
+		cache[p_key] = entry;
+	}
 
 	static String get_cache_key(String p_hostname, IP::Type p_type) {
 		return itos(p_type) + p_hostname;
@@ -115,17 +190,23 @@ struct _IP_ResolverPrivate {
 
 IP_Address IP::resolve_hostname(const String &p_hostname, IP::Type p_type) {
 
-	resolver->mutex->lock();
-
 	String key = _IP_ResolverPrivate::get_cache_key(p_hostname, p_type);
-	if (resolver->cache.has(key) && resolver->cache[key].is_valid()) {
-		IP_Address res = resolver->cache[key];
+
+	resolver->mutex->lock();
+	const _IP_ResolverPrivate::CacheEntry *entry = resolver->cache.getptr(key);
+	if (entry && resolver->cache_entry_valid(*entry)) {
+		IP_Address res = entry->address;
 		resolver->mutex->unlock();
 		return res;
 	}
+	resolver->mutex->unlock();
 
+	// Resolve without holding the lock; concurrent callers may query the OS
+	// in parallel for different hostnames.
 	IP_Address res = _resolve_hostname(p_hostname, p_type);
-	resolver->cache[key] = res;
+
+	resolver->mutex->lock();
+	resolver->cache_store(key, res);
 	resolver->mutex->unlock();
 	return res;
 }
@@ -145,13 +226,16 @@ IP::ResolverID IP::resolve_hostname_queue_item(const String &p_hostname, IP::Typ
 	String key = _IP_ResolverPrivate::get_cache_key(p_hostname, p_type);
 	resolver->queue[id].hostname = p_hostname;
 	resolver->queue[id].type = p_type;
-	if (resolver->cache.has(key) && resolver->cache[key].is_valid()) {
-		resolver->queue[id].response = resolver->cache[key];
+	resolver->queue[id].in_progress = false;
+	const _IP_ResolverPrivate::CacheEntry *entry = resolver->cache.getptr(key);
+	if (entry && resolver->cache_entry_valid(*entry)) {
+		resolver->queue[id].response = entry->address;
 		resolver->queue[id].status = IP::RESOLVER_STATUS_DONE;
+		call_deferred("emit_signal", "resolve_completed", id, String(entry->address), IP::RESOLVER_STATUS_DONE);
 	} else {
 		resolver->queue[id].response = IP_Address();
 		resolver->queue[id].status = IP::RESOLVER_STATUS_WAITING;
-		if (resolver->thread)
+		if (resolver->thread_count > 0)
 			resolver->sem->post();
 		else
 			resolver->resolve_queues();
@@ -206,6 +290,19 @@ void IP::erase_resolve_item(ResolverID p_id) {
 	resolver->mutex->unlock();
 }
 
+void IP::set_cache_ttl(int p_seconds) {
+
+	ERR_FAIL_COND(p_seconds < 0);
+	resolver->mutex->lock();
+	resolver->cache_ttl = p_seconds;
+	resolver->mutex->unlock();
+}
+
+int IP::get_cache_ttl() const {
+
+	return resolver->cache_ttl;
+}
+
 void IP::clear_cache(const String &p_hostname) {
 
 	resolver->mutex->lock();
@@ -279,6 +376,10 @@ void IP::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_local_addresses"), &IP::_get_local_addresses);
 	ClassDB::bind_method(D_METHOD("get_local_interfaces"), &IP::_get_local_interfaces);
 	ClassDB::bind_method(D_METHOD("clear_cache", "hostname"), &IP::clear_cache, DEFVAL(""));
+	ClassDB::bind_method(D_METHOD("set_cache_ttl", "seconds"), &IP::set_cache_ttl);
+	ClassDB::bind_method(D_METHOD("get_cache_ttl"), &IP::get_cache_ttl);
+
+	ADD_SIGNAL(MethodInfo("resolve_completed", PropertyInfo(Variant::INT, "id"), PropertyInfo(Variant::STRING, "address"), PropertyInfo(Variant::INT, "status")));
 
 	BIND_ENUM_CONSTANT(RESOLVER_STATUS_NONE);
 	BIND_ENUM_CONSTANT(RESOLVER_STATUS_WAITING);
@@ -316,6 +417,8 @@ IP::IP() {
 	resolver = memnew(_IP_ResolverPrivate);
 	resolver->sem = NULL;
 	resolver->mutex = Mutex::create();
+	resolver->thread_count = 0;
+	resolver->cache_ttl = 300;
 
 #ifndef NO_THREADS
 
@@ -323,27 +426,34 @@ IP::IP() {
 	if (resolver->sem) {
 		resolver->thread_abort = false;
 
-		resolver->thread = Thread::create(_IP_ResolverPrivate::_thread_function, resolver);
+		for (int i = 0; i < _IP_ResolverPrivate::RESOLVER_THREAD_COUNT; i++) {
+
+			Thread *thread = Thread::create(_IP_ResolverPrivate::_thread_function, resolver);
+			if (!thread)
+				break;
+			resolver->threads[resolver->thread_count++] = thread;
+		}
 
-		if (!resolver->thread)
+		if (resolver->thread_count == 0) {
 			memdelete(resolver->sem); //wtf
-	} else {
-		resolver->thread = NULL;
+			resolver->sem = NULL;
+		}
 	}
-#else
-	resolver->sem = NULL;
-	resolver->thread = NULL;
 #endif
 }
 
 IP::~IP() {
 
 #ifndef NO_THREADS
-	if (resolver->thread) {
+	if (resolver->thread_count > 0) {
 		resolver->thread_abort = true;
-		resolver->sem->post();
-		Thread::wait_to_finish(resolver->thread);
-		memdelete(resolver->thread);
+		for (int i = 0; i < resolver->thread_count; i++) {
+			resolver->sem->post();
+		}
+		for (int i = 0; i < resolver->thread_count; i++) {
+			Thread::wait_to_finish(resolver->threads[i]);
+			memdelete(resolver->threads[i]);
+		}
 		memdelete(resolver->sem);
 	}
 
@@ -94,6 +94,8 @@ public:
 	virtual void get_local_interfaces(Map<String, Interface_Info> *r_interfaces) const = 0;
 	void erase_resolve_item(ResolverID p_id);
 
+	void set_cache_ttl(int p_seconds);
+	int get_cache_ttl() const;
 	void clear_cache(const String &p_hostname = "");
 
 	static IP *get_singleton();
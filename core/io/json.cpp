@@ -178,6 +178,36 @@ Error JSON::_get_token(const CharType *p_str, int &index, int p_len, Token &r_to
 
 				index++;
 				String str;
+				//fast path, scan ahead for the closing quote; strings without escapes
+				//(the vast majority) become a single bulk copy instead of per-character appends
+				{
+					int end = index;
+					bool has_escape = false;
+					while (p_str[end] != 0 && p_str[end] != '"') {
+						if (p_str[end] == '\\') {
+							has_escape = true;
+							break;
+						}
+						if (p_str[end] == '\n')
+							line++;
+						end++;
+					}
+					if (!has_escape) {
+						if (p_str[end] == 0) {
+							r_err_str = "Unterminated String";
+							return ERR_PARSE_ERROR;
+						}
+						r_token.type = TK_STRING;
+						r_token.value = String(&p_str[index], end - index);
+						index = end + 1;
+						return OK;
+					}
+					//escapes present, take the slow path below but bulk-copy the clean prefix
+					if (end > index) {
+						str = String(&p_str[index], end - index);
+						index = end;
+					}
+				}
 				while (true) {
 					if (p_str[index] == 0) {
 						r_err_str = "Unterminated String";
@@ -279,16 +309,15 @@ Error JSON::_get_token(const CharType *p_str, int &index, int p_len, Token &r_to
 
 				} else if ((p_str[index] >= 'A' && p_str[index] <= 'Z') || (p_str[index] >= 'a' && p_str[index] <= 'z')) {
 
-					String id;
+					int from = index;
 
 					while ((p_str[index] >= 'A' && p_str[index] <= 'Z') || (p_str[index] >= 'a' && p_str[index] <= 'z')) {
 
-						id += p_str[index];
 						index++;
 					}
 
 					r_token.type = TK_IDENTIFIER;
-					r_token.value = id;
+					r_token.value = String(&p_str[from], index - from);
 					return OK;
 				} else {
 					r_err_str = "Unexpected character.";
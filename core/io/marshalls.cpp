@@ -549,10 +549,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			if (count) {
 				data.resize(count);
 				PoolVector<uint8_t>::Write w = data.write();
-				for (int32_t i = 0; i < count; i++) {
-
-					w[i] = buf[i];
-				}
+				copymem(w.ptr(), buf, count);
 			}
 
 			r_variant = data;
@@ -576,13 +573,18 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			PoolVector<int> data;
 
 			if (count) {
-				//const int*rbuf=(const int*)buf;
 				data.resize(count);
 				PoolVector<int>::Write w = data.write();
-				for (int32_t i = 0; i < count; i++) {
+				copymem(w.ptr(), buf, count * 4);
+#ifdef BIG_ENDIAN_ENABLED
+				{
+					uint32_t *ptr = (uint32_t *)w.ptr();
+					for (int32_t i = 0; i < count; i++) {
 
-					w[i] = decode_uint32(&buf[i * 4]);
+						ptr[i] = BSWAP32(ptr[i]);
+					}
 				}
+#endif
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -602,13 +604,18 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			PoolVector<float> data;
 
 			if (count) {
-				//const float*rbuf=(const float*)buf;
 				data.resize(count);
 				PoolVector<float>::Write w = data.write();
-				for (int32_t i = 0; i < count; i++) {
+				copymem(w.ptr(), buf, count * 4);
+#ifdef BIG_ENDIAN_ENABLED
+				{
+					uint32_t *ptr = (uint32_t *)w.ptr();
+					for (int32_t i = 0; i < count; i++) {
 
-					w[i] = decode_float(&buf[i * 4]);
+						ptr[i] = BSWAP32(ptr[i]);
+					}
 				}
+#endif
 			}
 			r_variant = data;
 
@@ -662,11 +669,25 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 				varray.resize(count);
 				PoolVector<Vector2>::Write w = varray.write();
 
+#ifdef REAL_T_IS_DOUBLE
 				for (int32_t i = 0; i < count; i++) {
 
 					w[i].x = decode_float(buf + i * 4 * 2 + 4 * 0);
 					w[i].y = decode_float(buf + i * 4 * 2 + 4 * 1);
 				}
+#else
+				// Wire layout matches the in-memory layout, copy whole.
+				copymem(w.ptr(), buf, count * 4 * 2);
+#ifdef BIG_ENDIAN_ENABLED
+				{
+					uint32_t *ptr = (uint32_t *)w.ptr();
+					for (int32_t i = 0; i < count * 2; i++) {
+
+						ptr[i] = BSWAP32(ptr[i]);
+					}
+				}
+#endif
+#endif
 
 				int adv = 4 * 2 * count;
 
@@ -697,12 +718,26 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 				varray.resize(count);
 				PoolVector<Vector3>::Write w = varray.write();
 
+#ifdef REAL_T_IS_DOUBLE
 				for (int32_t i = 0; i < count; i++) {
 
 					w[i].x = decode_float(buf + i * 4 * 3 + 4 * 0);
 					w[i].y = decode_float(buf + i * 4 * 3 + 4 * 1);
 					w[i].z = decode_float(buf + i * 4 * 3 + 4 * 2);
 				}
+#else
+				// Wire layout matches the in-memory layout, copy whole.
+				copymem(w.ptr(), buf, count * 4 * 3);
+#ifdef BIG_ENDIAN_ENABLED
+				{
+					uint32_t *ptr = (uint32_t *)w.ptr();
+					for (int32_t i = 0; i < count * 3; i++) {
+
+						ptr[i] = BSWAP32(ptr[i]);
+					}
+				}
+#endif
+#endif
 
 				int adv = 4 * 3 * count;
 
@@ -733,13 +768,17 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 				carray.resize(count);
 				PoolVector<Color>::Write w = carray.write();
 
-				for (int32_t i = 0; i < count; i++) {
+				// Color is always four floats, wire layout matches the in-memory layout.
+				copymem(w.ptr(), buf, count * 4 * 4);
+#ifdef BIG_ENDIAN_ENABLED
+				{
+					uint32_t *ptr = (uint32_t *)w.ptr();
+					for (int32_t i = 0; i < count * 4; i++) {
 
-					w[i].r = decode_float(buf + i * 4 * 4 + 4 * 0);
-					w[i].g = decode_float(buf + i * 4 * 4 + 4 * 1);
-					w[i].b = decode_float(buf + i * 4 * 4 + 4 * 2);
-					w[i].a = decode_float(buf + i * 4 * 4 + 4 * 3);
+						ptr[i] = BSWAP32(ptr[i]);
+					}
 				}
+#endif
 
 				int adv = 4 * 4 * count;
 
@@ -122,6 +122,9 @@ void MultiplayerAPI::poll() {
 			break; // It's also possible that a packet or RPC caused a disconnection, so also check here.
 		}
 	}
+
+	// Everything queued while processing this tick (and during the frame before it) goes out coalesced.
+	flush_batches();
 }
 
 void MultiplayerAPI::clear() {
@@ -129,6 +132,7 @@ void MultiplayerAPI::clear() {
 	path_get_cache.clear();
 	path_send_cache.clear();
 	packet_cache.clear();
+	send_batches.clear();
 	last_send_cache_id = 1;
 }
 
@@ -230,6 +234,11 @@ void MultiplayerAPI::_process_packet(int p_from, const uint8_t *p_packet, int p_
 
 			_process_raw(p_from, p_packet, p_packet_len);
 		} break;
+
+		case NETWORK_COMMAND_BATCH: {
+
+			_process_batch(p_from, p_packet, p_packet_len);
+		} break;
 	}
 }
 
@@ -553,14 +562,12 @@ void MultiplayerAPI::_send_rpc(Node *p_from, int p_to, bool p_unreliable, bool p
 	// See if all peers have cached path (is so, call can be fast).
 	bool has_all_peers = _send_confirm_path(from_path, psc, p_to);
 
-	// Take chance and set transfer mode, since all send methods will use it.
-	network_peer->set_transfer_mode(p_unreliable ? NetworkedMultiplayerPeer::TRANSFER_MODE_UNRELIABLE : NetworkedMultiplayerPeer::TRANSFER_MODE_RELIABLE);
+	NetworkedMultiplayerPeer::TransferMode mode = p_unreliable ? NetworkedMultiplayerPeer::TRANSFER_MODE_UNRELIABLE : NetworkedMultiplayerPeer::TRANSFER_MODE_RELIABLE;
 
 	if (has_all_peers) {
 
 		// They all have verified paths, so send fast.
-		network_peer->set_target_peer(p_to); // To all of you.
-		network_peer->put_packet(packet_cache.ptr(), ofs); // A message with love.
+		_send_packet(p_to, mode, packet_cache.ptr(), ofs); // A message with love.
 	} else {
 		// Not all verified path, so send one by one.
 
@@ -581,21 +588,72 @@ void MultiplayerAPI::_send_rpc(Node *p_from, int p_to, bool p_unreliable, bool p
 			Map<int, bool>::Element *F = psc->confirmed_peers.find(E->get());
 			ERR_CONTINUE(!F); // Should never happen.
 
-			network_peer->set_target_peer(E->get()); // To this one specifically.
-
 			if (F->get()) {
 				// This one confirmed path, so use id.
 				encode_uint32(psc->id, &(packet_cache.write[1]));
-				network_peer->put_packet(packet_cache.ptr(), ofs);
+				_send_packet(E->get(), mode, packet_cache.ptr(), ofs);
 			} else {
 				// This one did not confirm path yet, so use entire path (sorry!).
 				encode_uint32(0x80000000 | ofs, &(packet_cache.write[1])); // Offset to path and flag.
-				network_peer->put_packet(packet_cache.ptr(), ofs + path_len);
+				_send_packet(E->get(), mode, packet_cache.ptr(), ofs + path_len);
 			}
 		}
 	}
 }
 
+void MultiplayerAPI::_send_packet(int p_to, NetworkedMultiplayerPeer::TransferMode p_mode, const uint8_t *p_data, int p_len) {
+
+	if (!batching_enabled) {
+		network_peer->set_transfer_mode(p_mode);
+		network_peer->set_target_peer(p_to);
+		network_peer->put_packet(p_data, p_len);
+		return;
+	}
+
+	// One datagram may not mix transfer modes or targets, so buffers are keyed by both.
+	int64_t key = ((int64_t)p_to << 2) | (int64_t)p_mode;
+	SendBatch &batch = send_batches[key];
+
+	if (batch.data.empty()) {
+		batch.data.push_back(NETWORK_COMMAND_BATCH);
+	} else if (batch.data.size() + 4 + p_len > BATCH_FLUSH_SIZE) {
+		// Keep coalesced datagrams under the typical MTU, send what was gathered so far.
+		network_peer->set_transfer_mode(p_mode);
+		network_peer->set_target_peer(p_to);
+		network_peer->put_packet(batch.data.ptr(), batch.data.size());
+		batch.data.resize(1);
+	}
+
+	int ofs = batch.data.size();
+	batch.data.resize(ofs + 4 + p_len);
+	encode_uint32(p_len, &(batch.data.write[ofs]));
+	memcpy(&(batch.data.write[ofs + 4]), p_data, p_len);
+}
+
+void MultiplayerAPI::flush_batches() {
+
+	if (send_batches.empty())
+		return;
+
+	if (!network_peer.is_valid()) {
+		send_batches.clear();
+		return;
+	}
+
+	for (Map<int64_t, SendBatch>::Element *E = send_batches.front(); E; E = E->next()) {
+
+		const SendBatch &batch = E->get();
+		if (batch.data.size() <= 1)
+			continue; // Nothing was queued after the command byte.
+
+		network_peer->set_transfer_mode((NetworkedMultiplayerPeer::TransferMode)(E->key() & 0x3));
+		network_peer->set_target_peer((int)(E->key() >> 2));
+		network_peer->put_packet(batch.data.ptr(), batch.data.size());
+	}
+
+	send_batches.clear();
+}
+
 void MultiplayerAPI::_add_peer(int p_id) {
 	connected_peers.insert(p_id);
 	path_get_cache.insert(p_id, PathGetCache());
@@ -809,6 +867,25 @@ void MultiplayerAPI::_process_raw(int p_from, const uint8_t *p_packet, int p_pac
 	emit_signal("network_peer_packet", p_from, out);
 }
 
+void MultiplayerAPI::_process_batch(int p_from, const uint8_t *p_packet, int p_packet_len) {
+
+	int ofs = 1;
+	while (ofs < p_packet_len) {
+
+		ERR_FAIL_COND_MSG(ofs + 4 > p_packet_len, "Invalid batch packet received. Size too small.");
+		uint32_t size = decode_uint32(&p_packet[ofs]);
+		ofs += 4;
+		ERR_FAIL_COND_MSG(size < 1 || ofs + (int)size > p_packet_len, "Invalid batch packet received. Sub-packet size mismatch.");
+		ERR_FAIL_COND_MSG(p_packet[ofs] == NETWORK_COMMAND_BATCH, "Invalid batch packet received. Batches can not be nested.");
+
+		_process_packet(p_from, &p_packet[ofs], size);
+		ofs += size;
+
+		if (!network_peer.is_valid())
+			return; // A sub-packet may have caused a disconnection.
+	}
+}
+
 int MultiplayerAPI::get_network_unique_id() const {
 
 	ERR_FAIL_COND_V_MSG(!network_peer.is_valid(), 0, "No network peer is assigned. Unable to get unique network ID.");
@@ -856,6 +933,19 @@ bool MultiplayerAPI::is_object_decoding_allowed() const {
 	return allow_object_decoding;
 }
 
+void MultiplayerAPI::set_packet_batching_enabled(bool p_enabled) {
+
+	if (batching_enabled && !p_enabled) {
+		flush_batches(); // Don't lose whatever was queued so far.
+	}
+	batching_enabled = p_enabled;
+}
+
+bool MultiplayerAPI::is_packet_batching_enabled() const {
+
+	return batching_enabled;
+}
+
 void MultiplayerAPI::profiling_start() {
 #ifdef DEBUG_ENABLED
 	profiling = true;
@@ -967,8 +1057,11 @@ void MultiplayerAPI::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_refusing_new_network_connections"), &MultiplayerAPI::is_refusing_new_network_connections);
 	ClassDB::bind_method(D_METHOD("set_allow_object_decoding", "enable"), &MultiplayerAPI::set_allow_object_decoding);
 	ClassDB::bind_method(D_METHOD("is_object_decoding_allowed"), &MultiplayerAPI::is_object_decoding_allowed);
+	ClassDB::bind_method(D_METHOD("set_packet_batching_enabled", "enabled"), &MultiplayerAPI::set_packet_batching_enabled);
+	ClassDB::bind_method(D_METHOD("is_packet_batching_enabled"), &MultiplayerAPI::is_packet_batching_enabled);
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "allow_object_decoding"), "set_allow_object_decoding", "is_object_decoding_allowed");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "packet_batching"), "set_packet_batching_enabled", "is_packet_batching_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "refuse_new_network_connections"), "set_refuse_new_network_connections", "is_refusing_new_network_connections");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "network_peer", PROPERTY_HINT_RESOURCE_TYPE, "NetworkedMultiplayerPeer", 0), "set_network_peer", "get_network_peer");
 	ADD_PROPERTY_DEFAULT("refuse_new_network_connections", false);
@@ -995,6 +1088,7 @@ MultiplayerAPI::MultiplayerAPI() :
 		allow_object_decoding(false) {
 	rpc_sender_id = 0;
 	root_node = NULL;
+	batching_enabled = false;
 #ifdef DEBUG_ENABLED
 	profiling = false;
 #endif
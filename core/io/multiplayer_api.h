@@ -92,6 +92,18 @@ private:
 	Node *root_node;
 	bool allow_object_decoding;
 
+	//outgoing coalescing, one buffer per (target, transfer mode) pair
+	struct SendBatch {
+		Vector<uint8_t> data; //command byte followed by length prefixed sub-packets
+	};
+
+	enum {
+		BATCH_FLUSH_SIZE = 1350 //soft cap so coalesced datagrams stay under the typical MTU
+	};
+
+	bool batching_enabled;
+	Map<int64_t, SendBatch> send_batches;
+
 protected:
 	static void _bind_methods();
 
@@ -102,9 +114,12 @@ protected:
 	void _process_rpc(Node *p_node, const StringName &p_name, int p_from, const uint8_t *p_packet, int p_packet_len, int p_offset);
 	void _process_rset(Node *p_node, const StringName &p_name, int p_from, const uint8_t *p_packet, int p_packet_len, int p_offset);
 	void _process_raw(int p_from, const uint8_t *p_packet, int p_packet_len);
+	void _process_batch(int p_from, const uint8_t *p_packet, int p_packet_len);
 
 	void _send_rpc(Node *p_from, int p_to, bool p_unreliable, bool p_set, const StringName &p_name, const Variant **p_arg, int p_argcount);
 	bool _send_confirm_path(NodePath p_path, PathSentCache *psc, int p_target);
+	void _send_packet(int p_to, NetworkedMultiplayerPeer::TransferMode p_mode, const uint8_t *p_data, int p_len);
+	void flush_batches();
 
 public:
 	enum NetworkCommands {
@@ -113,6 +128,7 @@ public:
 		NETWORK_COMMAND_SIMPLIFY_PATH,
 		NETWORK_COMMAND_CONFIRM_PATH,
 		NETWORK_COMMAND_RAW,
+		NETWORK_COMMAND_BATCH,
 	};
 
 	enum RPCMode {
@@ -157,6 +173,9 @@ public:
 	void set_allow_object_decoding(bool p_enable);
 	bool is_object_decoding_allowed() const;
 
+	void set_packet_batching_enabled(bool p_enabled);
+	bool is_packet_batching_enabled() const;
+
 	void profiling_start();
 	void profiling_end();
 
@@ -40,3 +40,48 @@ NetSocket *NetSocket::create() {
 	ERR_PRINT("Unable to create network socket, platform not supported");
 	return NULL;
 }
+
+Error NetSocket::recv_multiple(Message *p_messages, int p_count, int &r_received) {
+
+	r_received = 0;
+
+	while (r_received < p_count) {
+
+		Message &msg = p_messages[r_received];
+		Error err = recvfrom(msg.buffer, msg.buffer_size, msg.size, msg.ip, msg.port);
+
+		if (err != OK) {
+			if (err == ERR_BUSY) {
+				// Nothing else pending; partial batches are fine.
+				return r_received > 0 ? OK : ERR_BUSY;
+			}
+			return err;
+		}
+
+		r_received++;
+	}
+
+	return OK;
+}
+
+Error NetSocket::send_multiple(Message *p_messages, int p_count, int &r_sent) {
+
+	r_sent = 0;
+
+	while (r_sent < p_count) {
+
+		Message &msg = p_messages[r_sent];
+		Error err = sendto(msg.buffer, msg.buffer_size, msg.size, msg.ip, msg.port);
+
+		if (err != OK) {
+			if (err == ERR_BUSY) {
+				return r_sent > 0 ? OK : ERR_BUSY;
+			}
+			return err;
+		}
+
+		r_sent++;
+	}
+
+	return OK;
+}
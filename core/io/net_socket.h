@@ -54,6 +54,15 @@ public:
 		TYPE_UDP,
 	};
 
+	struct Message {
+
+		uint8_t *buffer; // Data in (send) / out (recv)
+		int buffer_size; // Send: bytes to send. Recv: buffer capacity.
+		int size; // Out: bytes actually sent / received
+		IP_Address ip; // Send: destination. Recv: source.
+		uint16_t port;
+	};
+
 	virtual Error open(Type p_type, IP::Type &ip_type) = 0;
 	virtual void close() = 0;
 	virtual Error bind(IP_Address p_addr, uint16_t p_port) = 0;
@@ -64,6 +73,11 @@ public:
 	virtual Error recvfrom(uint8_t *p_buffer, int p_len, int &r_read, IP_Address &r_ip, uint16_t &r_port) = 0;
 	virtual Error send(const uint8_t *p_buffer, int p_len, int &r_sent) = 0;
 	virtual Error sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IP_Address p_ip, uint16_t p_port) = 0;
+	// Datagram batching: move up to p_count messages in as few syscalls as the
+	// platform allows (recvmmsg/sendmmsg where available). The default
+	// implementations fall back to one recvfrom/sendto per message.
+	virtual Error recv_multiple(Message *p_messages, int p_count, int &r_received);
+	virtual Error send_multiple(Message *p_messages, int p_count, int &r_sent);
 	virtual Ref<NetSocket> accept(IP_Address &r_ip, uint16_t &r_port) = 0;
 
 	virtual bool is_open() const = 0;
@@ -206,13 +206,21 @@ Error PacketPeerUDP::_poll() {
 		return FAILED;
 	}
 
-	Error err;
-	int read;
-	IP_Address ip;
-	uint16_t port;
+	if (batch_buffer.size() == 0) {
+		batch_buffer.resize(PACKET_BATCH_COUNT * PACKET_BUFFER_SIZE);
+	}
+
+	NetSocket::Message msgs[PACKET_BATCH_COUNT];
 
 	while (true) {
-		err = _sock->recvfrom(recv_buffer, sizeof(recv_buffer), read, ip, port);
+
+		for (int i = 0; i < PACKET_BATCH_COUNT; i++) {
+			msgs[i].buffer = &batch_buffer.write[i * PACKET_BUFFER_SIZE];
+			msgs[i].buffer_size = PACKET_BUFFER_SIZE;
+		}
+
+		int received = 0;
+		Error err = _sock->recv_multiple(msgs, PACKET_BATCH_COUNT, received);
 
 		if (err != OK) {
 			if (err == ERR_BUSY)
@@ -220,19 +228,28 @@ Error PacketPeerUDP::_poll() {
 			return FAILED;
 		}
 
-		if (rb.space_left() < read + 24) {
+		for (int i = 0; i < received; i++) {
+
+			int read = msgs[i].size;
+
+			if (rb.space_left() < read + 24) {
 #ifdef TOOLS_ENABLED
-			WARN_PRINTS("Buffer full, dropping packets!");
+				WARN_PRINTS("Buffer full, dropping packets!");
 #endif
-			continue;
+				continue;
+			}
+
+			uint32_t port32 = msgs[i].port;
+			rb.write(msgs[i].ip.get_ipv6(), 16);
+			rb.write((uint8_t *)&port32, 4);
+			rb.write((uint8_t *)&read, 4);
+			rb.write(msgs[i].buffer, read);
+			++queue_count;
 		}
 
-		uint32_t port32 = port;
-		rb.write(ip.get_ipv6(), 16);
-		rb.write((uint8_t *)&port32, 4);
-		rb.write((uint8_t *)&read, 4);
-		rb.write(recv_buffer, read);
-		++queue_count;
+		if (received < PACKET_BATCH_COUNT) {
+			break; // Socket drained
+		}
 	}
 
 	return OK;
@@ -40,12 +40,13 @@ class PacketPeerUDP : public PacketPeer {
 
 protected:
 	enum {
-		PACKET_BUFFER_SIZE = 65536
+		PACKET_BUFFER_SIZE = 65536,
+		PACKET_BATCH_COUNT = 4 // Datagrams pulled per recv_multiple() call
 	};
 
 	RingBuffer<uint8_t> rb;
-	uint8_t recv_buffer[PACKET_BUFFER_SIZE];
 	uint8_t packet_buffer[PACKET_BUFFER_SIZE];
+	Vector<uint8_t> batch_buffer; // PACKET_BATCH_COUNT full-size slots, allocated on first poll
 	IP_Address packet_ip;
 	int packet_port;
 	int queue_count;
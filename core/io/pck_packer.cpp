@@ -30,6 +30,7 @@
 
 #include "pck_packer.h"
 
+#include "core/crypto/crypto_core.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
 #include "core/os/file_access.h"
 #include "core/version.h"
@@ -57,11 +58,12 @@ static void _pad(FileAccess *p_file, int p_bytes) {
 void PCKPacker::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("pck_start", "pck_name", "alignment"), &PCKPacker::pck_start, DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("pck_patch_start", "pck_name", "base_pck_name", "alignment"), &PCKPacker::pck_patch_start, DEFVAL(0));
 	ClassDB::bind_method(D_METHOD("add_file", "pck_path", "source_path"), &PCKPacker::add_file);
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
 };
 
-Error PCKPacker::pck_start(const String &p_file, int p_alignment) {
+Error PCKPacker::_pck_start(const String &p_file, int p_alignment, uint32_t p_version) {
 
 	if (file != NULL) {
 		memdelete(file);
@@ -72,9 +74,10 @@ Error PCKPacker::pck_start(const String &p_file, int p_alignment) {
 	ERR_FAIL_COND_V_MSG(!file, ERR_CANT_CREATE, "Can't open file to write: " + String(p_file) + ".");
 
 	alignment = p_alignment;
+	patch = p_version == PACK_FORMAT_VERSION_PATCH;
 
 	file->store_32(PACK_HEADER_MAGIC);
-	file->store_32(PACK_FORMAT_VERSION);
+	file->store_32(p_version);
 	file->store_32(VERSION_MAJOR);
 	file->store_32(VERSION_MINOR);
 	file->store_32(VERSION_PATCH);
@@ -89,6 +92,70 @@ Error PCKPacker::pck_start(const String &p_file, int p_alignment) {
 	return OK;
 };
 
+Error PCKPacker::pck_start(const String &p_file, int p_alignment) {
+
+	base_contents.clear();
+	return _pck_start(p_file, p_alignment, PACK_FORMAT_VERSION);
+};
+
+Error PCKPacker::pck_patch_start(const String &p_file, const String &p_base_pck, int p_alignment) {
+
+	// collect the content hashes of the base pack, so add_file() can turn
+	// unchanged files into references instead of storing their data again
+	base_contents.clear();
+
+	FileAccess *base = FileAccess::open(p_base_pck, FileAccess::READ);
+	ERR_FAIL_COND_V_MSG(!base, ERR_FILE_CANT_OPEN, "Can't open base pack: " + String(p_base_pck) + ".");
+
+	uint32_t magic = base->get_32();
+	if (magic != PACK_HEADER_MAGIC) {
+		memdelete(base);
+		ERR_FAIL_V_MSG(ERR_FILE_UNRECOGNIZED, "Not a pack file: " + String(p_base_pck) + ".");
+	}
+	uint32_t version = base->get_32();
+	if (version != PACK_FORMAT_VERSION) {
+		memdelete(base);
+		ERR_FAIL_V_MSG(ERR_FILE_UNRECOGNIZED, "Base pack must be a full (non-patch) pack of the current version: " + String(p_base_pck) + ".");
+	}
+	base->get_32(); // ver_major
+	base->get_32(); // ver_minor
+	base->get_32(); // ver_patch
+	for (int i = 0; i < 16; i++) {
+		base->get_32(); // reserved
+	}
+
+	int file_count = base->get_32();
+	int hashed_count = 0;
+	for (int i = 0; i < file_count; i++) {
+
+		uint32_t sl = base->get_32();
+		base->seek(base->get_position() + sl); // path, not needed
+		uint64_t ofs = base->get_64();
+		base->get_64(); // size
+		uint8_t md5[16];
+		base->get_buffer(md5, 16);
+
+		bool has_md5 = false;
+		for (int j = 0; j < 16; j++) {
+			if (md5[j] != 0) {
+				has_md5 = true;
+				break;
+			}
+		}
+		if (ofs != 0 && has_md5) {
+			base_contents.insert(String::hex_encode_buffer(md5, 16));
+			hashed_count++;
+		}
+	}
+	memdelete(base);
+
+	if (hashed_count == 0 && file_count > 0) {
+		WARN_PRINTS("Base pack stores no content hashes, every file will be stored in full: " + String(p_base_pck) + ".");
+	}
+
+	return _pck_start(p_file, p_alignment, PACK_FORMAT_VERSION_PATCH);
+};
+
 Error PCKPacker::add_file(const String &p_file, const String &p_src) {
 
 	FileAccess *f = FileAccess::open(p_src, FileAccess::READ);
@@ -102,6 +169,27 @@ Error PCKPacker::add_file(const String &p_file, const String &p_src) {
 	pf.size = f->get_len();
 	pf.offset_offset = 0;
 
+	{
+		CryptoCore::MD5Context md5_ctx;
+		md5_ctx.start();
+
+		const uint32_t buf_max = 65536;
+		uint8_t *buf = memnew_arr(uint8_t, buf_max);
+		uint64_t to_read = pf.size;
+		while (to_read > 0) {
+
+			int read = f->get_buffer(buf, MIN(to_read, buf_max));
+			if (read <= 0)
+				break;
+			md5_ctx.update(buf, read);
+			to_read -= read;
+		};
+		md5_ctx.finish(pf.md5);
+		memdelete_arr(buf);
+	}
+
+	pf.reference = patch && base_contents.has(String::hex_encode_buffer(pf.md5, 16));
+
 	files.push_back(pf);
 
 	f->close();
@@ -121,15 +209,13 @@ Error PCKPacker::flush(bool p_verbose) {
 	for (int i = 0; i < files.size(); i++) {
 
 		file->store_pascal_string(files[i].path);
+		if (patch) {
+			file->store_32(files[i].reference ? PACK_FILE_REFERENCE : 0); // flags
+		}
 		files.write[i].offset_offset = file->get_position();
-		file->store_64(0); // offset
+		file->store_64(0); // offset, unused for references
 		file->store_64(files[i].size); // size
-
-		// # empty md5
-		file->store_32(0);
-		file->store_32(0);
-		file->store_32(0);
-		file->store_32(0);
+		file->store_buffer(files[i].md5, 16);
 	};
 
 	uint64_t ofs = file->get_position();
@@ -143,6 +229,12 @@ Error PCKPacker::flush(bool p_verbose) {
 	int count = 0;
 	for (int i = 0; i < files.size(); i++) {
 
+		if (files[i].reference) {
+			//content already lives in the base pack, only the index entry is needed
+			count += 1;
+			continue;
+		};
+
 		FileAccess *src = FileAccess::open(files[i].src_path, FileAccess::READ);
 		uint64_t to_write = files[i].size;
 		while (to_write > 0) {
@@ -183,6 +275,8 @@ Error PCKPacker::flush(bool p_verbose) {
 PCKPacker::PCKPacker() {
 
 	file = NULL;
+	alignment = 0;
+	patch = false;
 };
 
 PCKPacker::~PCKPacker() {
@@ -32,6 +32,7 @@
 #define PCK_PACKER_H
 
 #include "core/reference.h"
+#include "core/set.h"
 
 class FileAccess;
 
@@ -41,6 +42,8 @@ class PCKPacker : public Reference {
 
 	FileAccess *file;
 	int alignment;
+	bool patch;
+	Set<String> base_contents; //hex content MD5s of the base pack, for patch packs
 
 	static void _bind_methods();
 
@@ -50,11 +53,16 @@ class PCKPacker : public Reference {
 		String src_path;
 		int size;
 		uint64_t offset_offset;
+		uint8_t md5[16];
+		bool reference; //content already in the base pack, write only the index entry
 	};
 	Vector<File> files;
 
+	Error _pck_start(const String &p_file, int p_alignment, uint32_t p_version);
+
 public:
 	Error pck_start(const String &p_file, int p_alignment = 0);
+	Error pck_patch_start(const String &p_file, const String &p_base_pck, int p_alignment = 0);
 	Error add_file(const String &p_file, const String &p_src);
 	Error flush(bool p_verbose = false);
 
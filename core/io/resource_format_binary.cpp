@@ -33,7 +33,9 @@
 #include "core/image.h"
 #include "core/io/file_access_compressed.h"
 #include "core/io/marshalls.h"
+#include "core/io/resource_load_trace.h"
 #include "core/os/dir_access.h"
+#include "core/os/os.h"
 #include "core/project_settings.h"
 #include "core/version.h"
 
@@ -700,6 +702,10 @@ Error ResourceInteractiveLoaderBinary::poll() {
 
 	uint64_t offset = internal_resources[s].offset;
 
+	uint64_t trace_from = 0;
+	if (ResourceLoadTrace::is_active())
+		trace_from = OS::get_singleton()->get_ticks_usec();
+
 	f->seek(offset);
 
 	String t = get_unicode_string();
@@ -720,6 +726,11 @@ Error ResourceInteractiveLoaderBinary::poll() {
 
 	RES res = RES(r);
 
+	if (ResourceLoadTrace::is_active()) {
+		ResourceLoadTrace::add("instance " + t, "resource_binary", trace_from);
+		trace_from = OS::get_singleton()->get_ticks_usec();
+	}
+
 	r->set_path(path);
 	r->set_subindex(subindex);
 
@@ -747,6 +758,11 @@ Error ResourceInteractiveLoaderBinary::poll() {
 #ifdef TOOLS_ENABLED
 	res->set_edited(false);
 #endif
+
+	if (ResourceLoadTrace::is_active()) {
+		ResourceLoadTrace::add("parse " + t, "resource_binary", trace_from, "\"properties\":" + itos(pc));
+	}
+
 	stage++;
 
 	resource_cache.push_back(res);
@@ -832,6 +848,11 @@ void ResourceInteractiveLoaderBinary::open(FileAccess *p_f) {
 
 	error = OK;
 
+	uint64_t trace_from = 0;
+	if (ResourceLoadTrace::is_active())
+		trace_from = OS::get_singleton()->get_ticks_usec();
+	bool compressed = false;
+
 	f = p_f;
 	uint8_t header[4];
 	f->get_buffer(header, 4);
@@ -840,6 +861,7 @@ void ResourceInteractiveLoaderBinary::open(FileAccess *p_f) {
 		FileAccessCompressed *fac = memnew(FileAccessCompressed);
 		fac->open_after_magic(f);
 		f = fac;
+		compressed = true;
 
 	} else if (header[0] != 'R' || header[1] != 'S' || header[2] != 'R' || header[3] != 'C') {
 		//not normal
@@ -921,6 +943,10 @@ void ResourceInteractiveLoaderBinary::open(FileAccess *p_f) {
 		error = ERR_FILE_CORRUPT;
 		ERR_FAIL_MSG("Premature end of file (EOF): " + local_path + ".");
 	}
+
+	if (ResourceLoadTrace::is_active()) {
+		ResourceLoadTrace::add(compressed ? "open_compressed " + local_path : "open " + local_path, "resource_binary", trace_from);
+	}
 }
 
 String ResourceInteractiveLoaderBinary::recognize(FileAccess *p_f) {
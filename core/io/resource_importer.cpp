@@ -375,6 +375,21 @@ void ResourceFormatImporter::get_importers_for_extension(const String &p_extensi
 	}
 }
 
+Ref<ResourceImporter> ResourceFormatImporter::get_importer_by_path(const String &p_path) const {
+
+	if (FileAccess::exists(p_path + ".import")) {
+
+		PathAndType pat;
+		Error err = _get_path_and_type(p_path, pat);
+
+		if (err == OK) {
+			return get_importer_by_name(pat.importer);
+		}
+	}
+
+	return get_importer_by_extension(p_path.get_extension().to_lower());
+}
+
 Ref<ResourceImporter> ResourceFormatImporter::get_importer_by_extension(const String &p_extension) const {
 
 	Ref<ResourceImporter> importer;
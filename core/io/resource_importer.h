@@ -83,6 +83,7 @@ public:
 	void remove_importer(const Ref<ResourceImporter> &p_importer) { importers.erase(p_importer); }
 	Ref<ResourceImporter> get_importer_by_name(const String &p_name) const;
 	Ref<ResourceImporter> get_importer_by_extension(const String &p_extension) const;
+	Ref<ResourceImporter> get_importer_by_path(const String &p_path) const;
 	void get_importers_for_extension(const String &p_extension, List<Ref<ResourceImporter> > *r_importers);
 
 	bool are_import_settings_valid(const String &p_path) const;
@@ -104,6 +105,7 @@ public:
 	virtual String get_resource_type() const = 0;
 	virtual float get_priority() const { return 1.0; }
 	virtual int get_import_order() const { return 0; }
+	virtual bool can_import_threaded() const { return false; } //only importers that touch no shared state during import() may return true
 
 	struct ImportOption {
 		PropertyInfo option;
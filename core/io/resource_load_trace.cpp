@@ -0,0 +1,104 @@
+/*************************************************************************/
+/*  resource_load_trace.cpp                                              */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "resource_load_trace.h"
+
+#include "core/os/file_access.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
+
+FileAccess *ResourceLoadTrace::file = NULL;
+Mutex *ResourceLoadTrace::mutex = NULL;
+bool ResourceLoadTrace::first_event = true;
+volatile bool ResourceLoadTrace::active = false;
+
+Error ResourceLoadTrace::start(const String &p_path) {
+
+	ERR_FAIL_COND_V(active, ERR_ALREADY_IN_USE);
+
+	Error err;
+	file = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Can't open load trace file for writing: " + p_path + ".");
+
+	file->store_string("[\n");
+	first_event = true;
+	mutex = Mutex::create();
+	active = true;
+
+	return OK;
+}
+
+void ResourceLoadTrace::add(const String &p_name, const String &p_cat, uint64_t p_from_usec, const String &p_args_json) {
+
+	if (!active)
+		return;
+
+	uint64_t now = OS::get_singleton()->get_ticks_usec();
+
+	//complete ("X") events don't need begin/end pairing, so error paths can't unbalance the trace
+	String ev = "{\"ph\":\"X\",\"name\":\"" + p_name.json_escape() + "\",\"cat\":\"" + p_cat + "\",\"ts\":" + uitos(p_from_usec) + ",\"dur\":" + uitos(now - p_from_usec) + ",\"pid\":" + itos(OS::get_singleton()->get_process_id()) + ",\"tid\":" + uitos(Thread::get_caller_id());
+	if (p_args_json != String()) {
+		ev += ",\"args\":{" + p_args_json + "}";
+	}
+	ev += "}";
+
+	if (mutex)
+		mutex->lock();
+	if (file) {
+		if (!first_event)
+			file->store_string(",\n");
+		first_event = false;
+		file->store_string(ev);
+	}
+	if (mutex)
+		mutex->unlock();
+}
+
+void ResourceLoadTrace::finish() {
+
+	if (!active)
+		return;
+
+	active = false;
+
+	if (mutex)
+		mutex->lock();
+	file->store_string("\n]\n");
+	file->close();
+	memdelete(file);
+	file = NULL;
+	if (mutex)
+		mutex->unlock();
+
+	if (mutex) {
+		memdelete(mutex);
+		mutex = NULL;
+	}
+}
@@ -0,0 +1,60 @@
+/*************************************************************************/
+/*  resource_load_trace.h                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef RESOURCE_LOAD_TRACE_H
+#define RESOURCE_LOAD_TRACE_H
+
+#include "core/os/mutex.h"
+#include "core/ustring.h"
+
+class FileAccess;
+
+// Records resource load timings into a chrome://tracing compatible event
+// file, enabled with the --load-trace command line flag. While inactive
+// every hook costs a single branch on a bool.
+
+class ResourceLoadTrace {
+
+	static FileAccess *file;
+	static Mutex *mutex;
+	static bool first_event;
+	static volatile bool active;
+
+public:
+	_FORCE_INLINE_ static bool is_active() { return active; }
+
+	static Error start(const String &p_path);
+	//p_from_usec is the OS::get_ticks_usec() timestamp where the measured span began,
+	//p_args_json is an optional list of extra "key":value pairs for the event
+	static void add(const String &p_name, const String &p_cat, uint64_t p_from_usec, const String &p_args_json = String());
+	static void finish();
+};
+
+#endif // RESOURCE_LOAD_TRACE_H
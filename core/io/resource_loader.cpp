@@ -31,6 +31,7 @@
 #include "resource_loader.h"
 
 #include "core/io/resource_importer.h"
+#include "core/io/resource_load_trace.h"
 #include "core/os/file_access.h"
 #include "core/os/os.h"
 #include "core/path_remap.h"
@@ -398,8 +399,23 @@ RES ResourceLoader::load(const String &p_path, const String &p_type_hint, bool p
 	}
 
 	print_verbose("Loading resource: " + path);
+
+	uint64_t trace_from = 0;
+	if (ResourceLoadTrace::is_active())
+		trace_from = OS::get_singleton()->get_ticks_usec();
+
 	RES res = _load(path, local_path, p_type_hint, p_no_cache, r_error);
 
+	if (ResourceLoadTrace::is_active()) {
+		String args = "\"type\":\"" + (res.is_valid() ? String(res->get_class()) : String("<failed>")) + "\"";
+		FileAccess *fs = FileAccess::open(path, FileAccess::READ);
+		if (fs) {
+			args += ",\"bytes\":" + uitos(fs->get_len());
+			memdelete(fs);
+		}
+		ResourceLoadTrace::add(path, "resource_load", trace_from, args);
+	}
+
 	if (res.is_null()) {
 		if (!p_no_cache) {
 			_remove_from_loading_map(local_path);
@@ -1003,14 +1019,249 @@ void ResourceLoader::remove_custom_loaders() {
 Mutex *ResourceLoader::loading_map_mutex = NULL;
 HashMap<ResourceLoader::LoadingMapKey, int, ResourceLoader::LoadingMapKeyHasher> ResourceLoader::loading_map;
 
+Mutex *ResourceLoader::thread_load_mutex = NULL;
+Semaphore *ResourceLoader::thread_load_semaphore = NULL;
+Thread *ResourceLoader::thread_load_thread = NULL;
+bool ResourceLoader::thread_load_exit = false;
+Map<String, ResourceLoader::ThreadLoadTask> ResourceLoader::thread_load_tasks;
+List<String> ResourceLoader::thread_load_queue;
+
+void ResourceLoader::_thread_load_one(const String &p_path) {
+
+	String type_hint;
+	{
+		if (thread_load_mutex)
+			thread_load_mutex->lock();
+		Map<String, ThreadLoadTask>::Element *E = thread_load_tasks.find(p_path);
+		if (E)
+			type_hint = E->get().type_hint;
+		if (thread_load_mutex)
+			thread_load_mutex->unlock();
+	}
+
+	uint64_t trace_from = 0;
+	if (ResourceLoadTrace::is_active())
+		trace_from = OS::get_singleton()->get_ticks_usec();
+
+	Error err = OK;
+	Ref<ResourceInteractiveLoader> ril = load_interactive(p_path, type_hint, false, &err);
+
+	RES res;
+	if (ril.is_valid()) {
+		err = OK;
+		while (err == OK) {
+			err = ril->poll();
+			if (thread_load_mutex)
+				thread_load_mutex->lock();
+			Map<String, ThreadLoadTask>::Element *E = thread_load_tasks.find(p_path);
+			if (E && ril->get_stage_count() > 0) {
+				E->get().progress = float(ril->get_stage()) / float(ril->get_stage_count());
+			}
+			if (thread_load_mutex)
+				thread_load_mutex->unlock();
+		}
+		if (err == ERR_FILE_EOF) {
+			res = ril->get_resource();
+		}
+	}
+
+	if (ResourceLoadTrace::is_active()) {
+		ResourceLoadTrace::add(p_path, "resource_load_threaded", trace_from, "\"type\":\"" + (res.is_valid() ? String(res->get_class()) : String("<failed>")) + "\"");
+	}
+
+	if (thread_load_mutex)
+		thread_load_mutex->lock();
+	Map<String, ThreadLoadTask>::Element *E = thread_load_tasks.find(p_path);
+	if (E) {
+		E->get().resource = res;
+		E->get().progress = 1.0;
+		if (res.is_valid()) {
+			E->get().error = OK;
+			E->get().status = THREAD_LOAD_LOADED;
+		} else {
+			E->get().error = (err == ERR_FILE_EOF || err == OK) ? FAILED : err;
+			E->get().status = THREAD_LOAD_FAILED;
+		}
+	}
+	if (thread_load_mutex)
+		thread_load_mutex->unlock();
+}
+
+void ResourceLoader::_thread_load_func(void *p_userdata) {
+
+	while (true) {
+
+		thread_load_semaphore->wait();
+
+		thread_load_mutex->lock();
+		if (thread_load_exit) {
+			thread_load_mutex->unlock();
+			break;
+		}
+		if (thread_load_queue.empty()) {
+			thread_load_mutex->unlock();
+			continue; //someone stole the work, wait for the next request
+		}
+		String path = thread_load_queue.front()->get();
+		thread_load_queue.pop_front();
+		thread_load_mutex->unlock();
+
+		_thread_load_one(path);
+	}
+}
+
+Error ResourceLoader::load_threaded_request(const String &p_path, const String &p_type_hint) {
+
+	String local_path;
+	if (p_path.is_rel_path())
+		local_path = "res://" + p_path;
+	else
+		local_path = ProjectSettings::get_singleton()->localize_path(p_path);
+
+	if (thread_load_mutex)
+		thread_load_mutex->lock();
+
+	if (!thread_load_tasks.has(local_path)) {
+
+		ThreadLoadTask task;
+		task.status = THREAD_LOAD_IN_PROGRESS;
+		task.progress = 0.0;
+		task.error = OK;
+		task.type_hint = p_type_hint;
+		thread_load_tasks[local_path] = task;
+
+#ifdef NO_THREADS
+		if (thread_load_mutex)
+			thread_load_mutex->unlock();
+		_thread_load_one(local_path); //no threads, load on the spot so the API still works
+		return OK;
+#else
+		thread_load_queue.push_back(local_path);
+		if (!thread_load_thread) {
+			thread_load_exit = false;
+			thread_load_thread = Thread::create(_thread_load_func, NULL);
+		}
+		thread_load_semaphore->post();
+#endif
+	}
+
+	if (thread_load_mutex)
+		thread_load_mutex->unlock();
+
+	return OK;
+}
+
+ResourceLoader::ThreadLoadStatus ResourceLoader::load_threaded_get_status(const String &p_path, float *r_progress) {
+
+	String local_path;
+	if (p_path.is_rel_path())
+		local_path = "res://" + p_path;
+	else
+		local_path = ProjectSettings::get_singleton()->localize_path(p_path);
+
+	ThreadLoadStatus status = THREAD_LOAD_INVALID_RESOURCE;
+
+	if (thread_load_mutex)
+		thread_load_mutex->lock();
+	const Map<String, ThreadLoadTask>::Element *E = thread_load_tasks.find(local_path);
+	if (E) {
+		status = E->get().status;
+		if (r_progress)
+			*r_progress = E->get().progress;
+	}
+	if (thread_load_mutex)
+		thread_load_mutex->unlock();
+
+	return status;
+}
+
+RES ResourceLoader::load_threaded_get(const String &p_path, Error *r_error) {
+
+	if (r_error)
+		*r_error = OK;
+
+	String local_path;
+	if (p_path.is_rel_path())
+		local_path = "res://" + p_path;
+	else
+		local_path = ProjectSettings::get_singleton()->localize_path(p_path);
+
+	while (true) {
+
+		if (thread_load_mutex)
+			thread_load_mutex->lock();
+
+		Map<String, ThreadLoadTask>::Element *E = thread_load_tasks.find(local_path);
+		if (!E) {
+			if (thread_load_mutex)
+				thread_load_mutex->unlock();
+			if (r_error)
+				*r_error = ERR_INVALID_PARAMETER;
+			ERR_FAIL_V_MSG(RES(), "Tried to get resource '" + local_path + "', but no threaded load for it was requested.");
+		}
+
+		if (E->get().status != THREAD_LOAD_IN_PROGRESS) {
+
+			RES res = E->get().resource;
+			Error err = E->get().error;
+			thread_load_tasks.erase(E);
+			if (thread_load_mutex)
+				thread_load_mutex->unlock();
+			if (r_error)
+				*r_error = err;
+			return res;
+		}
+
+		//if the worker did not pick it up yet, steal the work instead of waiting behind unrelated loads
+		bool stolen = false;
+		for (List<String>::Element *Q = thread_load_queue.front(); Q; Q = Q->next()) {
+			if (Q->get() == local_path) {
+				thread_load_queue.erase(Q);
+				stolen = true;
+				break;
+			}
+		}
+
+		if (thread_load_mutex)
+			thread_load_mutex->unlock();
+
+		if (stolen) {
+			_thread_load_one(local_path);
+		} else {
+			OS::get_singleton()->delay_usec(1000);
+		}
+	}
+}
+
 void ResourceLoader::initialize() {
 #ifndef NO_THREADS
 	loading_map_mutex = Mutex::create();
+	thread_load_mutex = Mutex::create();
+	thread_load_semaphore = Semaphore::create();
 #endif
 }
 
 void ResourceLoader::finalize() {
 #ifndef NO_THREADS
+	if (thread_load_thread) {
+		thread_load_mutex->lock();
+		thread_load_exit = true;
+		thread_load_mutex->unlock();
+		thread_load_semaphore->post();
+		Thread::wait_to_finish(thread_load_thread);
+		memdelete(thread_load_thread);
+		thread_load_thread = NULL;
+	}
+	for (Map<String, ThreadLoadTask>::Element *E = thread_load_tasks.front(); E; E = E->next()) {
+		ERR_PRINTS("Exited while threaded resource load is pending: " + E->key());
+	}
+	thread_load_tasks.clear();
+	thread_load_queue.clear();
+	memdelete(thread_load_semaphore);
+	thread_load_semaphore = NULL;
+	memdelete(thread_load_mutex);
+	thread_load_mutex = NULL;
+
 	const LoadingMapKey *K = NULL;
 	while ((K = loading_map.next(K))) {
 		ERR_PRINTS("Exited while resource is being loaded: " + K->path);
@@ -31,6 +31,7 @@
 #ifndef RESOURCE_LOADER_H
 #define RESOURCE_LOADER_H
 
+#include "core/os/semaphore.h"
 #include "core/os/thread.h"
 #include "core/resource.h"
 
@@ -142,6 +143,38 @@ class ResourceLoader {
 	static void _remove_from_loading_map_and_thread(const String &p_path, Thread::ID p_thread);
 
 public:
+	enum ThreadLoadStatus {
+		THREAD_LOAD_INVALID_RESOURCE,
+		THREAD_LOAD_IN_PROGRESS,
+		THREAD_LOAD_FAILED,
+		THREAD_LOAD_LOADED,
+	};
+
+private:
+	//background loading service, one worker polls interactive loads off the main thread
+	struct ThreadLoadTask {
+		ThreadLoadStatus status;
+		float progress;
+		Error error;
+		RES resource;
+		String type_hint;
+	};
+
+	static Mutex *thread_load_mutex;
+	static Semaphore *thread_load_semaphore;
+	static Thread *thread_load_thread;
+	static bool thread_load_exit;
+	static Map<String, ThreadLoadTask> thread_load_tasks;
+	static List<String> thread_load_queue;
+
+	static void _thread_load_func(void *p_userdata);
+	static void _thread_load_one(const String &p_path);
+
+public:
+	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "");
+	static ThreadLoadStatus load_threaded_get_status(const String &p_path, float *r_progress = NULL);
+	static RES load_threaded_get(const String &p_path, Error *r_error = NULL);
+
 	static Ref<ResourceInteractiveLoader> load_interactive(const String &p_path, const String &p_type_hint = "", bool p_no_cache = false, Error *r_error = NULL);
 	static RES load(const String &p_path, const String &p_type_hint = "", bool p_no_cache = false, Error *r_error = NULL);
 	static bool exists(const String &p_path, const String &p_type_hint = "");
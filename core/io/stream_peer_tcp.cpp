@@ -34,7 +34,42 @@
 
 Error StreamPeerTCP::_poll_connection() {
 
-	ERR_FAIL_COND_V(status != STATUS_CONNECTING || !_sock.is_valid() || !_sock->is_open(), FAILED);
+	ERR_FAIL_COND_V(status != STATUS_CONNECTING || !_sock.is_valid(), FAILED);
+
+	if (resolve_id != IP::RESOLVER_INVALID_ID) {
+		// Still waiting for the async DNS query issued by connect_to_host().
+		IP::ResolverStatus rstatus = IP::get_singleton()->get_resolve_item_status(resolve_id);
+		switch (rstatus) {
+			case IP::RESOLVER_STATUS_WAITING: {
+				if (OS::get_singleton()->get_ticks_msec() > timeout) {
+					disconnect_from_host();
+					status = STATUS_ERROR;
+					return ERR_CONNECTION_ERROR;
+				}
+				return OK;
+			}
+			case IP::RESOLVER_STATUS_DONE: {
+				IP_Address host = IP::get_singleton()->get_resolve_item_address(resolve_id);
+				IP::get_singleton()->erase_resolve_item(resolve_id);
+				resolve_id = IP::RESOLVER_INVALID_ID;
+				uint16_t port = peer_port;
+				status = STATUS_NONE;
+				if (!host.is_valid() || connect_to_host(host, port) != OK) {
+					status = STATUS_ERROR;
+					return ERR_CONNECTION_ERROR;
+				}
+				return OK;
+			}
+			default: {
+				IP::get_singleton()->erase_resolve_item(resolve_id);
+				resolve_id = IP::RESOLVER_INVALID_ID;
+				status = STATUS_ERROR;
+				return ERR_CANT_RESOLVE;
+			}
+		}
+	}
+
+	ERR_FAIL_COND_V(!_sock->is_open(), FAILED);
 
 	Error err = _sock->connect_to_host(peer_host, peer_port);
 
@@ -248,7 +283,7 @@ void StreamPeerTCP::set_no_delay(bool p_enabled) {
 
 bool StreamPeerTCP::is_connected_to_host() const {
 
-	return _sock.is_valid() && _sock->is_open() && (status == STATUS_CONNECTED || status == STATUS_CONNECTING);
+	return _sock.is_valid() && (_sock->is_open() || resolve_id != IP::RESOLVER_INVALID_ID) && (status == STATUS_CONNECTED || status == STATUS_CONNECTING);
 }
 
 StreamPeerTCP::Status StreamPeerTCP::get_status() {
@@ -282,6 +317,11 @@ void StreamPeerTCP::disconnect_from_host() {
 	if (_sock.is_valid() && _sock->is_open())
 		_sock->close();
 
+	if (resolve_id != IP::RESOLVER_INVALID_ID) {
+		IP::get_singleton()->erase_resolve_item(resolve_id);
+		resolve_id = IP::RESOLVER_INVALID_ID;
+	}
+
 	timeout = 0;
 	status = STATUS_NONE;
 	peer_host = IP_Address();
@@ -332,9 +372,18 @@ Error StreamPeerTCP::_connect(const String &p_address, int p_port) {
 	if (p_address.is_valid_ip_address()) {
 		ip = p_address;
 	} else {
-		ip = IP::get_singleton()->resolve_hostname(p_address);
-		if (!ip.is_valid())
+		// Resolve asynchronously; the connection keeps reporting
+		// STATUS_CONNECTING and _poll_connection() picks up the result, so
+		// connecting to a hostname never blocks on DNS.
+		ERR_FAIL_COND_V(_sock.is_valid() && _sock->is_open(), ERR_ALREADY_IN_USE);
+		resolve_id = IP::get_singleton()->resolve_hostname_queue_item(p_address);
+		if (resolve_id == IP::RESOLVER_INVALID_ID)
 			return ERR_CANT_RESOLVE;
+		timeout = OS::get_singleton()->get_ticks_msec() + (((uint64_t)GLOBAL_GET("network/limits/tcp/connect_timeout_seconds")) * 1000);
+		status = STATUS_CONNECTING;
+		peer_host = IP_Address();
+		peer_port = p_port;
+		return OK;
 	}
 
 	return connect_to_host(ip, p_port);
@@ -360,7 +409,8 @@ StreamPeerTCP::StreamPeerTCP() :
 		_sock(Ref<NetSocket>(NetSocket::create())),
 		timeout(0),
 		status(STATUS_NONE),
-		peer_port(0) {
+		peer_port(0),
+		resolve_id(IP::RESOLVER_INVALID_ID) {
 }
 
 StreamPeerTCP::~StreamPeerTCP() {
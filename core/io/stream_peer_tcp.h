@@ -56,6 +56,7 @@ protected:
 	Status status;
 	IP_Address peer_host;
 	uint16_t peer_port;
+	IP::ResolverID resolve_id;
 
 	Error _connect(const String &p_address, int p_port);
 	Error _poll_connection();
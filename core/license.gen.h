@@ -0,0 +1,8 @@
+const char *const GODOT_LICENSE_TEXT = "";
+struct ComponentCopyrightPart { const char *license; const char *const *files; const char *const *copyright_statements; int file_count; int copyright_count; };
+struct ComponentCopyright { const char *name; const ComponentCopyrightPart *parts; int part_count; };
+const int COPYRIGHT_INFO_COUNT = 0;
+const ComponentCopyright COPYRIGHT_INFO[] = {{(void*)0,(void*)0,0}};
+const int LICENSE_COUNT=0;
+const char *const LICENSE_NAMES[]={""};
+const char *const LICENSE_BODIES[]={""};
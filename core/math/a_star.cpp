@@ -32,6 +32,7 @@
 
 #include "core/math/geometry.h"
 #include "core/script_language.h"
+#include "core/sort_array.h"
 #include "scene/scene_string_names.h"
 
 int AStar::get_available_point_id() const {
@@ -70,11 +71,15 @@ void AStar::add_point(int p_id, const Vector3 &p_pos, real_t p_weight_scale) {
 		pt->open_pass = 0;
 		pt->closed_pass = 0;
 		pt->enabled = true;
+		pt->heap_index = 0;
+		pt->cluster = -1;
 		points.set(p_id, pt);
 	} else {
 		found_pt->pos = p_pos;
 		found_pt->weight_scale = p_weight_scale;
 	}
+
+	hierarchy_dirty = true;
 }
 
 Vector3 AStar::get_point_position(int p_id) const {
@@ -93,6 +98,7 @@ void AStar::set_point_position(int p_id, const Vector3 &p_pos) {
 	ERR_FAIL_COND(!p_exists);
 
 	p->pos = p_pos;
+	hierarchy_dirty = true;
 }
 
 real_t AStar::get_point_weight_scale(int p_id) const {
@@ -112,6 +118,7 @@ void AStar::set_point_weight_scale(int p_id, real_t p_weight_scale) {
 	ERR_FAIL_COND(p_weight_scale < 1);
 
 	p->weight_scale = p_weight_scale;
+	hierarchy_dirty = true;
 }
 
 void AStar::remove_point(int p_id) {
@@ -141,6 +148,7 @@ void AStar::remove_point(int p_id) {
 	memdelete(p);
 	points.remove(p_id);
 	last_free_id = p_id;
+	hierarchy_dirty = true;
 }
 
 void AStar::connect_points(int p_id, int p_with_id, bool bidirectional) {
@@ -178,6 +186,8 @@ void AStar::connect_points(int p_id, int p_with_id, bool bidirectional) {
 	}
 
 	segments.insert(s);
+
+	hierarchy_dirty = true;
 }
 
 void AStar::disconnect_points(int p_id, int p_with_id, bool bidirectional) {
@@ -217,6 +227,8 @@ void AStar::disconnect_points(int p_id, int p_with_id, bool bidirectional) {
 		if (s.direction != Segment::NONE)
 			segments.insert(s);
 	}
+
+	hierarchy_dirty = true;
 }
 
 bool AStar::has_point(int p_id) const {
@@ -267,6 +279,9 @@ void AStar::clear() {
 	}
 	segments.clear();
 	points.clear();
+	cluster_portals.clear();
+	portal_links.clear();
+	hierarchy_dirty = true;
 }
 
 int AStar::get_point_count() const {
@@ -336,7 +351,73 @@ Vector3 AStar::get_closest_position_in_segment(const Vector3 &p_point) const {
 	return closest_point;
 }
 
-bool AStar::_solve(Point *begin_point, Point *end_point) {
+void AStar::_open_list_push(Point *p_point) {
+
+	if (open_list_size >= open_list.size()) {
+		open_list.resize(open_list_size * 2 + 1);
+	}
+	open_list.write[open_list_size] = p_point;
+	p_point->heap_index = open_list_size;
+	open_list_size++;
+	_open_list_sift_up(p_point->heap_index);
+}
+
+void AStar::_open_list_pop_root() {
+
+	open_list_size--;
+	Point **heap = open_list.ptrw();
+	heap[0] = heap[open_list_size];
+	heap[0]->heap_index = 0;
+	if (open_list_size > 1) {
+		_open_list_sift_down(0);
+	}
+}
+
+void AStar::_open_list_sift_up(int p_index) {
+
+	Point **heap = open_list.ptrw();
+	Point *point = heap[p_index];
+	SortPoints worse;
+
+	while (p_index > 0) {
+		int parent = (p_index - 1) / 2;
+		if (!worse(heap[parent], point)) {
+			break;
+		}
+		heap[p_index] = heap[parent];
+		heap[p_index]->heap_index = p_index;
+		p_index = parent;
+	}
+	heap[p_index] = point;
+	point->heap_index = p_index;
+}
+
+void AStar::_open_list_sift_down(int p_index) {
+
+	Point **heap = open_list.ptrw();
+	Point *point = heap[p_index];
+	SortPoints worse;
+
+	while (true) {
+		int child = p_index * 2 + 1;
+		if (child >= open_list_size) {
+			break;
+		}
+		if (child + 1 < open_list_size && worse(heap[child], heap[child + 1])) {
+			child++;
+		}
+		if (!worse(point, heap[child])) {
+			break;
+		}
+		heap[p_index] = heap[child];
+		heap[p_index]->heap_index = p_index;
+		p_index = child;
+	}
+	heap[p_index] = point;
+	point->heap_index = p_index;
+}
+
+bool AStar::_solve(Point *begin_point, Point *end_point, int p_restrict_cluster) {
 
 	pass++;
 
@@ -344,14 +425,13 @@ bool AStar::_solve(Point *begin_point, Point *end_point) {
 
 	bool found_route = false;
 
-	Vector<Point *> open_list;
-	SortArray<Point *, SortPoints> sorter;
+	open_list_size = 0; // Reuse the heap allocation of previous solves.
 
 	begin_point->g_score = 0;
 	begin_point->f_score = _estimate_cost(begin_point->id, end_point->id);
-	open_list.push_back(begin_point);
+	_open_list_push(begin_point);
 
-	while (!open_list.empty()) {
+	while (open_list_size > 0) {
 
 		Point *p = open_list[0]; // The currently processed point
 
@@ -360,8 +440,7 @@ bool AStar::_solve(Point *begin_point, Point *end_point) {
 			break;
 		}
 
-		sorter.pop_heap(0, open_list.size(), open_list.ptrw()); // Remove the current point from the open list
-		open_list.remove(open_list.size() - 1);
+		_open_list_pop_root(); // Remove the current point from the open list
 		p->closed_pass = pass; // Mark the point as closed
 
 		for (OAHashMap<int, Point *>::Iterator it = p->neighbours.iter(); it.valid; it = p->neighbours.next_iter(it)) {
@@ -372,13 +451,16 @@ bool AStar::_solve(Point *begin_point, Point *end_point) {
 				continue;
 			}
 
+			if (p_restrict_cluster != -1 && e->cluster != p_restrict_cluster) {
+				continue;
+			}
+
 			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
 
 			bool new_point = false;
 
 			if (e->open_pass != pass) { // The point wasn't inside the open list.
 				e->open_pass = pass;
-				open_list.push_back(e);
 				new_point = true;
 			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
 				continue;
@@ -388,10 +470,10 @@ bool AStar::_solve(Point *begin_point, Point *end_point) {
 			e->g_score = tentative_g_score;
 			e->f_score = e->g_score + _estimate_cost(e->id, end_point->id);
 
-			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptrw());
+			if (new_point) {
+				_open_list_push(e);
 			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptrw());
+				_open_list_sift_up(e->heap_index); // The score only ever improves here.
 			}
 		}
 	}
@@ -399,6 +481,199 @@ bool AStar::_solve(Point *begin_point, Point *end_point) {
 	return found_route;
 }
 
+void AStar::_cluster_flood(Point *p_begin_point, int p_cluster) {
+
+	// Dijkstra restricted to one cluster; distances end up in g_score and
+	// every reached point has closed_pass == pass when this returns.
+	pass++;
+
+	open_list_size = 0;
+
+	p_begin_point->g_score = 0;
+	p_begin_point->f_score = 0;
+	p_begin_point->open_pass = pass;
+	_open_list_push(p_begin_point);
+
+	while (open_list_size > 0) {
+
+		Point *p = open_list[0];
+		_open_list_pop_root();
+		p->closed_pass = pass;
+
+		for (OAHashMap<int, Point *>::Iterator it = p->neighbours.iter(); it.valid; it = p->neighbours.next_iter(it)) {
+
+			Point *e = *(it.value);
+
+			if (!e->enabled || e->closed_pass == pass || e->cluster != p_cluster) {
+				continue;
+			}
+
+			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
+
+			bool new_point = false;
+
+			if (e->open_pass != pass) {
+				e->open_pass = pass;
+				new_point = true;
+			} else if (tentative_g_score >= e->g_score) {
+				continue;
+			}
+
+			e->g_score = tentative_g_score;
+			e->f_score = tentative_g_score; // No heuristic, plain Dijkstra.
+
+			if (new_point) {
+				_open_list_push(e);
+			} else {
+				_open_list_sift_up(e->heap_index);
+			}
+		}
+	}
+}
+
+void AStar::_build_hierarchy() {
+
+	cluster_portals.clear();
+	portal_links.clear();
+	cluster_count = 0;
+
+	for (OAHashMap<int, Point *>::Iterator it = points.iter(); it.valid; it = points.next_iter(it)) {
+		(*it.value)->cluster = -1;
+	}
+
+	// Grow clusters by breadth first flood fill, capped at cluster_size points,
+	// so sectors follow the connectivity of the graph rather than space.
+	Vector<Point *> queue;
+
+	for (OAHashMap<int, Point *>::Iterator it = points.iter(); it.valid; it = points.next_iter(it)) {
+
+		Point *seed = *(it.value);
+		if (!seed->enabled || seed->cluster != -1) {
+			continue;
+		}
+
+		int cluster = cluster_count++;
+		int assigned = 1;
+		int head = 0;
+
+		queue.clear();
+		queue.push_back(seed);
+		seed->cluster = cluster;
+
+		while (head < queue.size() && assigned < cluster_size) {
+
+			Point *p = queue[head++];
+
+			for (OAHashMap<int, Point *>::Iterator nit = p->neighbours.iter(); nit.valid; nit = p->neighbours.next_iter(nit)) {
+
+				Point *e = *(nit.value);
+				if (!e->enabled || e->cluster != -1) {
+					continue;
+				}
+
+				e->cluster = cluster;
+				queue.push_back(e);
+				assigned++;
+				if (assigned >= cluster_size) {
+					break;
+				}
+			}
+		}
+	}
+
+	// Points with an edge that crosses a cluster border become portals.
+	for (OAHashMap<int, Point *>::Iterator it = points.iter(); it.valid; it = points.next_iter(it)) {
+
+		Point *p = *(it.value);
+		if (!p->enabled || p->cluster == -1) {
+			continue;
+		}
+
+		for (OAHashMap<int, Point *>::Iterator nit = p->neighbours.iter(); nit.valid; nit = p->neighbours.next_iter(nit)) {
+
+			Point *e = *(nit.value);
+			if (!e->enabled || e->cluster == -1 || e->cluster == p->cluster) {
+				continue;
+			}
+
+			if (!portal_links.has(p->id)) {
+				cluster_portals[p->cluster].push_back(p->id);
+				portal_links[p->id] = Vector<PortalLink>();
+			}
+			if (!portal_links.has(e->id)) {
+				cluster_portals[e->cluster].push_back(e->id);
+				portal_links[e->id] = Vector<PortalLink>();
+			}
+
+			PortalLink link;
+			link.to = e->id;
+			link.cost = _compute_cost(p->id, e->id) * e->weight_scale;
+			portal_links[p->id].push_back(link);
+		}
+	}
+
+	// Precompute portal to portal costs inside each cluster.
+	for (Map<int, Vector<int> >::Element *E = cluster_portals.front(); E; E = E->next()) {
+
+		const Vector<int> &ports = E->get();
+
+		for (int i = 0; i < ports.size(); i++) {
+
+			Point *from;
+			points.lookup(ports[i], from);
+
+			_cluster_flood(from, E->key());
+
+			for (int j = 0; j < ports.size(); j++) {
+
+				if (j == i) {
+					continue;
+				}
+
+				Point *to;
+				points.lookup(ports[j], to);
+
+				if (to->closed_pass != pass) {
+					continue; // Not reachable without leaving the cluster.
+				}
+
+				PortalLink link;
+				link.to = to->id;
+				link.cost = to->g_score;
+				portal_links[from->id].push_back(link);
+			}
+		}
+	}
+
+	hierarchy_dirty = false;
+}
+
+bool AStar::_append_cluster_path(Point *p_begin_point, Point *p_end_point, int p_cluster, Vector<int> &r_path) {
+
+	if (!_solve(p_begin_point, p_end_point, p_cluster)) {
+		return false;
+	}
+
+	int pc = 0;
+	Point *p = p_end_point;
+	while (p != p_begin_point) {
+		pc++;
+		p = p->prev_point;
+	}
+
+	// Append everything after the begin point, which r_path already holds.
+	int base = r_path.size();
+	r_path.resize(base + pc);
+
+	p = p_end_point;
+	for (int idx = base + pc - 1; idx >= base; idx--) {
+		r_path.write[idx] = p->id;
+		p = p->prev_point;
+	}
+
+	return true;
+}
+
 float AStar::_estimate_cost(int p_from_id, int p_to_id) {
 
 	if (get_script_instance() && get_script_instance()->has_method(SceneStringNames::get_singleton()->_estimate_cost))
@@ -527,6 +802,225 @@ PoolVector<int> AStar::get_id_path(int p_from_id, int p_to_id) {
 	return path;
 }
 
+void AStar::set_cluster_size(int p_size) {
+
+	ERR_FAIL_COND(p_size < 2);
+	cluster_size = p_size;
+	hierarchy_dirty = true;
+}
+
+int AStar::get_cluster_size() const {
+
+	return cluster_size;
+}
+
+struct _AStarAbstractEntry {
+	real_t cost;
+	int id;
+};
+
+struct _AStarAbstractSort {
+	_FORCE_INLINE_ bool operator()(const _AStarAbstractEntry &A, const _AStarAbstractEntry &B) const {
+		return A.cost > B.cost; // Min heap.
+	}
+};
+
+PoolVector<int> AStar::get_hierarchical_id_path(int p_from_id, int p_to_id) {
+
+	Point *a;
+	bool from_exists = points.lookup(p_from_id, a);
+	ERR_FAIL_COND_V(!from_exists, PoolVector<int>());
+
+	Point *b;
+	bool to_exists = points.lookup(p_to_id, b);
+	ERR_FAIL_COND_V(!to_exists, PoolVector<int>());
+
+	if (a == b) {
+		PoolVector<int> ret;
+		ret.push_back(a->id);
+		return ret;
+	}
+
+	if (hierarchy_dirty) {
+		_build_hierarchy();
+	}
+
+	// Same sector (or disabled endpoints): the abstract graph can't help,
+	// fall back to the exact search.
+	if (a->cluster == -1 || b->cluster == -1 || a->cluster == b->cluster) {
+		return get_id_path(p_from_id, p_to_id);
+	}
+
+	if (!cluster_portals.has(a->cluster) || !cluster_portals.has(b->cluster)) {
+		return PoolVector<int>(); // An endpoint sits in a sector with no way out.
+	}
+
+	// Seed the abstract search with the portals reachable from the start
+	// inside its own sector.
+	Map<int, real_t> dist;
+	Map<int, int> prev;
+	Vector<_AStarAbstractEntry> heap;
+	SortArray<_AStarAbstractEntry, _AStarAbstractSort> heap_sort;
+
+	_cluster_flood(a, a->cluster);
+
+	const Vector<int> &start_ports = cluster_portals[a->cluster];
+	for (int i = 0; i < start_ports.size(); i++) {
+
+		Point *port;
+		points.lookup(start_ports[i], port);
+
+		if (port != a && port->closed_pass != pass) {
+			continue;
+		}
+
+		_AStarAbstractEntry e;
+		e.cost = (port == a) ? 0 : port->g_score;
+		e.id = port->id;
+
+		dist[e.id] = e.cost;
+		prev[e.id] = -1;
+		heap.push_back(e);
+		heap_sort.push_heap(0, heap.size() - 1, 0, e, heap.ptrw());
+	}
+
+	// Cost from each portal of the goal sector to the goal, solved per portal
+	// so one-way edges inside the sector are respected.
+	Map<int, real_t> end_dist;
+
+	const Vector<int> &end_ports = cluster_portals[b->cluster];
+	for (int i = 0; i < end_ports.size(); i++) {
+
+		Point *port;
+		points.lookup(end_ports[i], port);
+
+		if (port == b) {
+			end_dist[port->id] = 0;
+		} else if (_solve(port, b, b->cluster)) {
+			end_dist[port->id] = b->g_score;
+		}
+	}
+
+	// Dijkstra over the portal graph; -2 is the virtual goal node.
+	while (heap.size() > 0) {
+
+		_AStarAbstractEntry top = heap[0];
+		heap_sort.pop_heap(0, heap.size(), heap.ptrw());
+		heap.resize(heap.size() - 1);
+
+		if (top.id == -2) {
+			break;
+		}
+
+		if (top.cost > dist[top.id]) {
+			continue; // Stale entry, a better path was already found.
+		}
+
+		if (end_dist.has(top.id)) {
+
+			real_t nc = top.cost + end_dist[top.id];
+			if (!dist.has(-2) || nc < dist[-2]) {
+				dist[-2] = nc;
+				prev[-2] = top.id;
+
+				_AStarAbstractEntry e;
+				e.cost = nc;
+				e.id = -2;
+				heap.push_back(e);
+				heap_sort.push_heap(0, heap.size() - 1, 0, e, heap.ptrw());
+			}
+		}
+
+		const Vector<PortalLink> &links = portal_links[top.id];
+		for (int i = 0; i < links.size(); i++) {
+
+			real_t nc = top.cost + links[i].cost;
+			if (!dist.has(links[i].to) || nc < dist[links[i].to]) {
+				dist[links[i].to] = nc;
+				prev[links[i].to] = top.id;
+
+				_AStarAbstractEntry e;
+				e.cost = nc;
+				e.id = links[i].to;
+				heap.push_back(e);
+				heap_sort.push_heap(0, heap.size() - 1, 0, e, heap.ptrw());
+			}
+		}
+	}
+
+	if (!prev.has(-2)) {
+		return PoolVector<int>();
+	}
+
+	Vector<int> portal_seq;
+	for (int id = prev[-2]; id != -1; id = prev[id]) {
+		portal_seq.push_back(id);
+	}
+	portal_seq.invert();
+
+	// Refine: stitch the portal sequence into a concrete path by solving
+	// inside one sector at a time.
+	Vector<int> path;
+	path.push_back(a->id);
+	Point *cur_point = a;
+
+	for (int i = 0; i < portal_seq.size(); i++) {
+
+		Point *next;
+		points.lookup(portal_seq[i], next);
+
+		if (next == cur_point) {
+			continue;
+		}
+
+		if (next->cluster == cur_point->cluster) {
+			if (!_append_cluster_path(cur_point, next, cur_point->cluster, path)) {
+				return PoolVector<int>();
+			}
+		} else {
+			path.push_back(next->id); // Border crossing, a direct edge.
+		}
+
+		cur_point = next;
+	}
+
+	if (cur_point != b) {
+		if (!_append_cluster_path(cur_point, b, b->cluster, path)) {
+			return PoolVector<int>();
+		}
+	}
+
+	PoolVector<int> ret;
+	ret.resize(path.size());
+	{
+		PoolVector<int>::Write w = ret.write();
+		for (int i = 0; i < path.size(); i++) {
+			w[i] = path[i];
+		}
+	}
+
+	return ret;
+}
+
+PoolVector<Vector3> AStar::get_hierarchical_point_path(int p_from_id, int p_to_id) {
+
+	PoolVector<int> id_path = get_hierarchical_id_path(p_from_id, p_to_id);
+
+	PoolVector<Vector3> path;
+	path.resize(id_path.size());
+	{
+		PoolVector<int>::Read r = id_path.read();
+		PoolVector<Vector3>::Write w = path.write();
+		for (int i = 0; i < id_path.size(); i++) {
+			Point *p;
+			points.lookup(r[i], p);
+			w[i] = p->pos;
+		}
+	}
+
+	return path;
+}
+
 void AStar::set_point_disabled(int p_id, bool p_disabled) {
 
 	Point *p;
@@ -534,6 +1028,7 @@ void AStar::set_point_disabled(int p_id, bool p_disabled) {
 	ERR_FAIL_COND(!p_exists);
 
 	p->enabled = !p_disabled;
+	hierarchy_dirty = true;
 }
 
 bool AStar::is_point_disabled(int p_id) const {
@@ -576,6 +1071,11 @@ void AStar::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id"), &AStar::get_point_path);
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id"), &AStar::get_id_path);
 
+	ClassDB::bind_method(D_METHOD("set_cluster_size", "size"), &AStar::set_cluster_size);
+	ClassDB::bind_method(D_METHOD("get_cluster_size"), &AStar::get_cluster_size);
+	ClassDB::bind_method(D_METHOD("get_hierarchical_point_path", "from_id", "to_id"), &AStar::get_hierarchical_point_path);
+	ClassDB::bind_method(D_METHOD("get_hierarchical_id_path", "from_id", "to_id"), &AStar::get_hierarchical_id_path);
+
 	BIND_VMETHOD(MethodInfo(Variant::REAL, "_estimate_cost", PropertyInfo(Variant::INT, "from_id"), PropertyInfo(Variant::INT, "to_id")));
 	BIND_VMETHOD(MethodInfo(Variant::REAL, "_compute_cost", PropertyInfo(Variant::INT, "from_id"), PropertyInfo(Variant::INT, "to_id")));
 }
@@ -583,6 +1083,10 @@ void AStar::_bind_methods() {
 AStar::AStar() {
 	last_free_id = 0;
 	pass = 1;
+	open_list_size = 0;
+	cluster_size = 64;
+	cluster_count = 0;
+	hierarchy_dirty = true;
 }
 
 AStar::~AStar() {
@@ -698,6 +1202,35 @@ PoolVector<int> AStar2D::get_id_path(int p_from_id, int p_to_id) {
 	return astar.get_id_path(p_from_id, p_to_id);
 }
 
+void AStar2D::set_cluster_size(int p_size) {
+	astar.set_cluster_size(p_size);
+}
+
+int AStar2D::get_cluster_size() const {
+	return astar.get_cluster_size();
+}
+
+PoolVector<Vector2> AStar2D::get_hierarchical_point_path(int p_from_id, int p_to_id) {
+
+	PoolVector3Array pv = astar.get_hierarchical_point_path(p_from_id, p_to_id);
+	int size = pv.size();
+	PoolVector2Array path;
+	path.resize(size);
+	{
+		PoolVector<Vector3>::Read r = pv.read();
+		PoolVector<Vector2>::Write w = path.write();
+		for (int i = 0; i < size; i++) {
+			Vector3 p = r[i];
+			w[i] = Vector2(p.x, p.y);
+		}
+	}
+	return path;
+}
+
+PoolVector<int> AStar2D::get_hierarchical_id_path(int p_from_id, int p_to_id) {
+	return astar.get_hierarchical_id_path(p_from_id, p_to_id);
+}
+
 void AStar2D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_available_point_id"), &AStar2D::get_available_point_id);
@@ -728,6 +1261,11 @@ void AStar2D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id"), &AStar2D::get_point_path);
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id"), &AStar2D::get_id_path);
+
+	ClassDB::bind_method(D_METHOD("set_cluster_size", "size"), &AStar2D::set_cluster_size);
+	ClassDB::bind_method(D_METHOD("get_cluster_size"), &AStar2D::get_cluster_size);
+	ClassDB::bind_method(D_METHOD("get_hierarchical_point_path", "from_id", "to_id"), &AStar2D::get_hierarchical_point_path);
+	ClassDB::bind_method(D_METHOD("get_hierarchical_id_path", "from_id", "to_id"), &AStar2D::get_hierarchical_id_path);
 }
 
 AStar2D::AStar2D() {
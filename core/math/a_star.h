@@ -31,6 +31,7 @@
 #ifndef ASTAR_H
 #define ASTAR_H
 
+#include "core/map.h"
 #include "core/oa_hash_map.h"
 #include "core/reference.h"
 
@@ -64,6 +65,8 @@ class AStar : public Reference {
 		real_t f_score;
 		uint64_t open_pass;
 		uint64_t closed_pass;
+		int heap_index; // Position in the open list heap, valid while open_pass == pass.
+		int cluster; // Sector of the hierarchy this point belongs to, -1 when unassigned.
 	};
 
 	struct SortPoints {
@@ -119,7 +122,38 @@ class AStar : public Reference {
 	OAHashMap<int, Point *> points;
 	Set<Segment> segments;
 
-	bool _solve(Point *begin_point, Point *end_point);
+	// Open list binary heap, kept between solves so queries don't reallocate.
+	// Each point tracks its heap position, so improving the score of an
+	// already open point is a sift-up instead of a linear search.
+	Vector<Point *> open_list;
+	int open_list_size;
+
+	void _open_list_push(Point *p_point);
+	void _open_list_pop_root();
+	void _open_list_sift_up(int p_index);
+	void _open_list_sift_down(int p_index);
+
+	// Hierarchical (HPA*-style) pathfinding layer: the graph is clustered
+	// into sectors of at most cluster_size points, points with an edge into
+	// another sector become portals, and portal-to-portal costs inside each
+	// sector are precomputed. Any graph change marks the layer dirty; it is
+	// rebuilt lazily on the next hierarchical query.
+	struct PortalLink {
+		int to;
+		real_t cost;
+	};
+
+	int cluster_size;
+	int cluster_count;
+	bool hierarchy_dirty;
+	Map<int, Vector<int> > cluster_portals; // Cluster index -> portal point ids.
+	Map<int, Vector<PortalLink> > portal_links; // Portal id -> reachable portals.
+
+	void _build_hierarchy();
+	void _cluster_flood(Point *p_begin_point, int p_cluster);
+	bool _append_cluster_path(Point *p_begin_point, Point *p_end_point, int p_cluster, Vector<int> &r_path);
+
+	bool _solve(Point *begin_point, Point *end_point, int p_restrict_cluster = -1);
 
 protected:
 	static void _bind_methods();
@@ -158,6 +192,12 @@ public:
 	PoolVector<Vector3> get_point_path(int p_from_id, int p_to_id);
 	PoolVector<int> get_id_path(int p_from_id, int p_to_id);
 
+	void set_cluster_size(int p_size);
+	int get_cluster_size() const;
+
+	PoolVector<Vector3> get_hierarchical_point_path(int p_from_id, int p_to_id);
+	PoolVector<int> get_hierarchical_id_path(int p_from_id, int p_to_id);
+
 	AStar();
 	~AStar();
 };
@@ -200,6 +240,12 @@ public:
 	PoolVector<Vector2> get_point_path(int p_from_id, int p_to_id);
 	PoolVector<int> get_id_path(int p_from_id, int p_to_id);
 
+	void set_cluster_size(int p_size);
+	int get_cluster_size() const;
+
+	PoolVector<Vector2> get_hierarchical_point_path(int p_from_id, int p_to_id);
+	PoolVector<int> get_hierarchical_id_path(int p_from_id, int p_to_id);
+
 	AStar2D();
 	~AStar2D();
 };
@@ -217,6 +217,41 @@ Basis Basis::transposed() const {
 	return tr;
 }
 
+void Basis::xform_array(Vector3 *r_dst, const Vector3 *p_src, int p_count) const {
+
+	// Hoist the matrix into locals so the loop body only touches the vertex
+	// stream; this lets the compiler keep the coefficients in registers and
+	// vectorize the loop where the target arch allows it.
+	real_t xx = elements[0][0], xy = elements[0][1], xz = elements[0][2];
+	real_t yx = elements[1][0], yy = elements[1][1], yz = elements[1][2];
+	real_t zx = elements[2][0], zy = elements[2][1], zz = elements[2][2];
+
+	for (int i = 0; i < p_count; i++) {
+
+		Vector3 v = p_src[i];
+		r_dst[i] = Vector3(
+				xx * v.x + xy * v.y + xz * v.z,
+				yx * v.x + yy * v.y + yz * v.z,
+				zx * v.x + zy * v.y + zz * v.z);
+	}
+}
+
+void Basis::xform_inv_array(Vector3 *r_dst, const Vector3 *p_src, int p_count) const {
+
+	real_t xx = elements[0][0], xy = elements[0][1], xz = elements[0][2];
+	real_t yx = elements[1][0], yy = elements[1][1], yz = elements[1][2];
+	real_t zx = elements[2][0], zy = elements[2][1], zz = elements[2][2];
+
+	for (int i = 0; i < p_count; i++) {
+
+		Vector3 v = p_src[i];
+		r_dst[i] = Vector3(
+				xx * v.x + yx * v.y + zx * v.z,
+				xy * v.x + yy * v.y + zy * v.z,
+				xz * v.x + yz * v.y + zz * v.z);
+	}
+}
+
 // Multiplies the matrix from left by the scaling matrix: M -> S.M
 // See the comment for Basis::rotated for further explanation.
 void Basis::scale(const Vector3 &p_scale) {
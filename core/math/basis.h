@@ -137,6 +137,9 @@ public:
 
 	_FORCE_INLINE_ Vector3 xform(const Vector3 &p_vector) const;
 	_FORCE_INLINE_ Vector3 xform_inv(const Vector3 &p_vector) const;
+
+	void xform_array(Vector3 *r_dst, const Vector3 *p_src, int p_count) const;
+	void xform_inv_array(Vector3 *r_dst, const Vector3 *p_src, int p_count) const;
 	_FORCE_INLINE_ void operator*=(const Basis &p_matrix);
 	_FORCE_INLINE_ Basis operator*(const Basis &p_matrix) const;
 	_FORCE_INLINE_ void operator+=(const Basis &p_matrix);
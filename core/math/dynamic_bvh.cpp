@@ -0,0 +1,356 @@
+/*************************************************************************/
+/*  dynamic_bvh.cpp                                                      */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "dynamic_bvh.h"
+
+uint32_t DynamicBVH::_allocate_node() {
+
+	if (free_list == (uint32_t)INVALID_NODE) {
+		// grow the pool; the free list is threaded through 'parent'
+		uint32_t old_size = nodes.size();
+		nodes.resize(old_size == 0 ? 16 : old_size * 2);
+		Node *w = nodes.ptrw();
+		for (int i = old_size; i < nodes.size(); i++) {
+			w[i].parent = (i == nodes.size() - 1) ? (uint32_t)INVALID_NODE : (uint32_t)(i + 1);
+			w[i].height = -1;
+		}
+		free_list = old_size;
+	}
+
+	uint32_t node = free_list;
+	Node *w = nodes.ptrw();
+	free_list = w[node].parent;
+	w[node].parent = INVALID_NODE;
+	w[node].children[0] = INVALID_NODE;
+	w[node].children[1] = INVALID_NODE;
+	w[node].height = 0;
+	w[node].userdata = NULL;
+	node_count++;
+	return node;
+}
+
+void DynamicBVH::_free_node(uint32_t p_node) {
+
+	Node *w = nodes.ptrw();
+	w[p_node].parent = free_list;
+	w[p_node].height = -1;
+	free_list = p_node;
+	node_count--;
+}
+
+void DynamicBVH::_insert_leaf(uint32_t p_leaf) {
+
+	if (root == (uint32_t)INVALID_NODE) {
+		root = p_leaf;
+		nodes.ptrw()[p_leaf].parent = INVALID_NODE;
+		return;
+	}
+
+	Node *w = nodes.ptrw();
+
+	// descend towards the cheapest sibling (surface area heuristic)
+	AABB leaf_aabb = w[p_leaf].aabb;
+	uint32_t index = root;
+	while (!w[index].is_leaf()) {
+
+		uint32_t child0 = w[index].children[0];
+		uint32_t child1 = w[index].children[1];
+
+		real_t area = _aabb_cost(w[index].aabb);
+		real_t combined_area = _aabb_cost(w[index].aabb.merge(leaf_aabb));
+
+		real_t cost = 2.0 * combined_area;
+		real_t inheritance_cost = 2.0 * (combined_area - area);
+
+		real_t cost0;
+		if (w[child0].is_leaf()) {
+			cost0 = _aabb_cost(leaf_aabb.merge(w[child0].aabb)) + inheritance_cost;
+		} else {
+			real_t old_area = _aabb_cost(w[child0].aabb);
+			real_t new_area = _aabb_cost(leaf_aabb.merge(w[child0].aabb));
+			cost0 = (new_area - old_area) + inheritance_cost;
+		}
+
+		real_t cost1;
+		if (w[child1].is_leaf()) {
+			cost1 = _aabb_cost(leaf_aabb.merge(w[child1].aabb)) + inheritance_cost;
+		} else {
+			real_t old_area = _aabb_cost(w[child1].aabb);
+			real_t new_area = _aabb_cost(leaf_aabb.merge(w[child1].aabb));
+			cost1 = (new_area - old_area) + inheritance_cost;
+		}
+
+		if (cost < cost0 && cost < cost1)
+			break;
+
+		index = (cost0 < cost1) ? child0 : child1;
+	}
+
+	// create a new parent for the sibling and the leaf
+	uint32_t sibling = index;
+	uint32_t old_parent = w[sibling].parent;
+	uint32_t new_parent = _allocate_node();
+	w = nodes.ptrw(); // may have reallocated
+
+	w[new_parent].parent = old_parent;
+	w[new_parent].aabb = leaf_aabb.merge(w[sibling].aabb);
+	w[new_parent].height = w[sibling].height + 1;
+	w[new_parent].children[0] = sibling;
+	w[new_parent].children[1] = p_leaf;
+	w[sibling].parent = new_parent;
+	w[p_leaf].parent = new_parent;
+
+	if (old_parent == (uint32_t)INVALID_NODE) {
+		root = new_parent;
+	} else if (w[old_parent].children[0] == sibling) {
+		w[old_parent].children[0] = new_parent;
+	} else {
+		w[old_parent].children[1] = new_parent;
+	}
+
+	// refit and rebalance ancestors
+	index = w[p_leaf].parent;
+	while (index != (uint32_t)INVALID_NODE) {
+		index = _balance(index);
+		w = nodes.ptrw();
+
+		uint32_t child0 = w[index].children[0];
+		uint32_t child1 = w[index].children[1];
+		w[index].height = 1 + MAX(w[child0].height, w[child1].height);
+		w[index].aabb = w[child0].aabb.merge(w[child1].aabb);
+
+		index = w[index].parent;
+	}
+}
+
+void DynamicBVH::_remove_leaf(uint32_t p_leaf) {
+
+	if (root == p_leaf) {
+		root = INVALID_NODE;
+		return;
+	}
+
+	Node *w = nodes.ptrw();
+
+	uint32_t parent = w[p_leaf].parent;
+	uint32_t grand_parent = w[parent].parent;
+	uint32_t sibling = (w[parent].children[0] == p_leaf) ? w[parent].children[1] : w[parent].children[0];
+
+	if (grand_parent == (uint32_t)INVALID_NODE) {
+		root = sibling;
+		w[sibling].parent = INVALID_NODE;
+		_free_node(parent);
+		return;
+	}
+
+	// destroy the parent and connect the sibling to the grandparent
+	if (w[grand_parent].children[0] == parent) {
+		w[grand_parent].children[0] = sibling;
+	} else {
+		w[grand_parent].children[1] = sibling;
+	}
+	w[sibling].parent = grand_parent;
+	_free_node(parent);
+
+	uint32_t index = grand_parent;
+	while (index != (uint32_t)INVALID_NODE) {
+		index = _balance(index);
+		w = nodes.ptrw();
+
+		uint32_t child0 = w[index].children[0];
+		uint32_t child1 = w[index].children[1];
+		w[index].aabb = w[child0].aabb.merge(w[child1].aabb);
+		w[index].height = 1 + MAX(w[child0].height, w[child1].height);
+
+		index = w[index].parent;
+	}
+}
+
+// Standard AVL-style rotation; returns the node that took p_node's place.
+uint32_t DynamicBVH::_balance(uint32_t p_node) {
+
+	Node *w = nodes.ptrw();
+
+	uint32_t a = p_node;
+	if (w[a].is_leaf() || w[a].height < 2)
+		return a;
+
+	uint32_t b = w[a].children[0];
+	uint32_t c = w[a].children[1];
+
+	int balance = w[c].height - w[b].height;
+
+	// rotate C up
+	if (balance > 1) {
+		uint32_t f = w[c].children[0];
+		uint32_t g = w[c].children[1];
+
+		w[c].children[0] = a;
+		w[c].parent = w[a].parent;
+		w[a].parent = c;
+
+		if (w[c].parent != (uint32_t)INVALID_NODE) {
+			if (w[w[c].parent].children[0] == a) {
+				w[w[c].parent].children[0] = c;
+			} else {
+				w[w[c].parent].children[1] = c;
+			}
+		} else {
+			root = c;
+		}
+
+		if (w[f].height > w[g].height) {
+			w[c].children[1] = f;
+			w[a].children[1] = g;
+			w[g].parent = a;
+			w[a].aabb = w[b].aabb.merge(w[g].aabb);
+			w[c].aabb = w[a].aabb.merge(w[f].aabb);
+			w[a].height = 1 + MAX(w[b].height, w[g].height);
+			w[c].height = 1 + MAX(w[a].height, w[f].height);
+		} else {
+			w[c].children[1] = g;
+			w[a].children[1] = f;
+			w[f].parent = a;
+			w[a].aabb = w[b].aabb.merge(w[f].aabb);
+			w[c].aabb = w[a].aabb.merge(w[g].aabb);
+			w[a].height = 1 + MAX(w[b].height, w[f].height);
+			w[c].height = 1 + MAX(w[a].height, w[g].height);
+		}
+
+		return c;
+	}
+
+	// rotate B up
+	if (balance < -1) {
+		uint32_t d = w[b].children[0];
+		uint32_t e = w[b].children[1];
+
+		w[b].children[0] = a;
+		w[b].parent = w[a].parent;
+		w[a].parent = b;
+
+		if (w[b].parent != (uint32_t)INVALID_NODE) {
+			if (w[w[b].parent].children[0] == a) {
+				w[w[b].parent].children[0] = b;
+			} else {
+				w[w[b].parent].children[1] = b;
+			}
+		} else {
+			root = b;
+		}
+
+		if (w[d].height > w[e].height) {
+			w[b].children[1] = d;
+			w[a].children[0] = e;
+			w[e].parent = a;
+			w[a].aabb = w[c].aabb.merge(w[e].aabb);
+			w[b].aabb = w[a].aabb.merge(w[d].aabb);
+			w[a].height = 1 + MAX(w[c].height, w[e].height);
+			w[b].height = 1 + MAX(w[a].height, w[d].height);
+		} else {
+			w[b].children[1] = e;
+			w[a].children[0] = d;
+			w[d].parent = a;
+			w[a].aabb = w[c].aabb.merge(w[d].aabb);
+			w[b].aabb = w[a].aabb.merge(w[e].aabb);
+			w[a].height = 1 + MAX(w[c].height, w[d].height);
+			w[b].height = 1 + MAX(w[a].height, w[e].height);
+		}
+
+		return b;
+	}
+
+	return a;
+}
+
+DynamicBVH::ID DynamicBVH::insert(const AABB &p_aabb, void *p_userdata) {
+
+	uint32_t leaf = _allocate_node();
+	Node *w = nodes.ptrw();
+	w[leaf].aabb = p_aabb.grow(aabb_margin);
+	w[leaf].userdata = p_userdata;
+
+	_insert_leaf(leaf);
+
+	return leaf + 1;
+}
+
+bool DynamicBVH::update(ID p_id, const AABB &p_aabb) {
+
+	ERR_FAIL_COND_V(p_id == 0, false);
+	uint32_t leaf = p_id - 1;
+	ERR_FAIL_INDEX_V((int)leaf, nodes.size(), false);
+	ERR_FAIL_COND_V(!nodes[leaf].is_leaf(), false);
+
+	if (nodes[leaf].aabb.encloses(p_aabb))
+		return false; // still inside the fattened AABB, ancestors stay valid
+
+	_remove_leaf(leaf);
+	nodes.ptrw()[leaf].aabb = p_aabb.grow(aabb_margin);
+	_insert_leaf(leaf);
+
+	return true;
+}
+
+void DynamicBVH::remove(ID p_id) {
+
+	ERR_FAIL_COND(p_id == 0);
+	uint32_t leaf = p_id - 1;
+	ERR_FAIL_INDEX((int)leaf, nodes.size());
+	ERR_FAIL_COND(!nodes[leaf].is_leaf());
+
+	_remove_leaf(leaf);
+	_free_node(leaf);
+}
+
+void *DynamicBVH::get_userdata(ID p_id) const {
+
+	ERR_FAIL_COND_V(p_id == 0, NULL);
+	uint32_t leaf = p_id - 1;
+	ERR_FAIL_INDEX_V((int)leaf, nodes.size(), NULL);
+	return nodes[leaf].userdata;
+}
+
+const AABB &DynamicBVH::get_aabb(ID p_id) const {
+
+	static const AABB empty;
+	ERR_FAIL_COND_V(p_id == 0, empty);
+	uint32_t leaf = p_id - 1;
+	ERR_FAIL_INDEX_V((int)leaf, nodes.size(), empty);
+	return nodes[leaf].aabb;
+}
+
+DynamicBVH::DynamicBVH() {
+
+	root = INVALID_NODE;
+	free_list = INVALID_NODE;
+	node_count = 0;
+	aabb_margin = 0.1;
+}
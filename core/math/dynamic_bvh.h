@@ -0,0 +1,252 @@
+/*************************************************************************/
+/*  dynamic_bvh.h                                                        */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef DYNAMIC_BVH_H
+#define DYNAMIC_BVH_H
+
+#include "core/math/aabb.h"
+#include "core/math/plane.h"
+#include "core/vector.h"
+
+/**
+ * Dynamic bounding volume hierarchy (binary AABB tree) with contiguous node
+ * storage and height-balancing rotations, in the style of the trees used by
+ * Box2D and Bullet. Leaves store a fattened AABB, so small movements only
+ * refit ancestors instead of reinserting.
+ *
+ * Queries are const and touch no shared state, so any number of threads may
+ * cull concurrently as long as no insert/update/remove runs at the same time.
+ */
+class DynamicBVH {
+public:
+	typedef uint32_t ID; // 0 is an invalid ID
+
+private:
+	enum {
+		INVALID_NODE = 0xFFFFFFFF
+	};
+
+	struct Node {
+		AABB aabb; // fattened for leaves
+		uint32_t parent; // doubles as next free index when on the free list
+		uint32_t children[2];
+		int32_t height; // 0 for leaves, -1 when free
+		void *userdata;
+
+		_FORCE_INLINE_ bool is_leaf() const { return children[0] == INVALID_NODE; }
+	};
+
+	Vector<Node> nodes;
+	uint32_t root;
+	uint32_t free_list;
+	int node_count;
+	real_t aabb_margin;
+
+	uint32_t _allocate_node();
+	void _free_node(uint32_t p_node);
+	void _insert_leaf(uint32_t p_leaf);
+	void _remove_leaf(uint32_t p_leaf);
+	uint32_t _balance(uint32_t p_node);
+
+	static _FORCE_INLINE_ real_t _aabb_cost(const AABB &p_aabb) {
+		const Vector3 size = p_aabb.size;
+		return size.x * (size.y + size.z) + size.y * size.z; // surface area / 2
+	}
+
+public:
+	ID insert(const AABB &p_aabb, void *p_userdata);
+	// Returns true if the leaf had to be reinserted (moved out of its
+	// fattened AABB), false if the stored data still covers p_aabb.
+	bool update(ID p_id, const AABB &p_aabb);
+	void remove(ID p_id);
+
+	void *get_userdata(ID p_id) const;
+	const AABB &get_aabb(ID p_id) const;
+
+	int get_element_count() const { return node_count == 0 ? 0 : (node_count + 1) / 2; }
+
+	void set_aabb_margin(real_t p_margin) { aabb_margin = p_margin; }
+
+	/* Read-only queries; QueryResult is called as r_result(void *userdata)
+	 * and may return true to abort the query early. */
+
+	template <class QueryResult>
+	_FORCE_INLINE_ void aabb_query(const AABB &p_aabb, QueryResult &r_result) const;
+	template <class QueryResult>
+	_FORCE_INLINE_ void convex_query(const Plane *p_planes, int p_plane_count, QueryResult &r_result) const;
+	template <class QueryResult>
+	_FORCE_INLINE_ void segment_query(const Vector3 &p_from, const Vector3 &p_to, QueryResult &r_result) const;
+	template <class QueryResult>
+	_FORCE_INLINE_ void point_query(const Vector3 &p_point, QueryResult &r_result) const;
+
+	DynamicBVH();
+};
+
+template <class QueryResult>
+void DynamicBVH::aabb_query(const AABB &p_aabb, QueryResult &r_result) const {
+
+	if (root == (uint32_t)INVALID_NODE)
+		return;
+
+	const Node *nodes_ptr = nodes.ptr();
+	uint32_t stack[64];
+	int stack_pos = 0;
+	stack[stack_pos++] = root;
+
+	while (stack_pos) {
+
+		const Node &node = nodes_ptr[stack[--stack_pos]];
+		if (!node.aabb.intersects(p_aabb))
+			continue;
+
+		if (node.is_leaf()) {
+			if (r_result(node.userdata))
+				return;
+		} else {
+			if (unlikely(stack_pos + 2 > 64)) {
+				ERR_PRINT("DynamicBVH query stack overflow, tree too deep.");
+				return;
+			}
+			stack[stack_pos++] = node.children[0];
+			stack[stack_pos++] = node.children[1];
+		}
+	}
+}
+
+template <class QueryResult>
+void DynamicBVH::convex_query(const Plane *p_planes, int p_plane_count, QueryResult &r_result) const {
+
+	if (root == (uint32_t)INVALID_NODE)
+		return;
+
+	const Node *nodes_ptr = nodes.ptr();
+	uint32_t stack[64];
+	int stack_pos = 0;
+	stack[stack_pos++] = root;
+
+	while (stack_pos) {
+
+		const Node &node = nodes_ptr[stack[--stack_pos]];
+
+		bool outside = false;
+		for (int i = 0; i < p_plane_count; i++) {
+			Vector3 support = node.aabb.position;
+			const Vector3 &normal = p_planes[i].normal;
+			if (normal.x < 0)
+				support.x += node.aabb.size.x;
+			if (normal.y < 0)
+				support.y += node.aabb.size.y;
+			if (normal.z < 0)
+				support.z += node.aabb.size.z;
+			if (p_planes[i].is_point_over(support)) {
+				outside = true;
+				break;
+			}
+		}
+		if (outside)
+			continue;
+
+		if (node.is_leaf()) {
+			if (r_result(node.userdata))
+				return;
+		} else {
+			if (unlikely(stack_pos + 2 > 64)) {
+				ERR_PRINT("DynamicBVH query stack overflow, tree too deep.");
+				return;
+			}
+			stack[stack_pos++] = node.children[0];
+			stack[stack_pos++] = node.children[1];
+		}
+	}
+}
+
+template <class QueryResult>
+void DynamicBVH::segment_query(const Vector3 &p_from, const Vector3 &p_to, QueryResult &r_result) const {
+
+	if (root == (uint32_t)INVALID_NODE)
+		return;
+
+	const Node *nodes_ptr = nodes.ptr();
+	uint32_t stack[64];
+	int stack_pos = 0;
+	stack[stack_pos++] = root;
+
+	while (stack_pos) {
+
+		const Node &node = nodes_ptr[stack[--stack_pos]];
+		if (!node.aabb.intersects_segment(p_from, p_to))
+			continue;
+
+		if (node.is_leaf()) {
+			if (r_result(node.userdata))
+				return;
+		} else {
+			if (unlikely(stack_pos + 2 > 64)) {
+				ERR_PRINT("DynamicBVH query stack overflow, tree too deep.");
+				return;
+			}
+			stack[stack_pos++] = node.children[0];
+			stack[stack_pos++] = node.children[1];
+		}
+	}
+}
+
+template <class QueryResult>
+void DynamicBVH::point_query(const Vector3 &p_point, QueryResult &r_result) const {
+
+	if (root == (uint32_t)INVALID_NODE)
+		return;
+
+	const Node *nodes_ptr = nodes.ptr();
+	uint32_t stack[64];
+	int stack_pos = 0;
+	stack[stack_pos++] = root;
+
+	while (stack_pos) {
+
+		const Node &node = nodes_ptr[stack[--stack_pos]];
+		if (!node.aabb.has_point(p_point))
+			continue;
+
+		if (node.is_leaf()) {
+			if (r_result(node.userdata))
+				return;
+		} else {
+			if (unlikely(stack_pos + 2 > 64)) {
+				ERR_PRINT("DynamicBVH query stack overflow, tree too deep.");
+				return;
+			}
+			stack[stack_pos++] = node.children[0];
+			stack[stack_pos++] = node.children[1];
+		}
+	}
+}
+
+#endif // DYNAMIC_BVH_H
@@ -1933,230 +1933,444 @@ bool Expression::_compile_expression() {
 	return false;
 }
 
-bool Expression::_execute(const Array &p_inputs, Object *p_instance, Expression::ENode *p_node, Variant &r_ret, String &r_error_str) {
+static bool _expression_is_shareable(const Variant &p_value) {
 
-	switch (p_node->type) {
-		case Expression::ENode::TYPE_INPUT: {
+	// Containers and objects are shared by reference, so folding them into a
+	// constant would leak state between executions.
+	Variant::Type type = p_value.get_type();
+	return type != Variant::ARRAY && type != Variant::DICTIONARY && type != Variant::OBJECT;
+}
 
-			const Expression::InputNode *in = static_cast<const Expression::InputNode *>(p_node);
-			if (in->index < 0 || in->index >= p_inputs.size()) {
-				r_error_str = vformat(RTR("Invalid input %i (not passed) in expression"), in->index);
-				return true;
-			}
-			r_ret = p_inputs[in->index];
-		} break;
-		case Expression::ENode::TYPE_CONSTANT: {
+static bool _expression_func_is_pure(Expression::BuiltinFunc p_func) {
+
+	switch (p_func) {
+		case Expression::MATH_RANDOMIZE:
+		case Expression::MATH_RAND:
+		case Expression::MATH_RANDF:
+		case Expression::MATH_RANDOM:
+		case Expression::MATH_SEED:
+		case Expression::MATH_RANDSEED:
+		case Expression::TEXT_PRINT:
+		case Expression::TEXT_PRINTERR:
+		case Expression::TEXT_PRINTRAW:
+		case Expression::OBJ_WEAKREF:
+		case Expression::FUNC_FUNCREF:
+			return false;
+		default:
+			return true;
+	}
+}
 
-			const Expression::ConstantNode *c = static_cast<const Expression::ConstantNode *>(p_node);
-			r_ret = c->value;
+int Expression::_materialize(int p_value) {
 
+	if (p_value >= 0)
+		return p_value;
+
+	Instruction ins;
+	ins.type = ENode::TYPE_CONSTANT;
+	ins.constant = folded_constants[-p_value - 1];
+	ins.target = register_count++;
+	instructions.push_back(ins);
+	return ins.target;
+}
+
+// Compiles a node, returning either the register its instruction writes to
+// (>= 0) or a folded constant encoded as -index - 1. Folding only happens when
+// it cannot be observed: pure operations on constant operands whose result is
+// not shared by reference; runtime errors are never folded so their messages
+// stay intact.
+int Expression::_compile_node(const ENode *p_node) {
+
+	switch (p_node->type) {
+		case ENode::TYPE_INPUT: {
+
+			const InputNode *in = static_cast<const InputNode *>(p_node);
+
+			Instruction ins;
+			ins.type = ENode::TYPE_INPUT;
+			ins.input_index = in->index;
+			ins.target = register_count++;
+			instructions.push_back(ins);
+			return ins.target;
 		} break;
-		case Expression::ENode::TYPE_SELF: {
+		case ENode::TYPE_CONSTANT: {
 
-			if (!p_instance) {
-				r_error_str = RTR("self can't be used because instance is null (not passed)");
-				return true;
-			}
-			r_ret = p_instance;
+			const ConstantNode *cn = static_cast<const ConstantNode *>(p_node);
+			folded_constants.push_back(cn->value);
+			return -folded_constants.size();
 		} break;
-		case Expression::ENode::TYPE_OPERATOR: {
+		case ENode::TYPE_SELF: {
 
-			const Expression::OperatorNode *op = static_cast<const Expression::OperatorNode *>(p_node);
+			Instruction ins;
+			ins.type = ENode::TYPE_SELF;
+			ins.target = register_count++;
+			instructions.push_back(ins);
+			return ins.target;
+		} break;
+		case ENode::TYPE_OPERATOR: {
 
-			Variant a;
-			bool ret = _execute(p_inputs, p_instance, op->nodes[0], a, r_error_str);
-			if (ret)
-				return true;
+			const OperatorNode *op = static_cast<const OperatorNode *>(p_node);
 
-			Variant b;
+			int a = _compile_node(op->nodes[0]);
+			int b = -1;
+			if (op->nodes[1])
+				b = _compile_node(op->nodes[1]);
 
-			if (op->nodes[1]) {
-				ret = _execute(p_inputs, p_instance, op->nodes[1], b, r_error_str);
-				if (ret)
-					return true;
+			if (a < 0 && (!op->nodes[1] || b < 0)) {
+				bool valid = true;
+				Variant folded;
+				Variant empty;
+				Variant::evaluate(op->op, folded_constants[-a - 1], op->nodes[1] ? folded_constants[-b - 1] : empty, folded, valid);
+				if (valid && _expression_is_shareable(folded)) {
+					folded_constants.push_back(folded);
+					return -folded_constants.size();
+				}
 			}
 
-			bool valid = true;
-			Variant::evaluate(op->op, a, b, r_ret, valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid operands to operator %s, %s and %s."), Variant::get_operator_name(op->op), Variant::get_type_name(a.get_type()), Variant::get_type_name(b.get_type()));
-				return true;
+			Instruction ins;
+			ins.type = ENode::TYPE_OPERATOR;
+			ins.op = op->op;
+			ins.args[0] = _materialize(a);
+			ins.args[1] = op->nodes[1] ? _materialize(b) : -1;
+			ins.target = register_count++;
+			instructions.push_back(ins);
+			return ins.target;
+		} break;
+		case ENode::TYPE_INDEX: {
+
+			const IndexNode *index = static_cast<const IndexNode *>(p_node);
+
+			int base = _compile_node(index->base);
+			int idx = _compile_node(index->index);
+
+			if (base < 0 && idx < 0) {
+				bool valid = false;
+				Variant folded = folded_constants[-base - 1].get(folded_constants[-idx - 1], &valid);
+				if (valid && _expression_is_shareable(folded)) {
+					folded_constants.push_back(folded);
+					return -folded_constants.size();
+				}
 			}
 
+			Instruction ins;
+			ins.type = ENode::TYPE_INDEX;
+			ins.args[0] = _materialize(base);
+			ins.args[1] = _materialize(idx);
+			ins.target = register_count++;
+			instructions.push_back(ins);
+			return ins.target;
 		} break;
-		case Expression::ENode::TYPE_INDEX: {
+		case ENode::TYPE_NAMED_INDEX: {
 
-			const Expression::IndexNode *index = static_cast<const Expression::IndexNode *>(p_node);
+			const NamedIndexNode *index = static_cast<const NamedIndexNode *>(p_node);
 
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, index->base, base, r_error_str);
-			if (ret)
-				return true;
+			int base = _compile_node(index->base);
 
-			Variant idx;
+			if (base < 0) {
+				bool valid = false;
+				Variant folded = folded_constants[-base - 1].get_named(index->name, &valid);
+				if (valid && _expression_is_shareable(folded)) {
+					folded_constants.push_back(folded);
+					return -folded_constants.size();
+				}
+			}
+
+			Instruction ins;
+			ins.type = ENode::TYPE_NAMED_INDEX;
+			ins.name = index->name;
+			ins.args[0] = _materialize(base);
+			ins.target = register_count++;
+			instructions.push_back(ins);
+			return ins.target;
+		} break;
+		case ENode::TYPE_ARRAY: {
 
-			ret = _execute(p_inputs, p_instance, index->index, idx, r_error_str);
-			if (ret)
-				return true;
+			const ArrayNode *array = static_cast<const ArrayNode *>(p_node);
 
-			bool valid;
-			r_ret = base.get(idx, &valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid index of type %s for base type %s"), Variant::get_type_name(idx.get_type()), Variant::get_type_name(base.get_type()));
-				return true;
+			// Array and Dictionary literals are never folded: each execution
+			// has to produce a fresh container.
+			Instruction ins;
+			ins.type = ENode::TYPE_ARRAY;
+			ins.arg_regs.resize(array->array.size());
+			for (int i = 0; i < array->array.size(); i++) {
+				ins.arg_regs.write[i] = _materialize(_compile_node(array->array[i]));
 			}
+			ins.target = register_count++;
+			instructions.push_back(ins);
+			return ins.target;
+		} break;
+		case ENode::TYPE_DICTIONARY: {
+
+			const DictionaryNode *dictionary = static_cast<const DictionaryNode *>(p_node);
 
+			Instruction ins;
+			ins.type = ENode::TYPE_DICTIONARY;
+			ins.arg_regs.resize(dictionary->dict.size());
+			for (int i = 0; i < dictionary->dict.size(); i++) {
+				ins.arg_regs.write[i] = _materialize(_compile_node(dictionary->dict[i]));
+			}
+			ins.target = register_count++;
+			instructions.push_back(ins);
+			return ins.target;
 		} break;
-		case Expression::ENode::TYPE_NAMED_INDEX: {
+		case ENode::TYPE_CONSTRUCTOR: {
+
+			const ConstructorNode *constructor = static_cast<const ConstructorNode *>(p_node);
 
-			const Expression::NamedIndexNode *index = static_cast<const Expression::NamedIndexNode *>(p_node);
+			Vector<int> args;
+			args.resize(constructor->arguments.size());
+			bool all_const = true;
+			for (int i = 0; i < constructor->arguments.size(); i++) {
+				args.write[i] = _compile_node(constructor->arguments[i]);
+				if (args[i] >= 0)
+					all_const = false;
+			}
 
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, index->base, base, r_error_str);
-			if (ret)
-				return true;
+			if (all_const) {
+				Vector<const Variant *> argp;
+				argp.resize(args.size());
+				for (int i = 0; i < args.size(); i++) {
+					argp.write[i] = &folded_constants[-args[i] - 1];
+				}
 
-			bool valid;
-			r_ret = base.get_named(index->name, &valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid named index '%s' for base type %s"), String(index->name), Variant::get_type_name(base.get_type()));
-				return true;
+				Variant::CallError ce;
+				Variant folded = Variant::construct(constructor->data_type, (const Variant **)argp.ptr(), argp.size(), ce);
+				if (ce.error == Variant::CallError::CALL_OK && _expression_is_shareable(folded)) {
+					folded_constants.push_back(folded);
+					return -folded_constants.size();
+				}
 			}
 
+			Instruction ins;
+			ins.type = ENode::TYPE_CONSTRUCTOR;
+			ins.data_type = constructor->data_type;
+			ins.arg_regs.resize(args.size());
+			for (int i = 0; i < args.size(); i++) {
+				ins.arg_regs.write[i] = _materialize(args[i]);
+			}
+			ins.target = register_count++;
+			instructions.push_back(ins);
+			return ins.target;
 		} break;
-		case Expression::ENode::TYPE_ARRAY: {
-			const Expression::ArrayNode *array = static_cast<const Expression::ArrayNode *>(p_node);
+		case ENode::TYPE_BUILTIN_FUNC: {
 
-			Array arr;
-			arr.resize(array->array.size());
-			for (int i = 0; i < array->array.size(); i++) {
+			const BuiltinFuncNode *bifunc = static_cast<const BuiltinFuncNode *>(p_node);
 
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, array->array[i], value, r_error_str);
+			Vector<int> args;
+			args.resize(bifunc->arguments.size());
+			bool all_const = true;
+			for (int i = 0; i < bifunc->arguments.size(); i++) {
+				args.write[i] = _compile_node(bifunc->arguments[i]);
+				if (args[i] >= 0)
+					all_const = false;
+			}
 
-				if (ret)
-					return true;
-				arr[i] = value;
+			if (all_const && _expression_func_is_pure(bifunc->func)) {
+				Vector<const Variant *> argp;
+				argp.resize(args.size());
+				for (int i = 0; i < args.size(); i++) {
+					argp.write[i] = &folded_constants[-args[i] - 1];
+				}
+
+				Variant folded;
+				Variant::CallError ce;
+				String error_str;
+				exec_func(bifunc->func, (const Variant **)argp.ptr(), &folded, ce, error_str);
+				if (ce.error == Variant::CallError::CALL_OK && _expression_is_shareable(folded)) {
+					folded_constants.push_back(folded);
+					return -folded_constants.size();
+				}
+			}
+
+			Instruction ins;
+			ins.type = ENode::TYPE_BUILTIN_FUNC;
+			ins.func = bifunc->func;
+			ins.arg_regs.resize(args.size());
+			for (int i = 0; i < args.size(); i++) {
+				ins.arg_regs.write[i] = _materialize(args[i]);
 			}
+			ins.target = register_count++;
+			instructions.push_back(ins);
+			return ins.target;
+		} break;
+		case ENode::TYPE_CALL: {
 
-			r_ret = arr;
+			const CallNode *call = static_cast<const CallNode *>(p_node);
 
+			// Method calls are never folded, they may have side effects on the base.
+			Instruction ins;
+			ins.type = ENode::TYPE_CALL;
+			ins.name = call->method;
+			ins.args[0] = _materialize(_compile_node(call->base));
+			ins.arg_regs.resize(call->arguments.size());
+			for (int i = 0; i < call->arguments.size(); i++) {
+				ins.arg_regs.write[i] = _materialize(_compile_node(call->arguments[i]));
+			}
+			ins.target = register_count++;
+			instructions.push_back(ins);
+			return ins.target;
 		} break;
-		case Expression::ENode::TYPE_DICTIONARY: {
-			const Expression::DictionaryNode *dictionary = static_cast<const Expression::DictionaryNode *>(p_node);
+	}
 
-			Dictionary d;
-			for (int i = 0; i < dictionary->dict.size(); i += 2) {
+	CRASH_NOW(); // unreachable
+}
 
-				Variant key;
-				bool ret = _execute(p_inputs, p_instance, dictionary->dict[i + 0], key, r_error_str);
+void Expression::_compile() {
 
-				if (ret)
-					return true;
+	instructions.clear();
+	folded_constants.clear();
+	register_count = 0;
 
-				Variant value;
-				ret = _execute(p_inputs, p_instance, dictionary->dict[i + 1], value, r_error_str);
-				if (ret)
-					return true;
+	result_register = _materialize(_compile_node(root));
 
-				d[key] = value;
-			}
+	folded_constants.clear();
+}
 
-			r_ret = d;
-		} break;
-		case Expression::ENode::TYPE_CONSTRUCTOR: {
+bool Expression::_run(const Array &p_inputs, Object *p_instance, Variant *r_registers, Variant &r_ret, String &r_error_str) {
 
-			const Expression::ConstructorNode *constructor = static_cast<const Expression::ConstructorNode *>(p_node);
+	for (int i = 0; i < instructions.size(); i++) {
 
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(constructor->arguments.size());
-			argp.resize(constructor->arguments.size());
+		const Instruction &ins = instructions[i];
+		Variant *target = &r_registers[ins.target];
 
-			for (int i = 0; i < constructor->arguments.size(); i++) {
+		switch (ins.type) {
+			case ENode::TYPE_INPUT: {
 
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, constructor->arguments[i], value, r_error_str);
+				if (ins.input_index < 0 || ins.input_index >= p_inputs.size()) {
+					r_error_str = vformat(RTR("Invalid input %i (not passed) in expression"), ins.input_index);
+					return true;
+				}
+				*target = p_inputs[ins.input_index];
+			} break;
+			case ENode::TYPE_CONSTANT: {
 
-				if (ret)
+				*target = ins.constant;
+
+			} break;
+			case ENode::TYPE_SELF: {
+
+				if (!p_instance) {
+					r_error_str = RTR("self can't be used because instance is null (not passed)");
 					return true;
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
-			}
+				}
+				*target = p_instance;
+			} break;
+			case ENode::TYPE_OPERATOR: {
 
-			Variant::CallError ce;
-			r_ret = Variant::construct(constructor->data_type, (const Variant **)argp.ptr(), argp.size(), ce);
+				const Variant &a = r_registers[ins.args[0]];
+				const Variant empty;
+				const Variant &b = ins.args[1] >= 0 ? r_registers[ins.args[1]] : empty;
 
-			if (ce.error != Variant::CallError::CALL_OK) {
-				r_error_str = vformat(RTR("Invalid arguments to construct '%s'"), Variant::get_type_name(constructor->data_type));
-				return true;
-			}
+				bool valid = true;
+				Variant::evaluate(ins.op, a, b, *target, valid);
+				if (!valid) {
+					r_error_str = vformat(RTR("Invalid operands to operator %s, %s and %s."), Variant::get_operator_name(ins.op), Variant::get_type_name(a.get_type()), Variant::get_type_name(b.get_type()));
+					return true;
+				}
 
-		} break;
-		case Expression::ENode::TYPE_BUILTIN_FUNC: {
+			} break;
+			case ENode::TYPE_INDEX: {
 
-			const Expression::BuiltinFuncNode *bifunc = static_cast<const Expression::BuiltinFuncNode *>(p_node);
+				const Variant &base = r_registers[ins.args[0]];
+				const Variant &idx = r_registers[ins.args[1]];
 
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(bifunc->arguments.size());
-			argp.resize(bifunc->arguments.size());
+				bool valid;
+				*target = base.get(idx, &valid);
+				if (!valid) {
+					r_error_str = vformat(RTR("Invalid index of type %s for base type %s"), Variant::get_type_name(idx.get_type()), Variant::get_type_name(base.get_type()));
+					return true;
+				}
 
-			for (int i = 0; i < bifunc->arguments.size(); i++) {
+			} break;
+			case ENode::TYPE_NAMED_INDEX: {
 
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, bifunc->arguments[i], value, r_error_str);
-				if (ret)
+				const Variant &base = r_registers[ins.args[0]];
+
+				bool valid;
+				*target = base.get_named(ins.name, &valid);
+				if (!valid) {
+					r_error_str = vformat(RTR("Invalid named index '%s' for base type %s"), String(ins.name), Variant::get_type_name(base.get_type()));
 					return true;
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
-			}
+				}
 
-			Variant::CallError ce;
-			exec_func(bifunc->func, (const Variant **)argp.ptr(), &r_ret, ce, r_error_str);
+			} break;
+			case ENode::TYPE_ARRAY: {
 
-			if (ce.error != Variant::CallError::CALL_OK) {
-				r_error_str = "Builtin Call Failed. " + r_error_str;
-				return true;
-			}
+				Array arr;
+				arr.resize(ins.arg_regs.size());
+				for (int j = 0; j < ins.arg_regs.size(); j++) {
+					arr[j] = r_registers[ins.arg_regs[j]];
+				}
 
-		} break;
-		case Expression::ENode::TYPE_CALL: {
+				*target = arr;
 
-			const Expression::CallNode *call = static_cast<const Expression::CallNode *>(p_node);
+			} break;
+			case ENode::TYPE_DICTIONARY: {
 
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, call->base, base, r_error_str);
+				Dictionary d;
+				for (int j = 0; j < ins.arg_regs.size(); j += 2) {
+					d[r_registers[ins.arg_regs[j + 0]]] = r_registers[ins.arg_regs[j + 1]];
+				}
 
-			if (ret)
-				return true;
+				*target = d;
+			} break;
+			case ENode::TYPE_CONSTRUCTOR: {
 
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(call->arguments.size());
-			argp.resize(call->arguments.size());
+				Vector<const Variant *> argp;
+				argp.resize(ins.arg_regs.size());
+				for (int j = 0; j < ins.arg_regs.size(); j++) {
+					argp.write[j] = &r_registers[ins.arg_regs[j]];
+				}
 
-			for (int i = 0; i < call->arguments.size(); i++) {
+				Variant::CallError ce;
+				*target = Variant::construct(ins.data_type, (const Variant **)argp.ptr(), argp.size(), ce);
+
+				if (ce.error != Variant::CallError::CALL_OK) {
+					r_error_str = vformat(RTR("Invalid arguments to construct '%s'"), Variant::get_type_name(ins.data_type));
+					return true;
+				}
 
-				Variant value;
-				ret = _execute(p_inputs, p_instance, call->arguments[i], value, r_error_str);
+			} break;
+			case ENode::TYPE_BUILTIN_FUNC: {
+
+				Vector<const Variant *> argp;
+				argp.resize(ins.arg_regs.size());
+				for (int j = 0; j < ins.arg_regs.size(); j++) {
+					argp.write[j] = &r_registers[ins.arg_regs[j]];
+				}
+
+				Variant::CallError ce;
+				exec_func(ins.func, (const Variant **)argp.ptr(), target, ce, r_error_str);
 
-				if (ret)
+				if (ce.error != Variant::CallError::CALL_OK) {
+					r_error_str = "Builtin Call Failed. " + r_error_str;
 					return true;
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
-			}
+				}
 
-			Variant::CallError ce;
-			r_ret = base.call(call->method, (const Variant **)argp.ptr(), argp.size(), ce);
+			} break;
+			case ENode::TYPE_CALL: {
 
-			if (ce.error != Variant::CallError::CALL_OK) {
-				r_error_str = vformat(RTR("On call to '%s':"), String(call->method));
-				return true;
-			}
+				Variant &base = r_registers[ins.args[0]];
 
-		} break;
+				Vector<const Variant *> argp;
+				argp.resize(ins.arg_regs.size());
+				for (int j = 0; j < ins.arg_regs.size(); j++) {
+					argp.write[j] = &r_registers[ins.arg_regs[j]];
+				}
+
+				Variant::CallError ce;
+				*target = base.call(ins.name, (const Variant **)argp.ptr(), argp.size(), ce);
+
+				if (ce.error != Variant::CallError::CALL_OK) {
+					r_error_str = vformat(RTR("On call to '%s':"), String(ins.name));
+					return true;
+				}
+
+			} break;
+		}
 	}
+
+	r_ret = r_registers[result_register];
 	return false;
 }
 
@@ -2185,6 +2399,8 @@ Error Expression::parse(const String &p_expression, const Vector<String> &p_inpu
 		return ERR_INVALID_PARAMETER;
 	}
 
+	_compile();
+
 	return OK;
 }
 
@@ -2195,7 +2411,11 @@ Variant Expression::execute(Array p_inputs, Object *p_base, bool p_show_error) {
 	execution_error = false;
 	Variant output;
 	String error_txt;
-	bool err = _execute(p_inputs, p_base, root, output, error_txt);
+
+	Vector<Variant> registers;
+	registers.resize(register_count);
+
+	bool err = _run(p_inputs, p_base, registers.ptrw(), output, error_txt);
 	if (err) {
 		execution_error = true;
 		error_str = error_txt;
@@ -2205,6 +2425,37 @@ Variant Expression::execute(Array p_inputs, Object *p_base, bool p_show_error) {
 	return output;
 }
 
+Array Expression::execute_batch(Array p_input_sets, Object *p_base, bool p_show_error) {
+
+	ERR_FAIL_COND_V_MSG(error_set, Array(), "There was previously a parse error: " + error_str + ".");
+
+	execution_error = false;
+	Array results;
+	results.resize(p_input_sets.size());
+
+	// The register buffer is shared across the whole batch, so per-evaluation
+	// cost is just the instruction loop.
+	Vector<Variant> registers;
+	registers.resize(register_count);
+	Variant *regs = registers.ptrw();
+
+	for (int i = 0; i < p_input_sets.size(); i++) {
+
+		Variant output;
+		String error_txt;
+		bool err = _run(p_input_sets[i], p_base, regs, output, error_txt);
+		if (err) {
+			execution_error = true;
+			error_str = error_txt;
+			ERR_FAIL_COND_V_MSG(p_show_error, results, error_str);
+			break;
+		}
+		results[i] = output;
+	}
+
+	return results;
+}
+
 bool Expression::has_execute_failed() const {
 	return execution_error;
 }
@@ -2217,6 +2468,7 @@ void Expression::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("parse", "expression", "input_names"), &Expression::parse, DEFVAL(Vector<String>()));
 	ClassDB::bind_method(D_METHOD("execute", "inputs", "base_instance", "show_error"), &Expression::execute, DEFVAL(Array()), DEFVAL(Variant()), DEFVAL(true));
+	ClassDB::bind_method(D_METHOD("execute_batch", "input_sets", "base_instance", "show_error"), &Expression::execute_batch, DEFVAL(Variant()), DEFVAL(true));
 	ClassDB::bind_method(D_METHOD("has_execute_failed"), &Expression::has_execute_failed);
 	ClassDB::bind_method(D_METHOD("get_error_text"), &Expression::get_error_text);
 }
@@ -2227,6 +2479,8 @@ Expression::Expression() :
 		error_set(true),
 		root(NULL),
 		nodes(NULL),
+		register_count(0),
+		result_register(0),
 		execution_error(false) {
 }
 
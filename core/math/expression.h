@@ -345,8 +345,44 @@ private:
 
 	Vector<String> input_names;
 
+	// Flat bytecode compiled from the parsed tree, so execute() runs a linear
+	// instruction loop over numbered registers instead of re-walking ENodes.
+	struct Instruction {
+
+		ENode::Type type;
+		int target; //destination register
+		int args[2]; //source registers, -1 for the second one on unary operators
+		int input_index;
+		Variant::Operator op;
+		Variant::Type data_type;
+		BuiltinFunc func;
+		StringName name;
+		Variant constant;
+		Vector<int> arg_regs; //source registers for variadic instructions
+
+		Instruction() {
+			type = ENode::TYPE_CONSTANT;
+			target = 0;
+			args[0] = -1;
+			args[1] = -1;
+			input_index = 0;
+			op = Variant::OP_MAX;
+			data_type = Variant::NIL;
+			func = FUNC_MAX;
+		}
+	};
+
+	Vector<Instruction> instructions;
+	Vector<Variant> folded_constants; //only used while compiling
+	int register_count;
+	int result_register;
+
+	void _compile();
+	int _compile_node(const ENode *p_node);
+	int _materialize(int p_value);
+
 	bool execution_error;
-	bool _execute(const Array &p_inputs, Object *p_instance, Expression::ENode *p_node, Variant &r_ret, String &r_error_str);
+	bool _run(const Array &p_inputs, Object *p_instance, Variant *r_registers, Variant &r_ret, String &r_error_str);
 
 protected:
 	static void _bind_methods();
@@ -354,6 +390,7 @@ protected:
 public:
 	Error parse(const String &p_expression, const Vector<String> &p_input_names = Vector<String>());
 	Variant execute(Array p_inputs, Object *p_base = NULL, bool p_show_error = true);
+	Array execute_batch(Array p_input_sets, Object *p_base = NULL, bool p_show_error = true);
 	bool has_execute_failed() const;
 	String get_error_text() const;
 
@@ -184,6 +184,8 @@ private:
 		typename List<PairData *, AL>::Element *eA, *eB;
 	};
 
+	//ordered maps on purpose: pair processing order must be reproducible
+	//for deterministic (lockstep) simulation, do not swap for a HashMap
 	typedef Map<OctreeElementID, Element, Comparator<OctreeElementID>, AL> ElementMap;
 	typedef Map<PairKey, PairData, Comparator<PairKey>, AL> PairMap;
 	ElementMap element_map;
@@ -116,6 +116,46 @@ void Transform::set_look_at(const Vector3 &p_eye, const Vector3 &p_target, const
 	origin = p_eye;
 }
 
+void Transform::xform_array(Vector3 *r_dst, const Vector3 *p_src, int p_count) const {
+
+	// Hoist the matrix into locals so the loop body only touches the vertex
+	// stream; this lets the compiler keep the coefficients in registers and
+	// vectorize the loop where the target arch allows it.
+	real_t xx = basis.elements[0][0], xy = basis.elements[0][1], xz = basis.elements[0][2];
+	real_t yx = basis.elements[1][0], yy = basis.elements[1][1], yz = basis.elements[1][2];
+	real_t zx = basis.elements[2][0], zy = basis.elements[2][1], zz = basis.elements[2][2];
+	real_t ox = origin.x, oy = origin.y, oz = origin.z;
+
+	for (int i = 0; i < p_count; i++) {
+
+		Vector3 v = p_src[i];
+		r_dst[i] = Vector3(
+				xx * v.x + xy * v.y + xz * v.z + ox,
+				yx * v.x + yy * v.y + yz * v.z + oy,
+				zx * v.x + zy * v.y + zz * v.z + oz);
+	}
+}
+
+void Transform::xform_inv_array(Vector3 *r_dst, const Vector3 *p_src, int p_count) const {
+
+	real_t xx = basis.elements[0][0], xy = basis.elements[0][1], xz = basis.elements[0][2];
+	real_t yx = basis.elements[1][0], yy = basis.elements[1][1], yz = basis.elements[1][2];
+	real_t zx = basis.elements[2][0], zy = basis.elements[2][1], zz = basis.elements[2][2];
+	real_t ox = origin.x, oy = origin.y, oz = origin.z;
+
+	for (int i = 0; i < p_count; i++) {
+
+		Vector3 v = p_src[i];
+		v.x -= ox;
+		v.y -= oy;
+		v.z -= oz;
+		r_dst[i] = Vector3(
+				xx * v.x + yx * v.y + zx * v.z,
+				xy * v.x + yy * v.y + zy * v.z,
+				xz * v.x + yz * v.y + zz * v.z);
+	}
+}
+
 Transform Transform::interpolate_with(const Transform &p_transform, real_t p_c) const {
 
 	/* not sure if very "efficient" but good enough? */
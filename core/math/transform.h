@@ -87,6 +87,9 @@ public:
 	_FORCE_INLINE_ PoolVector<Vector3> xform(const PoolVector<Vector3> &p_array) const;
 	_FORCE_INLINE_ PoolVector<Vector3> xform_inv(const PoolVector<Vector3> &p_array) const;
 
+	void xform_array(Vector3 *r_dst, const Vector3 *p_src, int p_count) const;
+	void xform_inv_array(Vector3 *r_dst, const Vector3 *p_src, int p_count) const;
+
 	void operator*=(const Transform &p_transform);
 	Transform operator*(const Transform &p_transform) const;
 
@@ -218,9 +221,7 @@ PoolVector<Vector3> Transform::xform(const PoolVector<Vector3> &p_array) const {
 	PoolVector<Vector3>::Read r = p_array.read();
 	PoolVector<Vector3>::Write w = array.write();
 
-	for (int i = 0; i < p_array.size(); ++i) {
-		w[i] = xform(r[i]);
-	}
+	xform_array(w.ptr(), r.ptr(), p_array.size());
 	return array;
 }
 
@@ -232,9 +233,7 @@ PoolVector<Vector3> Transform::xform_inv(const PoolVector<Vector3> &p_array) con
 	PoolVector<Vector3>::Read r = p_array.read();
 	PoolVector<Vector3>::Write w = array.write();
 
-	for (int i = 0; i < p_array.size(); ++i) {
-		w[i] = xform_inv(r[i]);
-	}
+	xform_inv_array(w.ptr(), r.ptr(), p_array.size());
 	return array;
 }
 
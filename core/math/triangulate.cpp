@@ -82,56 +82,97 @@ bool Triangulate::is_inside_triangle(real_t Ax, real_t Ay,
 	}
 };
 
-bool Triangulate::snip(const Vector<Vector2> &p_contour, int u, int v, int w, int n, const Vector<int> &V, bool relaxed) {
-	int p;
+// Only reflex vertices can lie inside a candidate ear of a simple polygon,
+// so they are the only ones the containment test has to visit. Colinear
+// vertices are conservatively kept as potential blockers.
+static _FORCE_INLINE_ bool _is_reflex(const Vector2 *p_contour, int p_prev, int p_vtx, int p_next) {
+
+	return (p_contour[p_vtx] - p_contour[p_prev]).cross(p_contour[p_next] - p_contour[p_vtx]) <= 0.0;
+}
+
+bool Triangulate::snip(const Vector2 *p_contour, int u, int v, int w, const bool *p_reflex, Vector<int> &p_reflex_list, bool p_relaxed) {
+
 	real_t Ax, Ay, Bx, By, Cx, Cy, Px, Py;
-	const Vector2 *contour = &p_contour[0];
 
-	Ax = contour[V[u]].x;
-	Ay = contour[V[u]].y;
+	Ax = p_contour[u].x;
+	Ay = p_contour[u].y;
 
-	Bx = contour[V[v]].x;
-	By = contour[V[v]].y;
+	Bx = p_contour[v].x;
+	By = p_contour[v].y;
 
-	Cx = contour[V[w]].x;
-	Cy = contour[V[w]].y;
+	Cx = p_contour[w].x;
+	Cy = p_contour[w].y;
 
 	// It can happen that the triangulation ends up with three aligned vertices to deal with.
 	// In this scenario, making the check below strict may reject the possibility of
 	// forming a last triangle with these aligned vertices, preventing the triangulatiom
 	// from completing.
 	// To avoid that we allow zero-area triangles if all else failed.
-	float threshold = relaxed ? -CMP_EPSILON : CMP_EPSILON;
+	float threshold = p_relaxed ? -CMP_EPSILON : CMP_EPSILON;
 
 	if (threshold > (((Bx - Ax) * (Cy - Ay)) - ((By - Ay) * (Cx - Ax)))) return false;
 
-	for (p = 0; p < n; p++) {
-		if ((p == u) || (p == v) || (p == w)) continue;
-		Px = contour[V[p]].x;
-		Py = contour[V[p]].y;
-		if (is_inside_triangle(Ax, Ay, Bx, By, Cx, Cy, Px, Py, relaxed)) return false;
+	int *rl = p_reflex_list.ptrw();
+	int rc = p_reflex_list.size();
+	int kept = 0;
+	bool blocked = false;
+
+	for (int i = 0; i < rc; i++) {
+		int p = rl[i];
+		if (!p_reflex[p])
+			continue; // clipped or turned convex, drop from the list
+		rl[kept++] = p;
+		if (blocked || p == u || p == v || p == w)
+			continue;
+		Px = p_contour[p].x;
+		Py = p_contour[p].y;
+		if (is_inside_triangle(Ax, Ay, Bx, By, Cx, Cy, Px, Py, p_relaxed))
+			blocked = true;
 	}
+	p_reflex_list.resize(kept);
 
-	return true;
+	return !blocked;
 }
 
 bool Triangulate::triangulate(const Vector<Vector2> &contour, Vector<int> &result) {
-	/* allocate and initialize list of Vertices in polygon */
 
 	int n = contour.size();
 	if (n < 3) return false;
 
-	Vector<int> V;
-	V.resize(n);
+	const Vector2 *c = &contour[0];
 
-	/* we want a counter-clockwise polygon in V */
+	/* doubly linked list over the contour, oriented counter-clockwise,
+	   so clipping an ear is O(1) instead of compacting an index array */
+
+	Vector<int> next_buf, prev_buf;
+	next_buf.resize(n);
+	prev_buf.resize(n);
+	int *next = next_buf.ptrw();
+	int *prev = prev_buf.ptrw();
+
+	bool ccw = 0.0 < get_area(contour);
+
+	for (int i = 0; i < n; i++) {
+		int ni = (i + 1) % n;
+		if (ccw) {
+			next[i] = ni;
+			prev[ni] = i;
+		} else {
+			next[ni] = i;
+			prev[i] = ni;
+		}
+	}
 
-	if (0.0 < get_area(contour))
-		for (int v = 0; v < n; v++)
-			V.write[v] = v;
-	else
-		for (int v = 0; v < n; v++)
-			V.write[v] = (n - 1) - v;
+	Vector<bool> reflex_buf;
+	reflex_buf.resize(n);
+	bool *reflex = reflex_buf.ptrw();
+	Vector<int> reflex_list;
+
+	for (int i = 0; i < n; i++) {
+		reflex[i] = _is_reflex(c, prev[i], i, next[i]);
+		if (reflex[i])
+			reflex_list.push_back(i);
+	}
 
 	bool relaxed = false;
 
@@ -140,7 +181,9 @@ bool Triangulate::triangulate(const Vector<Vector2> &contour, Vector<int> &resul
 	/*  remove nv-2 Vertices, creating 1 triangle every time */
 	int count = 2 * nv; /* error detection */
 
-	for (int v = nv - 1; nv > 2;) {
+	int v = 0;
+
+	while (nv > 2) {
 		/* if we loop, it is probably a non-simple polygon */
 		if (0 >= (count--)) {
 			if (relaxed) {
@@ -160,35 +203,39 @@ bool Triangulate::triangulate(const Vector<Vector2> &contour, Vector<int> &resul
 		}
 
 		/* three consecutive vertices in current polygon, <u,v,w> */
-		int u = v;
-		if (nv <= u) u = 0; /* previous */
-		v = u + 1;
-		if (nv <= v) v = 0; /* new v    */
-		int w = v + 1;
-		if (nv <= w) w = 0; /* next     */
-
-		if (snip(contour, u, v, w, nv, V, relaxed)) {
-			int a, b, c, s, t;
+		int u = prev[v];
+		int w = next[v];
 
-			/* true names of the vertices */
-			a = V[u];
-			b = V[v];
-			c = V[w];
+		if (snip(c, u, v, w, reflex, reflex_list, relaxed)) {
 
 			/* output Triangle */
-			result.push_back(a);
-			result.push_back(b);
-			result.push_back(c);
+			result.push_back(u);
+			result.push_back(v);
+			result.push_back(w);
 
 			/* remove v from remaining polygon */
-			for (s = v, t = v + 1; t < nv; s++, t++)
-				V.write[s] = V[t];
+			next[u] = w;
+			prev[w] = u;
+			reflex[v] = false;
+
+			/* clipping the ear can only affect the two neighbours */
+			bool r = _is_reflex(c, prev[u], u, next[u]);
+			if (r && !reflex[u])
+				reflex_list.push_back(u);
+			reflex[u] = r;
+
+			r = _is_reflex(c, prev[w], w, next[w]);
+			if (r && !reflex[w])
+				reflex_list.push_back(w);
+			reflex[w] = r;
 
 			nv--;
 
 			/* reset error detection counter */
 			count = 2 * nv;
 		}
+
+		v = w;
 	}
 
 	return true;
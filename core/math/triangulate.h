@@ -55,7 +55,7 @@ public:
 			bool include_edges);
 
 private:
-	static bool snip(const Vector<Vector2> &p_contour, int u, int v, int w, int n, const Vector<int> &V, bool relaxed);
+	static bool snip(const Vector2 *p_contour, int u, int v, int w, const bool *p_reflex, Vector<int> &p_reflex_list, bool p_relaxed);
 };
 
 #endif
@@ -40,13 +40,40 @@ MessageQueue *MessageQueue::get_singleton() {
 	return singleton;
 }
 
-Error MessageQueue::push_call(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
+MessageQueue::Message *MessageQueue::_reserve_space(uint32_t p_room_needed) {
+
+	// Lock-free multi-producer reservation; the caller fills the space and
+	// must raise the message's ready flag (with a barrier) as the last step.
+	while (true) {
+
+		uint32_t pos = buffer_end;
 
-	_THREAD_SAFE_METHOD_
+		if (pos + p_room_needed > buffer_limit) {
+
+			if (pos <= buffer_limit) {
+				// First producer to overflow; leave an end marker so flush()
+				// knows where valid messages stop.
+				if (!atomic_compare_exchange(&buffer_end, pos, pos + p_room_needed))
+					continue; // lost the race, retry
+				Message *end_msg = memnew_placement(&buffer[pos], Message);
+				end_msg->type = TYPE_END;
+				atomic_increment(&end_msg->ready);
+			}
+			return NULL; // buffer is full until the next flush
+		}
 
-	int room_needed = sizeof(Message) + sizeof(Variant) * p_argcount;
+		if (atomic_compare_exchange(&buffer_end, pos, pos + p_room_needed)) {
+			return (Message *)&buffer[pos];
+		}
+	}
+}
+
+Error MessageQueue::push_call(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
 
-	if ((buffer_end + room_needed) >= buffer_size) {
+	uint32_t room_needed = sizeof(Message) + sizeof(Variant) * p_argcount;
+
+	Message *msg = _reserve_space(room_needed);
+	if (!msg) {
 		String type;
 		if (ObjectDB::get_instance(p_id))
 			type = ObjectDB::get_instance(p_id)->get_class();
@@ -55,7 +82,7 @@ Error MessageQueue::push_call(ObjectID p_id, const StringName &p_method, const V
 		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
 	}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
+	memnew_placement(msg, Message);
 	msg->args = p_argcount;
 	msg->instance_id = p_id;
 	msg->target = p_method;
@@ -63,15 +90,15 @@ Error MessageQueue::push_call(ObjectID p_id, const StringName &p_method, const V
 	if (p_show_error)
 		msg->type |= FLAG_SHOW_ERROR;
 
-	buffer_end += sizeof(Message);
-
+	Variant *args = (Variant *)(msg + 1);
 	for (int i = 0; i < p_argcount; i++) {
 
-		Variant *v = memnew_placement(&buffer[buffer_end], Variant);
-		buffer_end += sizeof(Variant);
+		Variant *v = memnew_placement(&args[i], Variant);
 		*v = *p_args[i];
 	}
 
+	atomic_increment(&msg->ready);
+
 	return OK;
 }
 
@@ -92,11 +119,10 @@ Error MessageQueue::push_call(ObjectID p_id, const StringName &p_method, VARIANT
 
 Error MessageQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
 
-	_THREAD_SAFE_METHOD_
+	uint32_t room_needed = sizeof(Message) + sizeof(Variant);
 
-	uint8_t room_needed = sizeof(Message) + sizeof(Variant);
-
-	if ((buffer_end + room_needed) >= buffer_size) {
+	Message *msg = _reserve_space(room_needed);
+	if (!msg) {
 		String type;
 		if (ObjectDB::get_instance(p_id))
 			type = ObjectDB::get_instance(p_id)->get_class();
@@ -105,43 +131,39 @@ Error MessageQueue::push_set(ObjectID p_id, const StringName &p_prop, const Vari
 		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
 	}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
+	memnew_placement(msg, Message);
 	msg->args = 1;
 	msg->instance_id = p_id;
 	msg->target = p_prop;
 	msg->type = TYPE_SET;
 
-	buffer_end += sizeof(Message);
-
-	Variant *v = memnew_placement(&buffer[buffer_end], Variant);
-	buffer_end += sizeof(Variant);
+	Variant *v = memnew_placement((Variant *)(msg + 1), Variant);
 	*v = p_value;
 
+	atomic_increment(&msg->ready);
+
 	return OK;
 }
 
 Error MessageQueue::push_notification(ObjectID p_id, int p_notification) {
 
-	_THREAD_SAFE_METHOD_
-
 	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
 
-	uint8_t room_needed = sizeof(Message);
-
-	if ((buffer_end + room_needed) >= buffer_size) {
+	Message *msg = _reserve_space(sizeof(Message));
+	if (!msg) {
 		print_line("Failed notification: " + itos(p_notification) + " target ID: " + itos(p_id));
 		statistics();
 		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
 	}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
+	memnew_placement(msg, Message);
 
 	msg->type = TYPE_NOTIFICATION;
 	msg->instance_id = p_id;
 	//msg->target;
 	msg->notification = p_notification;
 
-	buffer_end += sizeof(Message);
+	atomic_increment(&msg->ready);
 
 	return OK;
 }
@@ -168,9 +190,13 @@ void MessageQueue::statistics() {
 	int null_count = 0;
 
 	uint32_t read_pos = 0;
-	while (read_pos < buffer_end) {
+	uint32_t end = MIN(buffer_end, buffer_size);
+	while (read_pos < end) {
 		Message *message = (Message *)&buffer[read_pos];
 
+		if (!message->ready || (message->type & FLAG_MASK) == TYPE_END)
+			break;
+
 		Object *target = ObjectDB::get_instance(message->instance_id);
 
 		if (target != NULL) {
@@ -215,7 +241,7 @@ void MessageQueue::statistics() {
 			read_pos += sizeof(Variant) * message->args;
 	}
 
-	print_line("TOTAL BYTES: " + itos(buffer_end));
+	print_line("TOTAL BYTES: " + itos(MIN(buffer_end, buffer_size)));
 	print_line("NULL count: " + itos(null_count));
 
 	for (Map<StringName, int>::Element *E = set_count.front(); E; E = E->next()) {
@@ -256,24 +282,46 @@ void MessageQueue::_call_function(Object *p_target, const StringName &p_func, co
 
 void MessageQueue::flush() {
 
-	if (buffer_end > buffer_max_used) {
-		buffer_max_used = buffer_end;
-	}
+	ERR_FAIL_COND(flushing); //already flushing, you did something odd
+	flushing = true;
 
 	uint32_t read_pos = 0;
+	bool overflowed = false;
 
-	//using reverse locking strategy
-	_THREAD_SAFE_LOCK_
-
-	ERR_FAIL_COND(flushing); //already flushing, you did something odd
-	flushing = true;
+	while (true) {
 
-	while (read_pos < buffer_end) {
+		uint32_t end = buffer_end;
+		uint32_t used = MIN(end, buffer_size);
+		if (used > buffer_max_used) {
+			buffer_max_used = used;
+		}
 
-		//lock on each iteration, so a call can re-add itself to the message queue
+		if (read_pos >= end || overflowed) {
+			// Fully drained (or only discarded overflow reservations remain);
+			// clear the consumed region so the ready flags read as zero when
+			// the space is reused, then try to hand the buffer back.
+			memset(&buffer[0], 0, MIN(read_pos + (overflowed ? (uint32_t)sizeof(Message) : 0), buffer_size));
+			if (atomic_compare_exchange(&buffer_end, end, (uint32_t)0)) {
+				break;
+			}
+			// A producer appended while we were resetting; keep draining.
+			continue;
+		}
 
 		Message *message = (Message *)&buffer[read_pos];
 
+		// The producer may still be committing this message; its ready flag
+		// is raised last, after all fields and arguments are in place.
+		while (!atomic_add(&message->ready, (uint32_t)0)) {
+		}
+
+		if ((message->type & FLAG_MASK) == TYPE_END) {
+			// Push overflowed past this point; everything after was dropped.
+			message->~Message();
+			overflowed = true;
+			continue;
+		}
+
 		uint32_t advance = sizeof(Message);
 		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION)
 			advance += sizeof(Variant) * message->args;
@@ -281,8 +329,6 @@ void MessageQueue::flush() {
 		//pre-advance so this function is reentrant
 		read_pos += advance;
 
-		_THREAD_SAFE_UNLOCK_
-
 		Object *target = ObjectDB::get_instance(message->instance_id);
 
 		if (target != NULL) {
@@ -321,13 +367,9 @@ void MessageQueue::flush() {
 		}
 
 		message->~Message();
-
-		_THREAD_SAFE_LOCK_
 	}
 
-	buffer_end = 0; // reset buffer
 	flushing = false;
-	_THREAD_SAFE_UNLOCK_
 }
 
 bool MessageQueue::is_flushing() const {
@@ -346,16 +388,29 @@ MessageQueue::MessageQueue() {
 	buffer_size = GLOBAL_DEF_RST("memory/limits/message_queue/max_size_kb", DEFAULT_QUEUE_SIZE_KB);
 	ProjectSettings::get_singleton()->set_custom_property_info("memory/limits/message_queue/max_size_kb", PropertyInfo(Variant::INT, "memory/limits/message_queue/max_size_kb", PROPERTY_HINT_RANGE, "0,2048,1,or_greater"));
 	buffer_size *= 1024;
+	buffer_size = MAX(buffer_size, (uint32_t)sizeof(Message)); // an end marker must always fit, even with max_size_kb set to 0
+	buffer_limit = buffer_size - sizeof(Message);
 	buffer = memnew_arr(uint8_t, buffer_size);
+	memset(buffer, 0, buffer_size); // ready flags must read as zero in unused space
 }
 
 MessageQueue::~MessageQueue() {
 
 	uint32_t read_pos = 0;
+	uint32_t end = MIN(buffer_end, buffer_size);
 
-	while (read_pos < buffer_end) {
+	while (read_pos < end) {
 
 		Message *message = (Message *)&buffer[read_pos];
+
+		if (!message->ready)
+			break;
+
+		if ((message->type & FLAG_MASK) == TYPE_END) {
+			message->~Message();
+			break;
+		}
+
 		Variant *args = (Variant *)(message + 1);
 		int argc = message->args;
 		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
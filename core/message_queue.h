@@ -32,12 +32,10 @@
 #define MESSAGE_QUEUE_H
 
 #include "core/object.h"
-#include "core/os/thread_safe.h"
+#include "core/safe_refcount.h"
 
 class MessageQueue {
 
-	_THREAD_SAFE_CLASS_
-
 	enum {
 
 		DEFAULT_QUEUE_SIZE_KB = 1024
@@ -47,6 +45,7 @@ class MessageQueue {
 		TYPE_CALL,
 		TYPE_NOTIFICATION,
 		TYPE_SET,
+		TYPE_END, // overflow marker, scan must stop here
 		FLAG_SHOW_ERROR = 1 << 14,
 		FLAG_MASK = FLAG_SHOW_ERROR - 1
 
@@ -61,13 +60,21 @@ class MessageQueue {
 			int16_t notification;
 			int16_t args;
 		};
+		volatile uint32_t ready; // set last by the producer, so flush() never reads a half-written message
 	};
 
+	// Multi-producer single-consumer: producers reserve space with an atomic
+	// compare-exchange on buffer_end and commit by raising the per-message
+	// ready flag; flush() is the only reader. No mutex is involved.
+
 	uint8_t *buffer;
-	uint32_t buffer_end;
+	volatile uint32_t buffer_end;
+	uint32_t buffer_limit; // buffer_size minus room for an end marker
 	uint32_t buffer_max_used;
 	uint32_t buffer_size;
 
+	Message *_reserve_space(uint32_t p_room_needed);
+
 	void _call_function(Object *p_target, const StringName &p_func, const Variant *p_args, int p_argcount, bool p_show_error);
 
 	static MessageQueue *singleton;
@@ -629,7 +629,7 @@ void Object::get_property_list(List<PropertyInfo> *p_list, bool p_reversed) cons
 
 	_get_property_listv(p_list, p_reversed);
 
-	if (!is_class("Script")) { // can still be set, but this is for userfriendlyness
+	if (!Object::cast_to<Script>(this)) { // can still be set, but this is for userfriendlyness
 #ifdef TOOLS_ENABLED
 		p_list->push_back(PropertyInfo(Variant::NIL, "Script", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_GROUP));
 #endif
@@ -1174,18 +1174,25 @@ Error Object::emit_signal(const StringName &p_name, const Variant **p_args, int
 	VMap<Signal::Target, Signal::Slot> slot_map = s->slot_map;
 
 	int ssize = slot_map.size();
+	//iterate over the flat pair array directly, the local copy can't be mutated
+	//under us so per-index accessor checks are pointless
+	const VMap<Signal::Target, Signal::Slot>::Pair *slots = slot_map.get_array();
 
 	OBJ_DEBUG_LOCK
 
+	enum {
+		BIND_MEM_INLINE_MAX = 16
+	};
+	const Variant *bind_mem_inline[BIND_MEM_INLINE_MAX];
 	Vector<const Variant *> bind_mem;
 
 	Error err = OK;
 
 	for (int i = 0; i < ssize; i++) {
 
-		const Connection &c = slot_map.getv(i).conn;
+		const Connection &c = slots[i].value.conn;
 
-		Object *target = ObjectDB::get_instance(slot_map.getk(i)._id);
+		Object *target = ObjectDB::get_instance(slots[i].key._id);
 		if (!target) {
 			// Target might have been deleted during signal callback, this is expected and OK.
 			continue;
@@ -1195,18 +1202,24 @@ Error Object::emit_signal(const StringName &p_name, const Variant **p_args, int
 		int argc = p_argcount;
 
 		if (c.binds.size()) {
-			//handle binds
-			bind_mem.resize(p_argcount + c.binds.size());
+			//handle binds, on the stack when they fit to not allocate per emission
+			const Variant **bind_args;
+			if (p_argcount + c.binds.size() <= BIND_MEM_INLINE_MAX) {
+				bind_args = bind_mem_inline;
+			} else {
+				bind_mem.resize(p_argcount + c.binds.size());
+				bind_args = bind_mem.ptrw();
+			}
 
 			for (int j = 0; j < p_argcount; j++) {
-				bind_mem.write[j] = p_args[j];
+				bind_args[j] = p_args[j];
 			}
 			for (int j = 0; j < c.binds.size(); j++) {
-				bind_mem.write[p_argcount + j] = &c.binds[j];
+				bind_args[p_argcount + j] = &c.binds[j];
 			}
 
-			args = (const Variant **)bind_mem.ptr();
-			argc = bind_mem.size();
+			args = bind_args;
+			argc = p_argcount + c.binds.size();
 		}
 
 		if (c.flags & CONNECT_DEFERRED) {
@@ -1994,17 +2007,49 @@ void postinitialize_handler(Object *p_object) {
 	p_object->_postinitialize();
 }
 
-HashMap<ObjectID, Object *> ObjectDB::instances;
-ObjectID ObjectDB::instance_counter = 1;
-HashMap<Object *, ObjectID, ObjectDB::ObjectPtrHash> ObjectDB::instance_checks;
+ObjectDB::Slot *volatile ObjectDB::slot_pages[ObjectDB::SLOT_MAX_PAGES];
+uint32_t ObjectDB::slot_count = 0;
+uint32_t ObjectDB::first_free_slot = ObjectDB::SLOT_FREE_LIST_END;
+int ObjectDB::object_count = 0;
+OAHashMap<Object *, ObjectID, ObjectDB::ObjectPtrHash> ObjectDB::instance_checks;
 ObjectID ObjectDB::add_instance(Object *p_object) {
 
 	ERR_FAIL_COND_V(p_object->get_instance_id() != 0, 0);
 
 	rw_lock->write_lock();
-	ObjectID instance_id = ++instance_counter;
-	instances[instance_id] = p_object;
-	instance_checks[p_object] = instance_id;
+
+	uint32_t idx;
+	if (first_free_slot != SLOT_FREE_LIST_END) {
+		idx = first_free_slot;
+		first_free_slot = slot_pages[idx >> SLOT_PAGE_BITS][idx & SLOT_PAGE_MASK].next_free;
+	} else {
+		idx = slot_count;
+		uint32_t page = idx >> SLOT_PAGE_BITS;
+		if (page >= SLOT_MAX_PAGES) {
+			rw_lock->write_unlock();
+			ERR_FAIL_V_MSG(0, "Out of ObjectDB slots.");
+		}
+		if (!slot_pages[page]) {
+			Slot *new_page = (Slot *)memalloc(sizeof(Slot) * SLOT_PAGE_SIZE);
+			zeromem(new_page, sizeof(Slot) * SLOT_PAGE_SIZE);
+			slot_pages[page] = new_page;
+		}
+		slot_count++;
+	}
+
+	Slot &slot = slot_pages[idx >> SLOT_PAGE_BITS][idx & SLOT_PAGE_MASK];
+	uint32_t validator = slot.validator + 1;
+	if (validator == 0)
+		validator = 1; // 0 is reserved for "never assigned".
+
+	// Publish the pointer before the validator, so a lock-free reader that
+	// sees the new validator always sees the right object.
+	slot.object = p_object;
+	slot.validator = validator;
+
+	ObjectID instance_id = ((uint64_t)validator << 32) | idx;
+	instance_checks.set(p_object, instance_id);
+	object_count++;
 
 	rw_lock->write_unlock();
 
@@ -2013,32 +2058,44 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 
 void ObjectDB::remove_instance(Object *p_object) {
 
+	ObjectID instance_id = p_object->get_instance_id();
+	uint32_t idx = (uint32_t)(instance_id & 0xFFFFFFFF);
+	uint32_t validator = (uint32_t)(instance_id >> 32);
+
 	rw_lock->write_lock();
 
-	instances.erase(p_object->get_instance_id());
-	instance_checks.erase(p_object);
+	if (idx >= slot_count || !slot_pages[idx >> SLOT_PAGE_BITS]) {
+		rw_lock->write_unlock();
+		ERR_FAIL_MSG("Attempted to remove an object not present in the ObjectDB.");
+	}
+	Slot &slot = slot_pages[idx >> SLOT_PAGE_BITS][idx & SLOT_PAGE_MASK];
+	if (slot.validator != validator || slot.object != p_object) {
+		rw_lock->write_unlock();
+		ERR_FAIL_MSG("Attempted to remove an object not present in the ObjectDB.");
+	}
 
-	rw_lock->write_unlock();
-}
-Object *ObjectDB::get_instance(ObjectID p_instance_id) {
+	// Invalidate the validator first; readers re-check it after loading the
+	// pointer, so they can never return the object past this point.
+	slot.validator = validator + 1;
+	slot.object = NULL;
+	slot.next_free = first_free_slot;
+	first_free_slot = idx;
 
-	rw_lock->read_lock();
-	Object **obj = instances.getptr(p_instance_id);
-	rw_lock->read_unlock();
+	instance_checks.remove(p_object);
+	object_count--;
 
-	if (!obj)
-		return NULL;
-	return *obj;
+	rw_lock->write_unlock();
 }
 
 void ObjectDB::debug_objects(DebugFunc p_func) {
 
 	rw_lock->read_lock();
 
-	const ObjectID *K = NULL;
-	while ((K = instances.next(K))) {
+	for (uint32_t i = 0; i < slot_count; i++) {
 
-		p_func(instances[*K]);
+		const Slot &slot = slot_pages[i >> SLOT_PAGE_BITS][i & SLOT_PAGE_MASK];
+		if (slot.object)
+			p_func(slot.object);
 	}
 
 	rw_lock->read_unlock();
@@ -2049,11 +2106,7 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 
 int ObjectDB::get_object_count() {
 
-	rw_lock->read_lock();
-	int count = instances.size();
-	rw_lock->read_unlock();
-
-	return count;
+	return object_count;
 }
 
 RWLock *ObjectDB::rw_lock = NULL;
@@ -2066,23 +2119,34 @@ void ObjectDB::setup() {
 void ObjectDB::cleanup() {
 
 	rw_lock->write_lock();
-	if (instances.size()) {
+	if (object_count > 0) {
 
 		WARN_PRINT("ObjectDB Instances still exist!");
 		if (OS::get_singleton()->is_stdout_verbose()) {
-			const ObjectID *K = NULL;
-			while ((K = instances.next(K))) {
+			for (uint32_t i = 0; i < slot_count; i++) {
 
+				const Slot &slot = slot_pages[i >> SLOT_PAGE_BITS][i & SLOT_PAGE_MASK];
+				Object *obj = slot.object;
+				if (!obj)
+					continue;
 				String node_name;
-				if (instances[*K]->is_class("Node"))
-					node_name = " - Node name: " + String(instances[*K]->call("get_name"));
-				if (instances[*K]->is_class("Resource"))
-					node_name = " - Resource name: " + String(instances[*K]->call("get_name")) + " Path: " + String(instances[*K]->call("get_path"));
-				print_line("Leaked instance: " + String(instances[*K]->get_class()) + ":" + itos(*K) + node_name);
+				if (obj->is_class("Node"))
+					node_name = " - Node name: " + String(obj->call("get_name"));
+				if (obj->is_class("Resource"))
+					node_name = " - Resource name: " + String(obj->call("get_name")) + " Path: " + String(obj->call("get_path"));
+				print_line("Leaked instance: " + String(obj->get_class()) + ":" + itos(obj->get_instance_id()) + node_name);
 			}
 		}
 	}
-	instances.clear();
+	for (int i = 0; i < SLOT_MAX_PAGES; i++) {
+		if (slot_pages[i]) {
+			memfree(slot_pages[i]);
+			slot_pages[i] = NULL;
+		}
+	}
+	slot_count = 0;
+	first_free_slot = SLOT_FREE_LIST_END;
+	object_count = 0;
 	instance_checks.clear();
 	rw_lock->write_unlock();
 	memdelete(rw_lock);
@@ -34,6 +34,7 @@
 #include "core/hash_map.h"
 #include "core/list.h"
 #include "core/map.h"
+#include "core/oa_hash_map.h"
 #include "core/os/rw_lock.h"
 #include "core/set.h"
 #include "core/variant.h"
@@ -772,10 +773,33 @@ class ObjectDB {
 		}
 	};
 
-	static HashMap<ObjectID, Object *> instances;
-	static HashMap<Object *, ObjectID, ObjectPtrHash> instance_checks;
+	// Instance ids encode a slot index in the low 32 bits and a per-slot
+	// validation counter in the high 32 bits, so get_instance() is an array
+	// load plus a validator compare and takes no lock at all. Slots live in
+	// fixed-size pages that are never moved or freed while the database is
+	// alive, which keeps concurrent lock-free readers safe while the writer
+	// side (add/remove) runs under the write lock.
+	enum {
+		SLOT_PAGE_BITS = 14,
+		SLOT_PAGE_SIZE = 1 << SLOT_PAGE_BITS, // 16384 slots per page.
+		SLOT_PAGE_MASK = SLOT_PAGE_SIZE - 1,
+		SLOT_MAX_PAGES = 4096, // 67M simultaneously live objects.
+		SLOT_FREE_LIST_END = 0xFFFFFFFF
+	};
+
+	struct Slot {
+		Object *volatile object;
+		volatile uint32_t validator;
+		uint32_t next_free;
+	};
+
+	static Slot *volatile slot_pages[SLOT_MAX_PAGES];
+	static uint32_t slot_count;
+	static uint32_t first_free_slot;
+	static int object_count;
+
+	static OAHashMap<Object *, ObjectID, ObjectPtrHash> instance_checks;
 
-	static ObjectID instance_counter;
 	friend class Object;
 	friend void unregister_core_types();
 
@@ -789,7 +813,28 @@ class ObjectDB {
 public:
 	typedef void (*DebugFunc)(Object *p_obj);
 
-	static Object *get_instance(ObjectID p_instance_id);
+	_FORCE_INLINE_ static Object *get_instance(ObjectID p_instance_id) {
+
+		uint32_t idx = (uint32_t)(p_instance_id & 0xFFFFFFFF);
+		uint32_t validator = (uint32_t)(p_instance_id >> 32);
+		if (validator == 0 || idx >= (uint32_t)SLOT_MAX_PAGES * SLOT_PAGE_SIZE)
+			return NULL;
+
+		Slot *page = slot_pages[idx >> SLOT_PAGE_BITS];
+		if (!page)
+			return NULL;
+
+		const Slot &slot = page[idx & SLOT_PAGE_MASK];
+		if (slot.validator != validator)
+			return NULL;
+		Object *obj = slot.object;
+		// Removal bumps the validator before clearing the pointer, so
+		// re-checking it here catches a concurrent removal that could have
+		// made the loaded pointer stale.
+		if (slot.validator != validator)
+			return NULL;
+		return obj;
+	}
 	static void debug_objects(DebugFunc p_func);
 	static int get_object_count();
 
@@ -189,8 +189,18 @@ public:
 			CRASH_COND(!list_element);
 			return list_element->get().second;
 		};
+
+		//opaque handle for cursor-style iteration (see Dictionary); remains
+		//valid until the underlying element is erased
+		_FORCE_INLINE_ const void *cursor() const {
+			return list_element;
+		}
 	};
 
+	ConstElement element_for_cursor(const void *p_cursor) const {
+		return ConstElement((const typename InternalList::Element *)p_cursor);
+	}
+
 	ConstElement find(const K &p_key) const {
 		typename InternalList::Element *const *list_element = map.getptr(p_key);
 		if (list_element) {
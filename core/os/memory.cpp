@@ -67,6 +67,14 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 #ifdef DEBUG_ENABLED
 uint64_t Memory::mem_usage = 0;
 uint64_t Memory::max_usage = 0;
+uint64_t Memory::domain_usage[Memory::DOMAIN_MAX] = { 0 };
+uint64_t Memory::domain_max_usage[Memory::DOMAIN_MAX] = { 0 };
+
+#ifdef NO_THREADS
+static Memory::AllocDomain current_alloc_domain = Memory::DOMAIN_CORE;
+#else
+static thread_local Memory::AllocDomain current_alloc_domain = Memory::DOMAIN_CORE;
+#endif
 #endif
 
 uint64_t Memory::alloc_count = 0;
@@ -92,8 +100,16 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 		uint8_t *s8 = (uint8_t *)mem;
 
 #ifdef DEBUG_ENABLED
+		// the second half of the pad remembers the allocation's domain, so
+		// free/realloc can credit the right counter even when they run under
+		// a different scope than the allocation did
+		s[1] = current_alloc_domain;
+
 		atomic_add(&mem_usage, p_bytes);
 		atomic_exchange_if_greater(&max_usage, mem_usage);
+
+		atomic_add(&domain_usage[current_alloc_domain], (uint64_t)p_bytes);
+		atomic_exchange_if_greater(&domain_max_usage[current_alloc_domain], domain_usage[current_alloc_domain]);
 #endif
 		return s8 + PAD_ALIGN;
 	} else {
@@ -120,11 +136,16 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 		uint64_t *s = (uint64_t *)mem;
 
 #ifdef DEBUG_ENABLED
+		uint64_t domain = s[1] < (uint64_t)DOMAIN_MAX ? s[1] : (uint64_t)DOMAIN_CORE;
+
 		if (p_bytes > *s) {
 			atomic_add(&mem_usage, p_bytes - *s);
 			atomic_exchange_if_greater(&max_usage, mem_usage);
+			atomic_add(&domain_usage[domain], p_bytes - *s);
+			atomic_exchange_if_greater(&domain_max_usage[domain], domain_usage[domain]);
 		} else {
 			atomic_sub(&mem_usage, *s - p_bytes);
+			atomic_sub(&domain_usage[domain], *s - p_bytes);
 		}
 #endif
 
@@ -173,6 +194,9 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 #ifdef DEBUG_ENABLED
 		uint64_t *s = (uint64_t *)mem;
 		atomic_sub(&mem_usage, *s);
+
+		uint64_t domain = s[1] < (uint64_t)DOMAIN_MAX ? s[1] : (uint64_t)DOMAIN_CORE;
+		atomic_sub(&domain_usage[domain], *s);
 #endif
 
 		free(mem);
@@ -203,6 +227,180 @@ uint64_t Memory::get_mem_max_usage() {
 #endif
 }
 
+void Memory::set_current_domain(AllocDomain p_domain) {
+#ifdef DEBUG_ENABLED
+	current_alloc_domain = p_domain;
+#endif
+}
+
+Memory::AllocDomain Memory::get_current_domain() {
+#ifdef DEBUG_ENABLED
+	return current_alloc_domain;
+#else
+	return DOMAIN_CORE;
+#endif
+}
+
+const char *Memory::get_domain_name(AllocDomain p_domain) {
+
+	static const char *names[DOMAIN_MAX] = {
+		"core",
+		"rendering",
+		"physics",
+		"audio",
+		"scene",
+		"script",
+	};
+
+	ERR_FAIL_INDEX_V(p_domain, DOMAIN_MAX, "");
+	return names[p_domain];
+}
+
+uint64_t Memory::get_domain_usage(AllocDomain p_domain) {
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_INDEX_V(p_domain, DOMAIN_MAX, 0);
+	return domain_usage[p_domain];
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_domain_max_usage(AllocDomain p_domain) {
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_INDEX_V(p_domain, DOMAIN_MAX, 0);
+	return domain_max_usage[p_domain];
+#else
+	return 0;
+#endif
+}
+
+LinearArena::Page *LinearArena::_alloc_page(size_t p_min_size) {
+
+	size_t size = MAX(p_min_size + sizeof(Page), page_size);
+	Page *page = (Page *)Memory::alloc_static(size, false);
+	page->next = NULL;
+	page->size = size - sizeof(Page);
+	page->used = 0;
+	return page;
+}
+
+void *LinearArena::alloc(size_t p_bytes) {
+
+	// keep allocations aligned like the default allocator does
+	p_bytes = (p_bytes + PAD_ALIGN - 1) & ~((size_t)PAD_ALIGN - 1);
+
+	if (!pages || pages->used + p_bytes > pages->size) {
+		Page *page = _alloc_page(p_bytes);
+		page->next = pages;
+		pages = page;
+	}
+
+	void *ptr = (uint8_t *)(pages + 1) + pages->used;
+	pages->used += p_bytes;
+	return ptr;
+}
+
+void LinearArena::reset() {
+
+	if (!pages)
+		return;
+
+	// keep only the most recent (largest hot) page around for reuse
+	while (pages->next) {
+		Page *next = pages->next;
+		Memory::free_static(pages, false);
+		pages = next;
+	}
+	pages->used = 0;
+}
+
+void LinearArena::clear() {
+
+	while (pages) {
+		Page *next = pages->next;
+		Memory::free_static(pages, false);
+		pages = next;
+	}
+}
+
+LinearArena::LinearArena(size_t p_page_size) {
+
+	pages = NULL;
+	page_size = p_page_size + sizeof(Page);
+}
+
+LinearArena::~LinearArena() {
+
+	clear();
+}
+
+// Per-thread frame arenas. The registry is a simple lock-protected list that
+// is only touched the first time a thread allocates, and by reset_frame().
+
+struct FrameArenaRegistryEntry {
+	LinearArena arena;
+	FrameArenaRegistryEntry *next;
+};
+
+static FrameArenaRegistryEntry *frame_arena_registry = NULL;
+static volatile uint32_t frame_arena_registry_lock = 0;
+
+#ifdef NO_THREADS
+static FrameArenaRegistryEntry *frame_arena_tls = NULL;
+#else
+static thread_local FrameArenaRegistryEntry *frame_arena_tls = NULL;
+#endif
+
+LinearArena *FrameAllocator::_register_thread_arena() {
+
+	FrameArenaRegistryEntry *entry = memnew(FrameArenaRegistryEntry);
+
+	// spinlock; this cannot rely on Mutex, which may not exist this early
+	while (!atomic_compare_exchange(&frame_arena_registry_lock, (uint32_t)0, (uint32_t)1)) {
+	}
+	entry->next = frame_arena_registry;
+	frame_arena_registry = entry;
+	atomic_decrement(&frame_arena_registry_lock);
+
+	frame_arena_tls = entry;
+	return &entry->arena;
+}
+
+LinearArena &FrameAllocator::get_thread_arena() {
+
+	if (frame_arena_tls) {
+		return frame_arena_tls->arena;
+	}
+	return *_register_thread_arena();
+}
+
+void *FrameAllocator::alloc(size_t p_memory) {
+
+	return get_thread_arena().alloc(p_memory);
+}
+
+void FrameAllocator::reset_frame() {
+
+	// Called from the main loop at a frame boundary, when no worker is
+	// supposed to hold frame-allocated data anymore.
+	while (!atomic_compare_exchange(&frame_arena_registry_lock, (uint32_t)0, (uint32_t)1)) {
+	}
+	for (FrameArenaRegistryEntry *entry = frame_arena_registry; entry; entry = entry->next) {
+		entry->arena.reset();
+	}
+	atomic_decrement(&frame_arena_registry_lock);
+}
+
+void FrameAllocator::cleanup() {
+
+	while (frame_arena_registry) {
+		FrameArenaRegistryEntry *next = frame_arena_registry->next;
+		memdelete(frame_arena_registry);
+		frame_arena_registry = next;
+	}
+	frame_arena_tls = NULL;
+}
+
 _GlobalNil::_GlobalNil() {
 
 	color = 1;
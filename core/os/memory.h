@@ -43,9 +43,32 @@
 class Memory {
 
 	Memory();
+
+public:
+	/**
+	 * Allocation domains. Every static allocation is attributed to the domain
+	 * active on the calling thread at the time of the allocation (see
+	 * MEM_DOMAIN_SCOPE); the domain is remembered in the allocation prepad so
+	 * frees and reallocs credit the right counter no matter which scope they
+	 * happen under. Tracking piggybacks on the DEBUG_ENABLED prepad, like
+	 * mem_usage does.
+	 */
+	enum AllocDomain {
+		DOMAIN_CORE, // default; anything not claimed by a scope below
+		DOMAIN_RENDERING,
+		DOMAIN_PHYSICS,
+		DOMAIN_AUDIO,
+		DOMAIN_SCENE,
+		DOMAIN_SCRIPT,
+		DOMAIN_MAX
+	};
+
+private:
 #ifdef DEBUG_ENABLED
 	static uint64_t mem_usage;
 	static uint64_t max_usage;
+	static uint64_t domain_usage[DOMAIN_MAX];
+	static uint64_t domain_max_usage[DOMAIN_MAX];
 #endif
 
 	static uint64_t alloc_count;
@@ -58,14 +81,93 @@ public:
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+
+	static void set_current_domain(AllocDomain p_domain);
+	static AllocDomain get_current_domain();
+	static const char *get_domain_name(AllocDomain p_domain);
+	static uint64_t get_domain_usage(AllocDomain p_domain);
+	static uint64_t get_domain_max_usage(AllocDomain p_domain);
 };
 
+/**
+ * Tags all static allocations made by the calling thread for the lifetime of
+ * the scope. Nests; the previous domain is restored on exit.
+ */
+class MemoryDomainScope {
+
+	Memory::AllocDomain prev_domain;
+
+public:
+	_FORCE_INLINE_ MemoryDomainScope(Memory::AllocDomain p_domain) {
+		prev_domain = Memory::get_current_domain();
+		Memory::set_current_domain(p_domain);
+	}
+	_FORCE_INLINE_ ~MemoryDomainScope() {
+		Memory::set_current_domain(prev_domain);
+	}
+};
+
+#ifdef DEBUG_ENABLED
+#define MEM_DOMAIN_SCOPE(m_domain) MemoryDomainScope __mem_domain_scope(Memory::m_domain)
+#else
+#define MEM_DOMAIN_SCOPE(m_domain)
+#endif
+
 class DefaultAllocator {
 public:
 	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_static(p_memory, false); }
 	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_static(p_ptr, false); }
 };
 
+/**
+ * Linear (bump-pointer) arena. Allocations just advance a cursor within a
+ * page and are never freed individually; reset() throws everything away at
+ * once. Meant for short-lived allocations in hot paths that would otherwise
+ * churn the system allocator.
+ */
+class LinearArena {
+
+	struct Page {
+		Page *next;
+		size_t size;
+		size_t used;
+		// allocations follow the header
+	};
+
+	Page *pages;
+	size_t page_size;
+
+	Page *_alloc_page(size_t p_min_size);
+
+public:
+	void *alloc(size_t p_bytes);
+	void reset(); ///< rewind; keeps the first page, frees the rest
+	void clear(); ///< free all pages
+
+	LinearArena(size_t p_page_size = 256 * 1024);
+	~LinearArena();
+};
+
+/**
+ * Per-thread frame allocator. alloc() bumps the calling thread's arena, so
+ * it needs no locking; free() is a no-op, which makes this usable as the
+ * allocator parameter of List or with memnew_allocator for data that does
+ * not outlive the frame. All arenas are rewound once per frame by the main
+ * loop through reset_frame().
+ */
+class FrameAllocator {
+
+	static LinearArena *_register_thread_arena();
+
+public:
+	static void *alloc(size_t p_memory);
+	_FORCE_INLINE_ static void free(void *p_ptr) {}
+
+	static LinearArena &get_thread_arena();
+	static void reset_frame();
+	static void cleanup();
+};
+
 void *operator new(size_t p_size, const char *p_description); ///< operator new that takes a description and uses MemoryStaticPool
 void *operator new(size_t p_size, void *(*p_allocfunc)(size_t p_size)); ///< operator new that takes a description and uses MemoryStaticPool
 
@@ -426,6 +426,16 @@ uint64_t OS::get_static_memory_peak_usage() const {
 	return Memory::get_mem_max_usage();
 }
 
+uint64_t OS::get_static_memory_usage_by_domain(Memory::AllocDomain p_domain) const {
+
+	return Memory::get_domain_usage(p_domain);
+}
+
+uint64_t OS::get_static_memory_peak_usage_by_domain(Memory::AllocDomain p_domain) const {
+
+	return Memory::get_domain_max_usage(p_domain);
+}
+
 Error OS::set_cwd(const String &p_cwd) {
 
 	return ERR_CANT_OPEN;
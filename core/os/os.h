@@ -401,6 +401,9 @@ public:
 	virtual uint64_t get_dynamic_memory_usage() const;
 	virtual uint64_t get_free_static_memory() const;
 
+	uint64_t get_static_memory_usage_by_domain(Memory::AllocDomain p_domain) const;
+	uint64_t get_static_memory_peak_usage_by_domain(Memory::AllocDomain p_domain) const;
+
 	RenderThreadMode get_render_thread_mode() const { return _render_thread_mode; }
 
 	virtual String get_locale() const;
@@ -431,6 +434,10 @@ public:
 
 	virtual Error move_to_trash(const String &p_path) { return FAILED; }
 
+	// Read-only whole-file memory mapping, NULL when the platform does not support it.
+	virtual const uint8_t *map_file(const String &p_path, uint64_t &r_size) { return NULL; }
+	virtual void unmap_file(const uint8_t *p_base, uint64_t p_size) {}
+
 	virtual void set_no_window_mode(bool p_enable);
 	virtual bool is_no_window_mode_enabled() const;
 
@@ -35,6 +35,7 @@
 #include "core/os/os.h"
 #include "core/os/thread.h"
 #include "core/os/thread_safe.h"
+#include "core/os/worker_thread_pool.h"
 #include "core/safe_refcount.h"
 
 template <class C, class U>
@@ -53,15 +54,10 @@ struct ThreadArrayProcessData {
 #ifndef NO_THREADS
 
 template <class T>
-void process_array_thread(void *ud) {
+void process_array_group_task(void *ud, uint32_t p_index) {
 
 	T &data = *(T *)ud;
-	while (true) {
-		uint32_t index = atomic_increment(&data.index);
-		if (index >= data.elements)
-			break;
-		data.process(index);
-	}
+	data.process(p_index);
 }
 
 template <class C, class M, class U>
@@ -73,20 +69,9 @@ void thread_process_array(uint32_t p_elements, C *p_instance, M p_method, U p_us
 	data.userdata = p_userdata;
 	data.index = 0;
 	data.elements = p_elements;
-	data.process(data.index); //process first, let threads increment for next
-
-	Vector<Thread *> threads;
-
-	threads.resize(OS::get_singleton()->get_processor_count());
 
-	for (int i = 0; i < threads.size(); i++) {
-		threads.write[i] = Thread::create(process_array_thread<ThreadArrayProcessData<C, U> >, &data);
-	}
-
-	for (int i = 0; i < threads.size(); i++) {
-		Thread::wait_to_finish(threads[i]);
-		memdelete(threads[i]);
-	}
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_group_task(&process_array_group_task<ThreadArrayProcessData<C, U> >, &data, p_elements);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
 }
 
 #else
@@ -0,0 +1,308 @@
+/*************************************************************************/
+/*  worker_thread_pool.cpp                                               */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "worker_thread_pool.h"
+
+#include "core/os/os.h"
+
+WorkerThreadPool *WorkerThreadPool::singleton = NULL;
+
+void WorkerThreadPool::_thread_function(void *p_user) {
+
+	ThreadData *td = (ThreadData *)p_user;
+	WorkerThreadPool *pool = td->pool;
+
+	while (true) {
+
+		pool->task_available_semaphore->wait();
+		if (pool->exit_threads)
+			break;
+
+		Task *task = pool->_take_task(td->index);
+		if (task) {
+			pool->_process_task(task);
+		}
+	}
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::_allocate_task(TaskFunc p_func, void *p_userdata) {
+
+	Task *task = memnew(Task);
+	task->callback = p_func;
+	task->userdata = p_userdata;
+
+	task_mutex->lock();
+	task->id = ++last_task_id;
+	tasks[task->id] = task;
+	task_mutex->unlock();
+
+	return task;
+}
+
+void WorkerThreadPool::_post_task(Task *p_task) {
+
+	uint32_t queue = atomic_increment(&next_queue) % (uint32_t)threads.size();
+	ThreadData *td = threads[queue];
+
+	td->deque_mutex->lock();
+	td->deque.push_back(p_task);
+	td->deque_mutex->unlock();
+
+	task_available_semaphore->post();
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::_take_task(uint32_t p_thread_index) {
+
+	// Own deque first (LIFO for cache warmth), then steal FIFO from the others.
+	for (int i = 0; i < threads.size(); i++) {
+
+		ThreadData *td = threads[(p_thread_index + i) % threads.size()];
+		Task *task = NULL;
+
+		td->deque_mutex->lock();
+		if (td->deque.size()) {
+			if (i == 0) {
+				task = td->deque[td->deque.size() - 1];
+				td->deque.resize(td->deque.size() - 1);
+			} else {
+				task = td->deque[0];
+				td->deque.remove(0);
+			}
+		}
+		td->deque_mutex->unlock();
+
+		if (task)
+			return task;
+	}
+
+	return NULL;
+}
+
+void WorkerThreadPool::_process_group_chunk(Group *p_group) {
+
+	while (true) {
+		uint32_t index = atomic_increment(&p_group->index) - 1;
+		if (index >= p_group->elements)
+			break;
+		p_group->callback(p_group->userdata, index);
+	}
+}
+
+void WorkerThreadPool::_process_task(Task *p_task) {
+
+	if (p_task->group) {
+
+		Group *group = p_task->group;
+		_process_group_chunk(group);
+
+		task_mutex->lock();
+		tasks.erase(p_task->id);
+		task_mutex->unlock();
+		memdelete(p_task);
+
+		if (atomic_decrement(&group->tasks_pending) == 0) {
+			group->done_semaphore->post();
+		}
+
+	} else {
+
+		p_task->callback(p_task->userdata);
+
+		task_mutex->lock();
+		p_task->completed = 1;
+		if (p_task->done_semaphore) {
+			p_task->done_semaphore->post();
+		}
+		task_mutex->unlock();
+	}
+}
+
+WorkerThreadPool::TaskID WorkerThreadPool::add_task(TaskFunc p_func, void *p_userdata) {
+
+	ERR_FAIL_COND_V(!p_func, 0);
+
+	Task *task = _allocate_task(p_func, p_userdata);
+
+	if (threads.size() == 0) {
+		// No worker threads (NO_THREADS or single core); run in place.
+		task->callback(task->userdata);
+		task->completed = 1;
+	} else {
+		_post_task(task);
+	}
+
+	return task->id;
+}
+
+void WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
+
+	task_mutex->lock();
+	Map<TaskID, Task *>::Element *E = tasks.find(p_task_id);
+	if (!E) {
+		task_mutex->unlock();
+		ERR_FAIL_MSG("Invalid task ID (already waited for?): " + itos(p_task_id));
+	}
+	Task *task = E->get();
+
+	if (!task->completed) {
+		if (!task->done_semaphore) {
+			task->done_semaphore = Semaphore::create();
+		}
+		task_mutex->unlock();
+		task->done_semaphore->wait();
+		task_mutex->lock();
+	}
+
+	tasks.erase(p_task_id);
+	task_mutex->unlock();
+
+	if (task->done_semaphore) {
+		memdelete(task->done_semaphore);
+	}
+	memdelete(task);
+}
+
+WorkerThreadPool::GroupID WorkerThreadPool::add_group_task(GroupFunc p_func, void *p_userdata, uint32_t p_elements) {
+
+	ERR_FAIL_COND_V(!p_func, 0);
+
+	Group *group = memnew(Group);
+	group->callback = p_func;
+	group->userdata = p_userdata;
+	group->elements = p_elements;
+	group->done_semaphore = Semaphore::create();
+
+	uint32_t chunk_tasks = MIN((uint32_t)threads.size(), p_elements);
+	group->tasks_pending = chunk_tasks;
+
+	task_mutex->lock();
+	group->id = ++last_task_id;
+	groups[group->id] = group;
+	task_mutex->unlock();
+
+	if (chunk_tasks == 0) {
+		// Everything will be processed by the waiting thread.
+		group->done_semaphore->post();
+	} else {
+		for (uint32_t i = 0; i < chunk_tasks; i++) {
+			Task *task = _allocate_task(NULL, NULL);
+			task->group = group;
+			_post_task(task);
+		}
+	}
+
+	return group->id;
+}
+
+void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group_id) {
+
+	task_mutex->lock();
+	Map<GroupID, Group *>::Element *E = groups.find(p_group_id);
+	if (!E) {
+		task_mutex->unlock();
+		ERR_FAIL_MSG("Invalid group task ID (already waited for?): " + itos(p_group_id));
+	}
+	Group *group = E->get();
+	task_mutex->unlock();
+
+	_process_group_chunk(group); // Help out instead of just blocking.
+
+	group->done_semaphore->wait();
+
+	task_mutex->lock();
+	groups.erase(p_group_id);
+	task_mutex->unlock();
+
+	memdelete(group->done_semaphore);
+	memdelete(group);
+}
+
+void WorkerThreadPool::init(int p_thread_count) {
+
+	ERR_FAIL_COND(threads.size() > 0);
+
+	if (p_thread_count < 0) {
+		p_thread_count = OS::get_singleton()->get_processor_count();
+	}
+
+#ifdef NO_THREADS
+	p_thread_count = 0;
+#endif
+
+	for (int i = 0; i < p_thread_count; i++) {
+
+		ThreadData *td = memnew(ThreadData);
+		td->index = i;
+		td->pool = this;
+		td->deque_mutex = Mutex::create();
+		threads.push_back(td);
+	}
+
+	for (int i = 0; i < threads.size(); i++) {
+		threads[i]->thread = Thread::create(_thread_function, threads[i]);
+	}
+}
+
+void WorkerThreadPool::finish() {
+
+	if (threads.size() == 0)
+		return;
+
+	exit_threads = 1;
+	for (int i = 0; i < threads.size(); i++) {
+		task_available_semaphore->post();
+	}
+
+	for (int i = 0; i < threads.size(); i++) {
+		Thread::wait_to_finish(threads[i]->thread);
+		memdelete(threads[i]->thread);
+		memdelete(threads[i]->deque_mutex);
+		memdelete(threads[i]);
+	}
+	threads.clear();
+}
+
+WorkerThreadPool::WorkerThreadPool() {
+
+	singleton = this;
+	exit_threads = 0;
+	next_queue = 0;
+	last_task_id = 0;
+	task_mutex = Mutex::create();
+	task_available_semaphore = Semaphore::create();
+}
+
+WorkerThreadPool::~WorkerThreadPool() {
+
+	finish();
+	memdelete(task_mutex);
+	memdelete(task_available_semaphore);
+	singleton = NULL;
+}
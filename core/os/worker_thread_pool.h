@@ -0,0 +1,150 @@
+/*************************************************************************/
+/*  worker_thread_pool.h                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef WORKER_THREAD_POOL_H
+#define WORKER_THREAD_POOL_H
+
+#include "core/map.h"
+#include "core/os/mutex.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+#include "core/safe_refcount.h"
+#include "core/vector.h"
+
+// Engine-wide pool of worker threads, shared by every subsystem that needs
+// short-lived parallelism (culling, particles, image processing, ...), so
+// subsystems stop spawning ad-hoc threads and oversubscribing the CPU.
+// Each worker owns a deque of tasks; new tasks are distributed round-robin
+// and idle workers steal from the front of other workers' deques.
+
+class WorkerThreadPool {
+public:
+	typedef uint64_t TaskID;
+	typedef uint64_t GroupID;
+
+	typedef void (*TaskFunc)(void *p_userdata);
+	typedef void (*GroupFunc)(void *p_userdata, uint32_t p_index);
+
+private:
+	struct Group {
+		GroupID id;
+		GroupFunc callback;
+		void *userdata;
+		uint32_t elements;
+		volatile uint32_t index; // next element to process
+		volatile uint32_t tasks_pending; // chunk tasks not yet finished
+		Semaphore *done_semaphore;
+
+		Group() {
+			id = 0;
+			callback = NULL;
+			userdata = NULL;
+			elements = 0;
+			index = 0;
+			tasks_pending = 0;
+			done_semaphore = NULL;
+		}
+	};
+
+	struct Task {
+		TaskID id;
+		TaskFunc callback;
+		void *userdata;
+		Group *group; // non-null for group chunk tasks
+		Semaphore *done_semaphore; // created on demand by the waiter
+		volatile uint32_t completed;
+
+		Task() {
+			id = 0;
+			callback = NULL;
+			userdata = NULL;
+			group = NULL;
+			done_semaphore = NULL;
+			completed = 0;
+		}
+	};
+
+	struct ThreadData {
+		Thread *thread;
+		uint32_t index;
+		Vector<Task *> deque; // back: local LIFO end; front: steal end
+		Mutex *deque_mutex;
+		WorkerThreadPool *pool;
+
+		ThreadData() {
+			thread = NULL;
+			index = 0;
+			deque_mutex = NULL;
+			pool = NULL;
+		}
+	};
+
+	Vector<ThreadData *> threads;
+	Semaphore *task_available_semaphore;
+	volatile uint32_t exit_threads;
+	volatile uint32_t next_queue; // round-robin submission cursor
+
+	Mutex *task_mutex; // guards the id->task/group maps and per-task state
+	Map<TaskID, Task *> tasks;
+	Map<GroupID, Group *> groups;
+	uint64_t last_task_id;
+
+	static WorkerThreadPool *singleton;
+
+	static void _thread_function(void *p_user);
+
+	Task *_allocate_task(TaskFunc p_func, void *p_userdata);
+	void _post_task(Task *p_task);
+	Task *_take_task(uint32_t p_thread_index);
+	void _process_task(Task *p_task);
+	void _process_group_chunk(Group *p_group);
+
+public:
+	static WorkerThreadPool *get_singleton() { return singleton; }
+
+	// Tasks must always be waited on; the TaskID is freed by the wait.
+	TaskID add_task(TaskFunc p_func, void *p_userdata);
+	void wait_for_task_completion(TaskID p_task_id);
+
+	// Runs p_func once for each index in [0, p_elements), distributed over
+	// the pool. The waiting thread also participates in processing.
+	GroupID add_group_task(GroupFunc p_func, void *p_userdata, uint32_t p_elements);
+	void wait_for_group_task_completion(GroupID p_group_id);
+
+	int get_thread_count() const { return threads.size(); }
+
+	void init(int p_thread_count = -1);
+	void finish();
+
+	WorkerThreadPool();
+	~WorkerThreadPool();
+};
+
+#endif // WORKER_THREAD_POOL_H
@@ -132,9 +132,9 @@ class PoolVector {
 
 		{
 			Write w;
-			w._ref(alloc);
+			w._ref(alloc, true);
 			Read r;
-			r._ref(old_alloc);
+			r._ref(old_alloc, false);
 
 			int cur_elements = alloc->size / sizeof(T);
 			T *dst = (T *)w.ptr();
@@ -155,7 +155,7 @@ class PoolVector {
 
 			{
 				Write w;
-				w._ref(old_alloc);
+				w._ref(old_alloc, true);
 
 				int cur_elements = old_alloc->size / sizeof(T);
 				T *elems = (T *)w.ptr();
@@ -218,7 +218,7 @@ class PoolVector {
 			// which is not desirable here because we are destroying the last reference anyways
 			Write w;
 			// Reference to still prevent other threads from touching the alloc
-			w._ref(alloc);
+			w._ref(alloc, true);
 
 			for (int i = 0; i < cur_elements; i++) {
 
@@ -259,13 +259,23 @@ public:
 	protected:
 		MemoryPool::Alloc *alloc;
 		T *mem;
+		bool locked;
 
-		_FORCE_INLINE_ void _ref(MemoryPool::Alloc *p_alloc) {
+		_FORCE_INLINE_ void _ref(MemoryPool::Alloc *p_alloc, bool p_writer) {
 			alloc = p_alloc;
 			if (alloc) {
-				if (atomic_increment(&alloc->lock) == 1) {
-					if (MemoryPool::memory_pool) {
-						//lock it and get mem
+				// Plain reads of malloc-backed memory are just a pointer
+				// dereference; the PoolVector itself keeps the allocation
+				// referenced, so only writers (which must block resize) and
+				// pooled memory need the atomic lock traffic. Read accessors
+				// are opened thousands of times per frame by particles and
+				// mesh code, so this matters.
+				locked = p_writer || MemoryPool::memory_pool != NULL;
+				if (locked) {
+					if (atomic_increment(&alloc->lock) == 1) {
+						if (MemoryPool::memory_pool) {
+							//lock it and get mem
+						}
 					}
 				}
 
@@ -276,7 +286,7 @@ public:
 		_FORCE_INLINE_ void _unref() {
 
 			if (alloc) {
-				if (atomic_decrement(&alloc->lock) == 0) {
+				if (locked && atomic_decrement(&alloc->lock) == 0) {
 					if (MemoryPool::memory_pool) {
 						//put mem back
 					}
@@ -290,6 +300,7 @@ public:
 		Access() {
 			alloc = NULL;
 			mem = NULL;
+			locked = false;
 		}
 
 	public:
@@ -311,11 +322,11 @@ public:
 			if (this->alloc == p_read.alloc)
 				return;
 			this->_unref();
-			this->_ref(p_read.alloc);
+			this->_ref(p_read.alloc, false);
 		}
 
 		Read(const Read &p_read) {
-			this->_ref(p_read.alloc);
+			this->_ref(p_read.alloc, false);
 		}
 
 		Read() {}
@@ -330,11 +341,11 @@ public:
 			if (this->alloc == p_read.alloc)
 				return;
 			this->_unref();
-			this->_ref(p_read.alloc);
+			this->_ref(p_read.alloc, true);
 		}
 
 		Write(const Write &p_read) {
-			this->_ref(p_read.alloc);
+			this->_ref(p_read.alloc, true);
 		}
 
 		Write() {}
@@ -344,7 +355,7 @@ public:
 
 		Read r;
 		if (alloc) {
-			r._ref(alloc);
+			r._ref(alloc, false);
 		}
 		return r;
 	}
@@ -353,7 +364,7 @@ public:
 		Write w;
 		if (alloc) {
 			_copy_on_write(); //make sure there is only one being acessed
-			w._ref(alloc);
+			w._ref(alloc, true);
 		}
 		return w;
 	}
@@ -1209,6 +1209,17 @@ ProjectSettings::ProjectSettings() {
 	Compression::zstd_window_log_size = GLOBAL_DEF("compression/formats/zstd/window_log_size", 27);
 	custom_prop_info["compression/formats/zstd/window_log_size"] = PropertyInfo(Variant::INT, "compression/formats/zstd/window_log_size", PROPERTY_HINT_RANGE, "10,30,1");
 
+	String zstd_dict_path = GLOBAL_DEF("compression/formats/zstd/dictionary_path", String());
+	custom_prop_info["compression/formats/zstd/dictionary_path"] = PropertyInfo(Variant::STRING, "compression/formats/zstd/dictionary_path", PROPERTY_HINT_FILE, "*.dict");
+	if (zstd_dict_path != String()) {
+		Vector<uint8_t> zstd_dict = FileAccess::get_file_as_array(zstd_dict_path);
+		if (zstd_dict.size()) {
+			Compression::set_zstd_dictionary(zstd_dict.ptr(), zstd_dict.size());
+		} else {
+			WARN_PRINTS("Couldn't load zstd dictionary: " + zstd_dict_path);
+		}
+	}
+
 	Compression::zlib_level = GLOBAL_DEF("compression/formats/zlib/compression_level", Z_DEFAULT_COMPRESSION);
 	custom_prop_info["compression/formats/zlib/compression_level"] = PropertyInfo(Variant::INT, "compression/formats/zlib/compression_level", PROPERTY_HINT_RANGE, "-1,9,1");
 
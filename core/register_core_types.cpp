@@ -39,7 +39,9 @@
 #include "core/engine.h"
 #include "core/func_ref.h"
 #include "core/input_map.h"
+#include "core/io/compression.h"
 #include "core/io/config_file.h"
+#include "core/io/file_access_async.h"
 #include "core/io/http_client.h"
 #include "core/io/image_loader.h"
 #include "core/io/marshalls.h"
@@ -61,9 +63,11 @@
 #include "core/math/triangle_mesh.h"
 #include "core/os/input.h"
 #include "core/os/main_loop.h"
+#include "core/os/worker_thread_pool.h"
 #include "core/packed_data_container.h"
 #include "core/path_remap.h"
 #include "core/project_settings.h"
+#include "core/tracepoints.h"
 #include "core/translation.h"
 #include "core/undo_redo.h"
 
@@ -87,6 +91,8 @@ static IP *ip = NULL;
 
 static _Geometry *_geometry = NULL;
 
+static WorkerThreadPool *worker_thread_pool = NULL;
+
 extern Mutex *_global_mutex;
 
 extern void register_global_constants();
@@ -103,7 +109,12 @@ void register_core_types() {
 	_global_mutex = Mutex::create();
 
 	StringName::setup();
+	EngineTracepoints::initialize();
 	ResourceLoader::initialize();
+	FileAccessAsync::initialize();
+
+	worker_thread_pool = memnew(WorkerThreadPool);
+	worker_thread_pool->init();
 
 	register_global_constants();
 	register_variant_methods();
@@ -299,8 +310,13 @@ void unregister_core_types() {
 	if (ip)
 		memdelete(ip);
 
+	memdelete(worker_thread_pool);
+
+	FileAccessAsync::finalize();
 	ResourceLoader::finalize();
 
+	Compression::cleanup();
+
 	ClassDB::cleanup_defaults();
 	ObjectDB::cleanup();
 
@@ -310,6 +326,7 @@ void unregister_core_types() {
 	ClassDB::cleanup();
 	ResourceCache::clear();
 	CoreStringNames::free();
+	EngineTracepoints::finalize();
 	StringName::cleanup();
 
 	if (_global_mutex) {
@@ -317,5 +334,6 @@ void unregister_core_types() {
 		_global_mutex = NULL; //still needed at a few places
 	};
 
+	FrameAllocator::cleanup();
 	MemoryPool::cleanup();
 }
@@ -36,12 +36,18 @@
 #include "core/safe_refcount.h"
 #include "core/set.h"
 #include "core/typedefs.h"
+#include "core/vector.h"
 
 class RID_OwnerBase;
 
+template <class T>
+class RID_SlotOwner;
+
 class RID_Data {
 
 	friend class RID_OwnerBase;
+	template <class T>
+	friend class RID_SlotOwner;
 
 #ifndef DEBUG_ENABLED
 	RID_OwnerBase *_owner;
@@ -56,8 +62,12 @@ public:
 
 class RID {
 	friend class RID_OwnerBase;
+	template <class T>
+	friend class RID_SlotOwner;
 
 	mutable RID_Data *_data;
+	uint32_t _slot; // index+generation when owned by a RID_SlotOwner; lets
+			// validation avoid touching _data, which may be freed
 
 public:
 	_FORCE_INLINE_ RID_Data *get_data() const { return _data; }
@@ -88,6 +98,7 @@ public:
 
 	_FORCE_INLINE_ RID() {
 		_data = NULL;
+		_slot = 0;
 	}
 };
 
@@ -201,4 +212,124 @@ public:
 	}
 };
 
+/**
+ * Slot-map owner: live objects are tracked in a flat slot array with a
+ * generation counter, so validity checks (get/owns) are two loads and a
+ * compare in every build configuration - no Set lookup in debug, no
+ * trusting the raw pointer in release. Freed slots are recycled and the
+ * generation guards against stale RIDs hitting a recycled slot. The slot
+ * array also allows cache-linear iteration over all live objects.
+ */
+template <class T>
+class RID_SlotOwner : public RID_OwnerBase {
+
+	enum {
+		GENERATION_BITS = 12,
+		GENERATION_MASK = (1 << GENERATION_BITS) - 1
+	};
+
+	struct Slot {
+		T *ptr;
+		uint32_t generation;
+	};
+
+	Vector<Slot> slots;
+	Vector<uint32_t> free_slots;
+
+	_FORCE_INLINE_ T *_validate(const RID &p_rid) const {
+
+		// Validate purely against slots[] using the index+generation stored
+		// in the RID; _data may point to freed memory for a stale RID, so it
+		// is only compared, never dereferenced.
+		if (!p_rid.get_data())
+			return NULL;
+		uint32_t index = p_rid._slot >> GENERATION_BITS;
+		if (index >= (uint32_t)slots.size())
+			return NULL;
+		const Slot &slot = slots[index];
+		if (slot.generation != (p_rid._slot & GENERATION_MASK) || slot.ptr != p_rid.get_data())
+			return NULL;
+		return slot.ptr;
+	}
+
+public:
+	RID make_rid(T *p_data) {
+
+		RID rid;
+		_set_data(rid, p_data);
+
+		uint32_t index;
+		if (free_slots.size()) {
+			index = free_slots[free_slots.size() - 1];
+			free_slots.resize(free_slots.size() - 1);
+		} else {
+			index = slots.size();
+			Slot s;
+			s.ptr = NULL;
+			s.generation = 0;
+			slots.push_back(s);
+		}
+
+		Slot &slot = slots.write[index];
+		slot.ptr = p_data;
+		rid._slot = (index << GENERATION_BITS) | slot.generation;
+
+		return rid;
+	}
+
+	_FORCE_INLINE_ T *get(const RID &p_rid) const {
+
+		T *ptr = _validate(p_rid);
+		ERR_FAIL_COND_V(!ptr, NULL);
+		return ptr;
+	}
+
+	_FORCE_INLINE_ T *getornull(const RID &p_rid) const {
+
+		return _validate(p_rid);
+	}
+
+	_FORCE_INLINE_ T *getptr(const RID &p_rid) const {
+
+		return static_cast<T *>(p_rid.get_data());
+	}
+
+	_FORCE_INLINE_ bool owns(const RID &p_rid) const {
+
+		return _validate(p_rid) != NULL;
+	}
+
+	void free(RID p_rid) {
+
+		ERR_FAIL_COND(!_validate(p_rid));
+		uint32_t index = p_rid._slot >> GENERATION_BITS;
+
+		Slot &slot = slots.write[index];
+		slot.ptr = NULL;
+		slot.generation = (slot.generation + 1) & GENERATION_MASK;
+		free_slots.push_back(index);
+
+#ifndef DEBUG_ENABLED
+		_remove_owner(p_rid);
+#endif
+	}
+
+	/* cache-linear iteration over live slots; entries may be NULL */
+
+	_FORCE_INLINE_ int get_slot_count() const { return slots.size(); }
+	_FORCE_INLINE_ T *get_slot(int p_index) const { return slots[p_index].ptr; }
+
+	void get_owned_list(List<RID> *p_owned) {
+
+		for (int i = 0; i < slots.size(); i++) {
+			if (slots[i].ptr) {
+				RID r;
+				_set_data(r, static_cast<T *>(slots[i].ptr));
+				r._slot = (uint32_t(i) << GENERATION_BITS) | slots[i].generation;
+				p_owned->push_back(r);
+			}
+		}
+	}
+};
+
 #endif
@@ -87,6 +87,11 @@ _ALWAYS_INLINE_ uint32_t _atomic_exchange_if_greater_impl(volatile uint32_t *pw,
 	ATOMIC_EXCHANGE_IF_GREATER_BODY(pw, val, LONG, InterlockedCompareExchange, uint32_t)
 }
 
+_ALWAYS_INLINE_ bool _atomic_compare_exchange_impl(volatile uint32_t *pw, volatile uint32_t expected, volatile uint32_t val) {
+
+	return InterlockedCompareExchange((LONG volatile *)pw, val, expected) == (LONG)expected;
+}
+
 _ALWAYS_INLINE_ uint64_t _atomic_conditional_increment_impl(volatile uint64_t *pw){
 
 	ATOMIC_CONDITIONAL_INCREMENT_BODY(pw, LONGLONG, InterlockedCompareExchange64, uint64_t)
@@ -117,6 +122,11 @@ _ALWAYS_INLINE_ uint64_t _atomic_exchange_if_greater_impl(volatile uint64_t *pw,
 	ATOMIC_EXCHANGE_IF_GREATER_BODY(pw, val, LONGLONG, InterlockedCompareExchange64, uint64_t)
 }
 
+_ALWAYS_INLINE_ bool _atomic_compare_exchange_impl(volatile uint64_t *pw, volatile uint64_t expected, volatile uint64_t val) {
+
+	return InterlockedCompareExchange64((LONGLONG volatile *)pw, val, expected) == (LONGLONG)expected;
+}
+
 // The actual advertised functions; they'll call the right implementation
 
 uint32_t atomic_conditional_increment(volatile uint32_t *pw) {
@@ -143,6 +153,10 @@ uint32_t atomic_exchange_if_greater(volatile uint32_t *pw, volatile uint32_t val
 	return _atomic_exchange_if_greater_impl(pw, val);
 }
 
+bool atomic_compare_exchange(volatile uint32_t *pw, volatile uint32_t expected, volatile uint32_t val) {
+	return _atomic_compare_exchange_impl(pw, expected, val);
+}
+
 uint64_t atomic_conditional_increment(volatile uint64_t *pw) {
 	return _atomic_conditional_increment_impl(pw);
 }
@@ -166,4 +180,8 @@ uint64_t atomic_add(volatile uint64_t *pw, volatile uint64_t val) {
 uint64_t atomic_exchange_if_greater(volatile uint64_t *pw, volatile uint64_t val) {
 	return _atomic_exchange_if_greater_impl(pw, val);
 }
+
+bool atomic_compare_exchange(volatile uint64_t *pw, volatile uint64_t expected, volatile uint64_t val) {
+	return _atomic_compare_exchange_impl(pw, expected, val);
+}
 #endif
@@ -68,6 +68,11 @@ public:
 
 	StringBuffer &reserve(int p_size);
 
+	//not guaranteed to be null terminated, use together with length()
+	_FORCE_INLINE_ const CharType *ptr() const {
+		return static_cast<const String &>(buffer).empty() ? short_buffer : buffer.ptr();
+	}
+
 	int length() const;
 
 	String as_string();
@@ -47,11 +47,13 @@ StringName _scs_create(const char *p_chr) {
 }
 
 bool StringName::configured = false;
-Mutex *StringName::lock = NULL;
+Mutex *StringName::_shard_locks[STRING_TABLE_SHARDS];
 
 void StringName::setup() {
 
-	lock = Mutex::create();
+	for (int i = 0; i < STRING_TABLE_SHARDS; i++) {
+		_shard_locks[i] = Mutex::create();
+	}
 
 	ERR_FAIL_COND(configured);
 	for (int i = 0; i < STRING_TABLE_LEN; i++) {
@@ -63,7 +65,9 @@ void StringName::setup() {
 
 void StringName::cleanup() {
 
-	lock->lock();
+	for (int i = 0; i < STRING_TABLE_SHARDS; i++) {
+		_shard_locks[i]->lock();
+	}
 
 	int lost_strings = 0;
 	for (int i = 0; i < STRING_TABLE_LEN; i++) {
@@ -87,9 +91,11 @@ void StringName::cleanup() {
 	if (lost_strings) {
 		print_verbose("StringName: " + itos(lost_strings) + " unclaimed string names at exit.");
 	}
-	lock->unlock();
 
-	memdelete(lock);
+	for (int i = 0; i < STRING_TABLE_SHARDS; i++) {
+		_shard_locks[i]->unlock();
+		memdelete(_shard_locks[i]);
+	}
 }
 
 void StringName::unref() {
@@ -98,6 +104,7 @@ void StringName::unref() {
 
 	if (_data && _data->refcount.unref()) {
 
+		Mutex *lock = _get_lock(_data->idx);
 		lock->lock();
 
 		if (_data->prev) {
@@ -184,12 +191,14 @@ StringName::StringName(const char *p_name) {
 	if (!p_name || p_name[0] == 0)
 		return; //empty, ignore
 
-	lock->lock();
-
 	uint32_t hash = String::hash(p_name);
 
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	Mutex *lock = _get_lock(idx);
+	lock->lock();
+
+
 	_data = _table[idx];
 
 	while (_data) {
@@ -231,12 +240,14 @@ StringName::StringName(const StaticCString &p_static_string) {
 
 	ERR_FAIL_COND(!p_static_string.ptr || !p_static_string.ptr[0]);
 
-	lock->lock();
-
 	uint32_t hash = String::hash(p_static_string.ptr);
 
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	Mutex *lock = _get_lock(idx);
+	lock->lock();
+
+
 	_data = _table[idx];
 
 	while (_data) {
@@ -279,12 +290,14 @@ StringName::StringName(const String &p_name) {
 	if (p_name == String())
 		return;
 
-	lock->lock();
-
 	uint32_t hash = p_name.hash();
 
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	Mutex *lock = _get_lock(idx);
+	lock->lock();
+
+
 	_data = _table[idx];
 
 	while (_data) {
@@ -325,12 +338,14 @@ StringName StringName::search(const char *p_name) {
 	if (!p_name[0])
 		return StringName();
 
-	lock->lock();
-
 	uint32_t hash = String::hash(p_name);
 
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	Mutex *lock = _get_lock(idx);
+	lock->lock();
+
+
 	_Data *_data = _table[idx];
 
 	while (_data) {
@@ -359,12 +374,14 @@ StringName StringName::search(const CharType *p_name) {
 	if (!p_name[0])
 		return StringName();
 
-	lock->lock();
-
 	uint32_t hash = String::hash(p_name);
 
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	Mutex *lock = _get_lock(idx);
+	lock->lock();
+
+
 	_Data *_data = _table[idx];
 
 	while (_data) {
@@ -387,12 +404,14 @@ StringName StringName::search(const String &p_name) {
 
 	ERR_FAIL_COND_V(p_name == "", StringName());
 
-	lock->lock();
-
 	uint32_t hash = p_name.hash();
 
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	Mutex *lock = _get_lock(idx);
+	lock->lock();
+
+
 	_Data *_data = _table[idx];
 
 	while (_data) {
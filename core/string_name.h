@@ -47,7 +47,12 @@ class StringName {
 
 		STRING_TABLE_BITS = 12,
 		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
+		STRING_TABLE_MASK = STRING_TABLE_LEN - 1,
+		// The table is split in shards with one lock each, so threads
+		// interning different names (loaders vs. main) rarely contend.
+		STRING_TABLE_SHARD_BITS = 6,
+		STRING_TABLE_SHARDS = 1 << STRING_TABLE_SHARD_BITS,
+		STRING_TABLE_SHARD_MASK = STRING_TABLE_SHARDS - 1
 	};
 
 	struct _Data {
@@ -82,7 +87,8 @@ class StringName {
 	friend void register_core_types();
 	friend void unregister_core_types();
 
-	static Mutex *lock;
+	static Mutex *_shard_locks[STRING_TABLE_SHARDS];
+	_FORCE_INLINE_ static Mutex *_get_lock(uint32_t p_idx) { return _shard_locks[p_idx & STRING_TABLE_SHARD_MASK]; }
 	static void setup();
 	static void cleanup();
 	static bool configured;
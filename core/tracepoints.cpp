@@ -0,0 +1,121 @@
+/*************************************************************************/
+/*  tracepoints.cpp                                                      */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "tracepoints.h"
+
+#include "core/script_language.h"
+#include "core/variant.h"
+
+Mutex *EngineTracepoints::mutex = NULL;
+volatile bool EngineTracepoints::enabled = false;
+EngineTracepoints::Event EngineTracepoints::events[EngineTracepoints::MAX_EVENTS];
+int EngineTracepoints::event_count = 0;
+
+void EngineTracepoints::set_enabled(bool p_enabled) {
+
+	if (enabled == p_enabled)
+		return;
+
+	if (mutex)
+		mutex->lock();
+	event_count = 0;
+	enabled = p_enabled;
+	if (mutex)
+		mutex->unlock();
+}
+
+void EngineTracepoints::add_event(const char *p_name, uint64_t p_begin_usec, uint64_t p_end_usec) {
+
+	if (!enabled)
+		return;
+
+	MutexLock lock(mutex);
+
+	if (event_count >= MAX_EVENTS)
+		return; //saturated for this frame, drop
+
+	Event &e = events[event_count++];
+	e.name = p_name;
+	e.begin_usec = p_begin_usec;
+	e.end_usec = p_end_usec;
+}
+
+void EngineTracepoints::flush_frame() {
+
+	if (!enabled || !ScriptDebugger::get_singleton())
+		return;
+
+	Array values;
+
+	{
+		MutexLock lock(mutex);
+
+		// Aggregate by name; the same scope may run several times per frame
+		// (e.g. multiple physics iterations or audio mix blocks).
+		for (int i = 0; i < event_count; i++) {
+
+			uint64_t usec = events[i].end_usec - events[i].begin_usec;
+
+			int found = -1;
+			for (int j = 0; j < values.size(); j += 2) {
+				if (String(values[j]) == events[i].name) {
+					found = j;
+					break;
+				}
+			}
+
+			if (found >= 0) {
+				values[found + 1] = double(values[found + 1]) + USEC_TO_SEC(usec);
+			} else {
+				values.push_back(events[i].name);
+				values.push_back(USEC_TO_SEC(usec));
+			}
+		}
+
+		event_count = 0;
+	}
+
+	if (values.size()) {
+		ScriptDebugger::get_singleton()->add_profiling_frame_data("tracepoints", values);
+	}
+}
+
+void EngineTracepoints::initialize() {
+
+	mutex = Mutex::create();
+}
+
+void EngineTracepoints::finalize() {
+
+	if (mutex) {
+		memdelete(mutex);
+		mutex = NULL;
+	}
+}
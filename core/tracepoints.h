@@ -0,0 +1,97 @@
+/*************************************************************************/
+/*  tracepoints.h                                                        */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TRACEPOINTS_H
+#define TRACEPOINTS_H
+
+#include "core/os/mutex.h"
+#include "core/os/os.h"
+#include "core/typedefs.h"
+
+// Named engine scopes for the remote profiler. While the remote debugger is
+// profiling, TRACE_SCOPE() records begin/end timestamps of engine internals
+// (main iteration phases, physics stepping, camera rendering, audio mixing)
+// and streams them once per frame as "tracepoints" profiling frame data, so a
+// frame spike can be attributed without rebuilding with custom prints.
+// Compiled in for debug/profile builds only; TRACE_SCOPE() vanishes in
+// release.
+class EngineTracepoints {
+public:
+	enum {
+		MAX_EVENTS = 1024
+	};
+
+	struct Event {
+		const char *name; //static strings only, the scope macro guarantees it
+		uint64_t begin_usec;
+		uint64_t end_usec;
+	};
+
+private:
+	static Mutex *mutex;
+	static volatile bool enabled;
+	static Event events[MAX_EVENTS];
+	static int event_count;
+
+public:
+	static _FORCE_INLINE_ bool is_enabled() { return enabled; }
+	static void set_enabled(bool p_enabled);
+
+	static void add_event(const char *p_name, uint64_t p_begin_usec, uint64_t p_end_usec);
+	static void flush_frame(); //called once per main iteration, sends collected scopes to the script debugger
+
+	static void initialize();
+	static void finalize();
+};
+
+class EngineTracepointScope {
+
+	const char *name;
+	uint64_t begin_usec;
+
+public:
+	_FORCE_INLINE_ EngineTracepointScope(const char *p_name) {
+		name = p_name;
+		begin_usec = EngineTracepoints::is_enabled() ? OS::get_singleton()->get_ticks_usec() : 0;
+	}
+	_FORCE_INLINE_ ~EngineTracepointScope() {
+		if (begin_usec) {
+			EngineTracepoints::add_event(name, begin_usec, OS::get_singleton()->get_ticks_usec());
+		}
+	}
+};
+
+#ifdef DEBUG_ENABLED
+#define TRACE_SCOPE(m_name) EngineTracepointScope __engine_tracepoint_scope(m_name)
+#else
+#define TRACE_SCOPE(m_name)
+#endif
+
+#endif // TRACEPOINTS_H
@@ -975,6 +975,8 @@ void TranslationServer::set_locale(const String &p_locale) {
 		locale = univ_locale;
 	}
 
+	_invalidate_caches();
+
 	if (OS::get_singleton()->get_main_loop()) {
 		OS::get_singleton()->get_main_loop()->notification(MainLoop::NOTIFICATION_TRANSLATION_CHANGED);
 	}
@@ -1038,15 +1040,18 @@ Vector<String> TranslationServer::get_all_locale_names() {
 void TranslationServer::add_translation(const Ref<Translation> &p_translation) {
 
 	translations.insert(p_translation);
+	_invalidate_caches();
 }
 void TranslationServer::remove_translation(const Ref<Translation> &p_translation) {
 
 	translations.erase(p_translation);
+	_invalidate_caches();
 }
 
 void TranslationServer::clear() {
 
 	translations.clear();
+	_invalidate_caches();
 };
 
 StringName TranslationServer::translate(const StringName &p_message) const {
@@ -1058,6 +1063,13 @@ StringName TranslationServer::translate(const StringName &p_message) const {
 
 	ERR_FAIL_COND_V_MSG(locale.length() < 2, p_message, "Could not translate message as configured locale '" + locale + "' is invalid.");
 
+	{
+		const StringName *cached = translate_cache.getptr(p_message);
+		if (cached) {
+			return *cached;
+		}
+	}
+
 	// Locale can be of the form 'll_CC', i.e. language code and regional code,
 	// e.g. 'en_US', 'en_GB', etc. It might also be simply 'll', e.g. 'en'.
 	// To find the relevant translation, we look for those with locale starting
@@ -1135,12 +1147,51 @@ StringName TranslationServer::translate(const StringName &p_message) const {
 	}
 
 	if (!res) {
-		return p_message;
+		res = p_message;
 	}
 
+	translate_cache[p_message] = res;
+
 	return res;
 }
 
+int TranslationServer::get_message_token(const StringName &p_message) {
+
+	const int *existing = token_map.getptr(p_message);
+	if (existing) {
+		return *existing;
+	}
+
+	TokenEntry e;
+	e.message = p_message;
+	e.version = cache_version - 1; //force resolution on the first lookup
+
+	int token = tokens.size();
+	tokens.push_back(e);
+	token_map[p_message] = token;
+
+	return token;
+}
+
+StringName TranslationServer::translate_token(int p_token) const {
+
+	ERR_FAIL_INDEX_V(p_token, tokens.size(), StringName());
+
+	TokenEntry &e = tokens.write[p_token];
+	if (e.version != cache_version) {
+		e.value = translate(e.message);
+		e.version = cache_version;
+	}
+
+	return e.value;
+}
+
+void TranslationServer::_invalidate_caches() {
+
+	cache_version++;
+	translate_cache.clear();
+}
+
 TranslationServer *TranslationServer::singleton = NULL;
 
 bool TranslationServer::_load_translations(const String &p_from) {
@@ -1217,6 +1268,8 @@ void TranslationServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_locale_name", "locale"), &TranslationServer::get_locale_name);
 
 	ClassDB::bind_method(D_METHOD("translate", "message"), &TranslationServer::translate);
+	ClassDB::bind_method(D_METHOD("get_message_token", "message"), &TranslationServer::get_message_token);
+	ClassDB::bind_method(D_METHOD("translate_token", "token"), &TranslationServer::translate_token);
 
 	ClassDB::bind_method(D_METHOD("add_translation", "translation"), &TranslationServer::add_translation);
 	ClassDB::bind_method(D_METHOD("remove_translation", "translation"), &TranslationServer::remove_translation);
@@ -1239,7 +1292,8 @@ void TranslationServer::load_translations() {
 
 TranslationServer::TranslationServer() :
 		locale("en"),
-		enabled(true) {
+		enabled(true),
+		cache_version(1) {
 	singleton = this;
 
 	for (int i = 0; locale_list[i]; ++i) {
@@ -31,6 +31,7 @@
 #ifndef TRANSLATION_H
 #define TRANSLATION_H
 
+#include "core/hash_map.h"
 #include "core/resource.h"
 
 class Translation : public Resource {
@@ -78,6 +79,21 @@ class TranslationServer : public Object {
 
 	bool enabled;
 
+	// Memoized lookups; translate() results and token slots stay valid until
+	// the catalog or locale changes (see _invalidate_caches).
+	struct TokenEntry {
+		StringName message;
+		StringName value;
+		uint64_t version;
+	};
+
+	mutable uint64_t cache_version;
+	mutable HashMap<StringName, StringName> translate_cache;
+	HashMap<StringName, int> token_map;
+	mutable Vector<TokenEntry> tokens;
+
+	void _invalidate_caches();
+
 	static TranslationServer *singleton;
 	bool _load_translations(const String &p_from);
 
@@ -101,6 +117,9 @@ public:
 
 	StringName translate(const StringName &p_message) const;
 
+	int get_message_token(const StringName &p_message);
+	StringName translate_token(int p_token) const;
+
 	static Vector<String> get_all_locales();
 	static Vector<String> get_all_locale_names();
 	static bool is_locale_valid(const String &p_locale);
@@ -37,6 +37,7 @@
 #include "core/color.h"
 #include "core/crypto/crypto_core.h"
 #include "core/math/math_funcs.h"
+#include "core/os/copymem.h"
 #include "core/os/memory.h"
 #include "core/print_string.h"
 #include "core/translation.h"
@@ -151,6 +152,64 @@ void CharString::copy_from(const char *p_cstr) {
 	strcpy(ptrw(), p_cstr);
 }
 
+/*************************************************************************/
+/*  Utf8String                                                           */
+/*************************************************************************/
+
+Utf8String::Utf8String(const String &p_string) {
+
+	_data = p_string.utf8();
+}
+
+Utf8String::Utf8String(const char *p_utf8, int p_len) {
+
+	if (!p_utf8)
+		return;
+
+	int len = p_len;
+	if (len < 0) {
+		len = strlen(p_utf8);
+	}
+
+	if (len == 0)
+		return;
+
+	_data.resize(len + 1);
+	copymem(_data.ptrw(), p_utf8, len);
+	_data[len] = 0;
+}
+
+bool Utf8String::operator==(const Utf8String &p_str) const {
+
+	if (_data.length() != p_str._data.length())
+		return false;
+
+	return memcmp(_data.get_data(), p_str._data.get_data(), _data.length()) == 0;
+}
+
+bool Utf8String::operator!=(const Utf8String &p_str) const {
+
+	return !(*this == p_str);
+}
+
+bool Utf8String::operator<(const Utf8String &p_str) const {
+
+	return _data < p_str._data;
+}
+
+uint32_t Utf8String::hash() const {
+
+	return String::hash(_data.get_data(), _data.length());
+}
+
+String Utf8String::get_string() const {
+
+	if (empty())
+		return String();
+
+	return String::utf8(_data.get_data(), _data.length());
+}
+
 void String::copy_from(const char *p_cstr) {
 
 	if (!p_cstr) {
@@ -1412,6 +1471,47 @@ bool String::parse_utf8(const char *p_utf8, int p_len) {
 		}
 	}
 
+	{
+		/* ASCII fast path; most storage heavy text (scripts, resources, JSON)
+		   never leaves it. Scan a word at a time until a high bit or the
+		   terminator shows up, then widen with a plain copy. */
+		const uint8_t *ptr8 = (const uint8_t *)p_utf8;
+		int ascii_len = 0;
+
+		if (p_len >= 0) {
+			const uint64_t high = 0x8080808080808080ULL;
+			const uint64_t ones = 0x0101010101010101ULL;
+
+			while (ascii_len + 8 <= p_len) {
+				uint64_t w;
+				copymem(&w, ptr8 + ascii_len, 8);
+				if ((w & high) || ((w - ones) & ~w & high)) //non ASCII byte or embedded NUL
+					break;
+				ascii_len += 8;
+			}
+		}
+
+		while ((p_len < 0 || ascii_len < p_len) && ptr8[ascii_len] && !(ptr8[ascii_len] & 0x80)) {
+			ascii_len++;
+		}
+
+		if ((p_len >= 0 && ascii_len == p_len) || ptr8[ascii_len] == 0) {
+
+			if (ascii_len == 0) {
+				clear();
+				return false;
+			}
+
+			resize(ascii_len + 1);
+			CharType *dst = ptrw();
+			for (int i = 0; i < ascii_len; i++) {
+				dst[i] = ptr8[i];
+			}
+			dst[ascii_len] = 0;
+			return false;
+		}
+	}
+
 	{
 		const char *ptrtmp = p_utf8;
 		const char *ptrtmp_limit = &p_utf8[p_len];
@@ -1578,6 +1678,14 @@ CharString String::utf8() const {
 	utf8s.resize(fl + 1);
 	uint8_t *cdst = (uint8_t *)utf8s.get_data();
 
+	if (fl == l) { //pure ASCII, narrow with a plain copy
+		for (int i = 0; i < l; i++) {
+			cdst[i] = d[i];
+		}
+		cdst[l] = 0;
+		return utf8s;
+	}
+
 #define APPEND_CHAR(m_c) *(cdst++) = m_c
 
 	for (int i = 0; i < l; i++) {
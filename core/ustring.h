@@ -370,6 +370,38 @@ bool operator==(const char *p_chr, const String &p_str);
 String operator+(const char *p_chr, const String &p_str);
 String operator+(CharType p_chr, const String &p_str);
 
+// Compact UTF-8 backed string for storage heavy text (resource text, JSON,
+// translations). Keeps the bytes as they came from disk or network instead of
+// widening to CharType, and only pays for the wide conversion when the value
+// crosses into String consuming code (typically the GUI).
+class Utf8String {
+
+	CharString _data;
+
+public:
+	_FORCE_INLINE_ int byte_length() const { return _data.length(); }
+	_FORCE_INLINE_ bool empty() const { return _data.length() == 0; }
+	_FORCE_INLINE_ const char *ptr() const { return _data.get_data(); }
+
+	bool operator==(const Utf8String &p_str) const;
+	bool operator!=(const Utf8String &p_str) const;
+	bool operator<(const Utf8String &p_str) const;
+
+	uint32_t hash() const;
+
+	String get_string() const; //wide conversion, done only at the boundary
+
+	void clear() { _data = CharString(); }
+
+	Utf8String() {}
+	Utf8String(const String &p_string);
+	Utf8String(const char *p_utf8, int p_len = -1);
+};
+
+struct Utf8StringHasher {
+	static _FORCE_INLINE_ uint32_t hash(const Utf8String &p_string) { return p_string.hash(); }
+};
+
 String itos(int64_t p_val);
 String uitos(uint64_t p_val);
 String rtos(double p_val);
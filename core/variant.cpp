@@ -908,6 +908,47 @@ bool Variant::is_one() const {
 	return false;
 }
 
+// Pool for the math types that Variant stores out of line (Transform is by
+// far the hottest: every script call passing one used to hit the allocator).
+// One bucket sized for the largest type, with a per-thread free list so no
+// locking is involved; memory is kept for reuse instead of being returned.
+
+union VariantPoolBlock {
+
+	VariantPoolBlock *next;
+	uint8_t data[sizeof(Transform) > sizeof(Transform2D) ? sizeof(Transform) : sizeof(Transform2D)];
+};
+
+#ifdef NO_THREADS
+static VariantPoolBlock *variant_pool_free_list = NULL;
+#else
+static thread_local VariantPoolBlock *variant_pool_free_list = NULL;
+#endif
+
+static _FORCE_INLINE_ void *variant_pool_alloc() {
+
+	if (variant_pool_free_list) {
+		VariantPoolBlock *block = variant_pool_free_list;
+		variant_pool_free_list = block->next;
+		return block;
+	}
+	return memalloc(sizeof(VariantPoolBlock));
+}
+
+static _FORCE_INLINE_ void variant_pool_free(void *p_ptr) {
+
+	VariantPoolBlock *block = (VariantPoolBlock *)p_ptr;
+	block->next = variant_pool_free_list;
+	variant_pool_free_list = block;
+}
+
+template <class T>
+static _FORCE_INLINE_ void variant_pool_delete(T *p_ptr) {
+
+	p_ptr->~T();
+	variant_pool_free(p_ptr);
+}
+
 void Variant::reference(const Variant &p_variant) {
 
 	switch (type) {
@@ -957,7 +998,7 @@ void Variant::reference(const Variant &p_variant) {
 		} break;
 		case TRANSFORM2D: {
 
-			_data._transform2d = memnew(Transform2D(*p_variant._data._transform2d));
+			_data._transform2d = memnew_placement(variant_pool_alloc(), Transform2D(*p_variant._data._transform2d));
 		} break;
 		case VECTOR3: {
 
@@ -970,7 +1011,7 @@ void Variant::reference(const Variant &p_variant) {
 
 		case AABB: {
 
-			_data._aabb = memnew(::AABB(*p_variant._data._aabb));
+			_data._aabb = memnew_placement(variant_pool_alloc(), ::AABB(*p_variant._data._aabb));
 		} break;
 		case QUAT: {
 
@@ -979,12 +1020,12 @@ void Variant::reference(const Variant &p_variant) {
 		} break;
 		case BASIS: {
 
-			_data._basis = memnew(Basis(*p_variant._data._basis));
+			_data._basis = memnew_placement(variant_pool_alloc(), Basis(*p_variant._data._basis));
 
 		} break;
 		case TRANSFORM: {
 
-			_data._transform = memnew(Transform(*p_variant._data._transform));
+			_data._transform = memnew_placement(variant_pool_alloc(), Transform(*p_variant._data._transform));
 		} break;
 
 		// misc types
@@ -1092,19 +1133,19 @@ void Variant::clear() {
 	*/
 		case TRANSFORM2D: {
 
-			memdelete(_data._transform2d);
+			variant_pool_delete(_data._transform2d);
 		} break;
 		case AABB: {
 
-			memdelete(_data._aabb);
+			variant_pool_delete(_data._aabb);
 		} break;
 		case BASIS: {
 
-			memdelete(_data._basis);
+			variant_pool_delete(_data._basis);
 		} break;
 		case TRANSFORM: {
 
-			memdelete(_data._transform);
+			variant_pool_delete(_data._transform);
 		} break;
 
 		// misc types
@@ -2239,13 +2280,13 @@ Variant::Variant(const Plane &p_plane) {
 Variant::Variant(const ::AABB &p_aabb) {
 
 	type = AABB;
-	_data._aabb = memnew(::AABB(p_aabb));
+	_data._aabb = memnew_placement(variant_pool_alloc(), ::AABB(p_aabb));
 }
 
 Variant::Variant(const Basis &p_matrix) {
 
 	type = BASIS;
-	_data._basis = memnew(Basis(p_matrix));
+	_data._basis = memnew_placement(variant_pool_alloc(), Basis(p_matrix));
 }
 
 Variant::Variant(const Quat &p_quat) {
@@ -2256,13 +2297,13 @@ Variant::Variant(const Quat &p_quat) {
 Variant::Variant(const Transform &p_transform) {
 
 	type = TRANSFORM;
-	_data._transform = memnew(Transform(p_transform));
+	_data._transform = memnew_placement(variant_pool_alloc(), Transform(p_transform));
 }
 
 Variant::Variant(const Transform2D &p_transform) {
 
 	type = TRANSFORM2D;
-	_data._transform2d = memnew(Transform2D(p_transform));
+	_data._transform2d = memnew_placement(variant_pool_alloc(), Transform2D(p_transform));
 }
 Variant::Variant(const Color &p_color) {
 
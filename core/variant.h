@@ -162,6 +162,38 @@ public:
 	bool is_zero() const;
 	bool is_one() const;
 
+#ifdef PTRCALL_ENABLED
+	// Pointer to the internal storage of the current type, laid out the way
+	// the ptrcall ABI expects its arguments (method_ptrcall.h). Returns NULL
+	// for types that need marshalling (NIL, OBJECT), callers must fall back
+	// to a regular call for those.
+	_FORCE_INLINE_ const void *get_ptrcall_arg() const {
+
+		switch (type) {
+			case NIL:
+				return NULL;
+			case BOOL:
+				return &_data._bool;
+			case INT:
+				return &_data._int;
+			case REAL:
+				return &_data._real;
+			case TRANSFORM2D:
+				return _data._transform2d;
+			case AABB:
+				return _data._aabb;
+			case BASIS:
+				return _data._basis;
+			case TRANSFORM:
+				return _data._transform;
+			case OBJECT:
+				return NULL; //reference semantics, can't be passed raw
+			default:
+				return _data._mem; //String, math types, RID, NodePath, containers
+		}
+	}
+#endif
+
 	operator bool() const;
 	operator signed int() const;
 	operator unsigned int() const; // this is the real one
@@ -3003,8 +3003,26 @@ bool Variant::iter_init(Variant &r_iter, bool &valid) const {
 			if (dic->empty())
 				return false;
 
-			const Variant *next = dic->next(NULL);
-			r_iter = *next;
+			//the iterator is [cursor, version, key]; the cursor advances in
+			//place without the per-step key lookup done by Dictionary::next(),
+			//the version detects mid-loop erases and the key both feeds
+			//iter_get and allows falling back to key-based advance.
+			//reuse the state array when the same slot runs the loop again,
+			//so steady-state iteration does not allocate
+			Array state;
+			if (r_iter.get_type() == ARRAY) {
+				state = r_iter;
+				if (state.size() != 3)
+					state.resize(3);
+			} else {
+				state.resize(3);
+				r_iter = state;
+			}
+
+			const void *cursor = dic->cursor_front();
+			state[0] = (int64_t)(uintptr_t)cursor;
+			state[1] = (int64_t)dic->get_version();
+			state[2] = dic->cursor_key(cursor);
 			return true;
 
 		} break;
@@ -3171,6 +3189,31 @@ bool Variant::iter_next(Variant &r_iter, bool &valid) const {
 		case DICTIONARY: {
 
 			const Dictionary *dic = reinterpret_cast<const Dictionary *>(_data._mem);
+			if (r_iter.get_type() == ARRAY) {
+
+				Array state = r_iter;
+				if (state.size() == 3) {
+					if ((uint64_t)(int64_t)state[1] == dic->get_version()) {
+						const void *cursor = (const void *)(uintptr_t)(int64_t)state[0];
+						cursor = dic->cursor_next(cursor);
+						if (!cursor)
+							return false;
+						state[0] = (int64_t)(uintptr_t)cursor;
+						state[2] = dic->cursor_key(cursor);
+						return true;
+					}
+					//an element was erased mid-loop; the cursor may dangle, so
+					//finish the loop with key-based advance (old behavior)
+					Variant key = state[2];
+					const Variant *next = dic->next(&key);
+					if (!next)
+						return false;
+					state[1] = 0; //never matches a live version
+					state[2] = *next;
+					return true;
+				}
+			}
+
 			const Variant *next = dic->next(&r_iter);
 			if (!next)
 				return false;
@@ -3321,7 +3364,12 @@ Variant Variant::iter_get(const Variant &r_iter, bool &r_valid) const {
 		} break;
 		case DICTIONARY: {
 
-			return r_iter; //iterator is the same as the key
+			if (r_iter.get_type() == ARRAY) {
+				Array state = r_iter;
+				if (state.size() == 3)
+					return state[2]; //current key
+			}
+			return r_iter; //legacy iterator is the key itself
 
 		} break;
 		case ARRAY: {
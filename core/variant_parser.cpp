@@ -64,6 +64,27 @@ bool VariantParser::StreamString::is_eof() const {
 	return pos > s.length();
 }
 
+String VariantParser::Stream::intern(const CharType *p_chars, int p_len) {
+
+	if (p_len == 0)
+		return String();
+
+	if (p_len > 64) //only short, key-like strings are worth caching
+		return String(p_chars, p_len);
+
+	uint32_t h = String::hash(p_chars, p_len);
+	String *e = intern_cache.getptr(h);
+	if (e) {
+		if (e->length() == p_len && memcmp(e->ptr(), p_chars, p_len * sizeof(CharType)) == 0)
+			return *e; //repeated string, share the existing allocation
+		return String(p_chars, p_len); //hash collision, keep the existing entry
+	}
+
+	String str(p_chars, p_len);
+	intern_cache[h] = str;
+	return str;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 const char *VariantParser::tk_name[TK_MAX] = {
@@ -200,7 +221,8 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 			};
 			case '"': {
 
-				String str;
+				StringBuffer<> str;
+				bool is_ascii = true;
 				while (true) {
 
 					CharType ch = p_stream->get_char();
@@ -274,19 +296,27 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 						}
 
 						str += res;
+						if (res >= 128)
+							is_ascii = false;
 
 					} else {
 						if (ch == '\n')
 							line++;
 						str += ch;
+						if (ch >= 128)
+							is_ascii = false;
 					}
 				}
 
-				if (p_stream->is_utf8()) {
-					str.parse_utf8(str.ascii(true).get_data());
+				if (p_stream->is_utf8() && !is_ascii) {
+					//only non-ASCII strings need the conversion round trip, for pure ASCII it is an identity transform
+					String s = str.as_string();
+					s.parse_utf8(s.ascii(true).get_data());
+					r_token.value = s;
+				} else {
+					r_token.value = p_stream->intern(str.ptr(), str.length());
 				}
 				r_token.type = TK_STRING;
-				r_token.value = str;
 				return OK;
 
 			} break;
@@ -391,7 +421,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 					p_stream->saved = cchar;
 
 					r_token.type = TK_IDENTIFIER;
-					r_token.value = id.as_string();
+					r_token.value = p_stream->intern(id.ptr(), id.length());
 					return OK;
 				} else {
 					r_err_str = "Unexpected character.";
@@ -31,6 +31,7 @@
 #ifndef VARIANT_PARSER_H
 #define VARIANT_PARSER_H
 
+#include "core/hash_map.h"
 #include "core/os/file_access.h"
 #include "core/resource.h"
 #include "core/variant.h"
@@ -45,9 +46,16 @@ public:
 
 		CharType saved;
 
+		//returns a String for the given span, sharing one allocation between repetitions
+		//of the same short string (dictionary keys, property names) within this stream
+		String intern(const CharType *p_chars, int p_len);
+
 		Stream() :
 				saved(0) {}
 		virtual ~Stream() {}
+
+	private:
+		HashMap<uint32_t, String> intern_cache;
 	};
 
 	struct StreamFile : public Stream {
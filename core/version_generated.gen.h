@@ -0,0 +1,10 @@
+#define VERSION_SHORT_NAME "godot"
+#define VERSION_NAME "Godot Engine"
+#define VERSION_MAJOR 3
+#define VERSION_MINOR 2
+#define VERSION_PATCH 0
+#define VERSION_STATUS "rc"
+#define VERSION_BUILD "custom_build"
+#define VERSION_MODULE_CONFIG ""
+#define VERSION_YEAR 2020
+#define VERSION_WEBSITE "https://godotengine.org"
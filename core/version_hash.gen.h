@@ -0,0 +1 @@
+#define VERSION_HASH "deadbeef"
@@ -126,7 +126,12 @@ public:
 		int height;
 		uint32_t flags;
 		Image::Format format;
+#ifdef TOOLS_ENABLED
+		// The headless editor/exporter reads texture contents back, so tool
+		// builds keep the pixels around. Dedicated server builds never read
+		// them again and only store the metadata above.
 		Ref<Image> image;
+#endif
 		String path;
 	};
 
@@ -165,8 +170,10 @@ public:
 		t->height = p_height;
 		t->flags = p_flags;
 		t->format = p_format;
+#ifdef TOOLS_ENABLED
 		t->image = Ref<Image>(memnew(Image));
 		t->image->create(p_width, p_height, false, p_format);
+#endif
 	}
 	void texture_set_data(RID p_texture, const Ref<Image> &p_image, int p_level) {
 		DummyTexture *t = texture_owner.getornull(p_texture);
@@ -174,7 +181,9 @@ public:
 		t->width = p_image->get_width();
 		t->height = p_image->get_height();
 		t->format = p_image->get_format();
+#ifdef TOOLS_ENABLED
 		t->image->create(t->width, t->height, false, t->format, p_image->get_data());
+#endif
 	}
 
 	void texture_set_data_partial(RID p_texture, const Ref<Image> &p_image, int src_x, int src_y, int src_w, int src_h, int dst_x, int dst_y, int p_dst_mip, int p_level) {
@@ -187,13 +196,19 @@ public:
 		ERR_FAIL_COND(src_x < 0 || src_y < 0 || src_x + src_w > p_image->get_width() || src_y + src_h > p_image->get_height());
 		ERR_FAIL_COND(dst_x < 0 || dst_y < 0 || dst_x + src_w > t->width || dst_y + src_h > t->height);
 
+#ifdef TOOLS_ENABLED
 		t->image->blit_rect(p_image, Rect2(src_x, src_y, src_w, src_h), Vector2(dst_x, dst_y));
+#endif
 	}
 
 	Ref<Image> texture_get_data(RID p_texture, int p_level) const {
 		DummyTexture *t = texture_owner.getornull(p_texture);
 		ERR_FAIL_COND_V(!t, Ref<Image>());
+#ifdef TOOLS_ENABLED
 		return t->image;
+#else
+		return Ref<Image>();
+#endif
 	}
 	void texture_set_flags(RID p_texture, uint32_t p_flags) {
 		DummyTexture *t = texture_owner.getornull(p_texture);
@@ -436,6 +451,7 @@ public:
 	Color multimesh_instance_get_custom_data(RID p_multimesh, int p_index) const { return Color(); }
 
 	void multimesh_set_as_bulk_array(RID p_multimesh, const PoolVector<float> &p_array) {}
+	void multimesh_set_buffer_region(RID p_multimesh, int p_instance_from, const PoolVector<float> &p_array) {}
 
 	void multimesh_set_visible_instances(RID p_multimesh, int p_visible) {}
 	int multimesh_get_visible_instances(RID p_multimesh) const { return 0; }
@@ -454,6 +470,7 @@ public:
 	void immediate_uv2(RID p_immediate, const Vector2 &tex_uv) {}
 	void immediate_end(RID p_immediate) {}
 	void immediate_clear(RID p_immediate) {}
+	void immediate_set_buffer(RID p_immediate, VS::PrimitiveType p_primitive, const PoolVector<Vector3> &p_vertices, const PoolVector<Vector3> &p_normals, const PoolVector<Plane> &p_tangents, const PoolVector<Color> &p_colors, const PoolVector<Vector2> &p_uvs, const PoolVector<Vector2> &p_uv2s, RID p_texture = RID()) {}
 	void immediate_set_material(RID p_immediate, RID p_material) {}
 	RID immediate_get_material(RID p_immediate) const { return RID(); }
 	AABB immediate_get_aabb(RID p_immediate) const { return AABB(); }
@@ -466,6 +483,7 @@ public:
 	void skeleton_set_world_transform(RID p_skeleton, bool p_enable, const Transform &p_world_transform) {}
 	int skeleton_get_bone_count(RID p_skeleton) const { return 0; }
 	void skeleton_bone_set_transform(RID p_skeleton, int p_bone, const Transform &p_transform) {}
+	void skeleton_set_bone_transforms(RID p_skeleton, const Vector<Transform> &p_transforms) {}
 	Transform skeleton_bone_get_transform(RID p_skeleton, int p_bone) const { return Transform(); }
 	void skeleton_bone_set_transform_2d(RID p_skeleton, int p_bone, const Transform2D &p_transform) {}
 	Transform2D skeleton_bone_get_transform_2d(RID p_skeleton, int p_bone) const { return Transform2D(); }
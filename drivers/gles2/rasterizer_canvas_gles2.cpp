@@ -541,6 +541,103 @@ static const GLenum gl_primitive[] = {
 	GL_TRIANGLE_FAN
 };
 
+bool RasterizerCanvasGLES2::_rect_is_batchable(const Item::CommandRect *p_rect) const {
+
+	//tiled rects change the texture wrap mode mid-draw and normal mapped
+	//rects need the rect mode flip handling, neither of which the generic
+	//vertex path can express
+
+	return !(p_rect->flags & (CANVAS_RECT_TILE | CANVAS_RECT_CLIP_UV)) && p_rect->normal_map == RID();
+}
+
+int RasterizerCanvasGLES2::_try_batch_rects(Item::Command **p_commands, int p_count, int p_current, RasterizerStorageGLES2::Material *p_material) {
+
+	//merge a run of consecutive rects sharing the same texture into a single
+	//vertex buffer draw; modulate goes into the per-vertex color so it may
+	//differ between rects. Returns the amount of commands consumed (0 if the
+	//run is too short to be worth it and the caller should draw normally).
+
+	if (data.batch_max_rects < 2)
+		return 0;
+
+	Item::CommandRect *first = static_cast<Item::CommandRect *>(p_commands[p_current]);
+
+	if (!_rect_is_batchable(first))
+		return 0;
+
+	int run = 1;
+	while (p_current + run < p_count && run < data.batch_max_rects) {
+
+		Item::Command *nc = p_commands[p_current + run];
+		if (nc->type != Item::Command::TYPE_RECT)
+			break;
+
+		Item::CommandRect *nr = static_cast<Item::CommandRect *>(nc);
+		if (nr->texture != first->texture || !_rect_is_batchable(nr))
+			break;
+
+		run++;
+	}
+
+	if (run < 2)
+		return 0;
+
+	state.canvas_shader.set_conditional(CanvasShaderGLES2::USE_TEXTURE_RECT, false);
+
+	if (state.canvas_shader.bind()) {
+		_set_uniforms();
+		state.canvas_shader.use_material((void *)p_material);
+	}
+
+	RasterizerStorageGLES2::Texture *texture = _bind_canvas_texture(first->texture, RID());
+
+	Size2 texpixel_size(1, 1);
+	if (texture) {
+		texpixel_size = Size2(1.0 / texture->width, 1.0 / texture->height);
+	}
+	state.canvas_shader.set_uniform(CanvasShaderGLES2::COLOR_TEXPIXEL_SIZE, texture ? texpixel_size : Vector2());
+
+	static const Vector2 corners[4] = { Vector2(0, 0), Vector2(1, 0), Vector2(1, 1), Vector2(0, 1) };
+	static const int triangles[6] = { 0, 1, 2, 0, 2, 3 };
+
+	int vertex_count = 0;
+
+	for (int j = 0; j < run; j++) {
+
+		Item::CommandRect *rect = static_cast<Item::CommandRect *>(p_commands[p_current + j]);
+
+		Rect2 src_rect = (rect->flags & CANVAS_RECT_REGION) ? Rect2(rect->source.position * texpixel_size, rect->source.size * texpixel_size) : Rect2(0, 0, 1, 1);
+		Rect2 dst_rect = Rect2(rect->rect.position, rect->rect.size);
+
+		if (dst_rect.size.width < 0) {
+			dst_rect.position.x += dst_rect.size.width;
+			dst_rect.size.width *= -1;
+		}
+		if (dst_rect.size.height < 0) {
+			dst_rect.position.y += dst_rect.size.height;
+			dst_rect.size.height *= -1;
+		}
+
+		bool flip_h = rect->flags & CANVAS_RECT_FLIP_H;
+		bool flip_v = rect->flags & CANVAS_RECT_FLIP_V;
+		bool transpose = rect->flags & CANVAS_RECT_TRANSPOSE;
+
+		for (int k = 0; k < 6; k++) {
+
+			Vector2 corner = corners[triangles[k]];
+
+			data.batch_vertices[vertex_count] = dst_rect.position + dst_rect.size * Vector2(flip_h ? 1.0 - corner.x : corner.x, flip_v ? 1.0 - corner.y : corner.y);
+			data.batch_uvs[vertex_count] = src_rect.position + src_rect.size * (transpose ? Vector2(corner.y, corner.x) : corner);
+			data.batch_colors[vertex_count] = rect->modulate;
+			vertex_count++;
+		}
+	}
+
+	_draw_generic(GL_TRIANGLES, vertex_count, data.batch_vertices, texture ? data.batch_uvs : NULL, data.batch_colors, false);
+
+	return run;
+}
+
 void RasterizerCanvasGLES2::_canvas_item_render_commands(Item *p_item, Item *current_clip, bool &reclip, RasterizerStorageGLES2::Material *p_material) {
 
 	int command_count = p_item->commands.size();
@@ -616,6 +713,12 @@ void RasterizerCanvasGLES2::_canvas_item_render_commands(Item *p_item, Item *cur
 
 				Item::CommandRect *r = static_cast<Item::CommandRect *>(command);
 
+				int batched = _try_batch_rects(commands, command_count, i, p_material);
+				if (batched > 0) {
+					i += batched - 1;
+					break;
+				}
+
 				glDisableVertexAttribArray(VS::ARRAY_COLOR);
 				glVertexAttrib4fv(VS::ARRAY_COLOR, r->modulate.components);
 
@@ -2132,6 +2235,25 @@ void RasterizerCanvasGLES2::initialize() {
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
 		data.polygon_index_buffer_size = index_size;
+
+		uint32_t batch_size = GLOBAL_DEF("rendering/limits/buffers/canvas_batch_buffer_size_kb", 128);
+		ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/buffers/canvas_batch_buffer_size_kb", PropertyInfo(Variant::INT, "rendering/limits/buffers/canvas_batch_buffer_size_kb", PROPERTY_HINT_RANGE, "0,256,1,or_greater"));
+		batch_size *= 1024; // kb
+
+		// 6 vertices per rect, the batch must also fit in the polygon buffer it is drawn from
+		uint32_t bytes_per_rect = 6 * (sizeof(Vector2) * 2 + sizeof(Color));
+		data.batch_max_rects = MIN(batch_size, data.polygon_buffer_size) / bytes_per_rect;
+
+		if (data.batch_max_rects >= 2) {
+			data.batch_vertices = memnew_arr(Vector2, data.batch_max_rects * 6);
+			data.batch_uvs = memnew_arr(Vector2, data.batch_max_rects * 6);
+			data.batch_colors = memnew_arr(Color, data.batch_max_rects * 6);
+		} else {
+			data.batch_max_rects = 0; // disabled
+			data.batch_vertices = NULL;
+			data.batch_uvs = NULL;
+			data.batch_colors = NULL;
+		}
 	}
 
 	// ninepatch buffers
@@ -2216,6 +2338,12 @@ void RasterizerCanvasGLES2::initialize() {
 }
 
 void RasterizerCanvasGLES2::finalize() {
+
+	if (data.batch_vertices) {
+		memdelete_arr(data.batch_vertices);
+		memdelete_arr(data.batch_uvs);
+		memdelete_arr(data.batch_colors);
+	}
 }
 
 RasterizerCanvasGLES2::RasterizerCanvasGLES2() {
@@ -70,6 +70,12 @@ public:
 		GLuint ninepatch_vertices;
 		GLuint ninepatch_elements;
 
+		//scratch arrays for rect batching (see _try_batch_rects)
+		Vector2 *batch_vertices;
+		Vector2 *batch_uvs;
+		Color *batch_colors;
+		int batch_max_rects;
+
 	} data;
 
 	struct State {
@@ -120,6 +126,9 @@ public:
 	_FORCE_INLINE_ void _draw_generic(GLuint p_primitive, int p_vertex_count, const Vector2 *p_vertices, const Vector2 *p_uvs, const Color *p_colors, bool p_singlecolor);
 	_FORCE_INLINE_ void _draw_generic_indices(GLuint p_primitive, const int *p_indices, int p_index_count, int p_vertex_count, const Vector2 *p_vertices, const Vector2 *p_uvs, const Color *p_colors, bool p_singlecolor);
 
+	_FORCE_INLINE_ bool _rect_is_batchable(const Item::CommandRect *p_rect) const;
+	int _try_batch_rects(Item::Command **p_commands, int p_count, int p_current, RasterizerStorageGLES2::Material *p_material);
+
 	_FORCE_INLINE_ void _canvas_item_render_commands(Item *p_item, Item *current_clip, bool &reclip, RasterizerStorageGLES2::Material *p_material);
 	void _copy_screen(const Rect2 &p_rect);
 	_FORCE_INLINE_ void _copy_texscreen(const Rect2 &p_rect);
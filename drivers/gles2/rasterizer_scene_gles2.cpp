@@ -1221,13 +1221,13 @@ void RasterizerSceneGLES2::_fill_render_list(InstanceBase **p_cull_result, int p
 
 			case VS::INSTANCE_MESH: {
 
-				RasterizerStorageGLES2::Mesh *mesh = storage->mesh_owner.getornull(instance->base);
+				RasterizerStorageGLES2::Mesh *mesh = storage->mesh_owner.getornull(instance->lod_mesh.is_valid() ? instance->lod_mesh : instance->base);
 				ERR_CONTINUE(!mesh);
 
 				int num_surfaces = mesh->surfaces.size();
 
 				for (int j = 0; j < num_surfaces; j++) {
-					int material_index = instance->materials[j].is_valid() ? j : -1;
+					int material_index = j < instance->materials.size() && instance->materials[j].is_valid() ? j : -1;
 
 					RasterizerStorageGLES2::Surface *surface = mesh->surfaces[j];
 
@@ -1442,10 +1442,15 @@ void RasterizerSceneGLES2::_setup_geometry(RenderList::Element *p_element, Raste
 
 			if (p_skeleton) {
 
+				bool use_uniform_skinning = storage->config.use_skeleton_uniforms && !p_skeleton->use_2d && p_skeleton->size <= MAX_UNIFORM_SKINNING_BONES;
+
 				if (!storage->config.use_skeleton_software) {
 					//use float texture workflow
 					glActiveTexture(GL_TEXTURE0 + storage->config.max_texture_image_units - 1);
 					glBindTexture(GL_TEXTURE_2D, p_skeleton->tex_id);
+				} else if (use_uniform_skinning) {
+					//the pose is uploaded as uniforms once the shader binds;
+					//bones and weights come from the regular vertex attributes
 				} else {
 					//use transform buffer workflow
 					ERR_FAIL_COND(p_skeleton->use_2d);
@@ -2453,10 +2458,13 @@ void RasterizerSceneGLES2::_render_render_list(RenderList::Element **p_elements,
 		if (skeleton != prev_skeleton) {
 
 			if (skeleton) {
+				bool use_uniform_skinning = storage->config.use_skeleton_uniforms && !skeleton->use_2d && skeleton->size <= MAX_UNIFORM_SKINNING_BONES;
 				state.scene_shader.set_conditional(SceneShaderGLES2::USE_SKELETON, true);
-				state.scene_shader.set_conditional(SceneShaderGLES2::USE_SKELETON_SOFTWARE, storage->config.use_skeleton_software);
+				state.scene_shader.set_conditional(SceneShaderGLES2::USE_SKELETON_UNIFORMS, use_uniform_skinning);
+				state.scene_shader.set_conditional(SceneShaderGLES2::USE_SKELETON_SOFTWARE, storage->config.use_skeleton_software && !use_uniform_skinning);
 			} else {
 				state.scene_shader.set_conditional(SceneShaderGLES2::USE_SKELETON, false);
+				state.scene_shader.set_conditional(SceneShaderGLES2::USE_SKELETON_UNIFORMS, false);
 				state.scene_shader.set_conditional(SceneShaderGLES2::USE_SKELETON_SOFTWARE, false);
 			}
 
@@ -2572,6 +2580,11 @@ void RasterizerSceneGLES2::_render_render_list(RenderList::Element **p_elements,
 
 		state.scene_shader.set_uniform(SceneShaderGLES2::WORLD_TRANSFORM, e->instance->transform);
 
+		if (skeleton && (i == 0 || shader_rebind || skeleton != prev_skeleton) && storage->config.use_skeleton_uniforms && !skeleton->use_2d && skeleton->size <= MAX_UNIFORM_SKINNING_BONES) {
+			//attribute-based GPU skinning: upload the pose into uniform registers
+			glUniform4fv(state.scene_shader.get_uniform_location(SceneShaderGLES2::SKELETON_BONES), skeleton->size * 3, (const GLfloat *)skeleton->bone_data.ptr());
+		}
+
 		if (use_lightmap_capture) { //this is per instance, must be set always if present
 			glUniform4fv(state.scene_shader.get_uniform_location(SceneShaderGLES2::LIGHTMAP_CAPTURES), 12, (const GLfloat *)e->instance->lightmap_capture_data.ptr());
 			state.scene_shader.set_uniform(SceneShaderGLES2::LIGHTMAP_CAPTURE_SKY, false);
@@ -2593,6 +2606,8 @@ void RasterizerSceneGLES2::_render_render_list(RenderList::Element **p_elements,
 
 	_setup_light_type(NULL, NULL); //clear light stuff
 	state.scene_shader.set_conditional(SceneShaderGLES2::USE_SKELETON, false);
+	state.scene_shader.set_conditional(SceneShaderGLES2::USE_SKELETON_UNIFORMS, false);
+	state.scene_shader.set_conditional(SceneShaderGLES2::USE_SKELETON_SOFTWARE, false);
 	state.scene_shader.set_conditional(SceneShaderGLES2::SHADELESS, false);
 	state.scene_shader.set_conditional(SceneShaderGLES2::BASE_PASS, false);
 	state.scene_shader.set_conditional(SceneShaderGLES2::USE_INSTANCING, false);
@@ -3535,7 +3550,7 @@ void RasterizerSceneGLES2::render_scene(const Transform &p_cam_transform, const
 #endif
 }
 
-void RasterizerSceneGLES2::render_shadow(RID p_light, RID p_shadow_atlas, int p_pass, InstanceBase **p_cull_result, int p_cull_count) {
+void RasterizerSceneGLES2::render_shadow(RID p_light, RID p_shadow_atlas, int p_pass, InstanceBase **p_cull_result, int p_cull_count, bool p_clear_region) {
 
 	state.render_no_shadows = false;
 
@@ -3741,14 +3756,16 @@ void RasterizerSceneGLES2::render_shadow(RID p_light, RID p_shadow_atlas, int p_
 		glScissor(x, y, width, height);
 	}
 
-	glEnable(GL_SCISSOR_TEST);
-	glClearDepth(1.0f);
-	glClear(GL_DEPTH_BUFFER_BIT);
-	if (storage->config.use_rgba_3d_shadows) {
-		glClearColor(1.0, 1.0, 1.0, 1.0);
-		glClear(GL_COLOR_BUFFER_BIT);
+	if (p_clear_region) {
+		glEnable(GL_SCISSOR_TEST);
+		glClearDepth(1.0f);
+		glClear(GL_DEPTH_BUFFER_BIT);
+		if (storage->config.use_rgba_3d_shadows) {
+			glClearColor(1.0, 1.0, 1.0, 1.0);
+			glClear(GL_COLOR_BUFFER_BIT);
+		}
+		glDisable(GL_SCISSOR_TEST);
 	}
-	glDisable(GL_SCISSOR_TEST);
 
 	if (light->reverse_cull) {
 		flip_facing = !flip_facing;
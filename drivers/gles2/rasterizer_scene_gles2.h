@@ -63,6 +63,7 @@ public:
 	enum {
 		INSTANCE_ATTRIB_BASE = 8,
 		INSTANCE_BONE_BASE = 13,
+		MAX_UNIFORM_SKINNING_BONES = 64, // Must match the skeleton_bones array in scene.glsl (3 vec4 rows per bone).
 	};
 
 	ShadowFilterMode shadow_filter_mode;
@@ -756,7 +757,7 @@ public:
 	void _post_process(Environment *env, const CameraMatrix &p_cam_projection);
 
 	virtual void render_scene(const Transform &p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_ortogonal, InstanceBase **p_cull_result, int p_cull_count, RID *p_light_cull_result, int p_light_cull_count, RID *p_reflection_probe_cull_result, int p_reflection_probe_cull_count, RID p_environment, RID p_shadow_atlas, RID p_reflection_atlas, RID p_reflection_probe, int p_reflection_probe_pass);
-	virtual void render_shadow(RID p_light, RID p_shadow_atlas, int p_pass, InstanceBase **p_cull_result, int p_cull_count);
+	virtual void render_shadow(RID p_light, RID p_shadow_atlas, int p_pass, InstanceBase **p_cull_result, int p_cull_count, bool p_clear_region = true);
 	virtual bool free(RID p_rid);
 
 	virtual void set_scene_pass(uint64_t p_pass);
@@ -3249,6 +3249,32 @@ void RasterizerStorageGLES2::multimesh_set_as_bulk_array(RID p_multimesh, const
 	}
 }
 
+void RasterizerStorageGLES2::multimesh_set_buffer_region(RID p_multimesh, int p_instance_from, const PoolVector<float> &p_array) {
+	MultiMesh *multimesh = multimesh_owner.getornull(p_multimesh);
+	ERR_FAIL_COND(!multimesh);
+	ERR_FAIL_COND(!multimesh->data.ptr());
+
+	int stride = multimesh->color_floats + multimesh->xform_floats + multimesh->custom_data_floats;
+	int asize = p_array.size();
+
+	ERR_FAIL_COND(asize % stride != 0);
+
+	int instances = asize / stride;
+	ERR_FAIL_INDEX(p_instance_from, multimesh->size);
+	ERR_FAIL_COND(p_instance_from + instances > multimesh->size);
+
+	PoolVector<float>::Read r = p_array.read();
+	ERR_FAIL_COND(!r.ptr());
+	copymem(&multimesh->data.write[p_instance_from * stride], r.ptr(), asize * sizeof(float));
+
+	multimesh->dirty_data = true;
+	multimesh->dirty_aabb = true;
+
+	if (!multimesh->update_list.in_list()) {
+		multimesh_update_list.add(&multimesh->update_list);
+	}
+}
+
 void RasterizerStorageGLES2::multimesh_set_visible_instances(RID p_multimesh, int p_visible) {
 	MultiMesh *multimesh = multimesh_owner.getornull(p_multimesh);
 	ERR_FAIL_COND(!multimesh);
@@ -3470,6 +3496,79 @@ void RasterizerStorageGLES2::immediate_clear(RID p_immediate) {
 	im->instance_change_notify(true, false);
 }
 
+void RasterizerStorageGLES2::immediate_set_buffer(RID p_immediate, VS::PrimitiveType p_primitive, const PoolVector<Vector3> &p_vertices, const PoolVector<Vector3> &p_normals, const PoolVector<Plane> &p_tangents, const PoolVector<Color> &p_colors, const PoolVector<Vector2> &p_uvs, const PoolVector<Vector2> &p_uv2s, RID p_texture) {
+
+	ERR_FAIL_INDEX(p_primitive, (int)VS::PRIMITIVE_MAX);
+	Immediate *im = immediate_owner.get(p_immediate);
+	ERR_FAIL_COND(!im);
+	ERR_FAIL_COND(im->building);
+
+	int vertex_count = p_vertices.size();
+	ERR_FAIL_COND(p_normals.size() != 0 && p_normals.size() != vertex_count);
+	ERR_FAIL_COND(p_tangents.size() != 0 && p_tangents.size() != vertex_count);
+	ERR_FAIL_COND(p_colors.size() != 0 && p_colors.size() != vertex_count);
+	ERR_FAIL_COND(p_uvs.size() != 0 && p_uvs.size() != vertex_count);
+	ERR_FAIL_COND(p_uv2s.size() != 0 && p_uv2s.size() != vertex_count);
+
+	im->chunks.clear();
+	im->mask = 0;
+	im->aabb = AABB();
+
+	if (vertex_count) {
+
+		Immediate::Chunk ic;
+		ic.texture = p_texture;
+		ic.primitive = p_primitive;
+
+		{
+			PoolVector<Vector3>::Read r = p_vertices.read();
+			ic.vertices.resize(vertex_count);
+			copymem(ic.vertices.ptrw(), r.ptr(), sizeof(Vector3) * vertex_count);
+
+			im->aabb.position = r[0];
+			for (int i = 1; i < vertex_count; i++) {
+				im->aabb.expand_to(r[i]);
+			}
+		}
+		im->mask |= VS::ARRAY_FORMAT_VERTEX;
+
+		if (p_normals.size()) {
+			PoolVector<Vector3>::Read r = p_normals.read();
+			ic.normals.resize(vertex_count);
+			copymem(ic.normals.ptrw(), r.ptr(), sizeof(Vector3) * vertex_count);
+			im->mask |= VS::ARRAY_FORMAT_NORMAL;
+		}
+		if (p_tangents.size()) {
+			PoolVector<Plane>::Read r = p_tangents.read();
+			ic.tangents.resize(vertex_count);
+			copymem(ic.tangents.ptrw(), r.ptr(), sizeof(Plane) * vertex_count);
+			im->mask |= VS::ARRAY_FORMAT_TANGENT;
+		}
+		if (p_colors.size()) {
+			PoolVector<Color>::Read r = p_colors.read();
+			ic.colors.resize(vertex_count);
+			copymem(ic.colors.ptrw(), r.ptr(), sizeof(Color) * vertex_count);
+			im->mask |= VS::ARRAY_FORMAT_COLOR;
+		}
+		if (p_uvs.size()) {
+			PoolVector<Vector2>::Read r = p_uvs.read();
+			ic.uvs.resize(vertex_count);
+			copymem(ic.uvs.ptrw(), r.ptr(), sizeof(Vector2) * vertex_count);
+			im->mask |= VS::ARRAY_FORMAT_TEX_UV;
+		}
+		if (p_uv2s.size()) {
+			PoolVector<Vector2>::Read r = p_uv2s.read();
+			ic.uv2s.resize(vertex_count);
+			copymem(ic.uv2s.ptrw(), r.ptr(), sizeof(Vector2) * vertex_count);
+			im->mask |= VS::ARRAY_FORMAT_TEX_UV2;
+		}
+
+		im->chunks.push_back(ic);
+	}
+
+	im->instance_change_notify(true, false);
+}
+
 AABB RasterizerStorageGLES2::immediate_get_aabb(RID p_immediate) const {
 	Immediate *im = immediate_owner.get(p_immediate);
 	ERR_FAIL_COND_V(!im, AABB());
@@ -3577,6 +3676,42 @@ void RasterizerStorageGLES2::skeleton_bone_set_transform(RID p_skeleton, int p_b
 	}
 }
 
+void RasterizerStorageGLES2::skeleton_set_bone_transforms(RID p_skeleton, const Vector<Transform> &p_transforms) {
+	Skeleton *skeleton = skeleton_owner.getornull(p_skeleton);
+	ERR_FAIL_COND(!skeleton);
+
+	ERR_FAIL_COND(p_transforms.size() > skeleton->size);
+	ERR_FAIL_COND(skeleton->use_2d);
+
+	float *bone_data = skeleton->bone_data.ptrw();
+	const Transform *transforms = p_transforms.ptr();
+	int count = p_transforms.size();
+
+	for (int i = 0; i < count; i++) {
+		const Transform &t = transforms[i];
+		int base_offset = i * 4 * 3;
+
+		bone_data[base_offset + 0] = t.basis[0].x;
+		bone_data[base_offset + 1] = t.basis[0].y;
+		bone_data[base_offset + 2] = t.basis[0].z;
+		bone_data[base_offset + 3] = t.origin.x;
+
+		bone_data[base_offset + 4] = t.basis[1].x;
+		bone_data[base_offset + 5] = t.basis[1].y;
+		bone_data[base_offset + 6] = t.basis[1].z;
+		bone_data[base_offset + 7] = t.origin.y;
+
+		bone_data[base_offset + 8] = t.basis[2].x;
+		bone_data[base_offset + 9] = t.basis[2].y;
+		bone_data[base_offset + 10] = t.basis[2].z;
+		bone_data[base_offset + 11] = t.origin.z;
+	}
+
+	if (!skeleton->update_list.in_list()) {
+		skeleton_update_list.add(&skeleton->update_list);
+	}
+}
+
 Transform RasterizerStorageGLES2::skeleton_bone_get_transform(RID p_skeleton, int p_bone) const {
 	Skeleton *skeleton = skeleton_owner.getornull(p_skeleton);
 	ERR_FAIL_COND_V(!skeleton, Transform());
@@ -5972,6 +6107,17 @@ void RasterizerStorageGLES2::initialize() {
 	// OR max_vertex_texture_image_units is zero
 	config.use_skeleton_software = (config.float_texture_supported == false) || (config.max_vertex_texture_image_units == 0);
 
+#ifdef GL_MAX_VERTEX_UNIFORM_VECTORS
+	glGetIntegerv(GL_MAX_VERTEX_UNIFORM_VECTORS, &config.max_vertex_uniform_vectors);
+#else
+	// Desktop GL has no *_VECTORS query, the component count is equivalent.
+	glGetIntegerv(GL_MAX_VERTEX_UNIFORM_COMPONENTS, &config.max_vertex_uniform_vectors);
+	config.max_vertex_uniform_vectors /= 4;
+#endif
+	// The uniform skinning path needs 192 vectors for the pose plus the
+	// regular vertex uniforms, so require a decent limit before using it.
+	config.use_skeleton_uniforms = config.use_skeleton_software && config.max_vertex_uniform_vectors >= 256;
+
 	shaders.copy.init();
 	shaders.cubemap_filter.init();
 	bool ggx_hq = GLOBAL_GET("rendering/quality/reflections/high_quality_ggx");
@@ -61,6 +61,11 @@ public:
 		bool shrink_textures_x2;
 		bool use_fast_texture_filter;
 		bool use_skeleton_software;
+		// Attribute-based GPU skinning with the pose in uniform registers;
+		// used instead of CPU skinning when the skeleton fits (see
+		// MAX_UNIFORM_SKINNING_BONES) and enough uniform vectors exist.
+		bool use_skeleton_uniforms;
+		int max_vertex_uniform_vectors;
 
 		int max_vertex_texture_image_units;
 		int max_texture_image_units;
@@ -798,6 +803,7 @@ public:
 	virtual Color multimesh_instance_get_custom_data(RID p_multimesh, int p_index) const;
 
 	virtual void multimesh_set_as_bulk_array(RID p_multimesh, const PoolVector<float> &p_array);
+	virtual void multimesh_set_buffer_region(RID p_multimesh, int p_instance_from, const PoolVector<float> &p_array);
 
 	virtual void multimesh_set_visible_instances(RID p_multimesh, int p_visible);
 	virtual int multimesh_get_visible_instances(RID p_multimesh) const;
@@ -850,6 +856,7 @@ public:
 	virtual void immediate_uv2(RID p_immediate, const Vector2 &tex_uv);
 	virtual void immediate_end(RID p_immediate);
 	virtual void immediate_clear(RID p_immediate);
+	virtual void immediate_set_buffer(RID p_immediate, VS::PrimitiveType p_primitive, const PoolVector<Vector3> &p_vertices, const PoolVector<Vector3> &p_normals, const PoolVector<Plane> &p_tangents, const PoolVector<Color> &p_colors, const PoolVector<Vector2> &p_uvs, const PoolVector<Vector2> &p_uv2s, RID p_texture = RID());
 	virtual void immediate_set_material(RID p_immediate, RID p_material);
 	virtual RID immediate_get_material(RID p_immediate) const;
 	virtual AABB immediate_get_aabb(RID p_immediate) const;
@@ -891,6 +898,7 @@ public:
 	virtual void skeleton_allocate(RID p_skeleton, int p_bones, bool p_2d_skeleton = false);
 	virtual int skeleton_get_bone_count(RID p_skeleton) const;
 	virtual void skeleton_bone_set_transform(RID p_skeleton, int p_bone, const Transform &p_transform);
+	virtual void skeleton_set_bone_transforms(RID p_skeleton, const Vector<Transform> &p_transforms);
 	virtual Transform skeleton_bone_get_transform(RID p_skeleton, int p_bone) const;
 	virtual void skeleton_bone_set_transform_2d(RID p_skeleton, int p_bone, const Transform2D &p_transform);
 	virtual Transform2D skeleton_bone_get_transform_2d(RID p_skeleton, int p_bone) const;
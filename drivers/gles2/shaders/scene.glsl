@@ -56,6 +56,14 @@ attribute highp vec4 bone_transform_row_2; // attrib:15
 attribute vec4 bone_ids; // attrib:6
 attribute highp vec4 bone_weights; // attrib:7
 
+#ifdef USE_SKELETON_UNIFORMS
+
+// 3 vec4 rows per bone; 64 bones keep this within the common 256 vector
+// limit with room left for the regular vertex uniforms
+uniform highp vec4 skeleton_bones[192];
+
+#else
+
 uniform highp sampler2D bone_transforms; // texunit:-1
 uniform ivec2 skeleton_texture_size;
 
@@ -63,6 +71,8 @@ uniform ivec2 skeleton_texture_size;
 
 #endif
 
+#endif
+
 #ifdef USE_INSTANCING
 
 attribute highp vec4 instance_xform_row_0; // attrib:8
@@ -385,6 +395,23 @@ void main() {
 	bone_transform[2] = vec4(bone_transform_row_0.z, bone_transform_row_1.z, bone_transform_row_2.z, 0.0);
 	bone_transform[3] = vec4(bone_transform_row_0.w, bone_transform_row_1.w, bone_transform_row_2.w, 1.0);
 
+#elif defined(USE_SKELETON_UNIFORMS)
+	// bone pose lives in uniform registers
+	{
+
+		for (int i = 0; i < 4; i++) {
+			int bone_ofs = int(bone_ids[i]) * 3;
+
+			highp mat4 b = mat4(
+					skeleton_bones[bone_ofs + 0],
+					skeleton_bones[bone_ofs + 1],
+					skeleton_bones[bone_ofs + 2],
+					vec4(0.0, 0.0, 0.0, 1.0));
+
+			bone_transform += transpose(b) * bone_weights[i];
+		}
+	}
+
 #else
 	// look up transform from the "pose texture"
 	{
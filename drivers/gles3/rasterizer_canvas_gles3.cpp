@@ -142,6 +142,53 @@ void RasterizerCanvasGLES3::light_internal_free(RID p_rid) {
 	memdelete(li);
 }
 
+void RasterizerCanvasGLES3::_multi_light_upload(Light *p_light_list) {
+
+	state.multi_light_list = p_light_list;
+	state.multi_light_count = 0;
+
+	Light *light = p_light_list;
+	while (light) {
+
+		//only additive lights can be collapsed into a single pass, the other
+		//modes need their own blend state
+		if (state.multi_light_count < MULTI_LIGHT_MAX && light->mode == VS::CANVAS_LIGHT_MODE_ADD) {
+
+			MultiLightUBO &ld = state.multi_light_data[state.multi_light_count];
+
+			store_transform2d(light->light_shader_xform, ld.light_matrix);
+			store_transform2d(light->xform_cache.affine_inverse(), ld.local_matrix);
+
+			Transform2D inv = light->light_shader_xform.affine_inverse();
+			Vector2 x = inv.elements[0].normalized();
+			Vector2 y = inv.elements[1].normalized();
+			ld.rot[0] = x.x;
+			ld.rot[1] = x.y;
+			ld.rot[2] = y.x;
+			ld.rot[3] = y.y;
+
+			for (int i = 0; i < 4; i++) {
+				ld.color[i] = light->color[i] * light->energy;
+				ld.height[i] = 0;
+			}
+			ld.height[0] = light->height;
+
+			light->batch_index = state.multi_light_count;
+			state.multi_light_count++;
+		} else {
+			light->batch_index = -1;
+		}
+
+		light = light->next_ptr;
+	}
+
+	if (state.multi_light_count) {
+		glBindBuffer(GL_UNIFORM_BUFFER, state.multi_light_ubo);
+		glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(MultiLightUBO) * state.multi_light_count, state.multi_light_data);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	}
+}
+
 void RasterizerCanvasGLES3::canvas_begin() {
 
 	if (storage->frame.current_rt && storage->frame.clear_request) {
@@ -204,6 +251,7 @@ void RasterizerCanvasGLES3::canvas_end() {
 
 	state.using_texture_rect = false;
 	state.using_ninepatch = false;
+	state.multi_light_list = NULL;
 }
 
 RasterizerStorageGLES3::Texture *RasterizerCanvasGLES3::_bind_canvas_texture(const RID &p_texture, const RID &p_normal_map, bool p_force) {
@@ -621,6 +669,98 @@ static const GLenum gl_primitive[] = {
 	GL_TRIANGLE_FAN
 };
 
+bool RasterizerCanvasGLES3::_rect_is_batchable(const Item::CommandRect *p_rect) const {
+
+	//tiled rects need the wrap mode changed and UV-clipped rects need the
+	//src_rect uniform, both of which the generic vertex path can't express;
+	//normal mapped rects rely on the rect mode flip handling in the shader
+
+	return !(p_rect->flags & (CANVAS_RECT_TILE | CANVAS_RECT_CLIP_UV)) && p_rect->normal_map == RID();
+}
+
+int RasterizerCanvasGLES3::_try_batch_rects(Item::Command **p_commands, int p_count, int p_current) {
+
+	//merge a run of consecutive rects sharing the same texture into a single
+	//vertex buffer draw; modulate goes into the per-vertex color so it may
+	//differ between rects. Returns the amount of commands consumed (0 if the
+	//run is too short to be worth it and the caller should draw normally).
+
+	if (data.batch_max_rects < 2)
+		return 0;
+
+	Item::CommandRect *first = static_cast<Item::CommandRect *>(p_commands[p_current]);
+
+	if (!_rect_is_batchable(first))
+		return 0;
+
+	int run = 1;
+	while (p_current + run < p_count && run < data.batch_max_rects) {
+
+		Item::Command *nc = p_commands[p_current + run];
+		if (nc->type != Item::Command::TYPE_RECT)
+			break;
+
+		Item::CommandRect *nr = static_cast<Item::CommandRect *>(nc);
+		if (nr->texture != first->texture || !_rect_is_batchable(nr))
+			break;
+
+		run++;
+	}
+
+	if (run < 2)
+		return 0;
+
+	_set_texture_rect_mode(false);
+
+	RasterizerStorageGLES3::Texture *texture = _bind_canvas_texture(first->texture, RID());
+
+	Size2 texpixel_size(1, 1);
+	if (texture) {
+		texpixel_size = Size2(1.0 / texture->width, 1.0 / texture->height);
+		state.canvas_shader.set_uniform(CanvasShaderGLES3::COLOR_TEXPIXEL_SIZE, texpixel_size);
+	}
+
+	static const Vector2 corners[4] = { Vector2(0, 0), Vector2(1, 0), Vector2(1, 1), Vector2(0, 1) };
+	static const int triangles[6] = { 0, 1, 2, 0, 2, 3 };
+
+	int vertex_count = 0;
+
+	for (int j = 0; j < run; j++) {
+
+		Item::CommandRect *rect = static_cast<Item::CommandRect *>(p_commands[p_current + j]);
+
+		Rect2 src_rect = (rect->flags & CANVAS_RECT_REGION) ? Rect2(rect->source.position * texpixel_size, rect->source.size * texpixel_size) : Rect2(0, 0, 1, 1);
+		Rect2 dst_rect = Rect2(rect->rect.position, rect->rect.size);
+
+		if (dst_rect.size.width < 0) {
+			dst_rect.position.x += dst_rect.size.width;
+			dst_rect.size.width *= -1;
+		}
+		if (dst_rect.size.height < 0) {
+			dst_rect.position.y += dst_rect.size.height;
+			dst_rect.size.height *= -1;
+		}
+
+		bool flip_h = rect->flags & CANVAS_RECT_FLIP_H;
+		bool flip_v = rect->flags & CANVAS_RECT_FLIP_V;
+		bool transpose = rect->flags & CANVAS_RECT_TRANSPOSE;
+
+		for (int k = 0; k < 6; k++) {
+
+			Vector2 corner = corners[triangles[k]];
+
+			data.batch_vertices[vertex_count] = dst_rect.position + dst_rect.size * Vector2(flip_h ? 1.0 - corner.x : corner.x, flip_v ? 1.0 - corner.y : corner.y);
+			data.batch_uvs[vertex_count] = src_rect.position + src_rect.size * (transpose ? Vector2(corner.y, corner.x) : corner);
+			data.batch_colors[vertex_count] = rect->modulate;
+			vertex_count++;
+		}
+	}
+
+	_draw_generic(GL_TRIANGLES, vertex_count, data.batch_vertices, texture ? data.batch_uvs : NULL, data.batch_colors, false);
+
+	return run;
+}
+
 void RasterizerCanvasGLES3::_canvas_item_render_commands(Item *p_item, Item *current_clip, bool &reclip) {
 
 	int cc = p_item->commands.size();
@@ -741,6 +881,12 @@ void RasterizerCanvasGLES3::_canvas_item_render_commands(Item *p_item, Item *cur
 
 				Item::CommandRect *rect = static_cast<Item::CommandRect *>(c);
 
+				int batched = _try_batch_rects(commands, cc, i);
+				if (batched > 0) {
+					i += batched - 1;
+					break;
+				}
+
 				_set_texture_rect_mode(true);
 
 				//set color
@@ -1332,6 +1478,20 @@ void RasterizerCanvasGLES3::_copy_texscreen(const Rect2 &p_rect) {
 	glEnable(GL_BLEND);
 }
 
+void RasterizerCanvasGLES3::_update_canvas_item_ubo() {
+
+	if (state.canvas_item_ubo_uploaded && memcmp(&state.canvas_item_ubo_prev, &state.canvas_item_ubo_data, sizeof(CanvasItemUBO)) == 0) {
+		return; //driver already has these values
+	}
+
+	glBindBuffer(GL_UNIFORM_BUFFER, state.canvas_item_ubo);
+	glBufferData(GL_UNIFORM_BUFFER, sizeof(CanvasItemUBO), &state.canvas_item_ubo_data, GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+	state.canvas_item_ubo_prev = state.canvas_item_ubo_data;
+	state.canvas_item_ubo_uploaded = true;
+}
+
 void RasterizerCanvasGLES3::canvas_render_items(Item *p_item_list, int p_z, const Color &p_modulate, Light *p_light, const Transform2D &p_transform) {
 
 	Item *current_clip = NULL;
@@ -1339,9 +1499,11 @@ void RasterizerCanvasGLES3::canvas_render_items(Item *p_item_list, int p_z, cons
 
 	bool rebind_shader = true;
 
-	glBindBuffer(GL_UNIFORM_BUFFER, state.canvas_item_ubo);
-	glBufferData(GL_UNIFORM_BUFFER, sizeof(CanvasItemUBO), &state.canvas_item_ubo_data, GL_DYNAMIC_DRAW);
-	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	_update_canvas_item_ubo();
+
+	if (p_light != state.multi_light_list) {
+		_multi_light_upload(p_light); //same list for every z range of a canvas, uploaded once
+	}
 
 	state.current_tex = RID();
 	state.current_tex_ptr = NULL;
@@ -1628,17 +1790,101 @@ void RasterizerCanvasGLES3::canvas_render_items(Item *p_item_list, int p_z, cons
 
 			Light *light = p_light;
 			bool light_used = false;
+			bool batch_used = false;
 			VS::CanvasLightMode mode = VS::CANVAS_LIGHT_MODE_ADD;
 			state.canvas_item_modulate = ci->final_modulate; // remove the canvas modulate
 
+			Light *batch_lights[MULTI_LIGHT_MAX];
+			int batch_light_count = 0;
+
+			if (state.multi_light_count > 0 && (!shader_cache || !shader_cache->canvas_item.uses_custom_light)) {
+				//gather the additive lights this item can take in a shared pass: no shadow
+				//to sample and no custom light function to run per light
+				while (light) {
+
+					if (light->batch_index >= 0 && !(light->shadow_buffer.is_valid() && ci->light_mask & light->item_shadow_mask) && ci->light_mask & light->item_mask && p_z >= light->z_min && p_z <= light->z_max && ci->global_rect_cache.intersects_transformed(light->xform_cache, light->rect_cache)) {
+						batch_lights[batch_light_count++] = light;
+					}
+					light = light->next_ptr;
+				}
+
+				light = p_light;
+			}
+
+			if (batch_light_count >= 2) {
+				//a single light is just as fast on the regular path
+
+				for (int j = 0; j < batch_light_count; j++) {
+					batch_lights[j]->multi_batched = true;
+				}
+
+				glBlendEquation(GL_FUNC_ADD);
+				glBlendFunc(GL_ONE, GL_ONE); //the multi-light shader premultiplies
+
+				state.canvas_shader.set_conditional(CanvasShaderGLES3::USE_MULTI_LIGHT, true);
+
+				glBindBufferBase(GL_UNIFORM_BUFFER, 3, state.multi_light_ubo);
+
+				for (int j = 0; j < batch_light_count; j += MULTI_LIGHTS_PER_PASS) {
+
+					int pass_count = MIN(batch_light_count - j, (int)MULTI_LIGHTS_PER_PASS);
+
+					Color pass_indices;
+					for (int k = 0; k < pass_count; k++) {
+
+						Light *l = batch_lights[j + k];
+						pass_indices[k] = l->batch_index;
+
+						glActiveTexture(GL_TEXTURE0 + storage->config.max_texture_image_units - 5 - k);
+						RasterizerStorageGLES3::Texture *t = storage->texture_owner.getornull(l->texture);
+						if (!t) {
+							glBindTexture(GL_TEXTURE_2D, storage->resources.white_tex);
+						} else {
+							t = t->get_ptr();
+
+							glBindTexture(t->target, t->tex_id);
+						}
+					}
+
+					bool multi_rebind = state.canvas_shader.bind();
+
+					if (multi_rebind) {
+						state.canvas_shader.set_uniform(CanvasShaderGLES3::FINAL_MODULATE, state.canvas_item_modulate);
+						state.canvas_shader.set_uniform(CanvasShaderGLES3::MODELVIEW_MATRIX, state.final_transform);
+						state.canvas_shader.set_uniform(CanvasShaderGLES3::EXTRA_MATRIX, Transform2D());
+						if (storage->frame.current_rt) {
+							state.canvas_shader.set_uniform(CanvasShaderGLES3::SCREEN_PIXEL_SIZE, Vector2(1.0 / storage->frame.current_rt->width, 1.0 / storage->frame.current_rt->height));
+						} else {
+							state.canvas_shader.set_uniform(CanvasShaderGLES3::SCREEN_PIXEL_SIZE, Vector2(1.0, 1.0));
+						}
+						if (state.using_skeleton) {
+							state.canvas_shader.set_uniform(CanvasShaderGLES3::SKELETON_TRANSFORM, state.skeleton_transform);
+							state.canvas_shader.set_uniform(CanvasShaderGLES3::SKELETON_TRANSFORM_INVERSE, state.skeleton_transform_inverse);
+						}
+					}
+
+					state.canvas_shader.set_uniform(CanvasShaderGLES3::MULTI_LIGHT_INDICES, pass_indices);
+					state.canvas_shader.set_uniform(CanvasShaderGLES3::MULTI_LIGHT_COUNT, pass_count);
+
+					glActiveTexture(GL_TEXTURE0);
+					_canvas_item_render_commands(ci, current_clip, reclip); //redraw with the whole light group at once
+				}
+
+				state.canvas_shader.set_conditional(CanvasShaderGLES3::USE_MULTI_LIGHT, false);
+				batch_used = true;
+			}
+
+			bool batch_blend = batch_used; //the batch pass leaves its own blend state behind
+
 			while (light) {
 
-				if (ci->light_mask & light->item_mask && p_z >= light->z_min && p_z <= light->z_max && ci->global_rect_cache.intersects_transformed(light->xform_cache, light->rect_cache)) {
+				if (!light->multi_batched && ci->light_mask & light->item_mask && p_z >= light->z_min && p_z <= light->z_max && ci->global_rect_cache.intersects_transformed(light->xform_cache, light->rect_cache)) {
 
 					//intersects this light
 
-					if (!light_used || mode != light->mode) {
+					if (!light_used || batch_blend || mode != light->mode) {
 
+						batch_blend = false; //blend state no longer the batch pass one
 						mode = light->mode;
 
 						switch (mode) {
@@ -1727,7 +1973,11 @@ void RasterizerCanvasGLES3::canvas_render_items(Item *p_item_list, int p_z, cons
 				light = light->next_ptr;
 			}
 
-			if (light_used) {
+			for (int j = 0; j < batch_light_count; j++) {
+				batch_lights[j]->multi_batched = false;
+			}
+
+			if (light_used || batch_used) {
 
 				state.canvas_shader.set_conditional(CanvasShaderGLES3::USE_LIGHTING, false);
 				state.canvas_shader.set_conditional(CanvasShaderGLES3::USE_SHADOWS, false);
@@ -1821,6 +2071,143 @@ void RasterizerCanvasGLES3::canvas_debug_viewport_shadows(Light *p_lights_with_s
 	canvas_end();
 }
 
+bool RasterizerCanvasGLES3::_update_occluder_batch(LightOccluderInstance *p_occluders) {
+
+	//validate the cached batch against the current occluder list; every light
+	//in a frame receives the same list, so after the first light this is a
+	//cheap walk and the merged buffer is reused as-is
+
+	bool dirty = false;
+	int count = 0;
+
+	for (LightOccluderInstance *instance = p_occluders; instance; instance = instance->next) {
+
+		RasterizerStorageGLES3::CanvasOccluder *cc = storage->canvas_occluder_owner.getornull(instance->polygon_buffer);
+		if (!cc || cc->len == 0) {
+			continue;
+		}
+
+		if (!dirty) {
+			if (count >= occluder_batch.size()) {
+				dirty = true;
+			} else {
+				const OccluderBatchEntry &e = occluder_batch[count];
+				if (e.polygon_buffer != instance->polygon_buffer || e.version != cc->version || e.xform != instance->xform_cache || e.light_mask != instance->light_mask || e.cull_cache != instance->cull_cache) {
+					dirty = true;
+				}
+			}
+		}
+
+		count++;
+	}
+
+	if (count != occluder_batch.size()) {
+		dirty = true;
+	}
+
+	if (!dirty) {
+		return occluder_batch.size() > 0;
+	}
+
+	occluder_batch.clear();
+
+	if (count == 0) {
+		return false;
+	}
+
+	Vector<float> vertices;
+	Vector<uint32_t> indices;
+
+	const int POLY_HEIGHT = 16384;
+
+	for (LightOccluderInstance *instance = p_occluders; instance; instance = instance->next) {
+
+		RasterizerStorageGLES3::CanvasOccluder *cc = storage->canvas_occluder_owner.getornull(instance->polygon_buffer);
+		if (!cc || cc->len == 0) {
+			continue;
+		}
+
+		int lc = cc->lines.size();
+
+		OccluderBatchEntry e;
+		e.polygon_buffer = instance->polygon_buffer;
+		e.version = cc->version;
+		e.xform = instance->xform_cache;
+		e.light_mask = instance->light_mask;
+		e.cull_cache = instance->cull_cache;
+		e.flip = instance->xform_cache.basis_determinant() < 0;
+		e.index_offset = indices.size();
+		e.index_count = cc->len * 3;
+
+		uint32_t base = vertices.size() / 3;
+		vertices.resize(vertices.size() + lc * 6);
+		indices.resize(indices.size() + lc * 3);
+
+		float *vw = vertices.ptrw() + base * 3;
+		uint32_t *iw = indices.ptrw() + e.index_offset;
+
+		PoolVector<Vector2>::Read lr = cc->lines.read();
+
+		//same layout canvas_light_occluder_set_polylines generates, but
+		//pre-transformed into world space so the whole batch draws with an
+		//identity world matrix
+		for (int i = 0; i < lc / 2; i++) {
+
+			Vector2 a = e.xform.xform(lr[i * 2 + 0]);
+			Vector2 b = e.xform.xform(lr[i * 2 + 1]);
+
+			vw[i * 12 + 0] = a.x;
+			vw[i * 12 + 1] = a.y;
+			vw[i * 12 + 2] = POLY_HEIGHT;
+
+			vw[i * 12 + 3] = b.x;
+			vw[i * 12 + 4] = b.y;
+			vw[i * 12 + 5] = POLY_HEIGHT;
+
+			vw[i * 12 + 6] = b.x;
+			vw[i * 12 + 7] = b.y;
+			vw[i * 12 + 8] = -POLY_HEIGHT;
+
+			vw[i * 12 + 9] = a.x;
+			vw[i * 12 + 10] = a.y;
+			vw[i * 12 + 11] = -POLY_HEIGHT;
+
+			iw[i * 6 + 0] = base + i * 4 + 0;
+			iw[i * 6 + 1] = base + i * 4 + 1;
+			iw[i * 6 + 2] = base + i * 4 + 2;
+
+			iw[i * 6 + 3] = base + i * 4 + 2;
+			iw[i * 6 + 4] = base + i * 4 + 3;
+			iw[i * 6 + 5] = base + i * 4 + 0;
+		}
+
+		occluder_batch.push_back(e);
+	}
+
+	uint32_t vertex_bytes = vertices.size() * sizeof(float);
+	uint32_t index_bytes = indices.size() * sizeof(uint32_t);
+
+	glBindBuffer(GL_ARRAY_BUFFER, data.occluder_batch_vertex);
+	if (vertex_bytes > data.occluder_batch_vertex_size) {
+		glBufferData(GL_ARRAY_BUFFER, vertex_bytes, vertices.ptr(), GL_DYNAMIC_DRAW);
+		data.occluder_batch_vertex_size = vertex_bytes;
+	} else {
+		glBufferSubData(GL_ARRAY_BUFFER, 0, vertex_bytes, vertices.ptr());
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, data.occluder_batch_index);
+	if (index_bytes > data.occluder_batch_index_size) {
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, index_bytes, indices.ptr(), GL_DYNAMIC_DRAW);
+		data.occluder_batch_index_size = index_bytes;
+	} else {
+		glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, index_bytes, indices.ptr());
+	}
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+	return true;
+}
+
 void RasterizerCanvasGLES3::canvas_light_shadow_buffer_update(RID p_buffer, const Transform2D &p_light_xform, int p_light_mask, float p_near, float p_far, LightOccluderInstance *p_occluders, CameraMatrix *p_xform_cache) {
 
 	RasterizerStorageGLES3::CanvasLightShadow *cls = storage->canvas_light_shadow_owner.get(p_buffer);
@@ -1836,8 +2223,15 @@ void RasterizerCanvasGLES3::canvas_light_shadow_buffer_update(RID p_buffer, cons
 
 	glBindFramebuffer(GL_FRAMEBUFFER, cls->fbo);
 
+	const bool batched = _update_occluder_batch(p_occluders);
+
 	state.canvas_shadow_shader.bind();
 
+	if (batched) {
+		//batch vertices are pre-transformed into world space
+		state.canvas_shadow_shader.set_uniform(CanvasShadowShaderGLES3::WORLD_MATRIX, Transform2D());
+	}
+
 	glViewport(0, 0, cls->size, cls->height);
 	glClearDepth(1.0f);
 	glClearColor(1, 1, 1, 1);
@@ -1887,6 +2281,88 @@ void RasterizerCanvasGLES3::canvas_light_shadow_buffer_update(RID p_buffer, cons
 
 		glViewport(0, (cls->height / 4) * i, cls->size, cls->height / 4);
 
+		if (batched) {
+
+			glBindVertexArray(data.occluder_batch_array);
+
+			const bool light_flip = p_light_xform.basis_determinant() < 0;
+
+			int e = 0;
+			while (e < occluder_batch.size()) {
+
+				const OccluderBatchEntry &entry = occluder_batch[e];
+
+				if (!(p_light_mask & entry.light_mask)) {
+					e++;
+					continue;
+				}
+
+				VS::CanvasOccluderPolygonCullMode transformed_cull_cache = entry.cull_cache;
+
+				if (transformed_cull_cache != VS::CANVAS_OCCLUDER_POLYGON_CULL_DISABLED && light_flip != entry.flip) {
+					transformed_cull_cache =
+							transformed_cull_cache == VS::CANVAS_OCCLUDER_POLYGON_CULL_CLOCKWISE ?
+									VS::CANVAS_OCCLUDER_POLYGON_CULL_COUNTER_CLOCKWISE :
+									VS::CANVAS_OCCLUDER_POLYGON_CULL_CLOCKWISE;
+				}
+
+				//coalesce every following entry drawn with the same cull state
+				//into a single draw; index ranges are contiguous by construction
+				int index_offset = entry.index_offset;
+				int index_count = entry.index_count;
+				e++;
+
+				while (e < occluder_batch.size()) {
+
+					const OccluderBatchEntry &next = occluder_batch[e];
+					if (!(p_light_mask & next.light_mask) || next.index_offset != index_offset + index_count) {
+						break;
+					}
+
+					VS::CanvasOccluderPolygonCullMode next_cull = next.cull_cache;
+					if (next_cull != VS::CANVAS_OCCLUDER_POLYGON_CULL_DISABLED && light_flip != next.flip) {
+						next_cull = next_cull == VS::CANVAS_OCCLUDER_POLYGON_CULL_CLOCKWISE ?
+											VS::CANVAS_OCCLUDER_POLYGON_CULL_COUNTER_CLOCKWISE :
+											VS::CANVAS_OCCLUDER_POLYGON_CULL_CLOCKWISE;
+					}
+
+					if (next_cull != transformed_cull_cache) {
+						break;
+					}
+
+					index_count += next.index_count;
+					e++;
+				}
+
+				if (cull != transformed_cull_cache) {
+
+					cull = transformed_cull_cache;
+					switch (cull) {
+						case VS::CANVAS_OCCLUDER_POLYGON_CULL_DISABLED: {
+
+							glDisable(GL_CULL_FACE);
+
+						} break;
+						case VS::CANVAS_OCCLUDER_POLYGON_CULL_CLOCKWISE: {
+
+							glEnable(GL_CULL_FACE);
+							glCullFace(GL_FRONT);
+						} break;
+						case VS::CANVAS_OCCLUDER_POLYGON_CULL_COUNTER_CLOCKWISE: {
+
+							glEnable(GL_CULL_FACE);
+							glCullFace(GL_BACK);
+
+						} break;
+					}
+				}
+
+				glDrawElements(GL_TRIANGLES, index_count, GL_UNSIGNED_INT, CAST_INT_TO_UCHAR_PTR(index_offset * sizeof(uint32_t)));
+			}
+
+			continue;
+		}
+
 		LightOccluderInstance *instance = p_occluders;
 
 		while (instance) {
@@ -1998,9 +2474,7 @@ void RasterizerCanvasGLES3::reset_canvas() {
 	store_transform(canvas_transform, state.canvas_item_ubo_data.projection_matrix);
 	state.canvas_item_ubo_data.time = storage->frame.time[0];
 
-	glBindBuffer(GL_UNIFORM_BUFFER, state.canvas_item_ubo);
-	glBufferData(GL_UNIFORM_BUFFER, sizeof(CanvasItemUBO), &state.canvas_item_ubo_data, GL_DYNAMIC_DRAW);
-	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	_update_canvas_item_ubo();
 
 	state.canvas_texscreen_used = false;
 }
@@ -2136,6 +2610,24 @@ void RasterizerCanvasGLES3::initialize() {
 		glBindVertexArray(0);
 		glBindBuffer(GL_ARRAY_BUFFER, 0); //unbind
 	}
+	{
+		//merged occluder batch buffers, filled on demand by _update_occluder_batch
+
+		glGenBuffers(1, &data.occluder_batch_vertex);
+		glGenBuffers(1, &data.occluder_batch_index);
+		data.occluder_batch_vertex_size = 0;
+		data.occluder_batch_index_size = 0;
+
+		glGenVertexArrays(1, &data.occluder_batch_array);
+		glBindVertexArray(data.occluder_batch_array);
+		glBindBuffer(GL_ARRAY_BUFFER, data.occluder_batch_vertex);
+		glEnableVertexAttribArray(VS::ARRAY_VERTEX);
+		glVertexAttribPointer(VS::ARRAY_VERTEX, 3, GL_FLOAT, false, 0, 0);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, data.occluder_batch_index);
+		glBindVertexArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0); //unbind
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0); //unbind
+	}
 	{
 		//particle quad buffers
 
@@ -2228,15 +2720,44 @@ void RasterizerCanvasGLES3::initialize() {
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
 		data.polygon_index_buffer_size = index_size;
+
+		uint32_t batch_size = GLOBAL_DEF_RST("rendering/limits/buffers/canvas_batch_buffer_size_kb", 128);
+		ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/buffers/canvas_batch_buffer_size_kb", PropertyInfo(Variant::INT, "rendering/limits/buffers/canvas_batch_buffer_size_kb", PROPERTY_HINT_RANGE, "0,256,1,or_greater"));
+		batch_size *= 1024; //kb
+
+		//6 vertices per rect, the batch must also fit in the polygon buffer it is drawn from
+		uint32_t bytes_per_rect = 6 * (sizeof(Vector2) * 2 + sizeof(Color));
+		data.batch_max_rects = MIN(batch_size, data.polygon_buffer_size) / bytes_per_rect;
+
+		if (data.batch_max_rects >= 2) {
+			data.batch_vertices = memnew_arr(Vector2, data.batch_max_rects * 6);
+			data.batch_uvs = memnew_arr(Vector2, data.batch_max_rects * 6);
+			data.batch_colors = memnew_arr(Color, data.batch_max_rects * 6);
+		} else {
+			data.batch_max_rects = 0; //disabled
+			data.batch_vertices = NULL;
+			data.batch_uvs = NULL;
+			data.batch_colors = NULL;
+		}
 	}
 
+	memset(&state.canvas_item_ubo_data, 0, sizeof(CanvasItemUBO)); //also zeroes padding, so memcmp on it is meaningful
 	store_transform(Transform(), state.canvas_item_ubo_data.projection_matrix);
+	state.canvas_item_ubo_uploaded = false;
 
 	glGenBuffers(1, &state.canvas_item_ubo);
 	glBindBuffer(GL_UNIFORM_BUFFER, state.canvas_item_ubo);
 	glBufferData(GL_UNIFORM_BUFFER, sizeof(CanvasItemUBO), &state.canvas_item_ubo_data, GL_DYNAMIC_DRAW);
 	glBindBuffer(GL_UNIFORM_BUFFER, 0);
 
+	glGenBuffers(1, &state.multi_light_ubo);
+	glBindBuffer(GL_UNIFORM_BUFFER, state.multi_light_ubo);
+	glBufferData(GL_UNIFORM_BUFFER, sizeof(MultiLightUBO) * MULTI_LIGHT_MAX, NULL, GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+	state.multi_light_count = 0;
+	state.multi_light_list = NULL;
+
 	state.canvas_shader.init();
 	state.canvas_shader.set_base_material_tex_index(2);
 	state.canvas_shadow_shader.init();
@@ -2257,6 +2778,12 @@ void RasterizerCanvasGLES3::finalize() {
 	glDeleteVertexArrays(1, &data.canvas_quad_array);
 
 	glDeleteVertexArrays(1, &data.polygon_buffer_pointer_array);
+
+	if (data.batch_vertices) {
+		memdelete_arr(data.batch_vertices);
+		memdelete_arr(data.batch_uvs);
+		memdelete_arr(data.batch_colors);
+	}
 }
 
 RasterizerCanvasGLES3::RasterizerCanvasGLES3() {
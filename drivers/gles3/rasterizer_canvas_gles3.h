@@ -48,6 +48,20 @@ public:
 		uint8_t padding[12];
 	};
 
+	enum {
+		MULTI_LIGHT_MAX = 16, //lights uploaded per canvas, must match MAX_MULTI_LIGHTS in canvas.glsl
+		MULTI_LIGHTS_PER_PASS = 4, //lights shaded per draw, one texture unit each
+	};
+
+	struct MultiLightUBO { //must match the MultiLight struct in canvas.glsl (std140)
+
+		float light_matrix[16];
+		float local_matrix[16];
+		float color[4];
+		float rot[4]; //normalized inverse rotation, x basis in xy, y basis in zw
+		float height[4]; //x used, rest padding
+	};
+
 	RasterizerSceneGLES3 *scene_render;
 
 	struct Data {
@@ -66,10 +80,26 @@ public:
 		uint32_t polygon_buffer_size;
 		uint32_t polygon_index_buffer_size;
 
+		//scratch arrays for rect batching (see _try_batch_rects)
+		Vector2 *batch_vertices;
+		Vector2 *batch_uvs;
+		Color *batch_colors;
+		int batch_max_rects;
+
+		//merged world-space occluder geometry, shared by every light's
+		//shadow pass and rebuilt only when an occluder changes
+		GLuint occluder_batch_vertex;
+		GLuint occluder_batch_index;
+		GLuint occluder_batch_array;
+		uint32_t occluder_batch_vertex_size;
+		uint32_t occluder_batch_index_size;
+
 	} data;
 
 	struct State {
 		CanvasItemUBO canvas_item_ubo_data;
+		CanvasItemUBO canvas_item_ubo_prev; //last contents uploaded to the driver
+		bool canvas_item_ubo_uploaded;
 		GLuint canvas_item_ubo;
 		bool canvas_texscreen_used;
 		CanvasShaderGLES3 canvas_shader;
@@ -92,6 +122,11 @@ public:
 		Transform2D skeleton_transform;
 		Transform2D skeleton_transform_inverse;
 
+		GLuint multi_light_ubo;
+		MultiLightUBO multi_light_data[MULTI_LIGHT_MAX];
+		int multi_light_count;
+		Light *multi_light_list; //list the current UBO contents were built from
+
 	} state;
 
 	RasterizerStorageGLES3 *storage;
@@ -126,6 +161,9 @@ public:
 	virtual void canvas_begin();
 	virtual void canvas_end();
 
+	void _multi_light_upload(Light *p_light_list);
+	void _update_canvas_item_ubo();
+
 	_FORCE_INLINE_ void _set_texture_rect_mode(bool p_enable, bool p_ninepatch = false);
 	_FORCE_INLINE_ RasterizerStorageGLES3::Texture *_bind_canvas_texture(const RID &p_texture, const RID &p_normal_map, bool p_force = false);
 
@@ -134,12 +172,30 @@ public:
 	_FORCE_INLINE_ void _draw_generic(GLuint p_primitive, int p_vertex_count, const Vector2 *p_vertices, const Vector2 *p_uvs, const Color *p_colors, bool p_singlecolor);
 	_FORCE_INLINE_ void _draw_generic_indices(GLuint p_primitive, const int *p_indices, int p_index_count, int p_vertex_count, const Vector2 *p_vertices, const Vector2 *p_uvs, const Color *p_colors, bool p_singlecolor);
 
+	_FORCE_INLINE_ bool _rect_is_batchable(const Item::CommandRect *p_rect) const;
+	int _try_batch_rects(Item::Command **p_commands, int p_count, int p_current);
+
 	_FORCE_INLINE_ void _canvas_item_render_commands(Item *p_item, Item *current_clip, bool &reclip);
 	_FORCE_INLINE_ void _copy_texscreen(const Rect2 &p_rect);
 
 	virtual void canvas_render_items(Item *p_item_list, int p_z, const Color &p_modulate, Light *p_light, const Transform2D &p_transform);
 	virtual void canvas_debug_viewport_shadows(Light *p_lights_with_shadow);
 
+	struct OccluderBatchEntry {
+		RID polygon_buffer;
+		uint64_t version;
+		Transform2D xform;
+		int light_mask;
+		VS::CanvasOccluderPolygonCullMode cull_cache;
+		bool flip; //negative determinant transform, flips the cull winding
+		int index_offset;
+		int index_count;
+	};
+
+	Vector<OccluderBatchEntry> occluder_batch;
+
+	bool _update_occluder_batch(LightOccluderInstance *p_occluders);
+
 	virtual void canvas_light_shadow_buffer_update(RID p_buffer, const Transform2D &p_light_xform, int p_light_mask, float p_near, float p_far, LightOccluderInstance *p_occluders, CameraMatrix *p_xform_cache);
 
 	virtual void reset_canvas();
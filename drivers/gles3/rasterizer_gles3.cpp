@@ -187,6 +187,7 @@ void RasterizerGLES3::initialize() {
 	*/
 
 	print_line("OpenGL ES 3.0 Renderer: " + VisualServer::get_singleton()->get_video_adapter_name());
+	ShaderGLES3::init_shader_cache();
 	storage->initialize();
 	canvas->initialize();
 	scene->initialize();
@@ -32,6 +32,7 @@
 
 #include "core/math/math_funcs.h"
 #include "core/os/os.h"
+#include "core/os/worker_thread_pool.h"
 #include "core/project_settings.h"
 #include "rasterizer_canvas_gles3.h"
 #include "servers/camera/camera_feed.h"
@@ -88,6 +89,8 @@ RID RasterizerSceneGLES3::shadow_atlas_create() {
 	ShadowAtlas *shadow_atlas = memnew(ShadowAtlas);
 	shadow_atlas->fbo = 0;
 	shadow_atlas->depth = 0;
+	shadow_atlas->static_fbo = 0;
+	shadow_atlas->static_depth = 0;
 	shadow_atlas->size = 0;
 	shadow_atlas->smallest_subdiv = 0;
 
@@ -117,6 +120,13 @@ void RasterizerSceneGLES3::shadow_atlas_set_size(RID p_atlas, int p_size) {
 		shadow_atlas->depth = 0;
 		shadow_atlas->fbo = 0;
 	}
+	if (shadow_atlas->static_fbo) {
+		glDeleteTextures(1, &shadow_atlas->static_depth);
+		glDeleteFramebuffers(1, &shadow_atlas->static_fbo);
+
+		shadow_atlas->static_depth = 0;
+		shadow_atlas->static_fbo = 0;
+	}
 	for (int i = 0; i < 4; i++) {
 		//clear subdivisions
 		shadow_atlas->quadrants[i].shadows.resize(0);
@@ -158,10 +168,101 @@ void RasterizerSceneGLES3::shadow_atlas_set_size(RID p_atlas, int p_size) {
 		glClearDepth(0.0f);
 		glClear(GL_DEPTH_BUFFER_BIT);
 
+		if (shadow_static_cache_enabled) {
+			// Second depth texture to cache the static casters of each shadow
+			glGenFramebuffers(1, &shadow_atlas->static_fbo);
+			glBindFramebuffer(GL_FRAMEBUFFER, shadow_atlas->static_fbo);
+
+			glGenTextures(1, &shadow_atlas->static_depth);
+			glBindTexture(GL_TEXTURE_2D, shadow_atlas->static_depth);
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, shadow_atlas->size, shadow_atlas->size, 0,
+					GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+			glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
+					GL_TEXTURE_2D, shadow_atlas->static_depth, 0);
+		}
+
 		glBindFramebuffer(GL_FRAMEBUFFER, 0);
 	}
 }
 
+bool RasterizerSceneGLES3::_shadow_atlas_shadow_rect(ShadowAtlas *shadow_atlas, RID p_light_intance, int p_pass, uint32_t &r_x, uint32_t &r_y, uint32_t &r_width, uint32_t &r_height) {
+
+	LightInstance *light_instance = light_instance_owner.getornull(p_light_intance);
+	ERR_FAIL_COND_V(!light_instance, false);
+	RasterizerStorageGLES3::Light *light = storage->light_owner.getornull(light_instance->light);
+	ERR_FAIL_COND_V(!light, false);
+
+	if (!shadow_atlas->shadow_owners.has(p_light_intance))
+		return false;
+
+	uint32_t key = shadow_atlas->shadow_owners[p_light_intance];
+
+	uint32_t quadrant = (key >> ShadowAtlas::QUADRANT_SHIFT) & 0x3;
+	uint32_t shadow = key & ShadowAtlas::SHADOW_INDEX_MASK;
+
+	ERR_FAIL_INDEX_V((int)shadow, shadow_atlas->quadrants[quadrant].shadows.size(), false);
+
+	uint32_t quadrant_size = shadow_atlas->size >> 1;
+
+	r_x = (quadrant & 1) * quadrant_size;
+	r_y = (quadrant >> 1) * quadrant_size;
+
+	uint32_t shadow_size = (quadrant_size / shadow_atlas->quadrants[quadrant].subdivision);
+	r_x += (shadow % shadow_atlas->quadrants[quadrant].subdivision) * shadow_size;
+	r_y += (shadow / shadow_atlas->quadrants[quadrant].subdivision) * shadow_size;
+
+	r_width = shadow_size;
+	r_height = shadow_size;
+
+	if (light->type == VS::LIGHT_OMNI) {
+		//only the dual paraboloid subregions are cacheable
+		if (light->omni_shadow_mode != VS::LIGHT_OMNI_SHADOW_DUAL_PARABOLOID)
+			return false;
+
+		if (light->omni_shadow_detail == VS::LIGHT_OMNI_SHADOW_DETAIL_HORIZONTAL) {
+			r_height /= 2;
+			r_y += p_pass * r_height;
+		} else {
+			r_width /= 2;
+			r_x += p_pass * r_width;
+		}
+	}
+
+	return true;
+}
+
+bool RasterizerSceneGLES3::is_shadow_atlas_static_cache_enabled(RID p_atlas) {
+
+	ShadowAtlas *shadow_atlas = shadow_atlas_owner.getornull(p_atlas);
+	return shadow_atlas && shadow_atlas->static_fbo != 0;
+}
+
+bool RasterizerSceneGLES3::shadow_atlas_cache_shadow(RID p_atlas, RID p_light_intance, int p_pass, bool p_to_cache) {
+
+	ShadowAtlas *shadow_atlas = shadow_atlas_owner.getornull(p_atlas);
+	ERR_FAIL_COND_V(!shadow_atlas, false);
+
+	if (!shadow_atlas->static_fbo)
+		return false;
+
+	uint32_t x, y, width, height;
+	if (!_shadow_atlas_shadow_rect(shadow_atlas, p_light_intance, p_pass, x, y, width, height))
+		return false;
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, p_to_cache ? shadow_atlas->fbo : shadow_atlas->static_fbo);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, p_to_cache ? shadow_atlas->static_fbo : shadow_atlas->fbo);
+	glBlitFramebuffer(x, y, x + width, y + height, x, y, x + width, y + height, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+	return true;
+}
+
 void RasterizerSceneGLES3::shadow_atlas_set_quadrant_subdivision(RID p_atlas, int p_quadrant, int p_subdivision) {
 
 	ShadowAtlas *shadow_atlas = shadow_atlas_owner.getornull(p_atlas);
@@ -1151,9 +1252,10 @@ bool RasterizerSceneGLES3::_setup_material(RasterizerStorageGLES3::Material *p_m
 	state.scene_shader.set_custom_shader(p_material->shader->custom_code_id);
 	bool rebind = state.scene_shader.bind();
 
-	if (p_material->ubo_id) {
+	if (p_material->ubo_id && state.current_material_ubo != p_material->ubo_id) {
 
 		glBindBufferBase(GL_UNIFORM_BUFFER, 1, p_material->ubo_id);
+		state.current_material_ubo = p_material->ubo_id;
 	}
 
 	int tc = p_material->textures.size();
@@ -1589,9 +1691,6 @@ void RasterizerSceneGLES3::_render_geometry(RenderList::Element *e) {
 				return;
 			}
 
-			glBindBuffer(GL_ARRAY_BUFFER, state.immediate_buffer);
-			glBindVertexArray(state.immediate_array);
-
 			for (const List<RasterizerStorageGLES3::Immediate::Chunk>::Element *E = im->chunks.front(); E; E = E->next()) {
 
 				const RasterizerStorageGLES3::Immediate::Chunk &c = E->get();
@@ -1599,6 +1698,12 @@ void RasterizerSceneGLES3::_render_geometry(RenderList::Element *e) {
 					continue;
 				}
 
+				//rotate through the streaming buffers, so uploading this chunk does
+				//not wait for a previous chunk's draw to retire
+				state.immediate_buffer_index = (state.immediate_buffer_index + 1) % 3;
+				glBindBuffer(GL_ARRAY_BUFFER, state.immediate_buffers[state.immediate_buffer_index]);
+				glBindVertexArray(state.immediate_arrays[state.immediate_buffer_index]);
+
 				int vertices = c.vertices.size();
 				uint32_t buf_ofs = 0;
 
@@ -1831,6 +1936,110 @@ void RasterizerSceneGLES3::_render_geometry(RenderList::Element *e) {
 	}
 }
 
+bool RasterizerSceneGLES3::_auto_instance_compatible(RenderList::Element *e, RenderList::Element *e2, bool p_check_lighting) {
+
+	if (e2->sort_key != e->sort_key || e2->geometry != e->geometry || e2->material != e->material || e2->owner != e->owner)
+		return false;
+
+	if (e2->instance->base_type != VS::INSTANCE_MESH || e2->instance->skeleton.is_valid())
+		return false;
+
+	if (!p_check_lighting)
+		return true;
+
+	//the per object lighting state becomes shared by the whole merged draw, so it must match
+
+	if (e2->instance->layer_mask != e->instance->layer_mask)
+		return false;
+
+	if (e2->instance->lightmap != e->instance->lightmap || !e2->instance->lightmap_capture_data.empty() || !e->instance->lightmap_capture_data.empty())
+		return false;
+
+	if (e2->instance->light_instances.size() != e->instance->light_instances.size() || e2->instance->reflection_probe_instances.size() != e->instance->reflection_probe_instances.size() || e2->instance->gi_probe_instances.size() != e->instance->gi_probe_instances.size())
+		return false;
+
+	for (int i = 0; i < e->instance->light_instances.size(); i++) {
+		if (e2->instance->light_instances[i] != e->instance->light_instances[i])
+			return false;
+	}
+
+	for (int i = 0; i < e->instance->reflection_probe_instances.size(); i++) {
+		if (e2->instance->reflection_probe_instances[i] != e->instance->reflection_probe_instances[i])
+			return false;
+	}
+
+	for (int i = 0; i < e->instance->gi_probe_instances.size(); i++) {
+		if (e2->instance->gi_probe_instances[i] != e->instance->gi_probe_instances[i])
+			return false;
+	}
+
+	return true;
+}
+
+void RasterizerSceneGLES3::_setup_auto_instances(RenderList::Element **p_elements, int p_count) {
+
+	RasterizerStorageGLES3::Surface *s = static_cast<RasterizerStorageGLES3::Surface *>(p_elements[0]->geometry);
+
+	glBindVertexArray(s->instancing_array_id); // use the instancing array ID
+
+	float *transforms = state.auto_instance_data;
+
+	for (int i = 0; i < p_count; i++) {
+
+		const Transform &t = p_elements[i]->instance->transform;
+		float *dataptr = &transforms[i * 12];
+
+		dataptr[0] = t.basis.elements[0][0];
+		dataptr[1] = t.basis.elements[0][1];
+		dataptr[2] = t.basis.elements[0][2];
+		dataptr[3] = t.origin.x;
+		dataptr[4] = t.basis.elements[1][0];
+		dataptr[5] = t.basis.elements[1][1];
+		dataptr[6] = t.basis.elements[1][2];
+		dataptr[7] = t.origin.y;
+		dataptr[8] = t.basis.elements[2][0];
+		dataptr[9] = t.basis.elements[2][1];
+		dataptr[10] = t.basis.elements[2][2];
+		dataptr[11] = t.origin.z;
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, state.auto_instance_buffer); //modify the buffer
+	glBufferSubData(GL_ARRAY_BUFFER, 0, p_count * 12 * sizeof(float), transforms);
+
+	int stride = 12 * 4;
+	glEnableVertexAttribArray(8);
+	glVertexAttribPointer(8, 4, GL_FLOAT, GL_FALSE, stride, NULL);
+	glVertexAttribDivisor(8, 1);
+	glEnableVertexAttribArray(9);
+	glVertexAttribPointer(9, 4, GL_FLOAT, GL_FALSE, stride, CAST_INT_TO_UCHAR_PTR(4 * 4));
+	glVertexAttribDivisor(9, 1);
+	glEnableVertexAttribArray(10);
+	glVertexAttribPointer(10, 4, GL_FLOAT, GL_FALSE, stride, CAST_INT_TO_UCHAR_PTR(8 * 4));
+	glVertexAttribDivisor(10, 1);
+	glDisableVertexAttribArray(11);
+	glVertexAttrib4f(11, 1, 1, 1, 1);
+	glDisableVertexAttribArray(12);
+	glVertexAttrib4f(12, 1, 1, 1, 1);
+}
+
+void RasterizerSceneGLES3::_render_auto_instances(RenderList::Element *e, int p_count) {
+
+	RasterizerStorageGLES3::Surface *s = static_cast<RasterizerStorageGLES3::Surface *>(e->geometry);
+
+	if (s->index_array_len > 0) {
+
+		glDrawElementsInstanced(gl_primitive[s->primitive], s->index_array_len, (s->array_len >= (1 << 16)) ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT, 0, p_count);
+
+		storage->info.render.vertices_count += s->index_array_len * p_count;
+
+	} else {
+
+		glDrawArraysInstanced(gl_primitive[s->primitive], 0, s->array_len, p_count);
+
+		storage->info.render.vertices_count += s->array_len * p_count;
+	}
+}
+
 void RasterizerSceneGLES3::_setup_light(RenderList::Element *e, const Transform &p_view_transform) {
 
 	int omni_indices[16];
@@ -1842,6 +2051,8 @@ void RasterizerSceneGLES3::_setup_light(RenderList::Element *e, const Transform
 
 	int maxobj = MIN(16, state.max_forward_lights_per_object);
 
+	bool use_clusters = state.cluster_enabled && !(e->sort_key & SORT_KEY_VERTEX_LIT_FLAG);
+
 	int lc = e->instance->light_instances.size();
 	if (lc) {
 
@@ -1852,6 +2063,9 @@ void RasterizerSceneGLES3::_setup_light(RenderList::Element *e, const Transform
 			if (!li || li->last_pass != render_pass) //not visible
 				continue;
 
+			if (use_clusters && li->light_ptr->cull_mask == 0xFFFFFFFF)
+				continue; //delivered through the cluster grid, only cull masked lights go per object
+
 			if (li && li->light_ptr->type == VS::LIGHT_OMNI) {
 				if (omni_count < maxobj && e->instance->layer_mask & li->light_ptr->cull_mask) {
 					omni_indices[omni_count++] = li->light_index;
@@ -1877,6 +2091,12 @@ void RasterizerSceneGLES3::_setup_light(RenderList::Element *e, const Transform
 		glUniform1iv(state.scene_shader.get_uniform(SceneShaderGLES3::SPOT_LIGHT_INDICES), spot_count, spot_indices);
 	}
 
+	if (use_clusters) {
+		state.scene_shader.set_uniform(SceneShaderGLES3::CLUSTER_SCREEN_SCALE, state.cluster_screen_scale);
+		state.scene_shader.set_uniform(SceneShaderGLES3::CLUSTER_DEPTH_SCALE, state.cluster_depth_scale);
+		state.scene_shader.set_uniform(SceneShaderGLES3::CLUSTER_Z_NEAR, state.cluster_z_near);
+	}
+
 	int rc = e->instance->reflection_probe_instances.size();
 
 	if (rc) {
@@ -1976,6 +2196,8 @@ void RasterizerSceneGLES3::_render_list(RenderList::Element **p_elements, int p_
 
 	glBindBufferBase(GL_UNIFORM_BUFFER, 0, state.scene_ubo); //bind globals ubo
 
+	state.current_material_ubo = 0; //binding point 1 may have been clobbered between lists
+
 	bool use_radiance_map = false;
 	if (!p_shadow && !p_directional_add) {
 		glBindBufferBase(GL_UNIFORM_BUFFER, 2, state.env_radiance_ubo); //bind environment radiance info
@@ -2011,6 +2233,7 @@ void RasterizerSceneGLES3::_render_list(RenderList::Element **p_elements, int p_
 	glEnable(GL_DEPTH_TEST);
 
 	state.scene_shader.set_conditional(SceneShaderGLES3::USE_SKELETON, false);
+	state.scene_shader.set_conditional(SceneShaderGLES3::USE_LIGHT_CLUSTERS, state.cluster_enabled && !p_shadow);
 
 	state.current_blend_mode = -1;
 	state.current_line_width = -1;
@@ -2180,7 +2403,23 @@ void RasterizerSceneGLES3::_render_list(RenderList::Element **p_elements, int p_
 			rebind = true;
 		}
 
-		bool use_instancing = e->instance->base_type == VS::INSTANCE_MULTIMESH || e->instance->base_type == VS::INSTANCE_PARTICLES;
+		int auto_instances = 1;
+
+		if (state.auto_instancing && e->instance->base_type == VS::INSTANCE_MESH && !skeleton && !static_cast<RasterizerStorageGLES3::Surface *>(e->geometry)->blend_shapes.size()) {
+#ifdef DEBUG_ENABLED
+			if (state.debug_draw != VS::VIEWPORT_DEBUG_DRAW_WIREFRAME)
+#endif
+			{
+				//consecutive elements with the same surface, material and lighting
+				//state can be merged into a single instanced draw
+				bool check_lighting = !p_shadow && !p_directional_add && !(e->sort_key & SORT_KEY_UNSHADED_FLAG);
+				while (i + auto_instances < p_element_count && auto_instances < AUTO_INSTANCE_MAX && _auto_instance_compatible(e, p_elements[i + auto_instances], check_lighting)) {
+					auto_instances++;
+				}
+			}
+		}
+
+		bool use_instancing = auto_instances > 1 || e->instance->base_type == VS::INSTANCE_MULTIMESH || e->instance->base_type == VS::INSTANCE_PARTICLES;
 
 		if (use_instancing != prev_use_instancing) {
 			state.scene_shader.set_conditional(SceneShaderGLES3::USE_INSTANCING, use_instancing);
@@ -2214,22 +2453,44 @@ void RasterizerSceneGLES3::_render_list(RenderList::Element **p_elements, int p_
 			_setup_light(e, p_view_transform);
 		}
 
-		if (e->owner != prev_owner || prev_base_type != e->instance->base_type || prev_geometry != e->geometry) {
+		if (auto_instances > 1) {
 
-			_setup_geometry(e, p_view_transform);
+			_setup_auto_instances(&p_elements[i], auto_instances);
 			storage->info.render.surface_switch_count++;
-		}
 
-		_set_cull(e->sort_key & RenderList::SORT_KEY_MIRROR_FLAG, e->sort_key & RenderList::SORT_KEY_CULL_DISABLED_FLAG, p_reverse_cull);
+			_set_cull(e->sort_key & RenderList::SORT_KEY_MIRROR_FLAG, e->sort_key & RenderList::SORT_KEY_CULL_DISABLED_FLAG, p_reverse_cull);
 
-		state.scene_shader.set_uniform(SceneShaderGLES3::WORLD_TRANSFORM, e->instance->transform);
+			state.scene_shader.set_uniform(SceneShaderGLES3::WORLD_TRANSFORM, Transform()); //the full transform comes from the instance array
+
+			_render_auto_instances(e, auto_instances);
+
+			storage->info.render.draw_call_count -= auto_instances - 1;
+			i += auto_instances - 1;
+
+			//the shared instancing array was left pointing at the scratch buffer,
+			//make sure the next element sets its geometry up again
+			prev_geometry = NULL;
+			prev_owner = NULL;
+		} else {
 
-		_render_geometry(e);
+			if (e->owner != prev_owner || prev_base_type != e->instance->base_type || prev_geometry != e->geometry) {
+
+				_setup_geometry(e, p_view_transform);
+				storage->info.render.surface_switch_count++;
+			}
+
+			_set_cull(e->sort_key & RenderList::SORT_KEY_MIRROR_FLAG, e->sort_key & RenderList::SORT_KEY_CULL_DISABLED_FLAG, p_reverse_cull);
+
+			state.scene_shader.set_uniform(SceneShaderGLES3::WORLD_TRANSFORM, e->instance->transform);
+
+			_render_geometry(e);
+
+			prev_geometry = e->geometry;
+			prev_owner = e->owner;
+		}
 
 		prev_material = material;
 		prev_base_type = e->instance->base_type;
-		prev_geometry = e->geometry;
-		prev_owner = e->owner;
 		prev_shading = shading;
 		prev_skeleton = skeleton;
 		prev_use_instancing = use_instancing;
@@ -2257,6 +2518,7 @@ void RasterizerSceneGLES3::_render_list(RenderList::Element **p_elements, int p_
 	state.scene_shader.set_conditional(SceneShaderGLES3::USE_CONTACT_SHADOWS, false);
 	state.scene_shader.set_conditional(SceneShaderGLES3::USE_VERTEX_LIGHTING, false);
 	state.scene_shader.set_conditional(SceneShaderGLES3::USE_OPAQUE_PREPASS, false);
+	state.scene_shader.set_conditional(SceneShaderGLES3::USE_LIGHT_CLUSTERS, false);
 }
 
 void RasterizerSceneGLES3::_add_geometry(RasterizerStorageGLES3::Geometry *p_geometry, InstanceBase *p_instance, RasterizerStorageGLES3::GeometryOwner *p_owner, int p_material, bool p_depth_pass, bool p_shadow_pass) {
@@ -2783,6 +3045,7 @@ void RasterizerSceneGLES3::_setup_lights(RID *p_light_cull_result, int p_light_c
 	state.omni_light_count = 0;
 	state.spot_light_count = 0;
 	state.directional_light_count = 0;
+	state.cluster_lights.clear();
 
 	directional_light = NULL;
 
@@ -2884,6 +3147,16 @@ void RasterizerSceneGLES3::_setup_lights(RID *p_light_cull_result, int p_light_c
 				copymem(&state.omni_array_tmp[li->light_index * state.ubo_light_size], &ubo_data, state.ubo_light_size);
 				state.omni_light_count++;
 
+				if (state.use_light_clusters && li->light_ptr->cull_mask == 0xFFFFFFFF) {
+					//lights with a custom cull mask stay on the per object lists
+					ClusterLight cl;
+					cl.center = pos;
+					cl.radius = li->light_ptr->param[VS::LIGHT_PARAM_RANGE];
+					cl.index = li->light_index;
+					cl.spot = false;
+					state.cluster_lights.push_back(cl);
+				}
+
 			} break;
 			case VS::LIGHT_SPOT: {
 
@@ -2966,6 +3239,16 @@ void RasterizerSceneGLES3::_setup_lights(RID *p_light_cull_result, int p_light_c
 				li->light_index = state.spot_light_count;
 				copymem(&state.spot_array_tmp[li->light_index * state.ubo_light_size], &ubo_data, state.ubo_light_size);
 				state.spot_light_count++;
+
+				if (state.use_light_clusters && li->light_ptr->cull_mask == 0xFFFFFFFF) {
+					//attenuation is zero beyond the radial range, so a full range sphere bounds the cone
+					ClusterLight cl;
+					cl.center = pos;
+					cl.radius = li->light_ptr->param[VS::LIGHT_PARAM_RANGE];
+					cl.index = li->light_index;
+					cl.spot = true;
+					state.cluster_lights.push_back(cl);
+				}
 			} break;
 		}
 
@@ -2993,6 +3276,103 @@ void RasterizerSceneGLES3::_setup_lights(RID *p_light_cull_result, int p_light_c
 	glBindBufferBase(GL_UNIFORM_BUFFER, 5, state.spot_array_ubo);
 }
 
+void RasterizerSceneGLES3::_update_light_clusters(const CameraMatrix &p_projection) {
+
+	if (!state.cluster_texture) {
+
+		glGenTextures(1, &state.cluster_texture);
+		glBindTexture(GL_TEXTURE_2D, state.cluster_texture);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_R32UI, CLUSTER_CELL_TEXELS, CLUSTER_CELL_COUNT, 0, GL_RED_INTEGER, GL_UNSIGNED_INT, NULL);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+		state.cluster_data.resize(CLUSTER_CELL_TEXELS * CLUSTER_CELL_COUNT);
+	}
+
+	uint32_t *cells = state.cluster_data.ptrw();
+	zeromem(cells, CLUSTER_CELL_TEXELS * CLUSTER_CELL_COUNT * sizeof(uint32_t));
+
+	float z_near = MAX(p_projection.get_z_near(), 0.001);
+	float z_far = MAX(p_projection.get_z_far(), z_near * 2.0);
+
+	state.cluster_z_near = z_near;
+	state.cluster_depth_scale = CLUSTER_DEPTH_SLICES / Math::log(z_far / z_near);
+	state.cluster_screen_scale = Vector2(float(CLUSTER_GRID_WIDTH) / storage->frame.current_rt->width, float(CLUSTER_GRID_HEIGHT) / storage->frame.current_rt->height);
+
+	float p00 = p_projection.matrix[0][0];
+	float p11 = p_projection.matrix[1][1];
+	float p20 = p_projection.matrix[2][0];
+	float p21 = p_projection.matrix[2][1];
+
+	const ClusterLight *cluster_lights = state.cluster_lights.ptr();
+	int light_count = state.cluster_lights.size();
+
+	for (int pass = 0; pass < 2; pass++) { //omnis first, so each cell list stays omni-then-spot ordered
+
+		for (int i = 0; i < light_count; i++) {
+
+			const ClusterLight &cl = cluster_lights[i];
+			if (cl.spot != (pass == 1))
+				continue;
+
+			float depth = -cl.center.z; //camera looks down -Z
+			if (depth + cl.radius <= z_near || depth - cl.radius >= z_far)
+				continue;
+
+			float z0 = MAX(depth - cl.radius, z_near);
+			float z1 = MIN(depth + cl.radius, z_far);
+
+			int slice0 = CLAMP(int(Math::log(z0 / z_near) * state.cluster_depth_scale), 0, CLUSTER_DEPTH_SLICES - 1);
+			int slice1 = CLAMP(int(Math::log(z1 / z_near) * state.cluster_depth_scale), 0, CLUSTER_DEPTH_SLICES - 1);
+
+			int tx0 = 0;
+			int tx1 = CLUSTER_GRID_WIDTH - 1;
+			int ty0 = 0;
+			int ty1 = CLUSTER_GRID_HEIGHT - 1;
+
+			if (depth - cl.radius > z_near) {
+				//sphere fully in front of the near plane, bound its NDC rect by
+				//projecting each extreme at both depth ends (perspective only,
+				//clustering is disabled for orthogonal cameras)
+				float nx0 = MIN((cl.center.x - cl.radius) * p00 / z0, (cl.center.x - cl.radius) * p00 / z1) - p20;
+				float nx1 = MAX((cl.center.x + cl.radius) * p00 / z0, (cl.center.x + cl.radius) * p00 / z1) - p20;
+				float ny0 = MIN((cl.center.y - cl.radius) * p11 / z0, (cl.center.y - cl.radius) * p11 / z1) - p21;
+				float ny1 = MAX((cl.center.y + cl.radius) * p11 / z0, (cl.center.y + cl.radius) * p11 / z1) - p21;
+
+				if (nx1 < -1.0 || nx0 > 1.0 || ny1 < -1.0 || ny0 > 1.0)
+					continue;
+
+				tx0 = CLAMP(int((nx0 * 0.5 + 0.5) * CLUSTER_GRID_WIDTH), 0, CLUSTER_GRID_WIDTH - 1);
+				tx1 = CLAMP(int((nx1 * 0.5 + 0.5) * CLUSTER_GRID_WIDTH), 0, CLUSTER_GRID_WIDTH - 1);
+				ty0 = CLAMP(int((ny0 * 0.5 + 0.5) * CLUSTER_GRID_HEIGHT), 0, CLUSTER_GRID_HEIGHT - 1);
+				ty1 = CLAMP(int((ny1 * 0.5 + 0.5) * CLUSTER_GRID_HEIGHT), 0, CLUSTER_GRID_HEIGHT - 1);
+			}
+
+			for (int s = slice0; s <= slice1; s++) {
+				for (int y = ty0; y <= ty1; y++) {
+					for (int x = tx0; x <= tx1; x++) {
+
+						uint32_t *cell = &cells[((s * CLUSTER_GRID_HEIGHT + y) * CLUSTER_GRID_WIDTH + x) * CLUSTER_CELL_TEXELS];
+						uint32_t total = (cell[0] & 0xFFFF) + (cell[0] >> 16);
+						if (total >= CLUSTER_MAX_LIGHTS_PER_CELL)
+							continue;
+
+						cell[1 + total] = cl.index;
+						cell[0] += cl.spot ? 0x10000 : 1;
+					}
+				}
+			}
+		}
+	}
+
+	glActiveTexture(GL_TEXTURE0 + storage->config.max_texture_image_units - 11);
+	glBindTexture(GL_TEXTURE_2D, state.cluster_texture);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, CLUSTER_CELL_TEXELS, CLUSTER_CELL_COUNT, GL_RED_INTEGER, GL_UNSIGNED_INT, cells);
+	glActiveTexture(GL_TEXTURE0);
+}
+
 void RasterizerSceneGLES3::_setup_reflections(RID *p_reflection_probe_cull_result, int p_reflection_probe_cull_count, const Transform &p_camera_inverse_transform, const CameraMatrix &p_camera_projection, RID p_reflection_atlas, Environment *p_env) {
 
 	state.reflection_probe_count = 0;
@@ -3142,14 +3522,14 @@ void RasterizerSceneGLES3::_fill_render_list(InstanceBase **p_cull_result, int p
 
 			case VS::INSTANCE_MESH: {
 
-				RasterizerStorageGLES3::Mesh *mesh = storage->mesh_owner.getptr(inst->base);
+				RasterizerStorageGLES3::Mesh *mesh = storage->mesh_owner.getptr(inst->lod_mesh.is_valid() ? inst->lod_mesh : inst->base);
 				ERR_CONTINUE(!mesh);
 
 				int ssize = mesh->surfaces.size();
 
 				for (int j = 0; j < ssize; j++) {
 
-					int mat_idx = inst->materials[j].is_valid() ? j : -1;
+					int mat_idx = j < inst->materials.size() && inst->materials[j].is_valid() ? j : -1;
 					RasterizerStorageGLES3::Surface *s = mesh->surfaces[j];
 					_add_geometry(s, inst, NULL, mat_idx, p_depth_pass, p_shadow_pass);
 				}
@@ -3690,15 +4070,75 @@ void RasterizerSceneGLES3::_post_process(Environment *env, const CameraMatrix &p
 		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-		glBindFramebuffer(GL_FRAMEBUFFER, storage->frame.current_rt->fbo); //copy to front first
+		bool half_res = state.dof_half_resolution && storage->frame.current_rt->effects.mip_maps[0].sizes.size() > 1 && storage->frame.current_rt->effects.mip_maps[1].sizes.size() > 0;
 
-		_copy_screen(true);
+		if (half_res) {
 
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, storage->frame.current_rt->color);
-		state.effect_blur_shader.set_uniform(EffectBlurShaderGLES3::DOF_DIR, Vector2(0, 1));
-		glBindFramebuffer(GL_FRAMEBUFFER, storage->frame.current_rt->effects.mip_maps[0].sizes[0].fbo); // copy to base level
-		_copy_screen();
+			//blur at half resolution, then merge back over the sharp image based on depth
+
+			int hr_w = storage->frame.current_rt->effects.mip_maps[1].sizes[0].width;
+			int hr_h = storage->frame.current_rt->effects.mip_maps[1].sizes[0].height;
+
+			glViewport(0, 0, hr_w, hr_h);
+			state.effect_blur_shader.set_uniform(EffectBlurShaderGLES3::PIXEL_SIZE, Vector2(1.0 / hr_w, 1.0 / hr_h));
+
+			glActiveTexture(GL_TEXTURE0);
+			glBindTexture(GL_TEXTURE_2D, composite_from);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR); //downsampling, so average the source
+
+			glBindFramebuffer(GL_FRAMEBUFFER, storage->frame.current_rt->effects.mip_maps[1].sizes[0].fbo);
+
+			_copy_screen(true);
+
+			glActiveTexture(GL_TEXTURE0);
+			glBindTexture(GL_TEXTURE_2D, storage->frame.current_rt->effects.mip_maps[1].color);
+			state.effect_blur_shader.set_uniform(EffectBlurShaderGLES3::DOF_DIR, Vector2(0, 1));
+			glBindFramebuffer(GL_FRAMEBUFFER, storage->frame.current_rt->effects.mip_maps[0].sizes[1].fbo); //blurred result in the half resolution level
+			_copy_screen();
+
+			glViewport(0, 0, vp_w, vp_h);
+
+			state.effect_blur_shader.set_conditional(EffectBlurShaderGLES3::DOF_FAR_BLUR, false);
+			state.effect_blur_shader.set_conditional(EffectBlurShaderGLES3::DOF_FAR_UPSAMPLE, true);
+			state.effect_blur_shader.bind();
+
+			state.effect_blur_shader.set_uniform(EffectBlurShaderGLES3::DOF_BEGIN, env->dof_blur_far_distance);
+			state.effect_blur_shader.set_uniform(EffectBlurShaderGLES3::DOF_END, env->dof_blur_far_distance + env->dof_blur_far_transition);
+			state.effect_blur_shader.set_uniform(EffectBlurShaderGLES3::CAMERA_Z_NEAR, p_cam_projection.get_z_near());
+			state.effect_blur_shader.set_uniform(EffectBlurShaderGLES3::CAMERA_Z_FAR, p_cam_projection.get_z_far());
+
+			glActiveTexture(GL_TEXTURE0);
+			glBindTexture(GL_TEXTURE_2D, storage->frame.current_rt->effects.mip_maps[0].color);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_NEAREST); //the upsample reads both levels
+
+			glBindFramebuffer(GL_FRAMEBUFFER, storage->frame.current_rt->fbo); //merge to front
+
+			_copy_screen(true);
+
+			state.effect_blur_shader.set_conditional(EffectBlurShaderGLES3::DOF_FAR_UPSAMPLE, false);
+			state.effect_blur_shader.set_conditional(EffectBlurShaderGLES3::SIMPLE_COPY, true);
+			state.effect_blur_shader.bind();
+			state.effect_blur_shader.set_uniform(EffectBlurShaderGLES3::LOD, float(0));
+
+			glActiveTexture(GL_TEXTURE0);
+			glBindTexture(GL_TEXTURE_2D, storage->frame.current_rt->color);
+			glBindFramebuffer(GL_FRAMEBUFFER, storage->frame.current_rt->effects.mip_maps[0].sizes[0].fbo); // copy to base level
+			_copy_screen();
+			state.effect_blur_shader.set_conditional(EffectBlurShaderGLES3::SIMPLE_COPY, false);
+
+		} else {
+
+			glBindFramebuffer(GL_FRAMEBUFFER, storage->frame.current_rt->fbo); //copy to front first
+
+			_copy_screen(true);
+
+			glActiveTexture(GL_TEXTURE0);
+			glBindTexture(GL_TEXTURE_2D, storage->frame.current_rt->color);
+			state.effect_blur_shader.set_uniform(EffectBlurShaderGLES3::DOF_DIR, Vector2(0, 1));
+			glBindFramebuffer(GL_FRAMEBUFFER, storage->frame.current_rt->effects.mip_maps[0].sizes[0].fbo); // copy to base level
+			_copy_screen();
+		}
 
 		state.effect_blur_shader.set_conditional(EffectBlurShaderGLES3::DOF_FAR_BLUR, false);
 		state.effect_blur_shader.set_conditional(EffectBlurShaderGLES3::DOF_QUALITY_LOW, false);
@@ -4085,6 +4525,67 @@ void RasterizerSceneGLES3::_post_process(Environment *env, const CameraMatrix &p
 	state.tonemap_shader.set_conditional(TonemapShaderGLES3::V_FLIP, false);
 }
 
+void RasterizerSceneGLES3::_gpu_timer_begin(int p_pass) {
+#ifdef GLES_OVER_GL
+	if (!gpu_timers.enabled || gpu_timers.section_open)
+		return;
+	if (gpu_timers.query_count[gpu_timers.frame] == GPUTimers::MAX_QUERIES)
+		return;
+
+	GPUTimers::Query &q = gpu_timers.queries[gpu_timers.frame][gpu_timers.query_count[gpu_timers.frame]++];
+	q.pass = p_pass;
+	glBeginQuery(GL_TIME_ELAPSED, q.id);
+	gpu_timers.section_open = true;
+#endif
+}
+
+void RasterizerSceneGLES3::_gpu_timer_end() {
+#ifdef GLES_OVER_GL
+	if (!gpu_timers.enabled || !gpu_timers.section_open)
+		return;
+
+	glEndQuery(GL_TIME_ELAPSED);
+	gpu_timers.section_open = false;
+#endif
+}
+
+void RasterizerSceneGLES3::_gpu_timers_resolve() {
+#ifdef GLES_OVER_GL
+	if (!gpu_timers.enabled)
+		return;
+
+	//resolve the queries recorded one frame ago; by now their results are normally ready without stalling
+	int resolve = gpu_timers.frame ^ 1;
+
+	uint64_t pass_time[GPUTimers::PASS_MAX];
+	for (int i = 0; i < GPUTimers::PASS_MAX; i++) {
+		pass_time[i] = 0;
+	}
+
+	for (int i = 0; i < gpu_timers.query_count[resolve]; i++) {
+
+		const GPUTimers::Query &q = gpu_timers.queries[resolve][i];
+		GLuint64 time_ns = 0;
+		glGetQueryObjectui64v(q.id, GL_QUERY_RESULT, &time_ns);
+		pass_time[q.pass] += time_ns;
+	}
+
+	storage->info.gpu_shadow_time_us = pass_time[GPUTimers::PASS_SHADOW] / 1000;
+	storage->info.gpu_opaque_time_us = pass_time[GPUTimers::PASS_OPAQUE] / 1000;
+	storage->info.gpu_transparent_time_us = pass_time[GPUTimers::PASS_TRANSPARENT] / 1000;
+	storage->info.gpu_effects_time_us = pass_time[GPUTimers::PASS_EFFECTS] / 1000;
+
+	gpu_timers.query_count[resolve] = 0;
+	gpu_timers.frame = resolve;
+#endif
+}
+
+void RasterizerSceneGLES3::_sort_render_list_task(void *p_userdata) {
+
+	RenderList *render_list = (RenderList *)p_userdata;
+	render_list->sort_by_key_cached(RenderList::SORT_CACHE_OPAQUE);
+}
+
 void RasterizerSceneGLES3::render_scene(const Transform &p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_ortogonal, InstanceBase **p_cull_result, int p_cull_count, RID *p_light_cull_result, int p_light_cull_count, RID *p_reflection_probe_cull_result, int p_reflection_probe_cull_count, RID p_environment, RID p_shadow_atlas, RID p_reflection_atlas, RID p_reflection_probe, int p_reflection_probe_pass) {
 
 	//first of all, make a new render pass
@@ -4164,6 +4665,15 @@ void RasterizerSceneGLES3::render_scene(const Transform &p_cam_transform, const
 	// Do depth prepass if it's explicitly enabled
 	bool use_depth_prepass = storage->config.use_depth_prepass;
 
+	// The viewport can override the project setting either way
+	if (storage->frame.current_rt) {
+		if (storage->frame.current_rt->flags[RasterizerStorage::RENDER_TARGET_FORCE_DEPTH_PREPASS]) {
+			use_depth_prepass = true;
+		} else if (storage->frame.current_rt->flags[RasterizerStorage::RENDER_TARGET_NO_DEPTH_PREPASS]) {
+			use_depth_prepass = false;
+		}
+	}
+
 	// If contact shadows are used then we need to do depth prepass even if it's otherwise disabled
 	use_depth_prepass = use_depth_prepass || state.used_contact_shadows;
 
@@ -4189,10 +4699,12 @@ void RasterizerSceneGLES3::render_scene(const Transform &p_cam_transform, const
 
 		render_list.clear();
 		_fill_render_list(p_cull_result, p_cull_count, true, false);
-		render_list.sort_by_key(false);
+		render_list.sort_by_key_cached(RenderList::SORT_CACHE_DEPTH);
+		_gpu_timer_begin(GPUTimers::PASS_OPAQUE);
 		state.scene_shader.set_conditional(SceneShaderGLES3::RENDER_DEPTH, true);
 		_render_list(render_list.elements, render_list.element_count, p_cam_transform, p_cam_projection, NULL, false, false, true, false, false);
 		state.scene_shader.set_conditional(SceneShaderGLES3::RENDER_DEPTH, false);
+		_gpu_timer_end();
 
 		glColorMask(1, 1, 1, 1);
 
@@ -4212,11 +4724,22 @@ void RasterizerSceneGLES3::render_scene(const Transform &p_cam_transform, const
 	_setup_lights(p_light_cull_result, p_light_cull_count, p_cam_transform.affine_inverse(), p_cam_projection, p_shadow_atlas);
 	_setup_reflections(p_reflection_probe_cull_result, p_reflection_probe_cull_count, p_cam_transform.affine_inverse(), p_cam_projection, p_reflection_atlas, env);
 
+	state.cluster_enabled = state.use_light_clusters && !p_cam_ortogonal && !p_reflection_probe.is_valid() && storage->frame.current_rt && (state.omni_light_count > 0 || state.spot_light_count > 0);
+	if (state.cluster_enabled) {
+		_update_light_clusters(p_cam_projection);
+	}
+
 	bool use_mrt = false;
 
 	render_list.clear();
 	_fill_render_list(p_cull_result, p_cull_count, false, false);
-	//
+
+	//sort the opaque list on a worker thread, overlapping the GL state and probe setup below
+	WorkerThreadPool::TaskID sort_task = 0;
+	bool sort_async = WorkerThreadPool::get_singleton() && WorkerThreadPool::get_singleton()->get_thread_count() > 0;
+	if (sort_async) {
+		sort_task = WorkerThreadPool::get_singleton()->add_task(_sort_render_list_task, &render_list);
+	}
 
 	glEnable(GL_BLEND);
 	glDepthMask(GL_TRUE);
@@ -4476,7 +4999,13 @@ void RasterizerSceneGLES3::render_scene(const Transform &p_cam_transform, const
 		glDisable(GL_BLEND);
 	}
 
-	render_list.sort_by_key(false);
+	if (sort_async) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(sort_task);
+	} else {
+		render_list.sort_by_key_cached(RenderList::SORT_CACHE_OPAQUE);
+	}
+
+	_gpu_timer_begin(GPUTimers::PASS_OPAQUE);
 
 	if (state.directional_light_count == 0) {
 		directional_light = NULL;
@@ -4492,6 +5021,8 @@ void RasterizerSceneGLES3::render_scene(const Transform &p_cam_transform, const
 		}
 	}
 
+	_gpu_timer_end();
+
 	state.scene_shader.set_conditional(SceneShaderGLES3::USE_MULTIPLE_RENDER_TARGETS, false);
 
 	if (use_mrt) {
@@ -4562,7 +5093,9 @@ void RasterizerSceneGLES3::render_scene(const Transform &p_cam_transform, const
 	glEnable(GL_DEPTH_TEST);
 	glDisable(GL_SCISSOR_TEST);
 
-	render_list.sort_by_reverse_depth_and_priority(true);
+	render_list.sort_alpha_cached();
+
+	_gpu_timer_begin(GPUTimers::PASS_TRANSPARENT);
 
 	if (state.directional_light_count == 0) {
 		directional_light = NULL;
@@ -4575,6 +5108,8 @@ void RasterizerSceneGLES3::render_scene(const Transform &p_cam_transform, const
 		}
 	}
 
+	_gpu_timer_end();
+
 	if (probe) {
 		//rendering a probe, do no more!
 		return;
@@ -4582,7 +5117,9 @@ void RasterizerSceneGLES3::render_scene(const Transform &p_cam_transform, const
 
 	if (env && (env->dof_blur_far_enabled || env->dof_blur_near_enabled) && storage->frame.current_rt && storage->frame.current_rt->buffers.active)
 		_prepare_depth_texture();
+	_gpu_timer_begin(GPUTimers::PASS_EFFECTS);
 	_post_process(env, p_cam_projection);
+	_gpu_timer_end();
 	// Needed only for debugging
 	/*	if (shadow_atlas && storage->frame.current_rt) {
 
@@ -4638,7 +5175,7 @@ void RasterizerSceneGLES3::render_scene(const Transform &p_cam_transform, const
 	//disable all stuff
 }
 
-void RasterizerSceneGLES3::render_shadow(RID p_light, RID p_shadow_atlas, int p_pass, InstanceBase **p_cull_result, int p_cull_count) {
+void RasterizerSceneGLES3::render_shadow(RID p_light, RID p_shadow_atlas, int p_pass, InstanceBase **p_cull_result, int p_cull_count, bool p_clear_region) {
 
 	render_pass++;
 
@@ -4820,6 +5357,8 @@ void RasterizerSceneGLES3::render_shadow(RID p_light, RID p_shadow_atlas, int p_
 
 	render_list.sort_by_depth(false); //shadow is front to back for performance
 
+	_gpu_timer_begin(GPUTimers::PASS_SHADOW);
+
 	glDisable(GL_BLEND);
 	glDisable(GL_DITHER);
 	glEnable(GL_DEPTH_TEST);
@@ -4836,10 +5375,12 @@ void RasterizerSceneGLES3::render_shadow(RID p_light, RID p_shadow_atlas, int p_
 		glScissor(x, y, width, height);
 	}
 
-	glEnable(GL_SCISSOR_TEST);
-	glClearDepth(1.0f);
-	glClear(GL_DEPTH_BUFFER_BIT);
-	glDisable(GL_SCISSOR_TEST);
+	if (p_clear_region) {
+		glEnable(GL_SCISSOR_TEST);
+		glClearDepth(1.0f);
+		glClear(GL_DEPTH_BUFFER_BIT);
+		glDisable(GL_SCISSOR_TEST);
+	}
 
 	state.ubo_data.z_offset = bias;
 	state.ubo_data.z_slope_scale = normal_bias;
@@ -4904,6 +5445,8 @@ void RasterizerSceneGLES3::render_shadow(RID p_light, RID p_shadow_atlas, int p_
 	}
 
 	glColorMask(1, 1, 1, 1);
+
+	_gpu_timer_end();
 }
 
 void RasterizerSceneGLES3::set_scene_pass(uint64_t p_pass) {
@@ -4981,6 +5524,24 @@ void RasterizerSceneGLES3::initialize() {
 
 	render_pass = 0;
 
+	shadow_static_cache_enabled = GLOBAL_DEF("rendering/quality/shadows/static_shadow_cache", true);
+
+	bool gpu_profiling = GLOBAL_DEF("rendering/gles3/gpu_profiling", true);
+#ifdef GLES_OVER_GL
+	gpu_timers.enabled = gpu_profiling;
+	if (gpu_timers.enabled) {
+		for (int i = 0; i < 2; i++) {
+			GLuint ids[GPUTimers::MAX_QUERIES];
+			glGenQueries(GPUTimers::MAX_QUERIES, ids);
+			for (int j = 0; j < GPUTimers::MAX_QUERIES; j++) {
+				gpu_timers.queries[i][j].id = ids[j];
+			}
+		}
+	}
+#else
+	(void)gpu_profiling; //timer queries are not core in ES 3.0
+#endif
+
 	state.scene_shader.init();
 
 	{
@@ -5150,6 +5711,12 @@ void RasterizerSceneGLES3::initialize() {
 
 		state.max_forward_lights_per_object = 8;
 
+		state.use_light_clusters = GLOBAL_DEF("rendering/quality/shading/use_light_clusters", false);
+	state.dof_half_resolution = GLOBAL_DEF("rendering/quality/depth_of_field/half_resolution", false);
+	state.auto_instancing = GLOBAL_DEF("rendering/quality/auto_instancing/enable", true);
+		state.cluster_enabled = false;
+		state.cluster_texture = 0;
+
 		state.scene_shader.add_custom_define("#define MAX_LIGHT_DATA_STRUCTS " + itos(state.max_ubo_lights) + "\n");
 		state.scene_shader.add_custom_define("#define MAX_FORWARD_LIGHTS " + itos(state.max_forward_lights_per_object) + "\n");
 
@@ -5234,12 +5801,21 @@ void RasterizerSceneGLES3::initialize() {
 		uint32_t immediate_buffer_size = GLOBAL_DEF("rendering/limits/buffers/immediate_buffer_size_kb", 2048);
 		ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/buffers/immediate_buffer_size_kb", PropertyInfo(Variant::INT, "rendering/limits/buffers/immediate_buffer_size_kb", PROPERTY_HINT_RANGE, "0,8192,1,or_greater"));
 
-		glGenBuffers(1, &state.immediate_buffer);
-		glBindBuffer(GL_ARRAY_BUFFER, state.immediate_buffer);
-		glBufferData(GL_ARRAY_BUFFER, immediate_buffer_size * 1024, NULL, GL_DYNAMIC_DRAW);
+		//scratch buffer holding the transforms of automatically instanced meshes
+		glGenBuffers(1, &state.auto_instance_buffer);
+		glBindBuffer(GL_ARRAY_BUFFER, state.auto_instance_buffer);
+		glBufferData(GL_ARRAY_BUFFER, AUTO_INSTANCE_MAX * 12 * sizeof(float), NULL, GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		glGenBuffers(3, state.immediate_buffers);
+		for (int i = 0; i < 3; i++) {
+			glBindBuffer(GL_ARRAY_BUFFER, state.immediate_buffers[i]);
+			glBufferData(GL_ARRAY_BUFFER, immediate_buffer_size * 1024, NULL, GL_DYNAMIC_DRAW);
+		}
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
 
-		glGenVertexArrays(1, &state.immediate_array);
+		glGenVertexArrays(3, state.immediate_arrays);
+		state.immediate_buffer_index = 0;
 	}
 
 #ifdef GLES_OVER_GL
@@ -5310,6 +5886,8 @@ void RasterizerSceneGLES3::initialize() {
 
 void RasterizerSceneGLES3::iteration() {
 
+	_gpu_timers_resolve();
+
 	shadow_filter_mode = ShadowFilterMode(int(GLOBAL_GET("rendering/quality/shadows/filter_mode")));
 	subsurface_scatter_follow_surface = GLOBAL_GET("rendering/quality/subsurface_scattering/follow_surface");
 	subsurface_scatter_weight_samples = GLOBAL_GET("rendering/quality/subsurface_scattering/weight_samples");
@@ -92,6 +92,27 @@ public:
 	Vector<RasterizerStorageGLES3::RenderTarget::Exposure> exposure_shrink;
 	int exposure_shrink_size;
 
+	enum {
+		// Must match the cluster constants in scene.glsl.
+		CLUSTER_GRID_WIDTH = 16,
+		CLUSTER_GRID_HEIGHT = 8,
+		CLUSTER_DEPTH_SLICES = 16,
+		CLUSTER_CELL_COUNT = CLUSTER_GRID_WIDTH * CLUSTER_GRID_HEIGHT * CLUSTER_DEPTH_SLICES,
+		CLUSTER_MAX_LIGHTS_PER_CELL = 32,
+		CLUSTER_CELL_TEXELS = CLUSTER_MAX_LIGHTS_PER_CELL + 1, // First texel holds the packed omni/spot counts.
+	};
+
+	enum {
+		AUTO_INSTANCE_MAX = 256, //max mesh instances merged into one instanced draw
+	};
+
+	struct ClusterLight {
+		Vector3 center; //view space
+		float radius;
+		uint32_t index; //index into the omni or spot UBO array
+		bool spot;
+	};
+
 	struct State {
 
 		bool texscreen_copied;
@@ -100,6 +121,7 @@ public:
 		int current_depth_draw;
 		bool current_depth_test;
 		GLuint current_main_tex;
+		GLuint current_material_ubo;
 
 		SceneShaderGLES3 scene_shader;
 		CubeToDpShaderGLES3 cube_to_dp_shader;
@@ -180,8 +202,14 @@ public:
 		GLuint omni_array_ubo;
 		GLuint reflection_array_ubo;
 
-		GLuint immediate_buffer;
-		GLuint immediate_array;
+		// ring of streaming buffers for immediates, so uploading a chunk does
+		// not sync against a previous chunk's still-pending draw
+		GLuint immediate_buffers[3];
+		GLuint immediate_arrays[3];
+		int immediate_buffer_index;
+
+		GLuint auto_instance_buffer;
+		float auto_instance_data[AUTO_INSTANCE_MAX * 12];
 
 		uint32_t ubo_light_size;
 		uint8_t *spot_array_tmp;
@@ -193,6 +221,17 @@ public:
 		int max_ubo_reflections;
 		int max_skeleton_bones;
 
+		bool use_light_clusters;
+		bool auto_instancing; //project setting
+		bool dof_half_resolution; //project setting
+		bool cluster_enabled; //this frame
+		GLuint cluster_texture;
+		Vector<uint32_t> cluster_data;
+		Vector<ClusterLight> cluster_lights;
+		float cluster_z_near;
+		float cluster_depth_scale;
+		Vector2 cluster_screen_scale;
+
 		bool used_contact_shadows;
 
 		int spot_light_count;
@@ -255,6 +294,9 @@ public:
 		GLuint fbo;
 		GLuint depth;
 
+		GLuint static_fbo; //static caster depth cache, same layout as depth
+		GLuint static_depth;
+
 		Map<RID, uint32_t> shadow_owners;
 	};
 
@@ -269,11 +311,53 @@ public:
 
 	RID_Owner<ShadowAtlas> shadow_atlas_owner;
 
+	bool shadow_static_cache_enabled;
+
+	/* GPU PASS TIMERS */
+
+	struct GPUTimers {
+
+		enum {
+			MAX_QUERIES = 64,
+			PASS_SHADOW = 0,
+			PASS_OPAQUE = 1,
+			PASS_TRANSPARENT = 2,
+			PASS_EFFECTS = 3,
+			PASS_MAX = 4
+		};
+
+		struct Query {
+			GLuint id;
+			uint8_t pass;
+		};
+
+		Query queries[2][MAX_QUERIES]; //double buffered, resolved one frame later
+		int query_count[2];
+		int frame; //parity currently being recorded
+		bool enabled;
+		bool section_open;
+
+		GPUTimers() {
+			query_count[0] = 0;
+			query_count[1] = 0;
+			frame = 0;
+			enabled = false;
+			section_open = false;
+		}
+	} gpu_timers;
+
+	void _gpu_timer_begin(int p_pass);
+	void _gpu_timer_end();
+	void _gpu_timers_resolve();
+
 	RID shadow_atlas_create();
 	void shadow_atlas_set_size(RID p_atlas, int p_size);
 	void shadow_atlas_set_quadrant_subdivision(RID p_atlas, int p_quadrant, int p_subdivision);
 	bool _shadow_atlas_find_shadow(ShadowAtlas *shadow_atlas, int *p_in_quadrants, int p_quadrant_count, int p_current_subdiv, uint64_t p_tick, int &r_quadrant, int &r_shadow);
 	bool shadow_atlas_update_light(RID p_atlas, RID p_light_intance, float p_coverage, uint64_t p_light_version);
+	bool _shadow_atlas_shadow_rect(ShadowAtlas *shadow_atlas, RID p_light_intance, int p_pass, uint32_t &r_x, uint32_t &r_y, uint32_t &r_width, uint32_t &r_height);
+	virtual bool shadow_atlas_cache_shadow(RID p_atlas, RID p_light_intance, int p_pass, bool p_to_cache);
+	virtual bool is_shadow_atlas_static_cache_enabled(RID p_atlas);
 
 	struct DirectionalShadow {
 		GLuint fbo;
@@ -784,6 +868,91 @@ public:
 			}
 		}
 
+		//In mostly static scenes the list content is usually identical to the
+		//previous frame, so the sorted permutation can be reused instead of
+		//sorting again. The hash is order sensitive, which also verifies the
+		//fill order matched. Separate slots, since several lists are built per
+		//frame (depth prepass, opaque, alpha).
+
+		enum {
+			SORT_CACHE_DEPTH = 0,
+			SORT_CACHE_OPAQUE = 1,
+			SORT_CACHE_ALPHA = 2,
+			SORT_CACHE_COUNT = 3
+		};
+
+		struct SortCache {
+			Vector<uint32_t> order; //indices into base_elements, in sorted order
+			uint64_t hash;
+			int count;
+		} sort_cache[SORT_CACHE_COUNT];
+
+		void sort_by_key_cached(int p_cache) {
+
+			uint64_t h = 14695981039346656037ULL;
+			for (int i = 0; i < element_count; i++) {
+				h = (h ^ uint64_t(uintptr_t(elements[i]->instance))) * 1099511628211ULL;
+				h = (h ^ elements[i]->sort_key) * 1099511628211ULL;
+			}
+
+			SortCache &cache = sort_cache[p_cache];
+
+			if (element_count == cache.count && h == cache.hash) {
+				const uint32_t *order = cache.order.ptr();
+				for (int i = 0; i < element_count; i++) {
+					elements[i] = &base_elements[order[i]];
+				}
+				return;
+			}
+
+			sort_by_key(false);
+
+			cache.order.resize(element_count);
+			uint32_t *order = cache.order.ptrw();
+			for (int i = 0; i < element_count; i++) {
+				order[i] = uint32_t(elements[i] - base_elements);
+			}
+			cache.hash = h;
+			cache.count = element_count;
+		}
+
+		void sort_alpha_cached() {
+
+			Element **alpha = &elements[max_elements - alpha_element_count];
+
+			uint64_t h = 14695981039346656037ULL;
+			for (int i = 0; i < alpha_element_count; i++) {
+				union {
+					float f;
+					uint32_t u;
+				} depth;
+				depth.f = alpha[i]->instance->depth;
+				h = (h ^ uint64_t(uintptr_t(alpha[i]->instance))) * 1099511628211ULL;
+				h = (h ^ alpha[i]->sort_key) * 1099511628211ULL;
+				h = (h ^ depth.u) * 1099511628211ULL;
+			}
+
+			SortCache &cache = sort_cache[SORT_CACHE_ALPHA];
+
+			if (alpha_element_count == cache.count && h == cache.hash) {
+				const uint32_t *order = cache.order.ptr();
+				for (int i = 0; i < alpha_element_count; i++) {
+					alpha[i] = &base_elements[order[i]];
+				}
+				return;
+			}
+
+			sort_by_reverse_depth_and_priority(true);
+
+			cache.order.resize(alpha_element_count);
+			uint32_t *order = cache.order.ptrw();
+			for (int i = 0; i < alpha_element_count; i++) {
+				order[i] = uint32_t(alpha[i] - base_elements);
+			}
+			cache.hash = h;
+			cache.count = alpha_element_count;
+		}
+
 		_FORCE_INLINE_ Element *add_element() {
 
 			if (element_count + alpha_element_count >= max_elements)
@@ -817,6 +986,11 @@ public:
 			max_elements = DEFAULT_MAX_ELEMENTS;
 			max_lights = DEFAULT_MAX_LIGHTS;
 			max_reflections = DEFAULT_MAX_REFLECTIONS;
+
+			for (int i = 0; i < SORT_CACHE_COUNT; i++) {
+				sort_cache[i].hash = 0;
+				sort_cache[i].count = -1;
+			}
 		}
 
 		~RenderList() {
@@ -837,6 +1011,10 @@ public:
 	_FORCE_INLINE_ void _render_geometry(RenderList::Element *e);
 	_FORCE_INLINE_ void _setup_light(RenderList::Element *e, const Transform &p_view_transform);
 
+	_FORCE_INLINE_ bool _auto_instance_compatible(RenderList::Element *e, RenderList::Element *e2, bool p_check_lighting);
+	_FORCE_INLINE_ void _setup_auto_instances(RenderList::Element **p_elements, int p_count);
+	_FORCE_INLINE_ void _render_auto_instances(RenderList::Element *e, int p_count);
+
 	void _render_list(RenderList::Element **p_elements, int p_element_count, const Transform &p_view_transform, const CameraMatrix &p_projection, RasterizerStorageGLES3::Sky *p_sky, bool p_reverse_cull, bool p_alpha_pass, bool p_shadow, bool p_directional_add, bool p_directional_shadows);
 
 	_FORCE_INLINE_ void _add_geometry(RasterizerStorageGLES3::Geometry *p_geometry, InstanceBase *p_instance, RasterizerStorageGLES3::GeometryOwner *p_owner, int p_material, bool p_depth_pass, bool p_shadow_pass);
@@ -848,12 +1026,14 @@ public:
 	void _setup_environment(Environment *env, const CameraMatrix &p_cam_projection, const Transform &p_cam_transform, bool p_no_fog = false);
 	void _setup_directional_light(int p_index, const Transform &p_camera_inverse_transform, bool p_use_shadows);
 	void _setup_lights(RID *p_light_cull_result, int p_light_cull_count, const Transform &p_camera_inverse_transform, const CameraMatrix &p_camera_projection, RID p_shadow_atlas);
+	void _update_light_clusters(const CameraMatrix &p_projection);
 	void _setup_reflections(RID *p_reflection_probe_cull_result, int p_reflection_probe_cull_count, const Transform &p_camera_inverse_transform, const CameraMatrix &p_camera_projection, RID p_reflection_atlas, Environment *p_env);
 
 	void _copy_screen(bool p_invalidate_color = false, bool p_invalidate_depth = false);
 	void _copy_texture_to_front_buffer(GLuint p_texture); //used for debug
 
 	void _fill_render_list(InstanceBase **p_cull_result, int p_cull_count, bool p_depth_pass, bool p_shadow_pass);
+	static void _sort_render_list_task(void *p_userdata);
 
 	void _blur_effect_buffer();
 	void _render_mrts(Environment *env, const CameraMatrix &p_cam_projection);
@@ -863,7 +1043,7 @@ public:
 	void _bind_depth_texture();
 
 	virtual void render_scene(const Transform &p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_ortogonal, InstanceBase **p_cull_result, int p_cull_count, RID *p_light_cull_result, int p_light_cull_count, RID *p_reflection_probe_cull_result, int p_reflection_probe_cull_count, RID p_environment, RID p_shadow_atlas, RID p_reflection_atlas, RID p_reflection_probe, int p_reflection_probe_pass);
-	virtual void render_shadow(RID p_light, RID p_shadow_atlas, int p_pass, InstanceBase **p_cull_result, int p_cull_count);
+	virtual void render_shadow(RID p_light, RID p_shadow_atlas, int p_pass, InstanceBase **p_cull_result, int p_cull_count, bool p_clear_region = true);
 	virtual bool free(RID p_rid);
 
 	virtual void set_scene_pass(uint64_t p_pass);
@@ -748,6 +748,36 @@ void RasterizerStorageGLES3::texture_allocate(RID p_texture, int p_width, int p_
 	texture->active = true;
 }
 
+void RasterizerStorageGLES3::_pbo_upload(GLenum p_target, int p_level, int p_x, int p_y, int p_w, int p_h, GLenum p_format, GLenum p_type, const uint8_t *p_data, uint32_t p_size) {
+
+	//stage frequently updated textures through a pixel buffer ring, so
+	//glTexSubImage2D returns as soon as the copy is queued instead of
+	//blocking until the GPU is done with the previous contents
+
+	if (!pbo_ring.buffers[pbo_ring.current]) {
+		glGenBuffers(1, &pbo_ring.buffers[pbo_ring.current]);
+	}
+
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo_ring.buffers[pbo_ring.current]);
+	glBufferData(GL_PIXEL_UNPACK_BUFFER, p_size, NULL, GL_STREAM_DRAW); //orphan, never wait on an upload still in flight
+
+	void *mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, p_size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+	if (mapped) {
+		copymem(mapped, p_data, p_size);
+		glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+		glTexSubImage2D(p_target, p_level, p_x, p_y, p_w, p_h, p_format, p_type, NULL); //sourced from the bound PBO
+	} else {
+		//mapping can fail on context loss, upload directly
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		glTexSubImage2D(p_target, p_level, p_x, p_y, p_w, p_h, p_format, p_type, p_data);
+		return;
+	}
+
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+	pbo_ring.current = (pbo_ring.current + 1) % PBORing::RING_SIZE;
+}
+
 void RasterizerStorageGLES3::texture_set_data(RID p_texture, const Ref<Image> &p_image, int p_layer) {
 
 	Texture *texture = texture_owner.get(p_texture);
@@ -921,7 +951,7 @@ void RasterizerStorageGLES3::texture_set_data(RID p_texture, const Ref<Image> &p
 			} else {
 				glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 				if (texture->flags & VS::TEXTURE_FLAG_USED_FOR_STREAMING) {
-					glTexSubImage2D(blit_target, i, 0, 0, w, h, format, type, &read[ofs]);
+					_pbo_upload(blit_target, i, 0, 0, w, h, format, type, &read[ofs], size);
 				} else {
 					glTexImage2D(blit_target, i, internal_format, w, h, 0, format, type, &read[ofs]);
 				}
@@ -1039,7 +1069,7 @@ void RasterizerStorageGLES3::texture_set_data_partial(RID p_texture, const Ref<I
 		} else {
 			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 			// `format` has to match the internal_format used when the texture was created
-			glTexSubImage2D(blit_target, p_dst_mip, dst_x, dst_y, src_w, src_h, format, type, &read[src_ofs]);
+			_pbo_upload(blit_target, p_dst_mip, dst_x, dst_y, src_w, src_h, format, type, &read[src_ofs], src_data_size);
 		}
 	} else {
 		if (texture->compressed) {
@@ -2264,6 +2294,7 @@ void RasterizerStorageGLES3::_update_shader(Shader *p_shader) const {
 			p_shader->canvas_item.uses_screen_texture = false;
 			p_shader->canvas_item.uses_screen_uv = false;
 			p_shader->canvas_item.uses_time = false;
+			p_shader->canvas_item.uses_custom_light = false;
 
 			shaders.actions_canvas.render_mode_values["blend_add"] = Pair<int *, int>(&p_shader->canvas_item.blend_mode, Shader::CanvasItem::BLEND_MODE_ADD);
 			shaders.actions_canvas.render_mode_values["blend_mix"] = Pair<int *, int>(&p_shader->canvas_item.blend_mode, Shader::CanvasItem::BLEND_MODE_MIX);
@@ -2279,6 +2310,7 @@ void RasterizerStorageGLES3::_update_shader(Shader *p_shader) const {
 			shaders.actions_canvas.usage_flag_pointers["SCREEN_PIXEL_SIZE"] = &p_shader->canvas_item.uses_screen_uv;
 			shaders.actions_canvas.usage_flag_pointers["SCREEN_TEXTURE"] = &p_shader->canvas_item.uses_screen_texture;
 			shaders.actions_canvas.usage_flag_pointers["TIME"] = &p_shader->canvas_item.uses_time;
+			shaders.actions_canvas.usage_flag_pointers["LIGHT"] = &p_shader->canvas_item.uses_custom_light;
 
 			actions = &shaders.actions_canvas;
 			actions->uniforms = &p_shader->uniforms;
@@ -2577,10 +2609,15 @@ void RasterizerStorageGLES3::material_set_param(RID p_material, const StringName
 	Material *material = material_owner.get(p_material);
 	ERR_FAIL_COND(!material);
 
-	if (p_value.get_type() == Variant::NIL)
-		material->params.erase(p_param);
-	else
+	if (p_value.get_type() == Variant::NIL) {
+		if (!material->params.erase(p_param))
+			return; //not set, nothing to reupload
+	} else {
+		Map<StringName, Variant>::Element *E = material->params.find(p_param);
+		if (E && E->get() == p_value)
+			return; //unchanged, keep the UBO as is
 		material->params[p_param] = p_value;
+	}
 
 	_material_make_dirty(material);
 }
@@ -3271,7 +3308,7 @@ void RasterizerStorageGLES3::_update_material(Material *material) {
 		}
 
 		glBindBuffer(GL_UNIFORM_BUFFER, material->ubo_id);
-		glBufferData(GL_UNIFORM_BUFFER, material->ubo_size, local_ubo, GL_STATIC_DRAW);
+		glBufferSubData(GL_UNIFORM_BUFFER, 0, material->ubo_size, local_ubo); //buffer was sized on creation, update in place
 		glBindBuffer(GL_UNIFORM_BUFFER, 0);
 	}
 
@@ -4611,6 +4648,7 @@ void RasterizerStorageGLES3::multimesh_allocate(RID p_multimesh, int p_instances
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
 	}
 
+	multimesh->mark_dirty_region(0, multimesh->size);
 	multimesh->dirty_data = true;
 	multimesh->dirty_aabb = true;
 
@@ -4678,6 +4716,7 @@ void RasterizerStorageGLES3::multimesh_instance_set_transform(RID p_multimesh, i
 	dataptr[10] = p_transform.basis.elements[2][2];
 	dataptr[11] = p_transform.origin.z;
 
+	multimesh->mark_dirty_region(p_index, 1);
 	multimesh->dirty_data = true;
 	multimesh->dirty_aabb = true;
 
@@ -4705,6 +4744,7 @@ void RasterizerStorageGLES3::multimesh_instance_set_transform_2d(RID p_multimesh
 	dataptr[6] = 0;
 	dataptr[7] = p_transform.elements[2][1];
 
+	multimesh->mark_dirty_region(p_index, 1);
 	multimesh->dirty_data = true;
 	multimesh->dirty_aabb = true;
 
@@ -4738,6 +4778,7 @@ void RasterizerStorageGLES3::multimesh_instance_set_color(RID p_multimesh, int p
 		dataptr[3] = p_color.a;
 	}
 
+	multimesh->mark_dirty_region(p_index, 1);
 	multimesh->dirty_data = true;
 	multimesh->dirty_aabb = true;
 
@@ -4772,6 +4813,7 @@ void RasterizerStorageGLES3::multimesh_instance_set_custom_data(RID p_multimesh,
 		dataptr[3] = p_custom_data.a;
 	}
 
+	multimesh->mark_dirty_region(p_index, 1);
 	multimesh->dirty_data = true;
 	multimesh->dirty_aabb = true;
 
@@ -4916,6 +4958,34 @@ void RasterizerStorageGLES3::multimesh_set_as_bulk_array(RID p_multimesh, const
 	PoolVector<float>::Read r = p_array.read();
 	copymem(multimesh->data.ptrw(), r.ptr(), dsize * sizeof(float));
 
+	multimesh->mark_dirty_region(0, multimesh->size);
+	multimesh->dirty_data = true;
+	multimesh->dirty_aabb = true;
+
+	if (!multimesh->update_list.in_list()) {
+		multimesh_update_list.add(&multimesh->update_list);
+	}
+}
+
+void RasterizerStorageGLES3::multimesh_set_buffer_region(RID p_multimesh, int p_instance_from, const PoolVector<float> &p_array) {
+
+	MultiMesh *multimesh = multimesh_owner.getornull(p_multimesh);
+	ERR_FAIL_COND(!multimesh);
+	ERR_FAIL_COND(!multimesh->data.ptr());
+
+	int stride = multimesh->color_floats + multimesh->xform_floats + multimesh->custom_data_floats;
+	int asize = p_array.size();
+
+	ERR_FAIL_COND(asize % stride != 0);
+
+	int instances = asize / stride;
+	ERR_FAIL_INDEX(p_instance_from, multimesh->size);
+	ERR_FAIL_COND(p_instance_from + instances > multimesh->size);
+
+	PoolVector<float>::Read r = p_array.read();
+	copymem(&multimesh->data.write[p_instance_from * stride], r.ptr(), asize * sizeof(float));
+
+	multimesh->mark_dirty_region(p_instance_from, instances);
 	multimesh->dirty_data = true;
 	multimesh->dirty_aabb = true;
 
@@ -4957,9 +5027,16 @@ void RasterizerStorageGLES3::update_dirty_multimeshes() {
 
 		if (multimesh->size && multimesh->dirty_data) {
 
-			glBindBuffer(GL_ARRAY_BUFFER, multimesh->buffer);
-			glBufferSubData(GL_ARRAY_BUFFER, 0, multimesh->data.size() * sizeof(float), multimesh->data.ptr());
-			glBindBuffer(GL_ARRAY_BUFFER, 0);
+			//upload only the dirty instance range
+			int stride = multimesh->color_floats + multimesh->xform_floats + multimesh->custom_data_floats;
+			int from = CLAMP(multimesh->dirty_from, 0, multimesh->size);
+			int to = CLAMP(multimesh->dirty_to, from, multimesh->size);
+
+			if (to > from) {
+				glBindBuffer(GL_ARRAY_BUFFER, multimesh->buffer);
+				glBufferSubData(GL_ARRAY_BUFFER, from * stride * sizeof(float), (to - from) * stride * sizeof(float), &multimesh->data.ptr()[from * stride]);
+				glBindBuffer(GL_ARRAY_BUFFER, 0);
+			}
 		}
 
 		if (multimesh->size && multimesh->dirty_aabb) {
@@ -5029,6 +5106,8 @@ void RasterizerStorageGLES3::update_dirty_multimeshes() {
 		}
 		multimesh->dirty_aabb = false;
 		multimesh->dirty_data = false;
+		multimesh->dirty_from = -1;
+		multimesh->dirty_to = 0;
 
 		multimesh->instance_change_notify(true, false);
 
@@ -5154,6 +5233,79 @@ void RasterizerStorageGLES3::immediate_clear(RID p_immediate) {
 	im->instance_change_notify(true, false);
 }
 
+void RasterizerStorageGLES3::immediate_set_buffer(RID p_immediate, VS::PrimitiveType p_primitive, const PoolVector<Vector3> &p_vertices, const PoolVector<Vector3> &p_normals, const PoolVector<Plane> &p_tangents, const PoolVector<Color> &p_colors, const PoolVector<Vector2> &p_uvs, const PoolVector<Vector2> &p_uv2s, RID p_texture) {
+
+	ERR_FAIL_INDEX(p_primitive, (int)VS::PRIMITIVE_MAX);
+	Immediate *im = immediate_owner.get(p_immediate);
+	ERR_FAIL_COND(!im);
+	ERR_FAIL_COND(im->building);
+
+	int vertex_count = p_vertices.size();
+	ERR_FAIL_COND(p_normals.size() != 0 && p_normals.size() != vertex_count);
+	ERR_FAIL_COND(p_tangents.size() != 0 && p_tangents.size() != vertex_count);
+	ERR_FAIL_COND(p_colors.size() != 0 && p_colors.size() != vertex_count);
+	ERR_FAIL_COND(p_uvs.size() != 0 && p_uvs.size() != vertex_count);
+	ERR_FAIL_COND(p_uv2s.size() != 0 && p_uv2s.size() != vertex_count);
+
+	im->chunks.clear();
+	im->mask = 0;
+	im->aabb = AABB();
+
+	if (vertex_count) {
+
+		Immediate::Chunk ic;
+		ic.texture = p_texture;
+		ic.primitive = p_primitive;
+
+		{
+			PoolVector<Vector3>::Read r = p_vertices.read();
+			ic.vertices.resize(vertex_count);
+			copymem(ic.vertices.ptrw(), r.ptr(), sizeof(Vector3) * vertex_count);
+
+			im->aabb.position = r[0];
+			for (int i = 1; i < vertex_count; i++) {
+				im->aabb.expand_to(r[i]);
+			}
+		}
+		im->mask |= VS::ARRAY_FORMAT_VERTEX;
+
+		if (p_normals.size()) {
+			PoolVector<Vector3>::Read r = p_normals.read();
+			ic.normals.resize(vertex_count);
+			copymem(ic.normals.ptrw(), r.ptr(), sizeof(Vector3) * vertex_count);
+			im->mask |= VS::ARRAY_FORMAT_NORMAL;
+		}
+		if (p_tangents.size()) {
+			PoolVector<Plane>::Read r = p_tangents.read();
+			ic.tangents.resize(vertex_count);
+			copymem(ic.tangents.ptrw(), r.ptr(), sizeof(Plane) * vertex_count);
+			im->mask |= VS::ARRAY_FORMAT_TANGENT;
+		}
+		if (p_colors.size()) {
+			PoolVector<Color>::Read r = p_colors.read();
+			ic.colors.resize(vertex_count);
+			copymem(ic.colors.ptrw(), r.ptr(), sizeof(Color) * vertex_count);
+			im->mask |= VS::ARRAY_FORMAT_COLOR;
+		}
+		if (p_uvs.size()) {
+			PoolVector<Vector2>::Read r = p_uvs.read();
+			ic.uvs.resize(vertex_count);
+			copymem(ic.uvs.ptrw(), r.ptr(), sizeof(Vector2) * vertex_count);
+			im->mask |= VS::ARRAY_FORMAT_TEX_UV;
+		}
+		if (p_uv2s.size()) {
+			PoolVector<Vector2>::Read r = p_uv2s.read();
+			ic.uvs2.resize(vertex_count);
+			copymem(ic.uvs2.ptrw(), r.ptr(), sizeof(Vector2) * vertex_count);
+			im->mask |= VS::ARRAY_FORMAT_TEX_UV2;
+		}
+
+		im->chunks.push_back(ic);
+	}
+
+	im->instance_change_notify(true, false);
+}
+
 AABB RasterizerStorageGLES3::immediate_get_aabb(RID p_immediate) const {
 
 	Immediate *im = immediate_owner.get(p_immediate);
@@ -5263,6 +5415,44 @@ void RasterizerStorageGLES3::skeleton_bone_set_transform(RID p_skeleton, int p_b
 	}
 }
 
+void RasterizerStorageGLES3::skeleton_set_bone_transforms(RID p_skeleton, const Vector<Transform> &p_transforms) {
+
+	Skeleton *skeleton = skeleton_owner.getornull(p_skeleton);
+
+	ERR_FAIL_COND(!skeleton);
+	ERR_FAIL_COND(p_transforms.size() > skeleton->size);
+	ERR_FAIL_COND(skeleton->use_2d);
+
+	float *texture = skeleton->skel_texture.ptrw();
+	const Transform *transforms = p_transforms.ptr();
+	int count = p_transforms.size();
+
+	for (int i = 0; i < count; i++) {
+
+		const Transform &t = transforms[i];
+		int base_ofs = ((i / 256) * 256) * 3 * 4 + (i % 256) * 4;
+
+		texture[base_ofs + 0] = t.basis[0].x;
+		texture[base_ofs + 1] = t.basis[0].y;
+		texture[base_ofs + 2] = t.basis[0].z;
+		texture[base_ofs + 3] = t.origin.x;
+		base_ofs += 256 * 4;
+		texture[base_ofs + 0] = t.basis[1].x;
+		texture[base_ofs + 1] = t.basis[1].y;
+		texture[base_ofs + 2] = t.basis[1].z;
+		texture[base_ofs + 3] = t.origin.y;
+		base_ofs += 256 * 4;
+		texture[base_ofs + 0] = t.basis[2].x;
+		texture[base_ofs + 1] = t.basis[2].y;
+		texture[base_ofs + 2] = t.basis[2].z;
+		texture[base_ofs + 3] = t.origin.z;
+	}
+
+	if (!skeleton->update_list.in_list()) {
+		skeleton_update_list.add(&skeleton->update_list);
+	}
+}
+
 Transform RasterizerStorageGLES3::skeleton_bone_get_transform(RID p_skeleton, int p_bone) const {
 
 	Skeleton *skeleton = skeleton_owner.getornull(p_skeleton);
@@ -6640,15 +6830,40 @@ void RasterizerStorageGLES3::_particles_process(Particles *p_particles, float p_
 	//*/
 }
 
+struct ParticlesUpdateSort {
+
+	_FORCE_INLINE_ bool operator()(const RasterizerStorageGLES3::Particles *A, const RasterizerStorageGLES3::Particles *B) const {
+		if (A->process_material == B->process_material) {
+			return A->fractional_delta < B->fractional_delta;
+		}
+		return A->process_material < B->process_material;
+	}
+};
+
 void RasterizerStorageGLES3::update_particles() {
 
 	glEnable(GL_RASTERIZER_DISCARD);
 
+	//drain the list up front and sort it, so systems sharing a process
+	//material are stepped back to back; with many small systems the program
+	//and texture rebinds per system cost more than the simulation itself
+	Vector<Particles *> update_list;
+
 	while (particle_update_list.first()) {
+		update_list.push_back(particle_update_list.first()->self());
+		particle_update_list.remove(particle_update_list.first());
+	}
+
+	update_list.sort_custom<ParticlesUpdateSort>();
+
+	Material *prev_material = NULL;
+	bool material_bound = false;
+
+	for (int up_idx = 0; up_idx < update_list.size(); up_idx++) {
 
 		//use transform feedback to process particles
 
-		Particles *particles = particle_update_list.first()->self();
+		Particles *particles = update_list[up_idx];
 
 		if (particles->restart_request) {
 			particles->prev_ticks = 0;
@@ -6662,7 +6877,6 @@ void RasterizerStorageGLES3::update_particles() {
 
 		if (particles->inactive && !particles->emitting) {
 
-			particle_update_list.remove(particle_update_list.first());
 			continue;
 		}
 
@@ -6682,13 +6896,14 @@ void RasterizerStorageGLES3::update_particles() {
 			particles->inactive_time += particles->speed_scale * frame.delta;
 			if (particles->inactive_time > particles->lifetime * 1.2) {
 				particles->inactive = true;
-				particle_update_list.remove(particle_update_list.first());
 				continue;
 			}
 		}
 
 		Material *material = material_owner.getornull(particles->process_material);
-		if (!material || !material->shader || material->shader->mode != VS::SHADER_PARTICLES) {
+		if (material_bound && material == prev_material) {
+			//same process material as the previous system, shader and textures are still bound
+		} else if (!material || !material->shader || material->shader->mode != VS::SHADER_PARTICLES) {
 
 			shaders.particles.set_custom_shader(0);
 		} else {
@@ -6742,6 +6957,9 @@ void RasterizerStorageGLES3::update_particles() {
 			}
 		}
 
+		prev_material = material;
+		material_bound = true;
+
 		shaders.particles.set_conditional(ParticlesShaderGLES3::USE_FRACTIONAL_DELTA, particles->fractional_delta);
 
 		shaders.particles.bind();
@@ -6804,8 +7022,6 @@ void RasterizerStorageGLES3::update_particles() {
 				_particles_process(particles, frame.delta);
 		}
 
-		particle_update_list.remove(particle_update_list.first());
-
 		if (particles->histories_enabled) {
 
 			SWAP(particles->particle_buffer_histories[0], particles->particle_buffer_histories[1]);
@@ -7671,6 +7887,7 @@ RID RasterizerStorageGLES3::canvas_light_occluder_create() {
 	co->index_id = 0;
 	co->vertex_id = 0;
 	co->len = 0;
+	co->version = 0;
 	glGenVertexArrays(1, &co->array_id);
 
 	return canvas_occluder_owner.make_rid(co);
@@ -7682,6 +7899,7 @@ void RasterizerStorageGLES3::canvas_light_occluder_set_polylines(RID p_occluder,
 	ERR_FAIL_COND(!co);
 
 	co->lines = p_lines;
+	co->version++;
 
 	if (p_lines.size() != co->len) {
 
@@ -8133,6 +8351,14 @@ int RasterizerStorageGLES3::get_render_info(VS::RenderInfo p_info) {
 			return info.texture_mem;
 		case VS::INFO_VERTEX_MEM_USED:
 			return info.vertex_mem;
+		case VS::INFO_GPU_SHADOW_TIME:
+			return info.gpu_shadow_time_us;
+		case VS::INFO_GPU_OPAQUE_TIME:
+			return info.gpu_opaque_time_us;
+		case VS::INFO_GPU_TRANSPARENT_TIME:
+			return info.gpu_transparent_time_us;
+		case VS::INFO_GPU_EFFECTS_TIME:
+			return info.gpu_effects_time_us;
 		default:
 			return 0; //no idea either
 	}
@@ -8346,6 +8572,14 @@ void RasterizerStorageGLES3::initialize() {
 		glGenVertexArrays(1, &resources.transform_feedback_array);
 	}
 
+	{
+		//pixel buffer ring for streaming texture uploads
+		for (int i = 0; i < PBORing::RING_SIZE; i++) {
+			pbo_ring.buffers[i] = 0;
+		}
+		pbo_ring.current = 0;
+	}
+
 	shaders.cubemap_filter.init();
 	bool ggx_hq = GLOBAL_GET("rendering/quality/reflections/high_quality_ggx");
 	shaders.cubemap_filter.set_conditional(CubemapFilterShaderGLES3::LOW_QUALITY, !ggx_hq);
@@ -142,6 +142,16 @@ public:
 
 	} resources;
 
+	struct PBORing {
+
+		enum { RING_SIZE = 2 };
+
+		GLuint buffers[RING_SIZE]; //lazily created
+		int current;
+	} pbo_ring;
+
+	void _pbo_upload(GLenum p_target, int p_level, int p_x, int p_y, int p_w, int p_h, GLenum p_format, GLenum p_type, const uint8_t *p_data, uint32_t p_size);
+
 	struct Info {
 
 		uint64_t texture_mem;
@@ -165,10 +175,20 @@ public:
 			}
 		} render, render_final, snap;
 
+		//per-pass GPU times of the last resolved frame, written by the scene renderer
+		uint32_t gpu_shadow_time_us;
+		uint32_t gpu_opaque_time_us;
+		uint32_t gpu_transparent_time_us;
+		uint32_t gpu_effects_time_us;
+
 		Info() {
 
 			texture_mem = 0;
 			vertex_mem = 0;
+			gpu_shadow_time_us = 0;
+			gpu_opaque_time_us = 0;
+			gpu_transparent_time_us = 0;
+			gpu_effects_time_us = 0;
 			render.reset();
 			render_final.reset();
 		}
@@ -454,6 +474,7 @@ public:
 			bool uses_screen_texture;
 			bool uses_screen_uv;
 			bool uses_time;
+			bool uses_custom_light;
 
 		} canvas_item;
 
@@ -787,6 +808,9 @@ public:
 		bool dirty_aabb;
 		bool dirty_data;
 
+		int dirty_from; //dirty instance range, -1 when empty
+		int dirty_to;
+
 		MultiMesh() :
 				size(0),
 				transform_format(VS::MULTIMESH_TRANSFORM_2D),
@@ -800,7 +824,18 @@ public:
 				color_floats(0),
 				custom_data_floats(0),
 				dirty_aabb(true),
-				dirty_data(true) {
+				dirty_data(true),
+				dirty_from(-1),
+				dirty_to(0) {
+		}
+
+		_FORCE_INLINE_ void mark_dirty_region(int p_index, int p_count) {
+			if (dirty_from < 0 || p_index < dirty_from) {
+				dirty_from = p_index;
+			}
+			if (p_index + p_count > dirty_to) {
+				dirty_to = p_index + p_count;
+			}
 		}
 	};
 
@@ -829,6 +864,7 @@ public:
 	virtual Color multimesh_instance_get_custom_data(RID p_multimesh, int p_index) const;
 
 	virtual void multimesh_set_as_bulk_array(RID p_multimesh, const PoolVector<float> &p_array);
+	virtual void multimesh_set_buffer_region(RID p_multimesh, int p_instance_from, const PoolVector<float> &p_array);
 
 	virtual void multimesh_set_visible_instances(RID p_multimesh, int p_visible);
 	virtual int multimesh_get_visible_instances(RID p_multimesh) const;
@@ -881,6 +917,7 @@ public:
 	virtual void immediate_uv2(RID p_immediate, const Vector2 &tex_uv);
 	virtual void immediate_end(RID p_immediate);
 	virtual void immediate_clear(RID p_immediate);
+	virtual void immediate_set_buffer(RID p_immediate, VS::PrimitiveType p_primitive, const PoolVector<Vector3> &p_vertices, const PoolVector<Vector3> &p_normals, const PoolVector<Plane> &p_tangents, const PoolVector<Color> &p_colors, const PoolVector<Vector2> &p_uvs, const PoolVector<Vector2> &p_uv2s, RID p_texture = RID());
 	virtual void immediate_set_material(RID p_immediate, RID p_material);
 	virtual RID immediate_get_material(RID p_immediate) const;
 	virtual AABB immediate_get_aabb(RID p_immediate) const;
@@ -914,6 +951,7 @@ public:
 	virtual void skeleton_allocate(RID p_skeleton, int p_bones, bool p_2d_skeleton = false);
 	virtual int skeleton_get_bone_count(RID p_skeleton) const;
 	virtual void skeleton_bone_set_transform(RID p_skeleton, int p_bone, const Transform &p_transform);
+	virtual void skeleton_set_bone_transforms(RID p_skeleton, const Vector<Transform> &p_transforms);
 	virtual Transform skeleton_bone_get_transform(RID p_skeleton, int p_bone) const;
 	virtual void skeleton_bone_set_transform_2d(RID p_skeleton, int p_bone, const Transform2D &p_transform);
 	virtual Transform2D skeleton_bone_get_transform_2d(RID p_skeleton, int p_bone) const;
@@ -1429,6 +1467,7 @@ public:
 		GLuint index_id; // 0 means, unconfigured
 		PoolVector<Vector2> lines;
 		int len;
+		uint64_t version; //bumped on every polyline update, lets the canvas batch occluders
 	};
 
 	RID_Owner<CanvasOccluder> canvas_occluder_owner;
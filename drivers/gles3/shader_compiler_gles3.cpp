@@ -842,6 +842,8 @@ Error ShaderCompilerGLES3::compile(VS::ShaderMode p_mode, const String &p_code,
 		return err;
 	}
 
+	parser.optimize();
+
 	r_gen_code.defines.clear();
 	r_gen_code.vertex = String();
 	r_gen_code.vertex_global = String();
@@ -30,7 +30,16 @@
 
 #include "shader_gles3.h"
 
+#include "core/os/dir_access.h"
+#include "core/os/file_access.h"
 #include "core/print_string.h"
+#include "core/project_settings.h"
+
+#ifndef GLES_OVER_GL
+//program binary functions are core in OpenGL ES 3.0; the bundled GL 3.3
+//headers used on desktop do not expose ARB_get_program_binary
+#define GLES3_HAS_PROGRAM_BINARY
+#endif
 
 //#define DEBUG_OPENGL
 
@@ -51,6 +60,147 @@
 
 ShaderGLES3 *ShaderGLES3::active = NULL;
 
+bool ShaderGLES3::shader_cache_enabled = false;
+String ShaderGLES3::shader_cache_dir;
+uint64_t ShaderGLES3::shader_cache_driver_hash = 0;
+
+void ShaderGLES3::init_shader_cache() {
+
+	shader_cache_enabled = GLOBAL_DEF("rendering/gles3/shader_cache", true);
+
+#ifdef GLES3_HAS_PROGRAM_BINARY
+	if (!shader_cache_enabled)
+		return;
+
+	GLint formats = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+	if (formats == 0) {
+		shader_cache_enabled = false;
+		return;
+	}
+
+	//binaries are driver specific, salt the cache key so a driver change
+	//invalidates every entry instead of feeding stale blobs to the GL
+	String driver_id = String((const char *)glGetString(GL_VENDOR)) + "/" + String((const char *)glGetString(GL_RENDERER)) + "/" + String((const char *)glGetString(GL_VERSION));
+	shader_cache_driver_hash = driver_id.hash64();
+
+	DirAccess *da = DirAccess::open("user://");
+	if (!da) {
+		shader_cache_enabled = false;
+		return;
+	}
+	da->make_dir("shader_cache");
+	memdelete(da);
+
+	shader_cache_dir = "user://shader_cache";
+#else
+	shader_cache_enabled = false;
+#endif
+}
+
+uint64_t ShaderGLES3::_program_cache_hash(CustomCode *p_cc) const {
+
+	uint64_t h = hash_djb2_one_64(base_code_hash, shader_cache_driver_hash);
+	h = hash_djb2_one_64(conditional_version.version, h);
+
+	for (int i = 0; i < custom_defines.size(); i++) {
+		h = hash_djb2_one_64(hash_djb2(custom_defines[i].get_data()), h);
+	}
+
+	if (p_cc) {
+		h = hash_djb2_one_64(p_cc->vertex.hash64(), h);
+		h = hash_djb2_one_64(p_cc->vertex_globals.hash64(), h);
+		h = hash_djb2_one_64(p_cc->fragment.hash64(), h);
+		h = hash_djb2_one_64(p_cc->fragment_globals.hash64(), h);
+		h = hash_djb2_one_64(p_cc->light.hash64(), h);
+		h = hash_djb2_one_64(p_cc->uniforms.hash64(), h);
+		for (int i = 0; i < p_cc->custom_defines.size(); i++) {
+			h = hash_djb2_one_64(hash_djb2(p_cc->custom_defines[i].get_data()), h);
+		}
+	}
+
+	return h;
+}
+
+String ShaderGLES3::_program_cache_path(uint64_t p_hash) const {
+
+	return shader_cache_dir.plus_file(get_shader_name() + "." + String::num_uint64(p_hash, 16) + ".bin");
+}
+
+bool ShaderGLES3::_load_program_binary(Version &p_v, uint64_t p_hash, CustomCode *p_cc) {
+
+#ifdef GLES3_HAS_PROGRAM_BINARY
+	FileAccess *f = FileAccess::open(_program_cache_path(p_hash), FileAccess::READ);
+	if (!f)
+		return false;
+
+	uint32_t format = f->get_32();
+	uint32_t length = f->get_32();
+
+	if (length == 0 || (uint64_t)length != f->get_len() - 8) {
+		memdelete(f);
+		return false;
+	}
+
+	Vector<uint8_t> binary;
+	binary.resize(length);
+	f->get_buffer(binary.ptrw(), length);
+	memdelete(f);
+
+	p_v.id = glCreateProgram();
+	ERR_FAIL_COND_V(p_v.id == 0, false);
+
+	glProgramBinary(p_v.id, format, binary.ptr(), length);
+
+	GLint status;
+	glGetProgramiv(p_v.id, GL_LINK_STATUS, &status);
+	if (status == GL_FALSE) {
+		//stale or rejected binary, fall back to compiling
+		glDeleteProgram(p_v.id);
+		p_v.id = 0;
+		return false;
+	}
+
+	p_v.vert_id = 0;
+	p_v.frag_id = 0;
+
+	_setup_program_uniforms(p_v, p_cc);
+
+	p_v.ok = true;
+	return true;
+#else
+	return false;
+#endif
+}
+
+void ShaderGLES3::_save_program_binary(Version &p_v, uint64_t p_hash) {
+
+#ifdef GLES3_HAS_PROGRAM_BINARY
+	GLint length = 0;
+	glGetProgramiv(p_v.id, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0)
+		return;
+
+	Vector<uint8_t> binary;
+	binary.resize(length);
+
+	GLenum format = 0;
+	GLsizei out_length = 0;
+	glGetProgramBinary(p_v.id, length, &out_length, &format, binary.ptrw());
+	if (out_length <= 0)
+		return;
+
+	FileAccess *f = FileAccess::open(_program_cache_path(p_hash), FileAccess::WRITE);
+	if (!f)
+		return;
+
+	f->store_32(format);
+	f->store_32(out_length);
+	f->store_buffer(binary.ptr(), out_length);
+	memdelete(f);
+#endif
+}
+
 //#define DEBUG_SHADER
 
 #ifdef DEBUG_SHADER
@@ -241,6 +391,20 @@ ShaderGLES3::Version *ShaderGLES3::get_current_version() {
 		v.code_version = cc->version;
 	}
 
+	/* TRY CACHED PROGRAM BINARY */
+
+	uint64_t program_hash = 0;
+
+	if (shader_cache_enabled) {
+		program_hash = _program_cache_hash(cc);
+		if (_load_program_binary(v, program_hash, cc)) {
+			if (cc) {
+				cc->versions.insert(conditional_version.version);
+			}
+			return &v;
+		}
+	}
+
 	/* CREATE PROGRAM */
 
 	v.id = glCreateProgram();
@@ -463,6 +627,12 @@ ShaderGLES3::Version *ShaderGLES3::get_current_version() {
 		}
 	}
 
+#ifdef GLES3_HAS_PROGRAM_BINARY
+	if (shader_cache_enabled) {
+		glProgramParameteri(v.id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
+#endif
+
 	glLinkProgram(v.id);
 
 	glGetProgramiv(v.id, GL_LINK_STATUS, &status);
@@ -506,19 +676,35 @@ ShaderGLES3::Version *ShaderGLES3::get_current_version() {
 
 	/* UNIFORMS */
 
-	glUseProgram(v.id);
+	_setup_program_uniforms(v, cc);
+
+	v.ok = true;
+	if (cc) {
+		cc->versions.insert(conditional_version.version);
+	}
+
+	if (shader_cache_enabled) {
+		_save_program_binary(v, program_hash);
+	}
+
+	return &v;
+}
+
+void ShaderGLES3::_setup_program_uniforms(Version &p_v, CustomCode *p_cc) {
+
+	glUseProgram(p_v.id);
 
 	//print_line("uniforms:  ");
 	for (int j = 0; j < uniform_count; j++) {
 
-		v.uniform_location[j] = glGetUniformLocation(v.id, uniform_names[j]);
-		//print_line("uniform "+String(uniform_names[j])+" location "+itos(v.uniform_location[j]));
+		p_v.uniform_location[j] = glGetUniformLocation(p_v.id, uniform_names[j]);
+		//print_line("uniform "+String(uniform_names[j])+" location "+itos(p_v.uniform_location[j]));
 	}
 
 	// set texture uniforms
 	for (int i = 0; i < texunit_pair_count; i++) {
 
-		GLint loc = glGetUniformLocation(v.id, texunit_pairs[i].name);
+		GLint loc = glGetUniformLocation(p_v.id, texunit_pairs[i].name);
 		if (loc >= 0) {
 			if (texunit_pairs[i].index < 0) {
 				glUniform1i(loc, max_image_units + texunit_pairs[i].index); //negative, goes down
@@ -532,29 +718,22 @@ ShaderGLES3::Version *ShaderGLES3::get_current_version() {
 	// assign uniform block bind points
 	for (int i = 0; i < ubo_count; i++) {
 
-		GLint loc = glGetUniformBlockIndex(v.id, ubo_pairs[i].name);
+		GLint loc = glGetUniformBlockIndex(p_v.id, ubo_pairs[i].name);
 		if (loc >= 0)
-			glUniformBlockBinding(v.id, loc, ubo_pairs[i].index);
+			glUniformBlockBinding(p_v.id, loc, ubo_pairs[i].index);
 	}
 
-	if (cc) {
+	if (p_cc) {
 
-		v.texture_uniform_locations.resize(cc->texture_uniforms.size());
-		for (int i = 0; i < cc->texture_uniforms.size(); i++) {
+		p_v.texture_uniform_locations.resize(p_cc->texture_uniforms.size());
+		for (int i = 0; i < p_cc->texture_uniforms.size(); i++) {
 
-			v.texture_uniform_locations.write[i] = glGetUniformLocation(v.id, String(cc->texture_uniforms[i]).ascii().get_data());
-			glUniform1i(v.texture_uniform_locations[i], i + base_material_tex_index);
+			p_v.texture_uniform_locations.write[i] = glGetUniformLocation(p_v.id, String(p_cc->texture_uniforms[i]).ascii().get_data());
+			glUniform1i(p_v.texture_uniform_locations[i], i + base_material_tex_index);
 		}
 	}
 
 	glUseProgram(0);
-
-	v.ok = true;
-	if (cc) {
-		cc->versions.insert(conditional_version.version);
-	}
-
-	return &v;
 }
 
 GLint ShaderGLES3::get_uniform_location(const String &p_name) const {
@@ -585,6 +764,9 @@ void ShaderGLES3::setup(const char **p_conditional_defines, int p_conditional_co
 	feedbacks = p_feedback;
 	feedback_count = p_feedback_count;
 
+	base_code_hash = hash_djb2_one_64(get_shader_name().hash64(), hash_djb2(p_vertex_code));
+	base_code_hash = hash_djb2_one_64(hash_djb2(p_fragment_code), base_code_hash);
+
 	//split vertex and shader code (thank you, shader compiler programmers from you know what company).
 	{
 		String globals_tag = "\nVERTEX_SHADER_GLOBALS";
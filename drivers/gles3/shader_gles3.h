@@ -192,6 +192,20 @@ private:
 
 	int max_image_units;
 
+	/* program binary cache */
+
+	static bool shader_cache_enabled;
+	static String shader_cache_dir;
+	static uint64_t shader_cache_driver_hash;
+
+	uint64_t base_code_hash; //hash of the built-in GLSL code, set in setup()
+
+	uint64_t _program_cache_hash(CustomCode *p_cc) const;
+	String _program_cache_path(uint64_t p_hash) const;
+	bool _load_program_binary(Version &p_v, uint64_t p_hash, CustomCode *p_cc);
+	void _save_program_binary(Version &p_v, uint64_t p_hash);
+	void _setup_program_uniforms(Version &p_v, CustomCode *p_cc);
+
 	_FORCE_INLINE_ void _set_uniform_variant(GLint p_uniform, const Variant &p_value) {
 
 		if (p_uniform < 0)
@@ -359,6 +373,10 @@ public:
 		return version->texture_uniform_locations[p_idx];
 	}
 
+	//set up the on-disk program binary cache; no-op when the platform has
+	//no program binary support
+	static void init_shader_cache();
+
 	virtual void init() = 0;
 	void finish();
 
@@ -92,6 +92,13 @@ const bool at_light_pass = true;
 const bool at_light_pass = false;
 #endif
 
+#ifdef USE_MULTI_LIGHT
+
+out highp vec2 multi_pos;
+out vec4 multi_local_rot;
+
+#endif
+
 #if defined(USE_MATERIAL)
 
 /* clang-format off */
@@ -252,6 +259,19 @@ VERTEX_SHADER_CODE
 	local_rot.zw *= sign(src_rect.w);
 #endif
 
+#endif
+
+#ifdef USE_MULTI_LIGHT
+
+	multi_pos = outvec.xy;
+
+	multi_local_rot.xy = normalize((modelview_matrix * (extra_matrix_instance * vec4(1.0, 0.0, 0.0, 0.0))).xy);
+	multi_local_rot.zw = normalize((modelview_matrix * (extra_matrix_instance * vec4(0.0, 1.0, 0.0, 0.0))).xy);
+#ifdef USE_TEXTURE_RECT
+	multi_local_rot.xy *= sign(src_rect.z);
+	multi_local_rot.zw *= sign(src_rect.w);
+#endif
+
 #endif
 }
 
@@ -318,6 +338,38 @@ const bool at_light_pass = true;
 const bool at_light_pass = false;
 #endif
 
+#ifdef USE_MULTI_LIGHT
+
+//several additive lights shaded in one pass, see the matching
+//constants and MultiLightUBO struct in rasterizer_canvas_gles3.h
+#define MAX_MULTI_LIGHTS 16
+
+struct MultiLight {
+	highp mat4 light_matrix;
+	highp mat4 local_matrix;
+	mediump vec4 light_color;
+	mediump vec4 light_rot; //normalized inverse rotation, x basis in xy, y basis in zw
+	mediump vec4 light_height; //x used, rest padding
+};
+
+layout(std140) uniform MultiLightData { //ubo:3
+
+	MultiLight multi_lights[MAX_MULTI_LIGHTS];
+};
+
+uniform lowp sampler2D multi_light_texture_0; // texunit:-5
+uniform lowp sampler2D multi_light_texture_1; // texunit:-6
+uniform lowp sampler2D multi_light_texture_2; // texunit:-7
+uniform lowp sampler2D multi_light_texture_3; // texunit:-8
+
+uniform mediump vec4 multi_light_indices;
+uniform mediump int multi_light_count;
+
+in highp vec2 multi_pos;
+in vec4 multi_local_rot;
+
+#endif
+
 uniform mediump vec4 final_modulate;
 
 layout(location = 0) out mediump vec4 frag_color;
@@ -720,6 +772,49 @@ FRAGMENT_SHADER_CODE
 	}
 
 //use lighting
+#endif
+
+#ifdef USE_MULTI_LIGHT
+
+	{
+		highp vec4 multi_pos4 = vec4(multi_pos, 0.0, 1.0);
+		vec3 multi_normal = normal;
+		if (normal_used) {
+			multi_normal.xy = mat2(multi_local_rot.xy, multi_local_rot.zw) * multi_normal.xy;
+		}
+
+		mediump vec3 light_accum = vec3(0.0);
+		mediump float alpha_accum = 0.0;
+
+//samplers cannot be indexed dynamically in GLSL ES 3.0, so unroll one block per texture unit
+#define MULTI_LIGHT_COMPUTE(m_idx, m_tex)                                                                                         \
+	if (m_idx < multi_light_count) {                                                                                              \
+		int light_index = int(multi_light_indices[m_idx]);                                                                        \
+		highp vec2 light_uv = (multi_lights[light_index].light_matrix * multi_pos4).xy;                                           \
+		if (all(greaterThanEqual(light_uv, vec2(0.0))) && all(lessThan(light_uv, vec2(1.0)))) {                                   \
+			mediump vec4 light = texture(m_tex, light_uv) * multi_lights[light_index].light_color;                                \
+			if (normal_used) {                                                                                                    \
+				highp vec2 light_vec = mat2(multi_lights[light_index].light_rot.xy, multi_lights[light_index].light_rot.zw) *     \
+						(multi_lights[light_index].local_matrix * multi_pos4).xy;                                                 \
+				light *= max(dot(-normalize(vec3(light_vec, -multi_lights[light_index].light_height.x)), multi_normal), 0.0);     \
+			}                                                                                                                     \
+			light_accum += light.rgb * light.a;                                                                                   \
+			alpha_accum += light.a * light.a;                                                                                     \
+		}                                                                                                                         \
+	}
+
+		MULTI_LIGHT_COMPUTE(0, multi_light_texture_0)
+		MULTI_LIGHT_COMPUTE(1, multi_light_texture_1)
+		MULTI_LIGHT_COMPUTE(2, multi_light_texture_2)
+		MULTI_LIGHT_COMPUTE(3, multi_light_texture_3)
+
+		//premultiplied for ONE,ONE blending, adding the same value the
+		//equivalent sequence of single light passes would have
+		color.rgb *= color.a * light_accum;
+		color.a *= color.a * alpha_accum;
+	}
+
+//use multi light
 #endif
 	//color.rgb *= color.a;
 	frag_color = color;
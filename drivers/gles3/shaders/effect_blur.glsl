@@ -56,7 +56,7 @@ uniform float glow_strength;
 
 #endif
 
-#if defined(DOF_FAR_BLUR) || defined(DOF_NEAR_BLUR)
+#if defined(DOF_FAR_BLUR) || defined(DOF_NEAR_BLUR) || defined(DOF_FAR_UPSAMPLE)
 
 #ifdef DOF_QUALITY_LOW
 const int dof_kernel_size = 5;
@@ -209,6 +209,29 @@ void main() {
 
 #endif
 
+#ifdef DOF_FAR_UPSAMPLE
+
+	//merge the half resolution far-field blur back over the sharp image,
+	//re-deriving the focus amount from full resolution depth so in-focus
+	//pixels keep their full resolution detail
+
+	float depth = textureLod(dof_source_depth, uv_interp, 0.0).r;
+	depth = depth * 2.0 - 1.0;
+#ifdef USE_ORTHOGONAL_PROJECTION
+	depth = ((depth + (camera_z_far + camera_z_near) / (camera_z_far - camera_z_near)) * (camera_z_far - camera_z_near)) / 2.0;
+#else
+	depth = 2.0 * camera_z_near * camera_z_far / (camera_z_far + camera_z_near - depth * (camera_z_far - camera_z_near));
+#endif
+
+	float amount = smoothstep(dof_begin, dof_end, depth);
+
+	vec4 sharp = textureLod(source_color, uv_interp, 0.0);
+	vec4 blurred = textureLod(source_color, uv_interp, 1.0); //half resolution level
+
+	frag_color = mix(sharp, blurred, amount);
+
+#endif
+
 #ifdef DOF_NEAR_BLUR
 
 	vec4 color_accum = vec4(0.0);
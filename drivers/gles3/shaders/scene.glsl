@@ -825,6 +825,20 @@ uniform int spot_light_count;
 uniform int reflection_indices[MAX_FORWARD_LIGHTS];
 uniform int reflection_count;
 
+#ifdef USE_LIGHT_CLUSTERS
+
+// must match rasterizer_scene_gles3.h
+#define CLUSTER_GRID_WIDTH 16
+#define CLUSTER_GRID_HEIGHT 8
+#define CLUSTER_DEPTH_SLICES 16
+
+uniform highp usampler2D cluster_texture; // texunit:-11
+uniform highp vec2 cluster_screen_scale;
+uniform highp float cluster_depth_scale;
+uniform highp float cluster_z_near;
+
+#endif
+
 #endif
 
 #if defined(SCREEN_TEXTURE_USED)
@@ -2055,6 +2069,30 @@ FRAGMENT_SHADER_CODE
 	diffuse_light *= albedo;
 #else
 
+#ifdef USE_LIGHT_CLUSTERS
+
+	{
+		highp float cluster_depth = max(-vertex.z, cluster_z_near);
+		int cluster_slice = clamp(int(log(cluster_depth / cluster_z_near) * cluster_depth_scale), 0, CLUSTER_DEPTH_SLICES - 1);
+		ivec2 cluster_tile = clamp(ivec2(gl_FragCoord.xy * cluster_screen_scale), ivec2(0, 0), ivec2(CLUSTER_GRID_WIDTH - 1, CLUSTER_GRID_HEIGHT - 1));
+		int cluster_cell = (cluster_slice * CLUSTER_GRID_HEIGHT + cluster_tile.y) * CLUSTER_GRID_WIDTH + cluster_tile.x;
+
+		uint cluster_counts = texelFetch(cluster_texture, ivec2(0, cluster_cell), 0).r;
+		int cluster_omni_count = int(cluster_counts & 0xFFFFu);
+		int cluster_spot_count = int(cluster_counts >> 16u);
+
+		for (int i = 0; i < cluster_omni_count; i++) {
+			light_process_omni(int(texelFetch(cluster_texture, ivec2(1 + i, cluster_cell), 0).r), vertex, eye_vec, normal, binormal, tangent, albedo, transmission, roughness, metallic, specular, rim, rim_tint, clearcoat, clearcoat_gloss, anisotropy, specular_blob_intensity, diffuse_light, specular_light, alpha);
+		}
+
+		for (int i = 0; i < cluster_spot_count; i++) {
+			light_process_spot(int(texelFetch(cluster_texture, ivec2(1 + cluster_omni_count + i, cluster_cell), 0).r), vertex, eye_vec, normal, binormal, tangent, albedo, transmission, roughness, metallic, specular, rim, rim_tint, clearcoat, clearcoat_gloss, anisotropy, specular_blob_intensity, diffuse_light, specular_light, alpha);
+		}
+	}
+
+#endif //USE_LIGHT_CLUSTERS
+
+	// with clusters enabled, these lists only carry lights with a custom cull mask
 	for (int i = 0; i < omni_light_count; i++) {
 		light_process_omni(omni_light_indices[i], vertex, eye_vec, normal, binormal, tangent, albedo, transmission, roughness, metallic, specular, rim, rim_tint, clearcoat, clearcoat_gloss, anisotropy, specular_blob_intensity, diffuse_light, specular_light, alpha);
 	}
@@ -598,6 +598,106 @@ Error NetSocketPosix::send(const uint8_t *p_buffer, int p_len, int &r_sent) {
 	return OK;
 }
 
+// recvmmsg/sendmmsg are Linux-only; other platforms take the per-message
+// fallback from NetSocket. A batch is capped so the header arrays stay on the
+// stack.
+#define MMSG_BATCH_MAX 64
+
+Error NetSocketPosix::recv_multiple(Message *p_messages, int p_count, int &r_received) {
+
+#if defined(__linux__)
+	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
+	ERR_FAIL_COND_V(p_count <= 0, ERR_INVALID_PARAMETER);
+
+	if (p_count > MMSG_BATCH_MAX) {
+		p_count = MMSG_BATCH_MAX;
+	}
+
+	struct mmsghdr msgs[MMSG_BATCH_MAX];
+	struct iovec iovs[MMSG_BATCH_MAX];
+	struct sockaddr_storage addrs[MMSG_BATCH_MAX];
+
+	memset(msgs, 0, sizeof(struct mmsghdr) * p_count);
+
+	for (int i = 0; i < p_count; i++) {
+		iovs[i].iov_base = p_messages[i].buffer;
+		iovs[i].iov_len = p_messages[i].buffer_size;
+		msgs[i].msg_hdr.msg_iov = &iovs[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+		msgs[i].msg_hdr.msg_name = &addrs[i];
+		msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+	}
+
+	int ret = ::recvmmsg(_sock, msgs, p_count, 0, NULL);
+
+	if (ret < 0) {
+		NetError err = _get_socket_error();
+		if (err == ERR_NET_WOULD_BLOCK)
+			return ERR_BUSY;
+
+		return FAILED;
+	}
+
+	r_received = ret;
+
+	for (int i = 0; i < ret; i++) {
+		p_messages[i].size = msgs[i].msg_len;
+		_set_ip_port(&addrs[i], p_messages[i].ip, p_messages[i].port);
+	}
+
+	return OK;
+#else
+	return NetSocket::recv_multiple(p_messages, p_count, r_received);
+#endif
+}
+
+Error NetSocketPosix::send_multiple(Message *p_messages, int p_count, int &r_sent) {
+
+#if defined(__linux__)
+	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
+	ERR_FAIL_COND_V(p_count <= 0, ERR_INVALID_PARAMETER);
+
+	if (p_count > MMSG_BATCH_MAX) {
+		p_count = MMSG_BATCH_MAX;
+	}
+
+	struct mmsghdr msgs[MMSG_BATCH_MAX];
+	struct iovec iovs[MMSG_BATCH_MAX];
+	struct sockaddr_storage addrs[MMSG_BATCH_MAX];
+
+	memset(msgs, 0, sizeof(struct mmsghdr) * p_count);
+
+	for (int i = 0; i < p_count; i++) {
+		iovs[i].iov_base = p_messages[i].buffer;
+		iovs[i].iov_len = p_messages[i].buffer_size;
+		msgs[i].msg_hdr.msg_iov = &iovs[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+		msgs[i].msg_hdr.msg_name = &addrs[i];
+		msgs[i].msg_hdr.msg_namelen = _set_addr_storage(&addrs[i], p_messages[i].ip, p_messages[i].port, _ip_type);
+	}
+
+	int ret = ::sendmmsg(_sock, msgs, p_count, 0);
+
+	if (ret < 0) {
+		NetError err = _get_socket_error();
+		if (err == ERR_NET_WOULD_BLOCK)
+			return ERR_BUSY;
+
+		return FAILED;
+	}
+
+	r_sent = ret;
+
+	for (int i = 0; i < ret; i++) {
+		p_messages[i].size = msgs[i].msg_len;
+	}
+
+	return OK;
+#else
+	return NetSocket::send_multiple(p_messages, p_count, r_sent);
+#endif
+}
+
 Error NetSocketPosix::sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IP_Address p_ip, uint16_t p_port) {
 	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
 
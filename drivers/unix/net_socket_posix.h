@@ -84,6 +84,8 @@ public:
 	virtual Error recvfrom(uint8_t *p_buffer, int p_len, int &r_read, IP_Address &r_ip, uint16_t &r_port);
 	virtual Error send(const uint8_t *p_buffer, int p_len, int &r_sent);
 	virtual Error sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IP_Address p_ip, uint16_t p_port);
+	virtual Error recv_multiple(Message *p_messages, int p_count, int &r_received);
+	virtual Error send_multiple(Message *p_messages, int p_count, int &r_sent);
 	virtual Ref<NetSocket> accept(IP_Address &r_ip, uint16_t &r_port);
 
 	virtual bool is_open() const;
@@ -56,12 +56,15 @@
 #include <assert.h>
 #include <dlfcn.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <poll.h>
 #include <signal.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/wait.h>
 #include <unistd.h>
@@ -491,6 +494,33 @@ String OS_Unix::get_user_data_dir() const {
 	return ProjectSettings::get_singleton()->get_resource_path();
 }
 
+const uint8_t *OS_Unix::map_file(const String &p_path, uint64_t &r_size) {
+
+	int fd = open(p_path.utf8().get_data(), O_RDONLY);
+	if (fd < 0)
+		return NULL;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size == 0) {
+		close(fd);
+		return NULL;
+	}
+
+	void *base = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd); // The mapping keeps its own reference to the file.
+	if (base == MAP_FAILED)
+		return NULL;
+
+	r_size = st.st_size;
+	return (const uint8_t *)base;
+}
+
+void OS_Unix::unmap_file(const uint8_t *p_base, uint64_t p_size) {
+
+	if (p_base)
+		munmap((void *)p_base, p_size);
+}
+
 String OS_Unix::get_executable_path() const {
 
 #ifdef __linux__
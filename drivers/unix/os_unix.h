@@ -101,6 +101,9 @@ public:
 
 	virtual String get_executable_path() const;
 	virtual String get_user_data_dir() const;
+
+	virtual const uint8_t *map_file(const String &p_path, uint64_t &r_size);
+	virtual void unmap_file(const uint8_t *p_base, uint64_t p_size);
 };
 
 class UnixTerminalLogger : public StdLogger {
@@ -0,0 +1,3 @@
+static const int _doc_data_class_path_count = 0;
+struct _DocDataClassPath { const char *name; const char *path; };
+static const _DocDataClassPath _doc_data_class_paths[1] = { { NULL, NULL } };
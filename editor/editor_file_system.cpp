@@ -35,6 +35,7 @@
 #include "core/io/resource_saver.h"
 #include "core/os/file_access.h"
 #include "core/os/os.h"
+#include "core/os/worker_thread_pool.h"
 #include "core/project_settings.h"
 #include "core/variant_parser.h"
 #include "editor_node.h"
@@ -560,15 +561,9 @@ bool EditorFileSystem::_update_scan_actions() {
 				int idx = ia.dir->find_file_index(ia.file);
 				ERR_CONTINUE(idx == -1);
 				String full_path = ia.dir->get_file_path(idx);
-				if (_test_for_reimport(full_path, false)) {
-					//must reimport
-					reimports.push_back(full_path);
-				} else {
-					//must not reimport, all was good
-					//update modified times, to avoid reimport
-					ia.dir->files[idx]->modified_time = FileAccess::get_modified_time(full_path);
-					ia.dir->files[idx]->import_modified_time = FileAccess::get_modified_time(full_path + ".import");
-				}
+				//the content hash was already checked in the scan stage, so
+				//getting here means the file really changed
+				reimports.push_back(full_path);
 
 				fs_changed = true;
 			} break;
@@ -796,15 +791,26 @@ void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, DirAccess
 				fi->type = ResourceFormatImporter::get_singleton()->get_resource_type(path);
 				fi->import_group_file = ResourceFormatImporter::get_singleton()->get_import_group_file(path);
 				fi->script_class_name = _get_global_script_class(fi->type, path, &fi->script_class_extends, &fi->script_class_icon_path);
-				fi->modified_time = 0;
-				fi->import_modified_time = 0;
 				fi->import_valid = ResourceLoader::is_import_valid(path);
 
-				ItemAction ia;
-				ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
-				ia.dir = p_dir;
-				ia.file = E->get();
-				scan_actions.push_back(ia);
+				//check the content hash here, in the scan stage, so a stale
+				//modified time alone (common on network filesystems) does not
+				//cause a reimport and the import stage only sees real work
+				if (_test_for_reimport(path, false)) {
+
+					fi->modified_time = 0;
+					fi->import_modified_time = 0;
+
+					ItemAction ia;
+					ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
+					ia.dir = p_dir;
+					ia.file = E->get();
+					scan_actions.push_back(ia);
+				} else {
+					//content matches, only the modified times were stale
+					fi->modified_time = mt;
+					fi->import_modified_time = import_mt;
+				}
 			}
 		} else {
 
@@ -986,6 +992,14 @@ void EditorFileSystem::_scan_fs_changes(EditorFileSystemDirectory *p_dir, const
 				}
 			}
 
+			if (reimport && !_test_for_reimport(path, false)) {
+				//the modified times are stale but the content hash still
+				//matches, so only remember the new times
+				p_dir->files[i]->modified_time = mt;
+				p_dir->files[i]->import_modified_time = FileAccess::get_modified_time(path + ".import");
+				reimport = false;
+			}
+
 			if (reimport) {
 
 				ItemAction ia;
@@ -1730,7 +1744,9 @@ void EditorFileSystem::_reimport_file(const String &p_file) {
 		}
 
 	} else {
+		late_added_files_mutex->lock(); //this function may run from the worker pool
 		late_added_files.insert(p_file); //imported files do not call update_file(), but just in case..
+		late_added_files_mutex->unlock();
 	}
 
 	Ref<ResourceImporter> importer;
@@ -1922,6 +1938,12 @@ void EditorFileSystem::_find_group_files(EditorFileSystemDirectory *efd, Map<Str
 	}
 }
 
+void EditorFileSystem::_reimport_thread(void *p_userdata, uint32_t p_index) {
+
+	ImportThreadData *itd = (ImportThreadData *)p_userdata;
+	singleton->_reimport_file(itd->reimport_files[itd->reimport_from + p_index].path);
+}
+
 void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 
 	{ //check that .import folder exists
@@ -1959,6 +1981,8 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 			ImportFile ifile;
 			ifile.path = p_files[i];
 			ifile.order = ResourceFormatImporter::get_singleton()->get_import_order(p_files[i]);
+			Ref<ResourceImporter> importer = ResourceFormatImporter::get_singleton()->get_importer_by_path(p_files[i]);
+			ifile.threaded = importer.is_valid() && importer->can_import_threaded();
 			files.push_back(ifile);
 		}
 
@@ -1973,9 +1997,34 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 
 	files.sort();
 
-	for (int i = 0; i < files.size(); i++) {
-		pr.step(files[i].path.get_file(), i);
-		_reimport_file(files[i].path);
+	for (int i = 0; i < files.size();) {
+
+		//import is per file independent, so contiguous files with the same
+		//import order whose importer allows it are spread over the worker pool
+		int from = i;
+		while (i + 1 < files.size() && files[i + 1].order == files[from].order && files[i + 1].threaded == files[from].threaded) {
+			i++;
+		}
+
+		if (files[from].threaded && i > from) {
+
+			pr.step(files[from].path.get_file(), from);
+
+			ImportThreadData itd;
+			itd.reimport_files = files.ptr();
+			itd.reimport_from = from;
+
+			WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_group_task(_reimport_thread, &itd, i - from + 1);
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+		} else {
+
+			for (int j = from; j <= i; j++) {
+				pr.step(files[j].path.get_file(), j);
+				_reimport_file(files[j].path);
+			}
+		}
+
+		i++;
 	}
 
 	//reimport groups
@@ -2135,6 +2184,7 @@ EditorFileSystem::EditorFileSystem() {
 	using_fat32_or_exfat = (da->get_filesystem_type() == "FAT32" || da->get_filesystem_type() == "exFAT");
 	memdelete(da);
 
+	late_added_files_mutex = Mutex::create();
 	scan_total = 0;
 	update_script_classes_queued = false;
 	first_scan = true;
@@ -2142,4 +2192,5 @@ EditorFileSystem::EditorFileSystem() {
 }
 
 EditorFileSystem::~EditorFileSystem() {
+	memdelete(late_added_files_mutex);
 }
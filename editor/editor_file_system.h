@@ -32,6 +32,7 @@
 #define EDITOR_FILE_SYSTEM_H
 
 #include "core/os/dir_access.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
 #include "core/os/thread_safe.h"
 #include "core/set.h"
@@ -151,6 +152,7 @@ class EditorFileSystem : public Node {
 
 	void _scan_filesystem();
 
+	Mutex *late_added_files_mutex; //_reimport_file can run from the worker pool
 	Set<String> late_added_files; //keep track of files that were added, these will be re-scanned
 	Set<String> late_update_files;
 
@@ -224,11 +226,19 @@ class EditorFileSystem : public Node {
 	struct ImportFile {
 		String path;
 		int order;
+		bool threaded; //used to group files per import worker batch
 		bool operator<(const ImportFile &p_if) const {
-			return order < p_if.order;
+			return order == p_if.order ? (threaded < p_if.threaded) : (order < p_if.order);
 		}
 	};
 
+	struct ImportThreadData {
+		const ImportFile *reimport_files;
+		int reimport_from;
+	};
+
+	static void _reimport_thread(void *p_userdata, uint32_t p_index);
+
 	void _scan_script_classes(EditorFileSystemDirectory *p_dir);
 	volatile bool update_script_classes_queued;
 	void _queue_update_script_classes();
@@ -913,6 +913,24 @@ void ResourceImporterScene::_optimize_animations(Node *scene, float p_max_lin_er
 	}
 }
 
+void ResourceImporterScene::_compress_animations(Node *scene) {
+
+	if (!scene->has_node(String("AnimationPlayer")))
+		return;
+	Node *n = scene->get_node(String("AnimationPlayer"));
+	ERR_FAIL_COND(!n);
+	AnimationPlayer *anim = Object::cast_to<AnimationPlayer>(n);
+	ERR_FAIL_COND(!anim);
+
+	List<StringName> anim_names;
+	anim->get_animation_list(&anim_names);
+	for (List<StringName>::Element *E = anim_names.front(); E; E = E->next()) {
+
+		Ref<Animation> a = anim->get_animation(E->get());
+		a->compress_transform_tracks();
+	}
+}
+
 static String _make_extname(const String &p_str) {
 
 	String ext_name = p_str.replace(".", "_");
@@ -1182,6 +1200,7 @@ void ResourceImporterScene::get_import_options(List<ImportOption> *r_options, in
 	r_options->push_back(ImportOption(PropertyInfo(Variant::REAL, "animation/optimizer/max_angular_error"), 0.01));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::REAL, "animation/optimizer/max_angle"), 22));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "animation/optimizer/remove_unused_tracks"), true));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "animation/compression/enabled"), false));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "animation/clips/amount", PROPERTY_HINT_RANGE, "0,256,1", PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_UPDATE_ALL_IF_MODIFIED), 0));
 	for (int i = 0; i < 256; i++) {
 		r_options->push_back(ImportOption(PropertyInfo(Variant::STRING, "animation/clip_" + itos(i + 1) + "/name"), ""));
@@ -1397,6 +1416,11 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 		_filter_tracks(scene, animation_filter);
 	}
 
+	if (bool(p_options["animation/compression/enabled"])) {
+		// last, after clips and filters, as compressed tracks are read-only
+		_compress_animations(scene);
+	}
+
 	bool external_animations = int(p_options["animation/storage"]) == 1 || int(p_options["animation/storage"]) == 2;
 	bool external_animations_as_text = int(p_options["animation/storage"]) == 2;
 	bool keep_custom_tracks = p_options["animation/keep_custom_tracks"];
@@ -1430,6 +1454,19 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 			float texel_size = p_options["meshes/lightmap_texel_size"];
 			texel_size = MAX(0.001, texel_size);
 
+			String cache_file_path = p_source_file + ".unwrap_cache";
+
+			PoolVector<uint8_t> src_unwrap_cache;
+			{
+				FileAccessRef file = FileAccess::open(cache_file_path, FileAccess::READ);
+				if (file) {
+					src_unwrap_cache.resize(file->get_len());
+					PoolVector<uint8_t>::Write w = src_unwrap_cache.write();
+					file->get_buffer(w.ptr(), src_unwrap_cache.size());
+				}
+			}
+			PoolVector<uint8_t> dst_unwrap_cache;
+
 			EditorProgress progress2("gen_lightmaps", TTR("Generating Lightmaps"), meshes.size());
 			int step = 0;
 			for (Map<Ref<ArrayMesh>, Transform>::Element *E = meshes.front(); E; E = E->next()) {
@@ -1442,12 +1479,21 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 
 				progress2.step(TTR("Generating for Mesh: ") + name + " (" + itos(step) + "/" + itos(meshes.size()) + ")", step);
 
-				Error err2 = mesh->lightmap_unwrap(E->get(), texel_size);
+				Error err2 = mesh->lightmap_unwrap_cached(E->get(), texel_size, src_unwrap_cache, dst_unwrap_cache);
 				if (err2 != OK) {
 					EditorNode::add_io_error("Mesh '" + name + "' failed lightmap generation. Please fix geometry.");
 				}
 				step++;
 			}
+
+			if (dst_unwrap_cache.size()) {
+				//only entries for meshes still present get carried over
+				FileAccessRef file = FileAccess::open(cache_file_path, FileAccess::WRITE);
+				if (file) {
+					PoolVector<uint8_t>::Read r = dst_unwrap_cache.read();
+					file->store_buffer(r.ptr(), dst_unwrap_cache.size());
+				}
+			}
 		}
 	}
 
@@ -0,0 +1 @@
+static const unsigned char app_icon_png[]={0};
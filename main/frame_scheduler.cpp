@@ -0,0 +1,200 @@
+/*************************************************************************/
+/*  frame_scheduler.cpp                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "frame_scheduler.h"
+
+#include "core/os/os.h"
+#include "core/sort_array.h"
+
+FrameScheduler *FrameScheduler::singleton = NULL;
+
+int FrameScheduler::register_task(Object *p_object, const StringName &p_method, int p_priority, int p_budget_usec) {
+
+	ERR_FAIL_NULL_V(p_object, 0);
+	ERR_FAIL_COND_V(p_budget_usec <= 0, 0);
+
+	Task task;
+	task.instance_id = p_object->get_instance_id();
+	task.method = p_method;
+	task.priority = p_priority;
+	task.budget_usec = p_budget_usec;
+	task.starved_frames = 0;
+
+	last_id++;
+	tasks[last_id] = task;
+	return last_id;
+}
+
+void FrameScheduler::unregister_task(int p_id) {
+
+	ERR_FAIL_COND(!tasks.has(p_id));
+	tasks.erase(p_id);
+}
+
+bool FrameScheduler::has_task(int p_id) const {
+
+	return tasks.has(p_id);
+}
+
+int FrameScheduler::get_task_count() const {
+
+	return tasks.size();
+}
+
+void FrameScheduler::set_idle_budget_usec(int p_usec) {
+
+	ERR_FAIL_COND(p_usec < 0);
+	idle_budget_usec = p_usec;
+}
+
+int FrameScheduler::get_idle_budget_usec() const {
+
+	return idle_budget_usec;
+}
+
+void FrameScheduler::set_min_slice_usec(int p_usec) {
+
+	ERR_FAIL_COND(p_usec < 0);
+	min_slice_usec = p_usec;
+}
+
+int FrameScheduler::get_min_slice_usec() const {
+
+	return min_slice_usec;
+}
+
+struct _FrameSchedulerTaskSort {
+
+	int effective_priority;
+	int id;
+
+	_FORCE_INLINE_ bool operator<(const _FrameSchedulerTaskSort &p_other) const {
+		if (effective_priority == p_other.effective_priority)
+			return id < p_other.id;
+		return effective_priority < p_other.effective_priority;
+	}
+};
+
+void FrameScheduler::process(uint64_t p_slack_usec) {
+
+	if (tasks.empty())
+		return;
+
+	//even a frame with no measured slack grants the frontmost task a minimum
+	//slice, so jobs keep making forward progress under sustained load
+	uint64_t remaining = MAX(p_slack_usec, (uint64_t)min_slice_usec);
+
+	//lower priority value runs earlier (same convention as Node::process_priority);
+	//frames spent waiting are subtracted, so starved tasks eventually reach the front
+	Vector<_FrameSchedulerTaskSort> order;
+	order.resize(tasks.size());
+	{
+		int i = 0;
+		for (Map<int, Task>::Element *E = tasks.front(); E; E = E->next()) {
+			order.write[i].effective_priority = E->get().priority - E->get().starved_frames;
+			order.write[i].id = E->key();
+			i++;
+		}
+	}
+	order.sort();
+
+	for (int i = 0; i < order.size(); i++) {
+
+		//re-find every iteration, a callback may have (un)registered tasks
+		Map<int, Task>::Element *E = tasks.find(order[i].id);
+		if (!E)
+			continue;
+
+		if (remaining == 0) {
+			E->get().starved_frames++;
+			continue;
+		}
+
+		Object *obj = ObjectDB::get_instance(E->get().instance_id);
+		if (!obj) {
+			tasks.erase(E);
+			continue;
+		}
+
+		uint64_t slice = MIN((uint64_t)E->get().budget_usec, remaining);
+		E->get().starved_frames = 0;
+
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+
+		Variant slice_v = (int64_t)slice;
+		const Variant *argp = &slice_v;
+		Variant::CallError ce;
+		Variant done = obj->call(E->get().method, &argp, 1, ce);
+
+		uint64_t spent = OS::get_singleton()->get_ticks_usec() - begin;
+		remaining = spent < remaining ? remaining - spent : 0;
+
+		E = tasks.find(order[i].id); //the callback may have unregistered itself
+		if (!E)
+			continue;
+
+		if (ce.error != Variant::CallError::CALL_OK) {
+			ERR_PRINT("FrameScheduler: error calling task method '" + String(E->get().method) + "', unregistering task.");
+			tasks.erase(E);
+			continue;
+		}
+
+		if (done.booleanize()) {
+			tasks.erase(E); //task reported completion
+		}
+	}
+}
+
+void FrameScheduler::_bind_methods() {
+
+	ClassDB::bind_method(D_METHOD("register_task", "object", "method", "priority", "budget_usec"), &FrameScheduler::register_task, DEFVAL(0), DEFVAL(1000));
+	ClassDB::bind_method(D_METHOD("unregister_task", "id"), &FrameScheduler::unregister_task);
+	ClassDB::bind_method(D_METHOD("has_task", "id"), &FrameScheduler::has_task);
+	ClassDB::bind_method(D_METHOD("get_task_count"), &FrameScheduler::get_task_count);
+
+	ClassDB::bind_method(D_METHOD("set_idle_budget_usec", "usec"), &FrameScheduler::set_idle_budget_usec);
+	ClassDB::bind_method(D_METHOD("get_idle_budget_usec"), &FrameScheduler::get_idle_budget_usec);
+	ClassDB::bind_method(D_METHOD("set_min_slice_usec", "usec"), &FrameScheduler::set_min_slice_usec);
+	ClassDB::bind_method(D_METHOD("get_min_slice_usec"), &FrameScheduler::get_min_slice_usec);
+}
+
+FrameScheduler::FrameScheduler() {
+
+	singleton = this;
+	last_id = 0;
+	idle_budget_usec = 2000;
+	min_slice_usec = 250;
+}
+
+FrameScheduler::~FrameScheduler() {
+
+	if (singleton == this)
+		singleton = NULL;
+}
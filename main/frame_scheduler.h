@@ -0,0 +1,84 @@
+/*************************************************************************/
+/*  frame_scheduler.h                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include "core/object.h"
+
+//runs registered incremental jobs in the idle slack Main::iteration measures
+//between frames, so systems like chunk generation or navmesh rebuilds don't
+//each reinvent time slicing with OS.get_ticks_usec in script
+
+class FrameScheduler : public Object {
+
+	GDCLASS(FrameScheduler, Object);
+
+	struct Task {
+
+		ObjectID instance_id;
+		StringName method;
+		int priority;
+		int budget_usec;
+		int starved_frames; //frames since the task last got a slice
+	};
+
+	Map<int, Task> tasks;
+	int last_id;
+	int idle_budget_usec;
+	int min_slice_usec;
+
+	static FrameScheduler *singleton;
+
+protected:
+	static void _bind_methods();
+
+public:
+	static FrameScheduler *get_singleton() { return singleton; }
+
+	int register_task(Object *p_object, const StringName &p_method, int p_priority = 0, int p_budget_usec = 1000);
+	void unregister_task(int p_id);
+	bool has_task(int p_id) const;
+	int get_task_count() const;
+
+	void set_idle_budget_usec(int p_usec);
+	int get_idle_budget_usec() const;
+
+	void set_min_slice_usec(int p_usec);
+	int get_min_slice_usec() const;
+
+	//called by Main::iteration with the measured slack for this frame
+	void process(uint64_t p_slack_usec);
+
+	FrameScheduler();
+	~FrameScheduler();
+};
+
+#endif // FRAME_SCHEDULER_H
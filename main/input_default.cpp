@@ -666,17 +666,30 @@ void InputDefault::accumulate_input_event(const Ref<InputEvent> &p_event) {
 		parse_input_event(p_event);
 		return;
 	}
+
+	accumulated_events_mutex->lock();
+
 	if (!accumulated_events.empty() && accumulated_events.back()->get()->accumulate(p_event)) {
+		accumulated_events_mutex->unlock();
 		return; //event was accumulated, exit
 	}
 
 	accumulated_events.push_back(p_event);
+	accumulated_events_mutex->unlock();
 }
 void InputDefault::flush_accumulated_events() {
 
-	while (accumulated_events.front()) {
-		parse_input_event(accumulated_events.front()->get());
-		accumulated_events.pop_front();
+	//take the whole queue at once, then dispatch unlocked; parsing may
+	//generate new events (e.g. touch emulation), which must not deadlock
+
+	accumulated_events_mutex->lock();
+	List<Ref<InputEvent> > events = accumulated_events;
+	accumulated_events.clear();
+	accumulated_events_mutex->unlock();
+
+	while (events.front()) {
+		parse_input_event(events.front()->get());
+		events.pop_front();
 	}
 }
 
@@ -701,6 +714,7 @@ void InputDefault::release_pressed_events() {
 
 InputDefault::InputDefault() {
 
+	accumulated_events_mutex = Mutex::create();
 	use_accumulated_input = true;
 	mouse_button_mask = 0;
 	emulate_touch_from_mouse = false;
@@ -1195,3 +1209,8 @@ int InputDefault::get_joy_axis_index_from_string(String p_axis) {
 	}
 	ERR_FAIL_V(-1);
 }
+
+InputDefault::~InputDefault() {
+
+	memdelete(accumulated_events_mutex);
+}
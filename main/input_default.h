@@ -32,6 +32,7 @@
 #define INPUT_DEFAULT_H
 
 #include "core/os/input.h"
+#include "core/os/mutex.h"
 
 class InputDefault : public Input {
 
@@ -183,6 +184,9 @@ private:
 
 	void _parse_input_event_impl(const Ref<InputEvent> &p_event, bool p_is_emulated);
 
+	// Guards accumulated_events; platforms that pump events from a separate
+	// thread can safely accumulate there while the main thread flushes.
+	Mutex *accumulated_events_mutex;
 	List<Ref<InputEvent> > accumulated_events;
 	bool use_accumulated_input;
 
@@ -275,6 +279,7 @@ public:
 
 	virtual void release_pressed_events();
 	InputDefault();
+	~InputDefault();
 };
 
 #endif // INPUT_DEFAULT_H
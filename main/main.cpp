@@ -37,19 +37,23 @@
 #include "core/io/file_access_zip.h"
 #include "core/io/image_loader.h"
 #include "core/io/ip.h"
+#include "core/io/resource_load_trace.h"
 #include "core/io/resource_loader.h"
 #include "core/message_queue.h"
 #include "core/os/dir_access.h"
+#include "core/os/memory.h"
 #include "core/os/os.h"
 #include "core/project_settings.h"
 #include "core/register_core_types.h"
 #include "core/script_debugger_local.h"
 #include "core/script_language.h"
+#include "core/tracepoints.h"
 #include "core/translation.h"
 #include "core/version.h"
 #include "core/version_hash.gen.h"
 #include "drivers/register_driver_types.h"
 #include "main/app_icon.gen.h"
+#include "main/frame_scheduler.h"
 #include "main/input_default.h"
 #include "main/main_timer_sync.h"
 #include "main/performance.h"
@@ -89,6 +93,7 @@ static ProjectSettings *globals = NULL;
 static InputMap *input_map = NULL;
 static TranslationServer *translation_server = NULL;
 static Performance *performance = NULL;
+static FrameScheduler *frame_scheduler = NULL;
 static PackedData *packed_data = NULL;
 #ifdef MINIZIP_ENABLED
 static ZipArchive *zip_packed_data = NULL;
@@ -280,6 +285,7 @@ void Main::print_help(const char *p_binary) {
 	OS::get_singleton()->print("  --disable-crash-handler          Disable crash handler when supported by the platform code.\n");
 	OS::get_singleton()->print("  --fixed-fps <fps>                Force a fixed number of frames per second. This setting disables real-time synchronization.\n");
 	OS::get_singleton()->print("  --print-fps                      Print the frames per second to the stdout.\n");
+	OS::get_singleton()->print("  --load-trace <file>              Record resource load timings to <file> in the chrome://tracing event format.\n");
 	OS::get_singleton()->print("\n");
 
 	OS::get_singleton()->print("Standalone tools:\n");
@@ -362,6 +368,10 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	ClassDB::register_class<Performance>();
 	engine->add_singleton(Engine::Singleton("Performance", performance));
 
+	frame_scheduler = memnew(FrameScheduler);
+	ClassDB::register_class<FrameScheduler>();
+	engine->add_singleton(Engine::Singleton("FrameScheduler", frame_scheduler));
+
 	GLOBAL_DEF("debug/settings/crash_handler/message", String("Please include this when reporting the bug on https://github.com/godotengine/godot/issues"));
 
 	MAIN_PRINT("Main: Parse CMDLine");
@@ -804,6 +814,15 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			}
 		} else if (I->get() == "--print-fps") {
 			print_fps = true;
+		} else if (I->get() == "--load-trace") {
+			if (I->next()) {
+				//start right away so every load below (project settings, boot splash, main scene) is attributed
+				ResourceLoadTrace::start(I->next()->get());
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing load-trace argument, aborting.\n");
+				goto error;
+			}
 		} else if (I->get() == "--disable-crash-handler") {
 			OS::get_singleton()->disable_crash_handler();
 		} else if (I->get() == "--skip-breakpoints") {
@@ -1122,6 +1141,9 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	Engine::get_singleton()->set_target_fps(GLOBAL_DEF("debug/settings/fps/force_fps", 0));
 	ProjectSettings::get_singleton()->set_custom_property_info("debug/settings/fps/force_fps", PropertyInfo(Variant::INT, "debug/settings/fps/force_fps", PROPERTY_HINT_RANGE, "0,120,1,or_greater"));
 
+	frame_scheduler->set_idle_budget_usec(GLOBAL_DEF("debug/settings/frame_scheduler/idle_budget_usec", 2000));
+	frame_scheduler->set_min_slice_usec(GLOBAL_DEF("debug/settings/frame_scheduler/min_slice_usec", 250));
+
 	GLOBAL_DEF("debug/settings/stdout/print_fps", false);
 
 	if (!OS::get_singleton()->_verbose_stdout) //overridden
@@ -1149,6 +1171,8 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 
 error:
 
+	ResourceLoadTrace::finish();
+
 	video_driver = "";
 	audio_driver = "";
 	project_path = "";
@@ -1159,6 +1183,8 @@ error:
 	if (show_help)
 		print_help(execpath);
 
+	if (frame_scheduler)
+		memdelete(frame_scheduler);
 	if (performance)
 		memdelete(performance);
 	if (input_map)
@@ -1956,6 +1982,8 @@ bool Main::iteration() {
 
 	iterating++;
 
+	FrameAllocator::reset_frame(); //data from the previous frame is gone now
+
 	uint64_t ticks = OS::get_singleton()->get_ticks_usec();
 	Engine::get_singleton()->_frame_ticks = ticks;
 	main_timer_sync.set_cpu_ticks_usec(ticks);
@@ -2002,17 +2030,25 @@ bool Main::iteration() {
 		Physics2DServer::get_singleton()->sync();
 		Physics2DServer::get_singleton()->flush_queries();
 
-		if (OS::get_singleton()->get_main_loop()->iteration(frame_slice * time_scale)) {
-			exit = true;
-			break;
+		{
+			TRACE_SCOPE("physics_process");
+			MEM_DOMAIN_SCOPE(DOMAIN_SCENE);
+			if (OS::get_singleton()->get_main_loop()->iteration(frame_slice * time_scale)) {
+				exit = true;
+				break;
+			}
 		}
 
 		message_queue->flush();
 
-		PhysicsServer::get_singleton()->step(frame_slice * time_scale);
+		{
+			TRACE_SCOPE("physics_server_step");
+			MEM_DOMAIN_SCOPE(DOMAIN_PHYSICS);
+			PhysicsServer::get_singleton()->step(frame_slice * time_scale);
 
-		Physics2DServer::get_singleton()->end_sync();
-		Physics2DServer::get_singleton()->step(frame_slice * time_scale);
+			Physics2DServer::get_singleton()->end_sync();
+			Physics2DServer::get_singleton()->step(frame_slice * time_scale);
+		}
 
 		message_queue->flush();
 
@@ -2025,8 +2061,12 @@ bool Main::iteration() {
 
 	uint64_t idle_begin = OS::get_singleton()->get_ticks_usec();
 
-	if (OS::get_singleton()->get_main_loop()->idle(step * time_scale)) {
-		exit = true;
+	{
+		TRACE_SCOPE("idle_process");
+		MEM_DOMAIN_SCOPE(DOMAIN_SCENE);
+		if (OS::get_singleton()->get_main_loop()->idle(step * time_scale)) {
+			exit = true;
+		}
 	}
 	message_queue->flush();
 
@@ -2034,6 +2074,9 @@ bool Main::iteration() {
 
 	if (OS::get_singleton()->can_draw() && !disable_render_loop) {
 
+		TRACE_SCOPE("visual_server_draw");
+		MEM_DOMAIN_SCOPE(DOMAIN_RENDERING);
+
 		if ((!force_redraw_requested) && OS::get_singleton()->is_in_low_processor_usage_mode()) {
 			if (VisualServer::get_singleton()->has_changed()) {
 				VisualServer::get_singleton()->draw(true, scaled_step); // flush visual commands
@@ -2056,6 +2099,22 @@ bool Main::iteration() {
 
 	AudioServer::get_singleton()->update();
 
+	if (frame_scheduler->get_task_count() > 0) {
+
+		//hand the scheduler whatever is left of the frame: with a target fps
+		//this is the time the loop would otherwise sleep away below; without
+		//one there is no measurable slack, so a configured budget is used
+		uint64_t sched_slack = frame_scheduler->get_idle_budget_usec();
+		int sched_fps = Engine::get_singleton()->get_target_fps();
+		if (sched_fps > 0 && !Engine::get_singleton()->is_editor_hint()) {
+			uint64_t time_step = 1000000L / sched_fps;
+			sched_slack = frame_time < time_step ? time_step - frame_time : 0;
+		}
+		frame_scheduler->process(sched_slack);
+	}
+
+	EngineTracepoints::flush_frame();
+
 	if (script_debugger) {
 		if (script_debugger->is_profiling()) {
 			script_debugger->profiling_set_frame_times(USEC_TO_SEC(frame_time), USEC_TO_SEC(idle_process_ticks), USEC_TO_SEC(physics_process_ticks), frame_slice);
@@ -2139,6 +2198,8 @@ void Main::cleanup() {
 
 	ERR_FAIL_COND(!_start_success);
 
+	ResourceLoadTrace::finish();
+
 	if (script_debugger) {
 		// Flush any remaining messages
 		script_debugger->idle_poll();
@@ -2205,6 +2266,8 @@ void Main::cleanup() {
 		memdelete(packed_data);
 	if (file_access_network_client)
 		memdelete(file_access_network_client);
+	if (frame_scheduler)
+		memdelete(frame_scheduler);
 	if (performance)
 		memdelete(performance);
 	if (input_map)
@@ -67,13 +67,33 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(RENDER_TEXTURE_MEM_USED);
 	BIND_ENUM_CONSTANT(RENDER_VERTEX_MEM_USED);
 	BIND_ENUM_CONSTANT(RENDER_USAGE_VIDEO_MEM_TOTAL);
+	BIND_ENUM_CONSTANT(RENDER_GPU_SHADOW_TIME);
+	BIND_ENUM_CONSTANT(RENDER_GPU_OPAQUE_TIME);
+	BIND_ENUM_CONSTANT(RENDER_GPU_TRANSPARENT_TIME);
+	BIND_ENUM_CONSTANT(RENDER_GPU_EFFECTS_TIME);
 	BIND_ENUM_CONSTANT(PHYSICS_2D_ACTIVE_OBJECTS);
 	BIND_ENUM_CONSTANT(PHYSICS_2D_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(PHYSICS_2D_ISLAND_COUNT);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_BROADPHASE_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_NARROWPHASE_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_ISLAND_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_SOLVE_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_INTEGRATE_TIME);
 	BIND_ENUM_CONSTANT(PHYSICS_3D_ACTIVE_OBJECTS);
 	BIND_ENUM_CONSTANT(PHYSICS_3D_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(PHYSICS_3D_ISLAND_COUNT);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_BROADPHASE_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_NARROWPHASE_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_ISLAND_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_SOLVE_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_INTEGRATE_TIME);
 	BIND_ENUM_CONSTANT(AUDIO_OUTPUT_LATENCY);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_CORE);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_RENDERING);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_PHYSICS);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_AUDIO);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_SCENE);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_SCRIPT);
 
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
@@ -113,13 +133,33 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		"video/texture_mem",
 		"video/vertex_mem",
 		"video/video_mem_max",
+		"gpu/shadow_time",
+		"gpu/opaque_time",
+		"gpu/transparent_time",
+		"gpu/effects_time",
 		"physics_2d/active_objects",
 		"physics_2d/collision_pairs",
 		"physics_2d/islands",
+		"physics_2d/broadphase_time",
+		"physics_2d/narrowphase_time",
+		"physics_2d/island_time",
+		"physics_2d/solve_time",
+		"physics_2d/integrate_time",
 		"physics_3d/active_objects",
 		"physics_3d/collision_pairs",
 		"physics_3d/islands",
+		"physics_3d/broadphase_time",
+		"physics_3d/narrowphase_time",
+		"physics_3d/island_time",
+		"physics_3d/solve_time",
+		"physics_3d/integrate_time",
 		"audio/output_latency",
+		"memory/static_core",
+		"memory/static_rendering",
+		"memory/static_physics",
+		"memory/static_audio",
+		"memory/static_scene",
+		"memory/static_script",
 
 	};
 
@@ -151,13 +191,33 @@ float Performance::get_monitor(Monitor p_monitor) const {
 		case RENDER_TEXTURE_MEM_USED: return VS::get_singleton()->get_render_info(VS::INFO_TEXTURE_MEM_USED);
 		case RENDER_VERTEX_MEM_USED: return VS::get_singleton()->get_render_info(VS::INFO_VERTEX_MEM_USED);
 		case RENDER_USAGE_VIDEO_MEM_TOTAL: return VS::get_singleton()->get_render_info(VS::INFO_USAGE_VIDEO_MEM_TOTAL);
+		case RENDER_GPU_SHADOW_TIME: return VS::get_singleton()->get_render_info(VS::INFO_GPU_SHADOW_TIME) / 1000000.0;
+		case RENDER_GPU_OPAQUE_TIME: return VS::get_singleton()->get_render_info(VS::INFO_GPU_OPAQUE_TIME) / 1000000.0;
+		case RENDER_GPU_TRANSPARENT_TIME: return VS::get_singleton()->get_render_info(VS::INFO_GPU_TRANSPARENT_TIME) / 1000000.0;
+		case RENDER_GPU_EFFECTS_TIME: return VS::get_singleton()->get_render_info(VS::INFO_GPU_EFFECTS_TIME) / 1000000.0;
 		case PHYSICS_2D_ACTIVE_OBJECTS: return Physics2DServer::get_singleton()->get_process_info(Physics2DServer::INFO_ACTIVE_OBJECTS);
 		case PHYSICS_2D_COLLISION_PAIRS: return Physics2DServer::get_singleton()->get_process_info(Physics2DServer::INFO_COLLISION_PAIRS);
 		case PHYSICS_2D_ISLAND_COUNT: return Physics2DServer::get_singleton()->get_process_info(Physics2DServer::INFO_ISLAND_COUNT);
+		case PHYSICS_2D_BROADPHASE_TIME: return Physics2DServer::get_singleton()->get_process_info(Physics2DServer::INFO_BROADPHASE_TIME) / 1000000.0;
+		case PHYSICS_2D_NARROWPHASE_TIME: return Physics2DServer::get_singleton()->get_process_info(Physics2DServer::INFO_NARROWPHASE_TIME) / 1000000.0;
+		case PHYSICS_2D_ISLAND_TIME: return Physics2DServer::get_singleton()->get_process_info(Physics2DServer::INFO_ISLAND_TIME) / 1000000.0;
+		case PHYSICS_2D_SOLVE_TIME: return Physics2DServer::get_singleton()->get_process_info(Physics2DServer::INFO_SOLVE_TIME) / 1000000.0;
+		case PHYSICS_2D_INTEGRATE_TIME: return Physics2DServer::get_singleton()->get_process_info(Physics2DServer::INFO_INTEGRATE_TIME) / 1000000.0;
 		case PHYSICS_3D_ACTIVE_OBJECTS: return PhysicsServer::get_singleton()->get_process_info(PhysicsServer::INFO_ACTIVE_OBJECTS);
 		case PHYSICS_3D_COLLISION_PAIRS: return PhysicsServer::get_singleton()->get_process_info(PhysicsServer::INFO_COLLISION_PAIRS);
 		case PHYSICS_3D_ISLAND_COUNT: return PhysicsServer::get_singleton()->get_process_info(PhysicsServer::INFO_ISLAND_COUNT);
+		case PHYSICS_3D_BROADPHASE_TIME: return PhysicsServer::get_singleton()->get_process_info(PhysicsServer::INFO_BROADPHASE_TIME) / 1000000.0;
+		case PHYSICS_3D_NARROWPHASE_TIME: return PhysicsServer::get_singleton()->get_process_info(PhysicsServer::INFO_NARROWPHASE_TIME) / 1000000.0;
+		case PHYSICS_3D_ISLAND_TIME: return PhysicsServer::get_singleton()->get_process_info(PhysicsServer::INFO_ISLAND_TIME) / 1000000.0;
+		case PHYSICS_3D_SOLVE_TIME: return PhysicsServer::get_singleton()->get_process_info(PhysicsServer::INFO_SOLVE_TIME) / 1000000.0;
+		case PHYSICS_3D_INTEGRATE_TIME: return PhysicsServer::get_singleton()->get_process_info(PhysicsServer::INFO_INTEGRATE_TIME) / 1000000.0;
 		case AUDIO_OUTPUT_LATENCY: return AudioServer::get_singleton()->get_output_latency();
+		case MEMORY_STATIC_CORE: return Memory::get_domain_usage(Memory::DOMAIN_CORE);
+		case MEMORY_STATIC_RENDERING: return Memory::get_domain_usage(Memory::DOMAIN_RENDERING);
+		case MEMORY_STATIC_PHYSICS: return Memory::get_domain_usage(Memory::DOMAIN_PHYSICS);
+		case MEMORY_STATIC_AUDIO: return Memory::get_domain_usage(Memory::DOMAIN_AUDIO);
+		case MEMORY_STATIC_SCENE: return Memory::get_domain_usage(Memory::DOMAIN_SCENE);
+		case MEMORY_STATIC_SCRIPT: return Memory::get_domain_usage(Memory::DOMAIN_SCRIPT);
 
 		default: {
 		}
@@ -193,13 +253,33 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_MEMORY,
 		MONITOR_TYPE_MEMORY,
 		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
 
 	};
 
@@ -73,14 +73,35 @@ public:
 		RENDER_TEXTURE_MEM_USED,
 		RENDER_VERTEX_MEM_USED,
 		RENDER_USAGE_VIDEO_MEM_TOTAL,
+		RENDER_GPU_SHADOW_TIME,
+		RENDER_GPU_OPAQUE_TIME,
+		RENDER_GPU_TRANSPARENT_TIME,
+		RENDER_GPU_EFFECTS_TIME,
 		PHYSICS_2D_ACTIVE_OBJECTS,
 		PHYSICS_2D_COLLISION_PAIRS,
 		PHYSICS_2D_ISLAND_COUNT,
+		PHYSICS_2D_BROADPHASE_TIME,
+		PHYSICS_2D_NARROWPHASE_TIME,
+		PHYSICS_2D_ISLAND_TIME,
+		PHYSICS_2D_SOLVE_TIME,
+		PHYSICS_2D_INTEGRATE_TIME,
 		PHYSICS_3D_ACTIVE_OBJECTS,
 		PHYSICS_3D_COLLISION_PAIRS,
 		PHYSICS_3D_ISLAND_COUNT,
+		PHYSICS_3D_BROADPHASE_TIME,
+		PHYSICS_3D_NARROWPHASE_TIME,
+		PHYSICS_3D_ISLAND_TIME,
+		PHYSICS_3D_SOLVE_TIME,
+		PHYSICS_3D_INTEGRATE_TIME,
 		//physics
 		AUDIO_OUTPUT_LATENCY,
+		//keep these last but before MONITOR_MAX; the enum is script-bound
+		MEMORY_STATIC_CORE,
+		MEMORY_STATIC_RENDERING,
+		MEMORY_STATIC_PHYSICS,
+		MEMORY_STATIC_AUDIO,
+		MEMORY_STATIC_SCENE,
+		MEMORY_STATIC_SCRIPT,
 		MONITOR_MAX
 	};
 
@@ -0,0 +1,2 @@
+static const unsigned char boot_splash_png[]={0};
+static const Color boot_splash_bg_color = Color(0,0,0);
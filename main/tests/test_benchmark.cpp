@@ -0,0 +1,309 @@
+/*************************************************************************/
+/*  test_benchmark.cpp                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "test_benchmark.h"
+
+#include "core/io/json.h"
+#include "core/io/marshalls.h"
+#include "core/math/a_star.h"
+#include "core/math/octree.h"
+#include "core/math/random_pcg.h"
+#include "core/os/os.h"
+#include "core/pool_vector.h"
+#include "core/variant.h"
+#include "core/version.h"
+
+#ifdef GDSCRIPT_ENABLED
+#include "modules/gdscript/gdscript.h"
+#endif
+
+//timed microbenchmarks over known hot paths, printing one JSON document so CI
+//can track trends; iteration counts are fixed so runs are comparable, and each
+//benchmark runs once untimed as warmup. run with: godot --test benchmark
+
+namespace TestBenchmark {
+
+static Array results;
+
+static void _report(const String &p_name, int p_iterations, uint64_t p_usec) {
+
+	Dictionary d;
+	d["name"] = p_name;
+	d["iterations"] = p_iterations;
+	d["total_usec"] = (int64_t)p_usec;
+	d["usec_per_iteration"] = p_iterations > 0 ? (double)p_usec / p_iterations : 0.0;
+	results.push_back(d);
+}
+
+static void bench_octree_cull_convex() {
+
+	const int object_count = 2000;
+	const int iterations = 1000;
+
+	RandomPCG rng;
+	rng.seed(0x600d5eed);
+
+	Octree<int> octree;
+	Vector<int> userdata;
+	userdata.resize(object_count);
+
+	for (int i = 0; i < object_count; i++) {
+		userdata.write[i] = i;
+		Vector3 pos(rng.randf() * 200.0 - 100.0, rng.randf() * 200.0 - 100.0, rng.randf() * 200.0 - 100.0);
+		octree.create(&userdata.write[i], AABB(pos, Vector3(1, 1, 1) * (0.5 + rng.randf() * 4.0)));
+	}
+
+	//frustum-like convex: five planes enclosing a wedge of the scene
+	Vector<Plane> convex;
+	convex.push_back(Plane(Vector3(0, 0, 1), -90));
+	convex.push_back(Plane(Vector3(0, 0, -1), -5));
+	convex.push_back(Plane(Vector3(0.7, 0, 0.7).normalized(), 20));
+	convex.push_back(Plane(Vector3(-0.7, 0, 0.7).normalized(), 20));
+	convex.push_back(Plane(Vector3(0, 1, 0), 40));
+
+	int *result_array[1024];
+
+	octree.cull_convex(convex, result_array, 1024); //warmup
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	int culled = 0;
+	for (int i = 0; i < iterations; i++) {
+		culled += octree.cull_convex(convex, result_array, 1024);
+	}
+	uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+	ERR_FAIL_COND(culled == 0); //also keeps the loop from being optimized out
+	_report("octree_cull_convex", iterations, elapsed);
+}
+
+static void bench_variant_evaluate() {
+
+	const int iterations = 1000000;
+
+	Variant a = 3;
+	Variant b = 4;
+	Variant c = 0.5;
+	Variant r;
+	bool valid;
+
+	Variant::evaluate(Variant::OP_ADD, a, b, r, valid); //warmup
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		Variant::evaluate(Variant::OP_ADD, a, b, r, valid);
+		Variant::evaluate(Variant::OP_MULTIPLY, r, c, r, valid);
+	}
+	uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+	_report("variant_evaluate", iterations * 2, elapsed);
+}
+
+static void bench_stringname_creation() {
+
+	const int name_count = 64;
+	const int iterations = 100000;
+
+	Vector<String> names;
+	for (int i = 0; i < name_count; i++) {
+		names.push_back("property_name_" + itos(i));
+	}
+
+	StringName warmup(names[0]);
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		StringName sn(names[i % name_count]);
+	}
+	uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+	_report("stringname_creation", iterations, elapsed);
+}
+
+static void bench_poolvector_access() {
+
+	const int size = 100000;
+	const int iterations = 100;
+
+	PoolVector<int> pv;
+	pv.resize(size);
+	{
+		PoolVector<int>::Write w = pv.write();
+		for (int i = 0; i < size; i++) {
+			w[i] = i;
+		}
+	}
+
+	int64_t sum = 0;
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		PoolVector<int>::Read r = pv.read();
+		const int *ptr = r.ptr();
+		for (int j = 0; j < size; j++) {
+			sum += ptr[j];
+		}
+	}
+	uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+	ERR_FAIL_COND(sum == 0);
+	_report("poolvector_read_sum", iterations * size, elapsed);
+
+	sum = 0;
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		for (int j = 0; j < size; j++) {
+			sum += pv.get(j); //locks per access, the pattern naive code uses
+		}
+	}
+	elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+	ERR_FAIL_COND(sum == 0);
+	_report("poolvector_get_sum", iterations * size, elapsed);
+}
+
+static void bench_gdscript_dispatch() {
+
+#ifdef GDSCRIPT_ENABLED
+	const int iterations = 200000;
+
+	Ref<GDScript> script;
+	script.instance();
+	script->set_source_code("func add_one(n):\n\treturn n + 1\n");
+	Error err = script->reload();
+	ERR_FAIL_COND_MSG(err != OK, "Benchmark script failed to compile.");
+
+	Ref<Reference> target;
+	target.instance();
+	target->set_script(script.get_ref_ptr());
+
+	Variant n = 0;
+
+	n = target->call("add_one", n); //warmup
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		n = target->call("add_one", n);
+	}
+	uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+	ERR_FAIL_COND((int)n != iterations + 1);
+	_report("gdscript_dispatch", iterations, elapsed);
+#endif
+}
+
+static void bench_encode_variant() {
+
+	const int iterations = 100000;
+
+	Dictionary dict;
+	dict["name"] = "benchmark";
+	dict["transform"] = Transform();
+	dict["health"] = 100;
+	dict["position"] = Vector3(1, 2, 3);
+	Array arr;
+	for (int i = 0; i < 8; i++) {
+		arr.push_back(i * 0.5);
+	}
+	dict["samples"] = arr;
+	Variant v = dict;
+
+	int len = 0;
+	encode_variant(v, NULL, len); //size query doubles as warmup
+
+	Vector<uint8_t> buffer;
+	buffer.resize(len);
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		encode_variant(v, buffer.ptrw(), len);
+	}
+	uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+	_report("encode_variant", iterations, elapsed);
+}
+
+static void bench_astar_solve() {
+
+	const int grid_size = 64;
+	const int iterations = 100;
+
+	AStar astar;
+	for (int x = 0; x < grid_size; x++) {
+		for (int y = 0; y < grid_size; y++) {
+			astar.add_point(x * grid_size + y, Vector3(x, 0, y));
+		}
+	}
+	for (int x = 0; x < grid_size; x++) {
+		for (int y = 0; y < grid_size; y++) {
+			if (x > 0) {
+				astar.connect_points(x * grid_size + y, (x - 1) * grid_size + y);
+			}
+			if (y > 0) {
+				astar.connect_points(x * grid_size + y, x * grid_size + y - 1);
+			}
+		}
+	}
+
+	astar.get_point_path(0, grid_size * grid_size - 1); //warmup
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	int path_points = 0;
+	for (int i = 0; i < iterations; i++) {
+		path_points += astar.get_point_path(0, grid_size * grid_size - 1).size();
+	}
+	uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+	ERR_FAIL_COND(path_points == 0);
+	_report("astar_solve", iterations, elapsed);
+}
+
+MainLoop *test() {
+
+	results = Array();
+
+	bench_octree_cull_convex();
+	bench_variant_evaluate();
+	bench_stringname_creation();
+	bench_poolvector_access();
+	bench_gdscript_dispatch();
+	bench_encode_variant();
+	bench_astar_solve();
+
+	Dictionary doc;
+	doc["version"] = VERSION_FULL_CONFIG;
+	doc["benchmarks"] = results;
+
+	print_line(JSON::print(doc));
+
+	results = Array();
+
+	return NULL;
+}
+} // namespace TestBenchmark
@@ -30,6 +30,7 @@
 
 #include "editor_scene_importer_assimp.h"
 #include "core/io/image_loader.h"
+#include "core/os/worker_thread_pool.h"
 #include "editor/import/resource_importer_scene.h"
 #include "import_utils.h"
 #include "scene/3d/camera.h"
@@ -840,6 +841,197 @@ void EditorSceneImporterAssimp::_import_animation(ImportState &state, int p_anim
 //
 // Mesh Generation from indices ? why do we need so much mesh code
 // [debt needs looked into]
+void EditorSceneImporterAssimp::_build_surface_task(void *p_userdata, uint32_t p_index) {
+
+	SurfaceData *surfaces = (SurfaceData *)p_userdata;
+	_build_surface_arrays(surfaces[p_index]);
+}
+
+void EditorSceneImporterAssimp::_build_surface_arrays(SurfaceData &p_surface) {
+
+	const aiMesh *ai_mesh = p_surface.ai_mesh;
+
+	//
+	// Create mesh from data from assimp
+	//
+
+	Ref<SurfaceTool> st;
+	st.instance();
+	st->begin(Mesh::PRIMITIVE_TRIANGLES);
+
+	for (size_t j = 0; j < ai_mesh->mNumVertices; j++) {
+
+		// Get the texture coordinates if they exist
+		if (ai_mesh->HasTextureCoords(0)) {
+			p_surface.has_uvs = true;
+			st->add_uv(Vector2(ai_mesh->mTextureCoords[0][j].x, 1.0f - ai_mesh->mTextureCoords[0][j].y));
+		}
+
+		if (ai_mesh->HasTextureCoords(1)) {
+			p_surface.has_uvs = true;
+			st->add_uv2(Vector2(ai_mesh->mTextureCoords[1][j].x, 1.0f - ai_mesh->mTextureCoords[1][j].y));
+		}
+
+		// Assign vertex colors
+		if (ai_mesh->HasVertexColors(0)) {
+			Color color = Color(ai_mesh->mColors[0]->r, ai_mesh->mColors[0]->g, ai_mesh->mColors[0]->b,
+					ai_mesh->mColors[0]->a);
+			st->add_color(color);
+		}
+
+		// Work out normal calculations? - this needs work it doesn't work properly on huestos
+		if (ai_mesh->mNormals != NULL) {
+			const aiVector3D normals = ai_mesh->mNormals[j];
+			const Vector3 godot_normal = Vector3(normals.x, normals.y, normals.z);
+			st->add_normal(godot_normal);
+			if (ai_mesh->HasTangentsAndBitangents()) {
+				const aiVector3D tangents = ai_mesh->mTangents[j];
+				const Vector3 godot_tangent = Vector3(tangents.x, tangents.y, tangents.z);
+				const aiVector3D bitangent = ai_mesh->mBitangents[j];
+				const Vector3 godot_bitangent = Vector3(bitangent.x, bitangent.y, bitangent.z);
+				float d = godot_normal.cross(godot_tangent).dot(godot_bitangent) > 0.0f ? 1.0f : -1.0f;
+				st->add_tangent(Plane(tangents.x, tangents.y, tangents.z, d));
+			}
+		}
+
+		// We have vertex weights right?
+		if (p_surface.vertex_weights.has(j)) {
+
+			Vector<BoneInfo> bone_info = p_surface.vertex_weights[j];
+			Vector<int> bones;
+			bones.resize(bone_info.size());
+			Vector<float> weights;
+			weights.resize(bone_info.size());
+
+			// todo? do we really need to loop over all bones? - assimp may have helper to find all influences on this vertex.
+			for (int k = 0; k < bone_info.size(); k++) {
+				bones.write[k] = bone_info[k].bone;
+				weights.write[k] = bone_info[k].weight;
+			}
+
+			st->add_bones(bones);
+			st->add_weights(weights);
+		}
+
+		// Assign vertex
+		const aiVector3D pos = ai_mesh->mVertices[j];
+
+		// note we must include node offset transform as this is relative to world space not local space.
+		Vector3 godot_pos = Vector3(pos.x, pos.y, pos.z);
+		st->add_vertex(godot_pos);
+	}
+
+	// fire replacement for face handling
+	for (size_t j = 0; j < ai_mesh->mNumFaces; j++) {
+		const aiFace face = ai_mesh->mFaces[j];
+		for (unsigned int k = 0; k < face.mNumIndices; k++) {
+			st->add_index(face.mIndices[k]);
+		}
+	}
+
+	if (ai_mesh->HasTangentsAndBitangents() == false && p_surface.has_uvs) {
+		st->generate_tangents();
+	}
+
+	Array array_mesh = st->commit_to_arrays();
+	Array morphs;
+	morphs.resize(ai_mesh->mNumAnimMeshes);
+
+	for (size_t j = 0; j < ai_mesh->mNumAnimMeshes; j++) {
+
+		String ai_anim_mesh_name = AssimpUtils::get_assimp_string(ai_mesh->mAnimMeshes[j]->mName);
+
+		if (ai_anim_mesh_name.empty()) {
+			ai_anim_mesh_name = String("morph_") + itos(j);
+		}
+
+		Array array_copy;
+		array_copy.resize(VisualServer::ARRAY_MAX);
+
+		for (int l = 0; l < VisualServer::ARRAY_MAX; l++) {
+			array_copy[l] = array_mesh[l].duplicate(true);
+		}
+
+		const size_t num_vertices = ai_mesh->mAnimMeshes[j]->mNumVertices;
+		array_copy[Mesh::ARRAY_INDEX] = Variant();
+		if (ai_mesh->mAnimMeshes[j]->HasPositions()) {
+			PoolVector3Array vertices;
+			vertices.resize(num_vertices);
+			for (size_t l = 0; l < num_vertices; l++) {
+				const aiVector3D ai_pos = ai_mesh->mAnimMeshes[j]->mVertices[l];
+				Vector3 position = Vector3(ai_pos.x, ai_pos.y, ai_pos.z);
+				vertices.write()[l] = position;
+			}
+			PoolVector3Array new_vertices = array_copy[VisualServer::ARRAY_VERTEX].duplicate(true);
+			ERR_CONTINUE(vertices.size() != new_vertices.size());
+			for (int32_t l = 0; l < new_vertices.size(); l++) {
+				PoolVector3Array::Write w = new_vertices.write();
+				w[l] = vertices[l];
+			}
+			array_copy[VisualServer::ARRAY_VERTEX] = new_vertices;
+		}
+
+		int32_t color_set = 0;
+		if (ai_mesh->mAnimMeshes[j]->HasVertexColors(color_set)) {
+			PoolColorArray colors;
+			colors.resize(num_vertices);
+			for (size_t l = 0; l < num_vertices; l++) {
+				const aiColor4D ai_color = ai_mesh->mAnimMeshes[j]->mColors[color_set][l];
+				Color color = Color(ai_color.r, ai_color.g, ai_color.b, ai_color.a);
+				colors.write()[l] = color;
+			}
+			PoolColorArray new_colors = array_copy[VisualServer::ARRAY_COLOR].duplicate(true);
+			ERR_CONTINUE(colors.size() != new_colors.size());
+			for (int32_t l = 0; l < colors.size(); l++) {
+				PoolColorArray::Write w = new_colors.write();
+				w[l] = colors[l];
+			}
+			array_copy[VisualServer::ARRAY_COLOR] = new_colors;
+		}
+
+		if (ai_mesh->mAnimMeshes[j]->HasNormals()) {
+			PoolVector3Array normals;
+			normals.resize(num_vertices);
+			for (size_t l = 0; l < num_vertices; l++) {
+				const aiVector3D ai_normal = ai_mesh->mAnimMeshes[j]->mNormals[l];
+				Vector3 normal = Vector3(ai_normal.x, ai_normal.y, ai_normal.z);
+				normals.write()[l] = normal;
+			}
+			PoolVector3Array new_normals = array_copy[VisualServer::ARRAY_NORMAL].duplicate(true);
+			ERR_CONTINUE(normals.size() != new_normals.size());
+			for (int l = 0; l < normals.size(); l++) {
+				PoolVector3Array::Write w = new_normals.write();
+				w[l] = normals[l];
+			}
+			array_copy[VisualServer::ARRAY_NORMAL] = new_normals;
+		}
+
+		if (ai_mesh->mAnimMeshes[j]->HasTangentsAndBitangents()) {
+			PoolColorArray tangents;
+			tangents.resize(num_vertices);
+			PoolColorArray::Write w = tangents.write();
+			for (size_t l = 0; l < num_vertices; l++) {
+				AssimpUtils::calc_tangent_from_mesh(ai_mesh, j, l, l, w);
+			}
+			PoolRealArray new_tangents = array_copy[VisualServer::ARRAY_TANGENT].duplicate(true);
+			ERR_CONTINUE(new_tangents.size() != tangents.size() * 4);
+			for (int32_t l = 0; l < tangents.size(); l++) {
+				new_tangents.write()[l + 0] = tangents[l].r;
+				new_tangents.write()[l + 1] = tangents[l].g;
+				new_tangents.write()[l + 2] = tangents[l].b;
+				new_tangents.write()[l + 3] = tangents[l].a;
+			}
+			array_copy[VisualServer::ARRAY_TANGENT] = new_tangents;
+		}
+
+		morphs[j] = array_copy;
+	}
+
+	p_surface.array_mesh = array_mesh;
+	p_surface.morphs = morphs;
+}
+
+
 Ref<Mesh>
 EditorSceneImporterAssimp::_generate_mesh_from_surface_indices(ImportState &state, const Vector<int> &p_surface_indices,
 		const aiNode *assimp_node, Ref<Skin> &skin,
@@ -869,11 +1061,16 @@ EditorSceneImporterAssimp::_generate_mesh_from_surface_indices(ImportState &stat
 	//
 	// Process Vertex Weights
 	//
+	// this part must stay serial, since it may assign the skeleton and skin
+	Vector<SurfaceData> surfaces;
+	surfaces.resize(p_surface_indices.size());
+
 	for (int i = 0; i < p_surface_indices.size(); i++) {
 		const unsigned int mesh_idx = p_surface_indices[i];
 		const aiMesh *ai_mesh = state.assimp_scene->mMeshes[mesh_idx];
-
-		Map<uint32_t, Vector<BoneInfo> > vertex_weights;
+		SurfaceData &surface = surfaces.write[i];
+		surface.ai_mesh = ai_mesh;
+		surface.has_uvs = false;
 
 		if (ai_mesh->mNumBones > 0) {
 			for (size_t b = 0; b < ai_mesh->mNumBones; b++) {
@@ -903,95 +1100,38 @@ EditorSceneImporterAssimp::_generate_mesh_from_surface_indices(ImportState &stat
 					bi.bone = bone_index;
 					bi.weight = ai_weights.mWeight;
 
-					if (!vertex_weights.has(vertex_index)) {
-						vertex_weights[vertex_index] = Vector<BoneInfo>();
+					if (!surface.vertex_weights.has(vertex_index)) {
+						surface.vertex_weights[vertex_index] = Vector<BoneInfo>();
 					}
 
-					vertex_weights[vertex_index].push_back(bi);
+					surface.vertex_weights[vertex_index].push_back(bi);
 				}
 			}
 		}
+	}
 
-		//
-		// Create mesh from data from assimp
-		//
-
-		Ref<SurfaceTool> st;
-		st.instance();
-		st->begin(Mesh::PRIMITIVE_TRIANGLES);
-
-		for (size_t j = 0; j < ai_mesh->mNumVertices; j++) {
-
-			// Get the texture coordinates if they exist
-			if (ai_mesh->HasTextureCoords(0)) {
-				has_uvs = true;
-				st->add_uv(Vector2(ai_mesh->mTextureCoords[0][j].x, 1.0f - ai_mesh->mTextureCoords[0][j].y));
-			}
-
-			if (ai_mesh->HasTextureCoords(1)) {
-				has_uvs = true;
-				st->add_uv2(Vector2(ai_mesh->mTextureCoords[1][j].x, 1.0f - ai_mesh->mTextureCoords[1][j].y));
-			}
-
-			// Assign vertex colors
-			if (ai_mesh->HasVertexColors(0)) {
-				Color color = Color(ai_mesh->mColors[0]->r, ai_mesh->mColors[0]->g, ai_mesh->mColors[0]->b,
-						ai_mesh->mColors[0]->a);
-				st->add_color(color);
-			}
-
-			// Work out normal calculations? - this needs work it doesn't work properly on huestos
-			if (ai_mesh->mNormals != NULL) {
-				const aiVector3D normals = ai_mesh->mNormals[j];
-				const Vector3 godot_normal = Vector3(normals.x, normals.y, normals.z);
-				st->add_normal(godot_normal);
-				if (ai_mesh->HasTangentsAndBitangents()) {
-					const aiVector3D tangents = ai_mesh->mTangents[j];
-					const Vector3 godot_tangent = Vector3(tangents.x, tangents.y, tangents.z);
-					const aiVector3D bitangent = ai_mesh->mBitangents[j];
-					const Vector3 godot_bitangent = Vector3(bitangent.x, bitangent.y, bitangent.z);
-					float d = godot_normal.cross(godot_tangent).dot(godot_bitangent) > 0.0f ? 1.0f : -1.0f;
-					st->add_tangent(Plane(tangents.x, tangents.y, tangents.z, d));
-				}
-			}
-
-			// We have vertex weights right?
-			if (vertex_weights.has(j)) {
-
-				Vector<BoneInfo> bone_info = vertex_weights[j];
-				Vector<int> bones;
-				bones.resize(bone_info.size());
-				Vector<float> weights;
-				weights.resize(bone_info.size());
-
-				// todo? do we really need to loop over all bones? - assimp may have helper to find all influences on this vertex.
-				for (int k = 0; k < bone_info.size(); k++) {
-					bones.write[k] = bone_info[k].bone;
-					weights.write[k] = bone_info[k].weight;
-				}
-
-				st->add_bones(bones);
-				st->add_weights(weights);
-			}
+	//
+	// Create mesh data from assimp
+	//
+	// vertex de-indexing, tangent generation and morph target arrays are
+	// independent per surface, so they are spread over the worker pool
+	if (surfaces.size() > 1) {
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_group_task(_build_surface_task, surfaces.ptrw(), surfaces.size());
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	} else if (surfaces.size() == 1) {
+		_build_surface_arrays(surfaces.write[0]);
+	}
 
-			// Assign vertex
-			const aiVector3D pos = ai_mesh->mVertices[j];
+	//
+	// Build the materials and assemble the mesh; the texture cache in the
+	// import state is shared, so this part stays serial
+	//
+	for (int i = 0; i < surfaces.size(); i++) {
 
-			// note we must include node offset transform as this is relative to world space not local space.
-			Vector3 godot_pos = Vector3(pos.x, pos.y, pos.z);
-			st->add_vertex(godot_pos);
-		}
+		const aiMesh *ai_mesh = surfaces[i].ai_mesh;
 
-		// fire replacement for face handling
-		for (size_t j = 0; j < ai_mesh->mNumFaces; j++) {
-			const aiFace face = ai_mesh->mFaces[j];
-			for (unsigned int k = 0; k < face.mNumIndices; k++) {
-				st->add_index(face.mIndices[k]);
-			}
-		}
-
-		if (ai_mesh->HasTangentsAndBitangents() == false && has_uvs) {
-			st->generate_tangents();
+		if (surfaces[i].has_uvs) {
+			has_uvs = true;
 		}
 
 		aiMaterial *ai_material = state.assimp_scene->mMaterials[ai_mesh->mMaterialIndex];
@@ -1201,101 +1341,7 @@ EditorSceneImporterAssimp::_generate_mesh_from_surface_indices(ImportState &stat
 			}
 		}
 
-		Array array_mesh = st->commit_to_arrays();
-		Array morphs;
-		morphs.resize(ai_mesh->mNumAnimMeshes);
-		Mesh::PrimitiveType primitive = Mesh::PRIMITIVE_TRIANGLES;
-
-		for (size_t j = 0; j < ai_mesh->mNumAnimMeshes; j++) {
-
-			String ai_anim_mesh_name = AssimpUtils::get_assimp_string(ai_mesh->mAnimMeshes[j]->mName);
-
-			if (ai_anim_mesh_name.empty()) {
-				ai_anim_mesh_name = String("morph_") + itos(j);
-			}
-
-			Array array_copy;
-			array_copy.resize(VisualServer::ARRAY_MAX);
-
-			for (int l = 0; l < VisualServer::ARRAY_MAX; l++) {
-				array_copy[l] = array_mesh[l].duplicate(true);
-			}
-
-			const size_t num_vertices = ai_mesh->mAnimMeshes[j]->mNumVertices;
-			array_copy[Mesh::ARRAY_INDEX] = Variant();
-			if (ai_mesh->mAnimMeshes[j]->HasPositions()) {
-				PoolVector3Array vertices;
-				vertices.resize(num_vertices);
-				for (size_t l = 0; l < num_vertices; l++) {
-					const aiVector3D ai_pos = ai_mesh->mAnimMeshes[j]->mVertices[l];
-					Vector3 position = Vector3(ai_pos.x, ai_pos.y, ai_pos.z);
-					vertices.write()[l] = position;
-				}
-				PoolVector3Array new_vertices = array_copy[VisualServer::ARRAY_VERTEX].duplicate(true);
-				ERR_CONTINUE(vertices.size() != new_vertices.size());
-				for (int32_t l = 0; l < new_vertices.size(); l++) {
-					PoolVector3Array::Write w = new_vertices.write();
-					w[l] = vertices[l];
-				}
-				array_copy[VisualServer::ARRAY_VERTEX] = new_vertices;
-			}
-
-			int32_t color_set = 0;
-			if (ai_mesh->mAnimMeshes[j]->HasVertexColors(color_set)) {
-				PoolColorArray colors;
-				colors.resize(num_vertices);
-				for (size_t l = 0; l < num_vertices; l++) {
-					const aiColor4D ai_color = ai_mesh->mAnimMeshes[j]->mColors[color_set][l];
-					Color color = Color(ai_color.r, ai_color.g, ai_color.b, ai_color.a);
-					colors.write()[l] = color;
-				}
-				PoolColorArray new_colors = array_copy[VisualServer::ARRAY_COLOR].duplicate(true);
-				ERR_CONTINUE(colors.size() != new_colors.size());
-				for (int32_t l = 0; l < colors.size(); l++) {
-					PoolColorArray::Write w = new_colors.write();
-					w[l] = colors[l];
-				}
-				array_copy[VisualServer::ARRAY_COLOR] = new_colors;
-			}
-
-			if (ai_mesh->mAnimMeshes[j]->HasNormals()) {
-				PoolVector3Array normals;
-				normals.resize(num_vertices);
-				for (size_t l = 0; l < num_vertices; l++) {
-					const aiVector3D ai_normal = ai_mesh->mAnimMeshes[j]->mNormals[l];
-					Vector3 normal = Vector3(ai_normal.x, ai_normal.y, ai_normal.z);
-					normals.write()[l] = normal;
-				}
-				PoolVector3Array new_normals = array_copy[VisualServer::ARRAY_NORMAL].duplicate(true);
-				ERR_CONTINUE(normals.size() != new_normals.size());
-				for (int l = 0; l < normals.size(); l++) {
-					PoolVector3Array::Write w = new_normals.write();
-					w[l] = normals[l];
-				}
-				array_copy[VisualServer::ARRAY_NORMAL] = new_normals;
-			}
-
-			if (ai_mesh->mAnimMeshes[j]->HasTangentsAndBitangents()) {
-				PoolColorArray tangents;
-				tangents.resize(num_vertices);
-				PoolColorArray::Write w = tangents.write();
-				for (size_t l = 0; l < num_vertices; l++) {
-					AssimpUtils::calc_tangent_from_mesh(ai_mesh, j, l, l, w);
-				}
-				PoolRealArray new_tangents = array_copy[VisualServer::ARRAY_TANGENT].duplicate(true);
-				ERR_CONTINUE(new_tangents.size() != tangents.size() * 4);
-				for (int32_t l = 0; l < tangents.size(); l++) {
-					new_tangents.write()[l + 0] = tangents[l].r;
-					new_tangents.write()[l + 1] = tangents[l].g;
-					new_tangents.write()[l + 2] = tangents[l].b;
-					new_tangents.write()[l + 3] = tangents[l].a;
-				}
-				array_copy[VisualServer::ARRAY_TANGENT] = new_tangents;
-			}
-
-			morphs[j] = array_copy;
-		}
-		mesh->add_surface_from_arrays(primitive, array_mesh, morphs);
+		mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, surfaces[i].array_mesh, surfaces[i].morphs);
 		mesh->surface_set_material(i, mat);
 		mesh->surface_set_name(i, AssimpUtils::get_assimp_string(ai_mesh->mName));
 	}
@@ -88,6 +88,17 @@ private:
 		float weight;
 	};
 
+	struct SurfaceData {
+		const aiMesh *ai_mesh;
+		Map<uint32_t, Vector<BoneInfo> > vertex_weights;
+		Array array_mesh;
+		Array morphs;
+		bool has_uvs;
+	};
+
+	static void _build_surface_task(void *p_userdata, uint32_t p_index);
+	static void _build_surface_arrays(SurfaceData &p_surface);
+
 	Ref<Mesh> _generate_mesh_from_surface_indices(ImportState &state, const Vector<int> &p_surface_indices,
 			const aiNode *assimp_node, Ref<Skin> &skin,
 			Skeleton *&skeleton_assigned);
@@ -56,3 +56,24 @@ bool GodotCollisionDispatcher::needsResponse(const btCollisionObject *body0, con
 	}
 	return btCollisionDispatcher::needsResponse(body0, body1);
 }
+
+const int GodotCollisionDispatcherMt::CASTED_TYPE_AREA = static_cast<int>(CollisionObjectBullet::TYPE_AREA);
+
+GodotCollisionDispatcherMt::GodotCollisionDispatcherMt(btCollisionConfiguration *collisionConfiguration) :
+		btCollisionDispatcherMt(collisionConfiguration) {}
+
+bool GodotCollisionDispatcherMt::needsCollision(const btCollisionObject *body0, const btCollisionObject *body1) {
+	if (body0->getUserIndex() == CASTED_TYPE_AREA || body1->getUserIndex() == CASTED_TYPE_AREA) {
+		// Avoide area narrow phase
+		return false;
+	}
+	return btCollisionDispatcher::needsCollision(body0, body1);
+}
+
+bool GodotCollisionDispatcherMt::needsResponse(const btCollisionObject *body0, const btCollisionObject *body1) {
+	if (body0->getUserIndex() == CASTED_TYPE_AREA || body1->getUserIndex() == CASTED_TYPE_AREA) {
+		// Avoide area narrow phase
+		return false;
+	}
+	return btCollisionDispatcher::needsResponse(body0, body1);
+}
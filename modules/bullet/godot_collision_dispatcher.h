@@ -33,6 +33,7 @@
 
 #include "core/int_types.h"
 
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
 #include <btBulletDynamicsCommon.h>
 
 /**
@@ -49,4 +50,17 @@ public:
 	virtual bool needsCollision(const btCollisionObject *body0, const btCollisionObject *body1);
 	virtual bool needsResponse(const btCollisionObject *body0, const btCollisionObject *body1);
 };
+
+/// Same behaviour as GodotCollisionDispatcher, but runs the narrowphase pairs
+/// in parallel on the task scheduler. Manifold order is no longer stable
+/// across runs, so it's only used when deterministic dispatch is disabled.
+class GodotCollisionDispatcherMt : public btCollisionDispatcherMt {
+private:
+	static const int CASTED_TYPE_AREA;
+
+public:
+	GodotCollisionDispatcherMt(btCollisionConfiguration *collisionConfiguration);
+	virtual bool needsCollision(const btCollisionObject *body0, const btCollisionObject *body1);
+	virtual bool needsResponse(const btCollisionObject *body0, const btCollisionObject *body1);
+};
 #endif
@@ -32,6 +32,7 @@
 
 #include "bullet_types_converter.h"
 #include "bullet_utilities.h"
+#include "core/os/worker_thread_pool.h"
 #include "scene/3d/soft_body.h"
 #include "space_bullet.h"
 
@@ -76,28 +77,48 @@ void SoftBodyBullet::on_enter_area(AreaBullet *p_area) {}
 
 void SoftBodyBullet::on_exit_area(AreaBullet *p_area) {}
 
+struct SoftBodyUpdateVisualServerTask {
+	const btSoftBody::tNodeArray *nodes;
+	const Vector<int> *indices_table;
+	SoftBodyVisualServerHandler *handler;
+};
+
+static void _update_visual_server_thread(void *p_userdata, uint32_t p_index) {
+
+	SoftBodyUpdateVisualServerTask *task = (SoftBodyUpdateVisualServerTask *)p_userdata;
+
+	const btSoftBody::Node &node = (*task->nodes)[p_index];
+	const void *vertex_position = reinterpret_cast<const void *>(&node.m_x);
+	const void *vertex_normal = reinterpret_cast<const void *>(&node.m_n);
+
+	const Vector<int> &vs_indices = task->indices_table[p_index];
+
+	const int vs_indices_size(vs_indices.size());
+	for (int x = 0; x < vs_indices_size; ++x) {
+		task->handler->set_vertex(vs_indices[x], vertex_position);
+		task->handler->set_normal(vs_indices[x], vertex_normal);
+	}
+}
+
 void SoftBodyBullet::update_visual_server(SoftBodyVisualServerHandler *p_visual_server_handler) {
 	if (!bt_soft_body)
 		return;
 
 	/// Update visual server vertices
-	const btSoftBody::tNodeArray &nodes(bt_soft_body->m_nodes);
-	const int nodes_count = nodes.size();
-
-	const Vector<int> *vs_indices;
-	const void *vertex_position;
-	const void *vertex_normal;
+	/// Nodes map to disjoint ranges of the surface buffer, so the copy out can run per node in parallel.
+	const int nodes_count = bt_soft_body->m_nodes.size();
 
-	for (int vertex_index = 0; vertex_index < nodes_count; ++vertex_index) {
-		vertex_position = reinterpret_cast<const void *>(&nodes[vertex_index].m_x);
-		vertex_normal = reinterpret_cast<const void *>(&nodes[vertex_index].m_n);
+	SoftBodyUpdateVisualServerTask task;
+	task.nodes = &bt_soft_body->m_nodes;
+	task.indices_table = indices_table.ptr();
+	task.handler = p_visual_server_handler;
 
-		vs_indices = &indices_table[vertex_index];
-
-		const int vs_indices_size(vs_indices->size());
-		for (int x = 0; x < vs_indices_size; ++x) {
-			p_visual_server_handler->set_vertex((*vs_indices)[x], vertex_position);
-			p_visual_server_handler->set_normal((*vs_indices)[x], vertex_normal);
+	if (nodes_count > 512 && WorkerThreadPool::get_singleton()) {
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_group_task(_update_visual_server_thread, &task, nodes_count);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	} else {
+		for (int vertex_index = 0; vertex_index < nodes_count; ++vertex_index) {
+			_update_visual_server_thread(&task, vertex_index);
 		}
 	}
 
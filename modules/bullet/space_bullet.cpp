@@ -34,6 +34,7 @@
 #include "bullet_types_converter.h"
 #include "bullet_utilities.h"
 #include "constraint_bullet.h"
+#include "core/os/worker_thread_pool.h"
 #include "core/project_settings.h"
 #include "core/ustring.h"
 #include "godot_collision_configuration.h"
@@ -48,8 +49,11 @@
 #include <BulletCollision/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.h>
 #include <BulletCollision/NarrowPhaseCollision/btGjkPairDetector.h>
 #include <BulletCollision/NarrowPhaseCollision/btPointCollector.h>
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
 #include <BulletSoftBody/btSoftBodyRigidBodyCollisionConfiguration.h>
 #include <BulletSoftBody/btSoftRigidDynamicsWorld.h>
+#include <LinearMath/btThreads.h>
 #include <btBulletDynamicsCommon.h>
 
 #include <assert.h>
@@ -336,6 +340,7 @@ SpaceBullet::SpaceBullet() :
 		collisionConfiguration(NULL),
 		dispatcher(NULL),
 		solver(NULL),
+		solver_pool(NULL),
 		dynamicsWorld(NULL),
 		soft_body_world_info(NULL),
 		ghostPairCallback(NULL),
@@ -579,14 +584,102 @@ btScalar calculateGodotCombinedFriction(const btCollisionObject *body0, const bt
 	return ABS(MIN(body0->getFriction(), body1->getFriction()));
 }
 
+/// Maps Bullet's internal parallelFor/parallelSum calls (island solving,
+/// parallel narrowphase, transform integration) onto the engine worker pool.
+class GodotBtTaskScheduler : public btITaskScheduler {
+
+	struct ParallelForTask {
+		const btIParallelForBody *body;
+		int begin;
+		int end;
+		int grain;
+	};
+
+	struct ParallelSumTask {
+		const btIParallelSumBody *body;
+		int begin;
+		int end;
+		int grain;
+		btScalar *sums;
+	};
+
+	static void _for_thread(void *p_userdata, uint32_t p_index) {
+		ParallelForTask *task = (ParallelForTask *)p_userdata;
+		const int from = task->begin + (int)p_index * task->grain;
+		task->body->forLoop(from, MIN(from + task->grain, task->end));
+	}
+
+	static void _sum_thread(void *p_userdata, uint32_t p_index) {
+		ParallelSumTask *task = (ParallelSumTask *)p_userdata;
+		const int from = task->begin + (int)p_index * task->grain;
+		task->sums[p_index] = task->body->sumLoop(from, MIN(from + task->grain, task->end));
+	}
+
+public:
+	GodotBtTaskScheduler() :
+			btITaskScheduler("GodotWorkerThreadPool") {}
+
+	virtual int getMaxNumThreads() const { return WorkerThreadPool::get_singleton()->get_thread_count() + 1; }
+	virtual int getNumThreads() const { return getMaxNumThreads(); }
+	virtual void setNumThreads(int numThreads) {}
+
+	virtual void parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody &body) {
+		if (iEnd - iBegin > grainSize) {
+			ParallelForTask task;
+			task.body = &body;
+			task.begin = iBegin;
+			task.end = iEnd;
+			task.grain = grainSize;
+			WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_group_task(_for_thread, &task, (iEnd - iBegin - 1) / grainSize + 1);
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+		} else {
+			body.forLoop(iBegin, iEnd);
+		}
+	}
+
+	virtual btScalar parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody &body) {
+		if (iEnd - iBegin > grainSize) {
+			const int chunks = (iEnd - iBegin - 1) / grainSize + 1;
+			Vector<btScalar> sums;
+			sums.resize(chunks);
+
+			ParallelSumTask task;
+			task.body = &body;
+			task.begin = iBegin;
+			task.end = iEnd;
+			task.grain = grainSize;
+			task.sums = sums.ptrw();
+			WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_group_task(_sum_thread, &task, chunks);
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+			btScalar sum = 0;
+			for (int i = 0; i < chunks; ++i) {
+				sum += sums[i];
+			}
+			return sum;
+		}
+		return body.sumLoop(iBegin, iEnd);
+	}
+};
+
 void SpaceBullet::create_empty_world(bool p_create_soft_world) {
 
 	gjk_epa_pen_solver = bulletnew(btGjkEpaPenetrationDepthSolver);
 	gjk_simplex_solver = bulletnew(btVoronoiSimplexSolver);
 
+	/// btSoftRigidDynamicsWorld has no multithreaded variant, so parallel
+	/// stepping is only available when the soft world is disabled.
+	const bool multithreaded = GLOBAL_DEF("physics/3d/bullet/multithreaded", false) && !p_create_soft_world && WorkerThreadPool::get_singleton();
+	/// Deterministic dispatch keeps the serial narrowphase so manifold (and
+	/// therefore constraint) ordering is stable across runs; islands are
+	/// still solved in parallel either way.
+	const bool deterministic_dispatch = GLOBAL_DEF("physics/3d/bullet/deterministic_dispatch", true);
+
 	void *world_mem;
 	if (p_create_soft_world) {
 		world_mem = malloc(sizeof(btSoftRigidDynamicsWorld));
+	} else if (multithreaded) {
+		world_mem = malloc(sizeof(btDiscreteDynamicsWorldMt));
 	} else {
 		world_mem = malloc(sizeof(btDiscreteDynamicsWorld));
 	}
@@ -599,14 +692,31 @@ void SpaceBullet::create_empty_world(bool p_create_soft_world) {
 		collisionConfiguration = bulletnew(GodotCollisionConfiguration(static_cast<btDiscreteDynamicsWorld *>(world_mem)));
 	}
 
-	dispatcher = bulletnew(GodotCollisionDispatcher(collisionConfiguration));
+	if (multithreaded && !deterministic_dispatch) {
+		dispatcher = bulletnew(GodotCollisionDispatcherMt(collisionConfiguration));
+	} else {
+		dispatcher = bulletnew(GodotCollisionDispatcher(collisionConfiguration));
+	}
 	broadphase = bulletnew(btDbvtBroadphase);
-	solver = bulletnew(btSequentialImpulseConstraintSolver);
 
 	if (p_create_soft_world) {
+		solver = bulletnew(btSequentialImpulseConstraintSolver);
 		dynamicsWorld = new (world_mem) btSoftRigidDynamicsWorld(dispatcher, broadphase, solver, collisionConfiguration);
 		soft_body_world_info = bulletnew(btSoftBodyWorldInfo);
+	} else if (multithreaded) {
+		// Installed once for the process; the scheduler is shared by every
+		// space and lives as long as the worker pool does.
+		static GodotBtTaskScheduler *bt_task_scheduler = NULL;
+		if (!bt_task_scheduler) {
+			bt_task_scheduler = bulletnew(GodotBtTaskScheduler);
+			btSetTaskScheduler(bt_task_scheduler);
+		}
+
+		solver_pool = bulletnew(btConstraintSolverPoolMt(bt_task_scheduler->getMaxNumThreads()));
+		solver = bulletnew(btSequentialImpulseConstraintSolverMt);
+		dynamicsWorld = new (world_mem) btDiscreteDynamicsWorldMt(dispatcher, broadphase, solver_pool, solver, collisionConfiguration);
 	} else {
+		solver = bulletnew(btSequentialImpulseConstraintSolver);
 		dynamicsWorld = new (world_mem) btDiscreteDynamicsWorld(dispatcher, broadphase, solver, collisionConfiguration);
 	}
 
@@ -648,6 +758,7 @@ void SpaceBullet::destroy_world() {
 	dynamicsWorld = NULL;
 
 	bulletdelete(solver);
+	bulletdelete(solver_pool);
 	bulletdelete(broadphase);
 	bulletdelete(dispatcher);
 	bulletdelete(collisionConfiguration);
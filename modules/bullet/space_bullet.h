@@ -96,6 +96,7 @@ class SpaceBullet : public RIDBullet {
 	btDefaultCollisionConfiguration *collisionConfiguration;
 	btCollisionDispatcher *dispatcher;
 	btConstraintSolver *solver;
+	class btConstraintSolverPoolMt *solver_pool;
 	btDiscreteDynamicsWorld *dynamicsWorld;
 	btSoftBodyWorldInfo *soft_body_world_info;
 	btGhostPairCallback *ghostPairCallback;
@@ -32,6 +32,7 @@
 #include "core/math/face3.h"
 #include "core/math/geometry.h"
 #include "core/os/os.h"
+#include "core/os/worker_thread_pool.h"
 #include "core/sort_array.h"
 #include "thirdparty/misc/triangulator.h"
 
@@ -1254,23 +1255,47 @@ void CSGBrushOperation::MeshMerge::mark_inside_faces() {
 	int max_alloc = faces.size();
 	_create_bvh(bvh, bvhptr, 0, faces.size(), 1, max_depth, max_alloc);
 
-	for (int i = 0; i < faces.size(); i++) {
+	//classifying each face is independent and only reads the BVH, so it spreads over the worker pool
+
+	MarkInsideTask task;
+	task.mesh = this;
+	task.bvh = bvh;
+	task.facesw = faces.ptrw();
+	task.max_depth = max_depth;
+	task.bvh_first = max_alloc - 1;
+	task.max_distance = max_distance;
+	task.intersection_aabb = intersection_aabb;
+
+	if (faces.size() > 512 && WorkerThreadPool::get_singleton()) {
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_group_task(_mark_inside_thread, &task, faces.size());
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	} else {
+		for (int i = 0; i < faces.size(); i++) {
+			_mark_inside_thread(&task, i);
+		}
+	}
+}
 
-		if (!intersection_aabb.intersects(bvh[i].aabb))
-			continue; //not in AABB intersection, so not in face intersection
-		Vector3 center = points[faces[i].points[0]];
-		center += points[faces[i].points[1]];
-		center += points[faces[i].points[2]];
-		center /= 3.0;
+void CSGBrushOperation::MeshMerge::_mark_inside_thread(void *p_userdata, uint32_t p_index) {
 
-		Plane plane(points[faces[i].points[0]], points[faces[i].points[1]], points[faces[i].points[2]]);
-		Vector3 target = center + plane.normal * max_distance + Vector3(0.0001234, 0.000512, 0.00013423); //reduce chance of edge hits by doing a small increment
+	MarkInsideTask *task = (MarkInsideTask *)p_userdata;
+	const MeshMerge *mesh = task->mesh;
+	int i = p_index;
 
-		int intersections = _bvh_count_intersections(bvh, max_depth, max_alloc - 1, center, target, i);
+	if (!task->intersection_aabb.intersects(task->bvh[i].aabb))
+		return; //not in AABB intersection, so not in face intersection
+	Vector3 center = mesh->points[mesh->faces[i].points[0]];
+	center += mesh->points[mesh->faces[i].points[1]];
+	center += mesh->points[mesh->faces[i].points[2]];
+	center /= 3.0;
 
-		if (intersections & 1) {
-			faces.write[i].inside = true;
-		}
+	Plane plane(mesh->points[mesh->faces[i].points[0]], mesh->points[mesh->faces[i].points[1]], mesh->points[mesh->faces[i].points[2]]);
+	Vector3 target = center + plane.normal * task->max_distance + Vector3(0.0001234, 0.000512, 0.00013423); //reduce chance of edge hits by doing a small increment
+
+	int intersections = mesh->_bvh_count_intersections(task->bvh, task->max_depth, task->bvh_first, center, target, i);
+
+	if (intersections & 1) {
+		task->facesw[i].inside = true;
 	}
 }
 
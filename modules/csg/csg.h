@@ -161,6 +161,18 @@ struct CSGBrushOperation {
 		//		void add_face(const Vector3 &p_a, const Vector3 &p_b, const Vector3 &p_c, bool p_from_b);
 
 		float vertex_snap;
+
+		struct MarkInsideTask {
+			const MeshMerge *mesh;
+			BVH *bvh;
+			Face *facesw;
+			int max_depth;
+			int bvh_first;
+			float max_distance;
+			AABB intersection_aabb;
+		};
+
+		static void _mark_inside_thread(void *p_userdata, uint32_t p_index);
 		void mark_inside_faces();
 	};
 
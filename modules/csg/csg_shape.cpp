@@ -131,11 +131,15 @@ float CSGShape::get_snap() const {
 	return snap;
 }
 
-void CSGShape::_make_dirty() {
+void CSGShape::_make_dirty(bool p_from_child) {
 
 	if (!is_inside_tree())
 		return;
 
+	if (!p_from_child) {
+		self_dirty = true; //our own brush is an input to every fold step, so the whole chain has to redo
+	}
+
 	if (dirty) {
 		return;
 	}
@@ -143,13 +147,21 @@ void CSGShape::_make_dirty() {
 	dirty = true;
 
 	if (parent) {
-		parent->_make_dirty();
+		parent->_make_dirty(true);
 	} else {
 		//only parent will do
 		call_deferred("_update_shape");
 	}
 }
 
+void CSGShape::_clear_fold_cache(int p_from) {
+
+	for (int i = p_from; i < fold_cache.size(); i++) {
+		memdelete(fold_cache[i].accum);
+	}
+	fold_cache.resize(p_from);
+}
+
 CSGBrush *CSGShape::_get_brush() {
 
 	if (dirty) {
@@ -158,7 +170,17 @@ CSGBrush *CSGShape::_get_brush() {
 		}
 		brush = NULL;
 
-		CSGBrush *n = _build_brush();
+		//children combine as a left fold, so the accumulated result after each child
+		//is cached; when only a late child changed, the folds before it are reused
+
+		CSGBrush *n = NULL;
+		int fold_idx = 0; //leading fold steps found still valid
+		bool prefix_valid = !self_dirty && fold_cache.size() > 0;
+
+		if (!prefix_valid) {
+			_clear_fold_cache(0);
+			n = _build_brush();
+		}
 
 		for (int i = 0; i < get_child_count(); i++) {
 
@@ -171,20 +193,43 @@ CSGBrush *CSGShape::_get_brush() {
 			CSGBrush *n2 = child->_get_brush();
 			if (!n2)
 				continue;
+
+			Transform child_xform = child->get_transform();
+			Operation child_op = child->get_operation();
+
+			if (prefix_valid) {
+				if (fold_idx < fold_cache.size()) {
+					const FoldStep &fs = fold_cache[fold_idx];
+					if (fs.child == child && fs.version == child->brush_version && fs.xform == child_xform && fs.operation == child_op) {
+						fold_idx++;
+						continue; //this fold step did not change, keep the cached accumulation
+					}
+				}
+				//first step that changed, resume from the last valid accumulation
+				prefix_valid = false;
+				_clear_fold_cache(fold_idx);
+				if (fold_idx > 0) {
+					n = memnew(CSGBrush);
+					n->copy_from(*fold_cache[fold_idx - 1].accum, Transform());
+				} else {
+					n = _build_brush();
+				}
+			}
+
 			if (!n) {
 				n = memnew(CSGBrush);
 
-				n->copy_from(*n2, child->get_transform());
+				n->copy_from(*n2, child_xform);
 
 			} else {
 
 				CSGBrush *nn = memnew(CSGBrush);
 				CSGBrush *nn2 = memnew(CSGBrush);
-				nn2->copy_from(*n2, child->get_transform());
+				nn2->copy_from(*n2, child_xform);
 
 				CSGBrushOperation bop;
 
-				switch (child->get_operation()) {
+				switch (child_op) {
 					case CSGShape::OPERATION_UNION: bop.merge_brushes(CSGBrushOperation::OPERATION_UNION, *n, *nn2, *nn, snap); break;
 					case CSGShape::OPERATION_INTERSECTION: bop.merge_brushes(CSGBrushOperation::OPERATION_INTERSECTION, *n, *nn2, *nn, snap); break;
 					case CSGShape::OPERATION_SUBTRACTION: bop.merge_brushes(CSGBrushOperation::OPERATION_SUBSTRACTION, *n, *nn2, *nn, snap); break;
@@ -193,6 +238,27 @@ CSGBrush *CSGShape::_get_brush() {
 				memdelete(nn2);
 				n = nn;
 			}
+
+			FoldStep fs;
+			fs.child = child;
+			fs.version = child->brush_version;
+			fs.xform = child_xform;
+			fs.operation = child_op;
+			fs.accum = memnew(CSGBrush);
+			fs.accum->copy_from(*n, Transform());
+			fold_cache.push_back(fs);
+			fold_idx++;
+		}
+
+		if (prefix_valid) {
+			//nothing past the prefix changed, but trailing children may be gone
+			_clear_fold_cache(fold_idx);
+			if (fold_idx > 0) {
+				n = memnew(CSGBrush);
+				n->copy_from(*fold_cache[fold_idx - 1].accum, Transform());
+			} else {
+				n = _build_brush();
+			}
 		}
 
 		if (n) {
@@ -212,7 +278,11 @@ CSGBrush *CSGShape::_get_brush() {
 
 		brush = n;
 
+		static uint64_t brush_version_count = 0;
+		brush_version = ++brush_version_count; //globally unique, so stale cache entries never match
+
 		dirty = false;
+		self_dirty = false;
 	}
 
 	return brush;
@@ -527,21 +597,21 @@ void CSGShape::_notification(int p_what) {
 	if (p_what == NOTIFICATION_LOCAL_TRANSFORM_CHANGED) {
 
 		if (parent) {
-			parent->_make_dirty();
+			parent->_make_dirty(true); //the fold cache catches which child moved
 		}
 	}
 
 	if (p_what == NOTIFICATION_VISIBILITY_CHANGED) {
 
 		if (parent) {
-			parent->_make_dirty();
+			parent->_make_dirty(true);
 		}
 	}
 
 	if (p_what == NOTIFICATION_EXIT_TREE) {
 
 		if (parent)
-			parent->_make_dirty();
+			parent->_make_dirty(true);
 		parent = NULL;
 
 		if (use_collision && is_root_shape() && root_collision_instance.is_valid()) {
@@ -645,6 +715,8 @@ CSGShape::CSGShape() {
 	parent = NULL;
 	brush = NULL;
 	dirty = false;
+	self_dirty = false;
+	brush_version = 0;
 	snap = 0.001;
 	use_collision = false;
 	collision_layer = 1;
@@ -658,6 +730,7 @@ CSGShape::~CSGShape() {
 		memdelete(brush);
 		brush = NULL;
 	}
+	_clear_fold_cache(0);
 }
 //////////////////////////////////
 
@@ -58,8 +58,23 @@ private:
 	AABB node_aabb;
 
 	bool dirty;
+	bool self_dirty; //this node's own brush changed, not just a child's
 	float snap;
 
+	uint64_t brush_version; //bumped every time the cached brush is rebuilt
+
+	struct FoldStep {
+		CSGShape *child;
+		uint64_t version;
+		Transform xform;
+		Operation operation;
+		CSGBrush *accum; //combined brush after folding this child in
+	};
+
+	Vector<FoldStep> fold_cache; //accumulated result of folding each child in, in child order
+
+	void _clear_fold_cache(int p_from);
+
 	bool use_collision;
 	uint32_t collision_layer;
 	uint32_t collision_mask;
@@ -107,7 +122,7 @@ private:
 protected:
 	void _notification(int p_what);
 	virtual CSGBrush *_build_brush() = 0;
-	void _make_dirty();
+	void _make_dirty(bool p_from_child = false);
 
 	static void _bind_methods();
 
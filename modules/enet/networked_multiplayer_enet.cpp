@@ -201,12 +201,172 @@ Error NetworkedMultiplayerENet::create_client(const String &p_address, int p_por
 	return OK;
 }
 
+void NetworkedMultiplayerENet::_queue_packet_data(ENetPeer *p_peer, int p_channel, uint32_t p_flags, const uint8_t *p_data, int p_data_len) {
+
+	// Soft cap so coalescing small packets doesn't push datagrams into fragmentation
+	const int soft_limit = 1200;
+
+	p_flags &= ENET_PACKET_FLAG_RELIABLE | ENET_PACKET_FLAG_UNSEQUENCED;
+
+	OutgoingBuffer *buffer = NULL;
+	for (List<OutgoingBuffer>::Element *E = outgoing_buffers.front(); E; E = E->next()) {
+		if (E->get().peer == p_peer && E->get().channel == p_channel && E->get().flags == p_flags) {
+			buffer = &E->get();
+			break;
+		}
+	}
+
+	if (buffer && buffer->packets > 0 && buffer->data.size() + 4 + p_data_len > soft_limit) {
+		// Ship what was coalesced so far, start a fresh aggregate
+		ENetPacket *packet = enet_packet_create(buffer->data.ptr(), buffer->data.size(), buffer->flags);
+		enet_peer_send(buffer->peer, buffer->channel, packet);
+		buffer->data.clear();
+		buffer->packets = 0;
+	}
+
+	if (!buffer) {
+		OutgoingBuffer nb;
+		nb.peer = p_peer;
+		nb.channel = p_channel;
+		nb.flags = p_flags;
+		nb.packets = 0;
+		outgoing_buffers.push_back(nb);
+		buffer = &outgoing_buffers.back()->get();
+	}
+
+	int ofs = buffer->data.size();
+	buffer->data.resize(ofs + 4 + p_data_len);
+	encode_uint32(p_data_len, &buffer->data.write[ofs]);
+	copymem(&buffer->data.write[ofs + 4], p_data, p_data_len);
+	buffer->packets++;
+}
+
+void NetworkedMultiplayerENet::_queue_packet(ENetPeer *p_peer, int p_channel, ENetPacket *p_packet) {
+
+	if (!packet_aggregation || p_channel == SYSCH_CONFIG) {
+		enet_peer_send(p_peer, p_channel, p_packet);
+		return;
+	}
+
+	_queue_packet_data(p_peer, p_channel, p_packet->flags, p_packet->data, p_packet->dataLength);
+	enet_packet_destroy(p_packet);
+}
+
+void NetworkedMultiplayerENet::_flush_outgoing_buffers() {
+
+	if (outgoing_buffers.empty())
+		return;
+
+	for (List<OutgoingBuffer>::Element *E = outgoing_buffers.front(); E; E = E->next()) {
+
+		OutgoingBuffer &buffer = E->get();
+		if (buffer.packets == 0)
+			continue;
+
+		ENetPacket *packet = enet_packet_create(buffer.data.ptr(), buffer.data.size(), buffer.flags);
+		enet_peer_send(buffer.peer, buffer.channel, packet);
+	}
+
+	outgoing_buffers.clear();
+	enet_host_flush(host);
+}
+
+void NetworkedMultiplayerENet::_process_data_packet(ENetPacket *p_packet, ENetPeer *p_peer, int p_channel) {
+
+	Packet packet;
+	packet.packet = p_packet;
+
+	uint32_t *id = (uint32_t *)p_peer->data;
+
+	if (p_packet->dataLength < 8) {
+		enet_packet_destroy(p_packet);
+		ERR_FAIL();
+	}
+
+	uint32_t source = decode_uint32(&p_packet->data[0]);
+	int target = decode_uint32(&p_packet->data[4]);
+
+	packet.from = source;
+	packet.channel = p_channel;
+
+	if (server) {
+
+		if (source != *id) {
+			// Someone is cheating and trying to fake the source!
+			enet_packet_destroy(p_packet);
+			ERR_FAIL();
+		}
+
+		packet.from = *id;
+
+		if (target == 1) {
+			// To myself and only myself
+			incoming_packets.push_back(packet);
+		} else if (!server_relay) {
+			// No other destination is allowed when server is not relaying
+			enet_packet_destroy(p_packet);
+			return;
+		} else if (target == 0) {
+			// Re-send to everyone but sender :|
+
+			incoming_packets.push_back(packet);
+			// And make copies for sending
+			for (Map<int, ENetPeer *>::Element *E = peer_map.front(); E; E = E->next()) {
+
+				if (uint32_t(E->key()) == source) // Do not resend to self
+					continue;
+
+				ENetPacket *packet2 = enet_packet_create(packet.packet->data, packet.packet->dataLength, packet.packet->flags);
+
+				_queue_packet(E->get(), p_channel, packet2);
+			}
+
+		} else if (target < 0) {
+			// To all but one
+
+			// And make copies for sending
+			for (Map<int, ENetPeer *>::Element *E = peer_map.front(); E; E = E->next()) {
+
+				if (uint32_t(E->key()) == source || E->key() == -target) // Do not resend to self, also do not send to excluded
+					continue;
+
+				ENetPacket *packet2 = enet_packet_create(packet.packet->data, packet.packet->dataLength, packet.packet->flags);
+
+				_queue_packet(E->get(), p_channel, packet2);
+			}
+
+			if (-target != 1) {
+				// Server is not excluded
+				incoming_packets.push_back(packet);
+			} else {
+				// Server is excluded, erase packet
+				enet_packet_destroy(packet.packet);
+			}
+
+		} else {
+			// To someone else, specifically
+			if (!peer_map.has(target)) {
+				enet_packet_destroy(p_packet);
+				ERR_FAIL();
+			}
+			_queue_packet(peer_map[target], p_channel, packet.packet);
+		}
+	} else {
+
+		incoming_packets.push_back(packet);
+	}
+
+	// Queued packets are destroyed on pop
+}
+
 void NetworkedMultiplayerENet::poll() {
 
 	ERR_FAIL_COND(!active);
 
 	_pop_current_packet();
 
+	_flush_outgoing_buffers(); // send what accumulated since last tick, coalesced
+
 	ENetEvent event;
 	/* Keep servicing until there are no available events left in queue. */
 	while (true) {
@@ -349,79 +509,32 @@ void NetworkedMultiplayerENet::poll() {
 					enet_packet_destroy(event.packet);
 				} else if (event.channelID < channel_count) {
 
-					Packet packet;
-					packet.packet = event.packet;
-
-					uint32_t *id = (uint32_t *)event.peer->data;
-
-					ERR_CONTINUE(event.packet->dataLength < 8);
-
-					uint32_t source = decode_uint32(&event.packet->data[0]);
-					int target = decode_uint32(&event.packet->data[4]);
-
-					packet.from = source;
-					packet.channel = event.channelID;
-
-					if (server) {
-						// Someone is cheating and trying to fake the source!
-						ERR_CONTINUE(source != *id);
-
-						packet.from = *id;
-
-						if (target == 1) {
-							// To myself and only myself
-							incoming_packets.push_back(packet);
-						} else if (!server_relay) {
-							// No other destination is allowed when server is not relaying
-							continue;
-						} else if (target == 0) {
-							// Re-send to everyone but sender :|
+					if (packet_aggregation) {
 
-							incoming_packets.push_back(packet);
-							// And make copies for sending
-							for (Map<int, ENetPeer *>::Element *E = peer_map.front(); E; E = E->next()) {
-
-								if (uint32_t(E->key()) == source) // Do not resend to self
-									continue;
-
-								ENetPacket *packet2 = enet_packet_create(packet.packet->data, packet.packet->dataLength, packet.packet->flags);
-
-								enet_peer_send(E->get(), event.channelID, packet2);
+						// Aggregated frame: uint32 length + packet, repeated
+						ENetPacket *ep = event.packet;
+						size_t ofs = 0;
+						bool valid = true;
+						while (ofs < ep->dataLength) {
+							if (ofs + 4 > ep->dataLength) {
+								valid = false;
+								break;
 							}
-
-						} else if (target < 0) {
-							// To all but one
-
-							// And make copies for sending
-							for (Map<int, ENetPeer *>::Element *E = peer_map.front(); E; E = E->next()) {
-
-								if (uint32_t(E->key()) == source || E->key() == -target) // Do not resend to self, also do not send to excluded
-									continue;
-
-								ENetPacket *packet2 = enet_packet_create(packet.packet->data, packet.packet->dataLength, packet.packet->flags);
-
-								enet_peer_send(E->get(), event.channelID, packet2);
-							}
-
-							if (-target != 1) {
-								// Server is not excluded
-								incoming_packets.push_back(packet);
-							} else {
-								// Server is excluded, erase packet
-								enet_packet_destroy(packet.packet);
+							uint32_t len = decode_uint32(&ep->data[ofs]);
+							ofs += 4;
+							if (len < 8 || ofs + len > ep->dataLength) {
+								valid = false;
+								break;
 							}
-
-						} else {
-							// To someone else, specifically
-							ERR_CONTINUE(!peer_map.has(target));
-							enet_peer_send(peer_map[target], event.channelID, packet.packet);
+							ENetPacket *sub = enet_packet_create(&ep->data[ofs], len, ep->flags);
+							_process_data_packet(sub, event.peer, event.channelID);
+							ofs += len;
 						}
+						enet_packet_destroy(ep);
+						ERR_CONTINUE_MSG(!valid, "Malformed aggregated packet received.");
 					} else {
-
-						incoming_packets.push_back(packet);
+						_process_data_packet(event.packet, event.peer, event.channelID);
 					}
-
-					// Destroy packet later
 				} else {
 					ERR_CONTINUE(true);
 				}
@@ -446,6 +559,8 @@ void NetworkedMultiplayerENet::close_connection(uint32_t wait_usec) {
 
 	_pop_current_packet();
 
+	_flush_outgoing_buffers(); // don't drop sends that were still coalescing
+
 	bool peers_disconnected = false;
 	for (Map<int, ENetPeer *>::Element *E = peer_map.front(); E; E = E->next()) {
 		if (E->get()) {
@@ -573,7 +688,15 @@ Error NetworkedMultiplayerENet::put_packet(const uint8_t *p_buffer, int p_buffer
 	if (server) {
 
 		if (target_peer == 0) {
-			enet_host_broadcast(host, channel, packet);
+			if (packet_aggregation) {
+				// Queue a copy per peer so each aggregate stays independent
+				for (Map<int, ENetPeer *>::Element *F = peer_map.front(); F; F = F->next()) {
+					_queue_packet_data(F->get(), channel, packet_flags, packet->data, packet->dataLength);
+				}
+				enet_packet_destroy(packet);
+			} else {
+				enet_host_broadcast(host, channel, packet);
+			}
 		} else if (target_peer < 0) {
 			// Send to all but one
 			// and make copies for sending
@@ -585,22 +708,28 @@ Error NetworkedMultiplayerENet::put_packet(const uint8_t *p_buffer, int p_buffer
 				if (F->key() == exclude) // Exclude packet
 					continue;
 
-				ENetPacket *packet2 = enet_packet_create(packet->data, packet->dataLength, packet_flags);
+				if (packet_aggregation) {
+					_queue_packet_data(F->get(), channel, packet_flags, packet->data, packet->dataLength);
+				} else {
+					ENetPacket *packet2 = enet_packet_create(packet->data, packet->dataLength, packet_flags);
 
-				enet_peer_send(F->get(), channel, packet2);
+					enet_peer_send(F->get(), channel, packet2);
+				}
 			}
 
 			enet_packet_destroy(packet); // Original packet no longer needed
 		} else {
-			enet_peer_send(E->get(), channel, packet);
+			_queue_packet(E->get(), channel, packet);
 		}
 	} else {
 
 		ERR_FAIL_COND_V(!peer_map.has(1), ERR_BUG);
-		enet_peer_send(peer_map[1], channel, packet); // Send to server for broadcast
+		_queue_packet(peer_map[1], channel, packet); // Send to server for broadcast
 	}
 
-	enet_host_flush(host);
+	if (!packet_aggregation) {
+		enet_host_flush(host); // When aggregating, sends go out coalesced on the next poll()
+	}
 
 	return OK;
 }
@@ -837,6 +966,16 @@ bool NetworkedMultiplayerENet::is_always_ordered() const {
 	return always_ordered;
 }
 
+void NetworkedMultiplayerENet::set_packet_aggregation_enabled(bool p_enabled) {
+	ERR_FAIL_COND_MSG(active, "Packet aggregation can't be toggled while the multiplayer instance is active. It must match on both ends of the connection.");
+
+	packet_aggregation = p_enabled;
+}
+
+bool NetworkedMultiplayerENet::is_packet_aggregation_enabled() const {
+	return packet_aggregation;
+}
+
 void NetworkedMultiplayerENet::set_server_relay_enabled(bool p_enabled) {
 	ERR_FAIL_COND(active);
 
@@ -867,6 +1006,8 @@ void NetworkedMultiplayerENet::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_channel_count"), &NetworkedMultiplayerENet::get_channel_count);
 	ClassDB::bind_method(D_METHOD("set_always_ordered", "ordered"), &NetworkedMultiplayerENet::set_always_ordered);
 	ClassDB::bind_method(D_METHOD("is_always_ordered"), &NetworkedMultiplayerENet::is_always_ordered);
+	ClassDB::bind_method(D_METHOD("set_packet_aggregation_enabled", "enabled"), &NetworkedMultiplayerENet::set_packet_aggregation_enabled);
+	ClassDB::bind_method(D_METHOD("is_packet_aggregation_enabled"), &NetworkedMultiplayerENet::is_packet_aggregation_enabled);
 	ClassDB::bind_method(D_METHOD("set_server_relay_enabled", "enabled"), &NetworkedMultiplayerENet::set_server_relay_enabled);
 	ClassDB::bind_method(D_METHOD("is_server_relay_enabled"), &NetworkedMultiplayerENet::is_server_relay_enabled);
 
@@ -874,6 +1015,7 @@ void NetworkedMultiplayerENet::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "transfer_channel"), "set_transfer_channel", "get_transfer_channel");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "channel_count"), "set_channel_count", "get_channel_count");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "always_ordered"), "set_always_ordered", "is_always_ordered");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "packet_aggregation"), "set_packet_aggregation_enabled", "is_packet_aggregation_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "server_relay"), "set_server_relay_enabled", "is_server_relay_enabled");
 
 	BIND_ENUM_CONSTANT(COMPRESS_NONE);
@@ -896,6 +1038,7 @@ NetworkedMultiplayerENet::NetworkedMultiplayerENet() {
 	channel_count = SYSCH_MAX;
 	transfer_channel = -1;
 	always_ordered = false;
+	packet_aggregation = false;
 	connection_status = CONNECTION_DISCONNECTED;
 	compression_mode = COMPRESS_NONE;
 	enet_compressor.context = this;
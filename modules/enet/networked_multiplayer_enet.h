@@ -97,6 +97,27 @@ private:
 
 	Packet current_packet;
 
+	// Tick-aligned send aggregation: outgoing packets are framed into one ENet
+	// packet per peer/channel/flags and flushed on poll(). Must be enabled on
+	// both ends, as the receiver has to undo the framing.
+	bool packet_aggregation;
+
+	struct OutgoingBuffer {
+
+		ENetPeer *peer;
+		int channel;
+		uint32_t flags;
+		int packets;
+		Vector<uint8_t> data; // uint32 length + payload, repeated
+	};
+
+	List<OutgoingBuffer> outgoing_buffers;
+
+	void _queue_packet_data(ENetPeer *p_peer, int p_channel, uint32_t p_flags, const uint8_t *p_data, int p_data_len);
+	void _queue_packet(ENetPeer *p_peer, int p_channel, ENetPacket *p_packet);
+	void _flush_outgoing_buffers();
+	void _process_data_packet(ENetPacket *p_packet, ENetPeer *p_peer, int p_channel);
+
 	uint32_t _gen_unique_id() const;
 	void _pop_current_packet();
 
@@ -159,6 +180,8 @@ public:
 	int get_channel_count() const;
 	void set_always_ordered(bool p_ordered);
 	bool is_always_ordered() const;
+	void set_packet_aggregation_enabled(bool p_enabled);
+	bool is_packet_aggregation_enabled() const;
 	void set_server_relay_enabled(bool p_enabled);
 	bool is_server_relay_enabled() const;
 
@@ -69,6 +69,29 @@ void GDAPI godot_method_bind_ptrcall(godot_method_bind *p_method_bind, godot_obj
 	mb->ptrcall(o, p_args, p_ret);
 }
 
+void GDAPI godot_method_bind_get_methods(const char *p_classname, const char **p_methodnames, const godot_int p_method_count, godot_method_bind **r_methods) {
+
+	//resolve the whole table with the class name interned once, instead of
+	//one string lookup round trip per method
+	StringName classname(p_classname);
+	for (godot_int i = 0; i < p_method_count; i++) {
+		r_methods[i] = (godot_method_bind *)ClassDB::get_method(classname, StringName(p_methodnames[i]));
+	}
+}
+
+void GDAPI godot_method_bind_ptrcall_bulk(godot_method_bind *p_method_bind, godot_object **p_instances, const godot_int p_instance_count, const void **p_args, void *p_rets, const godot_int p_ret_stride) {
+
+	MethodBind *mb = (MethodBind *)p_method_bind;
+	uint8_t *ret = (uint8_t *)p_rets;
+
+	for (godot_int i = 0; i < p_instance_count; i++) {
+		mb->ptrcall((Object *)p_instances[i], p_args, ret);
+		if (ret) {
+			ret += p_ret_stride;
+		}
+	}
+}
+
 godot_variant GDAPI godot_method_bind_call(godot_method_bind *p_method_bind, godot_object *p_instance, const godot_variant **p_args, const int p_arg_count, godot_variant_call_error *p_call_error) {
 	MethodBind *mb = (MethodBind *)p_method_bind;
 	Object *o = (Object *)p_instance;
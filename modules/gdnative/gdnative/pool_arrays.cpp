@@ -731,6 +731,40 @@ void GDAPI godot_pool_color_array_destroy(godot_pool_color_array *p_self) {
 	((PoolVector<Color> *)p_self)->~PoolVector();
 }
 
+//
+// borrowed views
+//
+
+const uint8_t GDAPI *godot_pool_byte_array_borrow(const godot_pool_byte_array *p_self) {
+	const PoolVector<uint8_t> *self = (const PoolVector<uint8_t> *)p_self;
+	return self->read().ptr();
+}
+
+const godot_int GDAPI *godot_pool_int_array_borrow(const godot_pool_int_array *p_self) {
+	const PoolVector<godot_int> *self = (const PoolVector<godot_int> *)p_self;
+	return self->read().ptr();
+}
+
+const godot_real GDAPI *godot_pool_real_array_borrow(const godot_pool_real_array *p_self) {
+	const PoolVector<godot_real> *self = (const PoolVector<godot_real> *)p_self;
+	return self->read().ptr();
+}
+
+const godot_vector2 GDAPI *godot_pool_vector2_array_borrow(const godot_pool_vector2_array *p_self) {
+	const PoolVector<Vector2> *self = (const PoolVector<Vector2> *)p_self;
+	return (const godot_vector2 *)self->read().ptr();
+}
+
+const godot_vector3 GDAPI *godot_pool_vector3_array_borrow(const godot_pool_vector3_array *p_self) {
+	const PoolVector<Vector3> *self = (const PoolVector<Vector3> *)p_self;
+	return (const godot_vector3 *)self->read().ptr();
+}
+
+const godot_color GDAPI *godot_pool_color_array_borrow(const godot_pool_color_array *p_self) {
+	const PoolVector<Color> *self = (const PoolVector<Color> *)p_self;
+	return (const godot_color *)self->read().ptr();
+}
+
 //
 // read accessor functions
 //
@@ -222,6 +222,11 @@ typedef struct {
 godot_method_bind GDAPI *godot_method_bind_get_method(const char *p_classname, const char *p_methodname);
 void GDAPI godot_method_bind_ptrcall(godot_method_bind *p_method_bind, godot_object *p_instance, const void **p_args, void *p_ret);
 godot_variant GDAPI godot_method_bind_call(godot_method_bind *p_method_bind, godot_object *p_instance, const godot_variant **p_args, const int p_arg_count, godot_variant_call_error *p_call_error);
+// Resolves a whole method table in one pass; entries that don't resolve are set to NULL.
+void GDAPI godot_method_bind_get_methods(const char *p_classname, const char **p_methodnames, const godot_int p_method_count, godot_method_bind **r_methods);
+// Ptrcalls the same method on many instances with one boundary crossing. p_rets may be
+// NULL for void methods; otherwise return values are written p_ret_stride bytes apart.
+void GDAPI godot_method_bind_ptrcall_bulk(godot_method_bind *p_method_bind, godot_object **p_instances, const godot_int p_instance_count, const void **p_args, void *p_rets, const godot_int p_ret_stride);
 ////// Script API
 
 typedef struct godot_gdnative_api_version {
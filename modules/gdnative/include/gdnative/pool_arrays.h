@@ -393,6 +393,21 @@ godot_bool GDAPI godot_pool_color_array_empty(const godot_pool_color_array *p_se
 
 void GDAPI godot_pool_color_array_destroy(godot_pool_color_array *p_self);
 
+//
+// borrowed views
+//
+// Direct pointers into the pool buffer, without the refcounted access objects
+// below. The pointer stays valid only while the array is neither written to
+// (copy-on-write may move it) nor destroyed; the caller guarantees that.
+//
+
+const uint8_t GDAPI *godot_pool_byte_array_borrow(const godot_pool_byte_array *p_self);
+const godot_int GDAPI *godot_pool_int_array_borrow(const godot_pool_int_array *p_self);
+const godot_real GDAPI *godot_pool_real_array_borrow(const godot_pool_real_array *p_self);
+const godot_vector2 GDAPI *godot_pool_vector2_array_borrow(const godot_pool_vector2_array *p_self);
+const godot_vector3 GDAPI *godot_pool_vector3_array_borrow(const godot_pool_vector3_array *p_self);
+const godot_color GDAPI *godot_pool_color_array_borrow(const godot_pool_color_array *p_self);
+
 //
 // read accessor functions
 //
@@ -112,6 +112,7 @@ void GDAPI godot_nativescript_register_method(void *p_gdnative_handle, const cha
 	method.info = MethodInfo(p_function_name);
 
 	E->get().methods.insert(p_function_name, method);
+	NSL->properties_version++; //_set/_get registration changes accessor resolution
 }
 
 void GDAPI godot_nativescript_register_property(void *p_gdnative_handle, const char *p_name, const char *p_path, godot_property_attributes *p_attr, godot_property_set_func p_set_func, godot_property_get_func p_get_func) {
@@ -133,6 +134,7 @@ void GDAPI godot_nativescript_register_property(void *p_gdnative_handle, const c
 			(PropertyUsageFlags)p_attr->usage);
 
 	E->get().properties.insert(p_path, property);
+	NSL->properties_version++;
 }
 
 void GDAPI godot_nativescript_register_signal(void *p_gdnative_handle, const char *p_name, const godot_signal *p_signal) {
@@ -539,6 +539,38 @@ NativeScript::~NativeScript() {
 
 #define GET_SCRIPT_DESC() script->get_script_desc()
 
+void NativeScriptDesc::compile_accessors(uint64_t p_version) {
+
+	setter_table.clear();
+	getter_table.clear();
+
+	// Flatten the chain top-down; the first occurrence of a name wins, like
+	// the walk in NativeScriptInstance::set/get. A level that defines _set or
+	// _get may intercept names of deeper levels, so flattening stops there
+	// for that accessor kind and those names take the slow path instead.
+	bool set_open = true;
+	bool get_open = true;
+
+	for (NativeScriptDesc *d = this; d && (set_open || get_open); d = d->base_data) {
+
+		for (OrderedHashMap<StringName, Property>::Element P = d->properties.front(); P; P = P.next()) {
+			if (set_open && !setter_table.has(P.key())) {
+				setter_table.set(P.key(), P.get().setter);
+			}
+			if (get_open && !getter_table.has(P.key())) {
+				getter_table.set(P.key(), P.get().getter);
+			}
+		}
+
+		if (d->methods.has("_set"))
+			set_open = false;
+		if (d->methods.has("_get"))
+			get_open = false;
+	}
+
+	accessors_version = p_version;
+}
+
 void NativeScriptInstance::_ml_call_reversed(NativeScriptDesc *script_data, const StringName &p_method, const Variant **p_args, int p_argcount) {
 	if (script_data->base_data) {
 		_ml_call_reversed(script_data->base_data, p_method, p_args, p_argcount);
@@ -554,6 +586,20 @@ void NativeScriptInstance::_ml_call_reversed(NativeScriptDesc *script_data, cons
 bool NativeScriptInstance::set(const StringName &p_name, const Variant &p_value) {
 	NativeScriptDesc *script_data = GET_SCRIPT_DESC();
 
+	if (script_data) {
+		if (script_data->accessors_version != NSL->properties_version) {
+			script_data->compile_accessors(NSL->properties_version);
+		}
+		const godot_property_set_func *S = script_data->setter_table.getptr(p_name);
+		if (S) {
+			S->set_func((godot_object *)owner,
+					S->method_data,
+					userdata,
+					(godot_variant *)&p_value);
+			return true;
+		}
+	}
+
 	while (script_data) {
 		OrderedHashMap<StringName, NativeScriptDesc::Property>::Element P = script_data->properties.find(p_name);
 		if (P) {
@@ -589,6 +635,22 @@ bool NativeScriptInstance::set(const StringName &p_name, const Variant &p_value)
 bool NativeScriptInstance::get(const StringName &p_name, Variant &r_ret) const {
 	NativeScriptDesc *script_data = GET_SCRIPT_DESC();
 
+	if (script_data) {
+		if (script_data->accessors_version != NSL->properties_version) {
+			script_data->compile_accessors(NSL->properties_version);
+		}
+		const godot_property_get_func *G = script_data->getter_table.getptr(p_name);
+		if (G) {
+			godot_variant value;
+			value = G->get_func((godot_object *)owner,
+					G->method_data,
+					userdata);
+			r_ret = *(Variant *)&value;
+			godot_variant_destroy(&value);
+			return true;
+		}
+	}
+
 	while (script_data) {
 		OrderedHashMap<StringName, NativeScriptDesc::Property>::Element P = script_data->properties.find(p_name);
 		if (P) {
@@ -1014,6 +1076,7 @@ void NativeScriptLanguage::_unload_stuff(bool p_reload) {
 
 NativeScriptLanguage::NativeScriptLanguage() {
 	NativeScriptLanguage::singleton = this;
+	properties_version = 1;
 #ifndef NO_THREADS
 	has_objects_to_register = false;
 	mutex = Mutex::create();
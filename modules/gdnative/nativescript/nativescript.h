@@ -73,6 +73,15 @@ struct NativeScriptDesc {
 	Map<StringName, Method> methods;
 	OrderedHashMap<StringName, Property> properties;
 	Map<StringName, Signal> signals_; // QtCreator doesn't like the name signals
+
+	// Accessors flattened over the base chain, so instance set/get resolve a
+	// property with one hash lookup instead of walking every level. Rebuilt
+	// lazily whenever registrations changed (see compile_accessors()).
+	HashMap<StringName, godot_property_set_func> setter_table;
+	HashMap<StringName, godot_property_get_func> getter_table;
+	uint64_t accessors_version; // 0 = stale; compared against NativeScriptLanguage::properties_version
+
+	void compile_accessors(uint64_t p_version);
 	StringName base;
 	StringName base_native_type;
 	NativeScriptDesc *base_data;
@@ -89,6 +98,7 @@ struct NativeScriptDesc {
 			methods(),
 			properties(),
 			signals_(),
+			accessors_version(0),
 			base(),
 			base_native_type(),
 			documentation(),
@@ -278,6 +288,8 @@ public:
 	Map<String, Map<StringName, NativeScriptDesc> > library_classes;
 	Map<String, Ref<GDNative> > library_gdnatives;
 
+	uint64_t properties_version; //bumped on registration, invalidates compiled accessor tables
+
 	Map<String, Set<NativeScript *> > library_script_users;
 
 	StringName _init_call_type;
@@ -593,6 +593,9 @@ Error GDScript::reload(bool p_keep_state) {
 			return err;
 		}
 	}
+
+	GDScriptLanguage::get_singleton()->invalidate_script_caches(); //member indices may have moved
+
 #ifdef DEBUG_ENABLED
 	for (const List<GDScriptWarning>::Element *E = parser.get_warnings().front(); E; E = E->next()) {
 		const GDScriptWarning &warning = E->get();
@@ -947,6 +950,9 @@ void GDScript::_save_orphaned_subclasses() {
 }
 
 GDScript::~GDScript() {
+
+	GDScriptLanguage::get_singleton()->invalidate_script_caches(); //other scripts may hold cached pointers into this one
+
 	for (Map<StringName, GDScriptFunction *>::Element *E = member_functions.front(); E; E = E->next()) {
 		memdelete(E->get());
 	}
@@ -1468,6 +1474,99 @@ Error GDScriptLanguage::execute_file(const String &p_path) {
 	return OK;
 }
 void GDScriptLanguage::finish() {
+	_stop_sampler();
+}
+
+void GDScriptLanguage::_sampler_thread_func(void *p_userdata) {
+
+#ifdef DEBUG_ENABLED
+	GDScriptLanguage *gdsl = (GDScriptLanguage *)p_userdata;
+	while (!gdsl->sampler_exit) {
+		gdsl->_sample_call_stack();
+		OS::get_singleton()->delay_usec(gdsl->sampler_interval);
+	}
+#endif
+}
+
+void GDScriptLanguage::_sample_call_stack() {
+
+#ifdef DEBUG_ENABLED
+	if (lock) {
+		lock->lock();
+	}
+
+	//only the main thread records a call stack; frames below the position read
+	//here are fully written by the time the position is visible, and holding the
+	//language lock keeps every GDScriptFunction alive while the sample is taken
+	int pos = _debug_call_stack_pos;
+	if (_call_stack && pos > 0 && pos <= _debug_max_call_stack) {
+
+		String folded;
+		Set<GDScriptFunction *> seen; //count recursive frames only once for total time
+
+		for (int i = 0; i < pos; i++) {
+
+			GDScriptFunction *function = _call_stack[i].function;
+			if (!function) {
+				continue;
+			}
+
+			if (!seen.has(function)) {
+				seen.insert(function);
+				function->profile.total_time += sampler_interval;
+				function->profile.frame_total_time += sampler_interval;
+			}
+			if (i == pos - 1) {
+				//the leaf frame owns the sample
+				function->profile.call_count++;
+				function->profile.frame_call_count++;
+				function->profile.self_time += sampler_interval;
+				function->profile.frame_self_time += sampler_interval;
+			}
+
+			if (folded.length() > 0) {
+				folded += ";";
+			}
+			folded += String(function->profile.signature);
+		}
+
+		if (folded.length() > 0) {
+			Map<String, int>::Element *E = sampler_folded.find(folded);
+			if (E) {
+				E->get()++;
+			} else {
+				sampler_folded.insert(folded, 1);
+			}
+		}
+	}
+
+	if (lock) {
+		lock->unlock();
+	}
+#endif
+}
+
+void GDScriptLanguage::_stop_sampler() {
+
+#ifdef DEBUG_ENABLED
+	if (!sampler_thread) {
+		return;
+	}
+
+	sampler_exit = true;
+	Thread::wait_to_finish(sampler_thread);
+	memdelete(sampler_thread);
+	sampler_thread = NULL;
+
+	//dump the folded stacks, one "stack count" line per unique stack, the format
+	//standard flamegraph tooling consumes directly
+	FileAccessRef f = FileAccess::open(sampler_folded_path, FileAccess::WRITE);
+	if (f) {
+		for (Map<String, int>::Element *E = sampler_folded.front(); E; E = E->next()) {
+			f->store_line(E->key() + " " + itos(E->get()));
+		}
+	}
+#endif
 }
 
 void GDScriptLanguage::profiling_start() {
@@ -1492,6 +1591,12 @@ void GDScriptLanguage::profiling_start() {
 	}
 
 	profiling = true;
+	sampling = use_sampling;
+	if (sampling && !sampler_thread) {
+		sampler_folded.clear();
+		sampler_exit = false;
+		sampler_thread = Thread::create(_sampler_thread_func, this);
+	}
 	if (lock) {
 		lock->unlock();
 	}
@@ -1502,11 +1607,14 @@ void GDScriptLanguage::profiling_start() {
 void GDScriptLanguage::profiling_stop() {
 
 #ifdef DEBUG_ENABLED
+	_stop_sampler(); //join before taking the lock, the sampler locks per sample
+
 	if (lock) {
 		lock->lock();
 	}
 
 	profiling = false;
+	sampling = false;
 	if (lock) {
 		lock->unlock();
 	}
@@ -2163,7 +2271,15 @@ GDScriptLanguage::GDScriptLanguage() {
 	lock = Mutex::create();
 #endif
 	profiling = false;
+	sampling = false;
+	sampler_thread = NULL;
+	sampler_exit = false;
+	use_sampling = GLOBAL_DEF("debug/settings/gdscript/sampling_profiler", false);
+	sampler_interval = GLOBAL_DEF("debug/settings/gdscript/sampling_profiler_interval_usec", 1000);
+	ProjectSettings::get_singleton()->set_custom_property_info("debug/settings/gdscript/sampling_profiler_interval_usec", PropertyInfo(Variant::INT, "debug/settings/gdscript/sampling_profiler_interval_usec", PROPERTY_HINT_RANGE, "100,100000,1"));
+	sampler_folded_path = GLOBAL_DEF("debug/settings/gdscript/sampling_profiler_folded_file", "user://script_profile.folded");
 	script_frame_time = 0;
+	script_cache_version = 1; //entries start at 0, so freshly allocated caches are always stale
 
 	_debug_call_stack_pos = 0;
 	int dmcs = GLOBAL_DEF("debug/settings/gdscript/max_call_stack", 1024);
@@ -2225,6 +2341,11 @@ Ref<GDScript> GDScriptLanguage::get_orphan_subclass(const String &p_qualified_na
 
 RES ResourceFormatLoaderGDScript::load(const String &p_path, const String &p_original_path, Error *r_error) {
 
+	//scripts always compile on the loading thread: parsing resolves 'extends' and
+	//'preload()' by re-entering ResourceLoader, which does not support concurrent
+	//loads of the same path, so compiles of an inheritance chain cannot be spread
+	//over the worker pool
+
 	if (r_error)
 		*r_error = ERR_FILE_CANT_OPEN;
 
@@ -355,7 +355,20 @@ class GDScriptLanguage : public ScriptLanguage {
 
 	SelfList<GDScriptFunction>::List function_list;
 	bool profiling;
+	bool sampling; //profile by sampling the call stack instead of instrumenting every call
+	bool use_sampling;
+	int sampler_interval;
+	String sampler_folded_path;
+	Thread *sampler_thread;
+	volatile bool sampler_exit;
+	Map<String, int> sampler_folded; //folded call stack -> sample count
+
+	static void _sampler_thread_func(void *p_userdata);
+	void _sample_call_stack();
+	void _stop_sampler();
+
 	uint64_t script_frame_time;
+	uint64_t script_cache_version; //bumped when any script is reloaded or freed, stales the per-function inline caches
 
 	Map<String, ObjectID> orphan_subclasses;
 
@@ -438,6 +451,11 @@ public:
 	_FORCE_INLINE_ const Map<StringName, int> &get_global_map() const { return globals; }
 	_FORCE_INLINE_ const Map<StringName, Variant> &get_named_globals_map() const { return named_globals; }
 
+	_FORCE_INLINE_ bool is_instrumenting() const { return profiling && !sampling; }
+
+	_FORCE_INLINE_ uint64_t get_script_cache_version() const { return script_cache_version; }
+	_FORCE_INLINE_ void invalidate_script_caches() { script_cache_version++; }
+
 	_FORCE_INLINE_ static GDScriptLanguage *get_singleton() { return singleton; }
 
 	virtual String get_name() const;
@@ -31,6 +31,7 @@
 #include "gdscript_compiler.h"
 
 #include "gdscript.h"
+#include "gdscript_functions.h"
 
 bool GDScriptCompiler::_is_class_member_property(CodeGen &codegen, const StringName &p_name) {
 
@@ -90,6 +91,33 @@ bool GDScriptCompiler::_create_unary_operator(CodeGen &codegen, const GDScriptPa
 	return true;
 }
 
+static int _get_typed_operator_kernel(Variant::Operator p_op, const GDScriptParser::DataType &p_a, const GDScriptParser::DataType &p_b) {
+
+	if (!p_a.has_type || !p_b.has_type)
+		return -1;
+	if (p_a.kind != GDScriptParser::DataType::BUILTIN || p_b.kind != GDScriptParser::DataType::BUILTIN)
+		return -1;
+	if (p_a.builtin_type != p_b.builtin_type)
+		return -1;
+
+	int op_idx;
+	switch (p_op) {
+		case Variant::OP_ADD: op_idx = 0; break;
+		case Variant::OP_SUBTRACT: op_idx = 1; break;
+		case Variant::OP_MULTIPLY: op_idx = 2; break;
+		case Variant::OP_DIVIDE: op_idx = 3; break;
+		default: return -1;
+	}
+
+	switch (p_a.builtin_type) {
+		case Variant::INT: return GDScriptFunction::TYPED_OP_ADD_INT + op_idx;
+		case Variant::REAL: return GDScriptFunction::TYPED_OP_ADD_REAL + op_idx;
+		case Variant::VECTOR2: return GDScriptFunction::TYPED_OP_ADD_VEC2 + op_idx;
+		case Variant::VECTOR3: return GDScriptFunction::TYPED_OP_ADD_VEC3 + op_idx;
+		default: return -1;
+	}
+}
+
 bool GDScriptCompiler::_create_binary_operator(CodeGen &codegen, const GDScriptParser::OperatorNode *on, Variant::Operator op, int p_stack_level, bool p_initializer, int p_index_addr) {
 
 	ERR_FAIL_COND_V(on->arguments.size() != 2, false);
@@ -104,8 +132,17 @@ bool GDScriptCompiler::_create_binary_operator(CodeGen &codegen, const GDScriptP
 	if (src_address_b < 0)
 		return false;
 
-	codegen.opcodes.push_back(GDScriptFunction::OPCODE_OPERATOR); // perform operator
-	codegen.opcodes.push_back(op); //which operator
+	int kernel = _get_typed_operator_kernel(op, on->arguments[0]->get_datatype(), on->arguments[1]->get_datatype());
+
+	if (kernel >= 0) {
+		//both operand types statically known, use the specialized opcode (same width,
+		//the interpreter falls back to Variant::evaluate if the runtime types differ)
+		codegen.opcodes.push_back(GDScriptFunction::OPCODE_OPERATOR_TYPED); // perform typed operator
+		codegen.opcodes.push_back(kernel); //which kernel
+	} else {
+		codegen.opcodes.push_back(GDScriptFunction::OPCODE_OPERATOR); // perform operator
+		codegen.opcodes.push_back(op); //which operator
+	}
 	codegen.opcodes.push_back(src_address_a); // argument 1
 	codegen.opcodes.push_back(src_address_b); // argument 2 (unary only takes one parameter)
 	return true;
@@ -726,6 +763,29 @@ int GDScriptCompiler::_parse_expression(CodeGen &codegen, const GDScriptParser::
 							}
 						}
 
+						GDScriptDataType base_type = _gdtype_from_datatype(on->arguments[0]->get_datatype());
+						if (base_type.has_type && (base_type.kind == GDScriptDataType::GDSCRIPT || base_type.kind == GDScriptDataType::SCRIPT)) {
+
+							GDScript *base_script = Object::cast_to<GDScript>(base_type.script_type.ptr());
+							if (base_script) {
+
+								StringName member_name = static_cast<GDScriptParser::IdentifierNode *>(on->arguments[1])->name;
+								const Map<StringName, GDScript::MemberInfo>::Element *BMI = base_script->member_indices.find(member_name);
+								if (BMI && BMI->get().getter == "") {
+									//statically typed script base, the member slot is known at compile time
+									Variant script = base_type.script_type;
+									int script_addr = codegen.get_constant_pos(script) | (GDScriptFunction::ADDR_TYPE_LOCAL_CONSTANT << GDScriptFunction::ADDR_BITS);
+
+									codegen.opcodes.push_back(GDScriptFunction::OPCODE_GET_SCRIPT_MEMBER);
+									codegen.opcodes.push_back(from);
+									codegen.opcodes.push_back(script_addr);
+									codegen.opcodes.push_back(BMI->get().index);
+									codegen.opcodes.push_back(codegen.get_name_map_pos(member_name)); //fallback when the runtime type mismatches
+									break;
+								}
+							}
+						}
+
 						index = codegen.get_name_map_pos(static_cast<GDScriptParser::IdentifierNode *>(on->arguments[1])->name);
 
 					} else {
@@ -1361,6 +1421,19 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Blo
 
 					case GDScriptParser::ControlFlowNode::CF_IF: {
 
+						if (cf->arguments[0]->type == GDScriptParser::Node::TYPE_CONSTANT) {
+							//condition folded to a constant, only the branch that can run is compiled
+							const GDScriptParser::ConstantNode *cn = static_cast<const GDScriptParser::ConstantNode *>(cf->arguments[0]);
+							const GDScriptParser::BlockNode *branch = cn->value.booleanize() ? cf->body : cf->body_else;
+
+							if (branch) {
+								Error err = _parse_block(codegen, branch, p_stack_level, p_break_addr, p_continue_addr);
+								if (err)
+									return err;
+							}
+							break;
+						}
+
 						int ret2 = _parse_expression(codegen, cf->arguments[0], p_stack_level, false);
 						if (ret2 < 0)
 							return ERR_PARSE_ERROR;
@@ -1404,34 +1477,110 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Blo
 						codegen.push_stack_identifiers();
 						codegen.add_stack_identifier(static_cast<const GDScriptParser::IdentifierNode *>(cf->arguments[0])->name, iter_stack_pos);
 
-						int ret2 = _parse_expression(codegen, cf->arguments[1], slevel, false);
-						if (ret2 < 0)
-							return ERR_COMPILATION_FAILED;
+						//detect 'for i in range(...)' so no array is ever materialized
+						const GDScriptParser::OperatorNode *range_call = NULL;
+						if (cf->arguments[1]->type == GDScriptParser::Node::TYPE_OPERATOR) {
+							const GDScriptParser::OperatorNode *con = static_cast<const GDScriptParser::OperatorNode *>(cf->arguments[1]);
+							if (con->op == GDScriptParser::OperatorNode::OP_CALL && con->arguments.size() >= 2 && con->arguments.size() <= 4 && con->arguments[0]->type == GDScriptParser::Node::TYPE_BUILT_IN_FUNCTION && static_cast<const GDScriptParser::BuiltInFunctionNode *>(con->arguments[0])->function == GDScriptFunctions::GEN_RANGE) {
+								range_call = con;
+							}
+						}
 
-						//assign container
-						codegen.opcodes.push_back(GDScriptFunction::OPCODE_ASSIGN);
-						codegen.opcodes.push_back(container_pos);
-						codegen.opcodes.push_back(ret2);
+						int step_pos = 0;
+						if (range_call) {
+							step_pos = (slevel++) | (GDScriptFunction::ADDR_TYPE_STACK << GDScriptFunction::ADDR_BITS);
+						}
+						codegen.alloc_stack(slevel);
+
+						int break_pos;
+						int continue_pos;
+
+						if (range_call) {
+
+							//counter/container/step slots hold from/to/step; missing
+							//from and step become the constants 0 and 1
+							int target_pos[3] = { counter_pos, container_pos, step_pos };
+							bool assigned[3] = { false, false, false };
+
+							int range_argc = range_call->arguments.size() - 1;
+							for (int i = 0; i < range_argc; i++) {
+
+								int ret2 = _parse_expression(codegen, range_call->arguments[i + 1], slevel, false);
+								if (ret2 < 0)
+									return ERR_COMPILATION_FAILED;
+								//assign into the destination slot right away; every argument is
+								//parsed at the same stack level, so a later one may reuse the
+								//temporary this result lives in
+								int target = range_argc == 1 ? 1 : i;
+								codegen.opcodes.push_back(GDScriptFunction::OPCODE_ASSIGN);
+								codegen.opcodes.push_back(target_pos[target]);
+								codegen.opcodes.push_back(ret2);
+								assigned[target] = true;
+							}
+
+							if (!assigned[0]) {
+								codegen.opcodes.push_back(GDScriptFunction::OPCODE_ASSIGN);
+								codegen.opcodes.push_back(counter_pos);
+								codegen.opcodes.push_back(codegen.get_constant_pos(0) | (GDScriptFunction::ADDR_TYPE_LOCAL_CONSTANT << GDScriptFunction::ADDR_BITS));
+							}
+							if (!assigned[2]) {
+								codegen.opcodes.push_back(GDScriptFunction::OPCODE_ASSIGN);
+								codegen.opcodes.push_back(step_pos);
+								codegen.opcodes.push_back(codegen.get_constant_pos(1) | (GDScriptFunction::ADDR_TYPE_LOCAL_CONSTANT << GDScriptFunction::ADDR_BITS));
+							}
+
+							//begin loop
+							codegen.opcodes.push_back(GDScriptFunction::OPCODE_ITERATE_BEGIN_RANGE);
+							codegen.opcodes.push_back(counter_pos);
+							codegen.opcodes.push_back(container_pos);
+							codegen.opcodes.push_back(step_pos);
+							codegen.opcodes.push_back(codegen.opcodes.size() + 4);
+							codegen.opcodes.push_back(iterator_pos);
+							codegen.opcodes.push_back(GDScriptFunction::OPCODE_JUMP); //skip code for next
+							codegen.opcodes.push_back(codegen.opcodes.size() + 9);
+							//break loop
+							break_pos = codegen.opcodes.size();
+							codegen.opcodes.push_back(GDScriptFunction::OPCODE_JUMP); //skip code for next
+							codegen.opcodes.push_back(0); //skip code for next
+							//next loop
+							continue_pos = codegen.opcodes.size();
+							codegen.opcodes.push_back(GDScriptFunction::OPCODE_ITERATE_RANGE);
+							codegen.opcodes.push_back(counter_pos);
+							codegen.opcodes.push_back(container_pos);
+							codegen.opcodes.push_back(step_pos);
+							codegen.opcodes.push_back(break_pos);
+							codegen.opcodes.push_back(iterator_pos);
+						} else {
+
+							int ret2 = _parse_expression(codegen, cf->arguments[1], slevel, false);
+							if (ret2 < 0)
+								return ERR_COMPILATION_FAILED;
+
+							//assign container
+							codegen.opcodes.push_back(GDScriptFunction::OPCODE_ASSIGN);
+							codegen.opcodes.push_back(container_pos);
+							codegen.opcodes.push_back(ret2);
 
-						//begin loop
-						codegen.opcodes.push_back(GDScriptFunction::OPCODE_ITERATE_BEGIN);
-						codegen.opcodes.push_back(counter_pos);
-						codegen.opcodes.push_back(container_pos);
-						codegen.opcodes.push_back(codegen.opcodes.size() + 4);
-						codegen.opcodes.push_back(iterator_pos);
-						codegen.opcodes.push_back(GDScriptFunction::OPCODE_JUMP); //skip code for next
-						codegen.opcodes.push_back(codegen.opcodes.size() + 8);
-						//break loop
-						int break_pos = codegen.opcodes.size();
-						codegen.opcodes.push_back(GDScriptFunction::OPCODE_JUMP); //skip code for next
-						codegen.opcodes.push_back(0); //skip code for next
-						//next loop
-						int continue_pos = codegen.opcodes.size();
-						codegen.opcodes.push_back(GDScriptFunction::OPCODE_ITERATE);
-						codegen.opcodes.push_back(counter_pos);
-						codegen.opcodes.push_back(container_pos);
-						codegen.opcodes.push_back(break_pos);
-						codegen.opcodes.push_back(iterator_pos);
+							//begin loop
+							codegen.opcodes.push_back(GDScriptFunction::OPCODE_ITERATE_BEGIN);
+							codegen.opcodes.push_back(counter_pos);
+							codegen.opcodes.push_back(container_pos);
+							codegen.opcodes.push_back(codegen.opcodes.size() + 4);
+							codegen.opcodes.push_back(iterator_pos);
+							codegen.opcodes.push_back(GDScriptFunction::OPCODE_JUMP); //skip code for next
+							codegen.opcodes.push_back(codegen.opcodes.size() + 8);
+							//break loop
+							break_pos = codegen.opcodes.size();
+							codegen.opcodes.push_back(GDScriptFunction::OPCODE_JUMP); //skip code for next
+							codegen.opcodes.push_back(0); //skip code for next
+							//next loop
+							continue_pos = codegen.opcodes.size();
+							codegen.opcodes.push_back(GDScriptFunction::OPCODE_ITERATE);
+							codegen.opcodes.push_back(counter_pos);
+							codegen.opcodes.push_back(container_pos);
+							codegen.opcodes.push_back(break_pos);
+							codegen.opcodes.push_back(iterator_pos);
+						}
 
 						Error err = _parse_block(codegen, cf->body, slevel, break_pos, continue_pos);
 						if (err)
@@ -1446,6 +1595,13 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Blo
 					} break;
 					case GDScriptParser::ControlFlowNode::CF_WHILE: {
 
+						bool constant_condition = cf->arguments[0]->type == GDScriptParser::Node::TYPE_CONSTANT;
+
+						if (constant_condition && !static_cast<const GDScriptParser::ConstantNode *>(cf->arguments[0])->value.booleanize()) {
+							//condition folded to a constant false, loop never runs
+							break;
+						}
+
 						codegen.opcodes.push_back(GDScriptFunction::OPCODE_JUMP);
 						codegen.opcodes.push_back(codegen.opcodes.size() + 3);
 						int break_addr = codegen.opcodes.size();
@@ -1453,12 +1609,15 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Blo
 						codegen.opcodes.push_back(0);
 						int continue_addr = codegen.opcodes.size();
 
-						int ret2 = _parse_expression(codegen, cf->arguments[0], p_stack_level, false);
-						if (ret2 < 0)
-							return ERR_PARSE_ERROR;
-						codegen.opcodes.push_back(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-						codegen.opcodes.push_back(ret2);
-						codegen.opcodes.push_back(break_addr);
+						if (!constant_condition) {
+							//constant true conditions skip the per-iteration test
+							int ret2 = _parse_expression(codegen, cf->arguments[0], p_stack_level, false);
+							if (ret2 < 0)
+								return ERR_PARSE_ERROR;
+							codegen.opcodes.push_back(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+							codegen.opcodes.push_back(ret2);
+							codegen.opcodes.push_back(break_addr);
+						}
 						Error err = _parse_block(codegen, cf->body, p_stack_level, break_addr, continue_addr);
 						if (err)
 							return err;
@@ -1721,6 +1880,11 @@ Error GDScriptCompiler::_parse_function(GDScript *p_script, const GDScriptParser
 		}
 		gdfunc->_global_names_count = gdfunc->global_names.size();
 
+		//inline caches for name based lookups, one slot per global name
+		gdfunc->_method_call_cache = memnew_arr(GDScriptFunction::MethodCallCache, gdfunc->_global_names_count);
+		gdfunc->_member_get_cache = memnew_arr(GDScriptFunction::MemberAccessCache, gdfunc->_global_names_count);
+		gdfunc->_member_set_cache = memnew_arr(GDScriptFunction::MemberAccessCache, gdfunc->_global_names_count);
+
 	} else {
 		gdfunc->_global_names_ptr = NULL;
 		gdfunc->_global_names_count = 0;
@@ -189,10 +189,15 @@ String GDScriptFunction::_get_call_error(const Variant::CallError &p_err, const
 	return err_text;
 }
 
+//Threaded (computed goto) dispatch: every opcode ends in its own indirect
+//jump through the label table, so the branch predictor sees one predictable
+//target per opcode pair instead of a single mispredicted switch branch.
+//__GNUC__ is also defined by Clang; other compilers take the switch below.
 #if defined(__GNUC__)
 #define OPCODES_TABLE                         \
 	static const void *switch_table_ops[] = { \
 		&&OPCODE_OPERATOR,                    \
+		&&OPCODE_OPERATOR_TYPED,              \
 		&&OPCODE_EXTENDS_TEST,                \
 		&&OPCODE_IS_BUILTIN,                  \
 		&&OPCODE_SET,                         \
@@ -201,6 +206,7 @@ String GDScriptFunction::_get_call_error(const Variant::CallError &p_err, const
 		&&OPCODE_GET_NAMED,                   \
 		&&OPCODE_SET_MEMBER,                  \
 		&&OPCODE_GET_MEMBER,                  \
+		&&OPCODE_GET_SCRIPT_MEMBER,           \
 		&&OPCODE_ASSIGN,                      \
 		&&OPCODE_ASSIGN_TRUE,                 \
 		&&OPCODE_ASSIGN_FALSE,                \
@@ -228,6 +234,8 @@ String GDScriptFunction::_get_call_error(const Variant::CallError &p_err, const
 		&&OPCODE_RETURN,                      \
 		&&OPCODE_ITERATE_BEGIN,               \
 		&&OPCODE_ITERATE,                     \
+		&&OPCODE_ITERATE_BEGIN_RANGE,         \
+		&&OPCODE_ITERATE_RANGE,               \
 		&&OPCODE_ASSERT,                      \
 		&&OPCODE_BREAKPOINT,                  \
 		&&OPCODE_LINE,                        \
@@ -257,10 +265,62 @@ String GDScriptFunction::_get_call_error(const Variant::CallError &p_err, const
 #define OPCODE_OUT break
 #endif
 
+//inline cache entries are written once per version, fields first and the version
+//last, so readers that check the version before the fields never see a slot being
+//rewritten; the lock only orders concurrent fills of the same slot
+
+void GDScriptFunction::_fill_method_cache(MethodCallCache &p_cache, const StringName &p_class, MethodBind *p_method, uint64_t p_version) {
+
+	if (GDScriptLanguage::get_singleton()->lock) {
+		GDScriptLanguage::get_singleton()->lock->lock();
+	}
+	if (p_cache.version != p_version) {
+		p_cache.base_class = p_class;
+		p_cache.method = p_method;
+		p_cache.version = p_version;
+	}
+	if (GDScriptLanguage::get_singleton()->lock) {
+		GDScriptLanguage::get_singleton()->lock->unlock();
+	}
+}
+
+void GDScriptFunction::_fill_member_cache(MemberAccessCache &p_cache, GDScript *p_script, int p_member_index, uint64_t p_version) {
+
+	if (GDScriptLanguage::get_singleton()->lock) {
+		GDScriptLanguage::get_singleton()->lock->lock();
+	}
+	if (p_cache.version != p_version) {
+		p_cache.script = p_script;
+		p_cache.member_index = p_member_index;
+		p_cache.version = p_version;
+	}
+	if (GDScriptLanguage::get_singleton()->lock) {
+		GDScriptLanguage::get_singleton()->lock->unlock();
+	}
+}
+
+//operand type and generic fallback operator for each OPCODE_OPERATOR_TYPED kernel,
+//indexed by GDScriptFunction::TypedOperator (must match its order)
+static const Variant::Type typed_operator_type[GDScriptFunction::TYPED_OP_MAX] = {
+	Variant::INT, Variant::INT, Variant::INT, Variant::INT,
+	Variant::REAL, Variant::REAL, Variant::REAL, Variant::REAL,
+	Variant::VECTOR2, Variant::VECTOR2, Variant::VECTOR2, Variant::VECTOR2,
+	Variant::VECTOR3, Variant::VECTOR3, Variant::VECTOR3, Variant::VECTOR3
+};
+
+static const Variant::Operator typed_operator_op[GDScriptFunction::TYPED_OP_MAX] = {
+	Variant::OP_ADD, Variant::OP_SUBTRACT, Variant::OP_MULTIPLY, Variant::OP_DIVIDE,
+	Variant::OP_ADD, Variant::OP_SUBTRACT, Variant::OP_MULTIPLY, Variant::OP_DIVIDE,
+	Variant::OP_ADD, Variant::OP_SUBTRACT, Variant::OP_MULTIPLY, Variant::OP_DIVIDE,
+	Variant::OP_ADD, Variant::OP_SUBTRACT, Variant::OP_MULTIPLY, Variant::OP_DIVIDE
+};
+
 Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Variant::CallError &r_err, CallState *p_state) {
 
 	OPCODES_TABLE;
 
+	MEM_DOMAIN_SCOPE(DOMAIN_SCRIPT); //attribute script-driven allocations
+
 	if (!_code_ptr) {
 
 		return Variant();
@@ -423,7 +483,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 	uint64_t function_start_time = 0;
 	uint64_t function_call_time = 0;
 
-	if (GDScriptLanguage::get_singleton()->profiling) {
+	if (GDScriptLanguage::get_singleton()->is_instrumenting()) {
 		function_start_time = OS::get_singleton()->get_ticks_usec();
 		function_call_time = 0;
 		profile.call_count++;
@@ -479,6 +539,82 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_OPERATOR_TYPED) {
+
+				CHECK_SPACE(5);
+
+				int kernel = _code_ptr[ip + 1];
+				GD_ERR_BREAK(kernel < 0 || kernel >= TYPED_OP_MAX);
+
+				GET_VARIANT_PTR(a, 2);
+				GET_VARIANT_PTR(b, 3);
+				GET_VARIANT_PTR(dst, 4);
+
+				bool done = false;
+
+				//the compiler only emits this when both operands were declared or inferred
+				//with the kernel's type, but the check is still needed as inference may be
+				//escaped at runtime (weakly typed calls, Variant reuse)
+				if (a->get_type() == typed_operator_type[kernel] && b->get_type() == typed_operator_type[kernel]) {
+
+					done = true;
+					switch (kernel) {
+						case TYPED_OP_ADD_INT: *dst = a->operator int64_t() + b->operator int64_t(); break;
+						case TYPED_OP_SUB_INT: *dst = a->operator int64_t() - b->operator int64_t(); break;
+						case TYPED_OP_MUL_INT: *dst = a->operator int64_t() * b->operator int64_t(); break;
+						case TYPED_OP_DIV_INT: {
+							int64_t den = *b;
+							if (den == 0) {
+								done = false; //generic path reports the division by zero
+							} else {
+								*dst = a->operator int64_t() / den;
+							}
+						} break;
+						case TYPED_OP_ADD_REAL: *dst = a->operator double() + b->operator double(); break;
+						case TYPED_OP_SUB_REAL: *dst = a->operator double() - b->operator double(); break;
+						case TYPED_OP_MUL_REAL: *dst = a->operator double() * b->operator double(); break;
+						case TYPED_OP_DIV_REAL: *dst = a->operator double() / b->operator double(); break;
+						case TYPED_OP_ADD_VEC2: *dst = a->operator Vector2() + b->operator Vector2(); break;
+						case TYPED_OP_SUB_VEC2: *dst = a->operator Vector2() - b->operator Vector2(); break;
+						case TYPED_OP_MUL_VEC2: *dst = a->operator Vector2() * b->operator Vector2(); break;
+						case TYPED_OP_DIV_VEC2: *dst = a->operator Vector2() / b->operator Vector2(); break;
+						case TYPED_OP_ADD_VEC3: *dst = a->operator Vector3() + b->operator Vector3(); break;
+						case TYPED_OP_SUB_VEC3: *dst = a->operator Vector3() - b->operator Vector3(); break;
+						case TYPED_OP_MUL_VEC3: *dst = a->operator Vector3() * b->operator Vector3(); break;
+						case TYPED_OP_DIV_VEC3: *dst = a->operator Vector3() / b->operator Vector3(); break;
+					}
+				}
+
+				if (!done) {
+
+					Variant::Operator op = typed_operator_op[kernel];
+					bool valid;
+#ifdef DEBUG_ENABLED
+
+					Variant ret;
+					Variant::evaluate(op, *a, *b, ret, valid);
+
+					if (!valid) {
+
+						if (ret.get_type() == Variant::STRING) {
+							//return a string when invalid with the error
+							err_text = ret;
+							err_text += " in operator '" + Variant::get_operator_name(op) + "'.";
+						} else {
+							err_text = "Invalid operands '" + Variant::get_type_name(a->get_type()) + "' and '" + Variant::get_type_name(b->get_type()) + "' in operator '" + Variant::get_operator_name(op) + "'.";
+						}
+						OPCODE_BREAK;
+					}
+					*dst = ret;
+#else
+					Variant::evaluate(op, *a, *b, *dst, valid);
+#endif
+				}
+
+				ip += 5;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_EXTENDS_TEST) {
 
 				CHECK_SPACE(4);
@@ -636,16 +772,53 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
-				dst->set_named(*index, *value, &valid);
+				bool found = false;
 
+				if (dst->get_type() == Variant::OBJECT) {
+					//per-name inline cache, writes plain (no setter, untyped) script
+					//members without the name lookup
+					Object *obj = dst->operator Object *();
 #ifdef DEBUG_ENABLED
-				if (!valid) {
-					String err_type;
-					err_text = "Invalid set index '" + String(*index) + "' (on base: '" + _get_var_type(dst) + "') with value of type '" + _get_var_type(value) + "'.";
-					OPCODE_BREAK;
+					if (obj && !ObjectDB::instance_validate(obj)) {
+						obj = NULL; //let set_named() report the error
+					}
+#endif
+					ScriptInstance *si = obj ? obj->get_script_instance() : NULL;
+					if (si && si->get_language() == GDScriptLanguage::get_singleton()) {
+
+						GDScriptInstance *gdi = static_cast<GDScriptInstance *>(si);
+						MemberAccessCache &cache = _member_set_cache[indexname];
+						uint64_t cache_version = GDScriptLanguage::get_singleton()->get_script_cache_version();
+
+						if (cache.version == cache_version) {
+							if (cache.script == gdi->script.ptr()) {
+								gdi->members.write[cache.member_index] = *value;
+								found = true;
+							}
+						} else {
+							const Map<StringName, GDScript::MemberInfo>::Element *E = gdi->script->member_indices.find(*index);
+							if (E && !E->get().setter && !E->get().data_type.has_type) {
+								_fill_member_cache(cache, gdi->script.ptr(), E->get().index, cache_version);
+								gdi->members.write[E->get().index] = *value;
+								found = true;
+							}
+						}
+					}
 				}
+
+				if (!found) {
+
+					bool valid;
+					dst->set_named(*index, *value, &valid);
+
+#ifdef DEBUG_ENABLED
+					if (!valid) {
+						String err_type;
+						err_text = "Invalid set index '" + String(*index) + "' (on base: '" + _get_var_type(dst) + "') with value of type '" + _get_var_type(value) + "'.";
+						OPCODE_BREAK;
+					}
 #endif
+				}
 				ip += 4;
 			}
 			DISPATCH_OPCODE;
@@ -662,25 +835,62 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
+				bool found = false;
+
+				if (src->get_type() == Variant::OBJECT) {
+					//per-name inline cache, reads plain (no getter) script members
+					//without the name lookup
+					Object *obj = src->operator Object *();
 #ifdef DEBUG_ENABLED
-				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, &valid);
+					if (obj && !ObjectDB::instance_validate(obj)) {
+						obj = NULL; //let get_named() report the error
+					}
+#endif
+					ScriptInstance *si = obj ? obj->get_script_instance() : NULL;
+					if (si && si->get_language() == GDScriptLanguage::get_singleton()) {
+
+						GDScriptInstance *gdi = static_cast<GDScriptInstance *>(si);
+						MemberAccessCache &cache = _member_get_cache[indexname];
+						uint64_t cache_version = GDScriptLanguage::get_singleton()->get_script_cache_version();
+
+						if (cache.version == cache_version) {
+							if (cache.script == gdi->script.ptr()) {
+								*dst = gdi->members[cache.member_index];
+								found = true;
+							}
+						} else {
+							const Map<StringName, GDScript::MemberInfo>::Element *E = gdi->script->member_indices.find(*index);
+							if (E && !E->get().getter) {
+								_fill_member_cache(cache, gdi->script.ptr(), E->get().index, cache_version);
+								*dst = gdi->members[E->get().index];
+								found = true;
+							}
+						}
+					}
+				}
+
+				if (!found) {
+
+					bool valid;
+#ifdef DEBUG_ENABLED
+					//allow better error message in cases where src and dst are the same stack position
+					Variant ret = src->get_named(*index, &valid);
 
 #else
-				*dst = src->get_named(*index, &valid);
+					*dst = src->get_named(*index, &valid);
 #endif
 #ifdef DEBUG_ENABLED
-				if (!valid) {
-					if (src->has_method(*index)) {
-						err_text = "Invalid get index '" + index->operator String() + "' (on base: '" + _get_var_type(src) + "'). Did you mean '." + index->operator String() + "()' or funcref(obj, \"" + index->operator String() + "\") ?";
-					} else {
-						err_text = "Invalid get index '" + index->operator String() + "' (on base: '" + _get_var_type(src) + "').";
+					if (!valid) {
+						if (src->has_method(*index)) {
+							err_text = "Invalid get index '" + index->operator String() + "' (on base: '" + _get_var_type(src) + "'). Did you mean '." + index->operator String() + "()' or funcref(obj, \"" + index->operator String() + "\") ?";
+						} else {
+							err_text = "Invalid get index '" + index->operator String() + "' (on base: '" + _get_var_type(src) + "').";
+						}
+						OPCODE_BREAK;
 					}
-					OPCODE_BREAK;
-				}
-				*dst = ret;
+					*dst = ret;
 #endif
+				}
 				ip += 4;
 			}
 			DISPATCH_OPCODE;
@@ -731,6 +941,64 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_GET_SCRIPT_MEMBER) {
+
+				CHECK_SPACE(6);
+
+				GET_VARIANT_PTR(src, 1);
+				GET_VARIANT_PTR(type, 2);
+				int member_index = _code_ptr[ip + 3];
+				int indexname = _code_ptr[ip + 4];
+				GET_VARIANT_PTR(dst, 5);
+
+				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
+				const StringName *index = &_global_names_ptr[indexname];
+
+				bool found = false;
+
+				if (src->get_type() == Variant::OBJECT) {
+
+					Object *obj = src->operator Object *();
+#ifdef DEBUG_ENABLED
+					if (obj && !ObjectDB::instance_validate(obj)) {
+						obj = NULL; //let get_named() report the error
+					}
+#endif
+					ScriptInstance *si = obj ? obj->get_script_instance() : NULL;
+					if (si && si->get_language() == GDScriptLanguage::get_singleton()) {
+
+						GDScriptInstance *gdi = static_cast<GDScriptInstance *>(si);
+						GDScript *base = Object::cast_to<GDScript>(type->operator Object *());
+
+						//member slots of a base script stay valid in every script extending it
+						const GDScript *s = gdi->script.ptr();
+						while (s && s != base) {
+							s = s->_base;
+						}
+						if (s && member_index >= 0 && member_index < gdi->members.size()) {
+							*dst = gdi->members[member_index];
+							found = true;
+						}
+					}
+				}
+
+				if (!found) {
+					//runtime type does not match what the compiler saw, resolve by name
+					bool valid;
+					Variant ret = src->get_named(*index, &valid);
+#ifdef DEBUG_ENABLED
+					if (!valid) {
+						err_text = "Invalid get index '" + index->operator String() + "' (on base: '" + _get_var_type(src) + "').";
+						OPCODE_BREAK;
+					}
+#endif
+					*dst = ret;
+				}
+
+				ip += 6;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_ASSIGN) {
 
 				CHECK_SPACE(3);
@@ -1073,22 +1341,132 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #ifdef DEBUG_ENABLED
 				uint64_t call_time = 0;
 
-				if (GDScriptLanguage::get_singleton()->profiling) {
+				if (GDScriptLanguage::get_singleton()->is_instrumenting()) {
 					call_time = OS::get_singleton()->get_ticks_usec();
 				}
 
 #endif
 				Variant::CallError err;
-				if (call_ret) {
+				bool called = false;
 
-					GET_VARIANT_PTR(ret, argc);
-					base->call_ptr(*methodname, (const Variant **)argptrs, argc, ret, err);
-				} else {
+				if (base->get_type() == Variant::OBJECT) {
+					//per-name inline cache, skips method resolution for native calls on
+					//scriptless objects (scripted receivers keep going through the full
+					//path so the script gets first pick)
+					Object *obj = base->operator Object *();
+#ifdef DEBUG_ENABLED
+					if (obj && !ObjectDB::instance_validate(obj)) {
+						obj = NULL; //let call_ptr() report the error
+					}
+#endif
+					if (obj && !obj->get_script_instance()) {
+
+						MethodCallCache &cache = _method_call_cache[nameg];
+						uint64_t cache_version = GDScriptLanguage::get_singleton()->get_script_cache_version();
+						MethodBind *method = NULL;
+
+						if (cache.version == cache_version) {
+							if (cache.base_class == obj->get_class_name()) {
+								method = cache.method;
+							}
+						} else {
+							method = ClassDB::get_method(obj->get_class_name(), *methodname);
+							if (method) {
+								_fill_method_cache(cache, obj->get_class_name(), method, cache_version);
+							}
+						}
+
+						if (method) {
+
+#if defined(PTRCALL_ENABLED) && defined(DEBUG_METHODS_ENABLED)
+							//when every argument already has the exact type the method expects,
+							//skip per-argument Variant validation/conversion and go through
+							//ptrcall, pointing straight into the Variants' internal storage
+							bool can_ptrcall = !method->is_vararg() && argc == method->get_argument_count() &&
+									(!method->has_return() || method->get_argument_type(-1) != Variant::OBJECT);
+
+							const void **ptrargs = NULL;
+							if (can_ptrcall && argc > 0) {
+								ptrargs = (const void **)alloca(argc * sizeof(const void *));
+							}
+
+							for (int i = 0; can_ptrcall && i < argc; i++) {
+
+								Variant::Type expected = method->get_argument_type(i);
+								if (expected == Variant::NIL) {
+									ptrargs[i] = argptrs[i]; //Variant parameter, pass as is
+								} else if (argptrs[i]->get_type() == expected) {
+									ptrargs[i] = argptrs[i]->get_ptrcall_arg();
+									if (!ptrargs[i]) {
+										can_ptrcall = false; //needs marshalling
+									}
+								} else {
+									can_ptrcall = false; //let call() convert or complain
+								}
+							}
+
+							if (can_ptrcall) {
+
+								if (!method->has_return()) {
+
+									method->ptrcall(obj, ptrargs, NULL);
+									if (call_ret) {
+										GET_VARIANT_PTR(ret, argc);
+										*ret = Variant();
+									}
+								} else {
+									//preconstruct a Variant of the return type and have the
+									//return value encoded straight into its storage; the VM
+									//stack slot is only written afterwards, as it may alias
+									//one of the arguments
+									Variant::Type ret_type = method->get_argument_type(-1);
+									Variant retv;
+									void *ret_ptr;
+									if (ret_type == Variant::NIL) {
+										ret_ptr = &retv; //Variant return, encoded whole
+									} else {
+										retv = Variant::construct(ret_type, NULL, 0, err);
+										ret_ptr = const_cast<void *>(retv.get_ptrcall_arg());
+									}
+									method->ptrcall(obj, ptrargs, ret_ptr);
+									if (call_ret) {
+										GET_VARIANT_PTR(ret, argc);
+										*ret = retv;
+									}
+								}
+								err.error = Variant::CallError::CALL_OK;
+								called = true;
+							}
+#endif
+							if (!called) {
+
+								if (call_ret) {
+
+									GET_VARIANT_PTR(ret, argc);
+									*ret = method->call(obj, (const Variant **)argptrs, argc, err);
+								} else {
 
-					base->call_ptr(*methodname, (const Variant **)argptrs, argc, NULL, err);
+									method->call(obj, (const Variant **)argptrs, argc, err);
+								}
+								called = true;
+							}
+						}
+					}
+				}
+
+				if (!called) {
+
+					if (call_ret) {
+
+						GET_VARIANT_PTR(ret, argc);
+						base->call_ptr(*methodname, (const Variant **)argptrs, argc, ret, err);
+					} else {
+
+						base->call_ptr(*methodname, (const Variant **)argptrs, argc, NULL, err);
+					}
 				}
 #ifdef DEBUG_ENABLED
-				if (GDScriptLanguage::get_singleton()->profiling) {
+				if (GDScriptLanguage::get_singleton()->is_instrumenting()) {
 					function_call_time += OS::get_singleton()->get_ticks_usec() - call_time;
 				}
 
@@ -1480,6 +1858,79 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_ITERATE_BEGIN_RANGE) {
+
+				CHECK_SPACE(12); //space for this and the range iterate that is always next
+
+				GET_VARIANT_PTR(counter, 1);
+				GET_VARIANT_PTR(to, 2);
+				GET_VARIANT_PTR(step, 3);
+
+#ifdef DEBUG_ENABLED
+				if ((counter->get_type() != Variant::INT && counter->get_type() != Variant::REAL) ||
+						(to->get_type() != Variant::INT && to->get_type() != Variant::REAL) ||
+						(step->get_type() != Variant::INT && step->get_type() != Variant::REAL)) {
+					err_text = "Invalid type in 'range' loop (arguments must be numbers).";
+					OPCODE_BREAK;
+				}
+#endif
+
+				int64_t from = counter->operator int64_t();
+				int64_t limit = to->operator int64_t();
+				int64_t incr = step->operator int64_t();
+
+				if (incr == 0) {
+					err_text = "Step argument in 'range' loop is zero.";
+					OPCODE_BREAK;
+				}
+
+				//normalize to integers so the range iterate can assume them
+				*counter = from;
+				*to = limit;
+				*step = incr;
+
+				if (incr > 0 ? from >= limit : from <= limit) {
+					//loop is empty
+					int jumpto = _code_ptr[ip + 4];
+					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
+					ip = jumpto;
+				} else {
+					GET_VARIANT_PTR(iterator, 5);
+
+					*iterator = from;
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_ITERATE_RANGE) {
+
+				CHECK_SPACE(6);
+
+				GET_VARIANT_PTR(counter, 1);
+				GET_VARIANT_PTR(to, 2);
+				GET_VARIANT_PTR(step, 3);
+
+				int64_t incr = step->operator int64_t();
+				int64_t next = counter->operator int64_t() + incr;
+				int64_t limit = to->operator int64_t();
+
+				*counter = next;
+
+				if (incr > 0 ? next >= limit : next <= limit) {
+					//loop is done
+					int jumpto = _code_ptr[ip + 4];
+					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
+					ip = jumpto;
+				} else {
+					GET_VARIANT_PTR(iterator, 5);
+
+					*iterator = next;
+					ip += 6; //loop again
+				}
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_ASSERT) {
 				CHECK_SPACE(3);
 
@@ -1591,7 +2042,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 	OPCODES_OUT
 #ifdef DEBUG_ENABLED
-	if (GDScriptLanguage::get_singleton()->profiling) {
+	if (GDScriptLanguage::get_singleton()->is_instrumenting()) {
 		uint64_t time_taken = OS::get_singleton()->get_ticks_usec() - function_start_time;
 		profile.total_time += time_taken;
 		profile.self_time += time_taken - function_call_time;
@@ -1747,6 +2198,9 @@ GDScriptFunction::GDScriptFunction() :
 
 	_stack_size = 0;
 	_call_size = 0;
+	_method_call_cache = NULL;
+	_member_get_cache = NULL;
+	_member_set_cache = NULL;
 	rpc_mode = MultiplayerAPI::RPC_MODE_DISABLED;
 	name = "<anonymous>";
 #ifdef DEBUG_ENABLED
@@ -1775,6 +2229,17 @@ GDScriptFunction::GDScriptFunction() :
 }
 
 GDScriptFunction::~GDScriptFunction() {
+
+	if (_method_call_cache) {
+		memdelete_arr(_method_call_cache);
+	}
+	if (_member_get_cache) {
+		memdelete_arr(_member_get_cache);
+	}
+	if (_member_set_cache) {
+		memdelete_arr(_member_set_cache);
+	}
+
 #ifdef DEBUG_ENABLED
 	if (GDScriptLanguage::get_singleton()->lock) {
 		GDScriptLanguage::get_singleton()->lock->lock();
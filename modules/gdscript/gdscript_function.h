@@ -41,6 +41,7 @@
 
 class GDScriptInstance;
 class GDScript;
+class MethodBind;
 
 struct GDScriptDataType {
 	bool has_type;
@@ -156,6 +157,7 @@ class GDScriptFunction {
 public:
 	enum Opcode {
 		OPCODE_OPERATOR,
+		OPCODE_OPERATOR_TYPED,
 		OPCODE_EXTENDS_TEST,
 		OPCODE_IS_BUILTIN,
 		OPCODE_SET,
@@ -164,6 +166,7 @@ public:
 		OPCODE_GET_NAMED,
 		OPCODE_SET_MEMBER,
 		OPCODE_GET_MEMBER,
+		OPCODE_GET_SCRIPT_MEMBER, //member slot resolved at compile time from a static script type
 		OPCODE_ASSIGN,
 		OPCODE_ASSIGN_TRUE,
 		OPCODE_ASSIGN_FALSE,
@@ -191,12 +194,36 @@ public:
 		OPCODE_RETURN,
 		OPCODE_ITERATE_BEGIN,
 		OPCODE_ITERATE,
+		OPCODE_ITERATE_BEGIN_RANGE, //counted integer loop, no array is materialized
+		OPCODE_ITERATE_RANGE,
 		OPCODE_ASSERT,
 		OPCODE_BREAKPOINT,
 		OPCODE_LINE,
 		OPCODE_END
 	};
 
+	//specialized kernels for OPCODE_OPERATOR_TYPED, emitted by the compiler when
+	//both operand types are statically known (type-major order, so kernel = TYPED_OP_ADD_<T> + op index)
+	enum TypedOperator {
+		TYPED_OP_ADD_INT,
+		TYPED_OP_SUB_INT,
+		TYPED_OP_MUL_INT,
+		TYPED_OP_DIV_INT,
+		TYPED_OP_ADD_REAL,
+		TYPED_OP_SUB_REAL,
+		TYPED_OP_MUL_REAL,
+		TYPED_OP_DIV_REAL,
+		TYPED_OP_ADD_VEC2,
+		TYPED_OP_SUB_VEC2,
+		TYPED_OP_MUL_VEC2,
+		TYPED_OP_DIV_VEC2,
+		TYPED_OP_ADD_VEC3,
+		TYPED_OP_SUB_VEC3,
+		TYPED_OP_MUL_VEC3,
+		TYPED_OP_DIV_VEC3,
+		TYPED_OP_MAX
+	};
+
 	enum Address {
 		ADDR_BITS = 24,
 		ADDR_MASK = ((1 << ADDR_BITS) - 1),
@@ -224,6 +251,31 @@ public:
 private:
 	friend class GDScriptCompiler;
 
+	//inline caches for name-based lookups, one entry per global name used by this
+	//function; filled once on the first successful resolution and checked against
+	//the receiver on every hit, stale when the version no longer matches
+	//GDScriptLanguage::get_script_cache_version()
+	struct MethodCallCache {
+		uint64_t version;
+		StringName base_class;
+		MethodBind *method;
+		MethodCallCache() {
+			version = 0;
+			method = NULL;
+		}
+	};
+
+	struct MemberAccessCache {
+		uint64_t version;
+		GDScript *script; //only compared against the receiver's script, never dereferenced
+		int member_index;
+		MemberAccessCache() {
+			version = 0;
+			script = NULL;
+			member_index = -1;
+		}
+	};
+
 	StringName source;
 
 	mutable Variant nil;
@@ -231,6 +283,9 @@ private:
 	int _constant_count;
 	const StringName *_global_names_ptr;
 	int _global_names_count;
+	MethodCallCache *_method_call_cache; //NULL when the function uses no global names
+	MemberAccessCache *_member_get_cache;
+	MemberAccessCache *_member_set_cache;
 #ifdef TOOLS_ENABLED
 	const StringName *_named_globals_ptr;
 	int _named_globals_count;
@@ -265,6 +320,9 @@ private:
 
 	List<StackDebug> stack_debug;
 
+	void _fill_method_cache(MethodCallCache &p_cache, const StringName &p_class, MethodBind *p_method, uint64_t p_version);
+	void _fill_member_cache(MemberAccessCache &p_cache, GDScript *p_script, int p_member_index, uint64_t p_version);
+
 	_FORCE_INLINE_ Variant *_get_variant(int p_address, GDScriptInstance *p_instance, GDScript *p_script, Variant &self, Variant *p_stack, String &r_error) const;
 	_FORCE_INLINE_ String _get_call_error(const Variant::CallError &p_err, const String &p_where, const Variant **argptrs) const;
 
@@ -32,7 +32,9 @@
 
 #include "core/io/marshalls.h"
 #include "core/message_queue.h"
+#include "core/os/worker_thread_pool.h"
 #include "scene/3d/light.h"
+#include "scene/resources/box_shape.h"
 #include "scene/resources/mesh_library.h"
 #include "scene/resources/surface_tool.h"
 #include "scene/scene_string_names.h"
@@ -402,45 +404,32 @@ void GridMap::_octant_transform(const OctantKey &p_key) {
 	}
 }
 
-bool GridMap::_octant_update(const OctantKey &p_key) {
-	ERR_FAIL_COND_V(!octant_map.has(p_key), false);
-	Octant &g = *octant_map[p_key];
-	if (!g.dirty)
-		return false;
+void GridMap::_octant_build_thread(void *p_userdata, uint32_t p_index) {
 
-	//erase body shapes
-	PhysicsServer::get_singleton()->body_clear_shapes(g.static_body);
+	OctantBuildList *bl = (OctantBuildList *)p_userdata;
+	bl->gridmap->_octant_build_data(bl->keys[p_index], bl->builds[p_index]);
+}
 
-	//erase body shapes debug
-	if (g.collision_debug.is_valid()) {
+void GridMap::_octant_build_data(const OctantKey &p_key, OctantBuildData &r_data) const {
 
-		VS::get_singleton()->mesh_clear(g.collision_debug);
-	}
+	//only reads the cell map and the mesh library, so this can run on worker threads
 
-	//erase navigation
-	if (navigation) {
-		for (Map<IndexKey, Octant::NavMesh>::Element *E = g.navmesh_ids.front(); E; E = E->next()) {
-			navigation->navmesh_remove(E->get().id);
-		}
-		g.navmesh_ids.clear();
-	}
+	ERR_FAIL_COND(!octant_map.has(p_key));
+	const Octant &g = *octant_map[p_key];
 
-	//erase multimeshes
+	bool debug_shapes = g.collision_debug.is_valid();
+	//don't merge when the debug mesh is visible, so it shows the authored per-cell shapes
+	bool merge_boxes = !debug_shapes;
 
-	for (int i = 0; i < g.multimesh_instances.size(); i++) {
+	struct MergeCandidate {
+		IndexKey key;
+		Vector3 half_extents;
+		Vector3 origin;
+	};
 
-		VS::get_singleton()->free(g.multimesh_instances[i].instance);
-		VS::get_singleton()->free(g.multimesh_instances[i].multimesh);
-	}
-	g.multimesh_instances.clear();
-
-	if (g.cells.size() == 0) {
-		//octant no longer needed
-		_octant_clean_up(p_key);
-		return true;
-	}
-
-	PoolVector<Vector3> col_debug;
+	//cells iterate in key order, so X varies fastest and runs of adjacent candidates
+	//along X end up consecutive in this vector
+	Vector<MergeCandidate> merge_candidates;
 
 	/*
 	 * foreach item in this octant,
@@ -448,8 +437,6 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 	 * and set said multimesh bounding box to one containing all cells which have this item
 	 */
 
-	Map<int, List<Pair<Transform, IndexKey> > > multimesh_items;
-
 	for (Set<IndexKey>::Element *E = g.cells.front(); E; E = E->next()) {
 
 		ERR_CONTINUE(!cell_map.has(E->get()));
@@ -468,48 +455,163 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 		xform.basis.scale(Vector3(cell_scale, cell_scale, cell_scale));
 		if (baked_meshes.size() == 0) {
 			if (mesh_library->get_item_mesh(c.item).is_valid()) {
-				if (!multimesh_items.has(c.item)) {
-					multimesh_items[c.item] = List<Pair<Transform, IndexKey> >();
+				if (!r_data.multimesh_items.has(c.item)) {
+					r_data.multimesh_items[c.item] = List<Pair<Transform, IndexKey> >();
 				}
 
 				Pair<Transform, IndexKey> p;
 				p.first = xform;
 				p.second = E->get();
-				multimesh_items[c.item].push_back(p);
+				r_data.multimesh_items[c.item].push_back(p);
 			}
 		}
 
 		Vector<MeshLibrary::ShapeData> shapes = mesh_library->get_item_shapes(c.item);
-		// add the item's shape at given xform to octant's static_body
-		for (int i = 0; i < shapes.size(); i++) {
-			// add the item's shape
-			if (!shapes[i].shape.is_valid())
-				continue;
-			PhysicsServer::get_singleton()->body_add_shape(g.static_body, shapes[i].shape->get_rid(), xform * shapes[i].local_transform);
-			if (g.collision_debug.is_valid()) {
-				shapes.write[i].shape->add_vertices_to_array(col_debug, xform * shapes[i].local_transform);
+
+		bool merged = false;
+
+		if (merge_boxes && c.rot == 0 && shapes.size() == 1 && shapes[0].shape.is_valid()) {
+			//a single unrotated box filling the cell along X can be merged with its neighbors
+			Ref<BoxShape> box = shapes[0].shape;
+			if (box.is_valid() && shapes[0].local_transform.basis == Basis() && Math::is_equal_approx(box->get_extents().x * 2.0 * cell_scale, cell_size.x)) {
+
+				MergeCandidate mc;
+				mc.key = E->get();
+				mc.half_extents = box->get_extents() * cell_scale;
+				mc.origin = xform.origin + shapes[0].local_transform.origin * cell_scale;
+				merge_candidates.push_back(mc);
+				merged = true;
+			}
+		}
+
+		if (!merged) {
+			// add the item's shape at given xform to octant's static_body
+			for (int i = 0; i < shapes.size(); i++) {
+				// add the item's shape
+				if (!shapes[i].shape.is_valid())
+					continue;
+				OctantBuildData::ShapePlacement sp;
+				sp.shape = shapes[i].shape->get_rid();
+				sp.xform = xform * shapes[i].local_transform;
+				r_data.shapes.push_back(sp);
+				if (debug_shapes) {
+					shapes.write[i].shape->add_vertices_to_array(r_data.col_debug, sp.xform);
+				}
 			}
 		}
 
 		// add the item's navmesh at given xform to GridMap's Navigation ancestor
 		Ref<NavigationMesh> navmesh = mesh_library->get_item_navmesh(c.item);
 		if (navmesh.is_valid()) {
-			Octant::NavMesh nm;
-			nm.xform = xform * mesh_library->get_item_navmesh_transform(c.item);
+			OctantBuildData::NavMeshPlacement np;
+			np.key = E->get();
+			np.navmesh = navmesh;
+			np.xform = xform;
+			np.navmesh_xform = xform * mesh_library->get_item_navmesh_transform(c.item);
+			r_data.navmeshes.push_back(np);
+		}
+	}
 
-			if (navigation) {
-				nm.id = navigation->navmesh_add(navmesh, xform, this);
-			} else {
-				nm.id = -1;
-			}
-			g.navmesh_ids[E->get()] = nm;
+	//merge runs of adjacent identical boxes along X into single larger boxes
+	for (int i = 0; i < merge_candidates.size();) {
+
+		int run = 1;
+		while (i + run < merge_candidates.size()) {
+
+			const MergeCandidate &a = merge_candidates[i + run - 1];
+			const MergeCandidate &b = merge_candidates[i + run];
+			if (b.key.y != a.key.y || b.key.z != a.key.z || b.key.x != a.key.x + 1)
+				break;
+			if (!b.half_extents.is_equal_approx(a.half_extents))
+				break;
+			if (!Math::is_equal_approx(b.origin.y, a.origin.y) || !Math::is_equal_approx(b.origin.z, a.origin.z))
+				break;
+			run++;
+		}
+
+		OctantBuildData::MergedBox mb;
+		mb.half_extents = merge_candidates[i].half_extents;
+		mb.half_extents.x *= run;
+		mb.xform.origin = (merge_candidates[i].origin + merge_candidates[i + run - 1].origin) * 0.5;
+		r_data.merged_boxes.push_back(mb);
+
+		i += run;
+	}
+}
+
+bool GridMap::_octant_update(const OctantKey &p_key, const OctantBuildData &p_build) {
+	ERR_FAIL_COND_V(!octant_map.has(p_key), false);
+	Octant &g = *octant_map[p_key];
+	if (!g.dirty)
+		return false;
+
+	//erase body shapes
+	PhysicsServer::get_singleton()->body_clear_shapes(g.static_body);
+
+	//erase merged box shapes
+	for (int i = 0; i < g.merged_shapes.size(); i++) {
+		PhysicsServer::get_singleton()->free(g.merged_shapes[i]);
+	}
+	g.merged_shapes.clear();
+
+	//erase body shapes debug
+	if (g.collision_debug.is_valid()) {
+
+		VS::get_singleton()->mesh_clear(g.collision_debug);
+	}
+
+	//erase navigation
+	if (navigation) {
+		for (Map<IndexKey, Octant::NavMesh>::Element *E = g.navmesh_ids.front(); E; E = E->next()) {
+			navigation->navmesh_remove(E->get().id);
 		}
+		g.navmesh_ids.clear();
+	}
+
+	//erase multimeshes
+
+	for (int i = 0; i < g.multimesh_instances.size(); i++) {
+
+		VS::get_singleton()->free(g.multimesh_instances[i].instance);
+		VS::get_singleton()->free(g.multimesh_instances[i].multimesh);
+	}
+	g.multimesh_instances.clear();
+
+	if (g.cells.size() == 0) {
+		//octant no longer needed
+		_octant_clean_up(p_key);
+		return true;
+	}
+
+	const PoolVector<Vector3> &col_debug = p_build.col_debug;
+
+	for (int i = 0; i < p_build.shapes.size(); i++) {
+		PhysicsServer::get_singleton()->body_add_shape(g.static_body, p_build.shapes[i].shape, p_build.shapes[i].xform);
+	}
+
+	for (int i = 0; i < p_build.merged_boxes.size(); i++) {
+		RID shape = PhysicsServer::get_singleton()->shape_create(PhysicsServer::SHAPE_BOX);
+		PhysicsServer::get_singleton()->shape_set_data(shape, p_build.merged_boxes[i].half_extents);
+		PhysicsServer::get_singleton()->body_add_shape(g.static_body, shape, p_build.merged_boxes[i].xform);
+		g.merged_shapes.push_back(shape);
+	}
+
+	for (int i = 0; i < p_build.navmeshes.size(); i++) {
+		Octant::NavMesh nm;
+		nm.xform = p_build.navmeshes[i].navmesh_xform;
+
+		if (navigation) {
+			nm.id = navigation->navmesh_add(p_build.navmeshes[i].navmesh, p_build.navmeshes[i].xform, this);
+		} else {
+			nm.id = -1;
+		}
+		g.navmesh_ids[p_build.navmeshes[i].key] = nm;
 	}
 
 	//update multimeshes, only if not baked
 	if (baked_meshes.size() == 0) {
 
-		for (Map<int, List<Pair<Transform, IndexKey> > >::Element *E = multimesh_items.front(); E; E = E->next()) {
+		for (Map<int, List<Pair<Transform, IndexKey> > >::Element *E = p_build.multimesh_items.front(); E; E = E->next()) {
 			Octant::MultimeshInstance mmi;
 
 			RID mm = VS::get_singleton()->multimesh_create();
@@ -640,6 +742,11 @@ void GridMap::_octant_clean_up(const OctantKey &p_key) {
 
 	PhysicsServer::get_singleton()->free(g.static_body);
 
+	for (int i = 0; i < g.merged_shapes.size(); i++) {
+		PhysicsServer::get_singleton()->free(g.merged_shapes[i]);
+	}
+	g.merged_shapes.clear();
+
 	//erase navigation
 	if (navigation) {
 		for (Map<IndexKey, Octant::NavMesh>::Element *E = g.navmesh_ids.front(); E; E = E->next()) {
@@ -791,11 +898,40 @@ void GridMap::_update_octants_callback() {
 	if (!awaiting_update)
 		return;
 
-	List<OctantKey> to_delete;
+	//building the octant data only reads the cell map and the mesh library, so it
+	//runs over the worker pool; the server-side swap below stays on this thread
+	Vector<OctantKey> dirty;
 	for (Map<OctantKey, Octant *>::Element *E = octant_map.front(); E; E = E->next()) {
+		if (E->get()->dirty) {
+			dirty.push_back(E->key());
+		}
+	}
+
+	Vector<OctantBuildData> builds;
+	builds.resize(dirty.size());
+
+	if (dirty.size() > 0) {
+
+		OctantBuildList bl;
+		bl.gridmap = this;
+		bl.keys = dirty.ptr();
+		bl.builds = builds.ptrw();
+
+		if (dirty.size() > 1 && WorkerThreadPool::get_singleton()) {
+			WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_group_task(_octant_build_thread, &bl, dirty.size());
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+		} else {
+			for (int i = 0; i < dirty.size(); i++) {
+				_octant_build_thread(&bl, i);
+			}
+		}
+	}
+
+	List<OctantKey> to_delete;
+	for (int i = 0; i < dirty.size(); i++) {
 
-		if (_octant_update(E->key())) {
-			to_delete.push_back(E->key());
+		if (_octant_update(dirty[i], builds[i])) {
+			to_delete.push_back(dirty[i]);
 		}
 	}
 
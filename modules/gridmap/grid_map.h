@@ -31,6 +31,7 @@
 #ifndef GRID_MAP_H
 #define GRID_MAP_H
 
+#include "core/pair.h"
 #include "scene/3d/navigation.h"
 #include "scene/3d/spatial.h"
 #include "scene/resources/mesh_library.h"
@@ -112,6 +113,8 @@ class GridMap : public Spatial {
 		RID collision_debug;
 		RID collision_debug_instance;
 
+		Vector<RID> merged_shapes; //box shapes created by merging contiguous cells, owned by the octant
+
 		bool dirty;
 		RID static_body;
 		Map<IndexKey, NavMesh> navmesh_ids;
@@ -177,10 +180,47 @@ class GridMap : public Spatial {
 		return Vector3(p_key.x, p_key.y, p_key.z) * cell_size * octant_size;
 	}
 
+	//everything an octant rebuild needs from the servers, prepared ahead of time
+	//so the expensive part can run on worker threads
+	struct OctantBuildData {
+
+		struct ShapePlacement {
+			RID shape;
+			Transform xform;
+		};
+
+		struct MergedBox {
+			Vector3 half_extents;
+			Transform xform;
+		};
+
+		struct NavMeshPlacement {
+			IndexKey key;
+			Ref<NavigationMesh> navmesh;
+			Transform xform;
+			Transform navmesh_xform;
+		};
+
+		Map<int, List<Pair<Transform, IndexKey> > > multimesh_items;
+		Vector<ShapePlacement> shapes;
+		Vector<MergedBox> merged_boxes;
+		Vector<NavMeshPlacement> navmeshes;
+		PoolVector<Vector3> col_debug;
+	};
+
+	struct OctantBuildList {
+		GridMap *gridmap;
+		const OctantKey *keys;
+		OctantBuildData *builds;
+	};
+
+	static void _octant_build_thread(void *p_userdata, uint32_t p_index);
+	void _octant_build_data(const OctantKey &p_key, OctantBuildData &r_data) const;
+
 	void _reset_physic_bodies_collision_filters();
 	void _octant_enter_world(const OctantKey &p_key);
 	void _octant_exit_world(const OctantKey &p_key);
-	bool _octant_update(const OctantKey &p_key);
+	bool _octant_update(const OctantKey &p_key, const OctantBuildData &p_build);
 	void _octant_clean_up(const OctantKey &p_key);
 	void _octant_transform(const OctantKey &p_key);
 	bool awaiting_update;
@@ -30,6 +30,9 @@
 
 #include "gd_mono_marshal.h"
 
+#include "core/os/copymem.h"
+
+#include "../utils/macros.h"
 #include "gd_mono.h"
 #include "gd_mono_cache.h"
 #include "gd_mono_class.h"
@@ -985,15 +988,17 @@ Array mono_array_to_Array(MonoArray *p_array) {
 	return ret;
 }
 
-// TODO: Use memcpy where possible
+// The InteropLayout static asserts guarantee the managed value types are
+// bit-compatible with the native ones, so pool arrays of them can marshal
+// with one bulk copy instead of per-element conversions.
 
 MonoArray *PoolIntArray_to_mono_array(const PoolIntArray &p_array) {
 	PoolIntArray::Read r = p_array.read();
 
 	MonoArray *ret = mono_array_new(mono_domain_get(), CACHED_CLASS_RAW(int32_t), p_array.size());
 
-	for (int i = 0; i < p_array.size(); i++) {
-		mono_array_set(ret, int32_t, i, r[i]);
+	if (p_array.size()) {
+		copymem(mono_array_addr(ret, int32_t, 0), r.ptr(), p_array.size() * sizeof(int32_t));
 	}
 
 	return ret;
@@ -1007,8 +1012,8 @@ PoolIntArray mono_array_to_PoolIntArray(MonoArray *p_array) {
 	ret.resize(length);
 	PoolIntArray::Write w = ret.write();
 
-	for (int i = 0; i < length; i++) {
-		w[i] = mono_array_get(p_array, int32_t, i);
+	if (length) {
+		copymem(w.ptr(), mono_array_addr(p_array, int32_t, 0), length * sizeof(int32_t));
 	}
 
 	return ret;
@@ -1019,8 +1024,8 @@ MonoArray *PoolByteArray_to_mono_array(const PoolByteArray &p_array) {
 
 	MonoArray *ret = mono_array_new(mono_domain_get(), CACHED_CLASS_RAW(uint8_t), p_array.size());
 
-	for (int i = 0; i < p_array.size(); i++) {
-		mono_array_set(ret, uint8_t, i, r[i]);
+	if (p_array.size()) {
+		copymem(mono_array_addr(ret, uint8_t, 0), r.ptr(), p_array.size() * sizeof(uint8_t));
 	}
 
 	return ret;
@@ -1034,8 +1039,8 @@ PoolByteArray mono_array_to_PoolByteArray(MonoArray *p_array) {
 	ret.resize(length);
 	PoolByteArray::Write w = ret.write();
 
-	for (int i = 0; i < length; i++) {
-		w[i] = mono_array_get(p_array, uint8_t, i);
+	if (length) {
+		copymem(w.ptr(), mono_array_addr(p_array, uint8_t, 0), length * sizeof(uint8_t));
 	}
 
 	return ret;
@@ -1046,8 +1051,8 @@ MonoArray *PoolRealArray_to_mono_array(const PoolRealArray &p_array) {
 
 	MonoArray *ret = mono_array_new(mono_domain_get(), REAL_T_MONOCLASS, p_array.size());
 
-	for (int i = 0; i < p_array.size(); i++) {
-		mono_array_set(ret, real_t, i, r[i]);
+	if (p_array.size()) {
+		copymem(mono_array_addr(ret, real_t, 0), r.ptr(), p_array.size() * sizeof(real_t));
 	}
 
 	return ret;
@@ -1061,8 +1066,8 @@ PoolRealArray mono_array_to_PoolRealArray(MonoArray *p_array) {
 	ret.resize(length);
 	PoolRealArray::Write w = ret.write();
 
-	for (int i = 0; i < length; i++) {
-		w[i] = mono_array_get(p_array, real_t, i);
+	if (length) {
+		copymem(w.ptr(), mono_array_addr(p_array, real_t, 0), length * sizeof(real_t));
 	}
 
 	return ret;
@@ -1097,14 +1102,19 @@ PoolStringArray mono_array_to_PoolStringArray(MonoArray *p_array) {
 	return ret;
 }
 
+// The bulk copies below reinterpret the native buffers as arrays of the
+// packed managed mirror structs, which is only valid while the layouts match.
+/* clang-format off */
+GD_STATIC_ASSERT(InteropLayout::MATCHES_Vector2 && InteropLayout::MATCHES_Vector3 && InteropLayout::MATCHES_Color);
+/* clang-format on */
+
 MonoArray *PoolColorArray_to_mono_array(const PoolColorArray &p_array) {
 	PoolColorArray::Read r = p_array.read();
 
 	MonoArray *ret = mono_array_new(mono_domain_get(), CACHED_CLASS_RAW(Color), p_array.size());
 
-	for (int i = 0; i < p_array.size(); i++) {
-		M_Color *raw = (M_Color *)mono_array_addr_with_size(ret, sizeof(M_Color), i);
-		*raw = MARSHALLED_OUT(Color, r[i]);
+	if (p_array.size()) {
+		copymem(mono_array_addr_with_size(ret, sizeof(M_Color), 0), r.ptr(), p_array.size() * sizeof(M_Color));
 	}
 
 	return ret;
@@ -1118,8 +1128,8 @@ PoolColorArray mono_array_to_PoolColorArray(MonoArray *p_array) {
 	ret.resize(length);
 	PoolColorArray::Write w = ret.write();
 
-	for (int i = 0; i < length; i++) {
-		w[i] = MARSHALLED_IN(Color, (M_Color *)mono_array_addr_with_size(p_array, sizeof(M_Color), i));
+	if (length) {
+		copymem(w.ptr(), mono_array_addr_with_size(p_array, sizeof(M_Color), 0), length * sizeof(M_Color));
 	}
 
 	return ret;
@@ -1130,9 +1140,8 @@ MonoArray *PoolVector2Array_to_mono_array(const PoolVector2Array &p_array) {
 
 	MonoArray *ret = mono_array_new(mono_domain_get(), CACHED_CLASS_RAW(Vector2), p_array.size());
 
-	for (int i = 0; i < p_array.size(); i++) {
-		M_Vector2 *raw = (M_Vector2 *)mono_array_addr_with_size(ret, sizeof(M_Vector2), i);
-		*raw = MARSHALLED_OUT(Vector2, r[i]);
+	if (p_array.size()) {
+		copymem(mono_array_addr_with_size(ret, sizeof(M_Vector2), 0), r.ptr(), p_array.size() * sizeof(M_Vector2));
 	}
 
 	return ret;
@@ -1146,8 +1155,8 @@ PoolVector2Array mono_array_to_PoolVector2Array(MonoArray *p_array) {
 	ret.resize(length);
 	PoolVector2Array::Write w = ret.write();
 
-	for (int i = 0; i < length; i++) {
-		w[i] = MARSHALLED_IN(Vector2, (M_Vector2 *)mono_array_addr_with_size(p_array, sizeof(M_Vector2), i));
+	if (length) {
+		copymem(w.ptr(), mono_array_addr_with_size(p_array, sizeof(M_Vector2), 0), length * sizeof(M_Vector2));
 	}
 
 	return ret;
@@ -1158,9 +1167,8 @@ MonoArray *PoolVector3Array_to_mono_array(const PoolVector3Array &p_array) {
 
 	MonoArray *ret = mono_array_new(mono_domain_get(), CACHED_CLASS_RAW(Vector3), p_array.size());
 
-	for (int i = 0; i < p_array.size(); i++) {
-		M_Vector3 *raw = (M_Vector3 *)mono_array_addr_with_size(ret, sizeof(M_Vector3), i);
-		*raw = MARSHALLED_OUT(Vector3, r[i]);
+	if (p_array.size()) {
+		copymem(mono_array_addr_with_size(ret, sizeof(M_Vector3), 0), r.ptr(), p_array.size() * sizeof(M_Vector3));
 	}
 
 	return ret;
@@ -1174,8 +1182,8 @@ PoolVector3Array mono_array_to_PoolVector3Array(MonoArray *p_array) {
 	ret.resize(length);
 	PoolVector3Array::Write w = ret.write();
 
-	for (int i = 0; i < length; i++) {
-		w[i] = MARSHALLED_IN(Vector3, (M_Vector3 *)mono_array_addr_with_size(p_array, sizeof(M_Vector3), i));
+	if (length) {
+		copymem(w.ptr(), mono_array_addr_with_size(p_array, sizeof(M_Vector3), 0), length * sizeof(M_Vector3));
 	}
 
 	return ret;
@@ -29,8 +29,10 @@
 /*************************************************************************/
 
 #include "navigation_mesh_generator.h"
+#include "core/hashfuncs.h"
 #include "core/math/quick_hull.h"
 #include "core/os/thread.h"
+#include "core/os/worker_thread_pool.h"
 #include "editor/editor_settings.h"
 #include "scene/3d/collision_shape.h"
 #include "scene/3d/mesh_instance.h"
@@ -54,6 +56,7 @@
 #endif
 
 EditorNavigationMeshGenerator *EditorNavigationMeshGenerator::singleton = NULL;
+Map<ObjectID, EditorNavigationMeshGenerator::TileCache> EditorNavigationMeshGenerator::bake_cache;
 
 void EditorNavigationMeshGenerator::_add_vertex(const Vector3 &p_vec3, Vector<float> &p_verticies) {
 	p_verticies.push_back(p_vec3.x);
@@ -270,15 +273,45 @@ void EditorNavigationMeshGenerator::_parse_geometry(Transform p_accumulated_tran
 	}
 }
 
-void EditorNavigationMeshGenerator::_convert_detail_mesh_to_native_navigation_mesh(const rcPolyMeshDetail *p_detail_mesh, Ref<NavigationMesh> p_nav_mesh) {
+uint32_t EditorNavigationMeshGenerator::_hash_bake_config(Ref<NavigationMesh> p_nav_mesh) {
+
+	float fconf[13] = {
+		p_nav_mesh->get_cell_size(),
+		p_nav_mesh->get_cell_height(),
+		p_nav_mesh->get_agent_height(),
+		p_nav_mesh->get_agent_radius(),
+		p_nav_mesh->get_agent_max_climb(),
+		p_nav_mesh->get_agent_max_slope(),
+		p_nav_mesh->get_region_min_size(),
+		p_nav_mesh->get_region_merge_size(),
+		p_nav_mesh->get_edge_max_length(),
+		p_nav_mesh->get_edge_max_error(),
+		p_nav_mesh->get_verts_per_poly(),
+		p_nav_mesh->get_detail_sample_distance(),
+		p_nav_mesh->get_detail_sample_max_error()
+	};
+
+	int iconf[4] = {
+		p_nav_mesh->get_sample_partition_type(),
+		p_nav_mesh->get_filter_low_hanging_obstacles() ? 1 : 0,
+		p_nav_mesh->get_filter_ledge_spans() ? 1 : 0,
+		p_nav_mesh->get_filter_walkable_low_height_spans() ? 1 : 0
+	};
+
+	uint32_t h = hash_djb2_buffer((const uint8_t *)fconf, sizeof(fconf));
+	h = hash_djb2_buffer((const uint8_t *)iconf, sizeof(iconf), h);
+	return h;
+}
 
-	PoolVector<Vector3> nav_vertices;
+void EditorNavigationMeshGenerator::_convert_detail_mesh_to_tile(const rcPolyMeshDetail *p_detail_mesh, BakedTile *r_tile) {
+
+	r_tile->vertices.clear();
+	r_tile->triangles.clear();
 
 	for (int i = 0; i < p_detail_mesh->nverts; i++) {
 		const float *v = &p_detail_mesh->verts[i * 3];
-		nav_vertices.append(Vector3(v[0], v[1], v[2]));
+		r_tile->vertices.push_back(Vector3(v[0], v[1], v[2]));
 	}
-	p_nav_mesh->set_vertices(nav_vertices);
 
 	for (int i = 0; i < p_detail_mesh->nmeshes; i++) {
 		const unsigned int *m = &p_detail_mesh->meshes[i * 4];
@@ -287,132 +320,151 @@ void EditorNavigationMeshGenerator::_convert_detail_mesh_to_native_navigation_me
 		const unsigned int ntris = m[3];
 		const unsigned char *tris = &p_detail_mesh->tris[btris * 4];
 		for (unsigned int j = 0; j < ntris; j++) {
-			Vector<int> nav_indices;
-			nav_indices.resize(3);
 			// Polygon order in recast is opposite than godot's
-			nav_indices.write[0] = ((int)(bverts + tris[j * 4 + 0]));
-			nav_indices.write[1] = ((int)(bverts + tris[j * 4 + 2]));
-			nav_indices.write[2] = ((int)(bverts + tris[j * 4 + 1]));
-			p_nav_mesh->add_polygon(nav_indices);
+			r_tile->triangles.push_back((int)(bverts + tris[j * 4 + 0]));
+			r_tile->triangles.push_back((int)(bverts + tris[j * 4 + 2]));
+			r_tile->triangles.push_back((int)(bverts + tris[j * 4 + 1]));
 		}
 	}
 }
 
-void EditorNavigationMeshGenerator::_build_recast_navigation_mesh(Ref<NavigationMesh> p_nav_mesh, EditorProgress *ep,
-		rcHeightfield *hf, rcCompactHeightfield *chf, rcContourSet *cset, rcPolyMesh *poly_mesh, rcPolyMeshDetail *detail_mesh,
-		Vector<float> &vertices, Vector<int> &indices) {
-	rcContext ctx;
-	ep->step(TTR("Setting up Configuration..."), 1);
+void EditorNavigationMeshGenerator::_bake_tile(TileBakeState *p_state, int p_dirty_index) {
 
-	const float *verts = vertices.ptr();
-	const int nverts = vertices.size() / 3;
-	const int *tris = indices.ptr();
-	const int ntris = indices.size() / 3;
+	const int tile = p_state->dirty_tiles[p_dirty_index];
+	const int tx = tile % p_state->tiles_x;
+	const int tz = tile / p_state->tiles_x;
 
-	float bmin[3], bmax[3];
-	rcCalcBounds(verts, nverts, bmin, bmax);
+	BakedTile *baked = &p_state->tiles[tile];
+	baked->vertices.clear();
+	baked->triangles.clear();
+
+	const Vector<int> &tris_in_tile = p_state->tile_indices[tile];
+	if (tris_in_tile.size() == 0) {
+		return;
+	}
+
+	NavigationMesh *nav_mesh = p_state->nav_mesh;
+	rcContext ctx;
 
 	rcConfig cfg;
 	memset(&cfg, 0, sizeof(cfg));
 
-	cfg.cs = p_nav_mesh->get_cell_size();
-	cfg.ch = p_nav_mesh->get_cell_height();
-	cfg.walkableSlopeAngle = p_nav_mesh->get_agent_max_slope();
-	cfg.walkableHeight = (int)Math::ceil(p_nav_mesh->get_agent_height() / cfg.ch);
-	cfg.walkableClimb = (int)Math::floor(p_nav_mesh->get_agent_max_climb() / cfg.ch);
-	cfg.walkableRadius = (int)Math::ceil(p_nav_mesh->get_agent_radius() / cfg.cs);
-	cfg.maxEdgeLen = (int)(p_nav_mesh->get_edge_max_length() / p_nav_mesh->get_cell_size());
-	cfg.maxSimplificationError = p_nav_mesh->get_edge_max_error();
-	cfg.minRegionArea = (int)(p_nav_mesh->get_region_min_size() * p_nav_mesh->get_region_min_size());
-	cfg.mergeRegionArea = (int)(p_nav_mesh->get_region_merge_size() * p_nav_mesh->get_region_merge_size());
-	cfg.maxVertsPerPoly = (int)p_nav_mesh->get_verts_per_poly();
-	cfg.detailSampleDist = p_nav_mesh->get_detail_sample_distance() < 0.9f ? 0 : p_nav_mesh->get_cell_size() * p_nav_mesh->get_detail_sample_distance();
-	cfg.detailSampleMaxError = p_nav_mesh->get_cell_height() * p_nav_mesh->get_detail_sample_max_error();
-
-	cfg.bmin[0] = bmin[0];
-	cfg.bmin[1] = bmin[1];
-	cfg.bmin[2] = bmin[2];
-	cfg.bmax[0] = bmax[0];
-	cfg.bmax[1] = bmax[1];
-	cfg.bmax[2] = bmax[2];
-
-	ep->step(TTR("Calculating grid size..."), 2);
-	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
-
-	ep->step(TTR("Creating heightfield..."), 3);
-	hf = rcAllocHeightfield();
-
+	cfg.cs = nav_mesh->get_cell_size();
+	cfg.ch = nav_mesh->get_cell_height();
+	cfg.walkableSlopeAngle = nav_mesh->get_agent_max_slope();
+	cfg.walkableHeight = (int)Math::ceil(nav_mesh->get_agent_height() / cfg.ch);
+	cfg.walkableClimb = (int)Math::floor(nav_mesh->get_agent_max_climb() / cfg.ch);
+	cfg.walkableRadius = (int)Math::ceil(nav_mesh->get_agent_radius() / cfg.cs);
+	cfg.maxEdgeLen = (int)(nav_mesh->get_edge_max_length() / nav_mesh->get_cell_size());
+	cfg.maxSimplificationError = nav_mesh->get_edge_max_error();
+	cfg.minRegionArea = (int)(nav_mesh->get_region_min_size() * nav_mesh->get_region_min_size());
+	cfg.mergeRegionArea = (int)(nav_mesh->get_region_merge_size() * nav_mesh->get_region_merge_size());
+	cfg.maxVertsPerPoly = (int)nav_mesh->get_verts_per_poly();
+	cfg.detailSampleDist = nav_mesh->get_detail_sample_distance() < 0.9f ? 0 : nav_mesh->get_cell_size() * nav_mesh->get_detail_sample_distance();
+	cfg.detailSampleMaxError = nav_mesh->get_cell_height() * nav_mesh->get_detail_sample_max_error();
+
+	// Overlap neighbouring tiles by a border so the walkable area erosion has
+	// context across the seam; recast drops the border polygons afterwards.
+	cfg.borderSize = cfg.walkableRadius + 3;
+	cfg.width = TILE_SIZE_CELLS + cfg.borderSize * 2;
+	cfg.height = TILE_SIZE_CELLS + cfg.borderSize * 2;
+
+	cfg.bmin[0] = p_state->bmin[0] + tx * p_state->tile_world - cfg.borderSize * cfg.cs;
+	cfg.bmin[1] = p_state->bmin[1];
+	cfg.bmin[2] = p_state->bmin[2] + tz * p_state->tile_world - cfg.borderSize * cfg.cs;
+	cfg.bmax[0] = cfg.bmin[0] + cfg.width * cfg.cs;
+	cfg.bmax[1] = p_state->bmax[1];
+	cfg.bmax[2] = cfg.bmin[2] + cfg.height * cfg.cs;
+
+	const float *verts = p_state->verts;
+	const int nverts = p_state->nverts;
+	const int *tris = tris_in_tile.ptr();
+	const int ntris = tris_in_tile.size() / 3;
+
+	rcHeightfield *hf = rcAllocHeightfield();
 	ERR_FAIL_COND(!hf);
-	ERR_FAIL_COND(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch));
 
-	ep->step(TTR("Marking walkable triangles..."), 4);
+	if (!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch)) {
+		rcFreeHeightField(hf);
+		ERR_FAIL();
+	}
+
 	{
 		Vector<unsigned char> tri_areas;
 		tri_areas.resize(ntris);
-
-		ERR_FAIL_COND(tri_areas.size() == 0);
-
 		memset(tri_areas.ptrw(), 0, ntris * sizeof(unsigned char));
 		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptrw());
 
-		ERR_FAIL_COND(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, cfg.walkableClimb));
+		if (!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, cfg.walkableClimb)) {
+			rcFreeHeightField(hf);
+			ERR_FAIL();
+		}
 	}
 
-	if (p_nav_mesh->get_filter_low_hanging_obstacles())
+	if (nav_mesh->get_filter_low_hanging_obstacles())
 		rcFilterLowHangingWalkableObstacles(&ctx, cfg.walkableClimb, *hf);
-	if (p_nav_mesh->get_filter_ledge_spans())
+	if (nav_mesh->get_filter_ledge_spans())
 		rcFilterLedgeSpans(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf);
-	if (p_nav_mesh->get_filter_walkable_low_height_spans())
+	if (nav_mesh->get_filter_walkable_low_height_spans())
 		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *hf);
 
-	ep->step(TTR("Constructing compact heightfield..."), 5);
-
-	chf = rcAllocCompactHeightfield();
-
-	ERR_FAIL_COND(!chf);
-	ERR_FAIL_COND(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf));
+	rcCompactHeightfield *chf = rcAllocCompactHeightfield();
+	if (!chf || !rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf)) {
+		rcFreeHeightField(hf);
+		rcFreeCompactHeightfield(chf);
+		ERR_FAIL();
+	}
 
 	rcFreeHeightField(hf);
 	hf = 0;
 
-	ep->step(TTR("Eroding walkable area..."), 6);
-	ERR_FAIL_COND(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf));
+	bool built = rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf);
 
-	ep->step(TTR("Partitioning..."), 7);
-	if (p_nav_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
-		ERR_FAIL_COND(!rcBuildDistanceField(&ctx, *chf));
-		ERR_FAIL_COND(!rcBuildRegions(&ctx, *chf, 0, cfg.minRegionArea, cfg.mergeRegionArea));
-	} else if (p_nav_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
-		ERR_FAIL_COND(!rcBuildRegionsMonotone(&ctx, *chf, 0, cfg.minRegionArea, cfg.mergeRegionArea));
-	} else {
-		ERR_FAIL_COND(!rcBuildLayerRegions(&ctx, *chf, 0, cfg.minRegionArea));
+	if (built) {
+		if (nav_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
+			built = rcBuildDistanceField(&ctx, *chf) && rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea);
+		} else if (nav_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
+			built = rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea);
+		} else {
+			built = rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea);
+		}
 	}
 
-	ep->step(TTR("Creating contours..."), 8);
-
-	cset = rcAllocContourSet();
-
-	ERR_FAIL_COND(!cset);
-	ERR_FAIL_COND(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset));
+	if (!built) {
+		rcFreeCompactHeightfield(chf);
+		ERR_FAIL();
+	}
 
-	ep->step(TTR("Creating polymesh..."), 9);
+	rcContourSet *cset = rcAllocContourSet();
+	if (!cset || !rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset)) {
+		rcFreeCompactHeightfield(chf);
+		rcFreeContourSet(cset);
+		ERR_FAIL();
+	}
 
-	poly_mesh = rcAllocPolyMesh();
-	ERR_FAIL_COND(!poly_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh));
+	rcPolyMesh *poly_mesh = rcAllocPolyMesh();
+	if (!poly_mesh || !rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh)) {
+		rcFreeCompactHeightfield(chf);
+		rcFreeContourSet(cset);
+		rcFreePolyMesh(poly_mesh);
+		ERR_FAIL();
+	}
 
-	detail_mesh = rcAllocPolyMeshDetail();
-	ERR_FAIL_COND(!detail_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh));
+	rcPolyMeshDetail *detail_mesh = rcAllocPolyMeshDetail();
+	if (!detail_mesh || !rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh)) {
+		rcFreeCompactHeightfield(chf);
+		rcFreeContourSet(cset);
+		rcFreePolyMesh(poly_mesh);
+		rcFreePolyMeshDetail(detail_mesh);
+		ERR_FAIL();
+	}
 
 	rcFreeCompactHeightfield(chf);
 	chf = 0;
 	rcFreeContourSet(cset);
 	cset = 0;
 
-	ep->step(TTR("Converting to native navigation mesh..."), 10);
-
-	_convert_detail_mesh_to_native_navigation_mesh(detail_mesh, p_nav_mesh);
+	_convert_detail_mesh_to_tile(detail_mesh, baked);
 
 	rcFreePolyMesh(poly_mesh);
 	poly_mesh = 0;
@@ -420,6 +472,173 @@ void EditorNavigationMeshGenerator::_build_recast_navigation_mesh(Ref<Navigation
 	detail_mesh = 0;
 }
 
+void EditorNavigationMeshGenerator::_bake_tile_task(void *p_userdata, uint32_t p_index) {
+
+	_bake_tile((TileBakeState *)p_userdata, p_index);
+}
+
+void EditorNavigationMeshGenerator::_bake_tiled(Ref<NavigationMesh> p_nav_mesh, EditorProgress *ep, Vector<float> &vertices, Vector<int> &indices) {
+
+	const float *verts = vertices.ptr();
+	const int nverts = vertices.size() / 3;
+	const int ntris = indices.size() / 3;
+
+	float bmin[3], bmax[3];
+	rcCalcBounds(verts, nverts, bmin, bmax);
+
+	const float cs = p_nav_mesh->get_cell_size();
+	const float tile_world = TILE_SIZE_CELLS * cs;
+
+	const int tiles_x = (int)((bmax[0] - bmin[0]) / tile_world) + 1;
+	const int tiles_z = (int)((bmax[2] - bmin[2]) / tile_world) + 1;
+	const int tile_count = tiles_x * tiles_z;
+
+	const uint32_t config_hash = _hash_bake_config(p_nav_mesh);
+
+	TileCache &cache = bake_cache[p_nav_mesh->get_instance_id()];
+	if (cache.tiles.size() != tile_count || cache.config_hash != config_hash || cache.tiles_x != tiles_x || cache.bmin != Vector3(bmin[0], bmin[1], bmin[2])) {
+		// Layout changed, every tile is dirty.
+		cache.tiles.clear();
+		cache.tiles.resize(tile_count);
+		cache.config_hash = config_hash;
+		cache.tiles_x = tiles_x;
+		cache.tiles_z = tiles_z;
+		cache.bmin = Vector3(bmin[0], bmin[1], bmin[2]);
+	}
+
+	ep->step(TTR("Assigning geometry to tiles..."), 2);
+
+	// A triangle is assigned to every tile whose bordered bounds it touches,
+	// so each tile can be baked from its own triangle list alone.
+	const float border_world = (Math::ceil(p_nav_mesh->get_agent_radius() / cs) + 3) * cs;
+
+	Vector<Vector<int> > tile_indices;
+	tile_indices.resize(tile_count);
+
+	for (int i = 0; i < ntris; i++) {
+
+		float minx = verts[indices[i * 3] * 3], maxx = minx;
+		float minz = verts[indices[i * 3] * 3 + 2], maxz = minz;
+		for (int j = 1; j < 3; j++) {
+			const float *v = &verts[indices[i * 3 + j] * 3];
+			minx = MIN(minx, v[0]);
+			maxx = MAX(maxx, v[0]);
+			minz = MIN(minz, v[2]);
+			maxz = MAX(maxz, v[2]);
+		}
+
+		int tx0 = (int)((minx - border_world - bmin[0]) / tile_world);
+		int tx1 = (int)((maxx + border_world - bmin[0]) / tile_world);
+		int tz0 = (int)((minz - border_world - bmin[2]) / tile_world);
+		int tz1 = (int)((maxz + border_world - bmin[2]) / tile_world);
+		tx0 = CLAMP(tx0, 0, tiles_x - 1);
+		tx1 = CLAMP(tx1, 0, tiles_x - 1);
+		tz0 = CLAMP(tz0, 0, tiles_z - 1);
+		tz1 = CLAMP(tz1, 0, tiles_z - 1);
+
+		for (int tz = tz0; tz <= tz1; tz++) {
+			for (int tx = tx0; tx <= tx1; tx++) {
+				Vector<int> &ti = tile_indices.write[tz * tiles_x + tx];
+				ti.push_back(indices[i * 3 + 0]);
+				ti.push_back(indices[i * 3 + 1]);
+				ti.push_back(indices[i * 3 + 2]);
+			}
+		}
+	}
+
+	// A tile is dirty when the hash of the geometry overlapping it changed.
+	Vector<int> dirty_tiles;
+
+	for (int t = 0; t < tile_count; t++) {
+
+		const Vector<int> &ti = tile_indices[t];
+
+		uint32_t h = config_hash;
+		for (int i = 0; i < ti.size(); i++) {
+			h = hash_djb2_buffer((const uint8_t *)&verts[ti[i] * 3], sizeof(float) * 3, h);
+		}
+		if (h == 0) {
+			h = 1; // 0 means never baked.
+		}
+
+		if (cache.tiles[t].hash != h) {
+			cache.tiles.write[t].hash = h;
+			dirty_tiles.push_back(t);
+		}
+	}
+
+	ep->step(vformat(TTR("Baking %d/%d tiles..."), dirty_tiles.size(), tile_count), 4);
+
+	if (dirty_tiles.size() > 0) {
+
+		TileBakeState state;
+		state.nav_mesh = p_nav_mesh.ptr();
+		state.verts = verts;
+		state.nverts = nverts;
+		state.tile_indices = tile_indices.ptr();
+		state.dirty_tiles = dirty_tiles.ptr();
+		state.tiles = cache.tiles.ptrw();
+		state.bmin[0] = bmin[0];
+		state.bmin[1] = bmin[1];
+		state.bmin[2] = bmin[2];
+		state.bmax[0] = bmax[0];
+		state.bmax[1] = bmax[1];
+		state.bmax[2] = bmax[2];
+		state.tile_world = tile_world;
+		state.tiles_x = tiles_x;
+
+		WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+		if (pool && dirty_tiles.size() > 1) {
+			WorkerThreadPool::GroupID group = pool->add_group_task(_bake_tile_task, &state, dirty_tiles.size());
+			pool->wait_for_group_task_completion(group);
+		} else {
+			for (int i = 0; i < dirty_tiles.size(); i++) {
+				_bake_tile(&state, i);
+			}
+		}
+	}
+
+	ep->step(TTR("Merging tiles..."), 10);
+
+	p_nav_mesh->clear_polygons();
+
+	PoolVector<Vector3> nav_vertices;
+	int vertex_count = 0;
+	for (int t = 0; t < tile_count; t++) {
+		vertex_count += cache.tiles[t].vertices.size();
+	}
+	nav_vertices.resize(vertex_count);
+
+	{
+		PoolVector<Vector3>::Write w = nav_vertices.write();
+		int base = 0;
+		for (int t = 0; t < tile_count; t++) {
+			const BakedTile &baked = cache.tiles[t];
+			for (int i = 0; i < baked.vertices.size(); i++) {
+				w[base + i] = baked.vertices[i];
+			}
+			base += baked.vertices.size();
+		}
+	}
+	p_nav_mesh->set_vertices(nav_vertices);
+
+	{
+		int base = 0;
+		for (int t = 0; t < tile_count; t++) {
+			const BakedTile &baked = cache.tiles[t];
+			for (int i = 0; i < baked.triangles.size() / 3; i++) {
+				Vector<int> nav_indices;
+				nav_indices.resize(3);
+				nav_indices.write[0] = base + baked.triangles[i * 3 + 0];
+				nav_indices.write[1] = base + baked.triangles[i * 3 + 1];
+				nav_indices.write[2] = base + baked.triangles[i * 3 + 2];
+				p_nav_mesh->add_polygon(nav_indices);
+			}
+			base += baked.vertices.size();
+		}
+	}
+}
+
 EditorNavigationMeshGenerator *EditorNavigationMeshGenerator::get_singleton() {
 	return singleton;
 }
@@ -458,29 +677,7 @@ void EditorNavigationMeshGenerator::bake(Ref<NavigationMesh> p_nav_mesh, Node *p
 	}
 
 	if (vertices.size() > 0 && indices.size() > 0) {
-
-		rcHeightfield *hf = NULL;
-		rcCompactHeightfield *chf = NULL;
-		rcContourSet *cset = NULL;
-		rcPolyMesh *poly_mesh = NULL;
-		rcPolyMeshDetail *detail_mesh = NULL;
-
-		_build_recast_navigation_mesh(p_nav_mesh, &ep, hf, chf, cset, poly_mesh, detail_mesh, vertices, indices);
-
-		rcFreeHeightField(hf);
-		hf = 0;
-
-		rcFreeCompactHeightfield(chf);
-		chf = 0;
-
-		rcFreeContourSet(cset);
-		cset = 0;
-
-		rcFreePolyMesh(poly_mesh);
-		poly_mesh = 0;
-
-		rcFreePolyMeshDetail(detail_mesh);
-		detail_mesh = 0;
+		_bake_tiled(p_nav_mesh, &ep, vertices, indices);
 	}
 	ep.step(TTR("Done!"), 11);
 }
@@ -489,6 +686,7 @@ void EditorNavigationMeshGenerator::clear(Ref<NavigationMesh> p_nav_mesh) {
 	if (p_nav_mesh.is_valid()) {
 		p_nav_mesh->clear_polygons();
 		p_nav_mesh->set_vertices(PoolVector<Vector3>());
+		bake_cache.erase(p_nav_mesh->get_instance_id());
 	}
 }
 
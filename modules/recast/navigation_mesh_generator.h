@@ -31,6 +31,7 @@
 #ifndef NAVIGATION_MESH_GENERATOR_H
 #define NAVIGATION_MESH_GENERATOR_H
 
+#include "core/map.h"
 #include "editor/editor_node.h"
 #include "scene/3d/navigation_mesh.h"
 
@@ -49,10 +50,55 @@ protected:
 	static void _add_faces(const PoolVector3Array &p_faces, const Transform &p_xform, Vector<float> &p_verticies, Vector<int> &p_indices);
 	static void _parse_geometry(Transform p_accumulated_transform, Node *p_node, Vector<float> &p_verticies, Vector<int> &p_indices, int p_generate_from, uint32_t p_collision_mask, bool p_recurse_children);
 
-	static void _convert_detail_mesh_to_native_navigation_mesh(const rcPolyMeshDetail *p_detail_mesh, Ref<NavigationMesh> p_nav_mesh);
-	static void _build_recast_navigation_mesh(Ref<NavigationMesh> p_nav_mesh, EditorProgress *ep,
-			rcHeightfield *hf, rcCompactHeightfield *chf, rcContourSet *cset, rcPolyMesh *poly_mesh,
-			rcPolyMeshDetail *detail_mesh, Vector<float> &vertices, Vector<int> &indices);
+	// Tiled baking: the geometry bounds are split into square tiles on the XZ
+	// plane, each tile runs the Recast pipeline independently (so tiles can be
+	// baked on worker threads) and the results are merged into the navmesh.
+	// Baked tiles are cached per navmesh, keyed by a hash of the overlapping
+	// geometry, so a rebake only rebuilds the tiles whose inputs changed.
+	enum {
+		TILE_SIZE_CELLS = 64
+	};
+
+	struct BakedTile {
+		uint32_t hash;
+		Vector<Vector3> vertices;
+		Vector<int> triangles; // Three indices per triangle, local to the tile.
+		BakedTile() { hash = 0; }
+	};
+
+	struct TileCache {
+		uint32_t config_hash;
+		int tiles_x;
+		int tiles_z;
+		Vector3 bmin;
+		Vector<BakedTile> tiles;
+		TileCache() {
+			config_hash = 0;
+			tiles_x = 0;
+			tiles_z = 0;
+		}
+	};
+
+	struct TileBakeState {
+		NavigationMesh *nav_mesh;
+		const float *verts;
+		int nverts;
+		const Vector<int> *tile_indices; // Triangle indices overlapping each tile.
+		const int *dirty_tiles;
+		BakedTile *tiles;
+		float bmin[3];
+		float bmax[3];
+		float tile_world;
+		int tiles_x;
+	};
+
+	static Map<ObjectID, TileCache> bake_cache;
+
+	static uint32_t _hash_bake_config(Ref<NavigationMesh> p_nav_mesh);
+	static void _convert_detail_mesh_to_tile(const rcPolyMeshDetail *p_detail_mesh, BakedTile *r_tile);
+	static void _bake_tile(TileBakeState *p_state, int p_dirty_index);
+	static void _bake_tile_task(void *p_userdata, uint32_t p_index);
+	static void _bake_tiled(Ref<NavigationMesh> p_nav_mesh, EditorProgress *ep, Vector<float> &vertices, Vector<int> &indices);
 
 public:
 	static EditorNavigationMeshGenerator *get_singleton();
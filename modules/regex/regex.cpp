@@ -30,6 +30,8 @@
 
 #include "regex.h"
 #include "core/os/memory.h"
+#include "core/os/mutex.h"
+#include "core/os/worker_thread_pool.h"
 
 extern "C" {
 #include <pcre2.h>
@@ -45,6 +47,115 @@ static void _regex_free(void *ptr, void *user) {
 	memfree(ptr);
 }
 
+// Compiled patterns are shared across RegEx instances through a global cache
+// keyed by pattern string, so reloading the same RegEx resource or creating
+// many instances of a common pattern compiles it once. Cached codes are freed
+// on eviction (only when unused) or at module cleanup.
+
+struct _RegExCacheEntry {
+
+	void *code;
+	int users;
+};
+
+static Map<String, _RegExCacheEntry> *regex_cache = NULL;
+static Mutex *regex_cache_mutex = NULL;
+
+static const int REGEX_CACHE_MAX_ENTRIES = 64;
+
+static void _regex_code_free(void *p_code) {
+
+	if (sizeof(CharType) == 2) {
+		pcre2_code_free_16((pcre2_code_16 *)p_code);
+	} else {
+		pcre2_code_free_32((pcre2_code_32 *)p_code);
+	}
+}
+
+static void *_regex_cache_acquire(const String &p_pattern) {
+
+	if (!regex_cache)
+		return NULL;
+
+	MutexLock lock(regex_cache_mutex);
+
+	Map<String, _RegExCacheEntry>::Element *E = regex_cache->find(p_pattern);
+	if (!E)
+		return NULL;
+
+	E->get().users++;
+	return E->get().code;
+}
+
+static void _regex_cache_insert(const String &p_pattern, void *p_code) {
+
+	if (!regex_cache)
+		return;
+
+	MutexLock lock(regex_cache_mutex);
+
+	if (regex_cache->has(p_pattern))
+		return; //another thread compiled it meanwhile; the caller keeps sole ownership of its copy
+
+	if (regex_cache->size() >= REGEX_CACHE_MAX_ENTRIES) {
+		//evict everything nobody holds anymore
+		Map<String, _RegExCacheEntry>::Element *E = regex_cache->front();
+		while (E) {
+			Map<String, _RegExCacheEntry>::Element *N = E->next();
+			if (E->get().users == 0) {
+				_regex_code_free(E->get().code);
+				regex_cache->erase(E);
+			}
+			E = N;
+		}
+	}
+
+	_RegExCacheEntry entry;
+	entry.code = p_code;
+	entry.users = 1;
+	regex_cache->insert(p_pattern, entry);
+}
+
+static bool _regex_cache_release(const String &p_pattern, void *p_code) {
+
+	if (!regex_cache)
+		return false;
+
+	MutexLock lock(regex_cache_mutex);
+
+	Map<String, _RegExCacheEntry>::Element *E = regex_cache->find(p_pattern);
+	if (!E || E->get().code != p_code)
+		return false; //not cache owned, the caller frees
+
+	E->get().users--;
+	return true;
+}
+
+void RegEx::initialize_cache() {
+
+	regex_cache = memnew((Map<String, _RegExCacheEntry>));
+	regex_cache_mutex = Mutex::create();
+}
+
+void RegEx::finalize_cache() {
+
+	if (regex_cache) {
+		for (Map<String, _RegExCacheEntry>::Element *E = regex_cache->front(); E; E = E->next()) {
+			//entries still held by a live RegEx are freed by its clear(), which
+			//finds the cache gone and takes ownership
+			if (E->get().users == 0) {
+				_regex_code_free(E->get().code);
+			}
+		}
+		memdelete(regex_cache);
+		regex_cache = NULL;
+	}
+	if (regex_cache_mutex) {
+		memdelete(regex_cache_mutex);
+		regex_cache_mutex = NULL;
+	}
+}
+
 int RegExMatch::_find(const Variant &p_name) const {
 
 	if (p_name.is_num()) {
@@ -176,26 +287,24 @@ void RegEx::_pattern_info(uint32_t what, void *where) const {
 
 void RegEx::clear() {
 
-	if (sizeof(CharType) == 2) {
-
-		if (code) {
-			pcre2_code_free_16((pcre2_code_16 *)code);
-			code = NULL;
-		}
+	if (!code)
+		return;
 
-	} else {
-
-		if (code) {
-			pcre2_code_free_32((pcre2_code_32 *)code);
-			code = NULL;
-		}
+	if (!_regex_cache_release(pattern, code)) {
+		//not (or no longer) owned by the cache
+		_regex_code_free(code);
 	}
+	code = NULL;
 }
 
 Error RegEx::compile(const String &p_pattern) {
 
+	clear(); //releases under the old pattern
 	pattern = p_pattern;
-	clear();
+
+	code = _regex_cache_acquire(pattern);
+	if (code)
+		return OK;
 
 	int err;
 	PCRE2_SIZE offset;
@@ -219,6 +328,9 @@ Error RegEx::compile(const String &p_pattern) {
 			return FAILED;
 		}
 
+		//best effort; matching falls back to the interpreter when JIT is unsupported
+		pcre2_jit_compile_16((pcre2_code_16 *)code, PCRE2_JIT_COMPLETE);
+
 	} else {
 
 		pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
@@ -236,7 +348,12 @@ Error RegEx::compile(const String &p_pattern) {
 			ERR_PRINT(message.utf8());
 			return FAILED;
 		}
+
+		pcre2_jit_compile_32((pcre2_code_32 *)code, PCRE2_JIT_COMPLETE);
 	}
+
+	_regex_cache_insert(pattern, code);
+
 	return OK;
 }
 
@@ -353,6 +470,64 @@ Array RegEx::search_all(const String &p_subject, int p_offset, int p_end) const
 	return result;
 }
 
+struct _RegExBatchTask {
+
+	const RegEx *regex;
+	const String *subjects;
+	Array *results;
+	int offset;
+	int end;
+};
+
+static void _search_all_batch_task(void *p_userdata, uint32_t p_index) {
+
+	_RegExBatchTask *task = (_RegExBatchTask *)p_userdata;
+	task->results[p_index] = task->regex->search_all(task->subjects[p_index], task->offset, task->end);
+}
+
+Array RegEx::search_all_batch(const Array &p_subjects, int p_offset, int p_end) const {
+
+	ERR_FAIL_COND_V(!is_valid(), Array());
+
+	int count = p_subjects.size();
+
+	Vector<String> subjects;
+	subjects.resize(count);
+	for (int i = 0; i < count; i++) {
+		subjects.write[i] = p_subjects[i];
+	}
+
+	Vector<Array> results;
+	results.resize(count);
+
+	_RegExBatchTask task;
+	task.regex = this;
+	task.subjects = subjects.ptr();
+	task.results = results.ptrw();
+	task.offset = p_offset;
+	task.end = p_end;
+
+	//subjects are independent and the compiled code is read-only at match
+	//time, so they can distribute over the worker pool
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (pool && count > 1 && pool->get_thread_count() > 0) {
+		WorkerThreadPool::GroupID group = pool->add_group_task(_search_all_batch_task, &task, count);
+		pool->wait_for_group_task_completion(group);
+	} else {
+		for (int i = 0; i < count; i++) {
+			_search_all_batch_task(&task, i);
+		}
+	}
+
+	Array result;
+	result.resize(count);
+	for (int i = 0; i < count; i++) {
+		result[i] = results[i];
+	}
+
+	return result;
+}
+
 String RegEx::sub(const String &p_subject, const String &p_replacement, bool p_all, int p_offset, int p_end) const {
 
 	ERR_FAIL_COND_V(!is_valid(), String());
@@ -504,16 +679,14 @@ RegEx::RegEx(const String &p_pattern) {
 
 RegEx::~RegEx() {
 
+	clear(); //the compiled code may be owned by the cache
+
 	if (sizeof(CharType) == 2) {
 
-		if (code)
-			pcre2_code_free_16((pcre2_code_16 *)code);
 		pcre2_general_context_free_16((pcre2_general_context_16 *)general_ctx);
 
 	} else {
 
-		if (code)
-			pcre2_code_free_32((pcre2_code_32 *)code);
 		pcre2_general_context_free_32((pcre2_general_context_32 *)general_ctx);
 	}
 }
@@ -524,6 +697,7 @@ void RegEx::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("compile", "pattern"), &RegEx::compile);
 	ClassDB::bind_method(D_METHOD("search", "subject", "offset", "end"), &RegEx::search, DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("search_all", "subject", "offset", "end"), &RegEx::search_all, DEFVAL(0), DEFVAL(-1));
+	ClassDB::bind_method(D_METHOD("search_all_batch", "subjects", "offset", "end"), &RegEx::search_all_batch, DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("sub", "subject", "replacement", "all", "offset", "end"), &RegEx::sub, DEFVAL(false), DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("is_valid"), &RegEx::is_valid);
 	ClassDB::bind_method(D_METHOD("get_pattern"), &RegEx::get_pattern);
@@ -89,6 +89,7 @@ public:
 
 	Ref<RegExMatch> search(const String &p_subject, int p_offset = 0, int p_end = -1) const;
 	Array search_all(const String &p_subject, int p_offset = 0, int p_end = -1) const;
+	Array search_all_batch(const Array &p_subjects, int p_offset = 0, int p_end = -1) const;
 	String sub(const String &p_subject, const String &p_replacement, bool p_all = false, int p_offset = 0, int p_end = -1) const;
 
 	bool is_valid() const;
@@ -96,6 +97,9 @@ public:
 	int get_group_count() const;
 	Array get_names() const;
 
+	static void initialize_cache();
+	static void finalize_cache();
+
 	RegEx();
 	RegEx(const String &p_pattern);
 	~RegEx();
@@ -34,9 +34,13 @@
 
 void register_regex_types() {
 
+	RegEx::initialize_cache();
+
 	ClassDB::register_class<RegExMatch>();
 	ClassDB::register_class<RegEx>();
 }
 
 void unregister_regex_types() {
+
+	RegEx::finalize_cache();
 }
@@ -30,8 +30,55 @@
 
 #include "image_compress_squish.h"
 
+#include "core/os/worker_thread_pool.h"
+
 #include <squish.h>
 
+// DXT blocks are independent, so each mip level is split into bands of block
+// rows and (de)compressed on all cores. Bands are multiples of 4 pixel rows,
+// matching the block grid, and their offsets into the block buffer follow
+// from the rows already emitted above them.
+struct SquishBandTask {
+	const squish::u8 *rgba; //source for compression, destination for decompression
+	squish::u8 *blocks;
+	int width;
+	int height;
+	int band_rows;
+	int flags;
+	bool decompress;
+};
+
+static const int SQUISH_BAND_ROWS = 64;
+
+static void _squish_process_band(void *p_userdata, uint32_t p_index) {
+
+	SquishBandTask *task = (SquishBandTask *)p_userdata;
+	int y = p_index * task->band_rows;
+	int rows = MIN(task->band_rows, task->height - y);
+	squish::u8 *block_ofs = task->blocks + squish::GetStorageRequirements(task->width, y, task->flags);
+
+	if (task->decompress) {
+		squish::DecompressImage((squish::u8 *)task->rgba + y * task->width * 4, task->width, rows, block_ofs, task->flags);
+	} else {
+		squish::CompressImage(task->rgba + y * task->width * 4, task->width, rows, block_ofs, task->flags);
+	}
+}
+
+static void _squish_run_banded(SquishBandTask &p_task) {
+
+	int bands = (p_task.height + p_task.band_rows - 1) / p_task.band_rows;
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+
+	if (pool && bands > 1) {
+		WorkerThreadPool::GroupID group = pool->add_group_task(_squish_process_band, &p_task, bands);
+		pool->wait_for_group_task_completion(group);
+	} else {
+		for (int i = 0; i < bands; i++) {
+			_squish_process_band(&p_task, i);
+		}
+	}
+}
+
 void image_decompress_squish(Image *p_image) {
 	int w = p_image->get_width();
 	int h = p_image->get_height();
@@ -65,7 +112,17 @@ void image_decompress_squish(Image *p_image) {
 		int src_ofs = 0, mipmap_size = 0, mipmap_w = 0, mipmap_h = 0;
 		p_image->get_mipmap_offset_size_and_dimensions(i, src_ofs, mipmap_size, mipmap_w, mipmap_h);
 		int dst_ofs = Image::get_image_mipmap_offset(p_image->get_width(), p_image->get_height(), target_format, i);
-		squish::DecompressImage(&wb[dst_ofs], w, h, &rb[src_ofs], squish_flags);
+
+		SquishBandTask task;
+		task.rgba = &wb[dst_ofs];
+		task.blocks = (squish::u8 *)&rb[src_ofs];
+		task.width = w;
+		task.height = h;
+		task.band_rows = SQUISH_BAND_ROWS;
+		task.flags = squish_flags;
+		task.decompress = true;
+		_squish_run_banded(task);
+
 		w >>= 1;
 		h >>= 1;
 	}
@@ -190,7 +247,17 @@ void image_compress_squish(Image *p_image, float p_lossy_quality, Image::Compres
 			int bh = h % 4 != 0 ? h + (4 - h % 4) : h;
 
 			int src_ofs = p_image->get_mipmap_offset(i);
-			squish::CompressImage(&rb[src_ofs], w, h, &wb[dst_ofs], squish_comp);
+
+			SquishBandTask task;
+			task.rgba = &rb[src_ofs];
+			task.blocks = &wb[dst_ofs];
+			task.width = w;
+			task.height = h;
+			task.band_rows = SQUISH_BAND_ROWS;
+			task.flags = squish_comp;
+			task.decompress = false;
+			_squish_run_banded(task);
+
 			dst_ofs += (MAX(4, bw) * MAX(4, bh)) >> shift;
 			w = MAX(w / 2, 1);
 			h = MAX(h / 2, 1);
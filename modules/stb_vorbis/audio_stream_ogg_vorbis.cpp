@@ -59,7 +59,28 @@ void AudioStreamPlaybackOGGVorbis::_mix_internal(AudioFrame *p_buffer, int p_fra
 			//end of file!
 			if (vorbis_stream->loop) {
 				//loop
-				seek(vorbis_stream->loop_offset);
+				float loop_time = vorbis_stream->loop_offset;
+				if (loop_time >= vorbis_stream->get_length()) {
+					loop_time = 0;
+				}
+				uint32_t loop_target = uint32_t(vorbis_stream->sample_rate * loop_time);
+
+				if (loop_stream && loop_primed && loop_frame == loop_target) {
+					//swap in the decoder primed at the loop point and have
+					//the spare one reprimed in the background
+					SWAP(ogg_stream, loop_stream);
+					SWAP(ogg_alloc, loop_alloc);
+					frames_mixed = loop_target;
+					loop_primed = 0;
+					_request_loop_prime(loop_target);
+				} else {
+					seek(vorbis_stream->loop_offset);
+					if (loop_stream && loop_primed && loop_frame != loop_target) {
+						//loop offset changed since the spare was primed
+						loop_primed = 0;
+						_request_loop_prime(loop_target);
+					}
+				}
 				loops++;
 				// we still have buffer to fill, start from this element in the next iteration.
 				start_buffer = p_frames - todo;
@@ -79,6 +100,31 @@ float AudioStreamPlaybackOGGVorbis::get_stream_sampling_rate() {
 	return vorbis_stream->sample_rate;
 }
 
+void AudioStreamPlaybackOGGVorbis::_prime_loop_task(void *p_userdata) {
+
+	AudioStreamPlaybackOGGVorbis *ovs = (AudioStreamPlaybackOGGVorbis *)p_userdata;
+	stb_vorbis_seek(ovs->loop_stream, ovs->loop_frame);
+	atomic_increment(&ovs->loop_primed); //publish after the seek
+}
+
+void AudioStreamPlaybackOGGVorbis::_request_loop_prime(uint32_t p_frame) {
+
+	loop_frame = p_frame;
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (pool) {
+		if (prime_task_pending) {
+			//the previous prime already finished (the swap only happens once
+			//primed), this just reclaims the task
+			pool->wait_for_task_completion(prime_task);
+		}
+		prime_task = pool->add_task(_prime_loop_task, this);
+		prime_task_pending = true;
+	} else {
+		_prime_loop_task(this);
+	}
+}
+
 void AudioStreamPlaybackOGGVorbis::start(float p_from_pos) {
 
 	active = true;
@@ -119,6 +165,13 @@ void AudioStreamPlaybackOGGVorbis::seek(float p_time) {
 }
 
 AudioStreamPlaybackOGGVorbis::~AudioStreamPlaybackOGGVorbis() {
+	if (prime_task_pending) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(prime_task);
+	}
+	if (loop_alloc.alloc_buffer) {
+		stb_vorbis_close(loop_stream);
+		AudioServer::get_singleton()->audio_data_free(loop_alloc.alloc_buffer);
+	}
 	if (ogg_alloc.alloc_buffer) {
 		stb_vorbis_close(ogg_stream);
 		AudioServer::get_singleton()->audio_data_free(ogg_alloc.alloc_buffer);
@@ -147,6 +200,26 @@ Ref<AudioStreamPlayback> AudioStreamOGGVorbis::instance_playback() {
 		ERR_FAIL_COND_V(!ovs->ogg_stream, Ref<AudioStreamPlaybackOGGVorbis>());
 	}
 
+	if (loop) {
+		//prime a spare decoder at the loop point, so loop restarts do not
+		//have to bisect the whole file on the mix thread
+		ovs->loop_alloc.alloc_buffer = (char *)AudioServer::get_singleton()->audio_data_alloc(decode_mem_size);
+		ovs->loop_alloc.alloc_buffer_length_in_bytes = decode_mem_size;
+		ovs->loop_stream = stb_vorbis_open_memory((const unsigned char *)data, data_len, &error, &ovs->loop_alloc);
+		if (!ovs->loop_stream) {
+			AudioServer::get_singleton()->audio_data_free(ovs->loop_alloc.alloc_buffer);
+			ovs->loop_alloc.alloc_buffer = NULL;
+		} else {
+			float loop_time = loop_offset;
+			if (loop_time >= length) {
+				loop_time = 0;
+			}
+			ovs->loop_frame = uint32_t(sample_rate * loop_time);
+			stb_vorbis_seek(ovs->loop_stream, ovs->loop_frame);
+			ovs->loop_primed = 1;
+		}
+	}
+
 	return ovs;
 }
 
@@ -32,6 +32,7 @@
 #define AUDIO_STREAM_STB_VORBIS_H
 
 #include "core/io/resource_loader.h"
+#include "core/os/worker_thread_pool.h"
 #include "servers/audio/audio_stream.h"
 
 #include "thirdparty/misc/stb_vorbis.h"
@@ -48,6 +49,19 @@ class AudioStreamPlaybackOGGVorbis : public AudioStreamPlaybackResampled {
 	bool active;
 	int loops;
 
+	//Second decoder kept seeked ("primed") at the loop point by a worker
+	//thread task, so a loop restart is a pointer swap instead of a
+	//bisection seek on the mix thread.
+	stb_vorbis *loop_stream;
+	stb_vorbis_alloc loop_alloc;
+	uint32_t loop_frame;
+	volatile uint32_t loop_primed;
+	WorkerThreadPool::TaskID prime_task;
+	bool prime_task_pending;
+
+	void _request_loop_prime(uint32_t p_frame);
+	static void _prime_loop_task(void *p_userdata);
+
 	friend class AudioStreamOGGVorbis;
 
 	Ref<AudioStreamOGGVorbis> vorbis_stream;
@@ -66,7 +80,15 @@ public:
 	virtual float get_playback_position() const;
 	virtual void seek(float p_time);
 
-	AudioStreamPlaybackOGGVorbis() {}
+	AudioStreamPlaybackOGGVorbis() {
+		loop_stream = NULL;
+		loop_alloc.alloc_buffer = NULL;
+		loop_alloc.alloc_buffer_length_in_bytes = 0;
+		loop_frame = 0;
+		loop_primed = 0;
+		prime_task = 0;
+		prime_task_pending = false;
+	}
 	~AudioStreamPlaybackOGGVorbis();
 };
 
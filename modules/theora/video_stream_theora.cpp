@@ -84,10 +84,12 @@ void VideoStreamPlaybackTheora::video_write(void) {
 	th_ycbcr_buffer yuv;
 	th_decode_ycbcr_out(td, yuv);
 
+	DecodedFrame &frame = frame_queue[frames_decoded % MAX_FRAMES];
+
 	int pitch = 4;
-	frame_data.resize(size.x * size.y * pitch);
+	frame.data.resize(size.x * size.y * pitch);
 	{
-		PoolVector<uint8_t>::Write w = frame_data.write();
+		PoolVector<uint8_t>::Write w = frame.data.write();
 		char *dst = (char *)w.ptr();
 
 		//uv_offset=(ti.pic_x/2)+(yuv[1].stride)*(ti.pic_y/2);
@@ -108,11 +110,8 @@ void VideoStreamPlaybackTheora::video_write(void) {
 		format = Image::FORMAT_RGBA8;
 	}
 
-	Ref<Image> img = memnew(Image(size.x, size.y, 0, Image::FORMAT_RGBA8, frame_data)); //zero copy image creation
-
-	texture->set_data(img); //zero copy send to visual server
-
-	frames_pending = 1;
+	frame.time = videobuf_time;
+	frames_decoded++; //publish only after the slot is fully written
 }
 
 void VideoStreamPlaybackTheora::clear() {
@@ -120,6 +119,15 @@ void VideoStreamPlaybackTheora::clear() {
 	if (!file)
 		return;
 
+	if (decode_thread) {
+		//stop the decoder before tearing down any codec state it may be using
+		decode_exit = true;
+		decode_sem->post(); //just in case
+		Thread::wait_to_finish(decode_thread);
+		memdelete(decode_thread);
+		decode_thread = NULL;
+	}
+
 	if (vorbis_p) {
 		ogg_stream_clear(&vo);
 		if (vorbis_p >= 3) {
@@ -151,7 +159,8 @@ void VideoStreamPlaybackTheora::clear() {
 	theora_p = 0;
 	vorbis_p = 0;
 	videobuf_ready = 0;
-	frames_pending = 0;
+	frames_decoded = 0;
+	frames_presented = 0;
 	videobuf_time = 0;
 	theora_eos = false;
 	vorbis_eos = false;
@@ -360,6 +369,14 @@ void VideoStreamPlaybackTheora::set_file(const String &p_file) {
 	buffering = true;
 	time = 0;
 	audio_frames_wrote = 0;
+
+	if (theora_p) {
+		decode_exit = false;
+		decode_done = false;
+		frames_decoded = 0;
+		frames_presented = 0;
+		decode_thread = Thread::create(_decoding_thread, this);
+	}
 };
 
 float VideoStreamPlaybackTheora::get_time() const {
@@ -388,10 +405,34 @@ void VideoStreamPlaybackTheora::update(float p_delta) {
 
 	time += p_delta;
 
-	if (videobuf_time > get_time()) {
-		return; //no new frames need to be produced
+	//frames are produced ahead of time by the decode thread; find the newest
+	//one that is already due, drop the ones it superseded
+	int due = 0;
+	while (frames_decoded - frames_presented > uint64_t(due) && frame_queue[(frames_presented + due) % MAX_FRAMES].time <= get_time()) {
+		due++;
 	}
 
+	if (due > 0) {
+		DecodedFrame &frame = frame_queue[(frames_presented + due - 1) % MAX_FRAMES];
+
+		Ref<Image> img = memnew(Image(size.x, size.y, 0, Image::FORMAT_RGBA8, frame.data)); //zero copy image creation
+
+		texture->set_data(img); //zero copy send to visual server
+
+		frames_presented += due;
+	}
+
+	if (decode_done && frames_decoded == frames_presented) {
+		//printf("video done, stopping\n");
+		stop();
+		return;
+	}
+
+	decode_sem->post(); //queue slots may have freed up, keep the decoder going
+};
+
+void VideoStreamPlaybackTheora::_decode_frame() {
+
 	bool frame_done = false;
 	bool audio_done = !vorbis_p;
 
@@ -511,8 +552,8 @@ void VideoStreamPlaybackTheora::update(float p_delta) {
 #else
 		if (file && /*!videobuf_ready && */ no_theora && theora_eos) {
 #endif
-			//printf("video done, stopping\n");
-			stop();
+			//end of stream; update() stops playback once the queue drains
+			decode_done = true;
 			return;
 		};
 
@@ -668,6 +709,21 @@ void VideoStreamPlaybackTheora::_streaming_thread(void *ud) {
 
 #endif
 
+void VideoStreamPlaybackTheora::_decoding_thread(void *ud) {
+
+	VideoStreamPlaybackTheora *vs = (VideoStreamPlaybackTheora *)ud;
+
+	while (!vs->decode_exit) {
+
+		if (vs->playing && !vs->paused && !vs->decode_done && vs->frames_decoded - vs->frames_presented < MAX_FRAMES) {
+			vs->_decode_frame();
+		} else {
+			//queue full, paused or not playing; update() posts when there is work again
+			vs->decode_sem->wait();
+		}
+	}
+}
+
 VideoStreamPlaybackTheora::VideoStreamPlaybackTheora() {
 
 	file = NULL;
@@ -675,10 +731,16 @@ VideoStreamPlaybackTheora::VideoStreamPlaybackTheora() {
 	vorbis_p = 0;
 	videobuf_ready = 0;
 	playing = false;
-	frames_pending = 0;
+	frames_decoded = 0;
+	frames_presented = 0;
 	videobuf_time = 0;
 	paused = false;
 
+	decode_sem = Semaphore::create();
+	decode_thread = NULL;
+	decode_exit = false;
+	decode_done = false;
+
 	buffering = false;
 	texture = Ref<ImageTexture>(memnew(ImageTexture));
 	mix_callback = NULL;
@@ -707,6 +769,8 @@ VideoStreamPlaybackTheora::~VideoStreamPlaybackTheora() {
 #endif
 	clear();
 
+	memdelete(decode_sem);
+
 	if (file)
 		memdelete(file);
 };
@@ -52,10 +52,16 @@ class VideoStreamPlaybackTheora : public VideoStreamPlayback {
 		MAX_FRAMES = 4,
 	};
 
-	//Image frames[MAX_FRAMES];
+	struct DecodedFrame {
+		PoolVector<uint8_t> data;
+		double time;
+	};
+
+	DecodedFrame frame_queue[MAX_FRAMES]; //filled by the decode thread, presented in update()
+	volatile uint64_t frames_decoded;
+	volatile uint64_t frames_presented;
+
 	Image::Format format;
-	PoolVector<uint8_t> frame_data;
-	int frames_pending;
 	FileAccess *file;
 	String file_name;
 	int audio_frames_wrote;
@@ -103,6 +109,14 @@ class VideoStreamPlaybackTheora : public VideoStreamPlayback {
 	void *mix_udata;
 	bool paused;
 
+	Semaphore *decode_sem;
+	Thread *decode_thread;
+	volatile bool decode_exit;
+	volatile bool decode_done; //end of stream was reached while decoding
+
+	static void _decoding_thread(void *ud);
+	void _decode_frame();
+
 #ifdef THEORA_USE_THREAD_STREAMING
 
 	enum {
@@ -72,6 +72,34 @@ void WSLPeer::_wsl_destroy(struct PeerData **p_data) {
 	*p_data = NULL;
 }
 
+// Frames staged by wsl_send_callback are written out here in a single
+// put_partial_data() call, so many small messages don't each pay a socket write.
+static Error _wsl_flush_staged(struct WSLPeer::PeerData *p_data) {
+	if (p_data->out_pos == 0 || !p_data->valid)
+		return OK;
+
+	Ref<StreamPeer> conn = p_data->conn;
+	int total = p_data->out_pos;
+	int ofs = 0;
+	while (ofs < total) {
+		int sent = 0;
+		Error err = conn->put_partial_data(p_data->out_buf.ptr() + ofs, total - ofs, sent);
+		if (err != OK) {
+			p_data->out_pos = 0;
+			return err;
+		}
+		if (sent == 0)
+			break; // Backpressure, keep the rest staged
+		ofs += sent;
+	}
+
+	if (ofs > 0 && ofs < total) {
+		movemem(p_data->out_buf.ptrw(), p_data->out_buf.ptr() + ofs, total - ofs);
+	}
+	p_data->out_pos = total - ofs;
+	return OK;
+}
+
 bool WSLPeer::_wsl_poll(struct PeerData *p_data) {
 	p_data->polling = true;
 	int err = 0;
@@ -79,6 +107,10 @@ bool WSLPeer::_wsl_poll(struct PeerData *p_data) {
 		print_verbose("Websocket (wslay) poll error: " + itos(err));
 		p_data->destroy = true;
 	}
+	if (!p_data->destroy && _wsl_flush_staged(p_data) != OK) {
+		print_verbose("Websocket flush error");
+		p_data->destroy = true;
+	}
 	p_data->polling = false;
 
 	if (p_data->destroy || (wslay_event_get_close_sent(p_data->ctx) && wslay_event_get_close_received(p_data->ctx))) {
@@ -116,18 +148,49 @@ ssize_t wsl_send_callback(wslay_event_context_ptr ctx, const uint8_t *data, size
 		wslay_event_set_error(ctx, WSLAY_ERR_CALLBACK_FAILURE);
 		return -1;
 	}
-	Ref<StreamPeer> conn = peer_data->conn;
-	int sent = 0;
-	Error err = conn->put_partial_data(data, len, sent);
-	if (err != OK) {
-		wslay_event_set_error(ctx, WSLAY_ERR_CALLBACK_FAILURE);
-		return -1;
+
+	if ((int)len > peer_data->out_buf.size()) {
+		// Frame bigger than the whole staging buffer, write it straight out
+		// (after anything already staged, to keep frame ordering).
+		if (_wsl_flush_staged(peer_data) != OK) {
+			wslay_event_set_error(ctx, WSLAY_ERR_CALLBACK_FAILURE);
+			return -1;
+		}
+		if (peer_data->out_pos > 0) {
+			wslay_event_set_error(ctx, WSLAY_ERR_WOULDBLOCK);
+			return -1;
+		}
+		Ref<StreamPeer> conn = peer_data->conn;
+		int sent = 0;
+		Error err = conn->put_partial_data(data, len, sent);
+		if (err != OK) {
+			wslay_event_set_error(ctx, WSLAY_ERR_CALLBACK_FAILURE);
+			return -1;
+		}
+		if (sent == 0) {
+			wslay_event_set_error(ctx, WSLAY_ERR_WOULDBLOCK);
+			return -1;
+		}
+		return sent;
 	}
-	if (sent == 0) {
-		wslay_event_set_error(ctx, WSLAY_ERR_WOULDBLOCK);
-		return -1;
+
+	// Stage the frame instead of writing it out; consecutive frames coalesce
+	// into a single socket write on flush.
+	if (peer_data->out_buf.size() - peer_data->out_pos < (int)len) {
+		// Try to make room first
+		if (_wsl_flush_staged(peer_data) != OK) {
+			wslay_event_set_error(ctx, WSLAY_ERR_CALLBACK_FAILURE);
+			return -1;
+		}
+		if (peer_data->out_buf.size() - peer_data->out_pos < (int)len) {
+			wslay_event_set_error(ctx, WSLAY_ERR_WOULDBLOCK);
+			return -1;
+		}
 	}
-	return sent;
+
+	copymem(peer_data->out_buf.ptrw() + peer_data->out_pos, data, len);
+	peer_data->out_pos += len;
+	return len;
 }
 
 int wsl_genmask_callback(wslay_event_context_ptr ctx, uint8_t *buf, size_t len, void *user_data) {
@@ -204,6 +267,8 @@ void WSLPeer::make_context(PeerData *p_data, unsigned int p_in_buf_size, unsigne
 
 	_in_buffer.resize(p_in_pkt_size, p_in_buf_size);
 	_packet_buffer.resize((1 << MAX(p_in_buf_size, p_out_buf_size)));
+	p_data->out_buf.resize(1 << p_out_buf_size);
+	p_data->out_pos = 0;
 
 	_data = p_data;
 	_data->peer = this;
@@ -297,6 +362,7 @@ void WSLPeer::close(int p_code, String p_reason) {
 		CharString cs = p_reason.utf8();
 		wslay_event_queue_close(_data->ctx, p_code, (uint8_t *)cs.ptr(), cs.size());
 		wslay_event_send(_data->ctx);
+		_wsl_flush_staged(_data); // The close frame should not wait for the next poll
 		_data->closing = true;
 	}
 
@@ -60,8 +60,11 @@ public:
 		Ref<StreamPeerTCP> tcp;
 		int id;
 		wslay_event_context_ptr ctx;
+		Vector<uint8_t> out_buf; // Serialized frames staged here, flushed as one write per poll
+		int out_pos;
 
 		PeerData() {
+			out_pos = 0;
 			polling = false;
 			destroy = false;
 			valid = false;
@@ -196,6 +196,32 @@ PoolByteArray HTTPClient::read_response_body_chunk() {
 	return chunk;
 }
 
+Error HTTPClient::read_response_body_stream(ReadBodyChunkCallback p_callback, void *p_userdata, int &r_size) {
+
+	ERR_FAIL_COND_V(status != STATUS_BODY, ERR_UNCONFIGURED);
+
+	int to_read = MIN(read_limit, polled_response.size() - response_read_offset);
+	r_size = to_read;
+
+	if (to_read > 0) {
+		// Hand out a view into the XHR response buffer, no intermediate copy
+		PoolByteArray::Read read = polled_response.read();
+		Error cb_err = p_callback(p_userdata, read.ptr() + response_read_offset, to_read);
+		if (cb_err != OK) {
+			return cb_err;
+		}
+		response_read_offset += to_read;
+	}
+
+	if (response_read_offset == polled_response.size()) {
+		status = STATUS_CONNECTED;
+		polled_response.resize(0);
+		godot_xhr_reset(xhr_id);
+	}
+
+	return OK;
+}
+
 void HTTPClient::set_blocking_mode(bool p_enable) {
 
 	ERR_FAIL_COND_MSG(p_enable, "HTTPClient blocking mode is not supported for the HTML5 platform.");
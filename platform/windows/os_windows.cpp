@@ -3256,6 +3256,39 @@ String OS_Windows::get_user_data_dir() const {
 	return ProjectSettings::get_singleton()->get_resource_path();
 }
 
+const uint8_t *OS_Windows::map_file(const String &p_path, uint64_t &r_size) {
+
+	String path = p_path.replace("/", "\\");
+	HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return NULL;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+		CloseHandle(file);
+		return NULL;
+	}
+
+	HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file); // The mapping keeps its own reference to the file.
+	if (!mapping)
+		return NULL;
+
+	void *base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping); // The view keeps its own reference to the mapping.
+	if (!base)
+		return NULL;
+
+	r_size = size.QuadPart;
+	return (const uint8_t *)base;
+}
+
+void OS_Windows::unmap_file(const uint8_t *p_base, uint64_t p_size) {
+
+	if (p_base)
+		UnmapViewOfFile((void *)p_base);
+}
+
 String OS_Windows::get_unique_id() const {
 
 	HW_PROFILE_INFO HwProfInfo;
@@ -432,6 +432,9 @@ public:
 
 	virtual Error move_to_trash(const String &p_path);
 
+	virtual const uint8_t *map_file(const String &p_path, uint64_t &r_size);
+	virtual void unmap_file(const uint8_t *p_base, uint64_t p_size);
+
 	virtual void process_and_drop_events();
 
 	OS_Windows(HINSTANCE _hInstance);
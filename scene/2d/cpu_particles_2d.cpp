@@ -30,6 +30,7 @@
 
 #include "cpu_particles_2d.h"
 
+#include "core/os/worker_thread_pool.h"
 #include "scene/2d/canvas_item.h"
 #include "scene/2d/particles_2d.h"
 #include "scene/resources/particles_material.h"
@@ -598,6 +599,20 @@ void CPUParticles2D::_update_internal() {
 	_update_particle_data_buffer();
 }
 
+struct CPUParticles2DChunkData {
+
+	CPUParticles2D *particles;
+	void *parray; //CPUParticles2D::Particle is private, cast back in the task
+	int chunk_size;
+	int pcount;
+	float delta;
+	float prev_time;
+	float system_phase;
+	Transform2D emission_xform;
+	Transform2D velocity_xform;
+	uint64_t seed_base;
+};
+
 void CPUParticles2D::_particles_process(float p_delta) {
 
 	p_delta *= speed_scale;
@@ -628,7 +643,59 @@ void CPUParticles2D::_particles_process(float p_delta) {
 
 	float system_phase = time / lifetime;
 
-	for (int i = 0; i < pcount; i++) {
+	if (color_ramp.is_valid()) {
+		// Gradient sorts its points lazily on first lookup, force that here so the
+		// worker threads below only ever read it.
+		color_ramp->get_color_at_offset(0);
+	}
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	const int chunk_size = 1024; //below this, threading overhead dominates
+
+	if (pool && pcount > chunk_size) {
+
+		CPUParticles2DChunkData chunk_data;
+		chunk_data.particles = this;
+		chunk_data.parray = parray;
+		chunk_data.chunk_size = chunk_size;
+		chunk_data.pcount = pcount;
+		chunk_data.delta = p_delta;
+		chunk_data.prev_time = prev_time;
+		chunk_data.system_phase = system_phase;
+		chunk_data.emission_xform = emission_xform;
+		chunk_data.velocity_xform = velocity_xform;
+		// Math's global RNG is not thread safe, so each chunk gets its own
+		// generator, seeded here on the calling thread.
+		chunk_data.seed_base = (uint64_t(Math::rand()) << 32) | Math::rand();
+
+		int chunks = (pcount - 1) / chunk_size + 1;
+		WorkerThreadPool::GroupID group = pool->add_group_task(_process_chunk_task, &chunk_data, chunks);
+		pool->wait_for_group_task_completion(group);
+	} else {
+		RandomPCG rng((uint64_t(Math::rand()) << 32) | Math::rand());
+		_particles_process_range(0, pcount, p_delta, prev_time, system_phase, emission_xform, velocity_xform, parray, rng);
+	}
+}
+
+void CPUParticles2D::_process_chunk_task(void *p_userdata, uint32_t p_index) {
+
+	CPUParticles2DChunkData *chunk_data = (CPUParticles2DChunkData *)p_userdata;
+	int from = p_index * chunk_data->chunk_size;
+	int to = MIN(from + chunk_data->chunk_size, chunk_data->pcount);
+	RandomPCG rng(chunk_data->seed_base + p_index);
+	chunk_data->particles->_particles_process_range(from, to, chunk_data->delta, chunk_data->prev_time, chunk_data->system_phase, chunk_data->emission_xform, chunk_data->velocity_xform, (Particle *)chunk_data->parray, rng);
+}
+
+void CPUParticles2D::_particles_process_range(int p_from, int p_to, float p_delta, float p_prev_time, float p_system_phase, const Transform2D &p_emission_xform, const Transform2D &p_velocity_xform, Particle *p_parray, RandomPCG &p_rng) {
+
+	int pcount = particles.size();
+	float prev_time = p_prev_time;
+	float system_phase = p_system_phase;
+	const Transform2D &emission_xform = p_emission_xform;
+	const Transform2D &velocity_xform = p_velocity_xform;
+	Particle *parray = p_parray;
+
+	for (int i = p_from; i < p_to; i++) {
 
 		Particle &p = parray[i];
 
@@ -709,16 +776,16 @@ void CPUParticles2D::_particles_process(float p_delta) {
 				tex_anim_offset = curve_parameters[PARAM_ANGLE]->interpolate(0);
 			}
 
-			p.seed = Math::rand();
+			p.seed = p_rng.rand();
 
-			p.angle_rand = Math::randf();
-			p.scale_rand = Math::randf();
-			p.hue_rot_rand = Math::randf();
-			p.anim_offset_rand = Math::randf();
+			p.angle_rand = p_rng.randf();
+			p.scale_rand = p_rng.randf();
+			p.hue_rot_rand = p_rng.randf();
+			p.anim_offset_rand = p_rng.randf();
 
-			float angle1_rad = Math::atan2(direction.y, direction.x) + (Math::randf() * 2.0 - 1.0) * Math_PI * spread / 180.0;
+			float angle1_rad = Math::atan2(direction.y, direction.x) + (p_rng.randf() * 2.0 - 1.0) * Math_PI * spread / 180.0;
 			Vector2 rot = Vector2(Math::cos(angle1_rad), Math::sin(angle1_rad));
-			p.velocity = rot * parameters[PARAM_INITIAL_LINEAR_VELOCITY] * Math::lerp(1.0f, float(Math::randf()), randomness[PARAM_INITIAL_LINEAR_VELOCITY]);
+			p.velocity = rot * parameters[PARAM_INITIAL_LINEAR_VELOCITY] * Math::lerp(1.0f, float(p_rng.randf()), randomness[PARAM_INITIAL_LINEAR_VELOCITY]);
 
 			float base_angle = (parameters[PARAM_ANGLE] + tex_angle) * Math::lerp(1.0f, p.angle_rand, randomness[PARAM_ANGLE]);
 			p.rotation = Math::deg2rad(base_angle);
@@ -729,7 +796,7 @@ void CPUParticles2D::_particles_process(float p_delta) {
 			p.custom[3] = 0.0;
 			p.transform = Transform2D();
 			p.time = 0;
-			p.lifetime = lifetime * (1.0 - Math::randf() * lifetime_randomness);
+			p.lifetime = lifetime * (1.0 - p_rng.randf() * lifetime_randomness);
 			p.base_color = Color(1, 1, 1, 1);
 
 			switch (emission_shape) {
@@ -737,12 +804,12 @@ void CPUParticles2D::_particles_process(float p_delta) {
 					//do none
 				} break;
 				case EMISSION_SHAPE_SPHERE: {
-					float s = Math::randf(), t = 2.0 * Math_PI * Math::randf();
+					float s = p_rng.randf(), t = 2.0 * Math_PI * p_rng.randf();
 					float radius = emission_sphere_radius * Math::sqrt(1.0 - s * s);
 					p.transform[2] = Vector2(Math::cos(t), Math::sin(t)) * radius;
 				} break;
 				case EMISSION_SHAPE_RECTANGLE: {
-					p.transform[2] = Vector2(Math::randf() * 2.0 - 1.0, Math::randf() * 2.0 - 1.0) * emission_rect_extents;
+					p.transform[2] = Vector2(p_rng.randf() * 2.0 - 1.0, p_rng.randf() * 2.0 - 1.0) * emission_rect_extents;
 				} break;
 				case EMISSION_SHAPE_POINTS:
 				case EMISSION_SHAPE_DIRECTED_POINTS: {
@@ -751,7 +818,7 @@ void CPUParticles2D::_particles_process(float p_delta) {
 					if (pc == 0)
 						break;
 
-					int random_idx = Math::rand() % pc;
+					int random_idx = p_rng.rand() % pc;
 
 					p.transform[2] = emission_points.get(random_idx);
 
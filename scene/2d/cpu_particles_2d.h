@@ -31,6 +31,7 @@
 #ifndef CPU_PARTICLES_2D_H
 #define CPU_PARTICLES_2D_H
 
+#include "core/math/random_pcg.h"
 #include "core/rid.h"
 #include "scene/2d/node_2d.h"
 #include "scene/resources/texture.h"
@@ -176,6 +177,8 @@ private:
 
 	void _update_internal();
 	void _particles_process(float p_delta);
+	void _particles_process_range(int p_from, int p_to, float p_delta, float p_prev_time, float p_system_phase, const Transform2D &p_emission_xform, const Transform2D &p_velocity_xform, Particle *p_parray, RandomPCG &p_rng);
+	static void _process_chunk_task(void *p_userdata, uint32_t p_index);
 	void _update_particle_data_buffer();
 
 	Mutex *update_mutex;
@@ -360,11 +360,19 @@ void TileMap::update_dirty_quadrants() {
 
 		Quadrant &q = *dirty_quadrant_list.first()->self();
 
-		for (List<RID>::Element *E = q.canvas_items.front(); E; E = E->next()) {
+		//keep the old canvas items; the rebuild below reuses them (cleared and
+		//reconfigured) instead of freeing and recreating them in the VisualServer,
+		//which is most of the cost of editing a quadrant during gameplay; with the
+		//debug hints active untracked child items hang off them, so free as before
+		List<RID> old_canvas_items;
+		if (!debug_shapes && !debug_navigation) {
+			old_canvas_items = q.canvas_items;
+		} else {
+			for (List<RID>::Element *E = q.canvas_items.front(); E; E = E->next()) {
 
-			vs->free(E->get());
+				vs->free(E->get());
+			}
 		}
-
 		q.canvas_items.clear();
 
 		if (!use_parent) {
@@ -420,9 +428,15 @@ void TileMap::update_dirty_quadrants() {
 
 			if (prev_canvas_item == RID() || prev_material != mat || prev_z_index != z_index) {
 
-				canvas_item = vs->canvas_item_create();
-				if (mat.is_valid())
-					vs->canvas_item_set_material(canvas_item, mat->get_rid());
+				if (old_canvas_items.size()) {
+					canvas_item = old_canvas_items.front()->get();
+					old_canvas_items.pop_front();
+					vs->canvas_item_clear(canvas_item);
+					vs->canvas_item_set_z_as_relative_to_parent(canvas_item, true); //may have been a debug item
+				} else {
+					canvas_item = vs->canvas_item_create();
+				}
+				vs->canvas_item_set_material(canvas_item, mat.is_valid() ? mat->get_rid() : RID());
 				vs->canvas_item_set_parent(canvas_item, get_canvas_item());
 				_update_item_material_state(canvas_item);
 				Transform2D xform;
@@ -693,6 +707,11 @@ void TileMap::update_dirty_quadrants() {
 			}
 		}
 
+		//free whatever the rebuild didn't reuse (the quadrant now needs fewer items)
+		for (List<RID>::Element *E = old_canvas_items.front(); E; E = E->next()) {
+			vs->free(E->get());
+		}
+
 		dirty_quadrant_list.remove(dirty_quadrant_list.first());
 		quadrant_order_dirty = true;
 	}
@@ -95,6 +95,48 @@ static const Vector3 speaker_directions[7] = {
 	Vector3(1.0, 0.0, 0.0).normalized(), // side-right
 };
 
+uint64_t AudioStreamPlayer3D::listener_cache_frame = uint64_t(-1);
+RID AudioStreamPlayer3D::listener_cache_scenario;
+Vector<AudioStreamPlayer3D::ListenerCache> AudioStreamPlayer3D::listener_cache;
+
+void AudioStreamPlayer3D::_update_listener_cache(Ref<World> p_world) {
+
+	listener_cache.clear();
+
+	List<Camera *> cameras;
+	p_world->get_camera_list(&cameras);
+
+	for (List<Camera *>::Element *E = cameras.front(); E; E = E->next()) {
+
+		Camera *camera = E->get();
+		Viewport *vp = camera->get_viewport();
+		if (!vp->is_audio_listener())
+			continue;
+
+		ListenerCache lc;
+		lc.viewport = vp;
+		lc.listener_is_camera = true;
+
+		Spatial *listener_node = camera;
+
+		Listener *listener = vp->get_listener();
+		if (listener) {
+			listener_node = listener;
+			lc.listener_is_camera = false;
+		}
+
+		lc.transform = listener_node->get_global_transform();
+		lc.affine_inv = lc.transform.affine_inverse();
+		lc.ortho_inv = lc.transform.orthonormalized().affine_inverse();
+		lc.doppler_velocity = lc.listener_is_camera ? camera->get_doppler_tracked_velocity() : Vector3();
+
+		listener_cache.push_back(lc);
+	}
+
+	listener_cache_frame = Engine::get_singleton()->get_physics_frames();
+	listener_cache_scenario = p_world->get_scenario();
+}
+
 void AudioStreamPlayer3D::_calc_output_vol(const Vector3 &source_dir, real_t tightness, AudioStreamPlayer3D::Output &output) {
 	unsigned int speaker_count; // only main speakers (no LFE)
 	switch (AudioServer::get_singleton()->get_speaker_mode()) {
@@ -409,26 +451,16 @@ void AudioStreamPlayer3D::_notification(int p_what) {
 				break;
 			}
 
-			List<Camera *> cameras;
-			world->get_camera_list(&cameras);
-
-			for (List<Camera *>::Element *E = cameras.front(); E; E = E->next()) {
-
-				Camera *camera = E->get();
-				Viewport *vp = camera->get_viewport();
-				if (!vp->is_audio_listener())
-					continue;
+			if (listener_cache_frame != Engine::get_singleton()->get_physics_frames() || listener_cache_scenario != world->get_scenario()) {
+				_update_listener_cache(world);
+			}
 
-				bool listener_is_camera = true;
-				Spatial *listener_node = camera;
+			for (int li = 0; li < listener_cache.size(); li++) {
 
-				Listener *listener = vp->get_listener();
-				if (listener) {
-					listener_node = listener;
-					listener_is_camera = false;
-				}
+				const ListenerCache &lc = listener_cache[li];
+				Viewport *vp = lc.viewport;
 
-				Vector3 local_pos = listener_node->get_global_transform().orthonormalized().affine_inverse().xform(global_pos);
+				Vector3 local_pos = lc.ortho_inv.xform(global_pos);
 
 				float dist = local_pos.length();
 
@@ -436,8 +468,8 @@ void AudioStreamPlayer3D::_notification(int p_what) {
 				Vector3 listener_area_pos;
 
 				if (area && area->is_using_reverb_bus() && area->get_reverb_uniformity() > 0) {
-					area_sound_pos = space_state->get_closest_point_to_object_volume(area->get_rid(), listener_node->get_global_transform().origin);
-					listener_area_pos = listener_node->get_global_transform().affine_inverse().xform(area_sound_pos);
+					area_sound_pos = space_state->get_closest_point_to_object_volume(area->get_rid(), lc.transform.origin);
+					listener_area_pos = lc.affine_inv.xform(area_sound_pos);
 				}
 
 				if (max_distance > 0) {
@@ -465,7 +497,7 @@ void AudioStreamPlayer3D::_notification(int p_what) {
 				float db_att = (1.0 - MIN(1.0, multiplier)) * attenuation_filter_db;
 
 				if (emission_angle_enabled) {
-					Vector3 listenertopos = global_pos - listener_node->get_global_transform().origin;
+					Vector3 listenertopos = global_pos - lc.transform.origin;
 					float c = listenertopos.normalized().dot(get_global_transform().basis.get_axis(2).normalized()); //it's z negative
 					float angle = Math::rad2deg(Math::acos(c));
 					if (angle > emission_angle)
@@ -574,13 +606,9 @@ void AudioStreamPlayer3D::_notification(int p_what) {
 
 				if (doppler_tracking != DOPPLER_TRACKING_DISABLED) {
 
-					Vector3 listener_velocity;
-
-					if (listener_is_camera) {
-						listener_velocity = camera->get_doppler_tracked_velocity();
-					}
+					Vector3 listener_velocity = lc.doppler_velocity;
 
-					Vector3 local_velocity = listener_node->get_global_transform().orthonormalized().basis.xform_inv(linear_velocity - listener_velocity);
+					Vector3 local_velocity = lc.ortho_inv.basis.xform(linear_velocity - listener_velocity);
 
 					if (local_velocity == Vector3()) {
 						output.pitch_scale = 1.0;
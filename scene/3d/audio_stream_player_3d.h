@@ -115,6 +115,23 @@ private:
 	bool stream_paused_fade_out;
 	StringName bus;
 
+	//Listener data is the same for every player in a frame, so it is
+	//resolved once per physics frame and shared, instead of every player
+	//walking the camera list and inverting listener transforms on its own.
+	struct ListenerCache {
+		Viewport *viewport; //only stored into Output for reference, not dereferenced
+		bool listener_is_camera;
+		Transform transform; //listener global transform
+		Transform affine_inv;
+		Transform ortho_inv; //orthonormalized affine inverse
+		Vector3 doppler_velocity;
+	};
+
+	static uint64_t listener_cache_frame;
+	static RID listener_cache_scenario;
+	static Vector<ListenerCache> listener_cache;
+	static void _update_listener_cache(Ref<World> p_world);
+
 	static void _calc_output_vol(const Vector3 &source_dir, real_t tightness, Output &output);
 	void _mix_audio();
 	static void _mix_audios(void *self) { reinterpret_cast<AudioStreamPlayer3D *>(self)->_mix_audio(); }
@@ -30,6 +30,7 @@
 
 #include "cpu_particles.h"
 
+#include "core/os/worker_thread_pool.h"
 #include "scene/3d/camera.h"
 #include "scene/3d/particles.h"
 #include "scene/resources/particles_material.h"
@@ -198,6 +199,16 @@ bool CPUParticles::get_fractional_delta() const {
 	return fractional_delta;
 }
 
+void CPUParticles::set_visibility_lod(VisibilityLOD p_lod) {
+	visibility_lod = p_lod;
+	lod_tick = 0;
+	lod_time_accum = 0;
+}
+
+CPUParticles::VisibilityLOD CPUParticles::get_visibility_lod() const {
+	return visibility_lod;
+}
+
 String CPUParticles::get_configuration_warning() const {
 
 	String warnings;
@@ -525,6 +536,20 @@ void CPUParticles::_update_internal() {
 	}
 
 	float delta = get_process_delta_time();
+
+	if (visibility_lod != VISIBILITY_LOD_DISABLED && !VS::get_singleton()->instance_is_visible(get_instance())) {
+		//camera does not see us; tick at reduced rate, banking the skipped
+		//time so the simulation clock does not slow down
+		int divisor = visibility_lod == VISIBILITY_LOD_HALF_RATE ? 2 : 4;
+		lod_tick++;
+		if (lod_tick % divisor != 0) {
+			lod_time_accum += delta;
+			return;
+		}
+	}
+	delta += lod_time_accum;
+	lod_time_accum = 0;
+
 	if (emitting) {
 		inactive_time = 0;
 	} else {
@@ -592,6 +617,20 @@ void CPUParticles::_update_internal() {
 	}
 }
 
+struct CPUParticlesChunkData {
+
+	CPUParticles *particles;
+	void *parray; //CPUParticles::Particle is private, cast back in the task
+	int chunk_size;
+	int pcount;
+	float delta;
+	float prev_time;
+	float system_phase;
+	Transform emission_xform;
+	Basis velocity_xform;
+	uint64_t seed_base;
+};
+
 void CPUParticles::_particles_process(float p_delta) {
 
 	p_delta *= speed_scale;
@@ -621,7 +660,59 @@ void CPUParticles::_particles_process(float p_delta) {
 
 	float system_phase = time / lifetime;
 
-	for (int i = 0; i < pcount; i++) {
+	if (color_ramp.is_valid()) {
+		// Gradient sorts its points lazily on first lookup, force that here so the
+		// worker threads below only ever read it.
+		color_ramp->get_color_at_offset(0);
+	}
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	const int chunk_size = 1024; //below this, threading overhead dominates
+
+	if (pool && pcount > chunk_size) {
+
+		CPUParticlesChunkData chunk_data;
+		chunk_data.particles = this;
+		chunk_data.parray = parray;
+		chunk_data.chunk_size = chunk_size;
+		chunk_data.pcount = pcount;
+		chunk_data.delta = p_delta;
+		chunk_data.prev_time = prev_time;
+		chunk_data.system_phase = system_phase;
+		chunk_data.emission_xform = emission_xform;
+		chunk_data.velocity_xform = velocity_xform;
+		// Math's global RNG is not thread safe, so each chunk gets its own
+		// generator, seeded here on the calling thread.
+		chunk_data.seed_base = (uint64_t(Math::rand()) << 32) | Math::rand();
+
+		int chunks = (pcount - 1) / chunk_size + 1;
+		WorkerThreadPool::GroupID group = pool->add_group_task(_process_chunk_task, &chunk_data, chunks);
+		pool->wait_for_group_task_completion(group);
+	} else {
+		RandomPCG rng((uint64_t(Math::rand()) << 32) | Math::rand());
+		_particles_process_range(0, pcount, p_delta, prev_time, system_phase, emission_xform, velocity_xform, parray, rng);
+	}
+}
+
+void CPUParticles::_process_chunk_task(void *p_userdata, uint32_t p_index) {
+
+	CPUParticlesChunkData *chunk_data = (CPUParticlesChunkData *)p_userdata;
+	int from = p_index * chunk_data->chunk_size;
+	int to = MIN(from + chunk_data->chunk_size, chunk_data->pcount);
+	RandomPCG rng(chunk_data->seed_base + p_index);
+	chunk_data->particles->_particles_process_range(from, to, chunk_data->delta, chunk_data->prev_time, chunk_data->system_phase, chunk_data->emission_xform, chunk_data->velocity_xform, (Particle *)chunk_data->parray, rng);
+}
+
+void CPUParticles::_particles_process_range(int p_from, int p_to, float p_delta, float p_prev_time, float p_system_phase, const Transform &p_emission_xform, const Basis &p_velocity_xform, Particle *p_parray, RandomPCG &p_rng) {
+
+	int pcount = particles.size();
+	float prev_time = p_prev_time;
+	float system_phase = p_system_phase;
+	const Transform &emission_xform = p_emission_xform;
+	const Basis &velocity_xform = p_velocity_xform;
+	Particle *parray = p_parray;
+
+	for (int i = p_from; i < p_to; i++) {
 
 		Particle &p = parray[i];
 
@@ -702,28 +793,28 @@ void CPUParticles::_particles_process(float p_delta) {
 				tex_anim_offset = curve_parameters[PARAM_ANGLE]->interpolate(0);
 			}
 
-			p.seed = Math::rand();
+			p.seed = p_rng.rand();
 
-			p.angle_rand = Math::randf();
-			p.scale_rand = Math::randf();
-			p.hue_rot_rand = Math::randf();
-			p.anim_offset_rand = Math::randf();
+			p.angle_rand = p_rng.randf();
+			p.scale_rand = p_rng.randf();
+			p.hue_rot_rand = p_rng.randf();
+			p.anim_offset_rand = p_rng.randf();
 
 			if (flags[FLAG_DISABLE_Z]) {
-				float angle1_rad = Math::atan2(direction.y, direction.x) + (Math::randf() * 2.0 - 1.0) * Math_PI * spread / 180.0;
+				float angle1_rad = Math::atan2(direction.y, direction.x) + (p_rng.randf() * 2.0 - 1.0) * Math_PI * spread / 180.0;
 				Vector3 rot = Vector3(Math::cos(angle1_rad), Math::sin(angle1_rad), 0.0);
-				p.velocity = rot * parameters[PARAM_INITIAL_LINEAR_VELOCITY] * Math::lerp(1.0f, float(Math::randf()), randomness[PARAM_INITIAL_LINEAR_VELOCITY]);
+				p.velocity = rot * parameters[PARAM_INITIAL_LINEAR_VELOCITY] * Math::lerp(1.0f, float(p_rng.randf()), randomness[PARAM_INITIAL_LINEAR_VELOCITY]);
 			} else {
 				//initiate velocity spread in 3D
-				float angle1_rad = Math::atan2(direction.x, direction.z) + (Math::randf() * 2.0 - 1.0) * Math_PI * spread / 180.0;
-				float angle2_rad = Math::atan2(direction.y, Math::abs(direction.z)) + (Math::randf() * 2.0 - 1.0) * (1.0 - flatness) * Math_PI * spread / 180.0;
+				float angle1_rad = Math::atan2(direction.x, direction.z) + (p_rng.randf() * 2.0 - 1.0) * Math_PI * spread / 180.0;
+				float angle2_rad = Math::atan2(direction.y, Math::abs(direction.z)) + (p_rng.randf() * 2.0 - 1.0) * (1.0 - flatness) * Math_PI * spread / 180.0;
 
 				Vector3 direction_xz = Vector3(Math::sin(angle1_rad), 0, Math::cos(angle1_rad));
 				Vector3 direction_yz = Vector3(0, Math::sin(angle2_rad), Math::cos(angle2_rad));
 				direction_yz.z = direction_yz.z / MAX(0.0001, Math::sqrt(ABS(direction_yz.z))); //better uniform distribution
 				Vector3 direction = Vector3(direction_xz.x * direction_yz.z, direction_yz.y, direction_xz.z * direction_yz.z);
 				direction.normalize();
-				p.velocity = direction * parameters[PARAM_INITIAL_LINEAR_VELOCITY] * Math::lerp(1.0f, float(Math::randf()), randomness[PARAM_INITIAL_LINEAR_VELOCITY]);
+				p.velocity = direction * parameters[PARAM_INITIAL_LINEAR_VELOCITY] * Math::lerp(1.0f, float(p_rng.randf()), randomness[PARAM_INITIAL_LINEAR_VELOCITY]);
 			}
 
 			float base_angle = (parameters[PARAM_ANGLE] + tex_angle) * Math::lerp(1.0f, p.angle_rand, randomness[PARAM_ANGLE]);
@@ -732,7 +823,7 @@ void CPUParticles::_particles_process(float p_delta) {
 			p.custom[2] = (parameters[PARAM_ANIM_OFFSET] + tex_anim_offset) * Math::lerp(1.0f, p.anim_offset_rand, randomness[PARAM_ANIM_OFFSET]); //animation offset (0-1)
 			p.transform = Transform();
 			p.time = 0;
-			p.lifetime = lifetime * (1.0 - Math::randf() * lifetime_randomness);
+			p.lifetime = lifetime * (1.0 - p_rng.randf() * lifetime_randomness);
 			p.base_color = Color(1, 1, 1, 1);
 
 			switch (emission_shape) {
@@ -740,12 +831,12 @@ void CPUParticles::_particles_process(float p_delta) {
 					//do none
 				} break;
 				case EMISSION_SHAPE_SPHERE: {
-					float s = 2.0 * Math::randf() - 1.0, t = 2.0 * Math_PI * Math::randf();
+					float s = 2.0 * p_rng.randf() - 1.0, t = 2.0 * Math_PI * p_rng.randf();
 					float radius = emission_sphere_radius * Math::sqrt(1.0 - s * s);
 					p.transform.origin = Vector3(radius * Math::cos(t), radius * Math::sin(t), emission_sphere_radius * s);
 				} break;
 				case EMISSION_SHAPE_BOX: {
-					p.transform.origin = Vector3(Math::randf() * 2.0 - 1.0, Math::randf() * 2.0 - 1.0, Math::randf() * 2.0 - 1.0) * emission_box_extents;
+					p.transform.origin = Vector3(p_rng.randf() * 2.0 - 1.0, p_rng.randf() * 2.0 - 1.0, p_rng.randf() * 2.0 - 1.0) * emission_box_extents;
 				} break;
 				case EMISSION_SHAPE_POINTS:
 				case EMISSION_SHAPE_DIRECTED_POINTS: {
@@ -754,7 +845,7 @@ void CPUParticles::_particles_process(float p_delta) {
 					if (pc == 0)
 						break;
 
-					int random_idx = Math::rand() % pc;
+					int random_idx = p_rng.rand() % pc;
 
 					p.transform.origin = emission_points.get(random_idx);
 
@@ -1314,6 +1405,8 @@ void CPUParticles::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_fixed_fps"), &CPUParticles::get_fixed_fps);
 	ClassDB::bind_method(D_METHOD("get_fractional_delta"), &CPUParticles::get_fractional_delta);
 	ClassDB::bind_method(D_METHOD("get_speed_scale"), &CPUParticles::get_speed_scale);
+	ClassDB::bind_method(D_METHOD("set_visibility_lod", "lod"), &CPUParticles::set_visibility_lod);
+	ClassDB::bind_method(D_METHOD("get_visibility_lod"), &CPUParticles::get_visibility_lod);
 
 	ClassDB::bind_method(D_METHOD("set_draw_order", "order"), &CPUParticles::set_draw_order);
 
@@ -1336,6 +1429,7 @@ void CPUParticles::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::REAL, "lifetime_randomness", PROPERTY_HINT_RANGE, "0,1,0.01"), "set_lifetime_randomness", "get_lifetime_randomness");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "fixed_fps", PROPERTY_HINT_RANGE, "0,1000,1"), "set_fixed_fps", "get_fixed_fps");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "fract_delta"), "set_fractional_delta", "get_fractional_delta");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "visibility_lod", PROPERTY_HINT_ENUM, "Disabled,Half Rate,Quarter Rate"), "set_visibility_lod", "get_visibility_lod");
 	ADD_GROUP("Drawing", "");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "local_coords"), "set_use_local_coordinates", "get_use_local_coordinates");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "draw_order", PROPERTY_HINT_ENUM, "Index,Lifetime,View Depth"), "set_draw_order", "get_draw_order");
@@ -1345,6 +1439,10 @@ void CPUParticles::_bind_methods() {
 	BIND_ENUM_CONSTANT(DRAW_ORDER_LIFETIME);
 	BIND_ENUM_CONSTANT(DRAW_ORDER_VIEW_DEPTH);
 
+	BIND_ENUM_CONSTANT(VISIBILITY_LOD_DISABLED);
+	BIND_ENUM_CONSTANT(VISIBILITY_LOD_HALF_RATE);
+	BIND_ENUM_CONSTANT(VISIBILITY_LOD_QUARTER_RATE);
+
 	////////////////////////////////
 
 	ClassDB::bind_method(D_METHOD("set_direction", "direction"), &CPUParticles::set_direction);
@@ -1515,6 +1613,7 @@ CPUParticles::CPUParticles() {
 	set_lifetime(1);
 	set_fixed_fps(0);
 	set_fractional_delta(true);
+	set_visibility_lod(VISIBILITY_LOD_DISABLED);
 	set_pre_process_time(0);
 	set_explosiveness_ratio(0);
 	set_randomness_ratio(0);
@@ -31,6 +31,7 @@
 #ifndef CPU_PARTICLES_H
 #define CPU_PARTICLES_H
 
+#include "core/math/random_pcg.h"
 #include "core/rid.h"
 #include "scene/3d/visual_instance.h"
 
@@ -78,6 +79,12 @@ public:
 		EMISSION_SHAPE_MAX
 	};
 
+	enum VisibilityLOD {
+		VISIBILITY_LOD_DISABLED,
+		VISIBILITY_LOD_HALF_RATE,
+		VISIBILITY_LOD_QUARTER_RATE,
+	};
+
 private:
 	bool emitting;
 
@@ -141,6 +148,10 @@ private:
 	int fixed_fps;
 	bool fractional_delta;
 
+	VisibilityLOD visibility_lod;
+	uint32_t lod_tick;
+	float lod_time_accum;
+
 	Transform inv_emission_transform;
 
 	volatile bool can_update;
@@ -176,6 +187,8 @@ private:
 
 	void _update_internal();
 	void _particles_process(float p_delta);
+	void _particles_process_range(int p_from, int p_to, float p_delta, float p_prev_time, float p_system_phase, const Transform &p_emission_xform, const Basis &p_velocity_xform, Particle *p_parray, RandomPCG &p_rng);
+	static void _process_chunk_task(void *p_userdata, uint32_t p_index);
 	void _update_particle_data_buffer();
 
 	Mutex *update_mutex;
@@ -223,6 +236,9 @@ public:
 	void set_fractional_delta(bool p_enable);
 	bool get_fractional_delta() const;
 
+	void set_visibility_lod(VisibilityLOD p_lod);
+	VisibilityLOD get_visibility_lod() const;
+
 	void set_draw_order(DrawOrder p_order);
 	DrawOrder get_draw_order() const;
 
@@ -294,5 +310,6 @@ VARIANT_ENUM_CAST(CPUParticles::DrawOrder)
 VARIANT_ENUM_CAST(CPUParticles::Parameter)
 VARIANT_ENUM_CAST(CPUParticles::Flags)
 VARIANT_ENUM_CAST(CPUParticles::EmissionShape)
+VARIANT_ENUM_CAST(CPUParticles::VisibilityLOD)
 
 #endif // CPU_PARTICLES_H
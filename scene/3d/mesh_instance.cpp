@@ -147,6 +147,20 @@ Ref<Mesh> MeshInstance::get_mesh() const {
 	return mesh;
 }
 
+void MeshInstance::add_lod_level(const Ref<Mesh> &p_mesh, float p_distance) {
+
+	ERR_FAIL_COND(p_mesh.is_null());
+
+	lod_meshes.push_back(p_mesh);
+	VS::get_singleton()->instance_add_lod_level(get_instance(), p_mesh->get_rid(), p_distance);
+}
+
+void MeshInstance::clear_lod_levels() {
+
+	lod_meshes.clear();
+	VS::get_singleton()->instance_clear_lod_levels(get_instance());
+}
+
 void MeshInstance::_resolve_skeleton_path() {
 
 	Ref<SkinReference> new_skin_reference;
@@ -395,6 +409,9 @@ void MeshInstance::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_skin", "skin"), &MeshInstance::set_skin);
 	ClassDB::bind_method(D_METHOD("get_skin"), &MeshInstance::get_skin);
 
+	ClassDB::bind_method(D_METHOD("add_lod_level", "mesh", "distance"), &MeshInstance::add_lod_level);
+	ClassDB::bind_method(D_METHOD("clear_lod_levels"), &MeshInstance::clear_lod_levels);
+
 	ClassDB::bind_method(D_METHOD("get_surface_material_count"), &MeshInstance::get_surface_material_count);
 	ClassDB::bind_method(D_METHOD("set_surface_material", "surface", "material"), &MeshInstance::set_surface_material);
 	ClassDB::bind_method(D_METHOD("get_surface_material", "surface"), &MeshInstance::get_surface_material);
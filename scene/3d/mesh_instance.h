@@ -59,6 +59,7 @@ protected:
 
 	Map<StringName, BlendShapeTrack> blend_shape_tracks;
 	Vector<Ref<Material> > materials;
+	Vector<Ref<Mesh> > lod_meshes; //keep LOD meshes referenced while the server may draw them
 
 	void _mesh_changed();
 	void _resolve_skeleton_path();
@@ -81,6 +82,9 @@ public:
 	void set_skeleton_path(const NodePath &p_skeleton);
 	NodePath get_skeleton_path();
 
+	void add_lod_level(const Ref<Mesh> &p_mesh, float p_distance);
+	void clear_lod_levels();
+
 	int get_surface_material_count() const;
 	void set_surface_material(int p_surface, const Ref<Material> &p_material);
 	Ref<Material> get_surface_material(int p_surface) const;
@@ -39,6 +39,8 @@ void Navigation::_navmesh_link(int p_id) {
 	ERR_FAIL_COND(nm.linked);
 	ERR_FAIL_COND(nm.navmesh.is_null());
 
+	path_cache.clear();
+
 	PoolVector<Vector3> vertices = nm.navmesh->get_vertices();
 	int len = vertices.size();
 	if (len == 0)
@@ -77,6 +79,13 @@ void Navigation::_navmesh_link(int p_id) {
 			e.point = _get_point(ep);
 			p.edges.write[j] = e;
 
+			if (j == 0) {
+				p.aabb.position = ep;
+				p.aabb.size = Vector3();
+			} else {
+				p.aabb.expand_to(ep);
+			}
+
 			if (j >= 2) {
 				Vector3 epa = nm.xform.xform(r[indices[j - 2]]);
 				Vector3 epb = nm.xform.xform(r[indices[j - 1]]);
@@ -97,6 +106,8 @@ void Navigation::_navmesh_link(int p_id) {
 			p.center /= plen;
 		}
 
+		p.query_pass = 0;
+
 		//connect
 
 		for (int j = 0; j < plen; j++) {
@@ -104,7 +115,7 @@ void Navigation::_navmesh_link(int p_id) {
 			int next = (j + 1) % plen;
 			EdgeKey ek(p.edges[j].point, p.edges[next].point);
 
-			Map<EdgeKey, Connection>::Element *C = connections.find(ek);
+			Connection *C = connections.getptr(ek);
 			if (!C) {
 
 				Connection c;
@@ -115,23 +126,25 @@ void Navigation::_navmesh_link(int p_id) {
 				connections[ek] = c;
 			} else {
 
-				if (C->get().B != NULL) {
+				if (C->B != NULL) {
 					ConnectionPending pending;
 					pending.polygon = &p;
 					pending.edge = j;
-					p.edges.write[j].P = C->get().pending.push_back(pending);
+					p.edges.write[j].P = C->pending.push_back(pending);
 					continue;
 				}
 
-				C->get().B = &p;
-				C->get().B_edge = j;
-				C->get().A->edges.write[C->get().A_edge].C = &p;
-				C->get().A->edges.write[C->get().A_edge].C_edge = j;
-				p.edges.write[j].C = C->get().A;
-				p.edges.write[j].C_edge = C->get().A_edge;
+				C->B = &p;
+				C->B_edge = j;
+				C->A->edges.write[C->A_edge].C = &p;
+				C->A->edges.write[C->A_edge].C_edge = j;
+				p.edges.write[j].C = C->A;
+				p.edges.write[j].C_edge = C->A_edge;
 				//connection successful.
 			}
 		}
+
+		_grid_insert(&p);
 	}
 
 	nm.linked = true;
@@ -143,10 +156,14 @@ void Navigation::_navmesh_unlink(int p_id) {
 	NavMesh &nm = navmesh_map[p_id];
 	ERR_FAIL_COND(!nm.linked);
 
+	path_cache.clear();
+
 	for (List<Polygon>::Element *E = nm.polygons.front(); E; E = E->next()) {
 
 		Polygon &p = E->get();
 
+		_grid_remove(&p);
+
 		int ec = p.edges.size();
 		Polygon::Edge *edges = p.edges.ptrw();
 
@@ -154,45 +171,45 @@ void Navigation::_navmesh_unlink(int p_id) {
 			int next = (i + 1) % ec;
 
 			EdgeKey ek(edges[i].point, edges[next].point);
-			Map<EdgeKey, Connection>::Element *C = connections.find(ek);
+			Connection *C = connections.getptr(ek);
 
 			ERR_CONTINUE(!C);
 
 			if (edges[i].P) {
-				C->get().pending.erase(edges[i].P);
+				C->pending.erase(edges[i].P);
 				edges[i].P = NULL;
-			} else if (C->get().B) {
+			} else if (C->B) {
 				//disconnect
 
-				C->get().B->edges.write[C->get().B_edge].C = NULL;
-				C->get().B->edges.write[C->get().B_edge].C_edge = -1;
-				C->get().A->edges.write[C->get().A_edge].C = NULL;
-				C->get().A->edges.write[C->get().A_edge].C_edge = -1;
+				C->B->edges.write[C->B_edge].C = NULL;
+				C->B->edges.write[C->B_edge].C_edge = -1;
+				C->A->edges.write[C->A_edge].C = NULL;
+				C->A->edges.write[C->A_edge].C_edge = -1;
 
-				if (C->get().A == &E->get()) {
+				if (C->A == &E->get()) {
 
-					C->get().A = C->get().B;
-					C->get().A_edge = C->get().B_edge;
+					C->A = C->B;
+					C->A_edge = C->B_edge;
 				}
-				C->get().B = NULL;
-				C->get().B_edge = -1;
+				C->B = NULL;
+				C->B_edge = -1;
 
-				if (C->get().pending.size()) {
+				if (C->pending.size()) {
 					//reconnect if something is pending
-					ConnectionPending cp = C->get().pending.front()->get();
-					C->get().pending.pop_front();
-
-					C->get().B = cp.polygon;
-					C->get().B_edge = cp.edge;
-					C->get().A->edges.write[C->get().A_edge].C = cp.polygon;
-					C->get().A->edges.write[C->get().A_edge].C_edge = cp.edge;
-					cp.polygon->edges.write[cp.edge].C = C->get().A;
-					cp.polygon->edges.write[cp.edge].C_edge = C->get().A_edge;
+					ConnectionPending cp = C->pending.front()->get();
+					C->pending.pop_front();
+
+					C->B = cp.polygon;
+					C->B_edge = cp.edge;
+					C->A->edges.write[C->A_edge].C = cp.polygon;
+					C->A->edges.write[C->A_edge].C_edge = cp.edge;
+					cp.polygon->edges.write[cp.edge].C = C->A;
+					cp.polygon->edges.write[cp.edge].C_edge = C->A_edge;
 					cp.polygon->edges.write[cp.edge].P = NULL;
 				}
 
 			} else {
-				connections.erase(C);
+				connections.erase(ek);
 				//erase
 			}
 		}
@@ -203,6 +220,140 @@ void Navigation::_navmesh_unlink(int p_id) {
 	nm.linked = false;
 }
 
+void Navigation::_grid_insert(Polygon *p_polygon) {
+
+	const int x0 = int(Math::floor(p_polygon->aabb.position.x / grid_cell_size));
+	const int x1 = int(Math::floor((p_polygon->aabb.position.x + p_polygon->aabb.size.x) / grid_cell_size));
+	const int z0 = int(Math::floor(p_polygon->aabb.position.z / grid_cell_size));
+	const int z1 = int(Math::floor((p_polygon->aabb.position.z + p_polygon->aabb.size.z) / grid_cell_size));
+
+	for (int z = z0; z <= z1; z++) {
+		for (int x = x0; x <= x1; x++) {
+			uint64_t key = _grid_key(x, z);
+			Vector<Polygon *> *cell = grid.lookup_ptr(key);
+			if (cell) {
+				cell->push_back(p_polygon);
+			} else {
+				Vector<Polygon *> new_cell;
+				new_cell.push_back(p_polygon);
+				grid.set(key, new_cell);
+			}
+		}
+	}
+
+	if (grid_polygon_count == 0) {
+		grid_min_x = x0;
+		grid_max_x = x1;
+		grid_min_z = z0;
+		grid_max_z = z1;
+	} else {
+		grid_min_x = MIN(grid_min_x, x0);
+		grid_max_x = MAX(grid_max_x, x1);
+		grid_min_z = MIN(grid_min_z, z0);
+		grid_max_z = MAX(grid_max_z, z1);
+	}
+	grid_polygon_count++;
+}
+
+void Navigation::_grid_remove(Polygon *p_polygon) {
+
+	const int x0 = int(Math::floor(p_polygon->aabb.position.x / grid_cell_size));
+	const int x1 = int(Math::floor((p_polygon->aabb.position.x + p_polygon->aabb.size.x) / grid_cell_size));
+	const int z0 = int(Math::floor(p_polygon->aabb.position.z / grid_cell_size));
+	const int z1 = int(Math::floor((p_polygon->aabb.position.z + p_polygon->aabb.size.z) / grid_cell_size));
+
+	for (int z = z0; z <= z1; z++) {
+		for (int x = x0; x <= x1; x++) {
+			uint64_t key = _grid_key(x, z);
+			Vector<Polygon *> *cell = grid.lookup_ptr(key);
+			ERR_CONTINUE(!cell);
+			int idx = cell->find(p_polygon);
+			ERR_CONTINUE(idx == -1);
+			cell->remove(idx);
+			if (cell->empty()) {
+				grid.remove(key);
+			}
+		}
+	}
+
+	grid_polygon_count--;
+	// Cell bounds only ever grow while polygons remain; the next insert into
+	// an empty grid resets them, so a stale extent can't outlive the meshes.
+}
+
+void Navigation::_grid_scan_cell(int p_x, int p_z, const Vector3 &p_point, Polygon *&r_polygon, Vector3 &r_point, Vector3 &r_normal, float &r_dist) {
+
+	if (p_x < grid_min_x || p_x > grid_max_x || p_z < grid_min_z || p_z > grid_max_z) {
+		return;
+	}
+
+	const Vector<Polygon *> *cell = grid.lookup_ptr(_grid_key(p_x, p_z));
+	if (!cell) {
+		return;
+	}
+
+	for (int i = 0; i < cell->size(); i++) {
+
+		Polygon *p = (*cell)[i];
+		if (p->query_pass == query_pass) {
+			continue; // Polygons spanning several cells are only tested once.
+		}
+		p->query_pass = query_pass;
+
+		for (int j = 2; j < p->edges.size(); j++) {
+
+			Face3 f(_get_vertex(p->edges[0].point), _get_vertex(p->edges[j - 1].point), _get_vertex(p->edges[j].point));
+			Vector3 inters = f.get_closest_point_to(p_point);
+			float d = inters.distance_to(p_point);
+			if (d < r_dist) {
+				r_polygon = p;
+				r_point = inters;
+				r_normal = f.get_plane().normal;
+				r_dist = d;
+			}
+		}
+	}
+}
+
+Navigation::Polygon *Navigation::_get_closest_polygon_point(const Vector3 &p_point, Vector3 &r_point, Vector3 &r_normal) {
+
+	if (grid_polygon_count == 0) {
+		return NULL;
+	}
+
+	query_pass++;
+
+	Polygon *closest_poly = NULL;
+	float closest_d = 1e20;
+
+	const int cx = int(Math::floor(p_point.x / grid_cell_size));
+	const int cz = int(Math::floor(p_point.z / grid_cell_size));
+
+	const int max_ring = MAX(MAX(cx - grid_min_x, grid_max_x - cx), MAX(cz - grid_min_z, grid_max_z - cz));
+
+	for (int ring = 0; ring <= max_ring; ring++) {
+
+		// Nothing on this ring can beat the best hit once the ring is further
+		// away on the XZ plane alone than the best full 3D distance.
+		if (closest_poly && (ring - 1) * grid_cell_size > closest_d) {
+			break;
+		}
+
+		for (int x = cx - ring; x <= cx + ring; x++) {
+			_grid_scan_cell(x, cz - ring, p_point, closest_poly, r_point, r_normal, closest_d);
+			if (ring > 0) {
+				_grid_scan_cell(x, cz + ring, p_point, closest_poly, r_point, r_normal, closest_d);
+			}
+		}
+		for (int z = cz - ring + 1; z <= cz + ring - 1; z++) {
+			_grid_scan_cell(cx - ring, z, p_point, closest_poly, r_point, r_normal, closest_d);
+			_grid_scan_cell(cx + ring, z, p_point, closest_poly, r_point, r_normal, closest_d);
+		}
+	}
+
+	return closest_poly;
+}
+
 int Navigation::navmesh_add(const Ref<NavigationMesh> &p_mesh, const Transform &p_xform, Object *p_owner) {
 
 	int id = last_id++;
@@ -271,43 +422,12 @@ void Navigation::_clip_path(Vector<Vector3> &path, Polygon *from_poly, const Vec
 
 Vector<Vector3> Navigation::get_simple_path(const Vector3 &p_start, const Vector3 &p_end, bool p_optimize) {
 
-	Polygon *begin_poly = NULL;
-	Polygon *end_poly = NULL;
 	Vector3 begin_point;
 	Vector3 end_point;
-	float begin_d = 1e20;
-	float end_d = 1e20;
-
-	for (Map<int, NavMesh>::Element *E = navmesh_map.front(); E; E = E->next()) {
+	Vector3 normal;
 
-		if (!E->get().linked)
-			continue;
-		for (List<Polygon>::Element *F = E->get().polygons.front(); F; F = F->next()) {
-
-			Polygon &p = F->get();
-			for (int i = 2; i < p.edges.size(); i++) {
-
-				Face3 f(_get_vertex(p.edges[0].point), _get_vertex(p.edges[i - 1].point), _get_vertex(p.edges[i].point));
-				Vector3 spoint = f.get_closest_point_to(p_start);
-				float dpoint = spoint.distance_to(p_start);
-				if (dpoint < begin_d) {
-					begin_d = dpoint;
-					begin_poly = &p;
-					begin_point = spoint;
-				}
-
-				spoint = f.get_closest_point_to(p_end);
-				dpoint = spoint.distance_to(p_end);
-				if (dpoint < end_d) {
-					end_d = dpoint;
-					end_poly = &p;
-					end_point = spoint;
-				}
-			}
-
-			p.prev_edge = -1;
-		}
-	}
+	Polygon *begin_poly = _get_closest_polygon_point(p_start, begin_point, normal);
+	Polygon *end_poly = _get_closest_polygon_point(p_end, end_point, normal);
 
 	if (!begin_poly || !end_poly) {
 
@@ -325,108 +445,159 @@ Vector<Vector3> Navigation::get_simple_path(const Vector3 &p_start, const Vector
 
 	bool found_route = false;
 
-	List<Polygon *> open_list;
+	PathCacheKey cache_key;
+	cache_key.begin = begin_poly;
+	cache_key.end = end_poly;
 
-	for (int i = 0; i < begin_poly->edges.size(); i++) {
+	if (use_path_cache) {
 
-		if (begin_poly->edges[i].C) {
+		Map<PathCacheKey, Vector<PathCacheStep> >::Element *C = path_cache.find(cache_key);
+		if (C) {
+			//replay the cached corridor onto the polygons and skip the search
+			const Vector<PathCacheStep> &steps = C->get();
+			for (int i = 0; i < steps.size(); i++) {
+				steps[i].poly->prev_edge = steps[i].prev_edge;
+				steps[i].poly->entry = steps[i].entry;
+			}
+			found_route = true;
+		}
+	}
+
+	query_pass++; // Polygons visited by this search are tagged with it.
 
-			begin_poly->edges[i].C->prev_edge = begin_poly->edges[i].C_edge;
+	if (!found_route) {
+
+		path_open_list_size = 0; // Reuse the buffer of previous queries.
+
+		for (int i = 0; i < begin_poly->edges.size(); i++) {
+
+			if (begin_poly->edges[i].C) {
+
+				begin_poly->edges[i].C->query_pass = query_pass;
+				begin_poly->edges[i].C->prev_edge = begin_poly->edges[i].C_edge;
 #ifdef USE_ENTRY_POINT
-			Vector3 edge[2] = {
-				_get_vertex(begin_poly->edges[i].point),
-				_get_vertex(begin_poly->edges[(i + 1) % begin_poly->edges.size()].point)
-			};
-
-			Vector3 entry = Geometry::get_closest_point_to_segment(begin_poly->entry, edge);
-			begin_poly->edges[i].C->distance = begin_point.distance_to(entry);
-			begin_poly->edges[i].C->entry = entry;
+				Vector3 edge[2] = {
+					_get_vertex(begin_poly->edges[i].point),
+					_get_vertex(begin_poly->edges[(i + 1) % begin_poly->edges.size()].point)
+				};
+
+				Vector3 entry = Geometry::get_closest_point_to_segment(begin_poly->entry, edge);
+				begin_poly->edges[i].C->distance = begin_point.distance_to(entry);
+				begin_poly->edges[i].C->entry = entry;
 #else
-			begin_poly->edges[i].C->distance = begin_poly->center.distance_to(begin_poly->edges[i].C->center);
+				begin_poly->edges[i].C->distance = begin_poly->center.distance_to(begin_poly->edges[i].C->center);
 #endif
-			open_list.push_back(begin_poly->edges[i].C);
+				if (path_open_list_size == path_open_list.size()) {
+					path_open_list.resize(path_open_list_size * 2 + 1);
+				}
+				path_open_list.write[path_open_list_size++] = begin_poly->edges[i].C;
+			}
 		}
-	}
 
-	while (!found_route) {
+		while (!found_route) {
 
-		if (open_list.size() == 0) {
-			break;
-		}
-		//check open list
+			if (path_open_list_size == 0) {
+				break;
+			}
+			//check open list
 
-		List<Polygon *>::Element *least_cost_poly = NULL;
-		float least_cost = 1e30;
+			int least_cost_idx = -1;
+			float least_cost = 1e30;
 
-		//this could be faster (cache previous results)
-		for (List<Polygon *>::Element *E = open_list.front(); E; E = E->next()) {
+			//this could be faster (cache previous results)
+			for (int i = 0; i < path_open_list_size; i++) {
 
-			Polygon *p = E->get();
+				Polygon *lp = path_open_list[i];
 
-			float cost = p->distance;
+				float cost = lp->distance;
 #ifdef USE_ENTRY_POINT
-			cost += p->entry.distance_to(end_point);
+				cost += lp->entry.distance_to(end_point);
 #else
-			cost += p->center.distance_to(end_point);
+				cost += lp->center.distance_to(end_point);
 #endif
-			if (cost < least_cost) {
-				least_cost_poly = E;
-				least_cost = cost;
+				if (cost < least_cost) {
+					least_cost_idx = i;
+					least_cost = cost;
+				}
 			}
-		}
 
-		Polygon *p = least_cost_poly->get();
-		//open the neighbours for search
+			Polygon *p = path_open_list[least_cost_idx];
+			//open the neighbours for search
 
-		if (p == end_poly) {
-			//oh my reached end! stop algorithm
-			found_route = true;
-			break;
-		}
+			if (p == end_poly) {
+				//oh my reached end! stop algorithm
+				found_route = true;
+				break;
+			}
 
-		for (int i = 0; i < p->edges.size(); i++) {
+			for (int i = 0; i < p->edges.size(); i++) {
 
-			Polygon::Edge &e = p->edges.write[i];
+				Polygon::Edge &e = p->edges.write[i];
 
-			if (!e.C)
-				continue;
+				if (!e.C)
+					continue;
 
 #ifdef USE_ENTRY_POINT
-			Vector3 edge[2] = {
-				_get_vertex(p->edges[i].point),
-				_get_vertex(p->edges[(i + 1) % p->edges.size()].point)
-			};
+				Vector3 edge[2] = {
+					_get_vertex(p->edges[i].point),
+					_get_vertex(p->edges[(i + 1) % p->edges.size()].point)
+				};
 
-			Vector3 entry = Geometry::get_closest_point_to_segment(p->entry, edge);
-			float distance = p->entry.distance_to(entry) + p->distance;
+				Vector3 entry = Geometry::get_closest_point_to_segment(p->entry, edge);
+				float distance = p->entry.distance_to(entry) + p->distance;
 #else
-			float distance = p->center.distance_to(e.C->center) + p->distance;
+				float distance = p->center.distance_to(e.C->center) + p->distance;
 #endif
 
-			if (e.C->prev_edge != -1) {
-				//oh this was visited already, can we win the cost?
+				if (e.C->query_pass == query_pass) {
+					//oh this was visited already, can we win the cost?
 
-				if (e.C->distance > distance) {
+					if (e.C->distance > distance) {
+
+						e.C->prev_edge = e.C_edge;
+						e.C->distance = distance;
+#ifdef USE_ENTRY_POINT
+						e.C->entry = entry;
+#endif
+					}
+				} else {
+					//add to open neighbours
 
+					e.C->query_pass = query_pass;
 					e.C->prev_edge = e.C_edge;
 					e.C->distance = distance;
 #ifdef USE_ENTRY_POINT
 					e.C->entry = entry;
 #endif
+					if (path_open_list_size == path_open_list.size()) {
+						path_open_list.resize(path_open_list_size * 2 + 1);
+					}
+					path_open_list.write[path_open_list_size++] = e.C;
 				}
-			} else {
-				//add to open neighbours
-
-				e.C->prev_edge = e.C_edge;
-				e.C->distance = distance;
-#ifdef USE_ENTRY_POINT
-				e.C->entry = entry;
-#endif
-				open_list.push_back(e.C);
 			}
+
+			path_open_list.write[least_cost_idx] = path_open_list[path_open_list_size - 1];
+			path_open_list_size--;
 		}
 
-		open_list.erase(least_cost_poly);
+		if (found_route && use_path_cache && !path_cache.has(cache_key)) {
+
+			if (path_cache.size() >= PATH_CACHE_MAX_ENTRIES) {
+				path_cache.clear(); //simple but bounded
+			}
+
+			Vector<PathCacheStep> steps;
+			Polygon *p = end_poly;
+			while (p != begin_poly) {
+				PathCacheStep step;
+				step.poly = p;
+				step.prev_edge = p->prev_edge;
+				step.entry = p->entry;
+				steps.push_back(step);
+				p = p->edges[p->prev_edge].C;
+			}
+			path_cache[cache_key] = steps;
+		}
 	}
 
 	if (found_route) {
@@ -605,27 +776,9 @@ Vector3 Navigation::get_closest_point_to_segment(const Vector3 &p_from, const Ve
 Vector3 Navigation::get_closest_point(const Vector3 &p_point) {
 
 	Vector3 closest_point;
-	float closest_point_d = 1e20;
+	Vector3 normal;
 
-	for (Map<int, NavMesh>::Element *E = navmesh_map.front(); E; E = E->next()) {
-
-		if (!E->get().linked)
-			continue;
-		for (List<Polygon>::Element *F = E->get().polygons.front(); F; F = F->next()) {
-
-			Polygon &p = F->get();
-			for (int i = 2; i < p.edges.size(); i++) {
-
-				Face3 f(_get_vertex(p.edges[0].point), _get_vertex(p.edges[i - 1].point), _get_vertex(p.edges[i].point));
-				Vector3 inters = f.get_closest_point_to(p_point);
-				float d = inters.distance_to(p_point);
-				if (d < closest_point_d) {
-					closest_point = inters;
-					closest_point_d = d;
-				}
-			}
-		}
-	}
+	_get_closest_polygon_point(p_point, closest_point, normal);
 
 	return closest_point;
 }
@@ -634,28 +787,8 @@ Vector3 Navigation::get_closest_point_normal(const Vector3 &p_point) {
 
 	Vector3 closest_point;
 	Vector3 closest_normal;
-	float closest_point_d = 1e20;
 
-	for (Map<int, NavMesh>::Element *E = navmesh_map.front(); E; E = E->next()) {
-
-		if (!E->get().linked)
-			continue;
-		for (List<Polygon>::Element *F = E->get().polygons.front(); F; F = F->next()) {
-
-			Polygon &p = F->get();
-			for (int i = 2; i < p.edges.size(); i++) {
-
-				Face3 f(_get_vertex(p.edges[0].point), _get_vertex(p.edges[i - 1].point), _get_vertex(p.edges[i].point));
-				Vector3 inters = f.get_closest_point_to(p_point);
-				float d = inters.distance_to(p_point);
-				if (d < closest_point_d) {
-					closest_point = inters;
-					closest_point_d = d;
-					closest_normal = f.get_plane().normal;
-				}
-			}
-		}
-	}
+	_get_closest_polygon_point(p_point, closest_point, closest_normal);
 
 	return closest_normal;
 }
@@ -663,31 +796,14 @@ Vector3 Navigation::get_closest_point_normal(const Vector3 &p_point) {
 Object *Navigation::get_closest_point_owner(const Vector3 &p_point) {
 
 	Vector3 closest_point;
-	Object *owner = NULL;
-	float closest_point_d = 1e20;
+	Vector3 normal;
 
-	for (Map<int, NavMesh>::Element *E = navmesh_map.front(); E; E = E->next()) {
-
-		if (!E->get().linked)
-			continue;
-		for (List<Polygon>::Element *F = E->get().polygons.front(); F; F = F->next()) {
-
-			Polygon &p = F->get();
-			for (int i = 2; i < p.edges.size(); i++) {
-
-				Face3 f(_get_vertex(p.edges[0].point), _get_vertex(p.edges[i - 1].point), _get_vertex(p.edges[i].point));
-				Vector3 inters = f.get_closest_point_to(p_point);
-				float d = inters.distance_to(p_point);
-				if (d < closest_point_d) {
-					closest_point = inters;
-					closest_point_d = d;
-					owner = E->get().owner;
-				}
-			}
-		}
+	Polygon *p = _get_closest_polygon_point(p_point, closest_point, normal);
+	if (!p) {
+		return NULL;
 	}
 
-	return owner;
+	return p->owner->owner;
 }
 
 void Navigation::set_up_vector(const Vector3 &p_up) {
@@ -700,6 +816,19 @@ Vector3 Navigation::get_up_vector() const {
 	return up;
 }
 
+void Navigation::set_use_path_cache(bool p_enabled) {
+
+	use_path_cache = p_enabled;
+	if (!use_path_cache) {
+		path_cache.clear();
+	}
+}
+
+bool Navigation::is_using_path_cache() const {
+
+	return use_path_cache;
+}
+
 void Navigation::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("navmesh_add", "mesh", "xform", "owner"), &Navigation::navmesh_add, DEFVAL(Variant()));
@@ -715,13 +844,23 @@ void Navigation::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_up_vector", "up"), &Navigation::set_up_vector);
 	ClassDB::bind_method(D_METHOD("get_up_vector"), &Navigation::get_up_vector);
 
+	ClassDB::bind_method(D_METHOD("set_use_path_cache", "enabled"), &Navigation::set_use_path_cache);
+	ClassDB::bind_method(D_METHOD("is_using_path_cache"), &Navigation::is_using_path_cache);
+
 	ADD_PROPERTY(PropertyInfo(Variant::VECTOR3, "up_vector"), "set_up_vector", "get_up_vector");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_path_cache"), "set_use_path_cache", "is_using_path_cache");
 }
 
 Navigation::Navigation() {
 
 	ERR_FAIL_COND(sizeof(Point) != 8);
 	cell_size = 0.01; //one centimeter
+	grid_cell_size = 8; //a few polygons per cell for typical meshes, coarse is fine
+	grid_polygon_count = 0;
+	grid_min_x = grid_min_z = grid_max_x = grid_max_z = 0;
+	query_pass = 0;
+	use_path_cache = false;
+	path_open_list_size = 0;
 	last_id = 1;
 	up = Vector3(0, 1, 0);
 }
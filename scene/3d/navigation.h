@@ -31,6 +31,8 @@
 #ifndef NAVIGATION_H
 #define NAVIGATION_H
 
+#include "core/hash_map.h"
+#include "core/oa_hash_map.h"
 #include "scene/3d/navigation_mesh.h"
 #include "scene/3d/spatial.h"
 
@@ -59,6 +61,10 @@ class Navigation : public Spatial {
 			return (a.key == p_key.a.key) ? (b.key < p_key.b.key) : (a.key < p_key.a.key);
 		};
 
+		bool operator==(const EdgeKey &p_key) const {
+			return a.key == p_key.a.key && b.key == p_key.b.key;
+		};
+
 		EdgeKey(const Point &p_a = Point(), const Point &p_b = Point()) :
 				a(p_a),
 				b(p_b) {
@@ -68,6 +74,13 @@ class Navigation : public Spatial {
 		}
 	};
 
+	struct EdgeKeyHasher {
+		static _FORCE_INLINE_ uint32_t hash(const EdgeKey &p_key) {
+			uint64_t h = hash_djb2_one_64(p_key.a.key);
+			return (uint32_t)hash_djb2_one_64(p_key.b.key, h);
+		}
+	};
+
 	struct NavMesh;
 	struct Polygon;
 
@@ -95,9 +108,11 @@ class Navigation : public Spatial {
 
 		Vector3 center;
 		Vector3 entry;
+		AABB aabb;
 
 		float distance;
 		int prev_edge;
+		uint64_t query_pass;
 		bool clockwise;
 
 		NavMesh *owner;
@@ -120,7 +135,7 @@ class Navigation : public Spatial {
 		}
 	};
 
-	Map<EdgeKey, Connection> connections;
+	HashMap<EdgeKey, Connection, EdgeKeyHasher> connections;
 
 	struct NavMesh {
 
@@ -153,6 +168,54 @@ class Navigation : public Spatial {
 	void _navmesh_link(int p_id);
 	void _navmesh_unlink(int p_id);
 
+	// Polygons are indexed in a uniform grid on the XZ plane so point queries
+	// scan outward from the query cell instead of visiting every polygon, and
+	// linking/unlinking a region only touches the cells that region overlaps.
+	float grid_cell_size;
+	OAHashMap<uint64_t, Vector<Polygon *> > grid;
+	int grid_polygon_count;
+	int grid_min_x, grid_min_z, grid_max_x, grid_max_z; // Cell bounds of everything inserted, caps the ring search.
+	uint64_t query_pass; // Guards against visiting a polygon twice in one query, also marks A* visits.
+
+	_FORCE_INLINE_ uint64_t _grid_key(int p_x, int p_z) const {
+		return (uint64_t(uint32_t(p_x)) << 32) | uint32_t(p_z);
+	}
+
+	void _grid_insert(Polygon *p_polygon);
+	void _grid_remove(Polygon *p_polygon);
+	void _grid_scan_cell(int p_x, int p_z, const Vector3 &p_point, Polygon *&r_polygon, Vector3 &r_point, Vector3 &r_normal, float &r_dist);
+	Polygon *_get_closest_polygon_point(const Vector3 &p_point, Vector3 &r_point, Vector3 &r_normal);
+
+	// Scratch open list for get_simple_path, reused between queries, and an
+	// optional cache of solved polygon corridors keyed by the endpoint
+	// polygons. The cache holds corridors, not final paths: the funnel pass
+	// still runs per call, so moving start/end points inside the same
+	// polygons stay exact while the A* is skipped. Any navmesh change clears
+	// the cache, which also keeps the polygon pointers in the keys valid.
+	enum {
+		PATH_CACHE_MAX_ENTRIES = 128
+	};
+
+	struct PathCacheKey {
+		Polygon *begin;
+		Polygon *end;
+		bool operator<(const PathCacheKey &p_key) const {
+			return (begin == p_key.begin) ? (end < p_key.end) : (begin < p_key.begin);
+		}
+	};
+
+	struct PathCacheStep {
+		Polygon *poly;
+		int prev_edge;
+		Vector3 entry;
+	};
+
+	bool use_path_cache;
+	Map<PathCacheKey, Vector<PathCacheStep> > path_cache;
+
+	Vector<Polygon *> path_open_list;
+	int path_open_list_size;
+
 	float cell_size;
 	Map<int, NavMesh> navmesh_map;
 	int last_id;
@@ -167,6 +230,9 @@ public:
 	void set_up_vector(const Vector3 &p_up);
 	Vector3 get_up_vector() const;
 
+	void set_use_path_cache(bool p_enabled);
+	bool is_using_path_cache() const;
+
 	//API should be as dynamic as possible
 	int navmesh_add(const Ref<NavigationMesh> &p_mesh, const Transform &p_xform, Object *p_owner = NULL);
 	void navmesh_set_transform(int p_id, const Transform &p_xform);
@@ -0,0 +1,169 @@
+/*************************************************************************/
+/*  portal.cpp                                                           */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "portal.h"
+
+#include "scene/3d/room.h"
+#include "servers/visual_server.h"
+
+void Portal::_update_geometry() {
+
+	if (!is_inside_world())
+		return;
+
+	Transform t = get_global_transform();
+	Vector2 half = size * 0.5;
+
+	Vector<Vector3> points;
+	points.push_back(t.xform(Vector3(-half.x, -half.y, 0)));
+	points.push_back(t.xform(Vector3(half.x, -half.y, 0)));
+	points.push_back(t.xform(Vector3(half.x, half.y, 0)));
+	points.push_back(t.xform(Vector3(-half.x, half.y, 0)));
+
+	VisualServer::get_singleton()->portal_set_geometry(portal, points);
+}
+
+void Portal::_update_rooms() {
+
+	if (!is_inside_tree())
+		return;
+
+	Room *a = Object::cast_to<Room>(get_node_or_null(room_a));
+	Room *b = Object::cast_to<Room>(get_node_or_null(room_b));
+
+	VisualServer::get_singleton()->portal_set_rooms(portal, a ? a->get_rid() : RID(), b ? b->get_rid() : RID());
+}
+
+void Portal::_notification(int p_what) {
+
+	switch (p_what) {
+		case NOTIFICATION_ENTER_WORLD: {
+
+			VisualServer::get_singleton()->portal_set_scenario(portal, get_world()->get_scenario());
+			_update_geometry();
+		} break;
+		case NOTIFICATION_READY: {
+
+			//siblings are guaranteed to be in the tree by now, the room
+			//paths could not be resolved when entering the world
+			_update_rooms();
+		} break;
+		case NOTIFICATION_TRANSFORM_CHANGED: {
+
+			_update_geometry();
+		} break;
+		case NOTIFICATION_EXIT_WORLD: {
+
+			VisualServer::get_singleton()->portal_set_scenario(portal, RID());
+		} break;
+	}
+}
+
+void Portal::set_size(const Vector2 &p_size) {
+
+	size = p_size;
+	_update_geometry();
+	_change_notify("size");
+	update_gizmo();
+}
+
+Vector2 Portal::get_size() const {
+
+	return size;
+}
+
+void Portal::set_room_a(const NodePath &p_room) {
+
+	room_a = p_room;
+	_update_rooms();
+}
+
+NodePath Portal::get_room_a() const {
+
+	return room_a;
+}
+
+void Portal::set_room_b(const NodePath &p_room) {
+
+	room_b = p_room;
+	_update_rooms();
+}
+
+NodePath Portal::get_room_b() const {
+
+	return room_b;
+}
+
+void Portal::set_enabled(bool p_enabled) {
+
+	enabled = p_enabled;
+	VisualServer::get_singleton()->portal_set_enabled(portal, enabled);
+}
+
+bool Portal::is_enabled() const {
+
+	return enabled;
+}
+
+RID Portal::get_rid() const {
+
+	return portal;
+}
+
+void Portal::_bind_methods() {
+
+	ClassDB::bind_method(D_METHOD("set_size", "size"), &Portal::set_size);
+	ClassDB::bind_method(D_METHOD("get_size"), &Portal::get_size);
+	ClassDB::bind_method(D_METHOD("set_room_a", "room"), &Portal::set_room_a);
+	ClassDB::bind_method(D_METHOD("get_room_a"), &Portal::get_room_a);
+	ClassDB::bind_method(D_METHOD("set_room_b", "room"), &Portal::set_room_b);
+	ClassDB::bind_method(D_METHOD("get_room_b"), &Portal::get_room_b);
+	ClassDB::bind_method(D_METHOD("set_enabled", "enabled"), &Portal::set_enabled);
+	ClassDB::bind_method(D_METHOD("is_enabled"), &Portal::is_enabled);
+	ClassDB::bind_method(D_METHOD("get_rid"), &Portal::get_rid);
+
+	ADD_PROPERTY(PropertyInfo(Variant::VECTOR2, "size"), "set_size", "get_size");
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "room_a", PROPERTY_HINT_NODE_PATH_VALID_TYPES, "Room"), "set_room_a", "get_room_a");
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "room_b", PROPERTY_HINT_NODE_PATH_VALID_TYPES, "Room"), "set_room_b", "get_room_b");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "enabled"), "set_enabled", "is_enabled");
+}
+
+Portal::Portal() {
+
+	portal = VisualServer::get_singleton()->portal_create();
+	size = Vector2(2, 2);
+	enabled = true;
+	set_notify_transform(true);
+}
+
+Portal::~Portal() {
+
+	VisualServer::get_singleton()->free(portal);
+}
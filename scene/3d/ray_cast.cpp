@@ -35,6 +35,9 @@
 #include "mesh_instance.h"
 #include "servers/physics_server.h"
 
+SelfList<RayCast>::List RayCast::batch_list;
+uint64_t RayCast::batch_flush_frame = (uint64_t)-1;
+
 void RayCast::set_cast_to(const Vector3 &p_point) {
 
 	cast_to = p_point;
@@ -106,6 +109,7 @@ void RayCast::set_enabled(bool p_enabled) {
 
 	if (is_inside_tree() && !Engine::get_singleton()->is_editor_hint())
 		set_physics_process_internal(p_enabled);
+	_update_batch_registration();
 	if (!p_enabled)
 		collided = false;
 
@@ -166,6 +170,8 @@ void RayCast::_notification(int p_what) {
 					exclude.erase(Object::cast_to<CollisionObject>(get_parent())->get_rid());
 			}
 
+			_update_batch_registration();
+
 		} break;
 		case NOTIFICATION_EXIT_TREE: {
 
@@ -173,6 +179,9 @@ void RayCast::_notification(int p_what) {
 				set_physics_process_internal(false);
 			}
 
+			if (batch_element.in_list())
+				batch_list.remove(&batch_element);
+
 			if (debug_shape)
 				_clear_debug_shape();
 
@@ -182,8 +191,21 @@ void RayCast::_notification(int p_what) {
 			if (!enabled)
 				break;
 
-			bool prev_collision_state = collided;
-			_update_raycast_state();
+			uint64_t frame = Engine::get_singleton()->get_physics_frames();
+			if (batch_flush_frame != frame) {
+				batch_flush_frame = frame;
+				_flush_batch();
+			}
+
+			bool prev_collision_state;
+			if (batched_frame == frame) {
+				//results were already written back by this frame's batched query
+				prev_collision_state = batch_prev_collided;
+			} else {
+				//not covered by the batch (e.g. enabled after the flush)
+				prev_collision_state = collided;
+				_update_raycast_state();
+			}
 			if (prev_collision_state != collided && get_tree()->is_debugging_collisions_hint()) {
 				if (debug_material.is_valid()) {
 					Ref<SpatialMaterial> line_material = static_cast<Ref<SpatialMaterial> >(debug_material);
@@ -228,6 +250,114 @@ void RayCast::force_raycast_update() {
 	_update_raycast_state();
 }
 
+void RayCast::_update_batch_registration() {
+
+	bool batched = enabled && is_inside_tree() && !Engine::get_singleton()->is_editor_hint();
+
+	if (batched == batch_element.in_list())
+		return;
+
+	if (batched)
+		batch_list.add(&batch_element);
+	else
+		batch_list.remove(&batch_element);
+}
+
+void RayCast::_flush_batch() {
+
+	int count = 0;
+	for (SelfList<RayCast> *e = batch_list.first(); e; e = e->next())
+		count++;
+
+	if (count < 2)
+		return; //nothing to share, let the notification handler query individually
+
+	Vector<RayCast *> nodes;
+	Vector<PhysicsDirectSpaceState *> states;
+	nodes.resize(count);
+	states.resize(count);
+
+	int valid = 0;
+	for (SelfList<RayCast> *e = batch_list.first(); e; e = e->next()) {
+
+		RayCast *rc = e->self();
+		Ref<World> w3d = rc->get_world();
+		if (w3d.is_null())
+			continue;
+		PhysicsDirectSpaceState *dss = PhysicsServer::get_singleton()->space_get_direct_state(w3d->get_space());
+		if (!dss)
+			continue;
+		nodes.write[valid] = rc;
+		states.write[valid] = dss;
+		valid++;
+	}
+
+	uint64_t frame = Engine::get_singleton()->get_physics_frames();
+
+	Vector<Vector3> from;
+	Vector<Vector3> to;
+	Vector<const Set<RID> *> excludes;
+	Vector<RayCast *> group;
+	Vector<PhysicsDirectSpaceState::RayResult> results;
+	Vector<bool> hits;
+
+	for (int i = 0; i < valid; i++) {
+
+		RayCast *first = nodes[i];
+		if (!first)
+			continue; //consumed by an earlier group
+
+		from.clear();
+		to.clear();
+		excludes.clear();
+		group.clear();
+
+		//everything sharing this space and filter settings becomes one batch
+		for (int j = i; j < valid; j++) {
+
+			RayCast *rc = nodes[j];
+			if (!rc || states[j] != states[i] || rc->collision_mask != first->collision_mask || rc->collide_with_bodies != first->collide_with_bodies || rc->collide_with_areas != first->collide_with_areas)
+				continue;
+
+			Transform gt = rc->get_global_transform();
+
+			Vector3 t = rc->cast_to;
+			if (t == Vector3())
+				t = Vector3(0, 0.01, 0);
+
+			from.push_back(gt.get_origin());
+			to.push_back(gt.xform(t));
+			excludes.push_back(&rc->exclude);
+			group.push_back(rc);
+			nodes.write[j] = NULL;
+		}
+
+		int ray_count = group.size();
+		results.resize(ray_count);
+		hits.resize(ray_count);
+
+		states[i]->intersect_ray_batch(from.ptr(), to.ptr(), ray_count, results.ptrw(), hits.ptrw(), Set<RID>(), first->collision_mask, first->collide_with_bodies, first->collide_with_areas, excludes.ptr());
+
+		for (int j = 0; j < ray_count; j++) {
+
+			RayCast *rc = group[j];
+			rc->batch_prev_collided = rc->collided;
+			if (hits[j]) {
+				rc->collided = true;
+				rc->against = results[j].collider_id;
+				rc->collision_point = results[j].position;
+				rc->collision_normal = results[j].normal;
+				rc->against_shape = results[j].shape;
+			} else {
+				rc->collided = false;
+				rc->against = 0;
+				rc->against_shape = 0;
+			}
+			rc->batched_frame = frame;
+		}
+	}
+}
+
 void RayCast::add_exception_rid(const RID &p_rid) {
 
 	exclude.insert(p_rid);
@@ -392,9 +522,12 @@ void RayCast::_clear_debug_shape() {
 	debug_shape = NULL;
 }
 
-RayCast::RayCast() {
+RayCast::RayCast() :
+		batch_element(this) {
 
 	enabled = false;
+	batched_frame = (uint64_t)-1;
+	batch_prev_collided = false;
 	against = 0;
 	collided = false;
 	against_shape = 0;
@@ -31,6 +31,7 @@
 #ifndef RAY_CAST_H
 #define RAY_CAST_H
 
+#include "core/self_list.h"
 #include "scene/3d/spatial.h"
 
 class RayCast : public Spatial {
@@ -60,6 +61,19 @@ class RayCast : public Spatial {
 	bool collide_with_areas;
 	bool collide_with_bodies;
 
+	// All enabled in-tree raycasts register here; the first one processed
+	// each physics frame issues a single batched space query for the whole
+	// list, sharing the broadphase traversal between them.
+	SelfList<RayCast> batch_element;
+	uint64_t batched_frame;
+	bool batch_prev_collided;
+
+	static SelfList<RayCast>::List batch_list;
+	static uint64_t batch_flush_frame;
+
+	void _update_batch_registration();
+	static void _flush_batch();
+
 protected:
 	void _notification(int p_what);
 	void _update_raycast_state();
@@ -0,0 +1,113 @@
+/*************************************************************************/
+/*  room.cpp                                                             */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "room.h"
+
+#include "servers/visual_server.h"
+
+void Room::_update_bounds() {
+
+	if (!is_inside_world())
+		return;
+
+	Transform t = get_global_transform();
+
+	//the six planes of the (possibly rotated and scaled) box, facing outwards
+	Vector<Plane> bounds;
+	for (int i = 0; i < 3; i++) {
+
+		Vector3 axis = t.basis.get_axis(i);
+		Vector3 face = axis * extents[i];
+		axis.normalize();
+
+		bounds.push_back(Plane(axis, axis.dot(t.origin + face)));
+		bounds.push_back(Plane(-axis, -axis.dot(t.origin - face)));
+	}
+
+	VisualServer::get_singleton()->room_set_bounds(room, bounds);
+}
+
+void Room::_notification(int p_what) {
+
+	switch (p_what) {
+		case NOTIFICATION_ENTER_WORLD: {
+
+			VisualServer::get_singleton()->room_set_scenario(room, get_world()->get_scenario());
+			_update_bounds();
+		} break;
+		case NOTIFICATION_TRANSFORM_CHANGED: {
+
+			_update_bounds();
+		} break;
+		case NOTIFICATION_EXIT_WORLD: {
+
+			VisualServer::get_singleton()->room_set_scenario(room, RID());
+		} break;
+	}
+}
+
+void Room::set_extents(const Vector3 &p_extents) {
+
+	extents = p_extents;
+	_update_bounds();
+	_change_notify("extents");
+	update_gizmo();
+}
+
+Vector3 Room::get_extents() const {
+
+	return extents;
+}
+
+RID Room::get_rid() const {
+
+	return room;
+}
+
+void Room::_bind_methods() {
+
+	ClassDB::bind_method(D_METHOD("set_extents", "extents"), &Room::set_extents);
+	ClassDB::bind_method(D_METHOD("get_extents"), &Room::get_extents);
+	ClassDB::bind_method(D_METHOD("get_rid"), &Room::get_rid);
+
+	ADD_PROPERTY(PropertyInfo(Variant::VECTOR3, "extents"), "set_extents", "get_extents");
+}
+
+Room::Room() {
+
+	room = VisualServer::get_singleton()->room_create();
+	extents = Vector3(1, 1, 1);
+	set_notify_transform(true);
+}
+
+Room::~Room() {
+
+	VisualServer::get_singleton()->free(room);
+}
@@ -312,6 +312,7 @@ void Skeleton::_notification(int p_what) {
 			}
 
 			//update skins
+			Vector<Transform> skin_transforms;
 			for (Set<SkinReference *>::Element *E = skin_bindings.front(); E; E = E->next()) {
 
 				const Skin *skin = E->get()->skin.operator->();
@@ -323,11 +324,18 @@ void Skeleton::_notification(int p_what) {
 					E->get()->bind_count = bind_count;
 				}
 
+				skin_transforms.resize(bind_count);
+				Transform *skin_transforms_ptr = skin_transforms.ptrw();
+
 				for (uint32_t i = 0; i < bind_count; i++) {
 					uint32_t bone_index = skin->get_bind_bone(i);
+					skin_transforms_ptr[i] = Transform();
 					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					vs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].pose_global * skin->get_bind_pose(i));
+					skin_transforms_ptr[i] = bonesptr[bone_index].pose_global * skin->get_bind_pose(i);
 				}
+
+				//single upload instead of one server call per bone
+				vs->skeleton_set_bone_transforms(skeleton, skin_transforms);
 			}
 
 			dirty = false;
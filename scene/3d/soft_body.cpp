@@ -80,14 +80,6 @@ void SoftBodyVisualServerHandler::commit_changes() {
 	VS::get_singleton()->mesh_surface_update_region(mesh, surface, 0, buffer);
 }
 
-void SoftBodyVisualServerHandler::set_vertex(int p_vertex_id, const void *p_vector3) {
-	copymem(&write_buffer[p_vertex_id * stride + offset_vertices], p_vector3, sizeof(float) * 3);
-}
-
-void SoftBodyVisualServerHandler::set_normal(int p_vertex_id, const void *p_vector3) {
-	copymem(&write_buffer[p_vertex_id * stride + offset_normal], p_vector3, sizeof(float) * 3);
-}
-
 void SoftBodyVisualServerHandler::set_aabb(const AABB &p_aabb) {
 	VS::get_singleton()->mesh_set_custom_aabb(mesh, p_aabb);
 }
@@ -31,6 +31,7 @@
 #ifndef SOFT_PHYSICS_BODY_H
 #define SOFT_PHYSICS_BODY_H
 
+#include "core/os/copymem.h"
 #include "scene/3d/mesh_instance.h"
 
 class SoftBody;
@@ -58,8 +59,12 @@ private:
 	void commit_changes();
 
 public:
-	void set_vertex(int p_vertex_id, const void *p_vector3);
-	void set_normal(int p_vertex_id, const void *p_vector3);
+	_FORCE_INLINE_ void set_vertex(int p_vertex_id, const void *p_vector3) {
+		copymem(&write_buffer[p_vertex_id * stride + offset_vertices], p_vector3, sizeof(float) * 3);
+	}
+	_FORCE_INLINE_ void set_normal(int p_vertex_id, const void *p_vector3) {
+		copymem(&write_buffer[p_vertex_id * stride + offset_normal], p_vector3, sizeof(float) * 3);
+	}
 	void set_aabb(const AABB &p_aabb);
 };
 
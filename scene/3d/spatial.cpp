@@ -96,17 +96,18 @@ void Spatial::_propagate_transform_changed(Spatial *p_origin) {
 		return;
 	}
 
-	/*
-	if (data.dirty&DIRTY_GLOBAL)
-		return; //already dirty
-	*/
-
 	data.children_lock++;
 
 	for (List<Spatial *>::Element *E = data.children.front(); E; E = E->next()) {
 
 		if (E->get()->data.toplevel_active)
 			continue; //don't propagate to a toplevel
+		if ((E->get()->data.dirty & DIRTY_GLOBAL) && E->get()->data.subtree_propagated) {
+			//still fully marked and queued from an earlier propagation; cleaning any
+			//descendant also cleans its ancestors (get_global_transform pulls the whole
+			//chain), so a dirty child here means its subtree is dirty too
+			continue;
+		}
 		E->get()->_propagate_transform_changed(p_origin);
 	}
 #ifdef TOOLS_ENABLED
@@ -117,6 +118,7 @@ void Spatial::_propagate_transform_changed(Spatial *p_origin) {
 		get_tree()->xform_change_list.add(&xform_change);
 	}
 	data.dirty |= DIRTY_GLOBAL;
+	data.subtree_propagated = true;
 
 	data.children_lock--;
 }
@@ -146,6 +148,7 @@ void Spatial::_notification(int p_what) {
 			}
 
 			data.dirty |= DIRTY_GLOBAL; //global is always dirty upon entering a scene
+			data.subtree_propagated = false;
 			_notify_dirty();
 
 			notification(NOTIFICATION_ENTER_WORLD);
@@ -218,6 +221,15 @@ void Spatial::_notification(int p_what) {
 
 		case NOTIFICATION_TRANSFORM_CHANGED: {
 
+			//this node just left the change queue; if it stays dirty (the handler may
+			//never query the global transform), ancestors must not skip its subtree or
+			//a later move would fail to requeue it
+			Spatial *s = this;
+			while (s) {
+				s->data.subtree_propagated = false;
+				s = s->data.parent;
+			}
+
 #ifdef TOOLS_ENABLED
 			if (data.gizmo.is_valid()) {
 				data.gizmo->transform();
@@ -483,6 +495,23 @@ bool Spatial::is_scale_disabled() const {
 	return data.disable_scale;
 }
 
+void Spatial::set_physics_interpolated(bool p_enabled) {
+
+	if (data.physics_interpolated == p_enabled)
+		return;
+
+	data.physics_interpolated = p_enabled;
+	_physics_interpolated_changed();
+}
+
+bool Spatial::is_physics_interpolated() const {
+	return data.physics_interpolated;
+}
+
+void Spatial::_physics_interpolated_changed() {
+	//nodes with server-side state (VisualInstance) forward the flag there
+}
+
 void Spatial::set_as_toplevel(bool p_enabled) {
 
 	if (data.toplevel == p_enabled)
@@ -756,6 +785,8 @@ void Spatial::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_set_as_toplevel"), &Spatial::is_set_as_toplevel);
 	ClassDB::bind_method(D_METHOD("set_disable_scale", "disable"), &Spatial::set_disable_scale);
 	ClassDB::bind_method(D_METHOD("is_scale_disabled"), &Spatial::is_scale_disabled);
+	ClassDB::bind_method(D_METHOD("set_physics_interpolated", "enabled"), &Spatial::set_physics_interpolated);
+	ClassDB::bind_method(D_METHOD("is_physics_interpolated"), &Spatial::is_physics_interpolated);
 	ClassDB::bind_method(D_METHOD("get_world"), &Spatial::get_world);
 
 	ClassDB::bind_method(D_METHOD("force_update_transform"), &Spatial::force_update_transform);
@@ -812,6 +843,8 @@ void Spatial::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::VECTOR3, "scale", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_EDITOR), "set_scale", "get_scale");
 	ADD_GROUP("Matrix", "");
 	ADD_PROPERTY(PropertyInfo(Variant::TRANSFORM, "transform", PROPERTY_HINT_NONE, ""), "set_transform", "get_transform");
+	ADD_GROUP("Interpolation", "");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "physics_interpolated"), "set_physics_interpolated", "is_physics_interpolated");
 	ADD_GROUP("Visibility", "");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "visible"), "set_visible", "is_visible");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "gizmo", PROPERTY_HINT_RESOURCE_TYPE, "SpatialGizmo", 0), "set_gizmo", "get_gizmo");
@@ -823,6 +856,7 @@ Spatial::Spatial() :
 		xform_change(this) {
 
 	data.dirty = DIRTY_NONE;
+	data.subtree_propagated = false;
 	data.children_lock = 0;
 
 	data.ignore_notification = false;
@@ -833,6 +867,7 @@ Spatial::Spatial() :
 	data.inside_world = false;
 	data.visible = true;
 	data.disable_scale = false;
+	data.physics_interpolated = false;
 
 #ifdef TOOLS_ENABLED
 	data.gizmo_disabled = false;
@@ -71,6 +71,9 @@ class Spatial : public Node {
 		mutable Vector3 scale;
 
 		mutable int dirty;
+		//the whole subtree below is still marked DIRTY_GLOBAL and queued for
+		//notification since this node last went dirty, so propagation can skip it
+		bool subtree_propagated;
 
 		Viewport *viewport;
 
@@ -89,6 +92,7 @@ class Spatial : public Node {
 
 		bool visible;
 		bool disable_scale;
+		bool physics_interpolated;
 
 #ifdef TOOLS_ENABLED
 		Ref<SpatialGizmo> gizmo;
@@ -107,6 +111,8 @@ class Spatial : public Node {
 protected:
 	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) { data.ignore_notification = p_ignore; }
 
+	virtual void _physics_interpolated_changed();
+
 	_FORCE_INLINE_ void _update_local_transform() const;
 
 	void _notification(int p_what);
@@ -153,6 +159,9 @@ public:
 	void set_disable_scale(bool p_enabled);
 	bool is_scale_disabled() const;
 
+	void set_physics_interpolated(bool p_enabled);
+	bool is_physics_interpolated() const;
+
 	void set_disable_gizmo(bool p_enabled);
 	void update_gizmo();
 	void set_gizmo(const Ref<SpatialGizmo> &p_gizmo);
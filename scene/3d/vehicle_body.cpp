@@ -431,29 +431,23 @@ void VehicleBody::_update_wheel(int p_idx, PhysicsDirectBodyState *s) {
 			wheel.m_raycastInfo.m_hardPointWS + wheel.m_raycastInfo.m_wheelDirectionWS * wheel.m_raycastInfo.m_suspensionLength);
 }
 
-real_t VehicleBody::_ray_cast(int p_idx, PhysicsDirectBodyState *s) {
+real_t VehicleBody::_ray_cast(int p_idx, PhysicsDirectBodyState *s, bool p_collided, const PhysicsDirectSpaceState::RayResult &p_result) {
 
 	VehicleWheel &wheel = *wheels[p_idx];
 
-	_update_wheel_transform(wheel, s);
-
 	real_t depth = -1;
 
 	real_t raylen = wheel.m_suspensionRestLength + wheel.m_wheelRadius;
 
-	Vector3 rayvector = wheel.m_raycastInfo.m_wheelDirectionWS * (raylen);
-	Vector3 source = wheel.m_raycastInfo.m_hardPointWS;
-	wheel.m_raycastInfo.m_contactPointWS = source + rayvector;
+	// The ray was cast in _direct_state_changed, batched with the other wheels.
+	Vector3 source = wheel.m_raycastInfo.m_hardPointWS - wheel.m_wheelRadius * wheel.m_raycastInfo.m_wheelDirectionWS;
 	const Vector3 &target = wheel.m_raycastInfo.m_contactPointWS;
-	source -= wheel.m_wheelRadius * wheel.m_raycastInfo.m_wheelDirectionWS;
 
 	real_t param = real_t(0.);
 
-	PhysicsDirectSpaceState::RayResult rr;
+	const PhysicsDirectSpaceState::RayResult &rr = p_result;
 
-	PhysicsDirectSpaceState *ss = s->get_space_state();
-
-	bool col = ss->intersect_ray(source, target, rr, exclude);
+	bool col = p_collided;
 
 	wheel.m_raycastInfo.m_groundObject = 0;
 
@@ -864,9 +858,39 @@ void VehicleBody::_direct_state_changed(Object *p_state) {
 		_update_wheel(i, state);
 	}
 
+	// Batch all wheel rays into a single space query instead of one
+	// intersect_ray (and one space traversal) per wheel.
+	Vector<Vector3> ray_from;
+	Vector<Vector3> ray_to;
+	Vector<PhysicsDirectSpaceState::RayResult> ray_results;
+	Vector<bool> ray_collided;
+	ray_from.resize(wheels.size());
+	ray_to.resize(wheels.size());
+	ray_results.resize(wheels.size());
+	ray_collided.resize(wheels.size());
+
+	for (int i = 0; i < wheels.size(); i++) {
+
+		VehicleWheel &wheel = *wheels[i];
+		_update_wheel_transform(wheel, state);
+
+		real_t raylen = wheel.m_suspensionRestLength + wheel.m_wheelRadius;
+		Vector3 rayvector = wheel.m_raycastInfo.m_wheelDirectionWS * (raylen);
+		Vector3 source = wheel.m_raycastInfo.m_hardPointWS;
+		wheel.m_raycastInfo.m_contactPointWS = source + rayvector;
+		source -= wheel.m_wheelRadius * wheel.m_raycastInfo.m_wheelDirectionWS;
+
+		ray_from.write[i] = source;
+		ray_to.write[i] = wheel.m_raycastInfo.m_contactPointWS;
+	}
+
+	if (wheels.size()) {
+		state->get_space_state()->intersect_ray_batch(ray_from.ptr(), ray_to.ptr(), wheels.size(), ray_results.ptrw(), ray_collided.ptrw(), exclude);
+	}
+
 	for (int i = 0; i < wheels.size(); i++) {
 
-		_ray_cast(i, state);
+		_ray_cast(i, state, ray_collided[i], ray_results[i]);
 		wheels[i]->set_transform(state->get_transform().inverse() * wheels[i]->m_worldTransform);
 	}
 
@@ -185,7 +185,7 @@ class VehicleBody : public RigidBody {
 
 	void _update_friction(PhysicsDirectBodyState *s);
 	void _update_suspension(PhysicsDirectBodyState *s);
-	real_t _ray_cast(int p_idx, PhysicsDirectBodyState *s);
+	real_t _ray_cast(int p_idx, PhysicsDirectBodyState *s, bool p_collided, const PhysicsDirectSpaceState::RayResult &p_result);
 	void _update_wheel_transform(VehicleWheel &wheel, PhysicsDirectBodyState *s);
 	void _update_wheel(int p_idx, PhysicsDirectBodyState *s);
 
@@ -48,6 +48,11 @@ void VisualInstance::_update_visibility() {
 	VS::get_singleton()->instance_set_visible(get_instance(), is_visible_in_tree());
 }
 
+void VisualInstance::_physics_interpolated_changed() {
+
+	VS::get_singleton()->instance_set_interpolated(instance, is_physics_interpolated());
+}
+
 void VisualInstance::_notification(int p_what) {
 
 	switch (p_what) {
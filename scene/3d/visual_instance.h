@@ -49,6 +49,7 @@ class VisualInstance : public Spatial {
 
 protected:
 	void _update_visibility();
+	virtual void _physics_interpolated_changed();
 
 	void _notification(int p_what);
 	static void _bind_methods();
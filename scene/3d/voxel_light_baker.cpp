@@ -257,7 +257,7 @@ static _FORCE_INLINE_ void get_uv_and_normal(const Vector3 &p_pos, const Vector3
 	r_normal = (p_normal[0] * u + p_normal[1] * v + p_normal[2] * w).normalized();
 }
 
-void VoxelLightBaker::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb) {
+void VoxelLightBaker::_plot_face_leaves(int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb, Vector<PlotLeaf> &r_leaves) {
 
 	if (p_level == cell_subdiv - 1) {
 		//plot the face by guessing its albedo and emission value
@@ -407,17 +407,21 @@ void VoxelLightBaker::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p
 			normal_accum *= accdiv;
 		}
 
-		//put this temporarily here, corrected in a later step
-		bake_cells.write[p_idx].albedo[0] += albedo_accum.r;
-		bake_cells.write[p_idx].albedo[1] += albedo_accum.g;
-		bake_cells.write[p_idx].albedo[2] += albedo_accum.b;
-		bake_cells.write[p_idx].emission[0] += emission_accum.r;
-		bake_cells.write[p_idx].emission[1] += emission_accum.g;
-		bake_cells.write[p_idx].emission[2] += emission_accum.b;
-		bake_cells.write[p_idx].normal[0] += normal_accum.x;
-		bake_cells.write[p_idx].normal[1] += normal_accum.y;
-		bake_cells.write[p_idx].normal[2] += normal_accum.z;
-		bake_cells.write[p_idx].alpha += alpha;
+		PlotLeaf leaf;
+		leaf.x = p_x;
+		leaf.y = p_y;
+		leaf.z = p_z;
+		leaf.albedo[0] = albedo_accum.r;
+		leaf.albedo[1] = albedo_accum.g;
+		leaf.albedo[2] = albedo_accum.b;
+		leaf.emission[0] = emission_accum.r;
+		leaf.emission[1] = emission_accum.g;
+		leaf.emission[2] = emission_accum.b;
+		leaf.normal[0] = normal_accum.x;
+		leaf.normal[1] = normal_accum.y;
+		leaf.normal[2] = normal_accum.z;
+		leaf.alpha = alpha;
+		r_leaves.push_back(leaf);
 
 	} else {
 		//go down
@@ -460,17 +464,70 @@ void VoxelLightBaker::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p
 				}
 			}
 
-			if (bake_cells[p_idx].children[i] == CHILD_EMPTY) {
+			_plot_face_leaves(p_level + 1, nx, ny, nz, p_vtx, p_normal, p_uv, p_material, aabb, r_leaves);
+		}
+	}
+}
+
+void VoxelLightBaker::_plot_face_task(uint32_t p_index, PlotFace *p_faces) {
+
+	PlotFace &face = p_faces[p_index];
+	_plot_face_leaves(0, 0, 0, 0, face.vtx, face.normal, face.uv, *face.material, po2_bounds, face.leaves);
+}
+
+void VoxelLightBaker::_merge_plot_leaves(const Vector<PlotLeaf> &p_leaves) {
+
+	for (int i = 0; i < p_leaves.size(); i++) {
+
+		const PlotLeaf &leaf = p_leaves[i];
+
+		uint32_t idx = 0;
+		int half = (1 << (cell_subdiv - 1)) >> 1;
+		int ofs_x = 0;
+		int ofs_y = 0;
+		int ofs_z = 0;
+
+		for (int level = 0; level < cell_subdiv - 1; level++) {
+
+			int child = 0;
+			if (leaf.x >= ofs_x + half) {
+				child |= 1;
+				ofs_x += half;
+			}
+			if (leaf.y >= ofs_y + half) {
+				child |= 2;
+				ofs_y += half;
+			}
+			if (leaf.z >= ofs_z + half) {
+				child |= 4;
+				ofs_z += half;
+			}
+
+			uint32_t child_idx = bake_cells[idx].children[child];
+			if (child_idx == CHILD_EMPTY) {
 				//sub cell must be created
 
-				uint32_t child_idx = bake_cells.size();
-				bake_cells.write[p_idx].children[i] = child_idx;
+				child_idx = bake_cells.size();
+				bake_cells.write[idx].children[child] = child_idx;
 				bake_cells.resize(bake_cells.size() + 1);
-				bake_cells.write[child_idx].level = p_level + 1;
+				bake_cells.write[child_idx].level = level + 1;
 			}
 
-			_plot_face(bake_cells[p_idx].children[i], p_level + 1, nx, ny, nz, p_vtx, p_normal, p_uv, p_material, aabb);
+			idx = child_idx;
+			half >>= 1;
 		}
+
+		//put this temporarily here, corrected in a later step
+		bake_cells.write[idx].albedo[0] += leaf.albedo[0];
+		bake_cells.write[idx].albedo[1] += leaf.albedo[1];
+		bake_cells.write[idx].albedo[2] += leaf.albedo[2];
+		bake_cells.write[idx].emission[0] += leaf.emission[0];
+		bake_cells.write[idx].emission[1] += leaf.emission[1];
+		bake_cells.write[idx].emission[2] += leaf.emission[2];
+		bake_cells.write[idx].normal[0] += leaf.normal[0];
+		bake_cells.write[idx].normal[1] += leaf.normal[1];
+		bake_cells.write[idx].normal[2] += leaf.normal[2];
+		bake_cells.write[idx].alpha += leaf.alpha;
 	}
 }
 
@@ -585,6 +642,8 @@ void VoxelLightBaker::plot_mesh(const Transform &p_xform, Ref<Mesh> &p_mesh, con
 		}
 		MaterialCache material = _get_material_cache(src_material);
 
+		Vector<PlotFace> faces;
+
 		Array a = p_mesh->surface_get_arrays(i);
 
 		PoolVector<Vector3> vertices = a[Mesh::ARRAY_VERTEX];
@@ -639,8 +698,15 @@ void VoxelLightBaker::plot_mesh(const Transform &p_xform, Ref<Mesh> &p_mesh, con
 				//test against original bounds
 				if (!fast_tri_box_overlap(original_bounds.position + original_bounds.size * 0.5, original_bounds.size * 0.5, vtxs))
 					continue;
-				//plot
-				_plot_face(0, 0, 0, 0, 0, vtxs, normal, uvs, material, po2_bounds);
+
+				PlotFace pf;
+				for (int k = 0; k < 3; k++) {
+					pf.vtx[k] = vtxs[k];
+					pf.normal[k] = normal[k];
+					pf.uv[k] = uvs[k];
+				}
+				pf.material = &material;
+				faces.push_back(pf);
 			}
 
 		} else {
@@ -672,8 +738,30 @@ void VoxelLightBaker::plot_mesh(const Transform &p_xform, Ref<Mesh> &p_mesh, con
 				//test against original bounds
 				if (!fast_tri_box_overlap(original_bounds.position + original_bounds.size * 0.5, original_bounds.size * 0.5, vtxs))
 					continue;
-				//plot face
-				_plot_face(0, 0, 0, 0, 0, vtxs, normal, uvs, material, po2_bounds);
+
+				PlotFace pf;
+				for (int k = 0; k < 3; k++) {
+					pf.vtx[k] = vtxs[k];
+					pf.normal[k] = normal[k];
+					pf.uv[k] = uvs[k];
+				}
+				pf.material = &material;
+				faces.push_back(pf);
+			}
+		}
+
+		//voxelize the faces on all cores, then merge the results into the
+		//octree serially (growing it allocates cells, which can't be shared)
+		const int plot_batch = 16384; //bounds the transient per-face leaf memory
+
+		for (int j = 0; j < faces.size(); j += plot_batch) {
+
+			int count = MIN(plot_batch, faces.size() - j);
+			thread_process_array(count, this, &VoxelLightBaker::_plot_face_task, &faces.write[j]);
+
+			for (int k = j; k < j + count; k++) {
+				_merge_plot_leaves(faces[k].leaves);
+				faces.write[k].leaves.clear();
 			}
 		}
 	}
@@ -1919,11 +2007,16 @@ Error VoxelLightBaker::make_lightmap(const Transform &p_xform, Ref<Mesh> &p_mesh
 
 		// make sure our OS-level rng is seeded
 
-		for (int i = 0; i < height; i++) {
+		//bands of rows per dispatch; coarse enough to amortize the thread pool
+		//synchronization, fine enough to keep progress/cancel responsive
+		const int band_size = 16;
+
+		for (int i = 0; i < height; i += band_size) {
 
-			thread_process_array(width, this, &VoxelLightBaker::_lightmap_bake_point, &lightmap_ptr[i * width]);
+			int band_rows = MIN(band_size, height - i);
+			thread_process_array(width * band_rows, this, &VoxelLightBaker::_lightmap_bake_point, &lightmap_ptr[i * width]);
 
-			lines = MAX(lines, i); //for multithread
+			lines = MAX(lines, i + band_rows - 1); //for multithread
 			if (p_bake_time_func) {
 				uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin_time;
 				float elapsed_sec = double(elapsed) / 1000000.0;
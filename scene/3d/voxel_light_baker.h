@@ -140,7 +140,29 @@ private:
 	Vector<Color> _get_bake_texture(Ref<Image> p_image, const Color &p_color_mul, const Color &p_color_add);
 	MaterialCache _get_material_cache(Ref<Material> p_material);
 
-	void _plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb);
+	// Parallel plotting: worker threads voxelize faces into per-face leaf
+	// contribution lists (pure math over the material cache), and the octree
+	// itself is grown on the calling thread by merging those lists, since
+	// cell allocation mutates shared state.
+	struct PlotLeaf {
+		int x, y, z;
+		float albedo[3];
+		float emission[3];
+		float normal[3];
+		float alpha;
+	};
+
+	struct PlotFace {
+		Vector3 vtx[3];
+		Vector3 normal[3];
+		Vector2 uv[3];
+		const MaterialCache *material;
+		Vector<PlotLeaf> leaves;
+	};
+
+	void _plot_face_leaves(int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb, Vector<PlotLeaf> &r_leaves);
+	void _plot_face_task(uint32_t p_index, PlotFace *p_faces);
+	void _merge_plot_leaves(const Vector<PlotLeaf> &p_leaves);
 	void _fixup_plot(int p_idx, int p_level);
 	void _debug_mesh(int p_idx, int p_level, const AABB &p_aabb, Ref<MultiMesh> &p_multimesh, int &idx, DebugMode p_mode);
 	void _check_init_light();
@@ -32,8 +32,10 @@
 
 #include "core/engine.h"
 #include "core/message_queue.h"
+#include "scene/3d/visual_instance.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_stream.h"
+#include "servers/visual_server.h"
 
 #ifdef TOOLS_ENABLED
 #include "editor/editor_settings.h"
@@ -210,16 +212,22 @@ void AnimationPlayer::_notification(int p_what) {
 			if (animation_process_mode == ANIMATION_PROCESS_PHYSICS)
 				break;
 
-			if (processing)
-				_animation_process(get_process_delta_time());
+			if (processing) {
+				float delta = get_process_delta_time();
+				if (_visibility_lod_tick(delta))
+					_animation_process(delta);
+			}
 		} break;
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 
 			if (animation_process_mode == ANIMATION_PROCESS_IDLE)
 				break;
 
-			if (processing)
-				_animation_process(get_physics_process_delta_time());
+			if (processing) {
+				float delta = get_physics_process_delta_time();
+				if (_visibility_lod_tick(delta))
+					_animation_process(delta);
+			}
 		} break;
 		case NOTIFICATION_EXIT_TREE: {
 
@@ -242,6 +250,11 @@ void AnimationPlayer::_ensure_node_caches(AnimationData *p_anim) {
 
 	p_anim->node_cache.resize(a->get_track_count());
 
+	p_anim->key_hints.resize(a->get_track_count());
+	for (int i = 0; i < p_anim->key_hints.size(); i++) {
+		p_anim->key_hints.write[i] = -1;
+	}
+
 	for (int i = 0; i < a->get_track_count(); i++) {
 
 		p_anim->node_cache.write[i] = NULL;
@@ -379,7 +392,7 @@ void AnimationPlayer::_animation_process_animation(AnimationData *p_anim, float
 				Quat rot;
 				Vector3 scale;
 
-				Error err = a->transform_track_interpolate(i, p_time, &loc, &rot, &scale);
+				Error err = a->transform_track_interpolate(i, p_time, &loc, &rot, &scale, &p_anim->key_hints.write[i]);
 				//ERR_CONTINUE(err!=OK); //used for testing, should be removed
 
 				if (err != OK)
@@ -856,6 +869,14 @@ void AnimationPlayer::_animation_update_transforms() {
 
 			ERR_CONTINUE(nc->accum_pass != accum_pass);
 
+			if (nc->pose_applied && nc->loc_accum == nc->loc_applied && nc->rot_accum == nc->rot_applied && nc->scale_accum == nc->scale_applied) {
+				continue; //same pose as last time, don't dirty the node again
+			}
+			nc->pose_applied = true;
+			nc->loc_applied = nc->loc_accum;
+			nc->rot_applied = nc->rot_accum;
+			nc->scale_applied = nc->scale_accum;
+
 			t.origin = nc->loc_accum;
 			t.basis.set_quat_scale(nc->rot_accum, nc->scale_accum);
 			if (nc->skeleton && nc->bone_idx >= 0) {
@@ -1413,6 +1434,7 @@ void AnimationPlayer::clear_caches() {
 	for (Map<StringName, AnimationData>::Element *E = animation_set.front(); E; E = E->next()) {
 
 		E->get().node_cache.clear();
+		E->get().key_hints.clear();
 	}
 
 	cache_update_size = 0;
@@ -1485,6 +1507,50 @@ AnimationPlayer::AnimationMethodCallMode AnimationPlayer::get_method_call_mode()
 	return method_call_mode;
 }
 
+void AnimationPlayer::set_visibility_lod(VisibilityLOD p_lod) {
+
+	visibility_lod = p_lod;
+	lod_tick = 0;
+	lod_time_accum = 0;
+}
+
+AnimationPlayer::VisibilityLOD AnimationPlayer::get_visibility_lod() const {
+
+	return visibility_lod;
+}
+
+void AnimationPlayer::set_visibility_lod_path(const NodePath &p_path) {
+
+	visibility_lod_path = p_path;
+}
+
+NodePath AnimationPlayer::get_visibility_lod_path() const {
+
+	return visibility_lod_path;
+}
+
+bool AnimationPlayer::_visibility_lod_tick(float &r_delta) {
+
+	if (visibility_lod != VISIBILITY_LOD_DISABLED && !visibility_lod_path.is_empty()) {
+
+		VisualInstance *vi = Object::cast_to<VisualInstance>(get_node_or_null(visibility_lod_path));
+		if (vi && !VS::get_singleton()->instance_is_visible(vi->get_instance())) {
+			//reference instance got culled; tick at reduced rate, banking the
+			//skipped time so the animation clock does not slow down
+			int divisor = visibility_lod == VISIBILITY_LOD_HALF_RATE ? 2 : 4;
+			lod_tick++;
+			if (lod_tick % divisor != 0) {
+				lod_time_accum += r_delta;
+				return false;
+			}
+		}
+	}
+
+	r_delta += lod_time_accum;
+	lod_time_accum = 0;
+	return true;
+}
+
 void AnimationPlayer::_set_process(bool p_process, bool p_force) {
 
 	if (processing == p_process && !p_force)
@@ -1675,6 +1741,11 @@ void AnimationPlayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_method_call_mode", "mode"), &AnimationPlayer::set_method_call_mode);
 	ClassDB::bind_method(D_METHOD("get_method_call_mode"), &AnimationPlayer::get_method_call_mode);
 
+	ClassDB::bind_method(D_METHOD("set_visibility_lod", "lod"), &AnimationPlayer::set_visibility_lod);
+	ClassDB::bind_method(D_METHOD("get_visibility_lod"), &AnimationPlayer::get_visibility_lod);
+	ClassDB::bind_method(D_METHOD("set_visibility_lod_path", "path"), &AnimationPlayer::set_visibility_lod_path);
+	ClassDB::bind_method(D_METHOD("get_visibility_lod_path"), &AnimationPlayer::get_visibility_lod_path);
+
 	ClassDB::bind_method(D_METHOD("get_current_animation_position"), &AnimationPlayer::get_current_animation_position);
 	ClassDB::bind_method(D_METHOD("get_current_animation_length"), &AnimationPlayer::get_current_animation_length);
 
@@ -1695,6 +1766,10 @@ void AnimationPlayer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::REAL, "playback_speed", PROPERTY_HINT_RANGE, "-64,64,0.01"), "set_speed_scale", "get_speed_scale");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "method_call_mode", PROPERTY_HINT_ENUM, "Deferred,Immediate"), "set_method_call_mode", "get_method_call_mode");
 
+	ADD_GROUP("Visibility LOD", "visibility_lod");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "visibility_lod", PROPERTY_HINT_ENUM, "Disabled,Half Rate,Quarter Rate"), "set_visibility_lod", "get_visibility_lod");
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "visibility_lod_path"), "set_visibility_lod_path", "get_visibility_lod_path");
+
 	ADD_SIGNAL(MethodInfo("animation_finished", PropertyInfo(Variant::STRING, "anim_name")));
 	ADD_SIGNAL(MethodInfo("animation_changed", PropertyInfo(Variant::STRING, "old_name"), PropertyInfo(Variant::STRING, "new_name")));
 	ADD_SIGNAL(MethodInfo("animation_started", PropertyInfo(Variant::STRING, "anim_name")));
@@ -1706,6 +1781,10 @@ void AnimationPlayer::_bind_methods() {
 
 	BIND_ENUM_CONSTANT(ANIMATION_METHOD_CALL_DEFERRED);
 	BIND_ENUM_CONSTANT(ANIMATION_METHOD_CALL_IMMEDIATE);
+
+	BIND_ENUM_CONSTANT(VISIBILITY_LOD_DISABLED);
+	BIND_ENUM_CONSTANT(VISIBILITY_LOD_HALF_RATE);
+	BIND_ENUM_CONSTANT(VISIBILITY_LOD_QUARTER_RATE);
 }
 
 AnimationPlayer::AnimationPlayer() {
@@ -1719,6 +1798,9 @@ AnimationPlayer::AnimationPlayer() {
 	end_notify = false;
 	animation_process_mode = ANIMATION_PROCESS_IDLE;
 	method_call_mode = ANIMATION_METHOD_CALL_DEFERRED;
+	visibility_lod = VISIBILITY_LOD_DISABLED;
+	lod_tick = 0;
+	lod_time_accum = 0;
 	processing = false;
 	default_blend_time = 0;
 	root = SceneStringNames::get_singleton()->path_pp;
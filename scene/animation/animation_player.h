@@ -70,6 +70,12 @@ public:
 		ANIMATION_METHOD_CALL_IMMEDIATE,
 	};
 
+	enum VisibilityLOD {
+		VISIBILITY_LOD_DISABLED,
+		VISIBILITY_LOD_HALF_RATE,
+		VISIBILITY_LOD_QUARTER_RATE,
+	};
+
 private:
 	enum {
 
@@ -101,6 +107,13 @@ private:
 		Vector3 scale_accum;
 		uint64_t accum_pass;
 
+		// last pose actually applied, so identical samples (held keys, single key
+		// tracks) don't dirty the Spatial/Skeleton again
+		bool pose_applied;
+		Vector3 loc_applied;
+		Quat rot_applied;
+		Vector3 scale_applied;
+
 		bool audio_playing;
 		float audio_start;
 		float audio_len;
@@ -151,6 +164,7 @@ private:
 				skeleton(NULL),
 				bone_idx(-1),
 				accum_pass(0),
+				pose_applied(false),
 				audio_playing(false),
 				audio_start(0.0),
 				audio_len(0.0),
@@ -191,6 +205,7 @@ private:
 		String name;
 		StringName next;
 		Vector<TrackNodeCache *> node_cache;
+		Vector<int> key_hints; //per-track playhead cursors for sequential sampling
 		Ref<Animation> animation;
 	};
 
@@ -254,6 +269,13 @@ private:
 
 	NodePath root;
 
+	VisibilityLOD visibility_lod;
+	NodePath visibility_lod_path;
+	uint32_t lod_tick;
+	float lod_time_accum;
+
+	bool _visibility_lod_tick(float &r_delta);
+
 	void _animation_process_animation(AnimationData *p_anim, float p_time, float p_delta, float p_interp, bool p_is_current = true, bool p_seeked = false, bool p_started = false);
 
 	void _ensure_node_caches(AnimationData *p_anim);
@@ -344,6 +366,12 @@ public:
 	void set_method_call_mode(AnimationMethodCallMode p_mode);
 	AnimationMethodCallMode get_method_call_mode() const;
 
+	void set_visibility_lod(VisibilityLOD p_lod);
+	VisibilityLOD get_visibility_lod() const;
+
+	void set_visibility_lod_path(const NodePath &p_path);
+	NodePath get_visibility_lod_path() const;
+
 	void seek(float p_time, bool p_update = false);
 	void seek_delta(float p_time, float p_delta);
 	float get_current_animation_position() const;
@@ -370,5 +398,6 @@ public:
 
 VARIANT_ENUM_CAST(AnimationPlayer::AnimationProcessMode);
 VARIANT_ENUM_CAST(AnimationPlayer::AnimationMethodCallMode);
+VARIANT_ENUM_CAST(AnimationPlayer::VisibilityLOD);
 
 #endif
@@ -33,8 +33,10 @@
 #include "animation_blend_tree.h"
 #include "core/engine.h"
 #include "core/method_bind_ext.gen.inc"
+#include "scene/3d/visual_instance.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_stream.h"
+#include "servers/visual_server.h"
 
 void AnimationNode::get_parameter_list(List<PropertyInfo> *r_list) const {
 	if (get_script_instance()) {
@@ -278,8 +280,26 @@ float AnimationNode::_blend_node(const StringName &p_subpath, const Vector<Strin
 		}
 	}
 
-	if (!p_seek && p_optimize && !any_valid) //pointless to go on, all are zero
-		return 0;
+	if (p_optimize && !any_valid) {
+		//pointless to go on, all are zero. If this was a seek, remember it so the
+		//branch can catch up when it becomes audible again instead of walking it now
+		if (p_seek) {
+			p_node->pending_seek = p_time;
+		}
+		return p_node->last_rem;
+	}
+
+	float time = p_time;
+	bool seek = p_seek;
+
+	if (p_node->pending_seek >= 0) {
+		if (!seek) {
+			//a seek was skipped while this branch was dormant, apply it now
+			seek = true;
+			time = p_node->pending_seek;
+		}
+		p_node->pending_seek = -1;
+	}
 
 	String new_path;
 	AnimationNode *new_parent;
@@ -293,7 +313,9 @@ float AnimationNode::_blend_node(const StringName &p_subpath, const Vector<Strin
 		new_parent = parent;
 		new_path = String(parent->base_path) + String(p_subpath) + "/";
 	}
-	return p_node->_pre_process(new_path, new_parent, state, p_time, p_seek, p_connections);
+	float rem = p_node->_pre_process(new_path, new_parent, state, time, seek, p_connections);
+	p_node->last_rem = rem;
+	return rem;
 }
 
 int AnimationNode::get_input_count() const {
@@ -456,6 +478,8 @@ AnimationNode::AnimationNode() {
 	state = NULL;
 	parent = NULL;
 	filter_enabled = false;
+	last_rem = 0;
+	pending_seek = -1;
 }
 
 ////////////////////
@@ -1287,11 +1311,17 @@ void AnimationTree::advance(float p_time) {
 void AnimationTree::_notification(int p_what) {
 
 	if (active && p_what == NOTIFICATION_INTERNAL_PHYSICS_PROCESS && process_mode == ANIMATION_PROCESS_PHYSICS) {
-		_process_graph(get_physics_process_delta_time());
+		float delta = get_physics_process_delta_time();
+		if (_visibility_lod_tick(delta)) {
+			_process_graph(delta);
+		}
 	}
 
 	if (active && p_what == NOTIFICATION_INTERNAL_PROCESS && process_mode == ANIMATION_PROCESS_IDLE) {
-		_process_graph(get_process_delta_time());
+		float delta = get_process_delta_time();
+		if (_visibility_lod_tick(delta)) {
+			_process_graph(delta);
+		}
 	}
 
 	if (p_what == NOTIFICATION_EXIT_TREE) {
@@ -1323,6 +1353,46 @@ NodePath AnimationTree::get_animation_player() const {
 	return animation_player;
 }
 
+void AnimationTree::set_visibility_lod(VisibilityLOD p_lod) {
+	visibility_lod = p_lod;
+	lod_tick = 0;
+	lod_time_accum = 0;
+}
+
+AnimationTree::VisibilityLOD AnimationTree::get_visibility_lod() const {
+	return visibility_lod;
+}
+
+void AnimationTree::set_visibility_lod_path(const NodePath &p_path) {
+	visibility_lod_path = p_path;
+}
+
+NodePath AnimationTree::get_visibility_lod_path() const {
+	return visibility_lod_path;
+}
+
+bool AnimationTree::_visibility_lod_tick(float &r_delta) {
+
+	if (visibility_lod != VISIBILITY_LOD_DISABLED && !visibility_lod_path.is_empty()) {
+
+		VisualInstance *vi = Object::cast_to<VisualInstance>(get_node_or_null(visibility_lod_path));
+		if (vi && !VS::get_singleton()->instance_is_visible(vi->get_instance())) {
+			//reference instance got culled; tick at reduced rate, banking the
+			//skipped time so the animation clock does not slow down
+			int divisor = visibility_lod == VISIBILITY_LOD_HALF_RATE ? 2 : 4;
+			lod_tick++;
+			if (lod_tick % divisor != 0) {
+				lod_time_accum += r_delta;
+				return false;
+			}
+		}
+	}
+
+	r_delta += lod_time_accum;
+	lod_time_accum = 0;
+	return true;
+}
+
 bool AnimationTree::is_state_invalid() const {
 
 	return !state.valid;
@@ -1548,6 +1618,11 @@ void AnimationTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_animation_player", "root"), &AnimationTree::set_animation_player);
 	ClassDB::bind_method(D_METHOD("get_animation_player"), &AnimationTree::get_animation_player);
 
+	ClassDB::bind_method(D_METHOD("set_visibility_lod", "lod"), &AnimationTree::set_visibility_lod);
+	ClassDB::bind_method(D_METHOD("get_visibility_lod"), &AnimationTree::get_visibility_lod);
+	ClassDB::bind_method(D_METHOD("set_visibility_lod_path", "path"), &AnimationTree::set_visibility_lod_path);
+	ClassDB::bind_method(D_METHOD("get_visibility_lod_path"), &AnimationTree::get_visibility_lod_path);
+
 	ClassDB::bind_method(D_METHOD("set_root_motion_track", "path"), &AnimationTree::set_root_motion_track);
 	ClassDB::bind_method(D_METHOD("get_root_motion_track"), &AnimationTree::get_root_motion_track);
 
@@ -1567,17 +1642,26 @@ void AnimationTree::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "anim_player", PROPERTY_HINT_NODE_PATH_VALID_TYPES, "AnimationPlayer"), "set_animation_player", "get_animation_player");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "active"), "set_active", "is_active");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_mode", PROPERTY_HINT_ENUM, "Physics,Idle,Manual"), "set_process_mode", "get_process_mode");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "visibility_lod", PROPERTY_HINT_ENUM, "Disabled,Half Rate,Quarter Rate"), "set_visibility_lod", "get_visibility_lod");
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "visibility_lod_path"), "set_visibility_lod_path", "get_visibility_lod_path");
 	ADD_GROUP("Root Motion", "root_motion_");
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_motion_track"), "set_root_motion_track", "get_root_motion_track");
 
 	BIND_ENUM_CONSTANT(ANIMATION_PROCESS_PHYSICS);
 	BIND_ENUM_CONSTANT(ANIMATION_PROCESS_IDLE);
 	BIND_ENUM_CONSTANT(ANIMATION_PROCESS_MANUAL);
+
+	BIND_ENUM_CONSTANT(VISIBILITY_LOD_DISABLED);
+	BIND_ENUM_CONSTANT(VISIBILITY_LOD_HALF_RATE);
+	BIND_ENUM_CONSTANT(VISIBILITY_LOD_QUARTER_RATE);
 }
 
 AnimationTree::AnimationTree() {
 
 	process_mode = ANIMATION_PROCESS_IDLE;
+	visibility_lod = VISIBILITY_LOD_DISABLED;
+	lod_tick = 0;
+	lod_time_accum = 0;
 	active = false;
 	cache_valid = false;
 	setup_pass = 1;
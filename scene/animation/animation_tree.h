@@ -87,6 +87,9 @@ public:
 	Vector<float> blends;
 	State *state;
 
+	float last_rem; //cached last output, returned while the branch is skipped as dormant
+	float pending_seek; //seek a dormant branch still has to apply when it becomes audible again, -1 if none
+
 	float _pre_process(const StringName &p_base_path, AnimationNode *p_parent, State *p_state, float p_time, bool p_seek, const Vector<StringName> &p_connections);
 	void _pre_update_animations(HashMap<NodePath, int> *track_map);
 
@@ -172,6 +175,12 @@ public:
 		ANIMATION_PROCESS_MANUAL,
 	};
 
+	enum VisibilityLOD {
+		VISIBILITY_LOD_DISABLED,
+		VISIBILITY_LOD_HALF_RATE,
+		VISIBILITY_LOD_QUARTER_RATE,
+	};
+
 private:
 	struct TrackCache {
 
@@ -264,6 +273,13 @@ private:
 	bool active;
 	NodePath animation_player;
 
+	VisibilityLOD visibility_lod;
+	NodePath visibility_lod_path;
+	uint32_t lod_tick;
+	float lod_time_accum;
+
+	bool _visibility_lod_tick(float &r_delta);
+
 	AnimationNode::State state;
 	bool cache_valid;
 	void _node_removed(Node *p_node);
@@ -322,6 +338,12 @@ public:
 	void set_animation_player(const NodePath &p_player);
 	NodePath get_animation_player() const;
 
+	void set_visibility_lod(VisibilityLOD p_lod);
+	VisibilityLOD get_visibility_lod() const;
+
+	void set_visibility_lod_path(const NodePath &p_path);
+	NodePath get_visibility_lod_path() const;
+
 	virtual String get_configuration_warning() const;
 
 	bool is_state_invalid() const;
@@ -343,5 +365,6 @@ public:
 };
 
 VARIANT_ENUM_CAST(AnimationTree::AnimationProcessMode)
+VARIANT_ENUM_CAST(AnimationTree::VisibilityLOD)
 
 #endif // ANIMATION_GRAPH_PLAYER_H
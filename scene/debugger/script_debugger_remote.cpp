@@ -36,6 +36,7 @@
 #include "core/os/input.h"
 #include "core/os/os.h"
 #include "core/project_settings.h"
+#include "core/tracepoints.h"
 #include "scene/main/node.h"
 #include "scene/main/scene_tree.h"
 #include "scene/main/viewport.h"
@@ -790,6 +791,7 @@ void ScriptDebuggerRemote::_poll_events() {
 			max_frame_functions = cmd[1];
 			profiler_function_signature_map.clear();
 			profiling = true;
+			EngineTracepoints::set_enabled(true);
 			frame_time = 0;
 			idle_time = 0;
 			physics_time = 0;
@@ -803,6 +805,7 @@ void ScriptDebuggerRemote::_poll_events() {
 				ScriptServer::get_language(i)->profiling_stop();
 			}
 			profiling = false;
+			EngineTracepoints::set_enabled(false);
 			_send_profiling_data(false);
 			print_line("PROFILING END!");
 		} else if (command == "start_network_profiling") {
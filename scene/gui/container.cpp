@@ -88,6 +88,11 @@ void Container::_sort_children() {
 	if (!is_inside_tree())
 		return;
 
+	if (!is_visible_in_tree()) {
+		pending_sort = false;
+		return; //it will be queued again when made visible
+	}
+
 	notification(NOTIFICATION_SORT_CHILDREN);
 	emit_signal(SceneStringNames::get_singleton()->sort_children);
 	pending_sort = false;
@@ -98,10 +103,17 @@ void Container::fit_child_in_rect(Control *p_child, const Rect2 &p_rect) {
 	ERR_FAIL_COND(!p_child);
 	ERR_FAIL_COND(p_child->get_parent() != this);
 
-	Size2 minsize = p_child->get_combined_minimum_size();
 	Rect2 r = p_rect;
 
-	if (!(p_child->get_h_size_flags() & SIZE_FILL)) {
+	bool h_fill = p_child->get_h_size_flags() & SIZE_FILL;
+	bool v_fill = p_child->get_v_size_flags() & SIZE_FILL;
+
+	Size2 minsize;
+	if (!h_fill || !v_fill) {
+		minsize = p_child->get_combined_minimum_size();
+	}
+
+	if (!h_fill) {
 		r.size.x = minsize.width;
 		if (p_child->get_h_size_flags() & SIZE_SHRINK_END) {
 			r.position.x += p_rect.size.width - minsize.width;
@@ -112,7 +124,7 @@ void Container::fit_child_in_rect(Control *p_child, const Rect2 &p_rect) {
 		}
 	}
 
-	if (!(p_child->get_v_size_flags() & SIZE_FILL)) {
+	if (!v_fill) {
 		r.size.y = minsize.y;
 		if (p_child->get_v_size_flags() & SIZE_SHRINK_END) {
 			r.position.y += p_rect.size.height - minsize.height;
@@ -983,20 +983,11 @@ void RichTextLabel::_notification(int p_what) {
 
 			int ofs = vscroll->get_value();
 
-			//todo, change to binary search
-
-			int from_line = 0;
-			int total_chars = 0;
-			while (from_line < main->lines.size()) {
-
-				if (main->lines[from_line].height_accum_cache + _get_text_rect().get_position().y >= ofs)
-					break;
-				total_chars += main->lines[from_line].char_count;
-				from_line++;
-			}
+			int from_line = _find_line_at_offset(main, ofs - _get_text_rect().get_position().y);
 
 			if (from_line >= main->lines.size())
 				break; //nothing to draw
+			int total_chars = main->lines[from_line].char_offset_cache;
 			int y = (main->lines[from_line].height_accum_cache - main->lines[from_line].height_cache) - ofs;
 			Ref<Font> base_font = get_font("normal_font");
 			Color base_color = get_color("default_color");
@@ -1033,15 +1024,7 @@ void RichTextLabel::_find_click(ItemFrame *p_frame, const Point2i &p_click, Item
 	bool use_outline = get_constant("shadow_as_outline");
 	Point2 shadow_ofs(get_constant("shadow_offset_x"), get_constant("shadow_offset_y"));
 
-	//todo, change to binary search
-	int from_line = 0;
-
-	while (from_line < p_frame->lines.size()) {
-
-		if (p_frame->lines[from_line].height_accum_cache >= ofs)
-			break;
-		from_line++;
-	}
+	int from_line = _find_line_at_offset(p_frame, ofs);
 
 	if (from_line >= p_frame->lines.size())
 		return;
@@ -1490,6 +1473,24 @@ bool RichTextLabel::_find_layout_subitem(Item *from, Item *to) {
 	return false;
 }
 
+int RichTextLabel::_find_line_at_offset(ItemFrame *p_frame, int p_height_ofs) const {
+
+	//binary search for the first line whose accumulated height reaches the offset
+	int from = 0;
+	int to = p_frame->lines.size();
+
+	while (from < to) {
+		int mid = (from + to) / 2;
+		if (p_frame->lines[mid].height_accum_cache < p_height_ofs) {
+			from = mid + 1;
+		} else {
+			to = mid;
+		}
+	}
+
+	return from;
+}
+
 void RichTextLabel::_validate_line_caches(ItemFrame *p_frame) {
 
 	if (p_frame->first_invalid_line == p_frame->lines.size())
@@ -1513,9 +1514,12 @@ void RichTextLabel::_validate_line_caches(ItemFrame *p_frame) {
 		_process_line(p_frame, text_rect.get_position(), y, text_rect.get_size().width - scroll_w, i, PROCESS_CACHE, base_font, Color(), font_color_shadow, use_outline, shadow_ofs);
 		p_frame->lines.write[i].height_cache = y;
 		p_frame->lines.write[i].height_accum_cache = y;
+		p_frame->lines.write[i].char_offset_cache = 0;
 
-		if (i > 0)
+		if (i > 0) {
 			p_frame->lines.write[i].height_accum_cache += p_frame->lines[i - 1].height_accum_cache;
+			p_frame->lines.write[i].char_offset_cache = p_frame->lines[i - 1].char_offset_cache + p_frame->lines[i - 1].char_count;
+		}
 	}
 
 	int total_height = 0;
@@ -94,12 +94,14 @@ private:
 		int height_cache;
 		int height_accum_cache;
 		int char_count;
+		int char_offset_cache; //characters in all the lines above, accumulated with the height caches
 		int minimum_width;
 		int maximum_width;
 
 		Line() {
 			from = NULL;
 			char_count = 0;
+			char_offset_cache = 0;
 		}
 	};
 
@@ -334,6 +336,7 @@ private:
 
 	void _invalidate_current_line(ItemFrame *p_frame);
 	void _validate_line_caches(ItemFrame *p_frame);
+	int _find_line_at_offset(ItemFrame *p_frame, int p_height_ofs) const;
 
 	void _add_item(Item *p_item, bool p_enter = false, bool p_ensure_newline = false);
 	void _remove_item(Item *p_item, const int p_line, const int p_subitem_line);
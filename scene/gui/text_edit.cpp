@@ -138,6 +138,7 @@ void TextEdit::Text::_update_line_cache(int p_line) const {
 	text.write[p_line].width_cache = w;
 
 	text.write[p_line].wrap_amount_cache = -1;
+	text.write[p_line].wrap_rows_cache.clear();
 
 	// Update regions.
 
@@ -246,6 +247,22 @@ void TextEdit::Text::set_line_wrap_amount(int p_line, int p_wrap_amount) const {
 	ERR_FAIL_INDEX(p_line, text.size());
 
 	text.write[p_line].wrap_amount_cache = p_wrap_amount;
+	if (p_wrap_amount == -1)
+		text.write[p_line].wrap_rows_cache.clear();
+}
+
+void TextEdit::Text::set_line_wrap_rows(int p_line, const Vector<String> &p_rows) const {
+
+	ERR_FAIL_INDEX(p_line, text.size());
+
+	text.write[p_line].wrap_rows_cache = p_rows;
+}
+
+const Vector<String> &TextEdit::Text::get_line_wrap_rows(int p_line) const {
+
+	CRASH_BAD_INDEX(p_line, text.size());
+
+	return text[p_line].wrap_rows_cache;
 }
 
 int TextEdit::Text::get_line_wrap_amount(int p_line) const {
@@ -266,6 +283,7 @@ void TextEdit::Text::clear_wrap_cache() {
 
 	for (int i = 0; i < text.size(); i++) {
 		text.write[i].wrap_amount_cache = -1;
+		text.write[i].wrap_rows_cache.clear();
 	}
 }
 
@@ -298,6 +316,7 @@ void TextEdit::Text::set(int p_line, const String &p_text) {
 
 	text.write[p_line].width_cache = -1;
 	text.write[p_line].wrap_amount_cache = -1;
+	text.write[p_line].wrap_rows_cache.clear();
 	text.write[p_line].data = p_text;
 }
 
@@ -967,7 +986,7 @@ void TextEdit::_notification(int p_what) {
 						break;
 					}
 
-					Map<int, HighlighterInfo> color_map;
+					const Map<int, HighlighterInfo> *color_map = NULL;
 					if (syntax_coloring) {
 						color_map = _get_line_syntax_highlighting(minimap_line);
 					}
@@ -1008,8 +1027,9 @@ void TextEdit::_notification(int p_what) {
 						int tabs = 0;
 						for (int j = 0; j < str.length(); j++) {
 							if (syntax_coloring) {
-								if (color_map.has(last_wrap_column + j)) {
-									current_color = color_map[last_wrap_column + j].color;
+								const Map<int, HighlighterInfo>::Element *E = color_map->find(last_wrap_column + j);
+								if (E) {
+									current_color = E->get().color;
 									if (readonly) {
 										current_color.a = cache.font_color_readonly.a;
 									}
@@ -1093,7 +1113,7 @@ void TextEdit::_notification(int p_what) {
 
 				const String &fullstr = text[line];
 
-				Map<int, HighlighterInfo> color_map;
+				const Map<int, HighlighterInfo> *color_map = NULL;
 				if (syntax_coloring) {
 					color_map = _get_line_syntax_highlighting(line);
 				}
@@ -1285,8 +1305,9 @@ void TextEdit::_notification(int p_what) {
 					for (; j < str.length(); j++) {
 
 						if (syntax_coloring) {
-							if (color_map.has(last_wrap_column + j)) {
-								current_color = color_map[last_wrap_column + j].color;
+							const Map<int, HighlighterInfo>::Element *E = color_map->find(last_wrap_column + j);
+							if (E) {
+								current_color = E->get().color;
 								if (readonly && current_color.a > cache.font_color_readonly.a) {
 									current_color.a = cache.font_color_readonly.a;
 								}
@@ -4349,6 +4370,12 @@ Vector<String> TextEdit::get_wrap_rows_text(int p_line) const {
 		return lines;
 	}
 
+	if (text.get_line_wrap_amount(p_line) != -1) {
+		const Vector<String> &cached_rows = text.get_line_wrap_rows(p_line);
+		if (cached_rows.size() > 0)
+			return cached_rows;
+	}
+
 	int px = 0;
 	int col = 0;
 	String line_text = text[p_line];
@@ -4408,6 +4435,7 @@ Vector<String> TextEdit::get_wrap_rows_text(int p_line) const {
 
 	// Update cache.
 	text.set_line_wrap_amount(p_line, lines.size() - 1);
+	text.set_line_wrap_rows(p_line, lines);
 
 	return lines;
 }
@@ -7284,15 +7312,14 @@ TextEdit::~TextEdit() {
 
 ///////////////////////////////////////////////////////////////////////////////
 
-Map<int, TextEdit::HighlighterInfo> TextEdit::_get_line_syntax_highlighting(int p_line) {
-	if (syntax_highlighting_cache.has(p_line)) {
-		return syntax_highlighting_cache[p_line];
+const Map<int, TextEdit::HighlighterInfo> *TextEdit::_get_line_syntax_highlighting(int p_line) {
+	Map<int, Map<int, HighlighterInfo> >::Element *C = syntax_highlighting_cache.find(p_line);
+	if (C) {
+		return &C->get();
 	}
 
 	if (syntax_highlighter != NULL) {
-		Map<int, HighlighterInfo> color_map = syntax_highlighter->_get_line_syntax_highlighting(p_line);
-		syntax_highlighting_cache[p_line] = color_map;
-		return color_map;
+		return &syntax_highlighting_cache.insert(p_line, syntax_highlighter->_get_line_syntax_highlighting(p_line))->get();
 	}
 
 	Map<int, HighlighterInfo> color_map;
@@ -7474,8 +7501,7 @@ Map<int, TextEdit::HighlighterInfo> TextEdit::_get_line_syntax_highlighting(int
 		}
 	}
 
-	syntax_highlighting_cache[p_line] = color_map;
-	return color_map;
+	return &syntax_highlighting_cache.insert(p_line, color_map)->get();
 }
 
 void SyntaxHighlighter::set_text_editor(TextEdit *p_text_editor) {
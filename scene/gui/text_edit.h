@@ -85,6 +85,7 @@ public:
 			bool has_info : 1;
 			int wrap_amount_cache : 24;
 			Map<int, ColorRegionInfo> region_info;
+			Vector<String> wrap_rows_cache; //wrapped substrings for the current wrap width, empty when invalid
 			Ref<Texture> info_icon;
 			String info;
 			String data;
@@ -117,6 +118,8 @@ public:
 		int get_char_width(CharType c, CharType next_c, int px) const;
 		void set_line_wrap_amount(int p_line, int p_wrap_amount) const;
 		int get_line_wrap_amount(int p_line) const;
+		void set_line_wrap_rows(int p_line, const Vector<String> &p_rows) const;
+		const Vector<String> &get_line_wrap_rows(int p_line) const;
 		const Map<int, ColorRegionInfo> &get_color_region_info(int p_line) const;
 		void set(int p_line, const String &p_text);
 		void set_marked(int p_line, bool p_marked) { text.write[p_line].marked = p_marked; }
@@ -315,7 +318,7 @@ private:
 	HashMap<String, Color> keywords;
 	HashMap<String, Color> member_keywords;
 
-	Map<int, HighlighterInfo> _get_line_syntax_highlighting(int p_line);
+	const Map<int, HighlighterInfo> *_get_line_syntax_highlighting(int p_line);
 
 	Vector<ColorRegion> color_regions;
 
@@ -350,18 +350,13 @@ bool HTTPRequest::_update_connection() {
 
 			client->poll();
 
-			PoolByteArray chunk = client->read_response_body_chunk();
-			downloaded += chunk.size();
-
-			if (file) {
-				PoolByteArray::Read r = chunk.read();
-				file->store_buffer(r.ptr(), chunk.size());
-				if (file->get_error() != OK) {
-					call_deferred("_request_done", RESULT_DOWNLOAD_FILE_WRITE_ERROR, response_code, response_headers, PoolByteArray());
-					return true;
-				}
-			} else {
-				body.append_array(chunk);
+			int read = 0;
+			Error stream_err = client->read_response_body_stream(_body_stream_handler, this, read);
+			downloaded += read;
+
+			if (stream_err != OK) {
+				call_deferred("_request_done", RESULT_DOWNLOAD_FILE_WRITE_ERROR, response_code, response_headers, PoolByteArray());
+				return true;
 			}
 
 			if (body_size_limit >= 0 && downloaded > body_size_limit) {
@@ -396,6 +391,26 @@ bool HTTPRequest::_update_connection() {
 	ERR_FAIL_V(false);
 }
 
+Error HTTPRequest::_body_stream_handler(void *p_userdata, const uint8_t *p_data, int p_size) {
+
+	HTTPRequest *self = (HTTPRequest *)p_userdata;
+
+	if (self->file) {
+		// Straight to disk, nothing is accumulated in memory
+		self->file->store_buffer(p_data, p_size);
+		if (self->file->get_error() != OK) {
+			return ERR_FILE_CANT_WRITE;
+		}
+	} else {
+		int ofs = self->body.size();
+		self->body.resize(ofs + p_size);
+		PoolByteArray::Write w = self->body.write();
+		copymem(w.ptr() + ofs, p_data, p_size);
+	}
+
+	return OK;
+}
+
 void HTTPRequest::_request_done(int p_status, int p_code, const PoolStringArray &headers, const PoolByteArray &p_data) {
 
 	cancel_request();
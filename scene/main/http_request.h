@@ -100,6 +100,8 @@ private:
 
 	bool _handle_response(bool *ret_value);
 
+	static Error _body_stream_handler(void *p_userdata, const uint8_t *p_data, int p_size);
+
 	Error _parse_url(const String &p_url);
 	Error _request();
 
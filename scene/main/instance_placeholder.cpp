@@ -30,9 +30,17 @@
 
 #include "instance_placeholder.h"
 
+#include "core/engine.h"
 #include "core/io/resource_loader.h"
+#include "core/project_settings.h"
+#include "scene/3d/camera.h"
+#include "scene/3d/spatial.h"
+#include "scene/main/viewport.h"
 #include "scene/resources/packed_scene.h"
 
+uint64_t InstancePlaceholder::instance_frame = 0;
+int InstancePlaceholder::instances_this_frame = 0;
+
 bool InstancePlaceholder::_set(const StringName &p_name, const Variant &p_value) {
 
 	PropSet ps;
@@ -75,6 +83,74 @@ String InstancePlaceholder::get_instance_path() const {
 	return path;
 }
 
+void InstancePlaceholder::set_instance_distance(float p_distance) {
+
+	instance_distance = p_distance;
+	if (is_inside_tree() && !Engine::get_singleton()->is_editor_hint()) {
+		set_process(instance_distance > 0);
+	}
+}
+
+float InstancePlaceholder::get_instance_distance() const {
+
+	return instance_distance;
+}
+
+void InstancePlaceholder::_check_instance_distance() {
+
+#ifndef _3D_DISABLED
+	Camera *camera = get_viewport()->get_camera();
+	if (!camera)
+		return;
+
+	//the placeholder itself has no transform, use the closest spatial ancestor as anchor
+	Spatial *anchor = NULL;
+	Node *p = get_parent();
+	while (p && !anchor) {
+		anchor = Object::cast_to<Spatial>(p);
+		p = p->get_parent();
+	}
+	if (!anchor)
+		return;
+
+	if (camera->get_global_transform().origin.distance_to(anchor->get_global_transform().origin) > instance_distance)
+		return;
+
+	static int budget = -1;
+	if (budget < 0) {
+		budget = GLOBAL_DEF("scene/placeholders/max_auto_instances_per_frame", 1);
+		ProjectSettings::get_singleton()->set_custom_property_info("scene/placeholders/max_auto_instances_per_frame", PropertyInfo(Variant::INT, "scene/placeholders/max_auto_instances_per_frame", PROPERTY_HINT_RANGE, "1,64,1"));
+	}
+
+	uint64_t frame = Engine::get_singleton()->get_idle_frames();
+	if (frame != instance_frame) {
+		instance_frame = frame;
+		instances_this_frame = 0;
+	}
+	if (instances_this_frame >= budget)
+		return; //over budget, try again next frame
+
+	instances_this_frame++;
+	create_instance(true);
+#endif
+}
+
+void InstancePlaceholder::_notification(int p_what) {
+
+	switch (p_what) {
+		case NOTIFICATION_ENTER_TREE: {
+
+			if (!Engine::get_singleton()->is_editor_hint() && instance_distance > 0) {
+				set_process(true);
+			}
+		} break;
+		case NOTIFICATION_PROCESS: {
+
+			_check_instance_distance();
+		} break;
+	}
+}
+
 Node *InstancePlaceholder::create_instance(bool p_replace, const Ref<PackedScene> &p_custom_scene) {
 
 	ERR_FAIL_COND_V(!is_inside_tree(), NULL);
@@ -140,7 +216,13 @@ void InstancePlaceholder::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("create_instance", "replace", "custom_scene"), &InstancePlaceholder::create_instance, DEFVAL(false), DEFVAL(Variant()));
 	ClassDB::bind_method(D_METHOD("replace_by_instance", "custom_scene"), &InstancePlaceholder::replace_by_instance, DEFVAL(Variant()));
 	ClassDB::bind_method(D_METHOD("get_instance_path"), &InstancePlaceholder::get_instance_path);
+	ClassDB::bind_method(D_METHOD("set_instance_distance", "distance"), &InstancePlaceholder::set_instance_distance);
+	ClassDB::bind_method(D_METHOD("get_instance_distance"), &InstancePlaceholder::get_instance_distance);
+
+	ADD_PROPERTY(PropertyInfo(Variant::REAL, "instance_distance", PROPERTY_HINT_RANGE, "0,8192,0.1,or_greater"), "set_instance_distance", "get_instance_distance");
 }
 
 InstancePlaceholder::InstancePlaceholder() {
+
+	instance_distance = 0;
 }
@@ -40,6 +40,8 @@ class InstancePlaceholder : public Node {
 	GDCLASS(InstancePlaceholder, Node);
 
 	String path;
+	float instance_distance;
+
 	struct PropSet {
 		StringName name;
 		Variant value;
@@ -47,17 +49,27 @@ class InstancePlaceholder : public Node {
 
 	List<PropSet> stored_values;
 
+	//shared frame budget so many placeholders coming into range don't stall a single frame
+	static uint64_t instance_frame;
+	static int instances_this_frame;
+
+	void _check_instance_distance();
+
 protected:
 	bool _set(const StringName &p_name, const Variant &p_value);
 	bool _get(const StringName &p_name, Variant &r_ret) const;
 	void _get_property_list(List<PropertyInfo> *p_list) const;
 
+	void _notification(int p_what);
 	static void _bind_methods();
 
 public:
 	void set_instance_path(const String &p_name);
 	String get_instance_path() const;
 
+	void set_instance_distance(float p_distance);
+	float get_instance_distance() const;
+
 	Dictionary get_stored_values(bool p_with_order = false);
 
 	Node *create_instance(bool p_replace = false, const Ref<PackedScene> &p_custom_scene = Ref<PackedScene>());
@@ -0,0 +1,404 @@
+/*************************************************************************/
+/*  network_replicator.cpp                                               */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "network_replicator.h"
+
+#include "core/io/marshalls.h"
+
+void NetworkReplicator::_append_bytes(const uint8_t *p_data, int p_len) {
+
+	int ofs = send_buffer.size();
+	send_buffer.resize(ofs + p_len);
+	copymem(send_buffer.ptrw() + ofs, p_data, p_len);
+}
+
+void NetworkReplicator::_append_variant(const Variant &p_value) {
+
+	int len = 0;
+	Error err = encode_variant(p_value, NULL, len, false);
+	ERR_FAIL_COND(err != OK);
+	int ofs = send_buffer.size();
+	send_buffer.resize(ofs + len);
+	encode_variant(p_value, send_buffer.ptrw() + ofs, len, false);
+}
+
+void NetworkReplicator::_capture_and_send() {
+
+	current_tick++;
+	bool keyframe = keyframe_interval <= 1 || (current_tick % keyframe_interval) == 0;
+
+	send_buffer.resize(0);
+	uint8_t header[8];
+	header[0] = SNAPSHOT_MAGIC;
+	header[1] = keyframe ? SNAPSHOT_FLAG_KEYFRAME : 0;
+	encode_uint32(current_tick, &header[2]);
+	encode_uint16(0, &header[6]); // Entity count, patched below.
+	_append_bytes(header, 8);
+
+	int written = 0;
+
+	for (Map<int, ReplicatedEntity>::Element *E = entities.front(); E; E = E->next()) {
+
+		ReplicatedEntity &entity = E->get();
+		Node *node = get_node_or_null(entity.path);
+		if (!node)
+			continue;
+
+		uint32_t mask = 0;
+		Vector<Variant> values;
+		values.resize(entity.properties.size());
+
+		for (int i = 0; i < entity.properties.size(); i++) {
+
+			Variant value = node->get(entity.properties[i]);
+			values.write[i] = value;
+			if (keyframe || !(value == entity.last_values[i]))
+				mask |= 1 << i;
+		}
+
+		if (mask == 0)
+			continue;
+
+		uint8_t ehdr[6];
+		encode_uint16(E->key(), &ehdr[0]);
+		encode_uint32(mask, &ehdr[2]);
+		_append_bytes(ehdr, 6);
+
+		for (int i = 0; i < values.size(); i++) {
+			if (mask & (1 << i)) {
+				_append_variant(values[i]);
+				entity.last_values.write[i] = values[i];
+			}
+		}
+		written++;
+	}
+
+	if (written == 0 && !keyframe)
+		return; // Nothing changed this tick.
+
+	encode_uint16(written, send_buffer.ptrw() + 6);
+
+	PoolVector<uint8_t> packet;
+	packet.resize(send_buffer.size());
+	{
+		PoolVector<uint8_t>::Write w = packet.write();
+		copymem(w.ptr(), send_buffer.ptr(), send_buffer.size());
+	}
+
+	// Deltas may be dropped (the next change or keyframe supersedes them),
+	// keyframes must arrive so late joiners and lossy links resynchronize.
+	get_multiplayer()->send_bytes(packet, NetworkedMultiplayerPeer::TARGET_PEER_BROADCAST,
+			keyframe ? NetworkedMultiplayerPeer::TRANSFER_MODE_RELIABLE : NetworkedMultiplayerPeer::TRANSFER_MODE_UNRELIABLE_ORDERED);
+}
+
+void NetworkReplicator::_on_network_packet(int p_from, const PoolVector<uint8_t> &p_packet) {
+
+	if (p_from != NetworkedMultiplayerPeer::TARGET_PEER_SERVER)
+		return; // Only the server replicates.
+	if (p_packet.size() < 8)
+		return;
+
+	PoolVector<uint8_t>::Read r = p_packet.read();
+	const uint8_t *buf = r.ptr();
+	int size = p_packet.size();
+
+	if (buf[0] != SNAPSHOT_MAGIC)
+		return; // Unrelated raw packet, leave it for whoever sent it.
+
+	uint32_t tick = decode_uint32(&buf[2]);
+	int entity_count = decode_uint16(&buf[6]);
+	int ofs = 8;
+
+	if (render_tick_valid && tick <= last_received_tick)
+		return; // Out of order unreliable delta, already superseded.
+
+	for (int i = 0; i < entity_count; i++) {
+
+		ERR_FAIL_COND_MSG(ofs + 6 > size, "Malformed replication snapshot received.");
+		int id = decode_uint16(&buf[ofs]);
+		uint32_t mask = decode_uint32(&buf[ofs + 2]);
+		ofs += 6;
+
+		Map<int, ReplicatedEntity>::Element *E = entities.find(id);
+		ERR_FAIL_COND_MSG(!E, "Replication snapshot references unregistered entity " + itos(id) + ". Both peers must register the same entities in the same order.");
+
+		Map<int, ClientEntityState>::Element *S = client_states.find(id);
+		if (!S) {
+			S = client_states.insert(id, ClientEntityState());
+			S->get().timelines.resize(E->get().properties.size());
+		}
+
+		for (int j = 0; j < E->get().properties.size(); j++) {
+
+			if (!(mask & (1 << j)))
+				continue;
+
+			Variant value;
+			int len = 0;
+			Error err = decode_variant(value, &buf[ofs], size - ofs, &len, false);
+			ERR_FAIL_COND_MSG(err != OK, "Malformed replication snapshot received.");
+			ofs += len;
+
+			List<PropertySample> &timeline = S->get().timelines.write[j];
+			PropertySample sample;
+			sample.tick = tick;
+			sample.value = value;
+			timeline.push_back(sample);
+			while (timeline.size() > MAX_BUFFERED_SAMPLES)
+				timeline.pop_front();
+		}
+	}
+
+	last_received_tick = tick;
+	if (!render_tick_valid) {
+		render_tick = (double)tick - interpolation_ticks;
+		render_tick_valid = true;
+	}
+
+	emit_signal("snapshot_received", (int64_t)tick);
+}
+
+bool NetworkReplicator::_property_is_interpolable(const Variant &p_a, const Variant &p_b) {
+
+	if (p_a.get_type() != p_b.get_type())
+		return false;
+
+	switch (p_a.get_type()) {
+		case Variant::INT:
+		case Variant::REAL:
+		case Variant::VECTOR2:
+		case Variant::VECTOR3:
+		case Variant::QUAT:
+		case Variant::BASIS:
+		case Variant::TRANSFORM:
+		case Variant::TRANSFORM2D:
+		case Variant::COLOR:
+			return true;
+		default:
+			return false; // Step discrete types instead of morphing them.
+	}
+}
+
+void NetworkReplicator::_apply_interpolated() {
+
+	if (!render_tick_valid)
+		return;
+
+	double desired = (double)last_received_tick - interpolation_ticks;
+	if (render_tick > (double)last_received_tick) {
+		render_tick = last_received_tick; // Starved for snapshots, hold rather than extrapolate.
+	} else if (desired - render_tick > tick_rate) {
+		render_tick = desired; // Fell over a second behind (e.g. tab suspended), snap forward.
+	}
+
+	for (Map<int, ClientEntityState>::Element *S = client_states.front(); S; S = S->next()) {
+
+		Map<int, ReplicatedEntity>::Element *E = entities.find(S->key());
+		if (!E)
+			continue;
+		Node *node = get_node_or_null(E->get().path);
+		if (!node)
+			continue;
+
+		for (int i = 0; i < S->get().timelines.size(); i++) {
+
+			List<PropertySample> &timeline = S->get().timelines.write[i];
+			if (timeline.empty())
+				continue;
+
+			List<PropertySample>::Element *prev = NULL;
+			List<PropertySample>::Element *next = NULL;
+			for (List<PropertySample>::Element *T = timeline.front(); T; T = T->next()) {
+				if ((double)T->get().tick <= render_tick) {
+					prev = T;
+				} else {
+					next = T;
+					break;
+				}
+			}
+
+			if (!prev) {
+				continue; // All samples are ahead of the render tick, keep waiting.
+			}
+
+			Variant value;
+			if (next && _property_is_interpolable(prev->get().value, next->get().value)) {
+				float c = (render_tick - prev->get().tick) / float(next->get().tick - prev->get().tick);
+				Variant::interpolate(prev->get().value, next->get().value, c, value);
+			} else {
+				value = prev->get().value;
+			}
+			node->set(E->get().properties[i], value);
+
+			// Drop samples older than the bracketing pair.
+			while (timeline.front() != prev)
+				timeline.pop_front();
+		}
+	}
+}
+
+void NetworkReplicator::_notification(int p_what) {
+
+	switch (p_what) {
+		case NOTIFICATION_READY: {
+
+			Ref<MultiplayerAPI> api = get_multiplayer();
+			if (api.is_valid())
+				api->connect("network_peer_packet", this, "_on_network_packet");
+			set_process_internal(true);
+		} break;
+		case NOTIFICATION_EXIT_TREE: {
+
+			Ref<MultiplayerAPI> api = get_multiplayer();
+			if (api.is_valid() && api->is_connected("network_peer_packet", this, "_on_network_packet"))
+				api->disconnect("network_peer_packet", this, "_on_network_packet");
+		} break;
+		case NOTIFICATION_INTERNAL_PROCESS: {
+
+			Ref<MultiplayerAPI> api = get_multiplayer();
+			if (api.is_null() || !api->has_network_peer())
+				break;
+
+			float delta = get_process_delta_time();
+			if (api->is_network_server()) {
+				tick_accum += delta;
+				float tick_time = 1.0 / tick_rate;
+				while (tick_accum >= tick_time) {
+					tick_accum -= tick_time;
+					_capture_and_send();
+				}
+			} else {
+				render_tick += delta * tick_rate;
+				_apply_interpolated();
+			}
+		} break;
+	}
+}
+
+int NetworkReplicator::add_entity(const NodePath &p_path, const PoolStringArray &p_properties) {
+
+	ERR_FAIL_COND_V_MSG(p_properties.size() == 0, -1, "An entity needs at least one replicated property.");
+	ERR_FAIL_COND_V_MSG(p_properties.size() > MAX_PROPERTIES, -1, "Entities can replicate at most " + itos(MAX_PROPERTIES) + " properties.");
+
+	ReplicatedEntity entity;
+	entity.path = p_path;
+	entity.properties.resize(p_properties.size());
+	entity.last_values.resize(p_properties.size());
+	PoolStringArray::Read r = p_properties.read();
+	for (int i = 0; i < p_properties.size(); i++) {
+		entity.properties.write[i] = r[i];
+	}
+
+	int id = next_entity_id++;
+	entities[id] = entity;
+	return id;
+}
+
+void NetworkReplicator::remove_entity(int p_id) {
+
+	ERR_FAIL_COND_MSG(!entities.has(p_id), "No replicated entity with id " + itos(p_id) + ".");
+	entities.erase(p_id);
+	client_states.erase(p_id);
+}
+
+void NetworkReplicator::clear_entities() {
+
+	entities.clear();
+	client_states.clear();
+	render_tick_valid = false;
+}
+
+void NetworkReplicator::set_tick_rate(int p_ticks_per_second) {
+
+	ERR_FAIL_COND(p_ticks_per_second <= 0);
+	tick_rate = p_ticks_per_second;
+}
+
+int NetworkReplicator::get_tick_rate() const {
+
+	return tick_rate;
+}
+
+void NetworkReplicator::set_interpolation_ticks(int p_ticks) {
+
+	ERR_FAIL_COND(p_ticks < 0);
+	interpolation_ticks = p_ticks;
+}
+
+int NetworkReplicator::get_interpolation_ticks() const {
+
+	return interpolation_ticks;
+}
+
+void NetworkReplicator::set_keyframe_interval(int p_ticks) {
+
+	ERR_FAIL_COND(p_ticks < 1);
+	keyframe_interval = p_ticks;
+}
+
+int NetworkReplicator::get_keyframe_interval() const {
+
+	return keyframe_interval;
+}
+
+void NetworkReplicator::_bind_methods() {
+
+	ClassDB::bind_method(D_METHOD("add_entity", "path", "properties"), &NetworkReplicator::add_entity);
+	ClassDB::bind_method(D_METHOD("remove_entity", "id"), &NetworkReplicator::remove_entity);
+	ClassDB::bind_method(D_METHOD("clear_entities"), &NetworkReplicator::clear_entities);
+
+	ClassDB::bind_method(D_METHOD("set_tick_rate", "ticks_per_second"), &NetworkReplicator::set_tick_rate);
+	ClassDB::bind_method(D_METHOD("get_tick_rate"), &NetworkReplicator::get_tick_rate);
+	ClassDB::bind_method(D_METHOD("set_interpolation_ticks", "ticks"), &NetworkReplicator::set_interpolation_ticks);
+	ClassDB::bind_method(D_METHOD("get_interpolation_ticks"), &NetworkReplicator::get_interpolation_ticks);
+	ClassDB::bind_method(D_METHOD("set_keyframe_interval", "ticks"), &NetworkReplicator::set_keyframe_interval);
+	ClassDB::bind_method(D_METHOD("get_keyframe_interval"), &NetworkReplicator::get_keyframe_interval);
+
+	ClassDB::bind_method(D_METHOD("_on_network_packet", "id", "packet"), &NetworkReplicator::_on_network_packet);
+
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "tick_rate", PROPERTY_HINT_RANGE, "1,120,1"), "set_tick_rate", "get_tick_rate");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "interpolation_ticks", PROPERTY_HINT_RANGE, "0,16,1"), "set_interpolation_ticks", "get_interpolation_ticks");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "keyframe_interval", PROPERTY_HINT_RANGE, "1,300,1"), "set_keyframe_interval", "get_keyframe_interval");
+
+	ADD_SIGNAL(MethodInfo("snapshot_received", PropertyInfo(Variant::INT, "tick")));
+}
+
+NetworkReplicator::NetworkReplicator() {
+
+	next_entity_id = 1;
+	tick_rate = 20;
+	interpolation_ticks = 2;
+	keyframe_interval = 30;
+	current_tick = 0;
+	tick_accum = 0;
+	last_received_tick = 0;
+	render_tick = 0;
+	render_tick_valid = false;
+}
@@ -0,0 +1,123 @@
+/*************************************************************************/
+/*  network_replicator.h                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef NETWORK_REPLICATOR_H
+#define NETWORK_REPLICATOR_H
+
+#include "scene/main/node.h"
+
+// Server-authoritative property replication above MultiplayerAPI: registered
+// entity properties are captured once per network tick into a delta-compressed
+// snapshot (periodic reliable keyframes, unreliable deltas in between), and
+// clients buffer a couple of ticks and interpolate between snapshots instead
+// of snapping to the last received value.
+//
+// Both ends must register the same entities in the same order, as entity ids
+// are assigned sequentially on registration.
+
+class NetworkReplicator : public Node {
+
+	GDCLASS(NetworkReplicator, Node);
+
+	enum {
+		SNAPSHOT_MAGIC = 0x52, // 'R'
+		SNAPSHOT_FLAG_KEYFRAME = 1,
+		MAX_PROPERTIES = 32, // Delta masks are a uint32_t
+		MAX_BUFFERED_SAMPLES = 64
+	};
+
+	struct ReplicatedEntity {
+
+		NodePath path;
+		Vector<StringName> properties;
+		Vector<Variant> last_values; // Server: last sent values, for delta masks
+	};
+
+	struct PropertySample {
+
+		uint32_t tick;
+		Variant value;
+	};
+
+	struct ClientEntityState {
+
+		Vector<List<PropertySample> > timelines; // One per registered property
+	};
+
+	Map<int, ReplicatedEntity> entities;
+	Map<int, ClientEntityState> client_states;
+	int next_entity_id;
+
+	int tick_rate;
+	int interpolation_ticks;
+	int keyframe_interval;
+
+	// Server
+	uint32_t current_tick;
+	float tick_accum;
+
+	// Client
+	uint32_t last_received_tick;
+	double render_tick;
+	bool render_tick_valid;
+
+	Vector<uint8_t> send_buffer; // Reused across ticks
+
+	void _append_bytes(const uint8_t *p_data, int p_len);
+	void _append_variant(const Variant &p_value);
+
+	void _capture_and_send();
+	void _apply_interpolated();
+	static bool _property_is_interpolable(const Variant &p_a, const Variant &p_b);
+
+	void _on_network_packet(int p_from, const PoolVector<uint8_t> &p_packet);
+
+protected:
+	void _notification(int p_what);
+	static void _bind_methods();
+
+public:
+	int add_entity(const NodePath &p_path, const PoolStringArray &p_properties);
+	void remove_entity(int p_id);
+	void clear_entities();
+
+	void set_tick_rate(int p_ticks_per_second);
+	int get_tick_rate() const;
+
+	void set_interpolation_ticks(int p_ticks);
+	int get_interpolation_ticks() const;
+
+	void set_keyframe_interval(int p_ticks);
+	int get_keyframe_interval() const;
+
+	NetworkReplicator();
+};
+
+#endif // NETWORK_REPLICATOR_H
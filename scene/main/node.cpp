@@ -46,6 +46,7 @@
 VARIANT_ENUM_CAST(Node::PauseMode);
 
 int Node::orphan_node_count = 0;
+uint64_t Node::tree_version = 1;
 
 void Node::_notification(int p_notification) {
 
@@ -339,6 +340,8 @@ void Node::move_child(Node *p_child, int p_pos) {
 	if (p_child->data.pos == p_pos)
 		return; //do nothing
 
+	tree_version++; //with duplicate names, sibling order can decide resolution
+
 	int motion_from = MIN(p_pos, p_child->data.pos);
 	int motion_to = MAX(p_pos, p_child->data.pos);
 
@@ -440,6 +443,9 @@ void Node::set_pause_mode(PauseMode p_mode) {
 	data.pause_mode = p_mode;
 	if (!is_inside_tree())
 		return; //pointless
+
+	data.tree->make_pause_state_changed(); //can_process() results may differ now
+
 	if ((data.pause_mode == PAUSE_MODE_INHERIT) == prev_inherits)
 		return; ///nothing changed
 
@@ -779,7 +785,7 @@ bool Node::can_process() const {
 float Node::get_physics_process_delta_time() const {
 
 	if (data.tree)
-		return data.tree->get_physics_process_time();
+		return data.tree->get_physics_process_time() * data.process_time_scale;
 	else
 		return 0;
 }
@@ -787,11 +793,16 @@ float Node::get_physics_process_delta_time() const {
 float Node::get_process_delta_time() const {
 
 	if (data.tree)
-		return data.tree->get_idle_process_time();
+		return data.tree->get_idle_process_time() * data.process_time_scale;
 	else
 		return 0;
 }
 
+float Node::get_process_time_scale() const {
+
+	return data.process_time_scale;
+}
+
 void Node::set_process(bool p_idle_process) {
 
 	if (data.idle_process == p_idle_process)
@@ -924,7 +935,13 @@ StringName Node::get_name() const {
 
 void Node::_set_name_nocheck(const StringName &p_name) {
 
+	StringName old_name = data.name;
 	data.name = p_name;
+	tree_version++;
+
+	if (data.parent) {
+		data.parent->_update_child_name_index(this, old_name);
+	}
 }
 
 String Node::invalid_character = ". : @ / \"";
@@ -946,11 +963,15 @@ void Node::set_name(const String &p_name) {
 	_validate_node_name(name);
 
 	ERR_FAIL_COND(name == "");
+
+	StringName old_name = data.name;
 	data.name = name;
+	tree_version++;
 
 	if (data.parent) {
 
 		data.parent->_validate_child_name(this);
+		data.parent->_update_child_name_index(this, old_name);
 	}
 
 	propagate_notification(NOTIFICATION_PATH_CHANGED);
@@ -1009,16 +1030,9 @@ void Node::_validate_child_name(Node *p_child, bool p_force_human_readable) {
 			unique = false;
 		} else {
 			//check if exists
-			Node **children = data.children.ptrw();
-			int cc = data.children.size();
-
-			for (int i = 0; i < cc; i++) {
-				if (children[i] == p_child)
-					continue;
-				if (children[i]->data.name == p_child->data.name) {
-					unique = false;
-					break;
-				}
+			Node *const *existing = data.children_by_name.getptr(p_child->data.name);
+			if (existing && *existing != p_child) {
+				unique = false;
 			}
 		}
 
@@ -1156,7 +1170,11 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name) {
 	p_child->data.name = p_name;
 	p_child->data.pos = data.children.size();
 	data.children.push_back(p_child);
+	if (!data.children_by_name.has(p_name)) {
+		data.children_by_name[p_name] = p_child; //with duplicate names, the first sibling wins lookups
+	}
 	p_child->data.parent = this;
+	tree_version++;
 	p_child->notification(NOTIFICATION_PARENTED);
 
 	if (data.tree) {
@@ -1266,6 +1284,13 @@ void Node::remove_child(Node *p_child) {
 
 	data.children.remove(idx);
 
+	{
+		Node **found = data.children_by_name.getptr(p_child->data.name);
+		if (found && *found == p_child) {
+			data.children_by_name.erase(p_child->data.name);
+		}
+	}
+
 	//update pointer and size
 	child_count = data.children.size();
 	children = data.children.ptrw();
@@ -1278,6 +1303,7 @@ void Node::remove_child(Node *p_child) {
 
 	p_child->data.parent = NULL;
 	p_child->data.pos = -1;
+	tree_version++;
 
 	// validate owner
 	p_child->_propagate_validate_owner();
@@ -1298,8 +1324,27 @@ Node *Node::get_child(int p_index) const {
 	return data.children[p_index];
 }
 
+void Node::_update_child_name_index(Node *p_child, const StringName &p_old_name) {
+
+	Node **found = data.children_by_name.getptr(p_old_name);
+	if (found && *found == p_child) {
+		data.children_by_name.erase(p_old_name);
+	}
+	if (!data.children_by_name.has(p_child->data.name)) {
+		data.children_by_name[p_child->data.name] = p_child;
+	}
+}
+
 Node *Node::_get_child_by_name(const StringName &p_name) const {
 
+	Node *const *found = data.children_by_name.getptr(p_name);
+	if (found)
+		return *found;
+
+	//not indexed; either no child has this name, or an indexed sibling with
+	//the same name was removed or renamed before this one (duplicates can
+	//only come in through _add_child_nocheck), so fall back to a scan
+
 	int cc = data.children.size();
 	Node *const *cd = data.children.ptr();
 
@@ -1319,6 +1364,13 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 
 	ERR_FAIL_COND_V_MSG(!data.inside_tree && p_path.is_absolute(), NULL, "Can't use get_node() with absolute paths from outside the active scene tree.");
 
+	{
+		const PathCache *pc = data.get_node_cache.getptr(p_path);
+		if (pc && pc->tree_version == tree_version) {
+			return pc->node;
+		}
+	}
+
 	Node *current = NULL;
 	Node *root = NULL;
 
@@ -1342,8 +1394,10 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 
 		} else if (name == SceneStringNames::get_singleton()->doubledot) { // ..
 
-			if (current == NULL || !current->data.parent)
-				return NULL;
+			if (current == NULL || !current->data.parent) {
+				current = NULL;
+				break;
+			}
 
 			next = current->data.parent;
 		} else if (current == NULL) {
@@ -1366,12 +1420,23 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 				}
 			}
 			if (next == NULL) {
-				return NULL;
+				current = NULL;
+				break;
 			};
 		}
 		current = next;
 	}
 
+	//negative results are cached too, they get invalidated like any other when the tree changes
+	if (data.get_node_cache.size() >= PATH_CACHE_MAX && !data.get_node_cache.has(p_path)) {
+		data.get_node_cache.clear();
+	}
+
+	PathCache pc;
+	pc.node = current;
+	pc.tree_version = tree_version;
+	data.get_node_cache.set(p_path, pc);
+
 	return current;
 }
 
@@ -2765,6 +2830,7 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_physics_process_delta_time"), &Node::get_physics_process_delta_time);
 	ClassDB::bind_method(D_METHOD("is_physics_processing"), &Node::is_physics_processing);
 	ClassDB::bind_method(D_METHOD("get_process_delta_time"), &Node::get_process_delta_time);
+	ClassDB::bind_method(D_METHOD("get_process_time_scale"), &Node::get_process_time_scale);
 	ClassDB::bind_method(D_METHOD("set_process", "enable"), &Node::set_process);
 	ClassDB::bind_method(D_METHOD("set_process_priority", "priority"), &Node::set_process_priority);
 	ClassDB::bind_method(D_METHOD("get_process_priority"), &Node::get_process_priority);
@@ -2953,6 +3019,7 @@ Node::Node() {
 	data.unhandled_key_input = false;
 	data.pause_mode = PAUSE_MODE_INHERIT;
 	data.pause_owner = NULL;
+	data.process_time_scale = 1;
 	data.network_master = 1; //server by default
 	data.path_cache = NULL;
 	data.parent_owned = false;
@@ -85,6 +85,21 @@ private:
 		GroupData() { persistent = false; }
 	};
 
+	// resolved get_node() results, valid while the global tree_version matches
+	struct PathCache {
+
+		Node *node;
+		uint64_t tree_version;
+	};
+
+	enum {
+		PATH_CACHE_MAX = 32 //per node, dynamic path users get the cache cleared instead of growing it
+	};
+
+	// bumped on any change that can alter how a NodePath resolves (reparenting,
+	// renames, child order), invalidating every cached path at once
+	static uint64_t tree_version;
+
 	struct Data {
 
 		String filename;
@@ -93,9 +108,12 @@ private:
 
 		HashMap<NodePath, int> editable_instances;
 
+		mutable HashMap<NodePath, PathCache> get_node_cache;
+
 		Node *parent;
 		Node *owner;
 		Vector<Node *> children; // list of children
+		HashMap<StringName, Node *> children_by_name; // name lookup index, maintained by add/remove/rename
 		int pos;
 		int depth;
 		int blocked; // safeguard that throws an error when attempting to modify the tree in a harmful way while being traversed.
@@ -116,6 +134,7 @@ private:
 
 		PauseMode pause_mode;
 		Node *pause_owner;
+		float process_time_scale; //set through SceneTree group time scales
 
 		int network_master;
 		Map<StringName, MultiplayerAPI::RPCMode> rpc_methods;
@@ -160,6 +179,7 @@ private:
 	void _replace_connections_target(Node *p_new_target);
 
 	void _validate_child_name(Node *p_child, bool p_force_human_readable = false);
+	void _update_child_name_index(Node *p_child, const StringName &p_old_name);
 	void _generate_serial_child_name(const Node *p_child, StringName &name) const;
 
 	void _propagate_reverse_notification(int p_notification);
@@ -343,6 +363,8 @@ public:
 	float get_process_delta_time() const;
 	bool is_processing() const;
 
+	float get_process_time_scale() const;
+
 	void set_physics_process_internal(bool p_process_internal);
 	bool is_physics_processing_internal() const;
 
@@ -36,6 +36,7 @@
 #include "core/os/dir_access.h"
 #include "core/os/keyboard.h"
 #include "core/os/os.h"
+#include "core/os/worker_thread_pool.h"
 #include "core/print_string.h"
 #include "core/project_settings.h"
 #include "main/input_default.h"
@@ -132,6 +133,12 @@ SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_nod
 	E->get().nodes.push_back(p_node);
 	//E->get().last_tree_version=0;
 	E->get().changed = true;
+
+	Map<StringName, float>::Element *TS = group_time_scales.find(p_group);
+	if (TS) {
+		p_node->data.process_time_scale = TS->get();
+	}
+
 	return &E->get();
 }
 
@@ -140,9 +147,15 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 	Map<StringName, Group>::Element *E = group_map.find(p_group);
 	ERR_FAIL_COND(!E);
 
+	if (group_time_scales.has(p_group)) {
+		p_node->data.process_time_scale = 1;
+	}
+
 	E->get().nodes.erase(p_node);
 	if (E->get().nodes.empty())
 		group_map.erase(E);
+	else
+		E->get().active_pause_version = 0; //the partition may hold the removed node
 }
 
 void SceneTree::make_group_changed(const StringName &p_group) {
@@ -151,6 +164,11 @@ void SceneTree::make_group_changed(const StringName &p_group) {
 		E->get().changed = true;
 }
 
+void SceneTree::make_pause_state_changed() {
+
+	pause_state_version++;
+}
+
 void SceneTree::flush_transform_notifications() {
 
 	SelfList<Node> *n = xform_change_list.first();
@@ -896,6 +914,7 @@ void SceneTree::set_pause(bool p_enabled) {
 	if (p_enabled == pause)
 		return;
 	pause = p_enabled;
+	make_pause_state_changed();
 	PhysicsServer::get_singleton()->set_active(!p_enabled);
 	Physics2DServer::get_singleton()->set_active(!p_enabled);
 	if (get_root())
@@ -951,6 +970,64 @@ void SceneTree::_call_input_pause(const StringName &p_group, const StringName &p
 		call_skip.clear();
 }
 
+struct _ParallelProcessData {
+
+	Node *const *nodes;
+	int notification;
+};
+
+static void _parallel_process_task(void *p_userdata, uint32_t p_index) {
+
+	_ParallelProcessData *pd = (_ParallelProcessData *)p_userdata;
+	pd->nodes[p_index]->notification(pd->notification);
+}
+
+void SceneTree::_process_parallel_groups(int p_notification, Set<Node *> &r_processed) {
+
+	for (Set<StringName>::Element *P = parallel_process_groups.front(); P; P = P->next()) {
+
+		Map<StringName, Group>::Element *E = group_map.find(P->get());
+		if (!E)
+			continue;
+
+		//snapshot the processable members, the worker tasks get a flat array
+		Vector<Node *> nodes;
+		const Group &g = E->get();
+		for (int i = 0; i < g.nodes.size(); i++) {
+
+			Node *n = g.nodes[i];
+			if (call_lock && call_skip.has(n))
+				continue;
+			if (!n->can_process())
+				continue;
+			if (!n->can_process_notification(p_notification))
+				continue;
+			nodes.push_back(n);
+		}
+
+		if (nodes.empty())
+			continue;
+
+		_ParallelProcessData pd;
+		pd.nodes = nodes.ptr();
+		pd.notification = p_notification;
+
+		WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+		if (pool && nodes.size() > 1) {
+			WorkerThreadPool::GroupID gid = pool->add_group_task(_parallel_process_task, &pd, nodes.size());
+			pool->wait_for_group_task_completion(gid); //sync point, the serial phase sees every member done
+		} else {
+			for (int i = 0; i < nodes.size(); i++) {
+				nodes[i]->notification(p_notification);
+			}
+		}
+
+		for (int i = 0; i < nodes.size(); i++) {
+			r_processed.insert(nodes[i]);
+		}
+	}
+}
+
 void SceneTree::_notify_group_pause(const StringName &p_group, int p_notification) {
 
 	Map<StringName, Group>::Element *E = group_map.find(p_group);
@@ -960,25 +1037,44 @@ void SceneTree::_notify_group_pause(const StringName &p_group, int p_notificatio
 	if (g.nodes.empty())
 		return;
 
+	bool membership_changed = g.changed;
 	_update_group_order(g, p_notification == Node::NOTIFICATION_PROCESS || p_notification == Node::NOTIFICATION_INTERNAL_PROCESS || p_notification == Node::NOTIFICATION_PHYSICS_PROCESS || p_notification == Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
 
+	if (membership_changed || g.active_pause_version != pause_state_version) {
+		//repartition so the frame loop only touches nodes that can run under
+		//the current pause state; with most of the tree paused this skips the
+		//idle majority entirely. Any change that may affect can_process()
+		//bumps pause_state_version (see make_pause_state_changed()).
+		g.active_nodes.clear();
+		for (int i = 0; i < g.nodes.size(); i++) {
+			if (g.nodes[i]->can_process())
+				g.active_nodes.push_back(g.nodes[i]);
+		}
+		g.active_pause_version = pause_state_version;
+	}
+
 	//copy, so copy on write happens in case something is removed from process while being called
 	//performance is not lost because only if something is added/removed the vector is copied.
-	Vector<Node *> nodes_copy = g.nodes;
+	Vector<Node *> nodes_copy = g.active_nodes;
 
 	int node_count = nodes_copy.size();
 	Node **nodes = nodes_copy.ptrw();
 
 	call_lock++;
 
+	Set<Node *> processed_in_parallel;
+	if (!parallel_process_groups.empty()) {
+		_process_parallel_groups(p_notification, processed_in_parallel);
+	}
+
 	for (int i = 0; i < node_count; i++) {
 
 		Node *n = nodes[i];
 		if (call_lock && call_skip.has(n))
 			continue;
-
-		if (!n->can_process())
+		if (processed_in_parallel.has(n))
 			continue;
+
 		if (!n->can_process_notification(p_notification))
 			continue;
 
@@ -1082,6 +1178,47 @@ bool SceneTree::has_group(const StringName &p_identifier) const {
 
 	return group_map.has(p_identifier);
 }
+
+void SceneTree::set_group_parallel_process(const StringName &p_group, bool p_enable) {
+
+	if (p_enable) {
+		parallel_process_groups.insert(p_group);
+	} else {
+		parallel_process_groups.erase(p_group);
+	}
+}
+
+bool SceneTree::is_group_parallel_process(const StringName &p_group) const {
+
+	return parallel_process_groups.has(p_group);
+}
+
+void SceneTree::set_group_time_scale(const StringName &p_group, float p_scale) {
+
+	ERR_FAIL_COND(p_scale < 0);
+
+	if (p_scale == 1) {
+		group_time_scales.erase(p_group);
+	} else {
+		group_time_scales[p_group] = p_scale;
+	}
+
+	//apply to current members; nodes joining or leaving the group later are
+	//handled by add_to_group/remove_from_group
+	Map<StringName, Group>::Element *E = group_map.find(p_group);
+	if (E) {
+		Group &g = E->get();
+		for (int i = 0; i < g.nodes.size(); i++) {
+			g.nodes[i]->data.process_time_scale = p_scale;
+		}
+	}
+}
+
+float SceneTree::get_group_time_scale(const StringName &p_group) const {
+
+	const Map<StringName, float>::Element *E = group_time_scales.find(p_group);
+	return E ? E->get() : 1.0;
+}
 void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_list) {
 
 	Map<StringName, Group>::Element *E = group_map.find(p_group);
@@ -1321,6 +1458,97 @@ Error SceneTree::reload_current_scene() {
 	return change_scene(fname);
 }
 
+void SceneTree::_reset_pooled_instance(Node *p_root, const Ref<PackedScene> &p_scene) {
+
+	//re-apply the properties recorded in the scene, so the revived instance
+	//starts over from its on-disk state; nodes added or removed at runtime and
+	//external signal connections are the caller's responsibility
+	Ref<PackedScene> scene = p_scene;
+	Ref<SceneState> state = scene->get_state();
+	if (state.is_null())
+		return;
+
+	int nc = state->get_node_count();
+	for (int i = 0; i < nc; i++) {
+
+		Node *node;
+		if (i == 0) {
+			node = p_root;
+		} else {
+			node = p_root->get_node_or_null(state->get_node_path(i));
+			if (!node)
+				continue;
+		}
+
+		int pc = state->get_node_property_count(i);
+		for (int j = 0; j < pc; j++) {
+			node->set(state->get_node_property_name(i, j), state->get_node_property_value(i, j));
+		}
+	}
+}
+
+Node *SceneTree::instance_pooled(const Ref<PackedScene> &p_scene) {
+
+	ERR_FAIL_COND_V(p_scene.is_null(), NULL);
+
+	String path = p_scene->get_path();
+	InstancePool *pool = path != String() ? instance_pools.getptr(path) : NULL;
+
+	if (pool && pool->nodes.size() > 0) {
+
+		Node *node = pool->nodes[pool->nodes.size() - 1];
+		pool->nodes.resize(pool->nodes.size() - 1);
+		_reset_pooled_instance(node, p_scene);
+		return node;
+	}
+
+	return p_scene->instance();
+}
+
+void SceneTree::release_pooled(Node *p_node) {
+
+	ERR_FAIL_NULL(p_node);
+	String path = p_node->get_filename();
+	ERR_FAIL_COND_MSG(path == String(), "Only the root of an instanced scene can be released to the pool.");
+
+	if (p_node->get_parent()) {
+		p_node->get_parent()->remove_child(p_node);
+	}
+
+	InstancePool &pool = instance_pools[path];
+	if (pool.nodes.size() >= max_pooled_instances) {
+		queue_delete(p_node);
+		return;
+	}
+
+	pool.nodes.push_back(p_node);
+}
+
+void SceneTree::clear_instance_pools() {
+
+	const String *K = NULL;
+	while ((K = instance_pools.next(K))) {
+
+		InstancePool &pool = instance_pools[*K];
+		for (int i = 0; i < pool.nodes.size(); i++) {
+			memdelete(pool.nodes[i]);
+		}
+	}
+
+	instance_pools.clear();
+}
+
+void SceneTree::set_max_pooled_instances(int p_amount) {
+
+	ERR_FAIL_COND(p_amount < 0);
+	max_pooled_instances = p_amount;
+}
+
+int SceneTree::get_max_pooled_instances() const {
+
+	return max_pooled_instances;
+}
+
 void SceneTree::add_current_scene(Node *p_current) {
 
 	current_scene = p_current;
@@ -1826,6 +2054,10 @@ void SceneTree::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_root"), &SceneTree::get_root);
 	ClassDB::bind_method(D_METHOD("has_group", "name"), &SceneTree::has_group);
+	ClassDB::bind_method(D_METHOD("set_group_parallel_process", "group", "enable"), &SceneTree::set_group_parallel_process);
+	ClassDB::bind_method(D_METHOD("is_group_parallel_process", "group"), &SceneTree::is_group_parallel_process);
+	ClassDB::bind_method(D_METHOD("set_group_time_scale", "group", "scale"), &SceneTree::set_group_time_scale);
+	ClassDB::bind_method(D_METHOD("get_group_time_scale", "group"), &SceneTree::get_group_time_scale);
 
 	ClassDB::bind_method(D_METHOD("set_auto_accept_quit", "enabled"), &SceneTree::set_auto_accept_quit);
 	ClassDB::bind_method(D_METHOD("set_quit_on_go_back", "enabled"), &SceneTree::set_quit_on_go_back);
@@ -1884,6 +2116,12 @@ void SceneTree::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("reload_current_scene"), &SceneTree::reload_current_scene);
 
+	ClassDB::bind_method(D_METHOD("instance_pooled", "scene"), &SceneTree::instance_pooled);
+	ClassDB::bind_method(D_METHOD("release_pooled", "node"), &SceneTree::release_pooled);
+	ClassDB::bind_method(D_METHOD("clear_instance_pools"), &SceneTree::clear_instance_pools);
+	ClassDB::bind_method(D_METHOD("set_max_pooled_instances", "amount"), &SceneTree::set_max_pooled_instances);
+	ClassDB::bind_method(D_METHOD("get_max_pooled_instances"), &SceneTree::get_max_pooled_instances);
+
 	ClassDB::bind_method(D_METHOD("_change_scene"), &SceneTree::_change_scene);
 
 	ClassDB::bind_method(D_METHOD("set_multiplayer", "multiplayer"), &SceneTree::set_multiplayer);
@@ -2051,6 +2289,7 @@ SceneTree::SceneTree() {
 	node_renamed_name = "node_renamed";
 	ugc_locked = false;
 	call_lock = 0;
+	pause_state_version = 1;
 	root_lock = 0;
 	node_count = 0;
 
@@ -2070,6 +2309,7 @@ SceneTree::SceneTree() {
 	root->set_as_audio_listener(true);
 	root->set_as_audio_listener_2d(true);
 	current_scene = NULL;
+	max_pooled_instances = GLOBAL_DEF("memory/limits/instance_pool/max_instances_per_scene", 64);
 
 	int ref_atlas_size = GLOBAL_DEF("rendering/quality/reflections/atlas_size", 2048);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/quality/reflections/atlas_size", PropertyInfo(Variant::INT, "rendering/quality/reflections/atlas_size", PROPERTY_HINT_RANGE, "0,8192,or_greater")); //next_power_of_2 will return a 0 as min value
@@ -2148,6 +2388,9 @@ SceneTree::SceneTree() {
 }
 
 SceneTree::~SceneTree() {
+
+	clear_instance_pools();
+
 	if (root) {
 		root->_set_tree(NULL);
 		root->_propagate_after_exit_tree();
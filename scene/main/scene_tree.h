@@ -97,7 +97,12 @@ private:
 		Vector<Node *> nodes;
 		//uint64_t last_tree_version;
 		bool changed;
-		Group() { changed = false; };
+		Vector<Node *> active_nodes; //partition of nodes that passes can_process()
+		uint64_t active_pause_version; //0 means the partition needs a rebuild
+		Group() {
+			changed = false;
+			active_pause_version = 0;
+		};
 	};
 
 	Viewport *root;
@@ -116,6 +121,17 @@ private:
 	int root_lock;
 
 	Map<StringName, Group> group_map;
+
+	struct InstancePool {
+
+		Vector<Node *> nodes;
+	};
+
+	HashMap<String, InstancePool> instance_pools; //deactivated scene instances, keyed by scene path
+	int max_pooled_instances;
+
+	void _reset_pooled_instance(Node *p_root, const Ref<PackedScene> &p_scene);
+
 	bool _quit;
 	bool initialized;
 	bool input_handled;
@@ -146,6 +162,11 @@ private:
 	int call_lock;
 	Set<Node *> call_skip; //skip erased nodes
 
+	Set<StringName> parallel_process_groups; //groups declared safe for concurrent processing
+
+	uint64_t pause_state_version; //bumped whenever the outcome of can_process() may have changed
+	Map<StringName, float> group_time_scales;
+
 	StretchMode stretch_mode;
 	StretchAspect stretch_aspect;
 	Size2i stretch_min;
@@ -205,8 +226,10 @@ private:
 	Group *add_to_group(const StringName &p_group, Node *p_node);
 	void remove_from_group(const StringName &p_group, Node *p_node);
 	void make_group_changed(const StringName &p_group);
+	void make_pause_state_changed();
 
 	void _notify_group_pause(const StringName &p_group, int p_notification);
+	void _process_parallel_groups(int p_notification, Set<Node *> &r_processed);
 	void _call_input_pause(const StringName &p_group, const StringName &p_method, const Ref<InputEvent> &p_input);
 	Variant _call_group_flags(const Variant **p_args, int p_argcount, Variant::CallError &r_error);
 	Variant _call_group(const Variant **p_args, int p_argcount, Variant::CallError &r_error);
@@ -365,6 +388,15 @@ public:
 	void get_nodes_in_group(const StringName &p_group, List<Node *> *p_list);
 	bool has_group(const StringName &p_identifier) const;
 
+	//members of a parallel group get their process notifications dispatched over the
+	//worker thread pool (with a sync point before the regular serial pass), so their
+	//_process/_physics_process must not touch the scene tree or unguarded shared state
+	void set_group_parallel_process(const StringName &p_group, bool p_enable);
+	bool is_group_parallel_process(const StringName &p_group) const;
+
+	void set_group_time_scale(const StringName &p_group, float p_scale);
+	float get_group_time_scale(const StringName &p_group) const;
+
 	void set_screen_stretch(StretchMode p_mode, StretchAspect p_aspect, const Size2 &p_minsize, real_t p_shrink = 1);
 
 	void set_use_font_oversampling(bool p_oversampling);
@@ -382,6 +414,17 @@ public:
 	Error change_scene_to(const Ref<PackedScene> &p_scene);
 	Error reload_current_scene();
 
+	//instance recycling for high-churn scenes (projectiles, particles, debris):
+	//release_pooled() detaches a scene instance and parks it in a per-scene
+	//freelist, instance_pooled() revives one (re-applying the properties stored
+	//in the scene) instead of building the subtree from scratch
+	Node *instance_pooled(const Ref<PackedScene> &p_scene);
+	void release_pooled(Node *p_node);
+	void clear_instance_pools();
+
+	void set_max_pooled_instances(int p_amount);
+	int get_max_pooled_instances() const;
+
 	Ref<SceneTreeTimer> create_timer(float p_delay_sec, bool p_process_pause = true);
 
 	//used by Main::start, don't use otherwise
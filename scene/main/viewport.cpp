@@ -3026,6 +3026,20 @@ bool Viewport::get_hdr() const {
 	return hdr;
 }
 
+void Viewport::set_depth_prepass_mode(DepthPrepassMode p_mode) {
+
+	if (depth_prepass_mode == p_mode)
+		return;
+
+	depth_prepass_mode = p_mode;
+	VS::get_singleton()->viewport_set_depth_prepass(viewport, VS::ViewportDepthPrepassMode(p_mode));
+}
+
+Viewport::DepthPrepassMode Viewport::get_depth_prepass_mode() const {
+
+	return depth_prepass_mode;
+}
+
 void Viewport::set_usage(Usage p_usage) {
 
 	usage = p_usage;
@@ -3150,6 +3164,9 @@ void Viewport::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_hdr", "enable"), &Viewport::set_hdr);
 	ClassDB::bind_method(D_METHOD("get_hdr"), &Viewport::get_hdr);
 
+	ClassDB::bind_method(D_METHOD("set_depth_prepass_mode", "mode"), &Viewport::set_depth_prepass_mode);
+	ClassDB::bind_method(D_METHOD("get_depth_prepass_mode"), &Viewport::get_depth_prepass_mode);
+
 	ClassDB::bind_method(D_METHOD("set_usage", "usage"), &Viewport::set_usage);
 	ClassDB::bind_method(D_METHOD("get_usage"), &Viewport::get_usage);
 
@@ -3236,6 +3253,7 @@ void Viewport::_bind_methods() {
 	ADD_GROUP("Rendering", "");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "msaa", PROPERTY_HINT_ENUM, "Disabled,2x,4x,8x,16x,AndroidVR 2x,AndroidVR 4x"), "set_msaa", "get_msaa");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "hdr"), "set_hdr", "get_hdr");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "depth_prepass_mode", PROPERTY_HINT_ENUM, "Inherit,Disabled,Enabled"), "set_depth_prepass_mode", "get_depth_prepass_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "disable_3d"), "set_disable_3d", "is_3d_disabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "keep_3d_linear"), "set_keep_3d_linear", "get_keep_3d_linear");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "usage", PROPERTY_HINT_ENUM, "2D,2D No-Sampling,3D,3D No-Effects"), "set_usage", "get_usage");
@@ -3244,7 +3262,7 @@ void Viewport::_bind_methods() {
 	ADD_GROUP("Render Target", "render_target_");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "render_target_v_flip"), "set_vflip", "get_vflip");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "render_target_clear_mode", PROPERTY_HINT_ENUM, "Always,Never,Next Frame"), "set_clear_mode", "get_clear_mode");
-	ADD_PROPERTY(PropertyInfo(Variant::INT, "render_target_update_mode", PROPERTY_HINT_ENUM, "Disabled,Once,When Visible,Always"), "set_update_mode", "get_update_mode");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "render_target_update_mode", PROPERTY_HINT_ENUM, "Disabled,Once,When Visible,Always,When Changed"), "set_update_mode", "get_update_mode");
 	ADD_GROUP("Audio Listener", "audio_listener_");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "audio_listener_enable_2d"), "set_as_audio_listener_2d", "is_audio_listener_2d");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "audio_listener_enable_3d"), "set_as_audio_listener", "is_audio_listener");
@@ -3269,6 +3287,7 @@ void Viewport::_bind_methods() {
 	BIND_ENUM_CONSTANT(UPDATE_ONCE);
 	BIND_ENUM_CONSTANT(UPDATE_WHEN_VISIBLE);
 	BIND_ENUM_CONSTANT(UPDATE_ALWAYS);
+	BIND_ENUM_CONSTANT(UPDATE_WHEN_CHANGED);
 
 	BIND_ENUM_CONSTANT(SHADOW_ATLAS_QUADRANT_SUBDIV_DISABLED);
 	BIND_ENUM_CONSTANT(SHADOW_ATLAS_QUADRANT_SUBDIV_1);
@@ -3303,6 +3322,10 @@ void Viewport::_bind_methods() {
 	BIND_ENUM_CONSTANT(USAGE_3D);
 	BIND_ENUM_CONSTANT(USAGE_3D_NO_EFFECTS);
 
+	BIND_ENUM_CONSTANT(DEPTH_PREPASS_INHERIT);
+	BIND_ENUM_CONSTANT(DEPTH_PREPASS_DISABLED);
+	BIND_ENUM_CONSTANT(DEPTH_PREPASS_ENABLED);
+
 	BIND_ENUM_CONSTANT(CLEAR_MODE_ALWAYS);
 	BIND_ENUM_CONSTANT(CLEAR_MODE_NEVER);
 	BIND_ENUM_CONSTANT(CLEAR_MODE_ONLY_NEXT_FRAME);
@@ -3394,6 +3417,7 @@ Viewport::Viewport() {
 
 	msaa = MSAA_DISABLED;
 	hdr = true;
+	depth_prepass_mode = DEPTH_PREPASS_INHERIT;
 
 	usage = USAGE_3D;
 	debug_draw = DEBUG_DRAW_DISABLED;
@@ -95,7 +95,8 @@ public:
 		UPDATE_DISABLED,
 		UPDATE_ONCE, //then goes to disabled
 		UPDATE_WHEN_VISIBLE, // default
-		UPDATE_ALWAYS
+		UPDATE_ALWAYS,
+		UPDATE_WHEN_CHANGED
 	};
 
 	enum ShadowAtlasQuadrantSubdiv {
@@ -125,6 +126,12 @@ public:
 		USAGE_3D_NO_EFFECTS,
 	};
 
+	enum DepthPrepassMode {
+		DEPTH_PREPASS_INHERIT,
+		DEPTH_PREPASS_DISABLED,
+		DEPTH_PREPASS_ENABLED,
+	};
+
 	enum RenderInfo {
 
 		RENDER_INFO_OBJECTS_IN_FRAME,
@@ -281,6 +288,7 @@ private:
 
 	MSAA msaa;
 	bool hdr;
+	DepthPrepassMode depth_prepass_mode;
 
 	Ref<ViewportTexture> default_texture;
 	Set<ViewportTexture *> viewport_textures;
@@ -496,6 +504,9 @@ public:
 	void set_hdr(bool p_hdr);
 	bool get_hdr() const;
 
+	void set_depth_prepass_mode(DepthPrepassMode p_mode);
+	DepthPrepassMode get_depth_prepass_mode() const;
+
 	Vector2 get_camera_coords(const Vector2 &p_viewport_coords) const;
 	Vector2 get_camera_rect_size() const;
 
@@ -565,6 +576,7 @@ VARIANT_ENUM_CAST(Viewport::UpdateMode);
 VARIANT_ENUM_CAST(Viewport::ShadowAtlasQuadrantSubdiv);
 VARIANT_ENUM_CAST(Viewport::MSAA);
 VARIANT_ENUM_CAST(Viewport::Usage);
+VARIANT_ENUM_CAST(Viewport::DepthPrepassMode);
 VARIANT_ENUM_CAST(Viewport::DebugDraw);
 VARIANT_ENUM_CAST(Viewport::ClearMode);
 VARIANT_ENUM_CAST(Viewport::RenderInfo);
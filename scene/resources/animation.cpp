@@ -91,6 +91,45 @@ bool Animation::_set(const StringName &p_name, const Variant &p_value) {
 			if (track_get_type(track) == TYPE_TRANSFORM) {
 
 				TransformTrack *tt = static_cast<TransformTrack *>(tracks[track]);
+
+				if (p_value.get_type() == Variant::DICTIONARY) {
+					//quantized track, see compress_transform_tracks()
+					Dictionary d = p_value;
+					ERR_FAIL_COND_V(!d.has("compressed"), false);
+
+					tt->loc_begin = d["loc_begin"];
+					tt->loc_end = d["loc_end"];
+					tt->scale_begin = d["scale_begin"];
+					tt->scale_end = d["scale_end"];
+
+					PoolVector<int> data = d["compressed"];
+					int dcount = data.size();
+					ERR_FAIL_COND_V(dcount % 10, false); //10 quantized values per key
+
+					PoolVector<int>::Read r = data.read();
+
+					tt->compressed_keys.resize(dcount / 10);
+
+					for (int i = 0; i < (dcount / 10); i++) {
+
+						CompressedTransformKey &ck = tt->compressed_keys.write[i];
+						const int *ofs = &r[i * 10];
+						ck.time = ofs[0];
+						ck.loc[0] = ofs[1];
+						ck.loc[1] = ofs[2];
+						ck.loc[2] = ofs[3];
+						ck.rot[0] = ofs[4];
+						ck.rot[1] = ofs[5];
+						ck.rot[2] = ofs[6];
+						ck.scale[0] = ofs[7];
+						ck.scale[1] = ofs[8];
+						ck.scale[2] = ofs[9];
+					}
+
+					tt->compressed = true;
+					return true;
+				}
+
 				PoolVector<float> values = p_value;
 				int vcount = values.size();
 				ERR_FAIL_COND_V(vcount % 12, false); // should be multiple of 11
@@ -373,6 +412,45 @@ bool Animation::_get(const StringName &p_name, Variant &r_ret) const {
 
 			if (track_get_type(track) == TYPE_TRANSFORM) {
 
+				const TransformTrack *tt = static_cast<const TransformTrack *>(tracks[track]);
+
+				if (tt->compressed) {
+
+					int kk = tt->compressed_keys.size();
+
+					PoolVector<int> data;
+					data.resize(kk * 10); //10 quantized values per key
+
+					PoolVector<int>::Write dw = data.write();
+
+					for (int i = 0; i < kk; i++) {
+
+						const CompressedTransformKey &ck = tt->compressed_keys[i];
+						int *ofs = &dw[i * 10];
+						ofs[0] = ck.time;
+						ofs[1] = ck.loc[0];
+						ofs[2] = ck.loc[1];
+						ofs[3] = ck.loc[2];
+						ofs[4] = ck.rot[0];
+						ofs[5] = ck.rot[1];
+						ofs[6] = ck.rot[2];
+						ofs[7] = ck.scale[0];
+						ofs[8] = ck.scale[1];
+						ofs[9] = ck.scale[2];
+					}
+
+					dw.release();
+
+					Dictionary d;
+					d["compressed"] = data;
+					d["loc_begin"] = tt->loc_begin;
+					d["loc_end"] = tt->loc_end;
+					d["scale_begin"] = tt->scale_begin;
+					d["scale_end"] = tt->scale_end;
+					r_ret = d;
+					return true;
+				}
+
 				PoolVector<real_t> keys;
 				int kk = track_get_key_count(track);
 				keys.resize(kk * 12);
@@ -684,6 +762,7 @@ void Animation::remove_track(int p_track) {
 
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
 			_clear(tt->transforms);
+			_clear(tt->compressed_keys);
 
 		} break;
 		case TYPE_VALUE: {
@@ -851,6 +930,22 @@ Error Animation::transform_track_get_key(int p_track, int p_key, Vector3 *r_loc,
 
 	TransformTrack *tt = static_cast<TransformTrack *>(t);
 	ERR_FAIL_COND_V(t->type != TYPE_TRANSFORM, ERR_INVALID_PARAMETER);
+
+	if (tt->compressed) {
+
+		ERR_FAIL_INDEX_V(p_key, tt->compressed_keys.size(), ERR_INVALID_PARAMETER);
+		TKey<TransformKey> key = _decompress_transform_key(tt, p_key);
+
+		if (r_loc)
+			*r_loc = key.value.loc;
+		if (r_rot)
+			*r_rot = key.value.rot;
+		if (r_scale)
+			*r_scale = key.value.scale;
+
+		return OK;
+	}
+
 	ERR_FAIL_INDEX_V(p_key, tt->transforms.size(), ERR_INVALID_PARAMETER);
 
 	if (r_loc)
@@ -863,6 +958,15 @@ Error Animation::transform_track_get_key(int p_track, int p_key, Vector3 *r_loc,
 	return OK;
 }
 
+bool Animation::transform_track_is_compressed(int p_track) const {
+
+	ERR_FAIL_INDEX_V(p_track, tracks.size(), false);
+	Track *t = tracks[p_track];
+	ERR_FAIL_COND_V(t->type != TYPE_TRANSFORM, false);
+
+	return static_cast<TransformTrack *>(t)->compressed;
+}
+
 int Animation::transform_track_insert_key(int p_track, float p_time, const Vector3 &p_loc, const Quat &p_rot, const Vector3 &p_scale) {
 
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), -1);
@@ -870,6 +974,7 @@ int Animation::transform_track_insert_key(int p_track, float p_time, const Vecto
 	ERR_FAIL_COND_V(t->type != TYPE_TRANSFORM, -1);
 
 	TransformTrack *tt = static_cast<TransformTrack *>(t);
+	ERR_FAIL_COND_V_MSG(tt->compressed, -1, "Compressed transform tracks can't be modified.");
 
 	TKey<TransformKey> tkey;
 	tkey.time = p_time;
@@ -898,6 +1003,7 @@ void Animation::track_remove_key(int p_track, int p_idx) {
 		case TYPE_TRANSFORM: {
 
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			ERR_FAIL_COND_MSG(tt->compressed, "Compressed transform tracks can't be modified.");
 			ERR_FAIL_INDEX(p_idx, tt->transforms.size());
 			tt->transforms.remove(p_idx);
 
@@ -951,6 +1057,15 @@ int Animation::track_find_key(int p_track, float p_time, bool p_exact) const {
 		case TYPE_TRANSFORM: {
 
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			if (tt->compressed) {
+				float ct = length > 0 ? p_time / length * 65535.0 : 0.0;
+				int k = _find(tt->compressed_keys, ct);
+				if (k < 0 || k >= tt->compressed_keys.size())
+					return -1;
+				if (_decompress_transform_key(tt, k).time != p_time && p_exact)
+					return -1;
+				return k;
+			}
 			int k = _find(tt->transforms, p_time);
 			if (k < 0 || k >= tt->transforms.size())
 				return -1;
@@ -1136,6 +1251,8 @@ int Animation::track_get_key_count(int p_track) const {
 		case TYPE_TRANSFORM: {
 
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			if (tt->compressed)
+				return tt->compressed_keys.size();
 			return tt->transforms.size();
 		} break;
 		case TYPE_VALUE: {
@@ -1179,6 +1296,18 @@ Variant Animation::track_get_key_value(int p_track, int p_key_idx) const {
 		case TYPE_TRANSFORM: {
 
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			if (tt->compressed) {
+				ERR_FAIL_INDEX_V(p_key_idx, tt->compressed_keys.size(), Variant());
+
+				TKey<TransformKey> key = _decompress_transform_key(tt, p_key_idx);
+
+				Dictionary d;
+				d["location"] = key.value.loc;
+				d["rotation"] = key.value.rot;
+				d["scale"] = key.value.scale;
+
+				return d;
+			}
 			ERR_FAIL_INDEX_V(p_key_idx, tt->transforms.size(), Variant());
 
 			Dictionary d;
@@ -1255,6 +1384,10 @@ float Animation::track_get_key_time(int p_track, int p_key_idx) const {
 		case TYPE_TRANSFORM: {
 
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			if (tt->compressed) {
+				ERR_FAIL_INDEX_V(p_key_idx, tt->compressed_keys.size(), -1);
+				return tt->compressed_keys[p_key_idx].time * (length / 65535.0);
+			}
 			ERR_FAIL_INDEX_V(p_key_idx, tt->transforms.size(), -1);
 			return tt->transforms[p_key_idx].time;
 		} break;
@@ -1308,6 +1441,7 @@ void Animation::track_set_key_time(int p_track, int p_key_idx, float p_time) {
 		case TYPE_TRANSFORM: {
 
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			ERR_FAIL_COND_MSG(tt->compressed, "Compressed transform tracks can't be modified.");
 			ERR_FAIL_INDEX(p_key_idx, tt->transforms.size());
 			TKey<TransformKey> key = tt->transforms[p_key_idx];
 			key.time = p_time;
@@ -1380,6 +1514,8 @@ float Animation::track_get_key_transition(int p_track, int p_key_idx) const {
 		case TYPE_TRANSFORM: {
 
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			if (tt->compressed)
+				return 1; //compressed keys don't store transitions
 			ERR_FAIL_INDEX_V(p_key_idx, tt->transforms.size(), -1);
 			return tt->transforms[p_key_idx].transition;
 		} break;
@@ -1424,6 +1560,7 @@ void Animation::track_set_key_value(int p_track, int p_key_idx, const Variant &p
 		case TYPE_TRANSFORM: {
 
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			ERR_FAIL_COND_MSG(tt->compressed, "Compressed transform tracks can't be modified.");
 			ERR_FAIL_INDEX(p_key_idx, tt->transforms.size());
 
 			Dictionary d = p_value;
@@ -1510,6 +1647,7 @@ void Animation::track_set_key_transition(int p_track, int p_key_idx, float p_tra
 		case TYPE_TRANSFORM: {
 
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			ERR_FAIL_COND_MSG(tt->compressed, "Compressed transform tracks can't be modified.");
 			ERR_FAIL_INDEX(p_key_idx, tt->transforms.size());
 			tt->transforms.write[p_key_idx].transition = p_transition;
 		} break;
@@ -1538,12 +1676,22 @@ void Animation::track_set_key_transition(int p_track, int p_key_idx, float p_tra
 }
 
 template <class K>
-int Animation::_find(const Vector<K> &p_keys, float p_time) const {
+int Animation::_find(const Vector<K> &p_keys, float p_time, int p_hint) const {
 
 	int len = p_keys.size();
 	if (len == 0)
 		return -2;
 
+	if (p_hint >= 0 && p_hint < len && p_keys[p_hint].time <= p_time) {
+		// during sequential playback the playhead only advances a key or two per
+		// frame, so resume scanning from where the last call left off
+		int idx = p_hint;
+		while (idx + 1 < len && (p_keys[idx + 1].time <= p_time || Math::is_equal_approx(p_time, p_keys[idx + 1].time))) {
+			idx++;
+		}
+		return idx;
+	}
+
 	int low = 0;
 	int high = len - 1;
 	int middle = 0;
@@ -1720,7 +1868,7 @@ float Animation::_cubic_interpolate(const float &p_pre_a, const float &p_a, cons
 }
 
 template <class T>
-T Animation::_interpolate(const Vector<TKey<T> > &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok) const {
+T Animation::_interpolate(const Vector<TKey<T> > &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, int *p_key_hint) const {
 
 	int len = _find(p_keys, length) + 1; // try to find last key (there may be more past the end)
 
@@ -1737,7 +1885,10 @@ T Animation::_interpolate(const Vector<TKey<T> > &p_keys, float p_time, Interpol
 		return p_keys[0].value;
 	}
 
-	int idx = _find(p_keys, p_time);
+	int idx = _find(p_keys, p_time, p_key_hint ? *p_key_hint : -1);
+	if (p_key_hint) {
+		*p_key_hint = idx;
+	}
 
 	ERR_FAIL_COND_V(idx == -2, T());
 
@@ -1863,7 +2014,170 @@ T Animation::_interpolate(const Vector<TKey<T> > &p_keys, float p_time, Interpol
 	// do a barrel roll
 }
 
-Error Animation::transform_track_interpolate(int p_track, float p_time, Vector3 *r_loc, Quat *r_rot, Vector3 *r_scale) const {
+_FORCE_INLINE_ Animation::TKey<Animation::TransformKey> Animation::_decompress_transform_key(const TransformTrack *p_track, int p_idx) const {
+
+	const CompressedTransformKey &ck = p_track->compressed_keys[p_idx];
+
+	TKey<TransformKey> key;
+	key.time = ck.time * (length / 65535.0);
+	key.transition = 1; //not stored in the compressed form
+
+	key.value.loc = Vector3(
+			p_track->loc_begin.x + (p_track->loc_end.x - p_track->loc_begin.x) * (ck.loc[0] * (1.0 / 65535.0)),
+			p_track->loc_begin.y + (p_track->loc_end.y - p_track->loc_begin.y) * (ck.loc[1] * (1.0 / 65535.0)),
+			p_track->loc_begin.z + (p_track->loc_end.z - p_track->loc_begin.z) * (ck.loc[2] * (1.0 / 65535.0)));
+
+	Vector3 axis = Vector3(ck.rot[0], ck.rot[1], ck.rot[2]) * (2.0 / 65535.0) - Vector3(1, 1, 1);
+	float w = Math::sqrt(MAX(0.0f, 1.0f - axis.length_squared())); //quantization was done on the positive hemisphere
+	key.value.rot = Quat(axis.x, axis.y, axis.z, w).normalized();
+
+	key.value.scale = Vector3(
+			p_track->scale_begin.x + (p_track->scale_end.x - p_track->scale_begin.x) * (ck.scale[0] * (1.0 / 65535.0)),
+			p_track->scale_begin.y + (p_track->scale_end.y - p_track->scale_begin.y) * (ck.scale[1] * (1.0 / 65535.0)),
+			p_track->scale_begin.z + (p_track->scale_end.z - p_track->scale_begin.z) * (ck.scale[2] * (1.0 / 65535.0)));
+
+	return key;
+}
+
+Animation::TransformKey Animation::_interpolate_compressed(const TransformTrack *p_track, float p_time, bool *p_ok, int *p_key_hint) const {
+
+	// same logic as the _interpolate template above, but run in the quantized
+	// 0..65535 time domain so keys only get decoded once the pair is known
+
+	const Vector<CompressedTransformKey> &keys = p_track->compressed_keys;
+	int len = keys.size(); //quantized times are clamped to the animation length, no keys past the end
+
+	if (len == 0) {
+
+		if (p_ok)
+			*p_ok = false;
+		return TransformKey();
+	} else if (len == 1) {
+
+		if (p_ok)
+			*p_ok = true;
+		return _decompress_transform_key(p_track, 0).value;
+	}
+
+	float ct = length > 0 ? p_time / length * 65535.0 : 0.0;
+
+	int idx = _find(keys, ct, p_key_hint ? *p_key_hint : -1);
+	if (p_key_hint) {
+		*p_key_hint = idx;
+	}
+
+	ERR_FAIL_COND_V(idx == -2, TransformKey());
+
+	bool result = true;
+	int next = 0;
+	float c = 0;
+	// prepare for all cases of interpolation
+
+	if (loop && p_track->loop_wrap) {
+		// loop
+		if (idx >= 0) {
+
+			if ((idx + 1) < len) {
+
+				next = idx + 1;
+				float delta = keys[next].time - keys[idx].time;
+				float from = ct - keys[idx].time;
+
+				if (Math::is_zero_approx(delta))
+					c = 0;
+				else
+					c = from / delta;
+
+			} else {
+
+				next = 0;
+				float delta = (65535.0 - keys[idx].time) + keys[next].time;
+				float from = ct - keys[idx].time;
+
+				if (Math::is_zero_approx(delta))
+					c = 0;
+				else
+					c = from / delta;
+			}
+
+		} else {
+			// on loop, behind first key
+			idx = len - 1;
+			next = 0;
+			float endtime = (65535.0 - keys[idx].time);
+			float delta = endtime + keys[next].time;
+			float from = endtime + ct;
+
+			if (Math::is_zero_approx(delta))
+				c = 0;
+			else
+				c = from / delta;
+		}
+
+	} else { // no loop
+
+		if (idx >= 0) {
+
+			if ((idx + 1) < len) {
+
+				next = idx + 1;
+				float delta = keys[next].time - keys[idx].time;
+				float from = ct - keys[idx].time;
+
+				if (Math::is_zero_approx(delta))
+					c = 0;
+				else
+					c = from / delta;
+
+			} else {
+
+				next = idx;
+			}
+
+		} else {
+
+			// only allow extending first key to anim start if looping
+			if (loop)
+				idx = next = 0;
+			else
+				result = false;
+		}
+	}
+
+	if (p_ok)
+		*p_ok = result;
+	if (!result)
+		return TransformKey();
+
+	TKey<TransformKey> a = _decompress_transform_key(p_track, idx);
+
+	if (idx == next) {
+		// don't interpolate if not needed
+		return a.value;
+	}
+
+	//per-key transitions were dropped on compression, so there is no ease step here
+
+	TKey<TransformKey> b = _decompress_transform_key(p_track, next);
+
+	switch (p_track->interpolation) {
+
+		case INTERPOLATION_NEAREST: {
+
+			return a.value;
+		} break;
+		case INTERPOLATION_LINEAR:
+		case INTERPOLATION_CUBIC: {
+
+			// cubic would need two extra key decodes for little gain on the dense
+			// imported tracks this format is meant for, treat it as linear
+			return _interpolate(a.value, b.value, c);
+		} break;
+		default: return a.value;
+	}
+}
+
+Error Animation::transform_track_interpolate(int p_track, float p_time, Vector3 *r_loc, Quat *r_rot, Vector3 *r_scale, int *r_key_hint) const {
 
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
@@ -1873,7 +2187,13 @@ Error Animation::transform_track_interpolate(int p_track, float p_time, Vector3
 
 	bool ok = false;
 
-	TransformKey tk = _interpolate(tt->transforms, p_time, tt->interpolation, tt->loop_wrap, &ok);
+	TransformKey tk;
+
+	if (tt->compressed) {
+		tk = _interpolate_compressed(tt, p_time, &ok, r_key_hint);
+	} else {
+		tk = _interpolate(tt->transforms, p_time, tt->interpolation, tt->loop_wrap, &ok, r_key_hint);
+	}
 
 	if (!ok)
 		return ERR_UNAVAILABLE;
@@ -2065,8 +2385,14 @@ void Animation::track_get_key_indices_in_range(int p_track, float p_time, float
 				case TYPE_TRANSFORM: {
 
 					const TransformTrack *tt = static_cast<const TransformTrack *>(t);
-					_track_get_key_indices_in_range(tt->transforms, from_time, length, p_indices);
-					_track_get_key_indices_in_range(tt->transforms, 0, to_time, p_indices);
+					if (tt->compressed) {
+						float cs = length > 0 ? 65535.0 / length : 0.0; //scale queries into the quantized time domain
+						_track_get_key_indices_in_range(tt->compressed_keys, from_time * cs, 65535.0, p_indices);
+						_track_get_key_indices_in_range(tt->compressed_keys, 0, to_time * cs, p_indices);
+					} else {
+						_track_get_key_indices_in_range(tt->transforms, from_time, length, p_indices);
+						_track_get_key_indices_in_range(tt->transforms, 0, to_time, p_indices);
+					}
 
 				} break;
 				case TYPE_VALUE: {
@@ -2125,7 +2451,12 @@ void Animation::track_get_key_indices_in_range(int p_track, float p_time, float
 		case TYPE_TRANSFORM: {
 
 			const TransformTrack *tt = static_cast<const TransformTrack *>(t);
-			_track_get_key_indices_in_range(tt->transforms, from_time, to_time, p_indices);
+			if (tt->compressed) {
+				float cs = length > 0 ? 65535.0 / length : 0.0; //scale queries into the quantized time domain
+				_track_get_key_indices_in_range(tt->compressed_keys, from_time * cs, to_time * cs, p_indices);
+			} else {
+				_track_get_key_indices_in_range(tt->transforms, from_time, to_time, p_indices);
+			}
 
 		} break;
 		case TYPE_VALUE: {
@@ -2780,6 +3111,7 @@ void Animation::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("track_get_interpolation_loop_wrap", "track_idx"), &Animation::track_get_interpolation_loop_wrap);
 
 	ClassDB::bind_method(D_METHOD("transform_track_interpolate", "track_idx", "time_sec"), &Animation::_transform_track_interpolate);
+	ClassDB::bind_method(D_METHOD("transform_track_is_compressed", "track_idx"), &Animation::transform_track_is_compressed);
 	ClassDB::bind_method(D_METHOD("value_track_set_update_mode", "track_idx", "mode"), &Animation::value_track_set_update_mode);
 	ClassDB::bind_method(D_METHOD("value_track_get_update_mode", "track_idx"), &Animation::value_track_get_update_mode);
 
@@ -2824,6 +3156,7 @@ void Animation::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("clear"), &Animation::clear);
 	ClassDB::bind_method(D_METHOD("copy_track", "track_idx", "to_animation"), &Animation::copy_track);
+	ClassDB::bind_method(D_METHOD("compress_transform_tracks"), &Animation::compress_transform_tracks);
 
 	ADD_PROPERTY(PropertyInfo(Variant::REAL, "length", PROPERTY_HINT_RANGE, "0.001,99999,0.001"), "set_length", "get_length");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "loop"), "set_loop", "has_loop");
@@ -3034,6 +3367,8 @@ void Animation::_transform_track_optimize(int p_idx, float p_allowed_linear_err,
 	ERR_FAIL_INDEX(p_idx, tracks.size());
 	ERR_FAIL_COND(tracks[p_idx]->type != TYPE_TRANSFORM);
 	TransformTrack *tt = static_cast<TransformTrack *>(tracks[p_idx]);
+	if (tt->compressed)
+		return; //nothing to do, compression already dropped the precision optimization relies on
 	bool prev_erased = false;
 	TKey<TransformKey> first_erased;
 
@@ -3081,6 +3416,87 @@ void Animation::optimize(float p_allowed_linear_err, float p_allowed_angular_err
 	}
 }
 
+static uint16_t _quantize_against_range(float p_value, float p_begin, float p_end) {
+
+	if (p_end - p_begin < CMP_EPSILON)
+		return 0; //constant component, decodes back to p_begin
+	return uint16_t(CLAMP((p_value - p_begin) / (p_end - p_begin), 0, 1) * 65535.0 + 0.5);
+}
+
+void Animation::compress_transform_tracks() {
+
+	if (length <= 0)
+		return; //key times are quantized against the length, nothing sane to do
+
+	for (int i = 0; i < tracks.size(); i++) {
+
+		if (tracks[i]->type != TYPE_TRANSFORM)
+			continue;
+
+		TransformTrack *tt = static_cast<TransformTrack *>(tracks[i]);
+		if (tt->compressed || tt->transforms.size() == 0)
+			continue;
+
+		// gather the per-track bounds the positions and scales are normalized against
+		Vector3 loc_begin = tt->transforms[0].value.loc;
+		Vector3 loc_end = loc_begin;
+		Vector3 scale_begin = tt->transforms[0].value.scale;
+		Vector3 scale_end = scale_begin;
+
+		for (int j = 1; j < tt->transforms.size(); j++) {
+
+			const TransformKey &tk = tt->transforms[j].value;
+			loc_begin.x = MIN(loc_begin.x, tk.loc.x);
+			loc_begin.y = MIN(loc_begin.y, tk.loc.y);
+			loc_begin.z = MIN(loc_begin.z, tk.loc.z);
+			loc_end.x = MAX(loc_end.x, tk.loc.x);
+			loc_end.y = MAX(loc_end.y, tk.loc.y);
+			loc_end.z = MAX(loc_end.z, tk.loc.z);
+			scale_begin.x = MIN(scale_begin.x, tk.scale.x);
+			scale_begin.y = MIN(scale_begin.y, tk.scale.y);
+			scale_begin.z = MIN(scale_begin.z, tk.scale.z);
+			scale_end.x = MAX(scale_end.x, tk.scale.x);
+			scale_end.y = MAX(scale_end.y, tk.scale.y);
+			scale_end.z = MAX(scale_end.z, tk.scale.z);
+		}
+
+		tt->loc_begin = loc_begin;
+		tt->loc_end = loc_end;
+		tt->scale_begin = scale_begin;
+		tt->scale_end = scale_end;
+
+		tt->compressed_keys.resize(tt->transforms.size());
+
+		for (int j = 0; j < tt->transforms.size(); j++) {
+
+			const TKey<TransformKey> &key = tt->transforms[j];
+			CompressedTransformKey &ck = tt->compressed_keys.write[j];
+
+			ck.time = uint16_t(CLAMP(key.time / length, 0, 1) * 65535.0 + 0.5);
+
+			ck.loc[0] = _quantize_against_range(key.value.loc.x, loc_begin.x, loc_end.x);
+			ck.loc[1] = _quantize_against_range(key.value.loc.y, loc_begin.y, loc_end.y);
+			ck.loc[2] = _quantize_against_range(key.value.loc.z, loc_begin.z, loc_end.z);
+
+			Quat rot = key.value.rot.normalized();
+			if (rot.w < 0)
+				rot = -rot; //q and -q are the same rotation, keep w positive so it can be reconstructed
+			ck.rot[0] = uint16_t(CLAMP(rot.x * 0.5 + 0.5, 0, 1) * 65535.0 + 0.5);
+			ck.rot[1] = uint16_t(CLAMP(rot.y * 0.5 + 0.5, 0, 1) * 65535.0 + 0.5);
+			ck.rot[2] = uint16_t(CLAMP(rot.z * 0.5 + 0.5, 0, 1) * 65535.0 + 0.5);
+
+			ck.scale[0] = _quantize_against_range(key.value.scale.x, scale_begin.x, scale_end.x);
+			ck.scale[1] = _quantize_against_range(key.value.scale.y, scale_begin.y, scale_end.y);
+			ck.scale[2] = _quantize_against_range(key.value.scale.z, scale_begin.z, scale_end.z);
+		}
+
+		_clear(tt->transforms);
+		tt->compressed = true;
+	}
+
+	emit_changed();
+}
+
 Animation::Animation() {
 
 	step = 0.1;
@@ -103,11 +103,30 @@ private:
 
 	/* TRANSFORM TRACK */
 
+	struct CompressedTransformKey {
+
+		uint16_t time; //normalized against the animation length
+		uint16_t loc[3]; //normalized against loc_begin..loc_end
+		uint16_t rot[3]; //quaternion x,y,z remapped to 0..1, w is reconstructed
+		uint16_t scale[3]; //normalized against scale_begin..scale_end
+	};
+
 	struct TransformTrack : public Track {
 
 		Vector<TKey<TransformKey> > transforms;
 
-		TransformTrack() { type = TYPE_TRANSFORM; }
+		//imported tracks may be quantized into this instead, see compress_transform_tracks()
+		bool compressed;
+		Vector3 loc_begin;
+		Vector3 loc_end;
+		Vector3 scale_begin;
+		Vector3 scale_end;
+		Vector<CompressedTransformKey> compressed_keys;
+
+		TransformTrack() {
+			type = TYPE_TRANSFORM;
+			compressed = false;
+		}
 	};
 
 	/* PROPERTY VALUE TRACK */
@@ -200,7 +219,7 @@ private:
 	int _insert(float p_time, T &p_keys, const V &p_value);
 
 	template <class K>
-	inline int _find(const Vector<K> &p_keys, float p_time) const;
+	inline int _find(const Vector<K> &p_keys, float p_time, int p_hint = -1) const;
 
 	_FORCE_INLINE_ Animation::TransformKey _interpolate(const Animation::TransformKey &p_a, const Animation::TransformKey &p_b, float p_c) const;
 
@@ -216,7 +235,10 @@ private:
 	_FORCE_INLINE_ float _cubic_interpolate(const float &p_pre_a, const float &p_a, const float &p_b, const float &p_post_b, float p_c) const;
 
 	template <class T>
-	_FORCE_INLINE_ T _interpolate(const Vector<TKey<T> > &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok) const;
+	_FORCE_INLINE_ T _interpolate(const Vector<TKey<T> > &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, int *p_key_hint = NULL) const;
+
+	_FORCE_INLINE_ TKey<TransformKey> _decompress_transform_key(const TransformTrack *p_track, int p_idx) const;
+	TransformKey _interpolate_compressed(const TransformTrack *p_track, float p_time, bool *p_ok, int *p_key_hint) const;
 
 	template <class T>
 	_FORCE_INLINE_ void _track_get_key_indices_in_range(const Vector<T> &p_array, float from_time, float to_time, List<int> *p_indices) const;
@@ -314,6 +336,7 @@ public:
 
 	int transform_track_insert_key(int p_track, float p_time, const Vector3 &p_loc, const Quat &p_rot = Quat(), const Vector3 &p_scale = Vector3());
 	Error transform_track_get_key(int p_track, int p_key, Vector3 *r_loc, Quat *r_rot, Vector3 *r_scale) const;
+	bool transform_track_is_compressed(int p_track) const;
 	void track_set_interpolation_type(int p_track, InterpolationType p_interp);
 	InterpolationType track_get_interpolation_type(int p_track) const;
 
@@ -342,7 +365,10 @@ public:
 	void track_set_interpolation_loop_wrap(int p_track, bool p_enable);
 	bool track_get_interpolation_loop_wrap(int p_track) const;
 
-	Error transform_track_interpolate(int p_track, float p_time, Vector3 *r_loc, Quat *r_rot, Vector3 *r_scale) const;
+	// r_key_hint is an optional per-caller playhead cursor: pass the value left by the
+	// previous call so sequential sampling can resume from the last key instead of
+	// binary searching the whole track. Initialize it to -1.
+	Error transform_track_interpolate(int p_track, float p_time, Vector3 *r_loc, Quat *r_rot, Vector3 *r_scale, int *r_key_hint = NULL) const;
 
 	Variant value_track_interpolate(int p_track, float p_time) const;
 	void value_track_get_key_indices(int p_track, float p_time, float p_delta, List<int> *p_indices) const;
@@ -369,6 +395,7 @@ public:
 	void clear();
 
 	void optimize(float p_allowed_linear_err = 0.05, float p_allowed_angular_err = 0.01, float p_max_optimizable_angle = Math_PI * 0.125);
+	void compress_transform_tracks(); //quantize transform keys to 16 bits per component; compressed tracks become read-only
 
 	Animation();
 	~Animation();
@@ -281,6 +281,9 @@ Size2 DynamicFontAtSize::get_char_size(CharType p_char, CharType p_next, const V
 
 	if (!valid)
 		return Size2(1, 1);
+
+	_THREAD_SAFE_METHOD_
+
 	const_cast<DynamicFontAtSize *>(this)->_update_char(p_char);
 
 	Pair<const Character *, DynamicFontAtSize *> char_pair_with_font = _find_char_with_font(p_char, p_fallbacks);
@@ -311,6 +314,8 @@ float DynamicFontAtSize::draw_char(RID p_canvas_item, const Point2 &p_pos, CharT
 	if (!valid)
 		return 0;
 
+	_THREAD_SAFE_METHOD_
+
 	const_cast<DynamicFontAtSize *>(this)->_update_char(p_char);
 
 	Pair<const Character *, DynamicFontAtSize *> char_pair_with_font = _find_char_with_font(p_char, p_fallbacks);
@@ -347,6 +352,7 @@ float DynamicFontAtSize::draw_char(RID p_canvas_item, const Point2 &p_pos, CharT
 			if (FT_HAS_COLOR(face)) {
 				modulate.r = modulate.g = modulate.b = 1.0;
 			}
+			const_cast<DynamicFontAtSize *>(font)->_upload_textures();
 			RID texture = font->textures[ch->texture_idx].texture->get_rid();
 			VisualServer::get_singleton()->canvas_item_add_texture_rect_region(p_canvas_item, Rect2(cpos, ch->rect.size), texture, ch->rect_uv, modulate, false, RID(), false);
 		}
@@ -400,7 +406,7 @@ DynamicFontAtSize::TexturePosition DynamicFontAtSize::_find_texture_pos_for_glyp
 
 		const CharTexture &ct = textures[i];
 
-		if (ct.texture->get_format() != p_image_format)
+		if (ct.format != p_image_format)
 			continue;
 
 		if (mw > ct.texture_size || mh > ct.texture_size) //too big for this texture
@@ -450,6 +456,7 @@ DynamicFontAtSize::TexturePosition DynamicFontAtSize::_find_texture_pos_for_glyp
 
 		CharTexture tex;
 		tex.texture_size = texsize;
+		tex.format = p_image_format;
 		tex.imgdata.resize(texsize * texsize * p_color_size); //grayscale alpha
 
 		{
@@ -526,18 +533,7 @@ DynamicFontAtSize::Character DynamicFontAtSize::_bitmap_to_character(FT_Bitmap b
 		}
 	}
 
-	//blit to image and texture
-	{
-
-		Ref<Image> img = memnew(Image(tex.texture_size, tex.texture_size, 0, require_format, tex.imgdata));
-
-		if (tex.texture.is_null()) {
-			tex.texture.instance();
-			tex.texture->create_from_image(img, Texture::FLAG_VIDEO_SURFACE | texture_flags);
-		} else {
-			tex.texture->set_data(img); //update
-		}
-	}
+	tex.dirty = true; //texture upload happens at draw time, on the main thread
 
 	// update height array
 
@@ -592,11 +588,11 @@ cleanup_stroker:
 
 void DynamicFontAtSize::_update_char(CharType p_char) {
 
+	_THREAD_SAFE_METHOD_
+
 	if (char_map.has(p_char))
 		return;
 
-	_THREAD_SAFE_METHOD_
-
 	Character character = Character::not_found();
 
 	FT_GlyphSlot slot = face->glyph;
@@ -637,6 +633,37 @@ void DynamicFontAtSize::_update_char(CharType p_char) {
 	char_map[p_char] = character;
 }
 
+void DynamicFontAtSize::_upload_textures() {
+
+	_THREAD_SAFE_METHOD_
+
+	for (int i = 0; i < textures.size(); i++) {
+
+		CharTexture &tex = textures.write[i];
+		if (!tex.dirty)
+			continue;
+
+		Ref<Image> img = memnew(Image(tex.texture_size, tex.texture_size, 0, tex.format, tex.imgdata));
+
+		if (tex.texture.is_null()) {
+			tex.texture.instance();
+			tex.texture->create_from_image(img, Texture::FLAG_VIDEO_SURFACE | texture_flags);
+		} else {
+			tex.texture->set_data(img); //update
+		}
+
+		tex.dirty = false;
+	}
+}
+
+void DynamicFontAtSize::preload_chars(const String &p_chars, const Vector<Ref<DynamicFontAtSize> > &p_fallbacks) {
+
+	for (int i = 0; i < p_chars.length(); i++) {
+		//rasterizes the glyph (and its fallback, if the font lacks it) as a side effect
+		get_char_size(p_chars[i], 0, p_fallbacks);
+	}
+}
+
 void DynamicFontAtSize::update_oversampling() {
 	if (oversampling == font_oversampling || !valid)
 		return;
@@ -899,6 +926,61 @@ float DynamicFont::draw_char(RID p_canvas_item, const Point2 &p_pos, CharType p_
 	return font_at_size->draw_char(p_canvas_item, p_pos, p_char, p_next, color, fallbacks, advance_only, p_outline) + spacing_char;
 }
 
+void DynamicFont::preload_chars(const String &p_chars) {
+
+	if (!data_at_size.is_valid())
+		return;
+
+	data_at_size->preload_chars(p_chars, fallback_data_at_size);
+
+	if (outline_cache_id.outline_size > 0 && outline_data_at_size.is_valid()) {
+		outline_data_at_size->preload_chars(p_chars, fallback_outline_data_at_size);
+	}
+}
+
+void DynamicFont::_preload_chars_task(void *p_userdata) {
+
+	PreloadJob *job = (PreloadJob *)p_userdata;
+
+	if (job->data_at_size.is_valid()) {
+		job->data_at_size->preload_chars(job->chars, job->fallbacks);
+	}
+	if (job->outline_data_at_size.is_valid()) {
+		job->outline_data_at_size->preload_chars(job->chars, job->outline_fallbacks);
+	}
+
+	memdelete(job);
+}
+
+void DynamicFont::preload_chars_async(const String &p_chars) {
+
+	if (!data_at_size.is_valid())
+		return;
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (!pool) {
+		preload_chars(p_chars);
+		return;
+	}
+
+	if (preload_task_pending) {
+		pool->wait_for_task_completion(preload_task);
+		preload_task_pending = false;
+	}
+
+	PreloadJob *job = memnew(PreloadJob);
+	job->data_at_size = data_at_size;
+	if (outline_cache_id.outline_size > 0) {
+		job->outline_data_at_size = outline_data_at_size;
+	}
+	job->fallbacks = fallback_data_at_size;
+	job->outline_fallbacks = fallback_outline_data_at_size;
+	job->chars = p_chars;
+
+	preload_task = pool->add_task(_preload_chars_task, job);
+	preload_task_pending = true;
+}
+
 void DynamicFont::set_fallback(int p_idx, const Ref<DynamicFontData> &p_data) {
 
 	ERR_FAIL_COND(p_data.is_null());
@@ -1011,6 +1093,9 @@ void DynamicFont::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_spacing", "type", "value"), &DynamicFont::set_spacing);
 	ClassDB::bind_method(D_METHOD("get_spacing", "type"), &DynamicFont::get_spacing);
 
+	ClassDB::bind_method(D_METHOD("preload_chars", "chars"), &DynamicFont::preload_chars);
+	ClassDB::bind_method(D_METHOD("preload_chars_async", "chars"), &DynamicFont::preload_chars_async);
+
 	ClassDB::bind_method(D_METHOD("add_fallback", "data"), &DynamicFont::add_fallback);
 	ClassDB::bind_method(D_METHOD("set_fallback", "idx", "data"), &DynamicFont::set_fallback);
 	ClassDB::bind_method(D_METHOD("get_fallback", "idx"), &DynamicFont::get_fallback);
@@ -1051,6 +1136,8 @@ DynamicFont::DynamicFont() :
 	spacing_char = 0;
 	spacing_space = 0;
 	outline_color = Color(1, 1, 1);
+	preload_task = 0;
+	preload_task_pending = false;
 	if (dynamic_font_mutex) {
 		dynamic_font_mutex->lock();
 		dynamic_fonts->add(&font_list);
@@ -1059,6 +1146,11 @@ DynamicFont::DynamicFont() :
 }
 
 DynamicFont::~DynamicFont() {
+	if (preload_task_pending) {
+		//the job holds references to the sizes; make sure it ran before they can die
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(preload_task);
+		preload_task_pending = false;
+	}
 	if (dynamic_font_mutex) {
 		dynamic_font_mutex->lock();
 		dynamic_fonts->remove(&font_list);
@@ -35,6 +35,7 @@
 #include "core/io/resource_loader.h"
 #include "core/os/mutex.h"
 #include "core/os/thread_safe.h"
+#include "core/os/worker_thread_pool.h"
 #include "core/pair.h"
 #include "scene/resources/font.h"
 
@@ -135,6 +136,14 @@ class DynamicFontAtSize : public Reference {
 		int texture_size;
 		Vector<int> offsets;
 		Ref<ImageTexture> texture;
+		Image::Format format;
+		bool dirty; //pixels were written, texture upload pending
+
+		CharTexture() {
+			texture_size = 0;
+			format = Image::FORMAT_LA8;
+			dirty = false;
+		}
 	};
 
 	Vector<CharTexture> textures;
@@ -175,6 +184,11 @@ class DynamicFontAtSize : public Reference {
 
 	_FORCE_INLINE_ void _update_char(CharType p_char);
 
+	// Glyphs are rasterized into the atlas image under the class mutex (so a
+	// worker thread can pre-warm them), while the actual texture upload is
+	// deferred to draw time on the main thread.
+	void _upload_textures();
+
 	friend class DynamicFontData;
 	Ref<DynamicFontData> font;
 	DynamicFontData::CacheID id;
@@ -197,6 +211,8 @@ public:
 	void set_texture_flags(uint32_t p_flags);
 	void update_oversampling();
 
+	void preload_chars(const String &p_chars, const Vector<Ref<DynamicFontAtSize> > &p_fallbacks);
+
 	DynamicFontAtSize();
 	~DynamicFontAtSize();
 };
@@ -235,6 +251,20 @@ private:
 
 	Color outline_color;
 
+	// Async pre-warm of glyphs, so showing new text (dialogue with uncached
+	// CJK characters, say) does not rasterize through FreeType mid-frame.
+	struct PreloadJob {
+		Ref<DynamicFontAtSize> data_at_size;
+		Ref<DynamicFontAtSize> outline_data_at_size;
+		Vector<Ref<DynamicFontAtSize> > fallbacks;
+		Vector<Ref<DynamicFontAtSize> > outline_fallbacks;
+		String chars;
+	};
+
+	WorkerThreadPool::TaskID preload_task;
+	bool preload_task_pending;
+	static void _preload_chars_task(void *p_userdata);
+
 protected:
 	void _reload_cache();
 
@@ -285,6 +315,9 @@ public:
 
 	virtual float draw_char(RID p_canvas_item, const Point2 &p_pos, CharType p_char, CharType p_next = 0, const Color &p_modulate = Color(1, 1, 1), bool p_outline = false) const;
 
+	void preload_chars(const String &p_chars);
+	void preload_chars_async(const String &p_chars);
+
 	SelfList<DynamicFont> font_list;
 
 	static Mutex *dynamic_font_mutex;
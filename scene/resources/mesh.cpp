@@ -30,6 +30,7 @@
 
 #include "mesh.h"
 
+#include "core/crypto/crypto_core.h"
 #include "core/pair.h"
 #include "scene/resources/concave_polygon_shape.h"
 #include "scene/resources/convex_polygon_shape.h"
@@ -1105,8 +1106,58 @@ struct ArrayMeshLightmapSurface {
 	uint32_t format;
 };
 
+//cache entries are laid out back to back: md5 of the unwrap inputs, atlas size, then the generated arrays
+static bool _lightmap_unwrap_cache_find(const PoolVector<uint8_t> &p_cache, const unsigned char *p_md5, Vector<float> *r_uvs, Vector<int> *r_vertices, Vector<int> *r_indices, int *r_size_x, int *r_size_y) {
+
+	int size = p_cache.size();
+	PoolVector<uint8_t>::Read r = p_cache.read();
+
+	int ofs = 0;
+	while (ofs + 16 + 4 * (int)sizeof(int32_t) <= size) {
+
+		const unsigned char *entry = &r[ofs];
+		int32_t header[4]; //size_x, size_y, vertex_count, index_count
+		copymem(header, entry + 16, sizeof(header));
+
+		int vertex_count = header[2];
+		int index_count = header[3];
+		int entry_size = 16 + 4 * sizeof(int32_t) + vertex_count * 2 * sizeof(float) + vertex_count * sizeof(int32_t) + index_count * sizeof(int32_t);
+		if (vertex_count < 0 || index_count < 0 || ofs + entry_size > size) {
+			break; //corrupted, ignore the rest
+		}
+
+		if (memcmp(entry, p_md5, 16) == 0) {
+
+			if (r_uvs) {
+				const unsigned char *data = entry + 16 + 4 * sizeof(int32_t);
+				r_uvs->resize(vertex_count * 2);
+				copymem(r_uvs->ptrw(), data, vertex_count * 2 * sizeof(float));
+				data += vertex_count * 2 * sizeof(float);
+				r_vertices->resize(vertex_count);
+				copymem(r_vertices->ptrw(), data, vertex_count * sizeof(int32_t));
+				data += vertex_count * sizeof(int32_t);
+				r_indices->resize(index_count);
+				copymem(r_indices->ptrw(), data, index_count * sizeof(int32_t));
+				*r_size_x = header[0];
+				*r_size_y = header[1];
+			}
+			return true;
+		}
+
+		ofs += entry_size;
+	}
+
+	return false;
+}
+
 Error ArrayMesh::lightmap_unwrap(const Transform &p_base_transform, float p_texel_size) {
 
+	PoolVector<uint8_t> dst_cache; //discarded
+	return lightmap_unwrap_cached(p_base_transform, p_texel_size, PoolVector<uint8_t>(), dst_cache);
+}
+
+Error ArrayMesh::lightmap_unwrap_cached(const Transform &p_base_transform, float p_texel_size, const PoolVector<uint8_t> &p_src_cache, PoolVector<uint8_t> &r_dst_cache) {
+
 	ERR_FAIL_COND_V(!array_mesh_lightmap_unwrap_callback, ERR_UNCONFIGURED);
 	ERR_FAIL_COND_V_MSG(blend_shapes.size() != 0, ERR_UNAVAILABLE, "Can't unwrap mesh with blend shapes.");
 
@@ -1188,20 +1239,72 @@ Error ArrayMesh::lightmap_unwrap(const Transform &p_base_transform, float p_texe
 		surfaces.push_back(s);
 	}
 
+	//hash everything the unwrap depends on (the transform is already baked into the vertices)
+
+	unsigned char hash[16];
+	{
+		CryptoCore::MD5Context ctx;
+		ctx.start();
+		ctx.update((const uint8_t *)&p_texel_size, sizeof(float));
+		ctx.update((const uint8_t *)vertices.ptr(), vertices.size() * sizeof(float));
+		ctx.update((const uint8_t *)normals.ptr(), normals.size() * sizeof(float));
+		ctx.update((const uint8_t *)indices.ptr(), indices.size() * sizeof(int));
+		ctx.update((const uint8_t *)face_materials.ptr(), face_materials.size() * sizeof(int));
+		ctx.finish(hash);
+	}
+
 	//unwrap
 
-	float *gen_uvs;
-	int *gen_vertices;
-	int *gen_indices;
-	int gen_vertex_count;
-	int gen_index_count;
+	Vector<float> gen_uvs;
+	Vector<int> gen_vertices;
+	Vector<int> gen_indices;
 	int size_x;
 	int size_y;
 
-	bool ok = array_mesh_lightmap_unwrap_callback(p_texel_size, vertices.ptr(), normals.ptr(), vertices.size() / 3, indices.ptr(), face_materials.ptr(), indices.size(), &gen_uvs, &gen_vertices, &gen_vertex_count, &gen_indices, &gen_index_count, &size_x, &size_y);
+	if (!_lightmap_unwrap_cache_find(p_src_cache, hash, &gen_uvs, &gen_vertices, &gen_indices, &size_x, &size_y)) {
+
+		float *result_uvs;
+		int *result_vertices;
+		int *result_indices;
+		int result_vertex_count;
+		int result_index_count;
 
-	if (!ok) {
-		return ERR_CANT_CREATE;
+		bool ok = array_mesh_lightmap_unwrap_callback(p_texel_size, vertices.ptr(), normals.ptr(), vertices.size() / 3, indices.ptr(), face_materials.ptr(), indices.size(), &result_uvs, &result_vertices, &result_vertex_count, &result_indices, &result_index_count, &size_x, &size_y);
+
+		if (!ok) {
+			return ERR_CANT_CREATE;
+		}
+
+		gen_uvs.resize(result_vertex_count * 2);
+		copymem(gen_uvs.ptrw(), result_uvs, result_vertex_count * 2 * sizeof(float));
+		gen_vertices.resize(result_vertex_count);
+		copymem(gen_vertices.ptrw(), result_vertices, result_vertex_count * sizeof(int));
+		gen_indices.resize(result_index_count);
+		copymem(gen_indices.ptrw(), result_indices, result_index_count * sizeof(int));
+
+		::free(result_uvs);
+		::free(result_vertices);
+		::free(result_indices);
+	}
+
+	//store for the next import; identical meshes share a single entry
+	if (!_lightmap_unwrap_cache_find(r_dst_cache, hash, NULL, NULL, NULL, NULL, NULL)) {
+
+		int32_t header[4] = { (int32_t)size_x, (int32_t)size_y, (int32_t)gen_vertices.size(), (int32_t)gen_indices.size() };
+
+		int ofs = r_dst_cache.size();
+		r_dst_cache.resize(ofs + 16 + sizeof(header) + gen_uvs.size() * sizeof(float) + gen_vertices.size() * sizeof(int32_t) + gen_indices.size() * sizeof(int32_t));
+		PoolVector<uint8_t>::Write w = r_dst_cache.write();
+		uint8_t *data = &w[ofs];
+		copymem(data, hash, 16);
+		data += 16;
+		copymem(data, header, sizeof(header));
+		data += sizeof(header);
+		copymem(data, gen_uvs.ptr(), gen_uvs.size() * sizeof(float));
+		data += gen_uvs.size() * sizeof(float);
+		copymem(data, gen_vertices.ptr(), gen_vertices.size() * sizeof(int32_t));
+		data += gen_vertices.size() * sizeof(int32_t);
+		copymem(data, gen_indices.ptr(), gen_indices.size() * sizeof(int32_t));
 	}
 
 	//remove surfaces
@@ -1220,9 +1323,9 @@ Error ArrayMesh::lightmap_unwrap(const Transform &p_base_transform, float p_texe
 		surfaces_tools.push_back(st); //stay there
 	}
 
-	print_verbose("Mesh: Gen indices: " + itos(gen_index_count));
+	print_verbose("Mesh: Gen indices: " + itos(gen_indices.size()));
 	//go through all indices
-	for (int i = 0; i < gen_index_count; i += 3) {
+	for (int i = 0; i < gen_indices.size(); i += 3) {
 
 		ERR_FAIL_INDEX_V(gen_vertices[gen_indices[i + 0]], uv_index.size(), ERR_BUG);
 		ERR_FAIL_INDEX_V(gen_vertices[gen_indices[i + 1]], uv_index.size(), ERR_BUG);
@@ -1265,11 +1368,6 @@ Error ArrayMesh::lightmap_unwrap(const Transform &p_base_transform, float p_texe
 		}
 	}
 
-	//free stuff
-	::free(gen_vertices);
-	::free(gen_indices);
-	::free(gen_uvs);
-
 	//generate surfaces
 
 	for (int i = 0; i < surfaces_tools.size(); i++) {
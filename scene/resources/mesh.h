@@ -231,6 +231,7 @@ public:
 	void regen_normalmaps();
 
 	Error lightmap_unwrap(const Transform &p_base_transform = Transform(), float p_texel_size = 0.05);
+	Error lightmap_unwrap_cached(const Transform &p_base_transform, float p_texel_size, const PoolVector<uint8_t> &p_src_cache, PoolVector<uint8_t> &r_dst_cache);
 
 	virtual void reload_from_file();
 
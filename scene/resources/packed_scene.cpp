@@ -129,6 +129,17 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 				} else {
 					InstancePlaceholder *ip = memnew(InstancePlaceholder);
 					ip->set_instance_path(path);
+
+					//project-wide default so placeholders instance themselves as the camera approaches
+					static float default_instance_distance = -1;
+					if (default_instance_distance < 0) {
+						default_instance_distance = GLOBAL_DEF("scene/placeholders/default_instance_distance", 0.0);
+						ProjectSettings::get_singleton()->set_custom_property_info("scene/placeholders/default_instance_distance", PropertyInfo(Variant::REAL, "scene/placeholders/default_instance_distance", PROPERTY_HINT_RANGE, "0,8192,0.1,or_greater"));
+					}
+					if (default_instance_distance > 0) {
+						ip->set_instance_distance(default_instance_distance);
+					}
+
 					node = ip;
 				}
 				node->set_scene_instance_load_placeholder(true);
@@ -33,6 +33,7 @@
 #include "core/io/resource_format_binary.h"
 #include "core/os/dir_access.h"
 #include "core/project_settings.h"
+#include "core/string_builder.h"
 #include "core/version.h"
 
 //version 2: changed names for basis, aabb, poolvectors, etc.
@@ -1465,10 +1466,10 @@ Error ResourceFormatSaverTextInstance::save(const String &p_path, const RES &p_r
 		packed_scene = p_resource;
 	}
 
-	Error err;
-	f = FileAccess::open(p_path, FileAccess::WRITE, &err);
-	ERR_FAIL_COND_V_MSG(err, ERR_CANT_OPEN, "Cannot save file '" + p_path + "'.");
-	FileAccessRef _fref(f);
+	//serialize to memory first; writing happens in one go at the end, which
+	//is much faster than thousands of small writes (mainly on network
+	//filesystems) and allows skipping the write entirely when nothing changed
+	StringBuilder sb;
 
 	local_path = ProjectSettings::get_singleton()->localize_path(p_path);
 
@@ -1514,8 +1515,8 @@ Error ResourceFormatSaverTextInstance::save(const String &p_path, const RES &p_r
 		}
 		title += "format=" + itos(FORMAT_VERSION) + "";
 
-		f->store_string(title);
-		f->store_line("]\n"); //one empty line
+		sb.append(title);
+		sb.append("]\n\n"); //one empty line
 	}
 
 #ifdef TOOLS_ENABLED
@@ -1569,11 +1570,11 @@ Error ResourceFormatSaverTextInstance::save(const String &p_path, const RES &p_r
 	for (int i = 0; i < sorted_er.size(); i++) {
 		String p = sorted_er[i].resource->get_path();
 
-		f->store_string("[ext_resource path=\"" + p + "\" type=\"" + sorted_er[i].resource->get_save_class() + "\" id=" + itos(sorted_er[i].index) + "]\n"); //bundled
+		sb.append("[ext_resource path=\"" + p + "\" type=\"" + sorted_er[i].resource->get_save_class() + "\" id=" + itos(sorted_er[i].index) + "]\n"); //bundled
 	}
 
 	if (external_resources.size())
-		f->store_line(String()); //separate
+		sb.append("\n"); //separate
 
 	Set<int> used_indices;
 
@@ -1602,7 +1603,7 @@ Error ResourceFormatSaverTextInstance::save(const String &p_path, const RES &p_r
 			break; //save as a scene
 
 		if (main) {
-			f->store_line("[resource]");
+			sb.append("[resource]\n");
 		} else {
 			String line = "[sub_resource ";
 			if (res->get_subindex() == 0) {
@@ -1617,7 +1618,7 @@ Error ResourceFormatSaverTextInstance::save(const String &p_path, const RES &p_r
 
 			int idx = res->get_subindex();
 			line += "type=\"" + res->get_class() + "\" id=" + itos(idx);
-			f->store_line(line + "]");
+			sb.append(line + "]\n");
 			if (takeover_paths) {
 				res->set_path(p_path + "::" + itos(idx), true);
 			}
@@ -1661,12 +1662,12 @@ Error ResourceFormatSaverTextInstance::save(const String &p_path, const RES &p_r
 
 				String vars;
 				VariantWriter::write_to_string(value, vars, _write_resources, this);
-				f->store_string(name.property_name_encode() + " = " + vars + "\n");
+				sb.append(name.property_name_encode() + " = " + vars + "\n");
 			}
 		}
 
 		if (E->next())
-			f->store_line(String());
+			sb.append("\n");
 	}
 
 	if (packed_scene.is_valid()) {
@@ -1708,36 +1709,36 @@ Error ResourceFormatSaverTextInstance::save(const String &p_path, const RES &p_r
 				header += sgroups;
 			}
 
-			f->store_string(header);
+			sb.append(header);
 
 			if (instance_placeholder != String()) {
 
 				String vars;
-				f->store_string(" instance_placeholder=");
+				sb.append(" instance_placeholder=");
 				VariantWriter::write_to_string(instance_placeholder, vars, _write_resources, this);
-				f->store_string(vars);
+				sb.append(vars);
 			}
 
 			if (instance.is_valid()) {
 
 				String vars;
-				f->store_string(" instance=");
+				sb.append(" instance=");
 				VariantWriter::write_to_string(instance, vars, _write_resources, this);
-				f->store_string(vars);
+				sb.append(vars);
 			}
 
-			f->store_line("]");
+			sb.append("]\n");
 
 			for (int j = 0; j < state->get_node_property_count(i); j++) {
 
 				String vars;
 				VariantWriter::write_to_string(state->get_node_property_value(i, j), vars, _write_resources, this);
 
-				f->store_string(String(state->get_node_property_name(i, j)).property_name_encode() + " = " + vars + "\n");
+				sb.append(String(state->get_node_property_name(i, j)).property_name_encode() + " = " + vars + "\n");
 			}
 
 			if (i < state->get_node_count() - 1)
-				f->store_line(String());
+				sb.append("\n");
 		}
 
 		for (int i = 0; i < state->get_connection_count(); i++) {
@@ -1753,22 +1754,37 @@ Error ResourceFormatSaverTextInstance::save(const String &p_path, const RES &p_r
 			}
 
 			Array binds = state->get_connection_binds(i);
-			f->store_string(connstr);
+			sb.append(connstr);
 			if (binds.size()) {
 				String vars;
 				VariantWriter::write_to_string(binds, vars, _write_resources, this);
-				f->store_string(" binds= " + vars);
+				sb.append(" binds= " + vars);
 			}
 
-			f->store_line("]");
+			sb.append("]\n");
 		}
 
 		Vector<NodePath> editable_instances = state->get_editable_instances();
 		for (int i = 0; i < editable_instances.size(); i++) {
-			f->store_line("\n[editable path=\"" + editable_instances[i].operator String() + "\"]");
+			sb.append("\n[editable path=\"" + editable_instances[i].operator String() + "\"]\n");
 		}
 	}
 
+	String text = sb.as_string();
+
+	if (FileAccess::exists(p_path) && FileAccess::get_md5(p_path) == text.md5_text()) {
+		//nothing changed, skip the rewrite so the modified time (and whatever
+		//watches it, like dependency reloads and reimports) stays untouched
+		return OK;
+	}
+
+	Error err;
+	f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err, ERR_CANT_OPEN, "Cannot save file '" + p_path + "'.");
+	FileAccessRef _fref(f);
+
+	f->store_string(text);
+
 	if (f->get_error() != OK && f->get_error() != ERR_FILE_EOF) {
 		f->close();
 		return ERR_CANT_CREATE;
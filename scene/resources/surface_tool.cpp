@@ -292,10 +292,9 @@ Array SurfaceTool::commit_to_arrays() {
 				array.resize(varr_len);
 				PoolVector<Vector3>::Write w = array.write();
 
-				int idx = 0;
-				for (List<Vertex>::Element *E = vertex_array.front(); E; E = E->next(), idx++) {
+				for (int idx = 0; idx < varr_len; idx++) {
 
-					const Vertex &v = E->get();
+					const Vertex &v = vertex_array[idx];
 
 					switch (i) {
 						case Mesh::ARRAY_VERTEX: {
@@ -319,10 +318,9 @@ Array SurfaceTool::commit_to_arrays() {
 				array.resize(varr_len);
 				PoolVector<Vector2>::Write w = array.write();
 
-				int idx = 0;
-				for (List<Vertex>::Element *E = vertex_array.front(); E; E = E->next(), idx++) {
+				for (int idx = 0; idx < varr_len; idx++) {
 
-					const Vertex &v = E->get();
+					const Vertex &v = vertex_array[idx];
 
 					switch (i) {
 
@@ -344,10 +342,10 @@ Array SurfaceTool::commit_to_arrays() {
 				array.resize(varr_len * 4);
 				PoolVector<float>::Write w = array.write();
 
-				int idx = 0;
-				for (List<Vertex>::Element *E = vertex_array.front(); E; E = E->next(), idx += 4) {
+				for (int j = 0; j < varr_len; j++) {
 
-					const Vertex &v = E->get();
+					const Vertex &v = vertex_array[j];
+					int idx = j * 4;
 
 					w[idx + 0] = v.tangent.x;
 					w[idx + 1] = v.tangent.y;
@@ -368,11 +366,9 @@ Array SurfaceTool::commit_to_arrays() {
 				array.resize(varr_len);
 				PoolVector<Color>::Write w = array.write();
 
-				int idx = 0;
-				for (List<Vertex>::Element *E = vertex_array.front(); E; E = E->next(), idx++) {
+				for (int idx = 0; idx < varr_len; idx++) {
 
-					const Vertex &v = E->get();
-					w[idx] = v.color;
+					w[idx] = vertex_array[idx].color;
 				}
 
 				w.release();
@@ -384,15 +380,14 @@ Array SurfaceTool::commit_to_arrays() {
 				array.resize(varr_len * 4);
 				PoolVector<int>::Write w = array.write();
 
-				int idx = 0;
-				for (List<Vertex>::Element *E = vertex_array.front(); E; E = E->next(), idx += 4) {
+				for (int j = 0; j < varr_len; j++) {
 
-					const Vertex &v = E->get();
+					const Vertex &v = vertex_array[j];
 
 					ERR_CONTINUE(v.bones.size() != 4);
 
-					for (int j = 0; j < 4; j++) {
-						w[idx + j] = v.bones[j];
+					for (int k = 0; k < 4; k++) {
+						w[j * 4 + k] = v.bones[k];
 					}
 				}
 
@@ -406,15 +401,14 @@ Array SurfaceTool::commit_to_arrays() {
 				array.resize(varr_len * 4);
 				PoolVector<float>::Write w = array.write();
 
-				int idx = 0;
-				for (List<Vertex>::Element *E = vertex_array.front(); E; E = E->next(), idx += 4) {
+				for (int j = 0; j < varr_len; j++) {
 
-					const Vertex &v = E->get();
+					const Vertex &v = vertex_array[j];
 					ERR_CONTINUE(v.weights.size() != 4);
 
-					for (int j = 0; j < 4; j++) {
+					for (int k = 0; k < 4; k++) {
 
-						w[idx + j] = v.weights[j];
+						w[j * 4 + k] = v.weights[k];
 					}
 				}
 
@@ -430,10 +424,9 @@ Array SurfaceTool::commit_to_arrays() {
 				array.resize(index_array.size());
 				PoolVector<int>::Write w = array.write();
 
-				int idx = 0;
-				for (List<int>::Element *E = index_array.front(); E; E = E->next(), idx++) {
+				for (int idx = 0; idx < index_array.size(); idx++) {
 
-					w[idx] = E->get();
+					w[idx] = index_array[idx];
 				}
 
 				w.release();
@@ -480,16 +473,17 @@ void SurfaceTool::index() {
 		return; //already indexed
 
 	HashMap<Vertex, int, VertexHasher> indices;
-	List<Vertex> new_vertices;
+	Vector<Vertex> new_vertices;
 
-	for (List<Vertex>::Element *E = vertex_array.front(); E; E = E->next()) {
+	for (int i = 0; i < vertex_array.size(); i++) {
 
-		int *idxptr = indices.getptr(E->get());
+		const Vertex &v = vertex_array[i];
+		int *idxptr = indices.getptr(v);
 		int idx;
 		if (!idxptr) {
 			idx = indices.size();
-			new_vertices.push_back(E->get());
-			indices[E->get()] = idx;
+			new_vertices.push_back(v);
+			indices[v] = idx;
 		} else {
 			idx = *idxptr;
 		}
@@ -497,7 +491,6 @@ void SurfaceTool::index() {
 		index_array.push_back(idx);
 	}
 
-	vertex_array.clear();
 	vertex_array = new_vertices;
 
 	format |= Mesh::ARRAY_FORMAT_INDEX;
@@ -507,24 +500,19 @@ void SurfaceTool::deindex() {
 
 	if (index_array.size() == 0)
 		return; //nothing to deindex
-	Vector<Vertex> varr;
-	varr.resize(vertex_array.size());
-	int idx = 0;
-	for (List<Vertex>::Element *E = vertex_array.front(); E; E = E->next()) {
-
-		varr.write[idx++] = E->get();
-	}
+	Vector<Vertex> varr = vertex_array;
 	vertex_array.clear();
-	for (List<int>::Element *E = index_array.front(); E; E = E->next()) {
+	vertex_array.resize(index_array.size());
+	for (int i = 0; i < index_array.size(); i++) {
 
-		ERR_FAIL_INDEX(E->get(), varr.size());
-		vertex_array.push_back(varr[E->get()]);
+		ERR_FAIL_INDEX(index_array[i], varr.size());
+		vertex_array.write[i] = varr[index_array[i]];
 	}
 	format &= ~Mesh::ARRAY_FORMAT_INDEX;
 	index_array.clear();
 }
 
-void SurfaceTool::_create_list(const Ref<Mesh> &p_existing, int p_surface, List<Vertex> *r_vertex, List<int> *r_index, int &lformat) {
+void SurfaceTool::_create_list(const Ref<Mesh> &p_existing, int p_surface, Vector<Vertex> *r_vertex, Vector<int> *r_index, int &lformat) {
 
 	Array arr = p_existing->surface_get_arrays(p_surface);
 	ERR_FAIL_COND(arr.size() != VS::ARRAY_MAX);
@@ -638,7 +626,7 @@ Vector<SurfaceTool::Vertex> SurfaceTool::create_vertex_array_from_triangle_array
 	return ret;
 }
 
-void SurfaceTool::_create_list_from_arrays(Array arr, List<Vertex> *r_vertex, List<int> *r_index, int &lformat) {
+void SurfaceTool::_create_list_from_arrays(Array arr, Vector<Vertex> *r_vertex, Vector<int> *r_index, int &lformat) {
 
 	PoolVector<Vector3> varr = arr[VS::ARRAY_VERTEX];
 	PoolVector<Vector3> narr = arr[VS::ARRAY_NORMAL];
@@ -797,15 +785,15 @@ void SurfaceTool::append_from(const Ref<Mesh> &p_existing, int p_surface, const
 	}
 
 	int nformat;
-	List<Vertex> nvertices;
-	List<int> nindices;
+	Vector<Vertex> nvertices;
+	Vector<int> nindices;
 	_create_list(p_existing, p_surface, &nvertices, &nindices, nformat);
 	format |= nformat;
 	int vfrom = vertex_array.size();
 
-	for (List<Vertex>::Element *E = nvertices.front(); E; E = E->next()) {
+	for (int i = 0; i < nvertices.size(); i++) {
 
-		Vertex v = E->get();
+		Vertex v = nvertices[i];
 		v.vertex = p_xform.xform(v.vertex);
 		if (nformat & VS::ARRAY_FORMAT_NORMAL) {
 			v.normal = p_xform.basis.xform(v.normal);
@@ -818,9 +806,9 @@ void SurfaceTool::append_from(const Ref<Mesh> &p_existing, int p_surface, const
 		vertex_array.push_back(v);
 	}
 
-	for (List<int>::Element *E = nindices.front(); E; E = E->next()) {
+	for (int i = 0; i < nindices.size(); i++) {
 
-		int dst_index = E->get() + vfrom;
+		int dst_index = nindices[i] + vfrom;
 		index_array.push_back(dst_index);
 	}
 	if (index_array.size() % 3) {
@@ -831,8 +819,8 @@ void SurfaceTool::append_from(const Ref<Mesh> &p_existing, int p_surface, const
 //mikktspace callbacks
 namespace {
 struct TangentGenerationContextUserData {
-	Vector<List<SurfaceTool::Vertex>::Element *> vertices;
-	Vector<List<int>::Element *> indices;
+	Vector<SurfaceTool::Vertex> *vertices;
+	Vector<int> *indices;
 };
 } // namespace
 
@@ -840,10 +828,10 @@ int SurfaceTool::mikktGetNumFaces(const SMikkTSpaceContext *pContext) {
 
 	TangentGenerationContextUserData &triangle_data = *reinterpret_cast<TangentGenerationContextUserData *>(pContext->m_pUserData);
 
-	if (triangle_data.indices.size() > 0) {
-		return triangle_data.indices.size() / 3;
+	if (triangle_data.indices->size() > 0) {
+		return triangle_data.indices->size() / 3;
 	} else {
-		return triangle_data.vertices.size() / 3;
+		return triangle_data.vertices->size() / 3;
 	}
 }
 int SurfaceTool::mikktGetNumVerticesOfFace(const SMikkTSpaceContext *pContext, const int iFace) {
@@ -854,13 +842,13 @@ void SurfaceTool::mikktGetPosition(const SMikkTSpaceContext *pContext, float fvP
 
 	TangentGenerationContextUserData &triangle_data = *reinterpret_cast<TangentGenerationContextUserData *>(pContext->m_pUserData);
 	Vector3 v;
-	if (triangle_data.indices.size() > 0) {
-		int index = triangle_data.indices[iFace * 3 + iVert]->get();
-		if (index < triangle_data.vertices.size()) {
-			v = triangle_data.vertices[index]->get().vertex;
+	if (triangle_data.indices->size() > 0) {
+		int index = (*triangle_data.indices)[iFace * 3 + iVert];
+		if (index < triangle_data.vertices->size()) {
+			v = (*triangle_data.vertices)[index].vertex;
 		}
 	} else {
-		v = triangle_data.vertices[iFace * 3 + iVert]->get().vertex;
+		v = (*triangle_data.vertices)[iFace * 3 + iVert].vertex;
 	}
 
 	fvPosOut[0] = v.x;
@@ -872,13 +860,13 @@ void SurfaceTool::mikktGetNormal(const SMikkTSpaceContext *pContext, float fvNor
 
 	TangentGenerationContextUserData &triangle_data = *reinterpret_cast<TangentGenerationContextUserData *>(pContext->m_pUserData);
 	Vector3 v;
-	if (triangle_data.indices.size() > 0) {
-		int index = triangle_data.indices[iFace * 3 + iVert]->get();
-		if (index < triangle_data.vertices.size()) {
-			v = triangle_data.vertices[index]->get().normal;
+	if (triangle_data.indices->size() > 0) {
+		int index = (*triangle_data.indices)[iFace * 3 + iVert];
+		if (index < triangle_data.vertices->size()) {
+			v = (*triangle_data.vertices)[index].normal;
 		}
 	} else {
-		v = triangle_data.vertices[iFace * 3 + iVert]->get().normal;
+		v = (*triangle_data.vertices)[iFace * 3 + iVert].normal;
 	}
 
 	fvNormOut[0] = v.x;
@@ -889,13 +877,13 @@ void SurfaceTool::mikktGetTexCoord(const SMikkTSpaceContext *pContext, float fvT
 
 	TangentGenerationContextUserData &triangle_data = *reinterpret_cast<TangentGenerationContextUserData *>(pContext->m_pUserData);
 	Vector2 v;
-	if (triangle_data.indices.size() > 0) {
-		int index = triangle_data.indices[iFace * 3 + iVert]->get();
-		if (index < triangle_data.vertices.size()) {
-			v = triangle_data.vertices[index]->get().uv;
+	if (triangle_data.indices->size() > 0) {
+		int index = (*triangle_data.indices)[iFace * 3 + iVert];
+		if (index < triangle_data.vertices->size()) {
+			v = (*triangle_data.vertices)[index].uv;
 		}
 	} else {
-		v = triangle_data.vertices[iFace * 3 + iVert]->get().uv;
+		v = (*triangle_data.vertices)[iFace * 3 + iVert].uv;
 	}
 
 	fvTexcOut[0] = v.x;
@@ -907,13 +895,13 @@ void SurfaceTool::mikktSetTSpaceDefault(const SMikkTSpaceContext *pContext, cons
 
 	TangentGenerationContextUserData &triangle_data = *reinterpret_cast<TangentGenerationContextUserData *>(pContext->m_pUserData);
 	Vertex *vtx = NULL;
-	if (triangle_data.indices.size() > 0) {
-		int index = triangle_data.indices[iFace * 3 + iVert]->get();
-		if (index < triangle_data.vertices.size()) {
-			vtx = &triangle_data.vertices[index]->get();
+	if (triangle_data.indices->size() > 0) {
+		int index = (*triangle_data.indices)[iFace * 3 + iVert];
+		if (index < triangle_data.vertices->size()) {
+			vtx = &triangle_data.vertices->write[index];
 		}
 	} else {
-		vtx = &triangle_data.vertices[iFace * 3 + iVert]->get();
+		vtx = &triangle_data.vertices->write[iFace * 3 + iVert];
 	}
 
 	if (vtx != NULL) {
@@ -940,17 +928,11 @@ void SurfaceTool::generate_tangents() {
 	msc.m_pInterface = &mkif;
 
 	TangentGenerationContextUserData triangle_data;
-	triangle_data.vertices.resize(vertex_array.size());
-	int idx = 0;
-	for (List<Vertex>::Element *E = vertex_array.front(); E; E = E->next()) {
-		triangle_data.vertices.write[idx++] = E;
-		E->get().binormal = Vector3();
-		E->get().tangent = Vector3();
-	}
-	triangle_data.indices.resize(index_array.size());
-	idx = 0;
-	for (List<int>::Element *E = index_array.front(); E; E = E->next()) {
-		triangle_data.indices.write[idx++] = E;
+	triangle_data.vertices = &vertex_array;
+	triangle_data.indices = &index_array;
+	for (int i = 0; i < vertex_array.size(); i++) {
+		vertex_array.write[i].binormal = Vector3();
+		vertex_array.write[i].tangent = Vector3();
 	}
 	msc.m_pUserData = &triangle_data;
 
@@ -975,63 +957,59 @@ void SurfaceTool::generate_normals(bool p_flip) {
 	if (smooth_groups.has(0))
 		smooth = smooth_groups[0];
 
-	List<Vertex>::Element *B = vertex_array.front();
-	for (List<Vertex>::Element *E = B; E;) {
+	int vlen = vertex_array.size();
+	ERR_FAIL_COND(vlen % 3 != 0);
+	Vertex *vtxs = vertex_array.ptrw();
 
-		List<Vertex>::Element *v[3];
-		v[0] = E;
-		v[1] = v[0]->next();
-		ERR_FAIL_COND(!v[1]);
-		v[2] = v[1]->next();
-		ERR_FAIL_COND(!v[2]);
-		E = v[2]->next();
+	int from = 0; //first vertex of the current smooth group
+	for (int i = 0; i < vlen; i += 3) {
 
 		Vector3 normal;
 		if (!p_flip)
-			normal = Plane(v[0]->get().vertex, v[1]->get().vertex, v[2]->get().vertex).normal;
+			normal = Plane(vtxs[i + 0].vertex, vtxs[i + 1].vertex, vtxs[i + 2].vertex).normal;
 		else
-			normal = Plane(v[2]->get().vertex, v[1]->get().vertex, v[0]->get().vertex).normal;
+			normal = Plane(vtxs[i + 2].vertex, vtxs[i + 1].vertex, vtxs[i + 0].vertex).normal;
 
 		if (smooth) {
 
-			for (int i = 0; i < 3; i++) {
+			for (int j = 0; j < 3; j++) {
 
-				Vector3 *lv = vertex_hash.getptr(v[i]->get());
+				Vector3 *lv = vertex_hash.getptr(vtxs[i + j]);
 				if (!lv) {
-					vertex_hash.set(v[i]->get(), normal);
+					vertex_hash.set(vtxs[i + j], normal);
 				} else {
 					(*lv) += normal;
 				}
 			}
 		} else {
 
-			for (int i = 0; i < 3; i++) {
+			for (int j = 0; j < 3; j++) {
 
-				v[i]->get().normal = normal;
+				vtxs[i + j].normal = normal;
 			}
 		}
 		count += 3;
 
-		if (smooth_groups.has(count) || !E) {
+		if (smooth_groups.has(count) || i + 3 == vlen) {
 
 			if (vertex_hash.size()) {
 
-				while (B != E) {
+				while (from < i + 3) {
 
-					Vector3 *lv = vertex_hash.getptr(B->get());
+					Vector3 *lv = vertex_hash.getptr(vtxs[from]);
 					if (lv) {
-						B->get().normal = lv->normalized();
+						vtxs[from].normal = lv->normalized();
 					}
 
-					B = B->next();
+					from++;
 				}
 
 			} else {
-				B = E;
+				from = i + 3;
 			}
 
 			vertex_hash.clear();
-			if (E) {
+			if (i + 3 < vlen) {
 				smooth = smooth_groups[count];
 			}
 		}
@@ -76,8 +76,8 @@ private:
 	int format;
 	Ref<Material> material;
 	//arrays
-	List<Vertex> vertex_array;
-	List<int> index_array;
+	Vector<Vertex> vertex_array;
+	Vector<int> index_array;
 	Map<int, bool> smooth_groups;
 
 	//memory
@@ -89,8 +89,8 @@ private:
 	Vector<float> last_weights;
 	Plane last_tangent;
 
-	void _create_list_from_arrays(Array arr, List<Vertex> *r_vertex, List<int> *r_index, int &lformat);
-	void _create_list(const Ref<Mesh> &p_existing, int p_surface, List<Vertex> *r_vertex, List<int> *r_index, int &lformat);
+	void _create_list_from_arrays(Array arr, Vector<Vertex> *r_vertex, Vector<int> *r_index, int &lformat);
+	void _create_list(const Ref<Mesh> &p_existing, int p_surface, Vector<Vertex> *r_vertex, Vector<int> *r_index, int &lformat);
 
 	//mikktspace callbacks
 	static int mikktGetNumFaces(const SMikkTSpaceContext *pContext);
@@ -130,7 +130,7 @@ public:
 
 	void clear();
 
-	List<Vertex> &get_vertex_array() { return vertex_array; }
+	Vector<Vertex> &get_vertex_array() { return vertex_array; }
 
 	void create_from_triangle_arrays(const Array &p_arrays);
 	static Vector<Vertex> create_vertex_array_from_triangle_arrays(const Array &p_arrays);
@@ -34,6 +34,7 @@
 #include "core/io/image_loader.h"
 #include "core/method_bind_ext.gen.inc"
 #include "core/os/os.h"
+#include "core/project_settings.h"
 #include "mesh.h"
 #include "scene/resources/bit_map.h"
 #include "servers/camera/camera_feed.h"
@@ -716,10 +717,18 @@ Error StreamTexture::_load_data(const String &p_path, int &tw, int &th, int &tw_
 
 Error StreamTexture::load(const String &p_path) {
 
+	//textures imported with the streaming bit set only keep mips up to this size
+	//resident, which caps VRAM use and load time for oversized texture sets
+	static int streaming_size_limit = -1;
+	if (streaming_size_limit < 0) {
+		streaming_size_limit = GLOBAL_DEF("rendering/quality/texture_streaming/max_size", 0);
+		ProjectSettings::get_singleton()->set_custom_property_info("rendering/quality/texture_streaming/max_size", PropertyInfo(Variant::INT, "rendering/quality/texture_streaming/max_size", PROPERTY_HINT_RANGE, "0,8192,1"));
+	}
+
 	int lw, lh, lwc, lhc, lflags;
 	Ref<Image> image;
 	image.instance();
-	Error err = _load_data(p_path, lw, lh, lwc, lhc, lflags, image);
+	Error err = _load_data(p_path, lw, lh, lwc, lhc, lflags, image, streaming_size_limit);
 	if (err)
 		return err;
 
@@ -31,65 +31,141 @@
 #include "world.h"
 
 #include "core/math/camera_matrix.h"
-#include "core/math/octree.h"
+#include "core/project_settings.h"
 #include "scene/3d/camera.h"
 #include "scene/3d/visibility_notifier.h"
 #include "scene/scene_string_names.h"
 
 struct SpatialIndexer {
 
-	Octree<VisibilityNotifier> octree;
+	// coarse spatial hash, notifiers are rasterized into the cells their AABB
+	// covers and cameras only test the cells their frustum touches, so there is
+	// no tree to rebalance as the streaming world adds and removes notifiers
 
-	struct NotifierData {
+	struct CellRef {
 
-		AABB aabb;
-		OctreeElementID id;
+		int ref;
+
+		_FORCE_INLINE_ int inc() {
+			ref++;
+			return ref;
+		}
+		_FORCE_INLINE_ int dec() {
+			ref--;
+			return ref;
+		}
+
+		_FORCE_INLINE_ CellRef() {
+			ref = 0;
+		}
 	};
 
-	Map<VisibilityNotifier *, NotifierData> notifiers;
-	struct CameraData {
+	struct CellKey {
 
-		Map<VisibilityNotifier *, uint64_t> notifiers;
+		union {
+			struct {
+				int16_t x;
+				int16_t y;
+				int16_t z;
+			};
+			uint64_t key;
+		};
+
+		bool operator==(const CellKey &p_key) const { return key == p_key.key; }
+		_FORCE_INLINE_ bool operator<(const CellKey &p_key) const {
+			return key < p_key.key;
+		}
+
+		CellKey() { key = 0; }
 	};
 
-	Map<Camera *, CameraData> cameras;
+	struct CellData {
+
+		Map<VisibilityNotifier *, CellRef> notifiers;
+	};
+
+	Map<CellKey, CellData> cells;
+	real_t cell_size;
+
+	Map<VisibilityNotifier *, AABB> notifiers;
+	struct CameraData {
 
-	enum {
-		VISIBILITY_CULL_MAX = 32768
+		Map<VisibilityNotifier *, uint64_t> notifiers;
 	};
 
-	Vector<VisibilityNotifier *> cull;
+	Map<Camera *, CameraData> cameras;
 
 	bool changed;
 	uint64_t pass;
 	uint64_t last_frame;
 
+	void _notifier_update_cells(VisibilityNotifier *p_notifier, const AABB &p_rect, bool p_add) {
+
+		int begin_x = Math::floor(p_rect.position.x / cell_size);
+		int begin_y = Math::floor(p_rect.position.y / cell_size);
+		int begin_z = Math::floor(p_rect.position.z / cell_size);
+		int end_x = Math::floor((p_rect.position.x + p_rect.size.x) / cell_size);
+		int end_y = Math::floor((p_rect.position.y + p_rect.size.y) / cell_size);
+		int end_z = Math::floor((p_rect.position.z + p_rect.size.z) / cell_size);
+
+		for (int x = begin_x; x <= end_x; x++) {
+			for (int y = begin_y; y <= end_y; y++) {
+				for (int z = begin_z; z <= end_z; z++) {
+
+					CellKey ck;
+					ck.x = x;
+					ck.y = y;
+					ck.z = z;
+					Map<CellKey, CellData>::Element *E = cells.find(ck);
+
+					if (p_add) {
+
+						if (!E)
+							E = cells.insert(ck, CellData());
+						E->get().notifiers[p_notifier].inc();
+					} else {
+
+						ERR_CONTINUE(!E);
+						if (E->get().notifiers[p_notifier].dec() == 0) {
+
+							E->get().notifiers.erase(p_notifier);
+							if (E->get().notifiers.empty()) {
+								cells.erase(E);
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
 	void _notifier_add(VisibilityNotifier *p_notifier, const AABB &p_rect) {
 
 		ERR_FAIL_COND(notifiers.has(p_notifier));
-		notifiers[p_notifier].aabb = p_rect;
-		notifiers[p_notifier].id = octree.create(p_notifier, p_rect);
+		notifiers[p_notifier] = p_rect;
+		_notifier_update_cells(p_notifier, p_rect, true);
 		changed = true;
 	}
 
 	void _notifier_update(VisibilityNotifier *p_notifier, const AABB &p_rect) {
 
-		Map<VisibilityNotifier *, NotifierData>::Element *E = notifiers.find(p_notifier);
+		Map<VisibilityNotifier *, AABB>::Element *E = notifiers.find(p_notifier);
 		ERR_FAIL_COND(!E);
-		if (E->get().aabb == p_rect)
+		if (E->get() == p_rect)
 			return;
 
-		E->get().aabb = p_rect;
-		octree.move(E->get().id, E->get().aabb);
+		_notifier_update_cells(p_notifier, p_rect, true);
+		_notifier_update_cells(p_notifier, E->get(), false);
+		E->get() = p_rect;
 		changed = true;
 	}
 
 	void _notifier_remove(VisibilityNotifier *p_notifier) {
 
-		Map<VisibilityNotifier *, NotifierData>::Element *E = notifiers.find(p_notifier);
+		Map<VisibilityNotifier *, AABB>::Element *E = notifiers.find(p_notifier);
 		ERR_FAIL_COND(!E);
 
-		octree.erase(E->get().id);
+		_notifier_update_cells(p_notifier, E->get(), false);
 		notifiers.erase(p_notifier);
 
 		List<Camera *> removed;
@@ -159,25 +235,45 @@ struct SpatialIndexer {
 			Camera *c = E->key();
 
 			Vector<Plane> planes = c->get_frustum();
-
-			int culled = octree.cull_convex(planes, cull.ptrw(), cull.size());
-
-			VisibilityNotifier **ptr = cull.ptrw();
+			const Plane *planesp = planes.ptr();
+			int plane_count = planes.size();
 
 			List<VisibilityNotifier *> added;
 			List<VisibilityNotifier *> removed;
 
-			for (int i = 0; i < culled; i++) {
+			Set<VisibilityNotifier *> tested;
+
+			for (Map<CellKey, CellData>::Element *F = cells.front(); F; F = F->next()) {
+
+				const CellKey &ck = F->key();
+				AABB cell_aabb(Vector3(ck.x, ck.y, ck.z) * cell_size, Vector3(cell_size, cell_size, cell_size));
+
+				if (!cell_aabb.intersects_convex_shape(planesp, plane_count))
+					continue;
+
+				for (Map<VisibilityNotifier *, CellRef>::Element *G = F->get().notifiers.front(); G; G = G->next()) {
+
+					VisibilityNotifier *n = G->key();
+					if (tested.has(n))
+						continue; //large notifiers span several cells, test once
+					tested.insert(n);
+
+					Map<VisibilityNotifier *, AABB>::Element *N = notifiers.find(n);
+					ERR_CONTINUE(!N);
+
+					if (!N->get().intersects_convex_shape(planesp, plane_count))
+						continue;
 
-				//notifiers in frustum
+					//notifier in frustum
 
-				Map<VisibilityNotifier *, uint64_t>::Element *H = E->get().notifiers.find(ptr[i]);
-				if (!H) {
+					Map<VisibilityNotifier *, uint64_t>::Element *H = E->get().notifiers.find(n);
+					if (!H) {
 
-					E->get().notifiers.insert(ptr[i], pass);
-					added.push_back(ptr[i]);
-				} else {
-					H->get() = pass;
+						E->get().notifiers.insert(n, pass);
+						added.push_back(n);
+					} else {
+						H->get() = pass;
+					}
 				}
 			}
 
@@ -206,7 +302,7 @@ struct SpatialIndexer {
 		pass = 0;
 		last_frame = 0;
 		changed = false;
-		cull.resize(VISIBILITY_CULL_MAX);
+		cell_size = GLOBAL_DEF("world/3d/visibility_cell_size", 64.0);
 	}
 };
 
@@ -54,26 +54,44 @@ void AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 
 	uint64_t mix_increment = uint64_t(((get_stream_sampling_rate() * p_rate_scale) / double(target_rate * global_rate_scale)) * double(FP_LEN));
 
-	for (int i = 0; i < p_frames; i++) {
-
-		uint32_t idx = CUBIC_INTERP_HISTORY + uint32_t(mix_offset >> FP_BITS);
-		//standard cubic interpolation (great quality/performance ratio)
-		//this used to be moved to a LUT for greater performance, but nowadays CPU speed is generally faster than memory.
-		float mu = (mix_offset & FP_MASK) / float(FP_LEN);
-		AudioFrame y0 = internal_buffer[idx - 3];
-		AudioFrame y1 = internal_buffer[idx - 2];
-		AudioFrame y2 = internal_buffer[idx - 1];
-		AudioFrame y3 = internal_buffer[idx - 0];
-
-		float mu2 = mu * mu;
-		AudioFrame a0 = y3 - y2 - y0 + y1;
-		AudioFrame a1 = y0 - y1 - a0;
-		AudioFrame a2 = y2 - y0;
-		AudioFrame a3 = y1;
-
-		p_buffer[i] = (a0 * mu * mu2 + a1 * mu2 + a2 * mu + a3);
-
-		mix_offset += mix_increment;
+	int i = 0;
+	while (i < p_frames) {
+
+		//Process the longest run of frames that stays inside the currently
+		//mixed internal buffer, so the interpolation loop below carries no
+		//refill branch and the compiler is free to vectorize it.
+		uint64_t limit = uint64_t(INTERNAL_BUFFER_LEN) << FP_BITS;
+		int todo = p_frames - i;
+		if (mix_increment > 0) {
+			uint64_t fit = (limit - mix_offset + mix_increment - 1) / mix_increment;
+			if (uint64_t(todo) > fit) {
+				todo = int(fit);
+			}
+		}
+
+		for (int j = 0; j < todo; j++) {
+
+			uint32_t idx = CUBIC_INTERP_HISTORY + uint32_t(mix_offset >> FP_BITS);
+			//standard cubic interpolation (great quality/performance ratio)
+			//this used to be moved to a LUT for greater performance, but nowadays CPU speed is generally faster than memory.
+			float mu = (mix_offset & FP_MASK) / float(FP_LEN);
+			AudioFrame y0 = internal_buffer[idx - 3];
+			AudioFrame y1 = internal_buffer[idx - 2];
+			AudioFrame y2 = internal_buffer[idx - 1];
+			AudioFrame y3 = internal_buffer[idx - 0];
+
+			float mu2 = mu * mu;
+			AudioFrame a0 = y3 - y2 - y0 + y1;
+			AudioFrame a1 = y0 - y1 - a0;
+			AudioFrame a2 = y2 - y0;
+			AudioFrame a3 = y1;
+
+			p_buffer[i + j] = (a0 * mu * mu2 + a1 * mu2 + a2 * mu + a3);
+
+			mix_offset += mix_increment;
+		}
+
+		i += todo;
 
 		while ((mix_offset >> FP_BITS) >= INTERNAL_BUFFER_LEN) {
 
@@ -104,47 +104,48 @@ void AudioEffectSpectrumAnalyzerInstance::process(const AudioFrame *p_src_frames
 		p_dst_frames[i] = p_src_frames[i];
 	}
 
-	//capture spectrum
-	while (p_frame_count) {
-		int to_fill = fft_size * 2 - temporal_fft_pos;
-		to_fill = MIN(to_fill, p_frame_count);
-
-		float *fftw = temporal_fft.ptrw();
-		for (int i = 0; i < to_fill; i++) { //left and right buffers
-			float window = -0.5 * Math::cos(2.0 * Math_PI * (double)i / (double)to_fill) + 0.5;
-			fftw[(i + temporal_fft_pos) * 2] = window * p_src_frames[i].l;
-			fftw[(i + temporal_fft_pos) * 2 + 1] = 0;
-			fftw[(i + temporal_fft_pos + fft_size * 2) * 2] = window * p_src_frames[i].r;
-			fftw[(i + temporal_fft_pos + fft_size * 2) * 2 + 1] = 0;
-		}
+	//store the raw samples; the FFT itself runs on demand when someone asks
+	//for a magnitude, so idle analyzers only pay for this copy
+	AudioFrame *cw = (AudioFrame *)capture_buffer.ptr(); //do not use write, avoid cow
+	int ring_size = capture_buffer.size();
+	for (int i = 0; i < p_frame_count; i++) {
+		cw[(capture_pos + i) % ring_size] = p_src_frames[i];
+	}
+	capture_pos += p_frame_count;
+
+	//determine time of capture
+	double remainer_sec = ((capture_pos % (fft_size * 2)) / mix_rate); //subtract remainder from mix time
+	last_fft_time = time - uint64_t(remainer_sec * 1000000.0);
+}
 
-		p_src_frames += to_fill;
-		temporal_fft_pos += to_fill;
-		p_frame_count -= to_fill;
+void AudioEffectSpectrumAnalyzerInstance::_compute_fft_block(int64_t p_block) const {
 
-		if (temporal_fft_pos == fft_size * 2) {
-			//time to do a FFT
-			smbFft(fftw, fft_size * 2, -1);
-			smbFft(fftw + fft_size * 4, fft_size * 2, -1);
-			int next = (fft_pos + 1) % fft_count;
+	int len = fft_size * 2;
+	int ring_size = capture_buffer.size();
+	const AudioFrame *cr = capture_buffer.ptr();
 
-			AudioFrame *hw = (AudioFrame *)fft_history[next].ptr(); //do not use write, avoid cow
+	float *fftw = temporal_fft.ptrw();
+	for (int i = 0; i < len; i++) { //left and right buffers
+		float window = -0.5 * Math::cos(2.0 * Math_PI * (double)i / (double)len) + 0.5;
+		const AudioFrame &f = cr[(uint64_t(p_block) * len + i) % ring_size];
+		fftw[i * 2] = window * f.l;
+		fftw[i * 2 + 1] = 0;
+		fftw[(i + len) * 2] = window * f.r;
+		fftw[(i + len) * 2 + 1] = 0;
+	}
 
-			for (int i = 0; i < fft_size; i++) {
-				//abs(vec)/fft_size normalizes each frequency
-				float window = 1.0; //-.5 * Math::cos(2. * Math_PI * (double)i / (double)fft_size) + .5;
-				hw[i].l = window * Vector2(fftw[i * 2], fftw[i * 2 + 1]).length() / float(fft_size);
-				hw[i].r = window * Vector2(fftw[fft_size * 4 + i * 2], fftw[fft_size * 4 + i * 2 + 1]).length() / float(fft_size);
-			}
+	smbFft(fftw, len, -1);
+	smbFft(fftw + len * 2, len, -1);
 
-			fft_pos = next; //swap
-			temporal_fft_pos = 0;
-		}
+	AudioFrame *hw = (AudioFrame *)fft_block.ptr(); //do not use write, avoid cow
+
+	for (int i = 0; i < fft_size; i++) {
+		//abs(vec)/fft_size normalizes each frequency
+		hw[i].l = Vector2(fftw[i * 2], fftw[i * 2 + 1]).length() / float(fft_size);
+		hw[i].r = Vector2(fftw[fft_size * 4 + i * 2], fftw[fft_size * 4 + i * 2 + 1]).length() / float(fft_size);
 	}
 
-	//determine time of capture
-	double remainer_sec = (temporal_fft_pos / mix_rate); //subtract remainder from mix time
-	last_fft_time = time - uint64_t(remainer_sec * 1000000.0);
+	fft_block_index = p_block;
 }
 
 void AudioEffectSpectrumAnalyzerInstance::_bind_methods() {
@@ -164,14 +165,24 @@ Vector2 AudioEffectSpectrumAnalyzerInstance::get_magnitude_for_frequency_range(f
 	diff -= AudioServer::get_singleton()->get_output_latency();
 	float fft_time_size = float(fft_size) / mix_rate;
 
-	int fft_index = fft_pos;
+	int64_t latest_block = int64_t(capture_pos / uint64_t(fft_size * 2)) - 1;
+	int64_t fft_index = latest_block;
 
 	while (diff > fft_time_size) {
 		diff -= fft_time_size;
 		fft_index -= 1;
-		if (fft_index < 0) {
-			fft_index = fft_count - 1;
-		}
+	}
+
+	if (latest_block - fft_index > fft_count - 1) {
+		fft_index = latest_block - (fft_count - 1); //anything older was already overwritten in the ring
+	}
+
+	if (fft_index < 0) {
+		return Vector2();
+	}
+
+	if (fft_block_index != fft_index) {
+		_compute_fft_block(fft_index);
 	}
 
 	int begin_pos = p_begin * fft_size / (mix_rate * 0.5);
@@ -183,7 +194,7 @@ Vector2 AudioEffectSpectrumAnalyzerInstance::get_magnitude_for_frequency_range(f
 	if (begin_pos > end_pos) {
 		SWAP(begin_pos, end_pos);
 	}
-	const AudioFrame *r = fft_history[fft_index].ptr();
+	const AudioFrame *r = fft_block.ptr();
 
 	if (p_mode == MAGNITUDE_AVERAGE) {
 		Vector2 avg;
@@ -217,16 +228,17 @@ Ref<AudioEffectInstance> AudioEffectSpectrumAnalyzer::instance() {
 	ins->fft_size = fft_sizes[fft_size];
 	ins->mix_rate = AudioServer::get_singleton()->get_mix_rate();
 	ins->fft_count = (buffer_length / (float(ins->fft_size) / ins->mix_rate)) + 1;
-	ins->fft_pos = 0;
 	ins->last_fft_time = 0;
-	ins->fft_history.resize(ins->fft_count);
+	ins->capture_buffer.resize((ins->fft_count + 1) * ins->fft_size * 2); //one block of slack so the reader stays clear of the write position
+	ins->capture_pos = 0;
 	ins->temporal_fft.resize(ins->fft_size * 8); //x2 stereo, x2 amount of samples for freqs, x2 for input
-	ins->temporal_fft_pos = 0;
-	for (int i = 0; i < ins->fft_count; i++) {
-		ins->fft_history.write[i].resize(ins->fft_size); //only magnitude matters
-		for (int j = 0; j < ins->fft_size; j++) {
-			ins->fft_history.write[i].write[j] = AudioFrame(0, 0);
-		}
+	ins->fft_block.resize(ins->fft_size); //only magnitude matters
+	ins->fft_block_index = -1;
+	for (int i = 0; i < ins->capture_buffer.size(); i++) {
+		ins->capture_buffer.write[i] = AudioFrame(0, 0);
+	}
+	for (int i = 0; i < ins->fft_size; i++) {
+		ins->fft_block.write[i] = AudioFrame(0, 0);
 	}
 	return ins;
 }
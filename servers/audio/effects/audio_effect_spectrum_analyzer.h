@@ -48,15 +48,18 @@ private:
 	friend class AudioEffectSpectrumAnalyzer;
 	Ref<AudioEffectSpectrumAnalyzer> base;
 
-	Vector<Vector<AudioFrame> > fft_history;
-	Vector<float> temporal_fft;
-	int temporal_fft_pos;
+	Vector<AudioFrame> capture_buffer; //ring of raw samples, the mix thread only writes here
+	uint64_t capture_pos; //total samples captured, monotonic
+	mutable Vector<float> temporal_fft;
+	mutable Vector<AudioFrame> fft_block; //magnitudes of the last block that was actually requested
+	mutable int64_t fft_block_index;
 	int fft_size;
 	int fft_count;
-	int fft_pos;
 	float mix_rate;
 	uint64_t last_fft_time;
 
+	void _compute_fft_block(int64_t p_block) const;
+
 protected:
 	static void _bind_methods();
 
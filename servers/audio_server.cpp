@@ -32,7 +32,9 @@
 #include "core/io/resource_loader.h"
 #include "core/os/file_access.h"
 #include "core/os/os.h"
+#include "core/os/worker_thread_pool.h"
 #include "core/project_settings.h"
+#include "core/tracepoints.h"
 #include "scene/resources/audio_stream_sample.h"
 #include "servers/audio/audio_driver_dummy.h"
 #include "servers/audio/effects/audio_effect_compressor.h"
@@ -293,6 +295,12 @@ void AudioServer::_driver_process(int p_frames, int32_t *p_buffer) {
 
 void AudioServer::_mix_step() {
 
+	TRACE_SCOPE("audio_mix_step");
+	MEM_DOMAIN_SCOPE(DOMAIN_AUDIO);
+
+	_flush_commands();
+	_process_audio_zones();
+
 	bool solo_mode = false;
 
 	for (int i = 0; i < buses.size(); i++) {
@@ -332,139 +340,205 @@ void AudioServer::_mix_step() {
 		}
 	}
 
+	//Compute how deep in the send chain every bus is. Buses of the same
+	//depth never feed one another (sends only target shallower buses), so
+	//their effect chains are independent and can be processed in parallel.
+	int max_level = 0;
+	mix_bus_levels.resize(buses.size());
+	mix_level_buses.resize(buses.size());
+	{
+		int *levels = mix_bus_levels.ptrw();
+		levels[0] = 0;
+		for (int i = 1; i < buses.size(); i++) {
+
+			int target = 0;
+			if (bus_map.has(buses[i]->send)) {
+				int tc = bus_map[buses[i]->send]->index_cache;
+				if (tc < i) {
+					target = tc;
+				}
+			}
+			levels[i] = levels[target] + 1;
+			if (levels[i] > max_level) {
+				max_level = levels[i];
+			}
+		}
+	}
+
 	//make callbacks for mixing the audio
 	for (Set<CallbackItem>::Element *E = callbacks.front(); E; E = E->next()) {
 
 		E->get().callback(E->get().userdata);
 	}
 
-	for (int i = buses.size() - 1; i >= 0; i--) {
-		//go bus by bus
-		Bus *bus = buses[i];
+	for (int level = max_level; level >= 0; level--) {
 
-		for (int k = 0; k < bus->channels.size(); k++) {
+		//gather the buses of this depth, deepest index first, so the send
+		//pass below keeps the original descending bus order
+		Bus **level_buses = mix_level_buses.ptrw();
+		int level_bus_count = 0;
+		for (int i = buses.size() - 1; i >= 0; i--) {
+			if (mix_bus_levels[i] == level) {
+				level_buses[level_bus_count++] = buses[i];
+			}
+		}
 
-			if (bus->channels[k].active && !bus->channels[k].used) {
-				//buffer was not used, but it's still active, so it must be cleaned
-				AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+		//process the effect chains, in parallel when there is more than one
+		WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+		if (pool && level_bus_count > 1) {
+			WorkerThreadPool::GroupID group = pool->add_group_task(_mix_bus_chain_task, this, level_bus_count);
+			pool->wait_for_group_task_completion(group); //join before touching the sends
+		} else {
+			for (int i = 0; i < level_bus_count; i++) {
+				_mix_bus_chain(level_buses[i]);
+			}
+		}
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
+		//apply volume and hand the result over to the send targets, one bus
+		//at a time; buses of the same depth may share a send target
+		for (int bi = 0; bi < level_bus_count; bi++) {
+
+			Bus *bus = level_buses[bi];
+
+			//process send
 
-					buf[j] = AudioFrame(0, 0);
+			Bus *send = NULL;
+
+			if (bus->index_cache > 0) {
+				//everything has a send save for master bus
+				if (!bus_map.has(bus->send)) {
+					send = buses[0];
+				} else {
+					send = bus_map[bus->send];
+					if (send->index_cache >= bus->index_cache) { //invalid, send to master
+						send = buses[0];
+					}
 				}
 			}
-		}
 
-		//process effects
-		if (!bus->bypass) {
-			for (int j = 0; j < bus->effects.size(); j++) {
+			for (int k = 0; k < bus->channels.size(); k++) {
 
-				if (!bus->effects[j].enabled)
+				if (!bus->channels[k].active)
 					continue;
 
-#ifdef DEBUG_ENABLED
-				uint64_t ticks = OS::get_singleton()->get_ticks_usec();
-#endif
+				AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
 
-				for (int k = 0; k < bus->channels.size(); k++) {
+				AudioFrame peak = AudioFrame(0, 0);
 
-					if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence()))
-						continue;
-					bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), temp_buffer.write[k].ptrw(), buffer_size);
+				float volume = Math::db2linear(bus->volume_db);
+
+				if (bus->zone_gain >= 0) {
+					volume *= bus->zone_gain;
 				}
 
-				//swap buffers, so internal buffer always has the right data
-				for (int k = 0; k < bus->channels.size(); k++) {
+				if (solo_mode) {
+					if (!bus->soloed) {
+						volume = 0.0;
+					}
+				} else {
+					if (bus->mute) {
+						volume = 0.0;
+					}
+				}
+
+				//apply volume and compute peak
+				for (uint32_t j = 0; j < buffer_size; j++) {
+
+					buf[j] *= volume;
 
-					if (!(buses[i]->channels[k].active || bus->channels[k].effect_instances[j]->process_silence()))
-						continue;
-					SWAP(bus->channels.write[k].buffer, temp_buffer.write[k]);
+					float l = ABS(buf[j].l);
+					if (l > peak.l) {
+						peak.l = l;
+					}
+					float r = ABS(buf[j].r);
+					if (r > peak.r) {
+						peak.r = r;
+					}
 				}
 
-#ifdef DEBUG_ENABLED
-				bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
-#endif
-			}
-		}
+				bus->channels.write[k].peak_volume = AudioFrame(Math::linear2db(peak.l + 0.0000000001), Math::linear2db(peak.r + 0.0000000001));
 
-		//process send
+				if (!bus->channels[k].used) {
+					//see if any audio is contained, because channel was not used
 
-		Bus *send = NULL;
+					if (MAX(peak.r, peak.l) > Math::db2linear(channel_disable_threshold_db)) {
+						bus->channels.write[k].last_mix_with_audio = mix_frames;
+					} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
+						bus->channels.write[k].active = false;
+						continue; //went inactive, don't mix.
+					}
+				}
 
-		if (i > 0) {
-			//everything has a send save for master bus
-			if (!bus_map.has(bus->send)) {
-				send = buses[0];
-			} else {
-				send = bus_map[bus->send];
-				if (send->index_cache >= bus->index_cache) { //invalid, send to master
-					send = buses[0];
+				if (send) {
+					//if not master bus, send
+					AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+
+					for (uint32_t j = 0; j < buffer_size; j++) {
+						target_buf[j] += buf[j];
+					}
 				}
 			}
 		}
+	}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
+	mix_frames += buffer_size;
+	to_mix = buffer_size;
+}
 
-			if (!bus->channels[k].active)
-				continue;
+void AudioServer::_mix_bus_chain(Bus *p_bus) {
 
-			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+	for (int k = 0; k < p_bus->channels.size(); k++) {
 
-			AudioFrame peak = AudioFrame(0, 0);
+		if (p_bus->channels[k].active && !p_bus->channels[k].used) {
+			//buffer was not used, but it's still active, so it must be cleaned
+			AudioFrame *buf = p_bus->channels.write[k].buffer.ptrw();
 
-			float volume = Math::db2linear(bus->volume_db);
+			for (uint32_t j = 0; j < buffer_size; j++) {
 
-			if (solo_mode) {
-				if (!bus->soloed) {
-					volume = 0.0;
-				}
-			} else {
-				if (bus->mute) {
-					volume = 0.0;
-				}
+				buf[j] = AudioFrame(0, 0);
 			}
+		}
+	}
 
-			//apply volume and compute peak
-			for (uint32_t j = 0; j < buffer_size; j++) {
+	//process effects
+	if (p_bus->bypass) {
+		return;
+	}
 
-				buf[j] *= volume;
+	for (int j = 0; j < p_bus->effects.size(); j++) {
 
-				float l = ABS(buf[j].l);
-				if (l > peak.l) {
-					peak.l = l;
-				}
-				float r = ABS(buf[j].r);
-				if (r > peak.r) {
-					peak.r = r;
-				}
-			}
+		if (!p_bus->effects[j].enabled)
+			continue;
 
-			bus->channels.write[k].peak_volume = AudioFrame(Math::linear2db(peak.l + 0.0000000001), Math::linear2db(peak.r + 0.0000000001));
+#ifdef DEBUG_ENABLED
+		uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+#endif
 
-			if (!bus->channels[k].used) {
-				//see if any audio is contained, because channel was not used
+		for (int k = 0; k < p_bus->channels.size(); k++) {
 
-				if (MAX(peak.r, peak.l) > Math::db2linear(channel_disable_threshold_db)) {
-					bus->channels.write[k].last_mix_with_audio = mix_frames;
-				} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
-					bus->channels.write[k].active = false;
-					continue; //went inactive, don't mix.
-				}
-			}
+			if (!(p_bus->channels[k].active || p_bus->channels[k].effect_instances[j]->process_silence()))
+				continue;
+			p_bus->channels.write[k].effect_instances.write[j]->process(p_bus->channels[k].buffer.ptr(), p_bus->temp_buffer.write[k].ptrw(), buffer_size);
+		}
 
-			if (send) {
-				//if not master bus, send
-				AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+		//swap buffers, so internal buffer always has the right data
+		for (int k = 0; k < p_bus->channels.size(); k++) {
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					target_buf[j] += buf[j];
-				}
-			}
+			if (!(p_bus->channels[k].active || p_bus->channels[k].effect_instances[j]->process_silence()))
+				continue;
+			SWAP(p_bus->channels.write[k].buffer, p_bus->temp_buffer.write[k]);
 		}
+
+#ifdef DEBUG_ENABLED
+		p_bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
+#endif
 	}
+}
 
-	mix_frames += buffer_size;
-	to_mix = buffer_size;
+void AudioServer::_mix_bus_chain_task(void *p_userdata, uint32_t p_index) {
+
+	AudioServer *server = (AudioServer *)p_userdata;
+	server->_mix_bus_chain(server->mix_level_buses[p_index]);
 }
 
 bool AudioServer::thread_has_channel_mix_buffer(int p_bus, int p_buffer) const {
@@ -516,6 +590,7 @@ void AudioServer::set_bus_count(int p_count) {
 	MARK_EDITED
 
 	lock();
+	_flush_commands(); //bus indices are about to change
 	int cb = buses.size();
 
 	if (p_count < buses.size()) {
@@ -560,9 +635,11 @@ void AudioServer::set_bus_count(int p_count) {
 		buses[i]->mute = false;
 		buses[i]->bypass = false;
 		buses[i]->volume_db = 0;
+		buses[i]->zone_gain = -1;
 		if (i > 0) {
 			buses[i]->send = "Master";
 		}
+		_bus_sync_gt_copies(buses[i]);
 
 		bus_map[attempt] = buses[i];
 	}
@@ -580,6 +657,7 @@ void AudioServer::remove_bus(int p_index) {
 	MARK_EDITED
 
 	lock();
+	_flush_commands(); //bus indices are about to change
 	bus_map.erase(buses[p_index]->name);
 	memdelete(buses[p_index]);
 	buses.remove(p_index);
@@ -632,6 +710,8 @@ void AudioServer::add_bus(int p_at_pos) {
 	bus->mute = false;
 	bus->bypass = false;
 	bus->volume_db = 0;
+	bus->zone_gain = -1;
+	_bus_sync_gt_copies(bus);
 
 	bus_map[attempt] = bus;
 
@@ -736,12 +816,18 @@ void AudioServer::set_bus_volume_db(int p_bus, float p_volume_db) {
 
 	MARK_EDITED
 
-	buses[p_bus]->volume_db = p_volume_db;
+	buses[p_bus]->volume_db_gt = p_volume_db;
+
+	Command c;
+	c.type = COMMAND_SET_BUS_VOLUME_DB;
+	c.bus = p_bus;
+	c.fvalue = p_volume_db;
+	_post_command(c);
 }
 float AudioServer::get_bus_volume_db(int p_bus) const {
 
 	ERR_FAIL_INDEX_V(p_bus, buses.size(), 0);
-	return buses[p_bus]->volume_db;
+	return buses[p_bus]->volume_db_gt;
 }
 
 int AudioServer::get_bus_channels(int p_bus) const {
@@ -750,19 +836,95 @@ int AudioServer::get_bus_channels(int p_bus) const {
 	return buses[p_bus]->channels.size();
 }
 
+void AudioServer::_post_command(const Command &p_command) {
+
+	if (command_write_pos - command_read_pos >= COMMAND_QUEUE_SIZE) {
+		//The mix thread is not draining (stalled or stopped driver); apply
+		//in place with the driver locked so nothing is lost.
+		lock();
+		_flush_commands();
+		_apply_command(p_command);
+		unlock();
+		return;
+	}
+
+	command_queue[command_write_pos % COMMAND_QUEUE_SIZE] = p_command;
+	atomic_increment(&command_write_pos); //full barrier, publishes the slot
+}
+
+void AudioServer::_apply_command(const Command &p_command) {
+
+	//Validate indices again; a structural edit may have happened between
+	//posting the command and applying it.
+	if (p_command.bus < 0 || p_command.bus >= buses.size())
+		return;
+
+	Bus *bus = buses[p_command.bus];
+
+	switch (p_command.type) {
+		case COMMAND_SET_BUS_VOLUME_DB: {
+			bus->volume_db = p_command.fvalue;
+		} break;
+		case COMMAND_SET_BUS_SEND: {
+			bus->send = p_command.svalue;
+		} break;
+		case COMMAND_SET_BUS_SOLO: {
+			bus->solo = p_command.bvalue;
+		} break;
+		case COMMAND_SET_BUS_MUTE: {
+			bus->mute = p_command.bvalue;
+		} break;
+		case COMMAND_SET_BUS_BYPASS_EFFECTS: {
+			bus->bypass = p_command.bvalue;
+		} break;
+		case COMMAND_SET_BUS_EFFECT_ENABLED: {
+			if (p_command.effect < 0 || p_command.effect >= bus->effects.size())
+				return;
+			bus->effects.write[p_command.effect].enabled = p_command.bvalue;
+		} break;
+	}
+}
+
+void AudioServer::_flush_commands() {
+
+	//Runs on the mix thread, or on the game thread while the driver is
+	//locked and the mix thread is therefore idle.
+	while (command_read_pos != atomic_add(&command_write_pos, (uint32_t)0)) {
+		Command &c = command_queue[command_read_pos % COMMAND_QUEUE_SIZE];
+		_apply_command(c);
+		c.svalue = StringName(); //don't keep names alive in the ring
+		atomic_increment(&command_read_pos);
+	}
+}
+
+void AudioServer::_bus_sync_gt_copies(Bus *p_bus) {
+
+	p_bus->volume_db_gt = p_bus->volume_db;
+	p_bus->send_gt = p_bus->send;
+	p_bus->solo_gt = p_bus->solo;
+	p_bus->mute_gt = p_bus->mute;
+	p_bus->bypass_gt = p_bus->bypass;
+}
+
 void AudioServer::set_bus_send(int p_bus, const StringName &p_send) {
 
 	ERR_FAIL_INDEX(p_bus, buses.size());
 
 	MARK_EDITED
 
-	buses[p_bus]->send = p_send;
+	buses[p_bus]->send_gt = p_send;
+
+	Command c;
+	c.type = COMMAND_SET_BUS_SEND;
+	c.bus = p_bus;
+	c.svalue = p_send;
+	_post_command(c);
 }
 
 StringName AudioServer::get_bus_send(int p_bus) const {
 
 	ERR_FAIL_INDEX_V(p_bus, buses.size(), StringName());
-	return buses[p_bus]->send;
+	return buses[p_bus]->send_gt;
 }
 
 void AudioServer::set_bus_solo(int p_bus, bool p_enable) {
@@ -771,14 +933,20 @@ void AudioServer::set_bus_solo(int p_bus, bool p_enable) {
 
 	MARK_EDITED
 
-	buses[p_bus]->solo = p_enable;
+	buses[p_bus]->solo_gt = p_enable;
+
+	Command c;
+	c.type = COMMAND_SET_BUS_SOLO;
+	c.bus = p_bus;
+	c.bvalue = p_enable;
+	_post_command(c);
 }
 
 bool AudioServer::is_bus_solo(int p_bus) const {
 
 	ERR_FAIL_INDEX_V(p_bus, buses.size(), false);
 
-	return buses[p_bus]->solo;
+	return buses[p_bus]->solo_gt;
 }
 
 void AudioServer::set_bus_mute(int p_bus, bool p_enable) {
@@ -787,13 +955,19 @@ void AudioServer::set_bus_mute(int p_bus, bool p_enable) {
 
 	MARK_EDITED
 
-	buses[p_bus]->mute = p_enable;
+	buses[p_bus]->mute_gt = p_enable;
+
+	Command c;
+	c.type = COMMAND_SET_BUS_MUTE;
+	c.bus = p_bus;
+	c.bvalue = p_enable;
+	_post_command(c);
 }
 bool AudioServer::is_bus_mute(int p_bus) const {
 
 	ERR_FAIL_INDEX_V(p_bus, buses.size(), false);
 
-	return buses[p_bus]->mute;
+	return buses[p_bus]->mute_gt;
 }
 
 void AudioServer::set_bus_bypass_effects(int p_bus, bool p_enable) {
@@ -802,17 +976,30 @@ void AudioServer::set_bus_bypass_effects(int p_bus, bool p_enable) {
 
 	MARK_EDITED
 
-	buses[p_bus]->bypass = p_enable;
+	buses[p_bus]->bypass_gt = p_enable;
+
+	Command c;
+	c.type = COMMAND_SET_BUS_BYPASS_EFFECTS;
+	c.bus = p_bus;
+	c.bvalue = p_enable;
+	_post_command(c);
 }
 bool AudioServer::is_bus_bypassing_effects(int p_bus) const {
 
 	ERR_FAIL_INDEX_V(p_bus, buses.size(), false);
 
-	return buses[p_bus]->bypass;
+	return buses[p_bus]->bypass_gt;
 }
 
 void AudioServer::_update_bus_effects(int p_bus) {
 
+	//size the effect scratch, bus chains may be processed in parallel so
+	//they cannot share one
+	buses.write[p_bus]->temp_buffer.resize(buses[p_bus]->channels.size());
+	for (int i = 0; i < buses[p_bus]->temp_buffer.size(); i++) {
+		buses.write[p_bus]->temp_buffer.write[i].resize(buffer_size);
+	}
+
 	for (int i = 0; i < buses[p_bus]->channels.size(); i++) {
 		buses.write[p_bus]->channels.write[i].effect_instances.resize(buses[p_bus]->effects.size());
 		for (int j = 0; j < buses[p_bus]->effects.size(); j++) {
@@ -833,6 +1020,7 @@ void AudioServer::add_bus_effect(int p_bus, const Ref<AudioEffect> &p_effect, in
 	MARK_EDITED
 
 	lock();
+	_flush_commands(); //effect indices are about to change
 
 	Bus::Effect fx;
 	fx.effect = p_effect;
@@ -860,6 +1048,7 @@ void AudioServer::remove_bus_effect(int p_bus, int p_effect) {
 	MARK_EDITED
 
 	lock();
+	_flush_commands(); //effect indices are about to change
 
 	buses[p_bus]->effects.remove(p_effect);
 	_update_bus_effects(p_bus);
@@ -900,6 +1089,7 @@ void AudioServer::swap_bus_effects(int p_bus, int p_effect, int p_by_effect) {
 	MARK_EDITED
 
 	lock();
+	_flush_commands(); //effect indices are about to change
 	SWAP(buses.write[p_bus]->effects.write[p_effect], buses.write[p_bus]->effects.write[p_by_effect]);
 	_update_bus_effects(p_bus);
 	unlock();
@@ -912,7 +1102,12 @@ void AudioServer::set_bus_effect_enabled(int p_bus, int p_effect, bool p_enabled
 
 	MARK_EDITED
 
-	buses.write[p_bus]->effects.write[p_effect].enabled = p_enabled;
+	Command c;
+	c.type = COMMAND_SET_BUS_EFFECT_ENABLED;
+	c.bus = p_bus;
+	c.effect = p_effect;
+	c.bvalue = p_enabled;
+	_post_command(c);
 }
 bool AudioServer::is_bus_effect_enabled(int p_bus, int p_effect) const {
 
@@ -953,19 +1148,189 @@ float AudioServer::get_global_rate_scale() const {
 	return global_rate_scale;
 }
 
-void AudioServer::init_channels_and_buffers() {
-	channel_count = get_channel_count();
-	temp_buffer.resize(channel_count);
+/* AUDIO ZONES */
+
+int AudioServer::_audio_zone_find(int p_id) const {
+
+	for (int i = 0; i < zones.size(); i++) {
+		if (zones[i].id == p_id)
+			return i;
+	}
+	return -1;
+}
+
+int AudioServer::audio_zone_create(const StringName &p_bus) {
+
+	lock();
+	AudioZone zone;
+	zone.id = zone_id_counter++;
+	zone.bus = p_bus;
+	zone.priority = 0;
+	zone.fade_time = 0.5;
+	zone.enabled = true;
+	zone.gain = 0;
+	zones.push_back(zone);
+	int id = zone.id;
+	unlock();
+
+	return id;
+}
+
+void AudioServer::audio_zone_remove(int p_zone) {
+
+	lock();
+	int idx = _audio_zone_find(p_zone);
+	if (idx != -1) {
+		zones.remove(idx);
+	}
+	unlock();
+}
+
+void AudioServer::audio_zone_set_bus(int p_zone, const StringName &p_bus) {
+
+	lock();
+	int idx = _audio_zone_find(p_zone);
+	if (idx != -1) {
+		zones.write[idx].bus = p_bus;
+	}
+	unlock();
+}
+
+void AudioServer::audio_zone_set_planes(int p_zone, const Vector<Plane> &p_planes) {
+
+	lock();
+	int idx = _audio_zone_find(p_zone);
+	if (idx != -1) {
+		zones.write[idx].planes = p_planes;
+	}
+	unlock();
+}
+
+void AudioServer::audio_zone_set_priority(int p_zone, int p_priority) {
+
+	lock();
+	int idx = _audio_zone_find(p_zone);
+	if (idx != -1) {
+		zones.write[idx].priority = p_priority;
+	}
+	unlock();
+}
+
+void AudioServer::audio_zone_set_fade_time(int p_zone, float p_fade_time) {
+
+	lock();
+	int idx = _audio_zone_find(p_zone);
+	if (idx != -1) {
+		zones.write[idx].fade_time = p_fade_time;
+	}
+	unlock();
+}
 
-	for (int i = 0; i < temp_buffer.size(); i++) {
-		temp_buffer.write[i].resize(buffer_size);
+void AudioServer::audio_zone_set_enabled(int p_zone, bool p_enabled) {
+
+	lock();
+	int idx = _audio_zone_find(p_zone);
+	if (idx != -1) {
+		zones.write[idx].enabled = p_enabled;
 	}
+	unlock();
+}
+
+void AudioServer::audio_zone_set_listener(const Vector3 &p_position) {
+
+	lock();
+	zone_listener_pos = p_position;
+	zone_listener_valid = true;
+	unlock();
+}
+
+void AudioServer::audio_zone_clear_listener() {
+
+	lock();
+	zone_listener_valid = false;
+	unlock();
+}
+
+int AudioServer::get_current_audio_zone() const {
+
+	return current_zone_id;
+}
+
+void AudioServer::_process_audio_zones() {
+
+	if (zones.empty())
+		return;
+
+	for (int i = 0; i < buses.size(); i++) {
+		buses[i]->zone_gain = -1;
+	}
+
+	//find the zone containing the listener; highest priority wins
+	int active = -1;
+	if (zone_listener_valid) {
+		for (int i = 0; i < zones.size(); i++) {
+
+			const AudioZone &zone = zones[i];
+			if (!zone.enabled || zone.planes.empty())
+				continue;
+
+			bool inside = true;
+			for (int j = 0; j < zone.planes.size(); j++) {
+				if (zone.planes[j].is_point_over(zone_listener_pos)) {
+					inside = false;
+					break;
+				}
+			}
+
+			if (inside && (active == -1 || zone.priority > zones[active].priority)) {
+				active = i;
+			}
+		}
+	}
+
+	current_zone_id = active == -1 ? -1 : zones[active].id;
+
+	//crossfade each zone's bus toward its target weight, one step per mix block
+	float block_time = buffer_size / get_mix_rate();
+
+	for (int i = 0; i < zones.size(); i++) {
+
+		AudioZone &zone = zones.write[i];
+		float target = (i == active) ? 1.0 : 0.0;
+
+		if (zone.fade_time > 0) {
+			float step = block_time / zone.fade_time;
+			if (zone.gain < target) {
+				zone.gain = MIN(zone.gain + step, target);
+			} else {
+				zone.gain = MAX(zone.gain - step, target);
+			}
+		} else {
+			zone.gain = target;
+		}
+
+		if (bus_map.has(zone.bus)) {
+			//several zones may share a bus; the most audible one wins
+			Bus *bus = bus_map[zone.bus];
+			bus->zone_gain = MAX(bus->zone_gain, zone.gain);
+		}
+	}
+}
+
+void AudioServer::init_channels_and_buffers() {
+	channel_count = get_channel_count();
 
 	for (int i = 0; i < buses.size(); i++) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
 		}
+		if (buses[i]->effects.size()) {
+			buses.write[i]->temp_buffer.resize(channel_count);
+			for (int j = 0; j < channel_count; j++) {
+				buses.write[i]->temp_buffer.write[j].resize(buffer_size);
+			}
+		}
 	}
 }
 
@@ -1214,6 +1579,7 @@ void AudioServer::set_bus_layout(const Ref<AudioBusLayout> &p_bus_layout) {
 	ERR_FAIL_COND(p_bus_layout.is_null() || p_bus_layout->buses.size() == 0);
 
 	lock();
+	_flush_commands(); //drop pending edits before rebuilding the layout
 	for (int i = 0; i < buses.size(); i++) {
 		memdelete(buses[i]);
 	}
@@ -1232,6 +1598,8 @@ void AudioServer::set_bus_layout(const Ref<AudioBusLayout> &p_bus_layout) {
 		bus->mute = p_bus_layout->buses[i].mute;
 		bus->bypass = p_bus_layout->buses[i].bypass;
 		bus->volume_db = p_bus_layout->buses[i].volume_db;
+		bus->zone_gain = -1;
+		_bus_sync_gt_copies(bus);
 
 		for (int j = 0; j < p_bus_layout->buses[i].effects.size(); j++) {
 
@@ -1271,11 +1639,11 @@ Ref<AudioBusLayout> AudioServer::generate_bus_layout() const {
 	for (int i = 0; i < buses.size(); i++) {
 
 		state->buses.write[i].name = buses[i]->name;
-		state->buses.write[i].send = buses[i]->send;
-		state->buses.write[i].mute = buses[i]->mute;
-		state->buses.write[i].solo = buses[i]->solo;
-		state->buses.write[i].bypass = buses[i]->bypass;
-		state->buses.write[i].volume_db = buses[i]->volume_db;
+		state->buses.write[i].send = buses[i]->send_gt;
+		state->buses.write[i].mute = buses[i]->mute_gt;
+		state->buses.write[i].solo = buses[i]->solo_gt;
+		state->buses.write[i].bypass = buses[i]->bypass_gt;
+		state->buses.write[i].volume_db = buses[i]->volume_db_gt;
 		for (int j = 0; j < buses[i]->effects.size(); j++) {
 			AudioBusLayout::Bus::Effect fx;
 			fx.effect = buses[i]->effects[j].effect;
@@ -1364,6 +1732,17 @@ void AudioServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_global_rate_scale", "scale"), &AudioServer::set_global_rate_scale);
 	ClassDB::bind_method(D_METHOD("get_global_rate_scale"), &AudioServer::get_global_rate_scale);
 
+	ClassDB::bind_method(D_METHOD("audio_zone_create", "bus"), &AudioServer::audio_zone_create);
+	ClassDB::bind_method(D_METHOD("audio_zone_remove", "zone"), &AudioServer::audio_zone_remove);
+	ClassDB::bind_method(D_METHOD("audio_zone_set_bus", "zone", "bus"), &AudioServer::audio_zone_set_bus);
+	ClassDB::bind_method(D_METHOD("audio_zone_set_planes", "zone", "planes"), &AudioServer::audio_zone_set_planes);
+	ClassDB::bind_method(D_METHOD("audio_zone_set_priority", "zone", "priority"), &AudioServer::audio_zone_set_priority);
+	ClassDB::bind_method(D_METHOD("audio_zone_set_fade_time", "zone", "fade_time"), &AudioServer::audio_zone_set_fade_time);
+	ClassDB::bind_method(D_METHOD("audio_zone_set_enabled", "zone", "enabled"), &AudioServer::audio_zone_set_enabled);
+	ClassDB::bind_method(D_METHOD("audio_zone_set_listener", "position"), &AudioServer::audio_zone_set_listener);
+	ClassDB::bind_method(D_METHOD("audio_zone_clear_listener"), &AudioServer::audio_zone_clear_listener);
+	ClassDB::bind_method(D_METHOD("get_current_audio_zone"), &AudioServer::get_current_audio_zone);
+
 	ClassDB::bind_method(D_METHOD("lock"), &AudioServer::lock);
 	ClassDB::bind_method(D_METHOD("unlock"), &AudioServer::unlock);
 
@@ -1405,6 +1784,8 @@ AudioServer::AudioServer() {
 	mix_frames = 0;
 	channel_count = 0;
 	to_mix = 0;
+	command_write_pos = 0;
+	command_read_pos = 0;
 	output_latency = 0;
 	output_latency_ticks = 0;
 #ifdef DEBUG_ENABLED
@@ -1413,6 +1794,9 @@ AudioServer::AudioServer() {
 	mix_time = 0;
 	mix_size = 0;
 	global_rate_scale = 1;
+	zone_id_counter = 1;
+	zone_listener_valid = false;
+	current_zone_id = -1;
 }
 
 AudioServer::~AudioServer() {
@@ -34,6 +34,7 @@
 #include "core/math/audio_frame.h"
 #include "core/object.h"
 #include "core/os/os.h"
+#include "core/safe_refcount.h"
 #include "core/variant.h"
 #include "servers/audio/audio_effect.h"
 
@@ -209,6 +210,7 @@ private:
 		};
 
 		Vector<Channel> channels;
+		Vector<Vector<AudioFrame> > temp_buffer; //effect scratch, one per channel, sized while the bus has effects
 
 		struct Effect {
 			Ref<AudioEffect> effect;
@@ -222,12 +224,65 @@ private:
 		float volume_db;
 		StringName send;
 		int index_cache;
+		float zone_gain; //mix thread; crossfade weight from audio zones, -1 when no zone targets this bus
+
+		//Last values set from the game thread. The fields above are owned by
+		//the mix thread and updated from the command queue at mix block
+		//boundaries; these copies keep the getters lock-free and exact.
+		float volume_db_gt;
+		StringName send_gt;
+		bool solo_gt;
+		bool mute_gt;
+		bool bypass_gt;
 	};
 
-	Vector<Vector<AudioFrame> > temp_buffer; //temp_buffer for each level
 	Vector<Bus *> buses;
 	Map<StringName, Bus *> bus_map;
 
+	//Parameter changes coming from the game thread are posted here and applied
+	//by the mix thread at mix block boundaries, so neither thread has to take
+	//the driver lock for simple bus tweaks. Single producer (game thread),
+	//single consumer (mix thread). Structural changes (bus count, effect
+	//lists, layouts) still go through lock().
+	enum CommandType {
+		COMMAND_SET_BUS_VOLUME_DB,
+		COMMAND_SET_BUS_SEND,
+		COMMAND_SET_BUS_SOLO,
+		COMMAND_SET_BUS_MUTE,
+		COMMAND_SET_BUS_BYPASS_EFFECTS,
+		COMMAND_SET_BUS_EFFECT_ENABLED,
+	};
+
+	struct Command {
+		CommandType type;
+		int bus;
+		int effect;
+		float fvalue;
+		bool bvalue;
+		StringName svalue;
+
+		Command() {
+			type = COMMAND_SET_BUS_VOLUME_DB;
+			bus = 0;
+			effect = 0;
+			fvalue = 0;
+			bvalue = false;
+		}
+	};
+
+	enum {
+		COMMAND_QUEUE_SIZE = 256 //must be a power of 2, the positions run free
+	};
+
+	Command command_queue[COMMAND_QUEUE_SIZE];
+	volatile uint32_t command_write_pos;
+	volatile uint32_t command_read_pos;
+
+	void _post_command(const Command &p_command);
+	void _apply_command(const Command &p_command);
+	void _flush_commands();
+	void _bus_sync_gt_copies(Bus *p_bus);
+
 	void _update_bus_effects(int p_bus);
 
 	static AudioServer *singleton;
@@ -247,6 +302,37 @@ private:
 
 	void _mix_step();
 
+	//scratch used by _mix_step() to schedule bus chains (mix thread only)
+	Vector<int> mix_bus_levels;
+	Vector<Bus *> mix_level_buses;
+
+	void _mix_bus_chain(Bus *p_bus);
+	static void _mix_bus_chain_task(void *p_userdata, uint32_t p_index);
+
+	//Acoustic zones: convex volumes that crossfade their target bus in and
+	//out as the listener enters and leaves them. The list is edited from the
+	//game thread under lock() and evaluated once per mix block on the audio
+	//thread; a linear scan is used, the expected zone counts do not justify
+	//an acceleration structure.
+	struct AudioZone {
+		int id;
+		Vector<Plane> planes; //convex volume, plane normals point outwards
+		StringName bus;
+		int priority;
+		float fade_time;
+		bool enabled;
+		float gain; //mix thread, current crossfade weight
+	};
+
+	Vector<AudioZone> zones;
+	int zone_id_counter;
+	Vector3 zone_listener_pos;
+	bool zone_listener_valid;
+	volatile int current_zone_id;
+
+	int _audio_zone_find(int p_id) const;
+	void _process_audio_zones();
+
 	struct CallbackItem {
 
 		AudioCallback callback;
@@ -332,6 +418,19 @@ public:
 	void set_global_rate_scale(float p_scale);
 	float get_global_rate_scale() const;
 
+	/* AUDIO ZONES */
+
+	int audio_zone_create(const StringName &p_bus);
+	void audio_zone_remove(int p_zone);
+	void audio_zone_set_bus(int p_zone, const StringName &p_bus);
+	void audio_zone_set_planes(int p_zone, const Vector<Plane> &p_planes);
+	void audio_zone_set_priority(int p_zone, int p_priority);
+	void audio_zone_set_fade_time(int p_zone, float p_fade_time);
+	void audio_zone_set_enabled(int p_zone, bool p_enabled);
+	void audio_zone_set_listener(const Vector3 &p_position);
+	void audio_zone_clear_listener();
+	int get_current_audio_zone() const;
+
 	virtual void init();
 	virtual void finish();
 	virtual void update();
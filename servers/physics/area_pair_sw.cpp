@@ -37,8 +37,16 @@ bool AreaPairSW::setup(real_t p_step) {
 
 	if (area->is_shape_set_as_disabled(area_shape) || body->is_shape_set_as_disabled(body_shape)) {
 		result = false;
-	} else if (area->test_collision_mask(body) && CollisionSolverSW::solve_static(body->get_shape(body_shape), body->get_transform() * body->get_shape_transform(body_shape), area->get_shape(area_shape), area->get_transform() * area->get_shape_transform(area_shape), NULL, this)) {
-		result = true;
+	} else if (!area->test_collision_mask(body)) {
+		result = false;
+	} else if (area->get_broadphase_self_version() == area_version && body->get_broadphase_self_version() == body_version) {
+		//neither object moved since the last evaluation
+		result = overlap;
+	} else {
+		result = CollisionSolverSW::solve_static(body->get_shape(body_shape), body->get_transform() * body->get_shape_transform(body_shape), area->get_shape(area_shape), area->get_transform() * area->get_shape_transform(area_shape), NULL, this);
+		area_version = area->get_broadphase_self_version();
+		body_version = body->get_broadphase_self_version();
+		overlap = result;
 	}
 
 	if (result != colliding) {
@@ -74,6 +82,9 @@ AreaPairSW::AreaPairSW(BodySW *p_body, int p_body_shape, AreaSW *p_area, int p_a
 	body_shape = p_body_shape;
 	area_shape = p_area_shape;
 	colliding = false;
+	overlap = false;
+	body_version = (uint64_t)-1; //force the first evaluation
+	area_version = (uint64_t)-1;
 	body->add_constraint(this, 0);
 	area->add_constraint(this);
 	if (p_body->get_mode() == PhysicsServer::BODY_MODE_KINEMATIC)
@@ -100,8 +111,16 @@ bool Area2PairSW::setup(real_t p_step) {
 	bool result = false;
 	if (area_a->is_shape_set_as_disabled(shape_a) || area_b->is_shape_set_as_disabled(shape_b)) {
 		result = false;
-	} else if (area_a->test_collision_mask(area_b) && CollisionSolverSW::solve_static(area_a->get_shape(shape_a), area_a->get_transform() * area_a->get_shape_transform(shape_a), area_b->get_shape(shape_b), area_b->get_transform() * area_b->get_shape_transform(shape_b), NULL, this)) {
-		result = true;
+	} else if (!area_a->test_collision_mask(area_b)) {
+		result = false;
+	} else if (area_a->get_broadphase_self_version() == a_version && area_b->get_broadphase_self_version() == b_version) {
+		//neither area moved since the last evaluation
+		result = overlap;
+	} else {
+		result = CollisionSolverSW::solve_static(area_a->get_shape(shape_a), area_a->get_transform() * area_a->get_shape_transform(shape_a), area_b->get_shape(shape_b), area_b->get_transform() * area_b->get_shape_transform(shape_b), NULL, this);
+		a_version = area_a->get_broadphase_self_version();
+		b_version = area_b->get_broadphase_self_version();
+		overlap = result;
 	}
 
 	if (result != colliding) {
@@ -139,6 +158,9 @@ Area2PairSW::Area2PairSW(AreaSW *p_area_a, int p_shape_a, AreaSW *p_area_b, int
 	shape_a = p_shape_a;
 	shape_b = p_shape_b;
 	colliding = false;
+	overlap = false;
+	a_version = (uint64_t)-1; //force the first evaluation
+	b_version = (uint64_t)-1;
 	area_a->add_constraint(this);
 	area_b->add_constraint(this);
 }
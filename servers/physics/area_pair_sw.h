@@ -42,6 +42,11 @@ class AreaPairSW : public ConstraintSW {
 	int body_shape;
 	int area_shape;
 	bool colliding;
+	// Last narrowphase result and the broadphase self versions it was
+	// computed at; while neither object moved, the result is reused.
+	bool overlap;
+	uint64_t body_version;
+	uint64_t area_version;
 
 public:
 	bool setup(real_t p_step);
@@ -58,6 +63,9 @@ class Area2PairSW : public ConstraintSW {
 	int shape_a;
 	int shape_b;
 	bool colliding;
+	bool overlap;
+	uint64_t a_version;
+	uint64_t b_version;
 
 public:
 	bool setup(real_t p_step);
@@ -79,25 +79,44 @@ void BodyPairSW::contact_added_callback(const Vector3 &p_point_A, const Vector3
 	contact.local_B = local_B;
 	contact.normal = (p_point_A - p_point_B).normalized();
 	contact.mass_normal = 0; // will be computed in setup()
+	contact.recycled = false;
 
 	// attempt to determine if the contact will be reused
+	// the pair of body-local anchors identifies the contact feature, so pick
+	// the best match one-to-one instead of the first within range; otherwise
+	// clustered points (e.g. crate corners) steal each other's accumulated
+	// impulses and warm-starting degrades into restarting
 	real_t contact_recycle_radius = space->get_contact_recycle_radius();
+	real_t recycle_radius_2 = contact_recycle_radius * contact_recycle_radius;
 
+	real_t best_distance = 1e20;
 	for (int i = 0; i < contact_count; i++) {
 
 		Contact &c = contacts[i];
-		if (c.local_A.distance_squared_to(local_A) < (contact_recycle_radius * contact_recycle_radius) &&
-				c.local_B.distance_squared_to(local_B) < (contact_recycle_radius * contact_recycle_radius)) {
+		if (c.recycled)
+			continue; //already claimed by another point this step
 
-			contact.acc_normal_impulse = c.acc_normal_impulse;
-			contact.acc_bias_impulse = c.acc_bias_impulse;
-			contact.acc_bias_impulse_center_of_mass = c.acc_bias_impulse_center_of_mass;
-			contact.acc_tangent_impulse = c.acc_tangent_impulse;
+		real_t da = c.local_A.distance_squared_to(local_A);
+		real_t db = c.local_B.distance_squared_to(local_B);
+		if (da >= recycle_radius_2 || db >= recycle_radius_2)
+			continue;
+
+		if (da + db < best_distance) {
+			best_distance = da + db;
 			new_index = i;
-			break;
 		}
 	}
 
+	if (new_index < contact_count) {
+
+		Contact &c = contacts[new_index];
+		contact.acc_normal_impulse = c.acc_normal_impulse;
+		contact.acc_bias_impulse = c.acc_bias_impulse;
+		contact.acc_bias_impulse_center_of_mass = c.acc_bias_impulse_center_of_mass;
+		contact.acc_tangent_impulse = c.acc_tangent_impulse;
+		contact.recycled = true;
+	}
+
 	// figure out if the contact amount must be reduced to fit the new contact
 
 	if (new_index == MAX_CONTACTS) {
@@ -149,6 +168,7 @@ void BodyPairSW::validate_contacts() {
 	for (int i = 0; i < contact_count; i++) {
 
 		Contact &c = contacts[i];
+		c.recycled = false; //new narrowphase pass starts, every contact is up for matching again
 
 		Vector3 global_A = A->get_transform().basis.xform(c.local_A);
 		Vector3 global_B = B->get_transform().basis.xform(c.local_B) + offset_B;
@@ -67,6 +67,7 @@ class BodyPairSW : public ConstraintSW {
 
 		real_t depth;
 		bool active;
+		bool recycled; // received a matching point from the narrowphase this step
 		Vector3 rA, rB; // Offset in world orientation with respect to center of mass
 	};
 
@@ -142,6 +142,25 @@ class BodySW : public CollisionObjectSW {
 	BodySW *island_next;
 	BodySW *island_list_next;
 
+public:
+	// Cached broadphase cull reused by SpaceSW::test_body_motion while the
+	// surroundings didn't change; see SpaceSW::_cull_aabb_for_body_cached.
+	struct MotionQueryCache {
+		AABB aabb;
+		uint64_t version;
+		int amount; //-1 if invalid
+		Vector<CollisionObjectSW *> results;
+		Vector<int> subindices;
+
+		MotionQueryCache() {
+			version = 0;
+			amount = -1;
+		}
+	};
+
+private:
+	MotionQueryCache motion_query_cache;
+
 	_FORCE_INLINE_ void _compute_area_gravity_and_dampenings(const AreaSW *p_area);
 
 	_FORCE_INLINE_ void _update_transform_dependant();
@@ -154,6 +173,8 @@ public:
 	void set_kinematic_margin(real_t p_margin);
 	_FORCE_INLINE_ real_t get_kinematic_margin() { return kinematic_safe_margin; }
 
+	_FORCE_INLINE_ MotionQueryCache &get_motion_query_cache() { return motion_query_cache; }
+
 	_FORCE_INLINE_ void add_area(AreaSW *p_area) {
 		int index = areas.find(AreaCMP(p_area));
 		if (index > -1) {
@@ -217,23 +238,35 @@ public:
 	_FORCE_INLINE_ const Vector3 &get_biased_linear_velocity() const { return biased_linear_velocity; }
 	_FORCE_INLINE_ const Vector3 &get_biased_angular_velocity() const { return biased_angular_velocity; }
 
+	//impulses are no-ops on static/kinematic bodies (zero inverse mass and
+	//inertia); the early return also keeps constraints from other islands
+	//from touching shared static bodies when islands solve on threads
+
 	_FORCE_INLINE_ void apply_central_impulse(const Vector3 &p_j) {
+		if (mode == PhysicsServer::BODY_MODE_STATIC || mode == PhysicsServer::BODY_MODE_KINEMATIC)
+			return;
 		linear_velocity += p_j * _inv_mass;
 	}
 
 	_FORCE_INLINE_ void apply_impulse(const Vector3 &p_pos, const Vector3 &p_j) {
 
+		if (mode == PhysicsServer::BODY_MODE_STATIC || mode == PhysicsServer::BODY_MODE_KINEMATIC)
+			return;
 		linear_velocity += p_j * _inv_mass;
 		angular_velocity += _inv_inertia_tensor.xform((p_pos - center_of_mass).cross(p_j));
 	}
 
 	_FORCE_INLINE_ void apply_torque_impulse(const Vector3 &p_j) {
 
+		if (mode == PhysicsServer::BODY_MODE_STATIC || mode == PhysicsServer::BODY_MODE_KINEMATIC)
+			return;
 		angular_velocity += _inv_inertia_tensor.xform(p_j);
 	}
 
 	_FORCE_INLINE_ void apply_bias_impulse(const Vector3 &p_pos, const Vector3 &p_j, real_t p_max_delta_av = -1.0) {
 
+		if (mode == PhysicsServer::BODY_MODE_STATIC || mode == PhysicsServer::BODY_MODE_KINEMATIC)
+			return;
 		biased_linear_velocity += p_j * _inv_mass;
 		if (p_max_delta_av != 0.0) {
 			Vector3 delta_av = _inv_inertia_tensor.xform((p_pos - center_of_mass).cross(p_j));
@@ -246,6 +279,8 @@ public:
 
 	_FORCE_INLINE_ void apply_bias_torque_impulse(const Vector3 &p_j) {
 
+		if (mode == PhysicsServer::BODY_MODE_STATIC || mode == PhysicsServer::BODY_MODE_KINEMATIC)
+			return;
 		biased_angular_velocity += _inv_inertia_tensor.xform(p_j);
 	}
 
@@ -0,0 +1,322 @@
+/*************************************************************************/
+/*  broad_phase_bvh.cpp                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "broad_phase_bvh.h"
+
+#include "core/project_settings.h"
+
+BroadPhaseSW::ID BroadPhaseBVH::create(CollisionObjectSW *p_object, int p_subindex) {
+
+	ERR_FAIL_COND_V(p_object == NULL, 0);
+
+	current++;
+
+	Element e;
+	e.id = current;
+	e.owner = p_object;
+	e._static = false;
+	e.subindex = p_subindex;
+	e.bvh_id = 0;
+	e.pass = 0;
+
+	element_map[current] = e;
+	return current;
+}
+
+void BroadPhaseBVH::move(ID p_id, const AABB &p_aabb) {
+
+	Map<ID, Element>::Element *E = element_map.find(p_id);
+	ERR_FAIL_COND(!E);
+
+	Element &e = E->get();
+	e.aabb = p_aabb;
+
+	bool requery;
+	if (e.bvh_id == 0) {
+		e.bvh_id = bvh.insert(p_aabb, &e);
+		requery = true;
+	} else {
+		//while the object stays inside its fattened leaf volume the tree is
+		//untouched and no pairs can change, so coherent motion pays nothing
+		requery = bvh.update(e.bvh_id, p_aabb);
+	}
+
+	if (requery && e.pass != pass + 1) {
+		e.pass = pass + 1; // dedup within this frame
+		moved_list.push_back(&e);
+	}
+}
+
+void BroadPhaseBVH::set_static(ID p_id, bool p_static) {
+
+	Map<ID, Element>::Element *E = element_map.find(p_id);
+	ERR_FAIL_COND(!E);
+	E->get()._static = p_static;
+}
+
+void BroadPhaseBVH::_unpair_all(Element *p_elem) {
+
+	//unpair must be done immediately on removal to avoid potential invalid pointers
+	List<PairKey> to_erase;
+	for (Map<PairKey, void *>::Element *F = pair_map.front(); F; F = F->next()) {
+
+		if (F->key().a == p_elem->id || F->key().b == p_elem->id) {
+
+			if (unpair_callback) {
+				Element *elem_A = &element_map[F->key().a];
+				Element *elem_B = &element_map[F->key().b];
+				unpair_callback(elem_A->owner, elem_A->subindex, elem_B->owner, elem_B->subindex, F->get(), unpair_userdata);
+			}
+			to_erase.push_back(F->key());
+		}
+	}
+	while (to_erase.size()) {
+
+		pair_map.erase(to_erase.front()->get());
+		to_erase.pop_front();
+	}
+}
+
+void BroadPhaseBVH::remove(ID p_id) {
+
+	Map<ID, Element>::Element *E = element_map.find(p_id);
+	ERR_FAIL_COND(!E);
+
+	Element &e = E->get();
+	_unpair_all(&e);
+	moved_list.erase(&e);
+
+	if (e.bvh_id != 0) {
+		bvh.remove(e.bvh_id);
+	}
+	element_map.erase(E);
+}
+
+CollisionObjectSW *BroadPhaseBVH::get_object(ID p_id) const {
+
+	const Map<ID, Element>::Element *E = element_map.find(p_id);
+	ERR_FAIL_COND_V(!E, NULL);
+	return E->get().owner;
+}
+
+bool BroadPhaseBVH::is_static(ID p_id) const {
+
+	const Map<ID, Element>::Element *E = element_map.find(p_id);
+	ERR_FAIL_COND_V(!E, false);
+	return E->get()._static;
+}
+
+int BroadPhaseBVH::get_subindex(ID p_id) const {
+
+	const Map<ID, Element>::Element *E = element_map.find(p_id);
+	ERR_FAIL_COND_V(!E, -1);
+	return E->get().subindex;
+}
+
+struct BroadPhaseBVHCullResult {
+
+	CollisionObjectSW **results;
+	int *result_indices;
+	int max_results;
+	int count;
+
+	bool operator()(void *p_userdata) {
+
+		BroadPhaseBVH::Element *elem = (BroadPhaseBVH::Element *)p_userdata;
+		results[count] = elem->owner;
+		if (result_indices) {
+			result_indices[count] = elem->subindex;
+		}
+		count++;
+		return count >= max_results; // abort when full
+	}
+};
+
+int BroadPhaseBVH::cull_point(const Vector3 &p_point, CollisionObjectSW **p_results, int p_max_results, int *p_result_indices) {
+
+	if (p_max_results <= 0)
+		return 0;
+
+	BroadPhaseBVHCullResult result;
+	result.results = p_results;
+	result.result_indices = p_result_indices;
+	result.max_results = p_max_results;
+	result.count = 0;
+
+	bvh.point_query(p_point, result);
+	return result.count;
+}
+
+int BroadPhaseBVH::cull_segment(const Vector3 &p_from, const Vector3 &p_to, CollisionObjectSW **p_results, int p_max_results, int *p_result_indices) {
+
+	if (p_max_results <= 0)
+		return 0;
+
+	BroadPhaseBVHCullResult result;
+	result.results = p_results;
+	result.result_indices = p_result_indices;
+	result.max_results = p_max_results;
+	result.count = 0;
+
+	bvh.segment_query(p_from, p_to, result);
+	return result.count;
+}
+
+int BroadPhaseBVH::cull_aabb(const AABB &p_aabb, CollisionObjectSW **p_results, int p_max_results, int *p_result_indices) {
+
+	if (p_max_results <= 0)
+		return 0;
+
+	BroadPhaseBVHCullResult result;
+	result.results = p_results;
+	result.result_indices = p_result_indices;
+	result.max_results = p_max_results;
+	result.count = 0;
+
+	bvh.aabb_query(p_aabb, result);
+	return result.count;
+}
+
+void BroadPhaseBVH::set_pair_callback(PairCallback p_pair_callback, void *p_userdata) {
+
+	pair_userdata = p_userdata;
+	pair_callback = p_pair_callback;
+}
+
+void BroadPhaseBVH::set_unpair_callback(UnpairCallback p_unpair_callback, void *p_userdata) {
+
+	unpair_userdata = p_userdata;
+	unpair_callback = p_unpair_callback;
+}
+
+struct BroadPhaseBVHPairResult {
+
+	BroadPhaseBVH::Element *self;
+	BroadPhaseBVH::Element *candidates[1024];
+	int count;
+
+	bool operator()(void *p_userdata) {
+
+		BroadPhaseBVH::Element *elem = (BroadPhaseBVH::Element *)p_userdata;
+		if (elem == self)
+			return false;
+		if (count == 1024)
+			return true;
+		candidates[count++] = elem;
+		return false;
+	}
+};
+
+void BroadPhaseBVH::update() {
+
+	pass++;
+
+	if (moved_list.empty())
+		return; //leaf volumes are unchanged, pairs cannot have changed either
+
+	// drop pairs whose fattened leaf volumes stopped overlapping; leaf volumes
+	// only change on reinsertion, so this can't happen unless something moved
+	{
+		List<PairKey> to_erase;
+		for (Map<PairKey, void *>::Element *F = pair_map.front(); F; F = F->next()) {
+
+			Element *elem_A = &element_map[F->key().a];
+			Element *elem_B = &element_map[F->key().b];
+
+			if (bvh.get_aabb(elem_A->bvh_id).intersects(bvh.get_aabb(elem_B->bvh_id)))
+				continue;
+
+			if (unpair_callback) {
+				unpair_callback(elem_A->owner, elem_A->subindex, elem_B->owner, elem_B->subindex, F->get(), unpair_userdata);
+			}
+			to_erase.push_back(F->key());
+		}
+		while (to_erase.size()) {
+
+			pair_map.erase(to_erase.front()->get());
+			to_erase.pop_front();
+		}
+	}
+
+	// find new pairs for everything that moved
+	while (moved_list.size()) {
+
+		Element *e = moved_list.front()->get();
+		moved_list.pop_front();
+
+		BroadPhaseBVHPairResult result;
+		result.self = e;
+		result.count = 0;
+
+		bvh.aabb_query(bvh.get_aabb(e->bvh_id), result);
+
+		for (int i = 0; i < result.count; i++) {
+
+			Element *other = result.candidates[i];
+
+			if (e->owner == other->owner)
+				continue;
+			if (e->_static && other->_static)
+				continue;
+			//candidates already overlap the fattened leaf volume; pairing on
+			//that (rather than the tight AABB) keeps pairs stable under jitter
+			//and lets narrowphase do the exact rejection
+
+			PairKey key(e->id, other->id);
+			if (pair_map.has(key))
+				continue;
+
+			void *data = NULL;
+			if (pair_callback) {
+				data = pair_callback(e->owner, e->subindex, other->owner, other->subindex, pair_userdata);
+			}
+			pair_map[key] = data;
+		}
+	}
+}
+
+BroadPhaseSW *BroadPhaseBVH::_create() {
+
+	return memnew(BroadPhaseBVH);
+}
+
+BroadPhaseBVH::BroadPhaseBVH() {
+
+	real_t margin = GLOBAL_DEF("physics/3d/bvh_aabb_margin", 0.1);
+	ProjectSettings::get_singleton()->set_custom_property_info("physics/3d/bvh_aabb_margin", PropertyInfo(Variant::REAL, "physics/3d/bvh_aabb_margin", PROPERTY_HINT_RANGE, "0,2,0.01"));
+	bvh.set_aabb_margin(margin);
+
+	current = 0;
+	pass = 0;
+	pair_callback = NULL;
+	pair_userdata = NULL;
+	unpair_callback = NULL;
+	unpair_userdata = NULL;
+}
@@ -65,6 +65,9 @@ public:
 	virtual void set_pair_callback(PairCallback p_pair_callback, void *p_userdata) = 0;
 	virtual void set_unpair_callback(UnpairCallback p_unpair_callback, void *p_userdata) = 0;
 
+	//whether cull_* may be called from several threads at once (no query-time mutation)
+	virtual bool supports_concurrent_queries() const { return false; }
+
 	virtual void update() = 0;
 
 	virtual ~BroadPhaseSW();
@@ -142,6 +142,11 @@ void CollisionObjectSW::_unregister_shapes() {
 			s.bpid = 0;
 		}
 	}
+
+	if (space) {
+		broadphase_self_version++;
+		space->bump_broadphase_version();
+	}
 }
 
 void CollisionObjectSW::_update_shapes() {
@@ -169,6 +174,9 @@ void CollisionObjectSW::_update_shapes() {
 
 		space->get_broadphase()->move(s.bpid, s.aabb_cache);
 	}
+
+	broadphase_self_version++;
+	space->bump_broadphase_version();
 }
 
 void CollisionObjectSW::_update_shapes_with_motion(const Vector3 &p_motion) {
@@ -193,6 +201,9 @@ void CollisionObjectSW::_update_shapes_with_motion(const Vector3 &p_motion) {
 
 		space->get_broadphase()->move(s.bpid, shape_aabb);
 	}
+
+	broadphase_self_version++;
+	space->bump_broadphase_version();
 }
 
 void CollisionObjectSW::_set_space(SpaceSW *p_space) {
@@ -236,4 +247,5 @@ CollisionObjectSW::CollisionObjectSW(Type p_type) :
 	collision_layer = 1;
 	collision_mask = 1;
 	ray_pickable = true;
+	broadphase_self_version = 0;
 }
@@ -102,6 +102,10 @@ protected:
 
 	bool ray_pickable;
 
+	// How many times this object updated its own broadphase entries; used to
+	// tell self-induced broadphase changes apart from the surroundings'.
+	uint64_t broadphase_self_version;
+
 	CollisionObjectSW(Type p_type);
 
 public:
@@ -135,6 +139,8 @@ public:
 	_FORCE_INLINE_ void set_ray_pickable(bool p_enable) { ray_pickable = p_enable; }
 	_FORCE_INLINE_ bool is_ray_pickable() const { return ray_pickable; }
 
+	_FORCE_INLINE_ uint64_t get_broadphase_self_version() const { return broadphase_self_version; }
+
 	void set_shape_as_disabled(int p_idx, bool p_enable);
 	_FORCE_INLINE_ bool is_shape_set_as_disabled(int p_idx) const {
 		CRASH_BAD_INDEX(p_idx, shapes.size());
@@ -31,8 +31,10 @@
 #include "physics_server_sw.h"
 
 #include "broad_phase_basic.h"
+#include "broad_phase_bvh.h"
 #include "broad_phase_octree.h"
 #include "core/os/os.h"
+#include "core/os/threaded_array_processor.h"
 #include "core/script_language.h"
 #include "joints/cone_twist_joint_sw.h"
 #include "joints/generic_6dof_joint_sw.h"
@@ -99,6 +101,8 @@ RID PhysicsServerSW::shape_create(ShapeType p_shape) {
 
 void PhysicsServerSW::shape_set_data(RID p_shape, const Variant &p_data) {
 
+	_sync_async_step();
+
 	ShapeSW *shape = shape_owner.get(p_shape);
 	ERR_FAIL_COND(!shape);
 	shape->set_data(p_data);
@@ -106,6 +110,8 @@ void PhysicsServerSW::shape_set_data(RID p_shape, const Variant &p_data) {
 
 void PhysicsServerSW::shape_set_custom_solver_bias(RID p_shape, real_t p_bias) {
 
+	_sync_async_step();
+
 	ShapeSW *shape = shape_owner.get(p_shape);
 	ERR_FAIL_COND(!shape);
 	shape->set_custom_bias(p_bias);
@@ -113,6 +119,8 @@ void PhysicsServerSW::shape_set_custom_solver_bias(RID p_shape, real_t p_bias) {
 
 PhysicsServer::ShapeType PhysicsServerSW::shape_get_type(RID p_shape) const {
 
+	_sync_async_step();
+
 	const ShapeSW *shape = shape_owner.get(p_shape);
 	ERR_FAIL_COND_V(!shape, SHAPE_CUSTOM);
 	return shape->get_type();
@@ -120,6 +128,8 @@ PhysicsServer::ShapeType PhysicsServerSW::shape_get_type(RID p_shape) const {
 
 Variant PhysicsServerSW::shape_get_data(RID p_shape) const {
 
+	_sync_async_step();
+
 	const ShapeSW *shape = shape_owner.get(p_shape);
 	ERR_FAIL_COND_V(!shape, Variant());
 	ERR_FAIL_COND_V(!shape->is_configured(), Variant());
@@ -135,6 +145,8 @@ real_t PhysicsServerSW::shape_get_margin(RID p_shape) const {
 
 real_t PhysicsServerSW::shape_get_custom_solver_bias(RID p_shape) const {
 
+	_sync_async_step();
+
 	const ShapeSW *shape = shape_owner.get(p_shape);
 	ERR_FAIL_COND_V(!shape, 0);
 	return shape->get_custom_bias();
@@ -161,6 +173,8 @@ RID PhysicsServerSW::space_create() {
 
 void PhysicsServerSW::space_set_active(RID p_space, bool p_active) {
 
+	_sync_async_step();
+
 	SpaceSW *space = space_owner.get(p_space);
 	ERR_FAIL_COND(!space);
 	if (p_active)
@@ -171,6 +185,8 @@ void PhysicsServerSW::space_set_active(RID p_space, bool p_active) {
 
 bool PhysicsServerSW::space_is_active(RID p_space) const {
 
+	_sync_async_step();
+
 	const SpaceSW *space = space_owner.get(p_space);
 	ERR_FAIL_COND_V(!space, false);
 
@@ -179,6 +195,8 @@ bool PhysicsServerSW::space_is_active(RID p_space) const {
 
 void PhysicsServerSW::space_set_param(RID p_space, SpaceParameter p_param, real_t p_value) {
 
+	_sync_async_step();
+
 	SpaceSW *space = space_owner.get(p_space);
 	ERR_FAIL_COND(!space);
 
@@ -187,6 +205,8 @@ void PhysicsServerSW::space_set_param(RID p_space, SpaceParameter p_param, real_
 
 real_t PhysicsServerSW::space_get_param(RID p_space, SpaceParameter p_param) const {
 
+	_sync_async_step();
+
 	const SpaceSW *space = space_owner.get(p_space);
 	ERR_FAIL_COND_V(!space, 0);
 	return space->get_param(p_param);
@@ -194,6 +214,8 @@ real_t PhysicsServerSW::space_get_param(RID p_space, SpaceParameter p_param) con
 
 PhysicsDirectSpaceState *PhysicsServerSW::space_get_direct_state(RID p_space) {
 
+	_sync_async_step();
+
 	SpaceSW *space = space_owner.get(p_space);
 	ERR_FAIL_COND_V(!space, NULL);
 	ERR_FAIL_COND_V_MSG(!doing_sync || space->is_locked(), NULL, "Space state is inaccessible right now, wait for iteration or physics process notification.");
@@ -203,6 +225,8 @@ PhysicsDirectSpaceState *PhysicsServerSW::space_get_direct_state(RID p_space) {
 
 void PhysicsServerSW::space_set_debug_contacts(RID p_space, int p_max_contacts) {
 
+	_sync_async_step();
+
 	SpaceSW *space = space_owner.get(p_space);
 	ERR_FAIL_COND(!space);
 	space->set_debug_contacts(p_max_contacts);
@@ -210,6 +234,8 @@ void PhysicsServerSW::space_set_debug_contacts(RID p_space, int p_max_contacts)
 
 Vector<Vector3> PhysicsServerSW::space_get_contacts(RID p_space) const {
 
+	_sync_async_step();
+
 	SpaceSW *space = space_owner.get(p_space);
 	ERR_FAIL_COND_V(!space, Vector<Vector3>());
 	return space->get_debug_contacts();
@@ -217,6 +243,8 @@ Vector<Vector3> PhysicsServerSW::space_get_contacts(RID p_space) const {
 
 int PhysicsServerSW::space_get_contact_count(RID p_space) const {
 
+	_sync_async_step();
+
 	SpaceSW *space = space_owner.get(p_space);
 	ERR_FAIL_COND_V(!space, 0);
 	return space->get_debug_contact_count();
@@ -232,6 +260,8 @@ RID PhysicsServerSW::area_create() {
 
 void PhysicsServerSW::area_set_space(RID p_area, RID p_space) {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND(!area);
 
@@ -250,6 +280,8 @@ void PhysicsServerSW::area_set_space(RID p_area, RID p_space) {
 
 RID PhysicsServerSW::area_get_space(RID p_area) const {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND_V(!area, RID());
 
@@ -261,6 +293,8 @@ RID PhysicsServerSW::area_get_space(RID p_area) const {
 
 void PhysicsServerSW::area_set_space_override_mode(RID p_area, AreaSpaceOverrideMode p_mode) {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND(!area);
 
@@ -269,6 +303,8 @@ void PhysicsServerSW::area_set_space_override_mode(RID p_area, AreaSpaceOverride
 
 PhysicsServer::AreaSpaceOverrideMode PhysicsServerSW::area_get_space_override_mode(RID p_area) const {
 
+	_sync_async_step();
+
 	const AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND_V(!area, AREA_SPACE_OVERRIDE_DISABLED);
 
@@ -277,6 +313,8 @@ PhysicsServer::AreaSpaceOverrideMode PhysicsServerSW::area_get_space_override_mo
 
 void PhysicsServerSW::area_add_shape(RID p_area, RID p_shape, const Transform &p_transform, bool p_disabled) {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND(!area);
 
@@ -288,6 +326,8 @@ void PhysicsServerSW::area_add_shape(RID p_area, RID p_shape, const Transform &p
 
 void PhysicsServerSW::area_set_shape(RID p_area, int p_shape_idx, RID p_shape) {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND(!area);
 
@@ -300,6 +340,8 @@ void PhysicsServerSW::area_set_shape(RID p_area, int p_shape_idx, RID p_shape) {
 
 void PhysicsServerSW::area_set_shape_transform(RID p_area, int p_shape_idx, const Transform &p_transform) {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND(!area);
 
@@ -308,6 +350,8 @@ void PhysicsServerSW::area_set_shape_transform(RID p_area, int p_shape_idx, cons
 
 int PhysicsServerSW::area_get_shape_count(RID p_area) const {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND_V(!area, -1);
 
@@ -315,6 +359,8 @@ int PhysicsServerSW::area_get_shape_count(RID p_area) const {
 }
 RID PhysicsServerSW::area_get_shape(RID p_area, int p_shape_idx) const {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND_V(!area, RID());
 
@@ -325,6 +371,8 @@ RID PhysicsServerSW::area_get_shape(RID p_area, int p_shape_idx) const {
 }
 Transform PhysicsServerSW::area_get_shape_transform(RID p_area, int p_shape_idx) const {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND_V(!area, Transform());
 
@@ -333,6 +381,8 @@ Transform PhysicsServerSW::area_get_shape_transform(RID p_area, int p_shape_idx)
 
 void PhysicsServerSW::area_remove_shape(RID p_area, int p_shape_idx) {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND(!area);
 
@@ -341,6 +391,8 @@ void PhysicsServerSW::area_remove_shape(RID p_area, int p_shape_idx) {
 
 void PhysicsServerSW::area_clear_shapes(RID p_area) {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND(!area);
 
@@ -350,6 +402,8 @@ void PhysicsServerSW::area_clear_shapes(RID p_area) {
 
 void PhysicsServerSW::area_set_shape_disabled(RID p_area, int p_shape_idx, bool p_disabled) {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND(!area);
 	ERR_FAIL_INDEX(p_shape_idx, area->get_shape_count());
@@ -359,6 +413,8 @@ void PhysicsServerSW::area_set_shape_disabled(RID p_area, int p_shape_idx, bool
 
 void PhysicsServerSW::area_attach_object_instance_id(RID p_area, ObjectID p_id) {
 
+	_sync_async_step();
+
 	if (space_owner.owns(p_area)) {
 		SpaceSW *space = space_owner.get(p_area);
 		p_area = space->get_default_area()->get_self();
@@ -369,6 +425,8 @@ void PhysicsServerSW::area_attach_object_instance_id(RID p_area, ObjectID p_id)
 }
 ObjectID PhysicsServerSW::area_get_object_instance_id(RID p_area) const {
 
+	_sync_async_step();
+
 	if (space_owner.owns(p_area)) {
 		SpaceSW *space = space_owner.get(p_area);
 		p_area = space->get_default_area()->get_self();
@@ -380,6 +438,8 @@ ObjectID PhysicsServerSW::area_get_object_instance_id(RID p_area) const {
 
 void PhysicsServerSW::area_set_param(RID p_area, AreaParameter p_param, const Variant &p_value) {
 
+	_sync_async_step();
+
 	if (space_owner.owns(p_area)) {
 		SpaceSW *space = space_owner.get(p_area);
 		p_area = space->get_default_area()->get_self();
@@ -391,6 +451,8 @@ void PhysicsServerSW::area_set_param(RID p_area, AreaParameter p_param, const Va
 
 void PhysicsServerSW::area_set_transform(RID p_area, const Transform &p_transform) {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND(!area);
 	area->set_transform(p_transform);
@@ -398,6 +460,8 @@ void PhysicsServerSW::area_set_transform(RID p_area, const Transform &p_transfor
 
 Variant PhysicsServerSW::area_get_param(RID p_area, AreaParameter p_param) const {
 
+	_sync_async_step();
+
 	if (space_owner.owns(p_area)) {
 		SpaceSW *space = space_owner.get(p_area);
 		p_area = space->get_default_area()->get_self();
@@ -410,6 +474,8 @@ Variant PhysicsServerSW::area_get_param(RID p_area, AreaParameter p_param) const
 
 Transform PhysicsServerSW::area_get_transform(RID p_area) const {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND_V(!area, Transform());
 
@@ -418,6 +484,8 @@ Transform PhysicsServerSW::area_get_transform(RID p_area) const {
 
 void PhysicsServerSW::area_set_collision_layer(RID p_area, uint32_t p_layer) {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND(!area);
 
@@ -426,6 +494,8 @@ void PhysicsServerSW::area_set_collision_layer(RID p_area, uint32_t p_layer) {
 
 void PhysicsServerSW::area_set_collision_mask(RID p_area, uint32_t p_mask) {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND(!area);
 
@@ -434,6 +504,8 @@ void PhysicsServerSW::area_set_collision_mask(RID p_area, uint32_t p_mask) {
 
 void PhysicsServerSW::area_set_monitorable(RID p_area, bool p_monitorable) {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND(!area);
 	FLUSH_QUERY_CHECK(area);
@@ -443,6 +515,8 @@ void PhysicsServerSW::area_set_monitorable(RID p_area, bool p_monitorable) {
 
 void PhysicsServerSW::area_set_monitor_callback(RID p_area, Object *p_receiver, const StringName &p_method) {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND(!area);
 
@@ -451,6 +525,8 @@ void PhysicsServerSW::area_set_monitor_callback(RID p_area, Object *p_receiver,
 
 void PhysicsServerSW::area_set_ray_pickable(RID p_area, bool p_enable) {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND(!area);
 
@@ -459,6 +535,8 @@ void PhysicsServerSW::area_set_ray_pickable(RID p_area, bool p_enable) {
 
 bool PhysicsServerSW::area_is_ray_pickable(RID p_area) const {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND_V(!area, false);
 
@@ -467,6 +545,8 @@ bool PhysicsServerSW::area_is_ray_pickable(RID p_area) const {
 
 void PhysicsServerSW::area_set_area_monitor_callback(RID p_area, Object *p_receiver, const StringName &p_method) {
 
+	_sync_async_step();
+
 	AreaSW *area = area_owner.get(p_area);
 	ERR_FAIL_COND(!area);
 
@@ -489,6 +569,8 @@ RID PhysicsServerSW::body_create(BodyMode p_mode, bool p_init_sleeping) {
 
 void PhysicsServerSW::body_set_space(RID p_body, RID p_space) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -507,6 +589,8 @@ void PhysicsServerSW::body_set_space(RID p_body, RID p_space) {
 
 RID PhysicsServerSW::body_get_space(RID p_body) const {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, RID());
 
@@ -518,6 +602,8 @@ RID PhysicsServerSW::body_get_space(RID p_body) const {
 
 void PhysicsServerSW::body_set_mode(RID p_body, BodyMode p_mode) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -526,6 +612,8 @@ void PhysicsServerSW::body_set_mode(RID p_body, BodyMode p_mode) {
 
 PhysicsServer::BodyMode PhysicsServerSW::body_get_mode(RID p_body) const {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, BODY_MODE_STATIC);
 
@@ -534,6 +622,8 @@ PhysicsServer::BodyMode PhysicsServerSW::body_get_mode(RID p_body) const {
 
 void PhysicsServerSW::body_add_shape(RID p_body, RID p_shape, const Transform &p_transform, bool p_disabled) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -545,6 +635,8 @@ void PhysicsServerSW::body_add_shape(RID p_body, RID p_shape, const Transform &p
 
 void PhysicsServerSW::body_set_shape(RID p_body, int p_shape_idx, RID p_shape) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -556,6 +648,8 @@ void PhysicsServerSW::body_set_shape(RID p_body, int p_shape_idx, RID p_shape) {
 }
 void PhysicsServerSW::body_set_shape_transform(RID p_body, int p_shape_idx, const Transform &p_transform) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -564,6 +658,8 @@ void PhysicsServerSW::body_set_shape_transform(RID p_body, int p_shape_idx, cons
 
 int PhysicsServerSW::body_get_shape_count(RID p_body) const {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, -1);
 
@@ -571,6 +667,8 @@ int PhysicsServerSW::body_get_shape_count(RID p_body) const {
 }
 RID PhysicsServerSW::body_get_shape(RID p_body, int p_shape_idx) const {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, RID());
 
@@ -582,6 +680,8 @@ RID PhysicsServerSW::body_get_shape(RID p_body, int p_shape_idx) const {
 
 void PhysicsServerSW::body_set_shape_disabled(RID p_body, int p_shape_idx, bool p_disabled) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 	ERR_FAIL_INDEX(p_shape_idx, body->get_shape_count());
@@ -592,6 +692,8 @@ void PhysicsServerSW::body_set_shape_disabled(RID p_body, int p_shape_idx, bool
 
 Transform PhysicsServerSW::body_get_shape_transform(RID p_body, int p_shape_idx) const {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, Transform());
 
@@ -600,6 +702,8 @@ Transform PhysicsServerSW::body_get_shape_transform(RID p_body, int p_shape_idx)
 
 void PhysicsServerSW::body_remove_shape(RID p_body, int p_shape_idx) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -608,6 +712,8 @@ void PhysicsServerSW::body_remove_shape(RID p_body, int p_shape_idx) {
 
 void PhysicsServerSW::body_clear_shapes(RID p_body) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -617,6 +723,8 @@ void PhysicsServerSW::body_clear_shapes(RID p_body) {
 
 void PhysicsServerSW::body_set_enable_continuous_collision_detection(RID p_body, bool p_enable) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -625,6 +733,8 @@ void PhysicsServerSW::body_set_enable_continuous_collision_detection(RID p_body,
 
 bool PhysicsServerSW::body_is_continuous_collision_detection_enabled(RID p_body) const {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, false);
 
@@ -633,6 +743,8 @@ bool PhysicsServerSW::body_is_continuous_collision_detection_enabled(RID p_body)
 
 void PhysicsServerSW::body_set_collision_layer(RID p_body, uint32_t p_layer) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -642,6 +754,8 @@ void PhysicsServerSW::body_set_collision_layer(RID p_body, uint32_t p_layer) {
 
 uint32_t PhysicsServerSW::body_get_collision_layer(RID p_body) const {
 
+	_sync_async_step();
+
 	const BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, 0);
 
@@ -650,6 +764,8 @@ uint32_t PhysicsServerSW::body_get_collision_layer(RID p_body) const {
 
 void PhysicsServerSW::body_set_collision_mask(RID p_body, uint32_t p_mask) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -659,6 +775,8 @@ void PhysicsServerSW::body_set_collision_mask(RID p_body, uint32_t p_mask) {
 
 uint32_t PhysicsServerSW::body_get_collision_mask(RID p_body) const {
 
+	_sync_async_step();
+
 	const BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, 0);
 
@@ -667,6 +785,8 @@ uint32_t PhysicsServerSW::body_get_collision_mask(RID p_body) const {
 
 void PhysicsServerSW::body_attach_object_instance_id(RID p_body, uint32_t p_id) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -675,6 +795,8 @@ void PhysicsServerSW::body_attach_object_instance_id(RID p_body, uint32_t p_id)
 
 uint32_t PhysicsServerSW::body_get_object_instance_id(RID p_body) const {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, 0);
 
@@ -683,12 +805,16 @@ uint32_t PhysicsServerSW::body_get_object_instance_id(RID p_body) const {
 
 void PhysicsServerSW::body_set_user_flags(RID p_body, uint32_t p_flags) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 };
 
 uint32_t PhysicsServerSW::body_get_user_flags(RID p_body) const {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, 0);
 
@@ -697,6 +823,8 @@ uint32_t PhysicsServerSW::body_get_user_flags(RID p_body) const {
 
 void PhysicsServerSW::body_set_param(RID p_body, BodyParameter p_param, real_t p_value) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -705,6 +833,8 @@ void PhysicsServerSW::body_set_param(RID p_body, BodyParameter p_param, real_t p
 
 real_t PhysicsServerSW::body_get_param(RID p_body, BodyParameter p_param) const {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, 0);
 
@@ -712,12 +842,16 @@ real_t PhysicsServerSW::body_get_param(RID p_body, BodyParameter p_param) const
 };
 
 void PhysicsServerSW::body_set_kinematic_safe_margin(RID p_body, real_t p_margin) {
+
+	_sync_async_step();
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 	body->set_kinematic_margin(p_margin);
 }
 
 real_t PhysicsServerSW::body_get_kinematic_safe_margin(RID p_body) const {
+
+	_sync_async_step();
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, 0);
 
@@ -726,6 +860,8 @@ real_t PhysicsServerSW::body_get_kinematic_safe_margin(RID p_body) const {
 
 void PhysicsServerSW::body_set_state(RID p_body, BodyState p_state, const Variant &p_variant) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -734,6 +870,8 @@ void PhysicsServerSW::body_set_state(RID p_body, BodyState p_state, const Varian
 
 Variant PhysicsServerSW::body_get_state(RID p_body, BodyState p_state) const {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, Variant());
 
@@ -742,6 +880,8 @@ Variant PhysicsServerSW::body_get_state(RID p_body, BodyState p_state) const {
 
 void PhysicsServerSW::body_set_applied_force(RID p_body, const Vector3 &p_force) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -751,6 +891,8 @@ void PhysicsServerSW::body_set_applied_force(RID p_body, const Vector3 &p_force)
 
 Vector3 PhysicsServerSW::body_get_applied_force(RID p_body) const {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, Vector3());
 	return body->get_applied_force();
@@ -758,6 +900,8 @@ Vector3 PhysicsServerSW::body_get_applied_force(RID p_body) const {
 
 void PhysicsServerSW::body_set_applied_torque(RID p_body, const Vector3 &p_torque) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -767,6 +911,8 @@ void PhysicsServerSW::body_set_applied_torque(RID p_body, const Vector3 &p_torqu
 
 Vector3 PhysicsServerSW::body_get_applied_torque(RID p_body) const {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, Vector3());
 
@@ -774,6 +920,8 @@ Vector3 PhysicsServerSW::body_get_applied_torque(RID p_body) const {
 };
 
 void PhysicsServerSW::body_add_central_force(RID p_body, const Vector3 &p_force) {
+
+	_sync_async_step();
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -782,6 +930,8 @@ void PhysicsServerSW::body_add_central_force(RID p_body, const Vector3 &p_force)
 }
 
 void PhysicsServerSW::body_add_force(RID p_body, const Vector3 &p_force, const Vector3 &p_pos) {
+
+	_sync_async_step();
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -790,6 +940,8 @@ void PhysicsServerSW::body_add_force(RID p_body, const Vector3 &p_force, const V
 };
 
 void PhysicsServerSW::body_add_torque(RID p_body, const Vector3 &p_torque) {
+
+	_sync_async_step();
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -798,6 +950,8 @@ void PhysicsServerSW::body_add_torque(RID p_body, const Vector3 &p_torque) {
 };
 
 void PhysicsServerSW::body_apply_central_impulse(RID p_body, const Vector3 &p_impulse) {
+
+	_sync_async_step();
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -809,6 +963,8 @@ void PhysicsServerSW::body_apply_central_impulse(RID p_body, const Vector3 &p_im
 
 void PhysicsServerSW::body_apply_impulse(RID p_body, const Vector3 &p_pos, const Vector3 &p_impulse) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -820,6 +976,8 @@ void PhysicsServerSW::body_apply_impulse(RID p_body, const Vector3 &p_pos, const
 
 void PhysicsServerSW::body_apply_torque_impulse(RID p_body, const Vector3 &p_impulse) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -831,6 +989,8 @@ void PhysicsServerSW::body_apply_torque_impulse(RID p_body, const Vector3 &p_imp
 
 void PhysicsServerSW::body_set_axis_velocity(RID p_body, const Vector3 &p_axis_velocity) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -846,6 +1006,8 @@ void PhysicsServerSW::body_set_axis_velocity(RID p_body, const Vector3 &p_axis_v
 
 void PhysicsServerSW::body_set_axis_lock(RID p_body, BodyAxis p_axis, bool p_lock) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -855,6 +1017,8 @@ void PhysicsServerSW::body_set_axis_lock(RID p_body, BodyAxis p_axis, bool p_loc
 
 bool PhysicsServerSW::body_is_axis_locked(RID p_body, BodyAxis p_axis) const {
 
+	_sync_async_step();
+
 	const BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, 0);
 	return body->is_axis_locked(p_axis);
@@ -862,6 +1026,8 @@ bool PhysicsServerSW::body_is_axis_locked(RID p_body, BodyAxis p_axis) const {
 
 void PhysicsServerSW::body_add_collision_exception(RID p_body, RID p_body_b) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -871,6 +1037,8 @@ void PhysicsServerSW::body_add_collision_exception(RID p_body, RID p_body_b) {
 
 void PhysicsServerSW::body_remove_collision_exception(RID p_body, RID p_body_b) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -880,6 +1048,8 @@ void PhysicsServerSW::body_remove_collision_exception(RID p_body, RID p_body_b)
 
 void PhysicsServerSW::body_get_collision_exceptions(RID p_body, List<RID> *p_exceptions) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -890,12 +1060,16 @@ void PhysicsServerSW::body_get_collision_exceptions(RID p_body, List<RID> *p_exc
 
 void PhysicsServerSW::body_set_contacts_reported_depth_threshold(RID p_body, real_t p_threshold) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 };
 
 real_t PhysicsServerSW::body_get_contacts_reported_depth_threshold(RID p_body) const {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, 0);
 	return 0;
@@ -903,6 +1077,8 @@ real_t PhysicsServerSW::body_get_contacts_reported_depth_threshold(RID p_body) c
 
 void PhysicsServerSW::body_set_omit_force_integration(RID p_body, bool p_omit) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 
@@ -911,6 +1087,8 @@ void PhysicsServerSW::body_set_omit_force_integration(RID p_body, bool p_omit) {
 
 bool PhysicsServerSW::body_is_omitting_force_integration(RID p_body) const {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, false);
 	return body->get_omit_force_integration();
@@ -918,6 +1096,8 @@ bool PhysicsServerSW::body_is_omitting_force_integration(RID p_body) const {
 
 void PhysicsServerSW::body_set_max_contacts_reported(RID p_body, int p_contacts) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 	body->set_max_contacts_reported(p_contacts);
@@ -925,6 +1105,8 @@ void PhysicsServerSW::body_set_max_contacts_reported(RID p_body, int p_contacts)
 
 int PhysicsServerSW::body_get_max_contacts_reported(RID p_body) const {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, -1);
 	return body->get_max_contacts_reported();
@@ -932,6 +1114,8 @@ int PhysicsServerSW::body_get_max_contacts_reported(RID p_body) const {
 
 void PhysicsServerSW::body_set_force_integration_callback(RID p_body, Object *p_receiver, const StringName &p_method, const Variant &p_udata) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 	body->set_force_integration_callback(p_receiver ? p_receiver->get_instance_id() : ObjectID(0), p_method, p_udata);
@@ -939,6 +1123,8 @@ void PhysicsServerSW::body_set_force_integration_callback(RID p_body, Object *p_
 
 void PhysicsServerSW::body_set_ray_pickable(RID p_body, bool p_enable) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND(!body);
 	body->set_ray_pickable(p_enable);
@@ -946,6 +1132,8 @@ void PhysicsServerSW::body_set_ray_pickable(RID p_body, bool p_enable) {
 
 bool PhysicsServerSW::body_is_ray_pickable(RID p_body) const {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, false);
 	return body->is_ray_pickable();
@@ -953,6 +1141,8 @@ bool PhysicsServerSW::body_is_ray_pickable(RID p_body) const {
 
 bool PhysicsServerSW::body_test_motion(RID p_body, const Transform &p_from, const Vector3 &p_motion, bool p_infinite_inertia, MotionResult *r_result, bool p_exclude_raycast_shapes) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, false);
 	ERR_FAIL_COND_V(!body->get_space(), false);
@@ -965,6 +1155,8 @@ bool PhysicsServerSW::body_test_motion(RID p_body, const Transform &p_from, cons
 
 int PhysicsServerSW::body_test_ray_separation(RID p_body, const Transform &p_transform, bool p_infinite_inertia, Vector3 &r_recover_motion, SeparationResult *r_results, int p_result_max, float p_margin) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, false);
 	ERR_FAIL_COND_V(!body->get_space(), false);
@@ -977,6 +1169,8 @@ int PhysicsServerSW::body_test_ray_separation(RID p_body, const Transform &p_tra
 
 PhysicsDirectBodyState *PhysicsServerSW::body_get_direct_state(RID p_body) {
 
+	_sync_async_step();
+
 	BodySW *body = body_owner.get(p_body);
 	ERR_FAIL_COND_V(!body, NULL);
 	ERR_FAIL_COND_V_MSG(!doing_sync || body->get_space()->is_locked(), NULL, "Body state is inaccessible right now, wait for iteration or physics process notification.");
@@ -989,6 +1183,8 @@ PhysicsDirectBodyState *PhysicsServerSW::body_get_direct_state(RID p_body) {
 
 RID PhysicsServerSW::joint_create_pin(RID p_body_A, const Vector3 &p_local_A, RID p_body_B, const Vector3 &p_local_B) {
 
+	_sync_async_step();
+
 	BodySW *body_A = body_owner.get(p_body_A);
 	ERR_FAIL_COND_V(!body_A, RID());
 
@@ -1010,6 +1206,8 @@ RID PhysicsServerSW::joint_create_pin(RID p_body_A, const Vector3 &p_local_A, RI
 
 void PhysicsServerSW::pin_joint_set_param(RID p_joint, PinJointParam p_param, real_t p_value) {
 
+	_sync_async_step();
+
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND(!joint);
 	ERR_FAIL_COND(joint->get_type() != JOINT_PIN);
@@ -1018,6 +1216,8 @@ void PhysicsServerSW::pin_joint_set_param(RID p_joint, PinJointParam p_param, re
 }
 real_t PhysicsServerSW::pin_joint_get_param(RID p_joint, PinJointParam p_param) const {
 
+	_sync_async_step();
+
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND_V(!joint, 0);
 	ERR_FAIL_COND_V(joint->get_type() != JOINT_PIN, 0);
@@ -1027,6 +1227,8 @@ real_t PhysicsServerSW::pin_joint_get_param(RID p_joint, PinJointParam p_param)
 
 void PhysicsServerSW::pin_joint_set_local_a(RID p_joint, const Vector3 &p_A) {
 
+	_sync_async_step();
+
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND(!joint);
 	ERR_FAIL_COND(joint->get_type() != JOINT_PIN);
@@ -1035,6 +1237,8 @@ void PhysicsServerSW::pin_joint_set_local_a(RID p_joint, const Vector3 &p_A) {
 }
 Vector3 PhysicsServerSW::pin_joint_get_local_a(RID p_joint) const {
 
+	_sync_async_step();
+
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND_V(!joint, Vector3());
 	ERR_FAIL_COND_V(joint->get_type() != JOINT_PIN, Vector3());
@@ -1044,6 +1248,8 @@ Vector3 PhysicsServerSW::pin_joint_get_local_a(RID p_joint) const {
 
 void PhysicsServerSW::pin_joint_set_local_b(RID p_joint, const Vector3 &p_B) {
 
+	_sync_async_step();
+
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND(!joint);
 	ERR_FAIL_COND(joint->get_type() != JOINT_PIN);
@@ -1052,6 +1258,8 @@ void PhysicsServerSW::pin_joint_set_local_b(RID p_joint, const Vector3 &p_B) {
 }
 Vector3 PhysicsServerSW::pin_joint_get_local_b(RID p_joint) const {
 
+	_sync_async_step();
+
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND_V(!joint, Vector3());
 	ERR_FAIL_COND_V(joint->get_type() != JOINT_PIN, Vector3());
@@ -1061,6 +1269,8 @@ Vector3 PhysicsServerSW::pin_joint_get_local_b(RID p_joint) const {
 
 RID PhysicsServerSW::joint_create_hinge(RID p_body_A, const Transform &p_frame_A, RID p_body_B, const Transform &p_frame_B) {
 
+	_sync_async_step();
+
 	BodySW *body_A = body_owner.get(p_body_A);
 	ERR_FAIL_COND_V(!body_A, RID());
 
@@ -1082,6 +1292,8 @@ RID PhysicsServerSW::joint_create_hinge(RID p_body_A, const Transform &p_frame_A
 
 RID PhysicsServerSW::joint_create_hinge_simple(RID p_body_A, const Vector3 &p_pivot_A, const Vector3 &p_axis_A, RID p_body_B, const Vector3 &p_pivot_B, const Vector3 &p_axis_B) {
 
+	_sync_async_step();
+
 	BodySW *body_A = body_owner.get(p_body_A);
 	ERR_FAIL_COND_V(!body_A, RID());
 
@@ -1103,6 +1315,8 @@ RID PhysicsServerSW::joint_create_hinge_simple(RID p_body_A, const Vector3 &p_pi
 
 void PhysicsServerSW::hinge_joint_set_param(RID p_joint, HingeJointParam p_param, real_t p_value) {
 
+	_sync_async_step();
+
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND(!joint);
 	ERR_FAIL_COND(joint->get_type() != JOINT_HINGE);
@@ -1111,6 +1325,8 @@ void PhysicsServerSW::hinge_joint_set_param(RID p_joint, HingeJointParam p_param
 }
 real_t PhysicsServerSW::hinge_joint_get_param(RID p_joint, HingeJointParam p_param) const {
 
+	_sync_async_step();
+
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND_V(!joint, 0);
 	ERR_FAIL_COND_V(joint->get_type() != JOINT_HINGE, 0);
@@ -1120,6 +1336,8 @@ real_t PhysicsServerSW::hinge_joint_get_param(RID p_joint, HingeJointParam p_par
 
 void PhysicsServerSW::hinge_joint_set_flag(RID p_joint, HingeJointFlag p_flag, bool p_value) {
 
+	_sync_async_step();
+
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND(!joint);
 	ERR_FAIL_COND(joint->get_type() != JOINT_HINGE);
@@ -1128,6 +1346,8 @@ void PhysicsServerSW::hinge_joint_set_flag(RID p_joint, HingeJointFlag p_flag, b
 }
 bool PhysicsServerSW::hinge_joint_get_flag(RID p_joint, HingeJointFlag p_flag) const {
 
+	_sync_async_step();
+
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND_V(!joint, false);
 	ERR_FAIL_COND_V(joint->get_type() != JOINT_HINGE, false);
@@ -1137,6 +1357,8 @@ bool PhysicsServerSW::hinge_joint_get_flag(RID p_joint, HingeJointFlag p_flag) c
 
 void PhysicsServerSW::joint_set_solver_priority(RID p_joint, int p_priority) {
 
+	_sync_async_step();
+
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND(!joint);
 	joint->set_priority(p_priority);
@@ -1144,12 +1366,16 @@ void PhysicsServerSW::joint_set_solver_priority(RID p_joint, int p_priority) {
 
 int PhysicsServerSW::joint_get_solver_priority(RID p_joint) const {
 
+	_sync_async_step();
+
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND_V(!joint, 0);
 	return joint->get_priority();
 }
 
 void PhysicsServerSW::joint_disable_collisions_between_bodies(RID p_joint, const bool p_disable) {
+
+	_sync_async_step();
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND(!joint);
 
@@ -1170,6 +1396,8 @@ void PhysicsServerSW::joint_disable_collisions_between_bodies(RID p_joint, const
 }
 
 bool PhysicsServerSW::joint_is_disabled_collisions_between_bodies(RID p_joint) const {
+
+	_sync_async_step();
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND_V(!joint, true);
 
@@ -1178,6 +1406,8 @@ bool PhysicsServerSW::joint_is_disabled_collisions_between_bodies(RID p_joint) c
 
 PhysicsServerSW::JointType PhysicsServerSW::joint_get_type(RID p_joint) const {
 
+	_sync_async_step();
+
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND_V(!joint, JOINT_PIN);
 	return joint->get_type();
@@ -1185,6 +1415,8 @@ PhysicsServerSW::JointType PhysicsServerSW::joint_get_type(RID p_joint) const {
 
 RID PhysicsServerSW::joint_create_slider(RID p_body_A, const Transform &p_local_frame_A, RID p_body_B, const Transform &p_local_frame_B) {
 
+	_sync_async_step();
+
 	BodySW *body_A = body_owner.get(p_body_A);
 	ERR_FAIL_COND_V(!body_A, RID());
 
@@ -1206,6 +1438,8 @@ RID PhysicsServerSW::joint_create_slider(RID p_body_A, const Transform &p_local_
 
 void PhysicsServerSW::slider_joint_set_param(RID p_joint, SliderJointParam p_param, real_t p_value) {
 
+	_sync_async_step();
+
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND(!joint);
 	ERR_FAIL_COND(joint->get_type() != JOINT_SLIDER);
@@ -1214,6 +1448,8 @@ void PhysicsServerSW::slider_joint_set_param(RID p_joint, SliderJointParam p_par
 }
 real_t PhysicsServerSW::slider_joint_get_param(RID p_joint, SliderJointParam p_param) const {
 
+	_sync_async_step();
+
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND_V(!joint, 0);
 	ERR_FAIL_COND_V(joint->get_type() != JOINT_CONE_TWIST, 0);
@@ -1223,6 +1459,8 @@ real_t PhysicsServerSW::slider_joint_get_param(RID p_joint, SliderJointParam p_p
 
 RID PhysicsServerSW::joint_create_cone_twist(RID p_body_A, const Transform &p_local_frame_A, RID p_body_B, const Transform &p_local_frame_B) {
 
+	_sync_async_step();
+
 	BodySW *body_A = body_owner.get(p_body_A);
 	ERR_FAIL_COND_V(!body_A, RID());
 
@@ -1244,6 +1482,8 @@ RID PhysicsServerSW::joint_create_cone_twist(RID p_body_A, const Transform &p_lo
 
 void PhysicsServerSW::cone_twist_joint_set_param(RID p_joint, ConeTwistJointParam p_param, real_t p_value) {
 
+	_sync_async_step();
+
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND(!joint);
 	ERR_FAIL_COND(joint->get_type() != JOINT_CONE_TWIST);
@@ -1252,6 +1492,8 @@ void PhysicsServerSW::cone_twist_joint_set_param(RID p_joint, ConeTwistJointPara
 }
 real_t PhysicsServerSW::cone_twist_joint_get_param(RID p_joint, ConeTwistJointParam p_param) const {
 
+	_sync_async_step();
+
 	JointSW *joint = joint_owner.get(p_joint);
 	ERR_FAIL_COND_V(!joint, 0);
 	ERR_FAIL_COND_V(joint->get_type() != JOINT_CONE_TWIST, 0);
@@ -1261,6 +1503,8 @@ real_t PhysicsServerSW::cone_twist_joint_get_param(RID p_joint, ConeTwistJointPa
 
 RID PhysicsServerSW::joint_create_generic_6dof(RID p_body_A, const Transform &p_local_frame_A, RID p_body_B, const Transform &p_local_frame_B) {
 
+	_sync_async_step();
+
 	BodySW *body_A = body_owner.get(p_body_A);
 	ERR_FAIL_COND_V(!body_A, RID());
 
@@ -1316,6 +1560,8 @@ bool PhysicsServerSW::generic_6dof_joint_get_flag(RID p_joint, Vector3::Axis p_a
 
 void PhysicsServerSW::free(RID p_rid) {
 
+	_sync_async_step();
+
 	_update_shapes(); //just in case
 
 	if (shape_owner.owns(p_rid)) {
@@ -1413,8 +1659,19 @@ void PhysicsServerSW::init() {
 	iterations = 8; // 8?
 	stepper = memnew(StepSW);
 	direct_state = memnew(PhysicsDirectBodyStateSW);
+	parallel_spaces = GLOBAL_DEF("physics/3d/parallel_space_stepping", false);
+	step_delta = 0;
+	async_stepping = GLOBAL_DEF("physics/3d/async_stepping", false);
+	step_task_pending = false;
+	step_task = 0;
+	async_step_delta = 0;
 };
 
+void PhysicsServerSW::_step_space(uint32_t p_index, void *p_unused) {
+
+	space_steppers[p_index]->step(step_space_array[p_index], step_delta, iterations);
+}
+
 void PhysicsServerSW::step(real_t p_step) {
 
 #ifndef _3D_DISABLED
@@ -1422,6 +1679,33 @@ void PhysicsServerSW::step(real_t p_step) {
 	if (!active)
 		return;
 
+	if (async_stepping && WorkerThreadPool::get_singleton() && WorkerThreadPool::get_singleton()->get_thread_count() > 0) {
+		// Run the step on a worker so the last step of a frame overlaps
+		// with idle processing and rendering; sync() waits for it before
+		// flush_queries() hands results to the scene. Every server entry
+		// point that touches simulation state calls _sync_async_step()
+		// first, so late callers from _process() block on the in-flight
+		// step instead of racing it; the overlap simply ends early.
+		async_step_delta = p_step;
+		step_task = WorkerThreadPool::get_singleton()->add_task(_async_step_task, this);
+		step_task_pending = true;
+		return;
+	}
+
+	_do_step(p_step);
+#endif
+}
+
+void PhysicsServerSW::_async_step_task(void *p_self) {
+
+	PhysicsServerSW *self = (PhysicsServerSW *)p_self;
+	self->_do_step(self->async_step_delta);
+}
+
+void PhysicsServerSW::_do_step(real_t p_step) {
+
+#ifndef _3D_DISABLED
+
 	_update_shapes();
 
 	doing_sync = false;
@@ -1432,18 +1716,45 @@ void PhysicsServerSW::step(real_t p_step) {
 	island_count = 0;
 	active_objects = 0;
 	collision_pairs = 0;
+	for (int i = 0; i < SpaceSW::ELAPSED_TIME_MAX; i++) {
+		phase_time[i] = 0;
+	}
+	bool use_threads = parallel_spaces && active_spaces.size() > 1 && WorkerThreadPool::get_singleton() && WorkerThreadPool::get_singleton()->get_thread_count() > 0;
+
+	if (use_threads) {
+		// Active spaces are fully isolated simulation worlds, so each one
+		// can step on its own worker thread. State callbacks stay deferred
+		// until flush_queries(), which runs on the main thread as usual.
+		step_space_array.clear();
+		for (Set<const SpaceSW *>::Element *E = active_spaces.front(); E; E = E->next()) {
+			step_space_array.push_back((SpaceSW *)E->get());
+		}
+		while (space_steppers.size() < step_space_array.size()) {
+			space_steppers.push_back(memnew(StepSW));
+		}
+		step_delta = p_step;
+		thread_process_array(step_space_array.size(), this, &PhysicsServerSW::_step_space, (void *)NULL);
+	} else {
+		for (Set<const SpaceSW *>::Element *E = active_spaces.front(); E; E = E->next()) {
+			stepper->step((SpaceSW *)E->get(), p_step, iterations);
+		}
+	}
+
 	for (Set<const SpaceSW *>::Element *E = active_spaces.front(); E; E = E->next()) {
 
-		stepper->step((SpaceSW *)E->get(), p_step, iterations);
 		island_count += E->get()->get_island_count();
 		active_objects += E->get()->get_active_objects();
 		collision_pairs += E->get()->get_collision_pairs();
+		for (int i = 0; i < SpaceSW::ELAPSED_TIME_MAX; i++) {
+			phase_time[i] += E->get()->get_elapsed_time(SpaceSW::ElapsedTime(i));
+		}
 	}
 #endif
 }
 
-void PhysicsServerSW::sync(){
+void PhysicsServerSW::sync() {
 
+	_sync_async_step();
 };
 
 void PhysicsServerSW::flush_queries() {
@@ -1453,6 +1764,8 @@ void PhysicsServerSW::flush_queries() {
 	if (!active)
 		return;
 
+	sync(); // In case a caller flushes without syncing first.
+
 	doing_sync = true;
 
 	flushing_queries = true;
@@ -1475,7 +1788,8 @@ void PhysicsServerSW::flush_queries() {
 			"generate_islands",
 			"setup_constraints",
 			"solve_constraints",
-			"integrate_velocities"
+			"integrate_velocities",
+			"broadphase"
 		};
 
 		for (int i = 0; i < SpaceSW::ELAPSED_TIME_MAX; i++) {
@@ -1505,7 +1819,12 @@ void PhysicsServerSW::flush_queries() {
 
 void PhysicsServerSW::finish() {
 
+	sync();
 	memdelete(stepper);
+	for (int i = 0; i < space_steppers.size(); i++) {
+		memdelete(space_steppers[i]);
+	}
+	space_steppers.clear();
 	memdelete(direct_state);
 };
 
@@ -1524,6 +1843,25 @@ int PhysicsServerSW::get_process_info(ProcessInfo p_info) {
 
 			return island_count;
 		} break;
+		case INFO_SOLVER_ITERATIONS: {
+			return iterations;
+		} break;
+		case INFO_BROADPHASE_TIME: {
+			return phase_time[SpaceSW::ELAPSED_TIME_BROADPHASE];
+		} break;
+		case INFO_NARROWPHASE_TIME: {
+			//narrowphase collision runs while setting up contact constraints
+			return phase_time[SpaceSW::ELAPSED_TIME_SETUP_CONSTRAINTS];
+		} break;
+		case INFO_ISLAND_TIME: {
+			return phase_time[SpaceSW::ELAPSED_TIME_GENERATE_ISLANDS];
+		} break;
+		case INFO_SOLVE_TIME: {
+			return phase_time[SpaceSW::ELAPSED_TIME_SOLVE_CONSTRAINTS];
+		} break;
+		case INFO_INTEGRATE_TIME: {
+			return phase_time[SpaceSW::ELAPSED_TIME_INTEGRATE_FORCES] + phase_time[SpaceSW::ELAPSED_TIME_INTEGRATE_VELOCITIES];
+		} break;
 	}
 
 	return 0;
@@ -1574,10 +1912,18 @@ void PhysicsServerSW::_shape_col_cbk(const Vector3 &p_point_A, const Vector3 &p_
 PhysicsServerSW *PhysicsServerSW::singleton = NULL;
 PhysicsServerSW::PhysicsServerSW() {
 	singleton = this;
-	BroadPhaseSW::create_func = BroadPhaseOctree::_create;
+	bool use_bvh = GLOBAL_DEF("physics/3d/use_bvh_broadphase", true);
+	if (use_bvh) {
+		BroadPhaseSW::create_func = BroadPhaseBVH::_create;
+	} else {
+		BroadPhaseSW::create_func = BroadPhaseOctree::_create;
+	}
 	island_count = 0;
 	active_objects = 0;
 	collision_pairs = 0;
+	for (int i = 0; i < SpaceSW::ELAPSED_TIME_MAX; i++) {
+		phase_time[i] = 0;
+	}
 
 	active = true;
 	flushing_queries = false;
@@ -31,6 +31,7 @@
 #ifndef PHYSICS_SERVER_SW
 #define PHYSICS_SERVER_SW
 
+#include "core/os/worker_thread_pool.h"
 #include "joints_sw.h"
 #include "servers/physics_server.h"
 #include "shape_sw.h"
@@ -50,19 +51,42 @@ class PhysicsServerSW : public PhysicsServer {
 	int island_count;
 	int active_objects;
 	int collision_pairs;
+	uint64_t phase_time[SpaceSW::ELAPSED_TIME_MAX];
 
 	bool flushing_queries;
 
 	StepSW *stepper;
 	Set<const SpaceSW *> active_spaces;
 
+	bool parallel_spaces;
+	Vector<SpaceSW *> step_space_array;
+	Vector<StepSW *> space_steppers;
+	real_t step_delta;
+	void _step_space(uint32_t p_index, void *p_unused);
+
+	bool async_stepping;
+	mutable bool step_task_pending; //cleared from const getters that sync
+	WorkerThreadPool::TaskID step_task;
+	real_t async_step_delta;
+	static void _async_step_task(void *p_self);
+	void _do_step(real_t p_step);
+
+	//an async step may still be integrating the spaces on a worker thread;
+	//every entry point that touches simulation state waits for it first
+	_FORCE_INLINE_ void _sync_async_step() const {
+		if (step_task_pending) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(step_task);
+			step_task_pending = false;
+		}
+	}
+
 	PhysicsDirectBodyStateSW *direct_state;
 
-	mutable RID_Owner<ShapeSW> shape_owner;
-	mutable RID_Owner<SpaceSW> space_owner;
-	mutable RID_Owner<AreaSW> area_owner;
-	mutable RID_Owner<BodySW> body_owner;
-	mutable RID_Owner<JointSW> joint_owner;
+	mutable RID_SlotOwner<ShapeSW> shape_owner;
+	mutable RID_SlotOwner<SpaceSW> space_owner;
+	mutable RID_SlotOwner<AreaSW> area_owner;
+	mutable RID_SlotOwner<BodySW> body_owner;
+	mutable RID_SlotOwner<JointSW> joint_owner;
 
 	//void _clear_query(QuerySW *p_query);
 	friend class CollisionObjectSW;
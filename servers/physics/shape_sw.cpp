@@ -38,6 +38,16 @@
 #define _EDGE_IS_VALID_SUPPORT_THRESHOLD 0.0002
 #define _FACE_IS_VALID_SUPPORT_THRESHOLD 0.9998
 
+#ifndef REAL_T_IS_DOUBLE
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define CONVEX_SUPPORT_SIMD
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define CONVEX_SUPPORT_SIMD
+#endif
+#endif
+
 void ShapeSW::configure(const AABB &p_aabb) {
 	aabb = p_aabb;
 	configured = true;
@@ -711,17 +721,167 @@ CapsuleShapeSW::CapsuleShapeSW() {
 
 /********** CONVEX POLYGON *************/
 
-void ConvexPolygonShapeSW::project_range(const Vector3 &p_normal, const Transform &p_transform, real_t &r_min, real_t &r_max) const {
+int ConvexPolygonShapeSW::_support_index(const Vector3 &p_normal) const {
 
 	int vertex_count = mesh.vertices.size();
-	if (vertex_count == 0)
+
+#ifdef CONVEX_SUPPORT_SIMD
+	if (soa_count >= 8) { //batching needs a few registers' worth of vertices to pay off
+
+		const float *xs = vertex_soa.ptr();
+		const float *ys = xs + soa_count;
+		const float *zs = ys + soa_count;
+
+		float lane_vals[4];
+		int32_t lane_idx[4];
+
+#if defined(__SSE2__)
+		__m128 nx = _mm_set1_ps(p_normal.x);
+		__m128 ny = _mm_set1_ps(p_normal.y);
+		__m128 nz = _mm_set1_ps(p_normal.z);
+		__m128 best = _mm_set1_ps(-1e30f);
+		__m128i best_idx = _mm_setzero_si128();
+		__m128i idx = _mm_set_epi32(3, 2, 1, 0);
+		__m128i step = _mm_set1_epi32(4);
+
+		for (int i = 0; i < soa_count; i += 4) {
+
+			__m128 d = _mm_mul_ps(_mm_loadu_ps(xs + i), nx);
+			d = _mm_add_ps(d, _mm_mul_ps(_mm_loadu_ps(ys + i), ny));
+			d = _mm_add_ps(d, _mm_mul_ps(_mm_loadu_ps(zs + i), nz));
+
+			__m128i gt = _mm_castps_si128(_mm_cmpgt_ps(d, best));
+			best = _mm_max_ps(best, d);
+			best_idx = _mm_or_si128(_mm_and_si128(gt, idx), _mm_andnot_si128(gt, best_idx));
+			idx = _mm_add_epi32(idx, step);
+		}
+
+		_mm_storeu_ps(lane_vals, best);
+		_mm_storeu_si128((__m128i *)lane_idx, best_idx);
+#else
+		float32x4_t nx = vdupq_n_f32(p_normal.x);
+		float32x4_t ny = vdupq_n_f32(p_normal.y);
+		float32x4_t nz = vdupq_n_f32(p_normal.z);
+		float32x4_t best = vdupq_n_f32(-1e30f);
+		uint32x4_t best_idx = vdupq_n_u32(0);
+		const uint32_t idx_init[4] = { 0, 1, 2, 3 };
+		uint32x4_t idx = vld1q_u32(idx_init);
+		uint32x4_t step = vdupq_n_u32(4);
+
+		for (int i = 0; i < soa_count; i += 4) {
+
+			float32x4_t d = vmulq_f32(vld1q_f32(xs + i), nx);
+			d = vmlaq_f32(d, vld1q_f32(ys + i), ny);
+			d = vmlaq_f32(d, vld1q_f32(zs + i), nz);
+
+			uint32x4_t gt = vcgtq_f32(d, best);
+			best = vmaxq_f32(best, d);
+			best_idx = vbslq_u32(gt, idx, best_idx);
+			idx = vaddq_u32(idx, step);
+		}
+
+		vst1q_f32(lane_vals, best);
+		vst1q_u32((uint32_t *)lane_idx, best_idx);
+#endif
+
+		int best_lane = 0;
+		for (int i = 1; i < 4; i++) {
+			if (lane_vals[i] > lane_vals[best_lane])
+				best_lane = i;
+		}
+
+		//padding repeats the last vertex, the strict compares keep the real one
+		return MIN(lane_idx[best_lane], vertex_count - 1);
+	}
+#endif
+
+	const Vector3 *vrts = &mesh.vertices[0];
+
+	int vert_support_idx = -1;
+	real_t support_max = 0;
+
+	for (int i = 0; i < vertex_count; i++) {
+
+		real_t d = p_normal.dot(vrts[i]);
+
+		if (i == 0 || d > support_max) {
+			support_max = d;
+			vert_support_idx = i;
+		}
+	}
+
+	return vert_support_idx;
+}
+
+void ConvexPolygonShapeSW::_project_range_local(const Vector3 &p_normal, real_t &r_min, real_t &r_max) const {
+
+	int vertex_count = mesh.vertices.size();
+
+#ifdef CONVEX_SUPPORT_SIMD
+	if (soa_count >= 8) {
+
+		const float *xs = vertex_soa.ptr();
+		const float *ys = xs + soa_count;
+		const float *zs = ys + soa_count;
+
+		float lane_min[4];
+		float lane_max[4];
+
+#if defined(__SSE2__)
+		__m128 nx = _mm_set1_ps(p_normal.x);
+		__m128 ny = _mm_set1_ps(p_normal.y);
+		__m128 nz = _mm_set1_ps(p_normal.z);
+		__m128 vmin = _mm_set1_ps(1e30f);
+		__m128 vmax = _mm_set1_ps(-1e30f);
+
+		for (int i = 0; i < soa_count; i += 4) {
+
+			__m128 d = _mm_mul_ps(_mm_loadu_ps(xs + i), nx);
+			d = _mm_add_ps(d, _mm_mul_ps(_mm_loadu_ps(ys + i), ny));
+			d = _mm_add_ps(d, _mm_mul_ps(_mm_loadu_ps(zs + i), nz));
+
+			vmin = _mm_min_ps(vmin, d);
+			vmax = _mm_max_ps(vmax, d);
+		}
+
+		_mm_storeu_ps(lane_min, vmin);
+		_mm_storeu_ps(lane_max, vmax);
+#else
+		float32x4_t nx = vdupq_n_f32(p_normal.x);
+		float32x4_t ny = vdupq_n_f32(p_normal.y);
+		float32x4_t nz = vdupq_n_f32(p_normal.z);
+		float32x4_t vmin = vdupq_n_f32(1e30f);
+		float32x4_t vmax = vdupq_n_f32(-1e30f);
+
+		for (int i = 0; i < soa_count; i += 4) {
+
+			float32x4_t d = vmulq_f32(vld1q_f32(xs + i), nx);
+			d = vmlaq_f32(d, vld1q_f32(ys + i), ny);
+			d = vmlaq_f32(d, vld1q_f32(zs + i), nz);
+
+			vmin = vminq_f32(vmin, d);
+			vmax = vmaxq_f32(vmax, d);
+		}
+
+		vst1q_f32(lane_min, vmin);
+		vst1q_f32(lane_max, vmax);
+#endif
+
+		r_min = lane_min[0];
+		r_max = lane_max[0];
+		for (int i = 1; i < 4; i++) {
+			r_min = MIN(r_min, lane_min[i]);
+			r_max = MAX(r_max, lane_max[i]);
+		}
 		return;
+	}
+#endif
 
 	const Vector3 *vrts = &mesh.vertices[0];
 
 	for (int i = 0; i < vertex_count; i++) {
 
-		real_t d = p_normal.dot(p_transform.xform(vrts[i]));
+		real_t d = p_normal.dot(vrts[i]);
 
 		if (i == 0 || d > r_max)
 			r_max = d;
@@ -730,30 +890,29 @@ void ConvexPolygonShapeSW::project_range(const Vector3 &p_normal, const Transfor
 	}
 }
 
-Vector3 ConvexPolygonShapeSW::get_support(const Vector3 &p_normal) const {
-
-	Vector3 n = p_normal;
-
-	int vert_support_idx = -1;
-	real_t support_max = 0;
+void ConvexPolygonShapeSW::project_range(const Vector3 &p_normal, const Transform &p_transform, real_t &r_min, real_t &r_max) const {
 
 	int vertex_count = mesh.vertices.size();
 	if (vertex_count == 0)
-		return Vector3();
+		return;
 
-	const Vector3 *vrts = &mesh.vertices[0];
+	//dot(n, T * v) == dot(basis^T * n, v) + dot(n, origin), so the whole range
+	//can be projected in local space without transforming every vertex
+	Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
+	real_t offset = p_normal.dot(p_transform.origin);
 
-	for (int i = 0; i < vertex_count; i++) {
+	_project_range_local(local_normal, r_min, r_max);
+	r_min += offset;
+	r_max += offset;
+}
 
-		real_t d = n.dot(vrts[i]);
+Vector3 ConvexPolygonShapeSW::get_support(const Vector3 &p_normal) const {
 
-		if (i == 0 || d > support_max) {
-			support_max = d;
-			vert_support_idx = i;
-		}
-	}
+	int vertex_count = mesh.vertices.size();
+	if (vertex_count == 0)
+		return Vector3();
 
-	return vrts[vert_support_idx];
+	return mesh.vertices[_support_index(p_normal)];
 }
 
 void ConvexPolygonShapeSW::get_supports(const Vector3 &p_normal, int p_max, Vector3 *r_supports, int &r_amount) const {
@@ -968,6 +1127,20 @@ void ConvexPolygonShapeSW::_setup(const Vector<Vector3> &p_vertices) {
 			_aabb.expand_to(mesh.vertices[i]);
 	}
 
+	int vc = mesh.vertices.size();
+	soa_count = (vc + 3) & ~3;
+	vertex_soa.resize(soa_count * 3);
+	if (vc > 0) {
+		float *w = vertex_soa.ptrw();
+		for (int i = 0; i < soa_count; i++) {
+			//pad by repeating the last vertex so the extra lanes never win
+			const Vector3 &v = mesh.vertices[MIN(i, vc - 1)];
+			w[i] = v.x;
+			w[soa_count + i] = v.y;
+			w[soa_count * 2 + i] = v.z;
+		}
+	}
+
 	configure(_aabb);
 }
 
@@ -982,6 +1155,8 @@ Variant ConvexPolygonShapeSW::get_data() const {
 }
 
 ConvexPolygonShapeSW::ConvexPolygonShapeSW() {
+
+	soa_count = 0;
 }
 
 /********** FACE POLYGON *************/
@@ -1380,9 +1555,11 @@ struct _VolumeSW_BVH {
 	int face_index;
 };
 
-_VolumeSW_BVH *_volume_sw_build_bvh(_VolumeSW_BVH_Element *p_elements, int p_size, int &count) {
+_VolumeSW_BVH *_volume_sw_build_bvh(_VolumeSW_BVH_Element *p_elements, int p_size, _VolumeSW_BVH *p_pool, int &count) {
 
-	_VolumeSW_BVH *bvh = memnew(_VolumeSW_BVH);
+	//nodes come from a preallocated pool (a tree over n leaves has at most
+	//2n - 1 nodes), so building does not hit the allocator per node
+	_VolumeSW_BVH *bvh = &p_pool[count++];
 
 	if (p_size == 1) {
 		//leaf
@@ -1390,7 +1567,6 @@ _VolumeSW_BVH *_volume_sw_build_bvh(_VolumeSW_BVH_Element *p_elements, int p_siz
 		bvh->left = NULL;
 		bvh->right = NULL;
 		bvh->face_index = p_elements->face_index;
-		count++;
 		return bvh;
 	} else {
 
@@ -1411,27 +1587,25 @@ _VolumeSW_BVH *_volume_sw_build_bvh(_VolumeSW_BVH_Element *p_elements, int p_siz
 		case 0: {
 
 			SortArray<_VolumeSW_BVH_Element, _VolumeSW_BVH_CompareX> sort_x;
-			sort_x.sort(p_elements, p_size);
+			sort_x.nth_element(0, p_size, p_size / 2, p_elements);
 
 		} break;
 		case 1: {
 
 			SortArray<_VolumeSW_BVH_Element, _VolumeSW_BVH_CompareY> sort_y;
-			sort_y.sort(p_elements, p_size);
+			sort_y.nth_element(0, p_size, p_size / 2, p_elements);
 		} break;
 		case 2: {
 
 			SortArray<_VolumeSW_BVH_Element, _VolumeSW_BVH_CompareZ> sort_z;
-			sort_z.sort(p_elements, p_size);
+			sort_z.nth_element(0, p_size, p_size / 2, p_elements);
 		} break;
 	}
 
 	int split = p_size / 2;
-	bvh->left = _volume_sw_build_bvh(p_elements, split, count);
-	bvh->right = _volume_sw_build_bvh(&p_elements[split], p_size - split, count);
+	bvh->left = _volume_sw_build_bvh(p_elements, split, p_pool, count);
+	bvh->right = _volume_sw_build_bvh(&p_elements[split], p_size - split, p_pool, count);
 
-	//printf("branch at %p - %i: %i\n",bvh,count,bvh->face_index);
-	count++;
 	return bvh;
 }
 
@@ -1460,8 +1634,6 @@ void ConcavePolygonShapeSW::_fill_bvh(_VolumeSW_BVH *p_bvh_tree, BVH *p_bvh_arra
 
 		p_bvh_array[p_idx].right = -1;
 	}
-
-	memdelete(p_bvh_tree);
 }
 
 void ConcavePolygonShapeSW::_setup(PoolVector<Vector3> p_faces) {
@@ -1518,7 +1690,9 @@ void ConcavePolygonShapeSW::_setup(PoolVector<Vector3> p_faces) {
 	vw.release();
 
 	int count = 0;
-	_VolumeSW_BVH *bvh_tree = _volume_sw_build_bvh(bvh_arrayw, src_face_count, count);
+	Vector<_VolumeSW_BVH> bvh_pool;
+	bvh_pool.resize(src_face_count * 2 - 1);
+	_VolumeSW_BVH *bvh_tree = _volume_sw_build_bvh(bvh_arrayw, src_face_count, bvh_pool.ptrw(), count);
 
 	bvh.resize(count + 1);
 
@@ -1575,8 +1749,96 @@ Vector3 HeightMapShapeSW::get_support(const Vector3 &p_normal) const {
 	return get_aabb().get_support(p_normal);
 }
 
+void HeightMapShapeSW::_get_cell_verts(const real_t *p_heights, int p_x, int p_z, Vector3 *r_verts) const {
+
+	r_verts[0] = Vector3(p_x * cell_size, p_heights[p_z * width + p_x], p_z * cell_size); //00
+	r_verts[1] = Vector3((p_x + 1) * cell_size, p_heights[p_z * width + p_x + 1], p_z * cell_size); //10
+	r_verts[2] = Vector3(p_x * cell_size, p_heights[(p_z + 1) * width + p_x], (p_z + 1) * cell_size); //01
+	r_verts[3] = Vector3((p_x + 1) * cell_size, p_heights[(p_z + 1) * width + p_x + 1], (p_z + 1) * cell_size); //11
+}
+
+bool HeightMapShapeSW::_intersect_cell_segment(const real_t *p_heights, int p_x, int p_z, const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal) const {
+
+	Vector3 v[4];
+	_get_cell_verts(p_heights, p_x, p_z, v);
+
+	Vector3 dir = (p_end - p_begin).normalized();
+
+	bool found = false;
+	real_t min_d = 1e20;
+
+	Vector3 res;
+	if (Geometry::segment_intersects_triangle(p_begin, p_end, v[0], v[3], v[1], &res)) {
+		found = true;
+		min_d = dir.dot(res - p_begin);
+		r_point = res;
+		r_normal = Plane(v[0], v[3], v[1]).normal;
+	}
+	if (Geometry::segment_intersects_triangle(p_begin, p_end, v[0], v[2], v[3], &res)) {
+		real_t d = dir.dot(res - p_begin);
+		if (!found || d < min_d) {
+			found = true;
+			r_point = res;
+			r_normal = Plane(v[0], v[2], v[3]).normal;
+		}
+	}
+
+	return found;
+}
+
 bool HeightMapShapeSW::intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal) const {
 
+	if (heights.size() == 0 || width < 2 || depth < 2)
+		return false;
+
+	//find where the segment enters the shape, so the cell walk can start there
+	Vector3 enter = p_begin;
+	if (!get_aabb().has_point(p_begin)) {
+		if (!get_aabb().intersects_segment(p_begin, p_end, &enter))
+			return false;
+	}
+
+	PoolVector<real_t>::Read r = heights.read();
+
+	//walk the cell grid in ray order (2D DDA over x/z), so the first cell
+	//that reports a hit holds the nearest triangle and the walk can stop
+	Vector3 rel = p_end - p_begin;
+
+	int x = CLAMP(int(Math::floor(enter.x / cell_size)), 0, width - 2);
+	int z = CLAMP(int(Math::floor(enter.z / cell_size)), 0, depth - 2);
+
+	int x_step = (rel.x > 0) ? 1 : ((rel.x < 0) ? -1 : 0);
+	int z_step = (rel.z > 0) ? 1 : ((rel.z < 0) ? -1 : 0);
+
+	real_t t_delta_x = x_step != 0 ? cell_size / Math::abs(rel.x) : 1e20;
+	real_t t_delta_z = z_step != 0 ? cell_size / Math::abs(rel.z) : 1e20;
+
+	real_t t_cross_x = x_step != 0 ? ((x + (x_step > 0 ? 1 : 0)) * cell_size - p_begin.x) / rel.x : 1e20;
+	real_t t_cross_z = z_step != 0 ? ((z + (z_step > 0 ? 1 : 0)) * cell_size - p_begin.z) / rel.z : 1e20;
+
+	while (true) {
+
+		if (_intersect_cell_segment(r.ptr(), x, z, p_begin, p_end, r_point, r_normal)) {
+			return true;
+		}
+
+		if (t_cross_x < t_cross_z) {
+			if (t_cross_x > 1.0)
+				break;
+			x += x_step;
+			if (x < 0 || x >= width - 1)
+				break;
+			t_cross_x += t_delta_x;
+		} else {
+			if (t_cross_z > 1.0)
+				break;
+			z += z_step;
+			if (z < 0 || z >= depth - 1)
+				break;
+			t_cross_z += t_delta_z;
+		}
+	}
+
 	return false;
 }
 
@@ -1586,10 +1848,75 @@ bool HeightMapShapeSW::intersect_point(const Vector3 &p_point) const {
 
 Vector3 HeightMapShapeSW::get_closest_point_to(const Vector3 &p_point) const {
 
-	return Vector3();
+	if (heights.size() == 0 || width < 2 || depth < 2)
+		return Vector3();
+
+	//approximation: clamp to the grid and sample the surface below/above
+	real_t x = CLAMP(p_point.x / cell_size, 0, width - 1);
+	real_t z = CLAMP(p_point.z / cell_size, 0, depth - 1);
+
+	int x0 = MIN(int(x), width - 2);
+	int z0 = MIN(int(z), depth - 2);
+	real_t xf = x - x0;
+	real_t zf = z - z0;
+
+	PoolVector<real_t>::Read r = heights.read();
+
+	real_t h00 = r[z0 * width + x0];
+	real_t h10 = r[z0 * width + x0 + 1];
+	real_t h01 = r[(z0 + 1) * width + x0];
+	real_t h11 = r[(z0 + 1) * width + x0 + 1];
+
+	real_t h = h00 + (h10 - h00) * xf + (h01 - h00) * zf + (h00 - h10 - h01 + h11) * xf * zf;
+
+	return Vector3(x * cell_size, h, z * cell_size);
 }
 
 void HeightMapShapeSW::cull(const AABB &p_local_aabb, Callback p_callback, void *p_userdata) const {
+
+	if (heights.size() == 0 || width < 2 || depth < 2)
+		return;
+
+	//direct cell lookup, only cells under the query AABB are touched; no
+	//face BVH is needed because the grid itself is the spatial index
+	int x_from = CLAMP(int(Math::floor(p_local_aabb.position.x / cell_size)), 0, width - 2);
+	int x_to = CLAMP(int(Math::ceil((p_local_aabb.position.x + p_local_aabb.size.x) / cell_size)), x_from + 1, width - 1);
+	int z_from = CLAMP(int(Math::floor(p_local_aabb.position.z / cell_size)), 0, depth - 2);
+	int z_to = CLAMP(int(Math::ceil((p_local_aabb.position.z + p_local_aabb.size.z) / cell_size)), z_from + 1, depth - 1);
+
+	real_t y_from = p_local_aabb.position.y;
+	real_t y_to = y_from + p_local_aabb.size.y;
+
+	PoolVector<real_t>::Read r = heights.read();
+
+	FaceShapeSW face; // use this to send in the callback
+
+	for (int z = z_from; z < z_to; z++) {
+
+		for (int x = x_from; x < x_to; x++) {
+
+			Vector3 v[4];
+			_get_cell_verts(r.ptr(), x, z, v);
+
+			real_t h_min = MIN(MIN(v[0].y, v[1].y), MIN(v[2].y, v[3].y));
+			real_t h_max = MAX(MAX(v[0].y, v[1].y), MAX(v[2].y, v[3].y));
+
+			if (h_max < y_from || h_min > y_to)
+				continue;
+
+			face.vertex[0] = v[0];
+			face.vertex[1] = v[3];
+			face.vertex[2] = v[1];
+			face.normal = Plane(v[0], v[3], v[1]).normal;
+			p_callback(p_userdata, &face);
+
+			face.vertex[0] = v[0];
+			face.vertex[1] = v[2];
+			face.vertex[2] = v[3];
+			face.normal = Plane(v[0], v[2], v[3]).normal;
+			p_callback(p_userdata, &face);
+		}
+	}
 }
 
 Vector3 HeightMapShapeSW::get_moment_of_inertia(real_t p_mass) const {
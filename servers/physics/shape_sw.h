@@ -263,7 +263,14 @@ struct ConvexPolygonShapeSW : public ShapeSW {
 
 	Geometry::MeshData mesh;
 
+	//vertices again as separate x/y/z arrays, each padded to a multiple of 4,
+	//so support queries can scan them four lanes at a time
+	Vector<float> vertex_soa;
+	int soa_count;
+
 	void _setup(const Vector<Vector3> &p_vertices);
+	int _support_index(const Vector3 &p_normal) const;
+	void _project_range_local(const Vector3 &p_normal, real_t &r_min, real_t &r_max) const;
 
 public:
 	const Geometry::MeshData &get_mesh() const { return mesh; }
@@ -373,8 +380,8 @@ struct HeightMapShapeSW : public ConcaveShapeSW {
 	int depth;
 	real_t cell_size;
 
-	//void _cull_segment(int p_idx,_SegmentCullParams *p_params) const;
-	//void _cull(int p_idx,_CullParams *p_params) const;
+	void _get_cell_verts(const real_t *p_heights, int p_x, int p_z, Vector3 *r_verts) const;
+	bool _intersect_cell_segment(const real_t *p_heights, int p_x, int p_z, const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal) const;
 
 	void _setup(PoolVector<real_t> p_heights, int p_width, int p_depth, real_t p_cell_size);
 
@@ -31,7 +31,9 @@
 #include "space_sw.h"
 
 #include "collision_solver_sw.h"
+#include "core/os/worker_thread_pool.h"
 #include "core/project_settings.h"
+#include "core/sort_array.h"
 #include "physics_server_sw.h"
 
 _FORCE_INLINE_ static bool _can_collide_with(CollisionObjectSW *p_object, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) {
@@ -97,13 +99,18 @@ bool PhysicsDirectSpaceStateSW::intersect_ray(const Vector3 &p_from, const Vecto
 
 	ERR_FAIL_COND_V(space->locked, false);
 
+	return _intersect_ray_internal(p_from, p_to, r_result, p_exclude, p_collision_mask, p_collide_with_bodies, p_collide_with_areas, p_pick_ray, space->intersection_query_results, space->intersection_query_subindex_results);
+}
+
+bool PhysicsDirectSpaceStateSW::_intersect_ray_internal(const Vector3 &p_from, const Vector3 &p_to, RayResult &r_result, const Set<RID> &p_exclude, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas, bool p_pick_ray, CollisionObjectSW **p_query_results, int *p_query_subindex_results) {
+
 	Vector3 begin, end;
 	Vector3 normal;
 	begin = p_from;
 	end = p_to;
 	normal = (end - begin).normalized();
 
-	int amount = space->broadphase->cull_segment(begin, end, space->intersection_query_results, SpaceSW::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	int amount = space->broadphase->cull_segment(begin, end, p_query_results, SpaceSW::INTERSECTION_QUERY_MAX, p_query_subindex_results);
 
 	//todo, create another array that references results, compute AABBs and check closest point to ray origin, sort, and stop evaluating results when beyond first collision
 
@@ -115,18 +122,18 @@ bool PhysicsDirectSpaceStateSW::intersect_ray(const Vector3 &p_from, const Vecto
 
 	for (int i = 0; i < amount; i++) {
 
-		if (!_can_collide_with(space->intersection_query_results[i], p_collision_mask, p_collide_with_bodies, p_collide_with_areas))
+		if (!_can_collide_with(p_query_results[i], p_collision_mask, p_collide_with_bodies, p_collide_with_areas))
 			continue;
 
-		if (p_pick_ray && !(space->intersection_query_results[i]->is_ray_pickable()))
+		if (p_pick_ray && !(p_query_results[i]->is_ray_pickable()))
 			continue;
 
-		if (p_exclude.has(space->intersection_query_results[i]->get_self()))
+		if (p_exclude.has(p_query_results[i]->get_self()))
 			continue;
 
-		const CollisionObjectSW *col_obj = space->intersection_query_results[i];
+		const CollisionObjectSW *col_obj = p_query_results[i];
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = p_query_subindex_results[i];
 		Transform inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
 
 		Vector3 local_from = inv_xform.xform(begin);
@@ -171,6 +178,122 @@ bool PhysicsDirectSpaceStateSW::intersect_ray(const Vector3 &p_from, const Vecto
 	return true;
 }
 
+struct PhysicsDirectSpaceStateSW::RayBatchData {
+
+	PhysicsDirectSpaceStateSW *state;
+	const Vector3 *from;
+	const Vector3 *to;
+	PhysicsDirectSpaceState::RayResult *results;
+	bool *collided;
+	const int *order;
+	int ray_count;
+	int chunk_size;
+	const Set<RID> *exclude;
+	const Set<RID> *const *ray_excludes;
+	uint32_t collision_mask;
+	bool collide_with_bodies;
+	bool collide_with_areas;
+};
+
+void PhysicsDirectSpaceStateSW::_intersect_ray_batch_task(void *p_userdata, uint32_t p_index) {
+
+	RayBatchData *data = (RayBatchData *)p_userdata;
+
+	//each chunk owns its candidate buffers, the shared space scratch can't be
+	//used from several threads
+	CollisionObjectSW **query_results = memnew_arr(CollisionObjectSW *, SpaceSW::INTERSECTION_QUERY_MAX);
+	int *query_subindex_results = memnew_arr(int, SpaceSW::INTERSECTION_QUERY_MAX);
+
+	int from = p_index * data->chunk_size;
+	int to = MIN(from + data->chunk_size, data->ray_count);
+
+	for (int i = from; i < to; i++) {
+
+		int ray = data->order[i];
+		data->collided[ray] = data->state->_intersect_ray_internal(data->from[ray], data->to[ray], data->results[ray], data->ray_excludes ? *data->ray_excludes[ray] : *data->exclude, data->collision_mask, data->collide_with_bodies, data->collide_with_areas, false, query_results, query_subindex_results);
+	}
+
+	memdelete_arr(query_results);
+	memdelete_arr(query_subindex_results);
+}
+
+struct _RayBatchSort {
+
+	const Vector3 *from;
+
+	//group rays by origin cell so consecutive rays enter the broadphase in
+	//nearby places and reuse the same nodes while they are hot
+	bool operator()(int p_a, int p_b) const {
+
+		const Vector3 &a = from[p_a];
+		const Vector3 &b = from[p_b];
+
+		int ca[3] = { int(Math::floor(a.x * 0.125)), int(Math::floor(a.y * 0.125)), int(Math::floor(a.z * 0.125)) };
+		int cb[3] = { int(Math::floor(b.x * 0.125)), int(Math::floor(b.y * 0.125)), int(Math::floor(b.z * 0.125)) };
+
+		for (int i = 0; i < 3; i++) {
+			if (ca[i] != cb[i])
+				return ca[i] < cb[i];
+		}
+
+		return p_a < p_b;
+	}
+};
+
+void PhysicsDirectSpaceStateSW::intersect_ray_batch(const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, bool *r_collided, const Set<RID> &p_exclude, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas, const Set<RID> *const *p_ray_excludes) {
+
+	ERR_FAIL_COND(space->locked);
+
+	if (p_ray_count <= 0)
+		return;
+
+	Vector<int> order;
+	order.resize(p_ray_count);
+	int *order_ptr = order.ptrw();
+	for (int i = 0; i < p_ray_count; i++) {
+		order_ptr[i] = i;
+	}
+
+	_RayBatchSort compare;
+	compare.from = p_from;
+	SortArray<int, _RayBatchSort> sorter;
+	sorter.compare = compare;
+	sorter.sort(order_ptr, p_ray_count);
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	bool use_threads = p_ray_count >= 64 && space->broadphase->supports_concurrent_queries() && pool && pool->get_thread_count() > 0;
+
+	if (use_threads) {
+
+		int chunks = MIN(pool->get_thread_count() + 1, (p_ray_count + 63) / 64);
+
+		RayBatchData data;
+		data.state = this;
+		data.from = p_from;
+		data.to = p_to;
+		data.results = r_results;
+		data.collided = r_collided;
+		data.order = order_ptr;
+		data.ray_count = p_ray_count;
+		data.chunk_size = (p_ray_count + chunks - 1) / chunks;
+		data.exclude = &p_exclude;
+		data.ray_excludes = p_ray_excludes;
+		data.collision_mask = p_collision_mask;
+		data.collide_with_bodies = p_collide_with_bodies;
+		data.collide_with_areas = p_collide_with_areas;
+
+		WorkerThreadPool::GroupID group = pool->add_group_task(_intersect_ray_batch_task, &data, chunks);
+		pool->wait_for_group_task_completion(group);
+	} else {
+
+		for (int i = 0; i < p_ray_count; i++) {
+
+			int ray = order_ptr[i];
+			r_collided[ray] = _intersect_ray_internal(p_from[ray], p_to[ray], r_results[ray], p_ray_excludes ? *p_ray_excludes[ray] : p_exclude, p_collision_mask, p_collide_with_bodies, p_collide_with_areas, false, space->intersection_query_results, space->intersection_query_subindex_results);
+		}
+	}
+}
+
 int PhysicsDirectSpaceStateSW::intersect_shape(const RID &p_shape, const Transform &p_xform, real_t p_margin, ShapeResult *r_results, int p_result_max, const Set<RID> &p_exclude, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) {
 
 	if (p_result_max <= 0)
@@ -506,9 +629,9 @@ PhysicsDirectSpaceStateSW::PhysicsDirectSpaceStateSW() {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-int SpaceSW::_cull_aabb_for_body(BodySW *p_body, const AABB &p_aabb) {
+int SpaceSW::_filter_cull_results_for_body(BodySW *p_body, const AABB &p_aabb, int p_amount) {
 
-	int amount = broadphase->cull_aabb(p_aabb, intersection_query_results, INTERSECTION_QUERY_MAX, intersection_query_subindex_results);
+	int amount = p_amount;
 
 	for (int i = 0; i < amount; i++) {
 
@@ -516,6 +639,8 @@ int SpaceSW::_cull_aabb_for_body(BodySW *p_body, const AABB &p_aabb) {
 
 		if (intersection_query_results[i] == p_body)
 			keep = false;
+		else if (!p_aabb.intersects(intersection_query_results[i]->get_shape_aabb(intersection_query_subindex_results[i])))
+			keep = false;
 		else if (intersection_query_results[i]->get_type() == CollisionObjectSW::TYPE_AREA)
 			keep = false;
 		else if ((static_cast<BodySW *>(intersection_query_results[i])->test_collision_mask(p_body)) == 0)
@@ -540,6 +665,55 @@ int SpaceSW::_cull_aabb_for_body(BodySW *p_body, const AABB &p_aabb) {
 	return amount;
 }
 
+int SpaceSW::_cull_aabb_for_body(BodySW *p_body, const AABB &p_aabb) {
+
+	int amount = broadphase->cull_aabb(p_aabb, intersection_query_results, INTERSECTION_QUERY_MAX, intersection_query_subindex_results);
+
+	return _filter_cull_results_for_body(p_body, p_aabb, amount);
+}
+
+int SpaceSW::_cull_aabb_for_body_cached(BodySW *p_body, const AABB &p_aabb) {
+
+	BodySW::MotionQueryCache &cache = p_body->get_motion_query_cache();
+
+	// Everything that happened in the broadphase minus this body's own
+	// updates; while it holds steady, the surroundings didn't change.
+	const uint64_t version = broadphase_change_version - p_body->get_broadphase_self_version();
+
+	int amount;
+
+	if (cache.amount < 0 || cache.version != version || !cache.aabb.encloses(p_aabb)) {
+
+		amount = broadphase->cull_aabb(p_aabb, intersection_query_results, INTERSECTION_QUERY_MAX, intersection_query_subindex_results);
+
+		cache.aabb = p_aabb;
+		cache.version = version;
+		cache.amount = amount;
+		cache.results.resize(amount);
+		cache.subindices.resize(amount);
+		CollisionObjectSW **results = cache.results.ptrw();
+		int *subindices = cache.subindices.ptrw();
+		for (int i = 0; i < amount; i++) {
+			results[i] = intersection_query_results[i];
+			subindices[i] = intersection_query_subindex_results[i];
+		}
+	} else {
+
+		amount = cache.amount;
+		CollisionObjectSW *const *results = cache.results.ptr();
+		const int *subindices = cache.subindices.ptr();
+		for (int i = 0; i < amount; i++) {
+			intersection_query_results[i] = results[i];
+			intersection_query_subindex_results[i] = subindices[i];
+		}
+	}
+
+	// Filter on every call; masks, exceptions and disabled shapes can change
+	// without touching the broadphase, and the cached cull may cover a wider
+	// AABB than this query.
+	return _filter_cull_results_for_body(p_body, p_aabb, amount);
+}
+
 int SpaceSW::test_body_ray_separation(BodySW *p_body, const Transform &p_transform, bool p_infinite_inertia, Vector3 &r_recover_motion, PhysicsServer::SeparationResult *r_results, int p_result_max, real_t p_margin) {
 
 	AABB body_aabb;
@@ -739,6 +913,15 @@ bool SpaceSW::test_body_motion(BodySW *p_body, const Transform &p_from, const Ve
 
 	Transform body_transform = p_from;
 
+	{
+		// Prime the per-body cached cull with the whole motion's AABB, so the
+		// recover, advance and rest steps below share one broadphase traversal.
+		AABB motion_aabb = body_aabb;
+		motion_aabb.position += p_motion;
+		motion_aabb = motion_aabb.merge(body_aabb);
+		_cull_aabb_for_body_cached(p_body, motion_aabb);
+	}
+
 	{
 		//STEP 1, FREE BODY IF STUCK
 
@@ -758,7 +941,7 @@ bool SpaceSW::test_body_motion(BodySW *p_body, const Transform &p_from, const Ve
 
 			bool collided = false;
 
-			int amount = _cull_aabb_for_body(p_body, body_aabb);
+			int amount = _cull_aabb_for_body_cached(p_body, body_aabb);
 
 			for (int j = 0; j < p_body->get_shape_count(); j++) {
 				if (p_body->is_shape_set_as_disabled(j))
@@ -818,7 +1001,7 @@ bool SpaceSW::test_body_motion(BodySW *p_body, const Transform &p_from, const Ve
 		motion_aabb.position += p_motion;
 		motion_aabb = motion_aabb.merge(body_aabb);
 
-		int amount = _cull_aabb_for_body(p_body, motion_aabb);
+		int amount = _cull_aabb_for_body_cached(p_body, motion_aabb);
 
 		for (int j = 0; j < p_body->get_shape_count(); j++) {
 
@@ -944,7 +1127,7 @@ bool SpaceSW::test_body_motion(BodySW *p_body, const Transform &p_from, const Ve
 
 		body_aabb.position += p_motion * unsafe;
 
-		int amount = _cull_aabb_for_body(p_body, body_aabb);
+		int amount = _cull_aabb_for_body_cached(p_body, body_aabb);
 
 		for (int i = 0; i < amount; i++) {
 
@@ -1009,6 +1192,7 @@ void *SpaceSW::_broadphase_pair(CollisionObjectSW *A, int p_subindex_A, Collisio
 	SpaceSW *self = (SpaceSW *)p_self;
 
 	self->collision_pairs++;
+	self->bump_broadphase_version();
 
 	if (type_A == CollisionObjectSW::TYPE_AREA) {
 
@@ -1037,6 +1221,7 @@ void SpaceSW::_broadphase_unpair(CollisionObjectSW *A, int p_subindex_A, Collisi
 
 	SpaceSW *self = (SpaceSW *)p_self;
 	self->collision_pairs--;
+	self->bump_broadphase_version();
 	ConstraintSW *c = (ConstraintSW *)p_data;
 	memdelete(c);
 }
@@ -1073,12 +1258,14 @@ void SpaceSW::add_object(CollisionObjectSW *p_object) {
 
 	ERR_FAIL_COND(objects.has(p_object));
 	objects.insert(p_object);
+	bump_broadphase_version();
 }
 
 void SpaceSW::remove_object(CollisionObjectSW *p_object) {
 
 	ERR_FAIL_COND(!objects.has(p_object));
 	objects.erase(p_object);
+	bump_broadphase_version();
 }
 
 const Set<CollisionObjectSW *> &SpaceSW::get_objects() const {
@@ -1209,6 +1396,7 @@ SpaceSW::SpaceSW() {
 	active_objects = 0;
 	island_count = 0;
 	contact_debug_count = 0;
+	broadphase_change_version = 0;
 
 	locked = false;
 	contact_recycle_radius = 0.01;
@@ -45,11 +45,17 @@ class PhysicsDirectSpaceStateSW : public PhysicsDirectSpaceState {
 
 	GDCLASS(PhysicsDirectSpaceStateSW, PhysicsDirectSpaceState);
 
+	struct RayBatchData;
+
+	bool _intersect_ray_internal(const Vector3 &p_from, const Vector3 &p_to, RayResult &r_result, const Set<RID> &p_exclude, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas, bool p_pick_ray, CollisionObjectSW **p_query_results, int *p_query_subindex_results);
+	static void _intersect_ray_batch_task(void *p_userdata, uint32_t p_index);
+
 public:
 	SpaceSW *space;
 
 	virtual int intersect_point(const Vector3 &p_point, ShapeResult *r_results, int p_result_max, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false);
 	virtual bool intersect_ray(const Vector3 &p_from, const Vector3 &p_to, RayResult &r_result, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false, bool p_pick_ray = false);
+	virtual void intersect_ray_batch(const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, bool *r_collided, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false, const Set<RID> *const *p_ray_excludes = NULL);
 	virtual int intersect_shape(const RID &p_shape, const Transform &p_xform, real_t p_margin, ShapeResult *r_results, int p_result_max, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false);
 	virtual bool cast_motion(const RID &p_shape, const Transform &p_xform, const Vector3 &p_motion, real_t p_margin, real_t &p_closest_safe, real_t &p_closest_unsafe, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false, ShapeRestInfo *r_info = NULL);
 	virtual bool collide_shape(RID p_shape, const Transform &p_shape_xform, real_t p_margin, Vector3 *r_results, int p_result_max, int &r_result_count, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false);
@@ -68,6 +74,7 @@ public:
 		ELAPSED_TIME_SETUP_CONSTRAINTS,
 		ELAPSED_TIME_SOLVE_CONSTRAINTS,
 		ELAPSED_TIME_INTEGRATE_VELOCITIES,
+		ELAPSED_TIME_BROADPHASE,
 		ELAPSED_TIME_MAX
 
 	};
@@ -124,9 +131,18 @@ private:
 
 	friend class PhysicsDirectSpaceStateSW;
 
+	// Bumped whenever anything (un)pairs, moves or (un)registers in the
+	// broadphase; lets per-body query caches tell if the surroundings changed.
+	uint64_t broadphase_change_version;
+
 	int _cull_aabb_for_body(BodySW *p_body, const AABB &p_aabb);
+	int _cull_aabb_for_body_cached(BodySW *p_body, const AABB &p_aabb);
+	int _filter_cull_results_for_body(BodySW *p_body, const AABB &p_aabb, int p_amount);
 
 public:
+	_FORCE_INLINE_ void bump_broadphase_version() { broadphase_change_version++; }
+	_FORCE_INLINE_ uint64_t get_broadphase_version() const { return broadphase_change_version; }
+
 	_FORCE_INLINE_ void set_self(const RID &p_self) { self = p_self; }
 	_FORCE_INLINE_ RID get_self() const { return self; }
 
@@ -31,7 +31,12 @@
 #include "step_sw.h"
 #include "joints_sw.h"
 
+#include "core/safe_refcount.h"
+
 #include "core/os/os.h"
+#include "core/os/worker_thread_pool.h"
+#include "core/project_settings.h"
+#include "core/tracepoints.h"
 
 void StepSW::_populate_island(BodySW *p_body, BodySW **p_island, ConstraintSW **p_constraint_island) {
 
@@ -107,6 +112,12 @@ void StepSW::_solve_island(ConstraintSW *p_island, int p_iterations, real_t p_de
 	}
 }
 
+void StepSW::_solve_island_task(void *p_userdata, uint32_t p_index) {
+
+	StepSW *step = (StepSW *)p_userdata;
+	step->_solve_island(step->island_array[p_index], step->island_iterations, step->island_delta);
+}
+
 void StepSW::_check_suspend(BodySW *p_island, real_t p_delta) {
 
 	bool can_sleep = true;
@@ -146,6 +157,12 @@ void StepSW::_check_suspend(BodySW *p_island, real_t p_delta) {
 
 void StepSW::step(SpaceSW *p_space, real_t p_delta, int p_iterations) {
 
+	TRACE_SCOPE("physics_space_step");
+
+	// Claim a globally unique step number; multiple steppers may run
+	// different spaces in parallel.
+	_step = atomic_increment(&next_step);
+
 	p_space->lock(); // can't access space during this
 
 	p_space->setup(); //update inertias, etc
@@ -247,7 +264,24 @@ void StepSW::step(SpaceSW *p_space, real_t p_delta, int p_iterations) {
 
 	/* SOLVE CONSTRAINT ISLANDS */
 
-	{
+	bool use_threads = threaded_islands && island_count > 1 && WorkerThreadPool::get_singleton() && WorkerThreadPool::get_singleton()->get_thread_count() > 0;
+
+	if (use_threads) {
+		//islands share no dynamic body by construction, so each one can
+		//solve on its own thread with bit-identical results regardless of
+		//scheduling order
+		island_array.clear();
+		ConstraintSW *ci = constraint_island_list;
+		while (ci) {
+			island_array.push_back(ci);
+			ci = ci->get_island_list_next();
+		}
+		island_delta = p_delta;
+		island_iterations = p_iterations;
+
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_group_task(_solve_island_task, this, island_array.size());
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	} else {
 		ConstraintSW *ci = constraint_island_list;
 		while (ci) {
 			//iterating each island separatedly improves cache efficiency
@@ -289,11 +323,22 @@ void StepSW::step(SpaceSW *p_space, real_t p_delta, int p_iterations) {
 	}
 
 	p_space->update();
+
+	{ //profile
+		profile_endtime = OS::get_singleton()->get_ticks_usec();
+		p_space->set_elapsed_time(SpaceSW::ELAPSED_TIME_BROADPHASE, profile_endtime - profile_begtime);
+	}
+
 	p_space->unlock();
-	_step++;
 }
 
+volatile uint64_t StepSW::next_step = 0;
+
 StepSW::StepSW() {
 
-	_step = 1;
+	_step = 0;
+
+	threaded_islands = GLOBAL_DEF("physics/3d/threaded_island_solving", true);
+	island_delta = 0;
+	island_iterations = 0;
 }
@@ -36,12 +36,20 @@
 class StepSW {
 
 	uint64_t _step;
+	static volatile uint64_t next_step; // Shared by all steppers, so island marks never collide across spaces.
+
+	bool threaded_islands;
+	Vector<ConstraintSW *> island_array;
+	real_t island_delta;
+	int island_iterations;
 
 	void _populate_island(BodySW *p_body, BodySW **p_island, ConstraintSW **p_constraint_island);
 	void _setup_island(ConstraintSW *p_island, real_t p_delta);
 	void _solve_island(ConstraintSW *p_island, int p_iterations, real_t p_delta);
 	void _check_suspend(BodySW *p_island, real_t p_delta);
 
+	static void _solve_island_task(void *p_userdata, uint32_t p_index);
+
 public:
 	void step(SpaceSW *p_space, real_t p_delta, int p_iterations);
 	StepSW();
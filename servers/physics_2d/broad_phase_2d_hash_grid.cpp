@@ -97,89 +97,180 @@ void BroadPhase2DHashGrid::_check_motion(Element *p_elem) {
 	}
 }
 
-void BroadPhase2DHashGrid::_enter_grid(Element *p_elem, const Rect2 &p_rect, bool p_static) {
+bool BroadPhase2DHashGrid::_is_large(const Rect2 &p_rect) const {
 
 	Vector2 sz = (p_rect.size / cell_size * LARGE_ELEMENT_FI); //use magic number to avoid floating point issues
-	if (sz.width * sz.height > large_object_min_surface) {
-		//large object, do not use grid, must check against all elements
-		for (Map<ID, Element>::Element *E = element_map.front(); E; E = E->next()) {
-			if (E->key() == p_elem->self)
-				continue; // do not pair against itself
-			if (E->get().owner == p_elem->owner)
-				continue;
-			if (E->get()._static && p_static)
-				continue;
+	return sz.width * sz.height > large_object_min_surface;
+}
 
-			_pair_attempt(p_elem, &E->get());
+void BroadPhase2DHashGrid::_enter_grid_cell(int p_x, int p_y, Element *p_elem, bool p_static) {
+
+	PosKey pk;
+	pk.x = p_x;
+	pk.y = p_y;
+
+	uint32_t idx = pk.hash() % hash_table_size;
+	PosBin *pb = hash_table[idx];
+
+	while (pb) {
+
+		if (pb->key == pk) {
+			break;
 		}
 
-		large_elements[p_elem].inc();
-		return;
+		pb = pb->next;
 	}
 
-	Point2i from = (p_rect.position / cell_size).floor();
-	Point2i to = ((p_rect.position + p_rect.size) / cell_size).floor();
+	bool entered = false;
 
-	for (int i = from.x; i <= to.x; i++) {
+	if (!pb) {
+		//does not exist, create!
+		pb = memnew(PosBin);
+		pb->key = pk;
+		pb->next = hash_table[idx];
+		hash_table[idx] = pb;
+	}
 
-		for (int j = from.y; j <= to.y; j++) {
+	if (p_static) {
+		if (pb->static_object_set[p_elem].inc() == 1) {
+			entered = true;
+		}
+	} else {
+		if (pb->object_set[p_elem].inc() == 1) {
 
-			PosKey pk;
-			pk.x = i;
-			pk.y = j;
+			entered = true;
+		}
+	}
 
-			uint32_t idx = pk.hash() % hash_table_size;
-			PosBin *pb = hash_table[idx];
+	if (entered) {
 
-			while (pb) {
+		for (Map<Element *, RC>::Element *E = pb->object_set.front(); E; E = E->next()) {
 
-				if (pb->key == pk) {
-					break;
-				}
+			if (E->key()->owner == p_elem->owner)
+				continue;
+			_pair_attempt(p_elem, E->key());
+		}
 
-				pb = pb->next;
+		if (!p_static) {
+
+			for (Map<Element *, RC>::Element *E = pb->static_object_set.front(); E; E = E->next()) {
+
+				if (E->key()->owner == p_elem->owner)
+					continue;
+				_pair_attempt(p_elem, E->key());
 			}
+		}
+	}
+}
 
-			bool entered = false;
+void BroadPhase2DHashGrid::_exit_grid_cell(int p_x, int p_y, Element *p_elem, bool p_static) {
 
-			if (!pb) {
-				//does not exist, create!
-				pb = memnew(PosBin);
-				pb->key = pk;
-				pb->next = hash_table[idx];
-				hash_table[idx] = pb;
+	PosKey pk;
+	pk.x = p_x;
+	pk.y = p_y;
+
+	uint32_t idx = pk.hash() % hash_table_size;
+	PosBin *pb = hash_table[idx];
+
+	while (pb) {
+
+		if (pb->key == pk) {
+			break;
+		}
+
+		pb = pb->next;
+	}
+
+	ERR_FAIL_COND(!pb); //should exist!!
+
+	bool exited = false;
+
+	if (p_static) {
+		if (pb->static_object_set[p_elem].dec() == 0) {
+
+			pb->static_object_set.erase(p_elem);
+			exited = true;
+		}
+	} else {
+		if (pb->object_set[p_elem].dec() == 0) {
+
+			pb->object_set.erase(p_elem);
+			exited = true;
+		}
+	}
+
+	if (exited) {
+
+		for (Map<Element *, RC>::Element *E = pb->object_set.front(); E; E = E->next()) {
+
+			if (E->key()->owner == p_elem->owner)
+				continue;
+			_unpair_attempt(p_elem, E->key());
+		}
+
+		if (!p_static) {
+
+			for (Map<Element *, RC>::Element *E = pb->static_object_set.front(); E; E = E->next()) {
+
+				if (E->key()->owner == p_elem->owner)
+					continue;
+				_unpair_attempt(p_elem, E->key());
 			}
+		}
+	}
 
-			if (p_static) {
-				if (pb->static_object_set[p_elem].inc() == 1) {
-					entered = true;
-				}
-			} else {
-				if (pb->object_set[p_elem].inc() == 1) {
+	if (pb->object_set.empty() && pb->static_object_set.empty()) {
+
+		if (hash_table[idx] == pb) {
+			hash_table[idx] = pb->next;
+		} else {
 
-					entered = true;
+			PosBin *px = hash_table[idx];
+
+			while (px) {
+
+				if (px->next == pb) {
+					px->next = pb->next;
+					break;
 				}
+
+				px = px->next;
 			}
 
-			if (entered) {
+			ERR_FAIL_COND(!px);
+		}
 
-				for (Map<Element *, RC>::Element *E = pb->object_set.front(); E; E = E->next()) {
+		memdelete(pb);
+	}
+}
 
-					if (E->key()->owner == p_elem->owner)
-						continue;
-					_pair_attempt(p_elem, E->key());
-				}
+void BroadPhase2DHashGrid::_enter_grid(Element *p_elem, const Rect2 &p_rect, bool p_static) {
 
-				if (!p_static) {
+	if (_is_large(p_rect)) {
+		//large object, do not use grid, must check against all elements
+		for (Map<ID, Element>::Element *E = element_map.front(); E; E = E->next()) {
+			if (E->key() == p_elem->self)
+				continue; // do not pair against itself
+			if (E->get().owner == p_elem->owner)
+				continue;
+			if (E->get()._static && p_static)
+				continue;
 
-					for (Map<Element *, RC>::Element *E = pb->static_object_set.front(); E; E = E->next()) {
+			_pair_attempt(p_elem, &E->get());
+		}
 
-						if (E->key()->owner == p_elem->owner)
-							continue;
-						_pair_attempt(p_elem, E->key());
-					}
-				}
-			}
+		large_elements[p_elem].inc();
+		return;
+	}
+
+	Point2i from = (p_rect.position / cell_size).floor();
+	Point2i to = ((p_rect.position + p_rect.size) / cell_size).floor();
+
+	for (int i = from.x; i <= to.x; i++) {
+
+		for (int j = from.y; j <= to.y; j++) {
+
+			_enter_grid_cell(i, j, p_elem, p_static);
 		}
 	}
 
@@ -200,8 +291,7 @@ void BroadPhase2DHashGrid::_enter_grid(Element *p_elem, const Rect2 &p_rect, boo
 
 void BroadPhase2DHashGrid::_exit_grid(Element *p_elem, const Rect2 &p_rect, bool p_static) {
 
-	Vector2 sz = (p_rect.size / cell_size * LARGE_ELEMENT_FI);
-	if (sz.width * sz.height > large_object_min_surface) {
+	if (_is_large(p_rect)) {
 
 		//unpair all elements, instead of checking all, just check what is already paired, so we at least save from checking static vs static
 		Map<Element *, PairData *>::Element *E = p_elem->paired.front();
@@ -224,83 +314,7 @@ void BroadPhase2DHashGrid::_exit_grid(Element *p_elem, const Rect2 &p_rect, bool
 
 		for (int j = from.y; j <= to.y; j++) {
 
-			PosKey pk;
-			pk.x = i;
-			pk.y = j;
-
-			uint32_t idx = pk.hash() % hash_table_size;
-			PosBin *pb = hash_table[idx];
-
-			while (pb) {
-
-				if (pb->key == pk) {
-					break;
-				}
-
-				pb = pb->next;
-			}
-
-			ERR_CONTINUE(!pb); //should exist!!
-
-			bool exited = false;
-
-			if (p_static) {
-				if (pb->static_object_set[p_elem].dec() == 0) {
-
-					pb->static_object_set.erase(p_elem);
-					exited = true;
-				}
-			} else {
-				if (pb->object_set[p_elem].dec() == 0) {
-
-					pb->object_set.erase(p_elem);
-					exited = true;
-				}
-			}
-
-			if (exited) {
-
-				for (Map<Element *, RC>::Element *E = pb->object_set.front(); E; E = E->next()) {
-
-					if (E->key()->owner == p_elem->owner)
-						continue;
-					_unpair_attempt(p_elem, E->key());
-				}
-
-				if (!p_static) {
-
-					for (Map<Element *, RC>::Element *E = pb->static_object_set.front(); E; E = E->next()) {
-
-						if (E->key()->owner == p_elem->owner)
-							continue;
-						_unpair_attempt(p_elem, E->key());
-					}
-				}
-			}
-
-			if (pb->object_set.empty() && pb->static_object_set.empty()) {
-
-				if (hash_table[idx] == pb) {
-					hash_table[idx] = pb->next;
-				} else {
-
-					PosBin *px = hash_table[idx];
-
-					while (px) {
-
-						if (px->next == pb) {
-							px->next = pb->next;
-							break;
-						}
-
-						px = px->next;
-					}
-
-					ERR_CONTINUE(!px);
-				}
-
-				memdelete(pb);
-			}
+			_exit_grid_cell(i, j, p_elem, p_static);
 		}
 	}
 
@@ -342,6 +356,49 @@ void BroadPhase2DHashGrid::move(ID p_id, const Rect2 &p_aabb) {
 	if (p_aabb == e.aabb)
 		return;
 
+	bool new_large = p_aabb != Rect2() && _is_large(p_aabb);
+	bool old_large = e.aabb != Rect2() && _is_large(e.aabb);
+
+	if (p_aabb != Rect2() && e.aabb != Rect2() && !new_large && !old_large) {
+
+		//incremental update: only touch the cells the element entered or
+		//left; cells covered by both rects keep their pair refcounts, so
+		//coherent motion does not rebuild pairs every frame
+		Point2i nfrom = (p_aabb.position / cell_size).floor();
+		Point2i nto = ((p_aabb.position + p_aabb.size) / cell_size).floor();
+		Point2i ofrom = (e.aabb.position / cell_size).floor();
+		Point2i oto = ((e.aabb.position + e.aabb.size) / cell_size).floor();
+
+		if (nfrom != ofrom || nto != oto) {
+
+			for (int i = nfrom.x; i <= nto.x; i++) {
+
+				for (int j = nfrom.y; j <= nto.y; j++) {
+
+					if (i >= ofrom.x && i <= oto.x && j >= ofrom.y && j <= oto.y)
+						continue; //already occupied
+					_enter_grid_cell(i, j, &e, e._static);
+				}
+			}
+
+			for (int i = ofrom.x; i <= oto.x; i++) {
+
+				for (int j = ofrom.y; j <= oto.y; j++) {
+
+					if (i >= nfrom.x && i <= nto.x && j >= nfrom.y && j <= nto.y)
+						continue; //still occupied
+					_exit_grid_cell(i, j, &e, e._static);
+				}
+			}
+		}
+
+		e.aabb = p_aabb;
+
+		_check_motion(&e);
+
+		return;
+	}
+
 	if (p_aabb != Rect2()) {
 
 		_enter_grid(&e, p_aabb, e._static);
@@ -122,6 +122,9 @@ class BroadPhase2DHashGrid : public BroadPhase2DSW {
 
 	void _enter_grid(Element *p_elem, const Rect2 &p_rect, bool p_static);
 	void _exit_grid(Element *p_elem, const Rect2 &p_rect, bool p_static);
+	_FORCE_INLINE_ void _enter_grid_cell(int p_x, int p_y, Element *p_elem, bool p_static);
+	_FORCE_INLINE_ void _exit_grid_cell(int p_x, int p_y, Element *p_elem, bool p_static);
+	_FORCE_INLINE_ bool _is_large(const Rect2 &p_rect) const;
 	template <bool use_aabb, bool use_segment>
 	_FORCE_INLINE_ void _cull(const Point2i p_cell, const Rect2 &p_aabb, const Point2 &p_from, const Point2 &p_to, CollisionObject2DSW **p_results, int p_max_results, int *p_result_indices, int &index);
 
@@ -33,6 +33,7 @@
 #include "broad_phase_2d_hash_grid.h"
 #include "collision_solver_2d_sw.h"
 #include "core/os/os.h"
+#include "core/os/threaded_array_processor.h"
 #include "core/project_settings.h"
 #include "core/script_language.h"
 
@@ -1322,8 +1323,15 @@ void Physics2DServerSW::init() {
 	iterations = 8; // 8?
 	stepper = memnew(Step2DSW);
 	direct_state = memnew(Physics2DDirectBodyStateSW);
+	parallel_spaces = GLOBAL_DEF("physics/2d/parallel_space_stepping", false);
+	step_delta = 0;
 };
 
+void Physics2DServerSW::_step_space(uint32_t p_index, void *p_unused) {
+
+	space_steppers[p_index]->step(step_space_array[p_index], step_delta, iterations);
+}
+
 void Physics2DServerSW::step(real_t p_step) {
 
 	if (!active)
@@ -1338,12 +1346,38 @@ void Physics2DServerSW::step(real_t p_step) {
 	island_count = 0;
 	active_objects = 0;
 	collision_pairs = 0;
+	for (int i = 0; i < Space2DSW::ELAPSED_TIME_MAX; i++) {
+		phase_time[i] = 0;
+	}
+	bool use_threads = parallel_spaces && active_spaces.size() > 1 && WorkerThreadPool::get_singleton() && WorkerThreadPool::get_singleton()->get_thread_count() > 0;
+
+	if (use_threads) {
+		// Active spaces are fully isolated simulation worlds, so each one
+		// can step on its own worker thread. State callbacks stay deferred
+		// until flush_queries(), which runs on the main thread as usual.
+		step_space_array.clear();
+		for (Set<const Space2DSW *>::Element *E = active_spaces.front(); E; E = E->next()) {
+			step_space_array.push_back((Space2DSW *)E->get());
+		}
+		while (space_steppers.size() < step_space_array.size()) {
+			space_steppers.push_back(memnew(Step2DSW));
+		}
+		step_delta = p_step;
+		thread_process_array(step_space_array.size(), this, &Physics2DServerSW::_step_space, (void *)NULL);
+	} else {
+		for (Set<const Space2DSW *>::Element *E = active_spaces.front(); E; E = E->next()) {
+			stepper->step((Space2DSW *)E->get(), p_step, iterations);
+		}
+	}
+
 	for (Set<const Space2DSW *>::Element *E = active_spaces.front(); E; E = E->next()) {
 
-		stepper->step((Space2DSW *)E->get(), p_step, iterations);
 		island_count += E->get()->get_island_count();
 		active_objects += E->get()->get_active_objects();
 		collision_pairs += E->get()->get_collision_pairs();
+		for (int i = 0; i < Space2DSW::ELAPSED_TIME_MAX; i++) {
+			phase_time[i] += E->get()->get_elapsed_time(Space2DSW::ElapsedTime(i));
+		}
 	}
 };
 
@@ -1377,7 +1411,8 @@ void Physics2DServerSW::flush_queries() {
 			"generate_islands",
 			"setup_constraints",
 			"solve_constraints",
-			"integrate_velocities"
+			"integrate_velocities",
+			"broadphase"
 		};
 
 		for (int i = 0; i < Space2DSW::ELAPSED_TIME_MAX; i++) {
@@ -1411,6 +1446,10 @@ void Physics2DServerSW::end_sync() {
 void Physics2DServerSW::finish() {
 
 	memdelete(stepper);
+	for (int i = 0; i < space_steppers.size(); i++) {
+		memdelete(space_steppers[i]);
+	}
+	space_steppers.clear();
 	memdelete(direct_state);
 };
 
@@ -1437,6 +1476,25 @@ int Physics2DServerSW::get_process_info(ProcessInfo p_info) {
 
 			return island_count;
 		} break;
+		case INFO_SOLVER_ITERATIONS: {
+			return iterations;
+		} break;
+		case INFO_BROADPHASE_TIME: {
+			return phase_time[Space2DSW::ELAPSED_TIME_BROADPHASE];
+		} break;
+		case INFO_NARROWPHASE_TIME: {
+			//narrowphase collision runs while setting up contact constraints
+			return phase_time[Space2DSW::ELAPSED_TIME_SETUP_CONSTRAINTS];
+		} break;
+		case INFO_ISLAND_TIME: {
+			return phase_time[Space2DSW::ELAPSED_TIME_GENERATE_ISLANDS];
+		} break;
+		case INFO_SOLVE_TIME: {
+			return phase_time[Space2DSW::ELAPSED_TIME_SOLVE_CONSTRAINTS];
+		} break;
+		case INFO_INTEGRATE_TIME: {
+			return phase_time[Space2DSW::ELAPSED_TIME_INTEGRATE_FORCES] + phase_time[Space2DSW::ELAPSED_TIME_INTEGRATE_VELOCITIES];
+		} break;
 	}
 
 	return 0;
@@ -1454,6 +1512,9 @@ Physics2DServerSW::Physics2DServerSW() {
 	island_count = 0;
 	active_objects = 0;
 	collision_pairs = 0;
+	for (int i = 0; i < Space2DSW::ELAPSED_TIME_MAX; i++) {
+		phase_time[i] = 0;
+	}
 	using_threads = int(ProjectSettings::get_singleton()->get("physics/2d/thread_model")) == 2;
 	flushing_queries = false;
 };
@@ -51,12 +51,19 @@ class Physics2DServerSW : public Physics2DServer {
 	int island_count;
 	int active_objects;
 	int collision_pairs;
+	uint64_t phase_time[Space2DSW::ELAPSED_TIME_MAX];
 
 	bool using_threads;
 
 	bool flushing_queries;
 
 	Step2DSW *stepper;
+
+	bool parallel_spaces;
+	Vector<Space2DSW *> step_space_array;
+	Vector<Step2DSW *> space_steppers;
+	real_t step_delta;
+	void _step_space(uint32_t p_index, void *p_unused);
 	Set<const Space2DSW *> active_spaces;
 
 	Physics2DDirectBodyStateSW *direct_state;
@@ -30,6 +30,9 @@
 
 #include "step_2d_sw.h"
 #include "core/os/os.h"
+#include "core/safe_refcount.h"
+#include "core/os/worker_thread_pool.h"
+#include "core/project_settings.h"
 
 void Step2DSW::_populate_island(Body2DSW *p_body, Body2DSW **p_island, Constraint2DSW **p_constraint_island) {
 
@@ -94,6 +97,12 @@ void Step2DSW::_solve_island(Constraint2DSW *p_island, int p_iterations, real_t
 	}
 }
 
+void Step2DSW::_solve_island_task(void *p_userdata, uint32_t p_index) {
+
+	Step2DSW *step = (Step2DSW *)p_userdata;
+	step->_solve_island(step->island_array[p_index], step->island_iterations, step->island_delta);
+}
+
 void Step2DSW::_check_suspend(Body2DSW *p_island, real_t p_delta) {
 
 	bool can_sleep = true;
@@ -133,6 +142,10 @@ void Step2DSW::_check_suspend(Body2DSW *p_island, real_t p_delta) {
 
 void Step2DSW::step(Space2DSW *p_space, real_t p_delta, int p_iterations) {
 
+	// Claim a globally unique step number; multiple steppers may run
+	// different spaces in parallel.
+	_step = atomic_increment(&next_step);
+
 	p_space->lock(); // can't access space during this
 
 	p_space->setup(); //update inertias, etc
@@ -263,7 +276,24 @@ void Step2DSW::step(Space2DSW *p_space, real_t p_delta, int p_iterations) {
 
 	/* SOLVE CONSTRAINT ISLANDS */
 
-	{
+	bool use_threads = threaded_islands && island_count > 1 && WorkerThreadPool::get_singleton() && WorkerThreadPool::get_singleton()->get_thread_count() > 0;
+
+	if (use_threads) {
+		//islands share no dynamic body by construction, so each one can
+		//solve on its own thread with bit-identical results regardless of
+		//scheduling order
+		island_array.clear();
+		Constraint2DSW *ci = constraint_island_list;
+		while (ci) {
+			island_array.push_back(ci);
+			ci = ci->get_island_list_next();
+		}
+		island_delta = p_delta;
+		island_iterations = p_iterations;
+
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_group_task(_solve_island_task, this, island_array.size());
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	} else {
 		Constraint2DSW *ci = constraint_island_list;
 		while (ci) {
 			//iterating each island separatedly improves cache efficiency
@@ -302,15 +332,26 @@ void Step2DSW::step(Space2DSW *p_space, real_t p_delta, int p_iterations) {
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
 		p_space->set_elapsed_time(Space2DSW::ELAPSED_TIME_INTEGRATE_VELOCITIES, profile_endtime - profile_begtime);
-		//profile_begtime=profile_endtime;
+		profile_begtime = profile_endtime;
 	}
 
 	p_space->update();
+
+	{ //profile
+		profile_endtime = OS::get_singleton()->get_ticks_usec();
+		p_space->set_elapsed_time(Space2DSW::ELAPSED_TIME_BROADPHASE, profile_endtime - profile_begtime);
+	}
+
 	p_space->unlock();
-	_step++;
 }
 
+volatile uint64_t Step2DSW::next_step = 0;
+
 Step2DSW::Step2DSW() {
 
-	_step = 1;
+	_step = 0;
+
+	threaded_islands = GLOBAL_DEF("physics/2d/threaded_island_solving", true);
+	island_delta = 0;
+	island_iterations = 0;
 }
@@ -36,12 +36,20 @@
 class Step2DSW {
 
 	uint64_t _step;
+	static volatile uint64_t next_step; // Shared by all steppers, so island marks never collide across spaces.
+
+	bool threaded_islands;
+	Vector<Constraint2DSW *> island_array;
+	real_t island_delta;
+	int island_iterations;
 
 	void _populate_island(Body2DSW *p_body, Body2DSW **p_island, Constraint2DSW **p_constraint_island);
 	bool _setup_island(Constraint2DSW *p_island, real_t p_delta);
 	void _solve_island(Constraint2DSW *p_island, int p_iterations, real_t p_delta);
 	void _check_suspend(Body2DSW *p_island, real_t p_delta);
 
+	static void _solve_island_task(void *p_userdata, uint32_t p_index);
+
 public:
 	void step(Space2DSW *p_space, real_t p_delta, int p_iterations);
 	Step2DSW();
@@ -387,6 +387,43 @@ Array Physics2DDirectSpaceState::_collide_shape(const Ref<Physics2DShapeQueryPar
 		r[i] = ret[i];
 	return r;
 }
+int Physics2DDirectSpaceState::_intersect_point_results(const Vector2 &p_point, const Ref<Physics2DShapeQueryResult> &p_result, int p_max_results, const Vector<RID> &p_exclude, uint32_t p_layers, bool p_collide_with_bodies, bool p_collide_with_areas) {
+
+	ERR_FAIL_COND_V(!p_result.is_valid(), 0);
+	ERR_FAIL_COND_V(p_max_results < 1, 0);
+
+	Set<RID> exclude;
+	for (int i = 0; i < p_exclude.size(); i++)
+		exclude.insert(p_exclude[i]);
+
+	Ref<Physics2DShapeQueryResult> res = p_result;
+
+	if (res->result.size() < p_max_results) {
+		res->result.resize(p_max_results); //grows once, then the buffer is reused across queries
+	}
+
+	res->result_count = intersect_point(p_point, res->result.ptrw(), p_max_results, exclude, p_layers, p_collide_with_bodies, p_collide_with_areas);
+
+	return res->result_count;
+}
+
+int Physics2DDirectSpaceState::_intersect_shape_results(const Ref<Physics2DShapeQueryParameters> &p_shape_query, const Ref<Physics2DShapeQueryResult> &p_result, int p_max_results) {
+
+	ERR_FAIL_COND_V(!p_shape_query.is_valid(), 0);
+	ERR_FAIL_COND_V(!p_result.is_valid(), 0);
+	ERR_FAIL_COND_V(p_max_results < 1, 0);
+
+	Ref<Physics2DShapeQueryResult> res = p_result;
+
+	if (res->result.size() < p_max_results) {
+		res->result.resize(p_max_results); //grows once, then the buffer is reused across queries
+	}
+
+	res->result_count = intersect_shape(p_shape_query->shape, p_shape_query->transform, p_shape_query->motion, p_shape_query->margin, res->result.ptrw(), p_max_results, p_shape_query->exclude, p_shape_query->collision_mask, p_shape_query->collide_with_bodies, p_shape_query->collide_with_areas);
+
+	return res->result_count;
+}
+
 Dictionary Physics2DDirectSpaceState::_get_rest_info(const Ref<Physics2DShapeQueryParameters> &p_shape_query) {
 
 	ERR_FAIL_COND_V(!p_shape_query.is_valid(), Dictionary());
@@ -418,6 +455,8 @@ void Physics2DDirectSpaceState::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("intersect_point_on_canvas", "point", "canvas_instance_id", "max_results", "exclude", "collision_layer", "collide_with_bodies", "collide_with_areas"), &Physics2DDirectSpaceState::_intersect_point_on_canvas, DEFVAL(32), DEFVAL(Array()), DEFVAL(0x7FFFFFFF), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("intersect_ray", "from", "to", "exclude", "collision_layer", "collide_with_bodies", "collide_with_areas"), &Physics2DDirectSpaceState::_intersect_ray, DEFVAL(Array()), DEFVAL(0x7FFFFFFF), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("intersect_shape", "shape", "max_results"), &Physics2DDirectSpaceState::_intersect_shape, DEFVAL(32));
+	ClassDB::bind_method(D_METHOD("intersect_point_results", "point", "result", "max_results", "exclude", "collision_layer", "collide_with_bodies", "collide_with_areas"), &Physics2DDirectSpaceState::_intersect_point_results, DEFVAL(32), DEFVAL(Array()), DEFVAL(0x7FFFFFFF), DEFVAL(true), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("intersect_shape_results", "shape", "result", "max_results"), &Physics2DDirectSpaceState::_intersect_shape_results, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("cast_motion", "shape"), &Physics2DDirectSpaceState::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "shape", "max_results"), &Physics2DDirectSpaceState::_collide_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("get_rest_info", "shape"), &Physics2DDirectSpaceState::_get_rest_info);
@@ -425,26 +464,32 @@ void Physics2DDirectSpaceState::_bind_methods() {
 
 int Physics2DShapeQueryResult::get_result_count() const {
 
-	return result.size();
+	return result_count;
 }
 RID Physics2DShapeQueryResult::get_result_rid(int p_idx) const {
 
+	ERR_FAIL_INDEX_V(p_idx, result_count, RID());
 	return result[p_idx].rid;
 }
 ObjectID Physics2DShapeQueryResult::get_result_object_id(int p_idx) const {
 
+	ERR_FAIL_INDEX_V(p_idx, result_count, 0);
 	return result[p_idx].collider_id;
 }
 Object *Physics2DShapeQueryResult::get_result_object(int p_idx) const {
 
+	ERR_FAIL_INDEX_V(p_idx, result_count, NULL);
 	return result[p_idx].collider;
 }
 int Physics2DShapeQueryResult::get_result_object_shape(int p_idx) const {
 
+	ERR_FAIL_INDEX_V(p_idx, result_count, -1);
 	return result[p_idx].shape;
 }
 
 Physics2DShapeQueryResult::Physics2DShapeQueryResult() {
+
+	result_count = 0;
 }
 
 void Physics2DShapeQueryResult::_bind_methods() {
@@ -762,6 +807,12 @@ void Physics2DServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(INFO_ACTIVE_OBJECTS);
 	BIND_ENUM_CONSTANT(INFO_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(INFO_ISLAND_COUNT);
+	BIND_ENUM_CONSTANT(INFO_SOLVER_ITERATIONS);
+	BIND_ENUM_CONSTANT(INFO_BROADPHASE_TIME);
+	BIND_ENUM_CONSTANT(INFO_NARROWPHASE_TIME);
+	BIND_ENUM_CONSTANT(INFO_ISLAND_TIME);
+	BIND_ENUM_CONSTANT(INFO_SOLVE_TIME);
+	BIND_ENUM_CONSTANT(INFO_INTEGRATE_TIME);
 }
 
 Physics2DServer::Physics2DServer() {
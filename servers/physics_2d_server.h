@@ -151,6 +151,8 @@ class Physics2DDirectSpaceState : public Object {
 	Array _intersect_point_on_canvas(const Vector2 &p_point, ObjectID p_canvas_intance_id, int p_max_results = 32, const Vector<RID> &p_exclude = Vector<RID>(), uint32_t p_layers = 0, bool p_collide_with_bodies = true, bool p_collide_with_areas = false);
 	Array _intersect_point_impl(const Vector2 &p_point, int p_max_results, const Vector<RID> &p_exclud, uint32_t p_layers, bool p_collide_with_bodies, bool p_collide_with_areas, bool p_filter_by_canvas = false, ObjectID p_canvas_instance_id = 0);
 	Array _intersect_shape(const Ref<Physics2DShapeQueryParameters> &p_shape_query, int p_max_results = 32);
+	int _intersect_point_results(const Vector2 &p_point, const Ref<Physics2DShapeQueryResult> &p_result, int p_max_results = 32, const Vector<RID> &p_exclude = Vector<RID>(), uint32_t p_layers = 0, bool p_collide_with_bodies = true, bool p_collide_with_areas = false);
+	int _intersect_shape_results(const Ref<Physics2DShapeQueryParameters> &p_shape_query, const Ref<Physics2DShapeQueryResult> &p_result, int p_max_results = 32);
 	Array _cast_motion(const Ref<Physics2DShapeQueryParameters> &p_shape_query);
 	Array _collide_shape(const Ref<Physics2DShapeQueryParameters> &p_shape_query, int p_max_results = 32);
 	Dictionary _get_rest_info(const Ref<Physics2DShapeQueryParameters> &p_shape_query);
@@ -211,6 +213,7 @@ class Physics2DShapeQueryResult : public Reference {
 	GDCLASS(Physics2DShapeQueryResult, Reference);
 
 	Vector<Physics2DDirectSpaceState::ShapeResult> result;
+	int result_count; //buffer is kept allocated across queries, only this many entries are valid
 
 	friend class Physics2DDirectSpaceState;
 
@@ -597,7 +600,13 @@ public:
 
 		INFO_ACTIVE_OBJECTS,
 		INFO_COLLISION_PAIRS,
-		INFO_ISLAND_COUNT
+		INFO_ISLAND_COUNT,
+		INFO_SOLVER_ITERATIONS,
+		INFO_BROADPHASE_TIME,
+		INFO_NARROWPHASE_TIME,
+		INFO_ISLAND_TIME,
+		INFO_SOLVE_TIME,
+		INFO_INTEGRATE_TIME
 	};
 
 	virtual int get_process_info(ProcessInfo p_info) = 0;
@@ -283,6 +283,76 @@ Dictionary PhysicsDirectSpaceState::_intersect_ray(const Vector3 &p_from, const
 	return d;
 }
 
+void PhysicsDirectSpaceState::intersect_ray_batch(const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, bool *r_collided, const Set<RID> &p_exclude, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas, const Set<RID> *const *p_ray_excludes) {
+
+	for (int i = 0; i < p_ray_count; i++) {
+		r_collided[i] = intersect_ray(p_from[i], p_to[i], r_results[i], p_ray_excludes ? *p_ray_excludes[i] : p_exclude, p_collision_mask, p_collide_with_bodies, p_collide_with_areas);
+	}
+}
+
+Array PhysicsDirectSpaceState::_intersect_ray_batch(const PoolVector<Vector3> &p_from, const PoolVector<Vector3> &p_to, const Vector<RID> &p_exclude, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) {
+
+	ERR_FAIL_COND_V(p_from.size() != p_to.size(), Array());
+
+	int ray_count = p_from.size();
+	if (ray_count == 0)
+		return Array();
+
+	Set<RID> exclude;
+	for (int i = 0; i < p_exclude.size(); i++)
+		exclude.insert(p_exclude[i]);
+
+	Vector<RayResult> results;
+	results.resize(ray_count);
+	Vector<bool> collided;
+	collided.resize(ray_count);
+
+	PoolVector<Vector3>::Read fr = p_from.read();
+	PoolVector<Vector3>::Read tr = p_to.read();
+
+	intersect_ray_batch(fr.ptr(), tr.ptr(), ray_count, results.ptrw(), collided.ptrw(), exclude, p_collision_mask, p_collide_with_bodies, p_collide_with_areas);
+
+	Array ret;
+	ret.resize(ray_count);
+	for (int i = 0; i < ray_count; i++) {
+
+		if (!collided[i]) {
+			ret[i] = Dictionary(); //empty dictionary means no hit, same as intersect_ray
+			continue;
+		}
+
+		const RayResult &inters = results[i];
+
+		Dictionary d;
+		d["position"] = inters.position;
+		d["normal"] = inters.normal;
+		d["collider_id"] = inters.collider_id;
+		d["collider"] = inters.collider;
+		d["shape"] = inters.shape;
+		d["rid"] = inters.rid;
+		ret[i] = d;
+	}
+
+	return ret;
+}
+
+int PhysicsDirectSpaceState::_intersect_shape_results(const Ref<PhysicsShapeQueryParameters> &p_shape_query, const Ref<PhysicsShapeQueryResult> &p_result, int p_max_results) {
+
+	ERR_FAIL_COND_V(!p_shape_query.is_valid(), 0);
+	ERR_FAIL_COND_V(!p_result.is_valid(), 0);
+	ERR_FAIL_COND_V(p_max_results < 1, 0);
+
+	Ref<PhysicsShapeQueryResult> res = p_result;
+
+	if (res->result.size() < p_max_results) {
+		res->result.resize(p_max_results); //grows once, then the buffer is reused across queries
+	}
+
+	res->result_count = intersect_shape(p_shape_query->shape, p_shape_query->transform, p_shape_query->margin, res->result.ptrw(), p_max_results, p_shape_query->exclude, p_shape_query->collision_mask, p_shape_query->collide_with_bodies, p_shape_query->collide_with_areas);
+
+	return res->result_count;
+}
+
 Array PhysicsDirectSpaceState::_intersect_shape(const Ref<PhysicsShapeQueryParameters> &p_shape_query, int p_max_results) {
 
 	ERR_FAIL_COND_V(!p_shape_query.is_valid(), Array());
@@ -362,7 +432,9 @@ PhysicsDirectSpaceState::PhysicsDirectSpaceState() {
 void PhysicsDirectSpaceState::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("intersect_ray", "from", "to", "exclude", "collision_mask", "collide_with_bodies", "collide_with_areas"), &PhysicsDirectSpaceState::_intersect_ray, DEFVAL(Array()), DEFVAL(0x7FFFFFFF), DEFVAL(true), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("intersect_ray_batch", "from", "to", "exclude", "collision_mask", "collide_with_bodies", "collide_with_areas"), &PhysicsDirectSpaceState::_intersect_ray_batch, DEFVAL(Array()), DEFVAL(0x7FFFFFFF), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("intersect_shape", "shape", "max_results"), &PhysicsDirectSpaceState::_intersect_shape, DEFVAL(32));
+	ClassDB::bind_method(D_METHOD("intersect_shape_results", "shape", "result", "max_results"), &PhysicsDirectSpaceState::_intersect_shape_results, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("cast_motion", "shape", "motion"), &PhysicsDirectSpaceState::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "shape", "max_results"), &PhysicsDirectSpaceState::_collide_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("get_rest_info", "shape"), &PhysicsDirectSpaceState::_get_rest_info);
@@ -370,26 +442,32 @@ void PhysicsDirectSpaceState::_bind_methods() {
 
 int PhysicsShapeQueryResult::get_result_count() const {
 
-	return result.size();
+	return result_count;
 }
 RID PhysicsShapeQueryResult::get_result_rid(int p_idx) const {
 
+	ERR_FAIL_INDEX_V(p_idx, result_count, RID());
 	return result[p_idx].rid;
 }
 ObjectID PhysicsShapeQueryResult::get_result_object_id(int p_idx) const {
 
+	ERR_FAIL_INDEX_V(p_idx, result_count, 0);
 	return result[p_idx].collider_id;
 }
 Object *PhysicsShapeQueryResult::get_result_object(int p_idx) const {
 
+	ERR_FAIL_INDEX_V(p_idx, result_count, NULL);
 	return result[p_idx].collider;
 }
 int PhysicsShapeQueryResult::get_result_object_shape(int p_idx) const {
 
+	ERR_FAIL_INDEX_V(p_idx, result_count, -1);
 	return result[p_idx].shape;
 }
 
 PhysicsShapeQueryResult::PhysicsShapeQueryResult() {
+
+	result_count = 0;
 }
 
 void PhysicsShapeQueryResult::_bind_methods() {
@@ -702,6 +780,12 @@ void PhysicsServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(INFO_ACTIVE_OBJECTS);
 	BIND_ENUM_CONSTANT(INFO_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(INFO_ISLAND_COUNT);
+	BIND_ENUM_CONSTANT(INFO_SOLVER_ITERATIONS);
+	BIND_ENUM_CONSTANT(INFO_BROADPHASE_TIME);
+	BIND_ENUM_CONSTANT(INFO_NARROWPHASE_TIME);
+	BIND_ENUM_CONSTANT(INFO_ISLAND_TIME);
+	BIND_ENUM_CONSTANT(INFO_SOLVE_TIME);
+	BIND_ENUM_CONSTANT(INFO_INTEGRATE_TIME);
 
 	BIND_ENUM_CONSTANT(SPACE_PARAM_CONTACT_RECYCLE_RADIUS);
 	BIND_ENUM_CONSTANT(SPACE_PARAM_CONTACT_MAX_SEPARATION);
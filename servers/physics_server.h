@@ -146,7 +146,9 @@ class PhysicsDirectSpaceState : public Object {
 
 private:
 	Dictionary _intersect_ray(const Vector3 &p_from, const Vector3 &p_to, const Vector<RID> &p_exclude = Vector<RID>(), uint32_t p_collision_mask = 0, bool p_collide_with_bodies = true, bool p_collide_with_areas = false);
+	Array _intersect_ray_batch(const PoolVector<Vector3> &p_from, const PoolVector<Vector3> &p_to, const Vector<RID> &p_exclude = Vector<RID>(), uint32_t p_collision_mask = 0, bool p_collide_with_bodies = true, bool p_collide_with_areas = false);
 	Array _intersect_shape(const Ref<PhysicsShapeQueryParameters> &p_shape_query, int p_max_results = 32);
+	int _intersect_shape_results(const Ref<PhysicsShapeQueryParameters> &p_shape_query, const Ref<PhysicsShapeQueryResult> &p_result, int p_max_results = 32);
 	Array _cast_motion(const Ref<PhysicsShapeQueryParameters> &p_shape_query, const Vector3 &p_motion);
 	Array _collide_shape(const Ref<PhysicsShapeQueryParameters> &p_shape_query, int p_max_results = 32);
 	Dictionary _get_rest_info(const Ref<PhysicsShapeQueryParameters> &p_shape_query);
@@ -177,6 +179,9 @@ public:
 
 	virtual bool intersect_ray(const Vector3 &p_from, const Vector3 &p_to, RayResult &r_result, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false, bool p_pick_ray = false) = 0;
 
+	//many rays against one space; backends may reorder and parallelize internally
+	virtual void intersect_ray_batch(const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, bool *r_collided, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false, const Set<RID> *const *p_ray_excludes = NULL);
+
 	virtual int intersect_shape(const RID &p_shape, const Transform &p_xform, float p_margin, ShapeResult *r_results, int p_result_max, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false) = 0;
 
 	struct ShapeRestInfo {
@@ -205,6 +210,7 @@ class PhysicsShapeQueryResult : public Reference {
 	GDCLASS(PhysicsShapeQueryResult, Reference);
 
 	Vector<PhysicsDirectSpaceState::ShapeResult> result;
+	int result_count; //buffer is kept allocated across queries, only this many entries are valid
 
 	friend class PhysicsDirectSpaceState;
 
@@ -767,7 +773,13 @@ public:
 
 		INFO_ACTIVE_OBJECTS,
 		INFO_COLLISION_PAIRS,
-		INFO_ISLAND_COUNT
+		INFO_ISLAND_COUNT,
+		INFO_SOLVER_ITERATIONS,
+		INFO_BROADPHASE_TIME,
+		INFO_NARROWPHASE_TIME,
+		INFO_ISLAND_TIME,
+		INFO_SOLVE_TIME,
+		INFO_INTEGRATE_TIME
 	};
 
 	virtual int get_process_info(ProcessInfo p_info) = 0;
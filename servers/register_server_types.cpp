@@ -137,8 +137,11 @@ void register_server_types() {
 	ClassDB::register_class<AudioStreamGenerator>();
 	ClassDB::register_virtual_class<AudioStreamGeneratorPlayback>();
 
+#if !defined(SERVER_ENABLED) || defined(TOOLS_ENABLED)
 	{
-		//audio effects
+		//audio effects; a dedicated server template never mixes audio, so it
+		//skips registering the DSP classes entirely (tool builds keep them so
+		//the headless editor can open any project)
 		ClassDB::register_class<AudioEffectAmplify>();
 
 		ClassDB::register_class<AudioEffectReverb>();
@@ -171,6 +174,7 @@ void register_server_types() {
 		ClassDB::register_class<AudioEffectSpectrumAnalyzer>();
 		ClassDB::register_virtual_class<AudioEffectSpectrumAnalyzerInstance>();
 	}
+#endif
 
 	ClassDB::register_class<CameraFeed>();
 
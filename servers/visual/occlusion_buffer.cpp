@@ -0,0 +1,232 @@
+/*************************************************************************/
+/*  occlusion_buffer.cpp                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "occlusion_buffer.h"
+
+void OcclusionBuffer::setup(int p_size) {
+
+	size = p_size;
+	if (size > 0) {
+		depth.resize(size * size);
+	} else {
+		depth.resize(0);
+	}
+}
+
+void OcclusionBuffer::begin(const Transform &p_cam_transform, const CameraMatrix &p_cam_projection) {
+
+	if (!size)
+		return;
+
+	camera_inverse = p_cam_transform.affine_inverse();
+	projection = p_cam_projection;
+	camera_position = p_cam_transform.origin;
+	z_near = p_cam_projection.get_z_near();
+
+	float *w = depth.ptrw();
+	for (int i = 0; i < size * size; i++) {
+		w[i] = 1e30f;
+	}
+}
+
+void OcclusionBuffer::_fill_convex(const Vector3 *p_screen, int p_point_count, float p_depth) {
+
+	float ymin = p_screen[0].y;
+	float ymax = p_screen[0].y;
+	for (int i = 1; i < p_point_count; i++) {
+		ymin = MIN(ymin, p_screen[i].y);
+		ymax = MAX(ymax, p_screen[i].y);
+	}
+
+	int from_y = MAX(0, (int)Math::ceil(ymin - 0.5));
+	int to_y = MIN(size - 1, (int)Math::floor(ymax - 0.5));
+
+	float *buffer = depth.ptrw();
+
+	for (int yi = from_y; yi <= to_y; yi++) {
+
+		float yc = yi + 0.5;
+
+		//intersect the convex polygon with this scanline
+		float xmin = 1e30f;
+		float xmax = -1e30f;
+
+		for (int i = 0; i < p_point_count; i++) {
+
+			const Vector3 &a = p_screen[i];
+			const Vector3 &b = p_screen[(i + 1) % p_point_count];
+
+			if ((a.y <= yc) == (b.y <= yc))
+				continue;
+
+			float x = a.x + (b.x - a.x) * (yc - a.y) / (b.y - a.y);
+			xmin = MIN(xmin, x);
+			xmax = MAX(xmax, x);
+		}
+
+		if (xmin > xmax)
+			continue;
+
+		int from_x = MAX(0, (int)Math::ceil(xmin - 0.5));
+		int to_x = MIN(size - 1, (int)Math::floor(xmax - 0.5));
+
+		float *row = &buffer[yi * size];
+		for (int xi = from_x; xi <= to_x; xi++) {
+			row[xi] = MIN(row[xi], p_depth);
+		}
+	}
+}
+
+void OcclusionBuffer::rasterize_box(const AABB &p_aabb) {
+
+	if (!size)
+		return;
+
+	for (int axis = 0; axis < 3; axis++) {
+
+		float slab_min = p_aabb.position[axis];
+		float slab_max = slab_min + p_aabb.size[axis];
+
+		if (camera_position[axis] > slab_min && camera_position[axis] < slab_max) {
+			//camera inside this slab, neither face is strictly back facing;
+			//skipping it only loses occlusion, never correctness
+			continue;
+		}
+
+		//the back face is on the side of the slab away from the camera
+		float face_pos = camera_position[axis] <= slab_min ? slab_max : slab_min;
+
+		int u = (axis + 1) % 3;
+		int v = (axis + 2) % 3;
+
+		Vector3 corners[4];
+		for (int i = 0; i < 4; i++) {
+			Vector3 c;
+			c[axis] = face_pos;
+			c[u] = p_aabb.position[u] + ((i == 1 || i == 2) ? p_aabb.size[u] : 0);
+			c[v] = p_aabb.position[v] + ((i >= 2) ? p_aabb.size[v] : 0);
+			corners[i] = camera_inverse.xform(c);
+		}
+
+		//clip against the near plane in view space (z <= -z_near)
+		Vector3 clipped[8];
+		int clipped_count = 0;
+
+		for (int i = 0; i < 4; i++) {
+
+			const Vector3 &a = corners[i];
+			const Vector3 &b = corners[(i + 1) % 4];
+
+			bool a_in = a.z <= -z_near;
+			bool b_in = b.z <= -z_near;
+
+			if (a_in) {
+				clipped[clipped_count++] = a;
+			}
+
+			if (a_in != b_in) {
+				float t = (-z_near - a.z) / (b.z - a.z);
+				clipped[clipped_count++] = a + (b - a) * t;
+			}
+		}
+
+		if (clipped_count < 3)
+			continue;
+
+		//flat depth per face: its farthest clipped point, which is always
+		//conservative for the whole face
+		float face_depth = 0;
+		Vector3 screen[8];
+
+		for (int i = 0; i < clipped_count; i++) {
+
+			face_depth = MAX(face_depth, -clipped[i].z);
+
+			Vector3 ndc = projection.xform(clipped[i]);
+			screen[i] = Vector3((ndc.x * 0.5 + 0.5) * size, (ndc.y * 0.5 + 0.5) * size, 0);
+		}
+
+		_fill_convex(screen, clipped_count, face_depth);
+	}
+}
+
+bool OcclusionBuffer::is_occluded(const AABB &p_aabb) const {
+
+	if (!size)
+		return false;
+
+	float min_depth = 1e30f;
+	float xmin = 1e30f, xmax = -1e30f;
+	float ymin = 1e30f, ymax = -1e30f;
+
+	for (int i = 0; i < 8; i++) {
+
+		Vector3 corner = camera_inverse.xform(p_aabb.get_endpoint(i));
+
+		if (corner.z > -z_near) {
+			//crosses the near plane, never occluded
+			return false;
+		}
+
+		min_depth = MIN(min_depth, -corner.z);
+
+		Vector3 ndc = projection.xform(corner);
+		float x = (ndc.x * 0.5 + 0.5) * size;
+		float y = (ndc.y * 0.5 + 0.5) * size;
+
+		xmin = MIN(xmin, x);
+		xmax = MAX(xmax, x);
+		ymin = MIN(ymin, y);
+		ymax = MAX(ymax, y);
+	}
+
+	//expand the rectangle a texel outwards so rasterization rounding can
+	//not produce false occlusion at the silhouette
+	int from_x = MAX(0, (int)Math::floor(xmin) - 1);
+	int to_x = MIN(size - 1, (int)Math::ceil(xmax) + 1);
+	int from_y = MAX(0, (int)Math::floor(ymin) - 1);
+	int to_y = MIN(size - 1, (int)Math::ceil(ymax) + 1);
+
+	const float *buffer = depth.ptr();
+
+	for (int yi = from_y; yi <= to_y; yi++) {
+
+		const float *row = &buffer[yi * size];
+		for (int xi = from_x; xi <= to_x; xi++) {
+
+			if (row[xi] >= min_depth) {
+				//no occluder in front of the instance here
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
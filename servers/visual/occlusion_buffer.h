@@ -0,0 +1,76 @@
+/*************************************************************************/
+/*  occlusion_buffer.h                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef OCCLUSION_BUFFER_H
+#define OCCLUSION_BUFFER_H
+
+#include "core/math/camera_matrix.h"
+#include "core/math/transform.h"
+#include "core/vector.h"
+
+/**
+ * Small CPU depth buffer for conservative occlusion culling. Box occluders
+ * are rasterized through rasterize_box() writing the farthest surface of
+ * each box (back faces, flat per-face max depth), and instance AABBs are
+ * then tested with is_occluded(): an instance is culled only when every
+ * buffer texel under its screen rectangle holds an occluder surface nearer
+ * than the instance's nearest corner, so errors always err towards drawing.
+ */
+class OcclusionBuffer {
+
+	Vector<float> depth; //view-space distance of the nearest occluder back face
+	int size;
+
+	Transform camera_inverse;
+	CameraMatrix projection;
+	Vector3 camera_position;
+	float z_near;
+
+	void _fill_convex(const Vector3 *p_screen, int p_point_count, float p_depth);
+
+public:
+	void setup(int p_size);
+
+	_FORCE_INLINE_ bool is_enabled() const { return size > 0; }
+
+	//clears the buffer and sets the camera for this frame
+	void begin(const Transform &p_cam_transform, const CameraMatrix &p_cam_projection);
+
+	void rasterize_box(const AABB &p_aabb);
+
+	bool is_occluded(const AABB &p_aabb) const;
+
+	OcclusionBuffer() {
+		size = 0;
+		z_near = 0;
+	}
+};
+
+#endif // OCCLUSION_BUFFER_H
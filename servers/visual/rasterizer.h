@@ -44,6 +44,8 @@ public:
 	virtual void shadow_atlas_set_size(RID p_atlas, int p_size) = 0;
 	virtual void shadow_atlas_set_quadrant_subdivision(RID p_atlas, int p_quadrant, int p_subdivision) = 0;
 	virtual bool shadow_atlas_update_light(RID p_atlas, RID p_light_intance, float p_coverage, uint64_t p_light_version) = 0;
+	virtual bool shadow_atlas_cache_shadow(RID p_atlas, RID p_light_intance, int p_pass, bool p_to_cache) { return false; } //copy a shadow between the atlas and the static caster cache, false if unsupported
+	virtual bool is_shadow_atlas_static_cache_enabled(RID p_atlas) { return false; }
 
 	virtual int get_directional_light_shadow_size(RID p_light_intance) = 0;
 	virtual void set_directional_shadow_count(int p_count) = 0;
@@ -87,6 +89,8 @@ public:
 		VS::InstanceType base_type;
 		RID base;
 
+		RID lod_mesh; //mesh to draw instead of base this frame, chosen during culling. Invalid means draw base.
+
 		RID skeleton;
 		RID material_override;
 
@@ -162,7 +166,7 @@ public:
 	virtual void gi_probe_instance_set_bounds(RID p_probe, const Vector3 &p_bounds) = 0;
 
 	virtual void render_scene(const Transform &p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_ortogonal, InstanceBase **p_cull_result, int p_cull_count, RID *p_light_cull_result, int p_light_cull_count, RID *p_reflection_probe_cull_result, int p_reflection_probe_cull_count, RID p_environment, RID p_shadow_atlas, RID p_reflection_atlas, RID p_reflection_probe, int p_reflection_probe_pass) = 0;
-	virtual void render_shadow(RID p_light, RID p_shadow_atlas, int p_pass, InstanceBase **p_cull_result, int p_cull_count) = 0;
+	virtual void render_shadow(RID p_light, RID p_shadow_atlas, int p_pass, InstanceBase **p_cull_result, int p_cull_count, bool p_clear_region = true) = 0;
 
 	virtual void set_scene_pass(uint64_t p_pass) = 0;
 	virtual void set_debug_draw_mode(VS::ViewportDebugDraw p_debug_draw) = 0;
@@ -325,6 +329,7 @@ public:
 	virtual Color multimesh_instance_get_custom_data(RID p_multimesh, int p_index) const = 0;
 
 	virtual void multimesh_set_as_bulk_array(RID p_multimesh, const PoolVector<float> &p_array) = 0;
+	virtual void multimesh_set_buffer_region(RID p_multimesh, int p_instance_from, const PoolVector<float> &p_array) = 0;
 
 	virtual void multimesh_set_visible_instances(RID p_multimesh, int p_visible) = 0;
 	virtual int multimesh_get_visible_instances(RID p_multimesh) const = 0;
@@ -343,6 +348,7 @@ public:
 	virtual void immediate_uv2(RID p_immediate, const Vector2 &tex_uv) = 0;
 	virtual void immediate_end(RID p_immediate) = 0;
 	virtual void immediate_clear(RID p_immediate) = 0;
+	virtual void immediate_set_buffer(RID p_immediate, VS::PrimitiveType p_primitive, const PoolVector<Vector3> &p_vertices, const PoolVector<Vector3> &p_normals, const PoolVector<Plane> &p_tangents, const PoolVector<Color> &p_colors, const PoolVector<Vector2> &p_uvs, const PoolVector<Vector2> &p_uv2s, RID p_texture = RID()) = 0;
 	virtual void immediate_set_material(RID p_immediate, RID p_material) = 0;
 	virtual RID immediate_get_material(RID p_immediate) const = 0;
 	virtual AABB immediate_get_aabb(RID p_immediate) const = 0;
@@ -353,6 +359,7 @@ public:
 	virtual void skeleton_allocate(RID p_skeleton, int p_bones, bool p_2d_skeleton = false) = 0;
 	virtual int skeleton_get_bone_count(RID p_skeleton) const = 0;
 	virtual void skeleton_bone_set_transform(RID p_skeleton, int p_bone, const Transform &p_transform) = 0;
+	virtual void skeleton_set_bone_transforms(RID p_skeleton, const Vector<Transform> &p_transforms) = 0;
 	virtual Transform skeleton_bone_get_transform(RID p_skeleton, int p_bone) const = 0;
 	virtual void skeleton_bone_set_transform_2d(RID p_skeleton, int p_bone, const Transform2D &p_transform) = 0;
 	virtual Transform2D skeleton_bone_get_transform_2d(RID p_skeleton, int p_bone) const = 0;
@@ -552,6 +559,8 @@ public:
 		RENDER_TARGET_HDR,
 		RENDER_TARGET_KEEP_3D_LINEAR,
 		RENDER_TARGET_DIRECT_TO_SCREEN,
+		RENDER_TARGET_NO_DEPTH_PREPASS,
+		RENDER_TARGET_FORCE_DEPTH_PREPASS,
 		RENDER_TARGET_FLAG_MAX
 	};
 
@@ -642,6 +651,9 @@ public:
 		Transform2D light_shader_xform;
 		Vector2 light_shader_pos;
 
+		int batch_index; //index in the multi-light array uploaded by the rasterizer, -1 when not batchable
+		bool multi_batched; //scratch flag while batching lights per item
+
 		Light *shadows_next_ptr;
 		Light *filter_next_ptr;
 		Light *next_ptr;
@@ -671,6 +683,8 @@ public:
 			shadow_gradient_length = 0;
 			shadow_filter = VS::CANVAS_LIGHT_FILTER_NONE;
 			shadow_smooth = 0.0;
+			batch_index = -1;
+			multi_batched = false;
 		}
 	};
 
@@ -855,6 +869,8 @@ public:
 		//VS::MaterialBlendMode blend_mode;
 		int light_mask;
 		Vector<Command *> commands;
+		Vector<Command *> command_recycle; //previous command list, kept so alloc_command() can reuse allocations
+		int command_recycle_pos;
 		mutable bool custom_rect;
 		mutable bool rect_dirty;
 		mutable Rect2 rect;
@@ -1026,9 +1042,36 @@ public:
 			return rect;
 		}
 
+		// Items are usually re-recorded with the same command sequence right
+		// after being cleared (CanvasItem::update() wipes and re-adds on any
+		// change), so clearing keeps the old list around and alloc_command()
+		// reuses the allocations in place for as long as the types match.
+		template <class T>
+		T *alloc_command(Command::Type p_type) {
+
+			T *command;
+			if (command_recycle_pos < command_recycle.size() && command_recycle[command_recycle_pos]->type == p_type) {
+				command = static_cast<T *>(command_recycle[command_recycle_pos]);
+				command_recycle_pos++;
+				command->~T();
+				memnew_placement(command, T);
+			} else {
+				//recording diverged from the previous one, drop what is left
+				for (int i = command_recycle_pos; i < command_recycle.size(); i++)
+					memdelete(command_recycle[i]);
+				command_recycle.clear();
+				command_recycle_pos = 0;
+				command = memnew(T);
+			}
+			commands.push_back(command);
+			return command;
+		}
+
 		void clear() {
-			for (int i = 0; i < commands.size(); i++)
-				memdelete(commands[i]);
+			for (int i = command_recycle_pos; i < command_recycle.size(); i++)
+				memdelete(command_recycle[i]);
+			command_recycle = commands;
+			command_recycle_pos = 0;
 			commands.clear();
 			clip = false;
 			rect_dirty = true;
@@ -1038,6 +1081,7 @@ public:
 		}
 		Item() {
 			light_mask = 1;
+			command_recycle_pos = 0;
 			vp_render = NULL;
 			next = NULL;
 			final_clip_owner = NULL;
@@ -1055,6 +1099,8 @@ public:
 		}
 		virtual ~Item() {
 			clear();
+			for (int i = 0; i < command_recycle.size(); i++)
+				memdelete(command_recycle[i]);
 			if (copy_back_buffer) memdelete(copy_back_buffer);
 		}
 	};
@@ -3808,6 +3808,376 @@ ShaderLanguage::Node *ShaderLanguage::_parse_and_reduce_expression(BlockNode *p_
 	return expr;
 }
 
+static bool _fold_scalar_op(ShaderLanguage::Operator p_op, ShaderLanguage::DataType p_base, const ShaderLanguage::ConstantNode::Value &p_a, const ShaderLanguage::ConstantNode::Value &p_b, ShaderLanguage::ConstantNode::Value *r_ret) {
+
+	switch (p_base) {
+		case ShaderLanguage::TYPE_INT: {
+			switch (p_op) {
+				case ShaderLanguage::OP_ADD: r_ret->sint = p_a.sint + p_b.sint; break;
+				case ShaderLanguage::OP_SUB: r_ret->sint = p_a.sint - p_b.sint; break;
+				case ShaderLanguage::OP_MUL: r_ret->sint = p_a.sint * p_b.sint; break;
+				case ShaderLanguage::OP_DIV: {
+					if (p_b.sint == 0)
+						return false; //leave the division by zero to the driver
+					r_ret->sint = p_a.sint / p_b.sint;
+				} break;
+				case ShaderLanguage::OP_MOD: {
+					if (p_b.sint == 0)
+						return false;
+					r_ret->sint = p_a.sint % p_b.sint;
+				} break;
+				default: return false;
+			}
+		} break;
+		case ShaderLanguage::TYPE_UINT: {
+			switch (p_op) {
+				case ShaderLanguage::OP_ADD: r_ret->uint = p_a.uint + p_b.uint; break;
+				case ShaderLanguage::OP_SUB: r_ret->uint = p_a.uint - p_b.uint; break;
+				case ShaderLanguage::OP_MUL: r_ret->uint = p_a.uint * p_b.uint; break;
+				case ShaderLanguage::OP_DIV: {
+					if (p_b.uint == 0)
+						return false;
+					r_ret->uint = p_a.uint / p_b.uint;
+				} break;
+				case ShaderLanguage::OP_MOD: {
+					if (p_b.uint == 0)
+						return false;
+					r_ret->uint = p_a.uint % p_b.uint;
+				} break;
+				default: return false;
+			}
+		} break;
+		case ShaderLanguage::TYPE_FLOAT: {
+			switch (p_op) {
+				case ShaderLanguage::OP_ADD: r_ret->real = p_a.real + p_b.real; break;
+				case ShaderLanguage::OP_SUB: r_ret->real = p_a.real - p_b.real; break;
+				case ShaderLanguage::OP_MUL: r_ret->real = p_a.real * p_b.real; break;
+				case ShaderLanguage::OP_DIV: {
+					if (p_b.real == 0.0f)
+						return false;
+					r_ret->real = p_a.real / p_b.real;
+				} break;
+				default: return false;
+			}
+		} break;
+		default: return false;
+	}
+
+	return true;
+}
+
+template <class T>
+static bool _fold_compare_values(ShaderLanguage::Operator p_op, T p_a, T p_b, bool *r_ret) {
+
+	switch (p_op) {
+		case ShaderLanguage::OP_EQUAL: *r_ret = p_a == p_b; break;
+		case ShaderLanguage::OP_NOT_EQUAL: *r_ret = p_a != p_b; break;
+		case ShaderLanguage::OP_LESS: *r_ret = p_a < p_b; break;
+		case ShaderLanguage::OP_LESS_EQUAL: *r_ret = p_a <= p_b; break;
+		case ShaderLanguage::OP_GREATER: *r_ret = p_a > p_b; break;
+		case ShaderLanguage::OP_GREATER_EQUAL: *r_ret = p_a >= p_b; break;
+		default: return false;
+	}
+
+	return true;
+}
+
+static bool _fold_scalar_compare(ShaderLanguage::Operator p_op, ShaderLanguage::DataType p_base, const ShaderLanguage::ConstantNode::Value &p_a, const ShaderLanguage::ConstantNode::Value &p_b, bool *r_ret) {
+
+	switch (p_base) {
+		case ShaderLanguage::TYPE_BOOL: {
+			if (p_op == ShaderLanguage::OP_EQUAL) {
+				*r_ret = p_a.boolean == p_b.boolean;
+				return true;
+			} else if (p_op == ShaderLanguage::OP_NOT_EQUAL) {
+				*r_ret = p_a.boolean != p_b.boolean;
+				return true;
+			}
+			return false;
+		} break;
+		case ShaderLanguage::TYPE_INT: return _fold_compare_values(p_op, p_a.sint, p_b.sint, r_ret);
+		case ShaderLanguage::TYPE_UINT: return _fold_compare_values(p_op, p_a.uint, p_b.uint, r_ret);
+		case ShaderLanguage::TYPE_FLOAT: return _fold_compare_values(p_op, p_a.real, p_b.real, r_ret);
+		default: return false;
+	}
+}
+
+ShaderLanguage::Node *ShaderLanguage::_optimize_expression(Node *p_node, const Map<StringName, bool> *p_bool_uniform_values) {
+
+	if (p_node->type == Node::TYPE_VARIABLE) {
+
+		//specialize bool uniforms whose value the caller pinned down
+		if (p_bool_uniform_values) {
+			VariableNode *vn = static_cast<VariableNode *>(p_node);
+			const Map<StringName, bool>::Element *V = p_bool_uniform_values->find(vn->name);
+			if (V && shader->uniforms.has(vn->name) && shader->uniforms[vn->name].type == TYPE_BOOL) {
+				ConstantNode *cn = alloc_node<ConstantNode>();
+				cn->datatype = TYPE_BOOL;
+				ConstantNode::Value v;
+				v.boolean = V->get();
+				cn->values.push_back(v);
+				return cn;
+			}
+		}
+		return p_node;
+	}
+
+	if (p_node->type != Node::TYPE_OPERATOR)
+		return p_node;
+
+	OperatorNode *op = static_cast<OperatorNode *>(p_node);
+
+	//function/constructor names and assignment targets must not be rewritten
+	int first_arg = 0;
+	if (op->op == OP_CALL || op->op == OP_CONSTRUCT || _is_operator_assign(op->op))
+		first_arg = 1;
+
+	for (int i = first_arg; i < op->arguments.size(); i++) {
+		op->arguments.write[i] = _optimize_expression(op->arguments[i], p_bool_uniform_values);
+	}
+
+	if (op->op == OP_SELECT_IF && op->arguments[0]->type == Node::TYPE_CONSTANT) {
+
+		ConstantNode *cn = static_cast<ConstantNode *>(op->arguments[0]);
+		if (cn->datatype == TYPE_BOOL)
+			return cn->values[0].boolean ? op->arguments[1] : op->arguments[2];
+	}
+
+	if (op->op == OP_NOT && op->arguments[0]->type == Node::TYPE_CONSTANT) {
+
+		ConstantNode *cn = static_cast<ConstantNode *>(op->arguments[0]);
+		if (cn->datatype == TYPE_BOOL) {
+			ConstantNode *ncn = alloc_node<ConstantNode>();
+			ncn->datatype = TYPE_BOOL;
+			ConstantNode::Value v;
+			v.boolean = !cn->values[0].boolean;
+			ncn->values.push_back(v);
+			return ncn;
+		}
+	}
+
+	if ((op->op == OP_AND || op->op == OP_OR) && op->arguments[0]->type == Node::TYPE_CONSTANT) {
+
+		ConstantNode *cn = static_cast<ConstantNode *>(op->arguments[0]);
+		if (cn->datatype == TYPE_BOOL) {
+			bool a = cn->values[0].boolean;
+			if (op->op == OP_AND)
+				return a ? op->arguments[1] : op->arguments[0];
+			else
+				return a ? op->arguments[0] : op->arguments[1];
+		}
+	}
+
+	if (op->arguments.size() == 2 && op->arguments[0]->type == Node::TYPE_CONSTANT && op->arguments[1]->type == Node::TYPE_CONSTANT) {
+
+		ConstantNode *a = static_cast<ConstantNode *>(op->arguments[0]);
+		ConstantNode *b = static_cast<ConstantNode *>(op->arguments[1]);
+
+		if (a->datatype == b->datatype && a->values.size() == b->values.size()) {
+
+			DataType base = get_scalar_type(a->datatype);
+
+			if (a->values.size() == 1) {
+				bool cmp;
+				if (_fold_scalar_compare(op->op, base, a->values[0], b->values[0], &cmp)) {
+					ConstantNode *cn = alloc_node<ConstantNode>();
+					cn->datatype = TYPE_BOOL;
+					ConstantNode::Value v;
+					v.boolean = cmp;
+					cn->values.push_back(v);
+					return cn;
+				}
+			}
+
+			if (a->datatype < TYPE_MAT2) { //component-wise arithmetic, matrices have their own semantics
+				Vector<ConstantNode::Value> values;
+				values.resize(a->values.size());
+				bool folded = true;
+				for (int i = 0; i < a->values.size(); i++) {
+					if (!_fold_scalar_op(op->op, base, a->values[i], b->values[i], &values.write[i])) {
+						folded = false;
+						break;
+					}
+				}
+
+				if (folded) {
+					ConstantNode *cn = alloc_node<ConstantNode>();
+					cn->datatype = a->datatype;
+					cn->values = values;
+					return cn;
+				}
+			}
+		}
+	}
+
+	return p_node;
+}
+
+void ShaderLanguage::_optimize_block(BlockNode *p_block, const Map<StringName, bool> *p_bool_uniform_values) {
+
+	List<Node *>::Element *E = p_block->statements.front();
+
+	while (E) {
+
+		List<Node *>::Element *N = E->next();
+		Node *statement = E->get();
+
+		switch (statement->type) {
+			case Node::TYPE_CONTROL_FLOW: {
+
+				ControlFlowNode *cf = static_cast<ControlFlowNode *>(statement);
+
+				for (int i = 0; i < cf->expressions.size(); i++) {
+					cf->expressions.write[i] = _optimize_expression(cf->expressions[i], p_bool_uniform_values);
+				}
+				for (int i = 0; i < cf->blocks.size(); i++) {
+					_optimize_block(cf->blocks[i], p_bool_uniform_values);
+				}
+
+				if (cf->flow_op == FLOW_OP_IF && cf->expressions[0]->type == Node::TYPE_CONSTANT) {
+
+					ConstantNode *cn = static_cast<ConstantNode *>(cf->expressions[0]);
+					if (cn->datatype == TYPE_BOOL) {
+						//branch decided at compile time, keep only the taken block
+						if (cn->values[0].boolean) {
+							E->set(cf->blocks[0]);
+						} else if (cf->blocks.size() > 1) {
+							E->set(cf->blocks[1]);
+						} else {
+							p_block->statements.erase(E);
+						}
+					}
+				}
+			} break;
+			case Node::TYPE_OPERATOR: {
+				E->set(_optimize_expression(statement, p_bool_uniform_values));
+			} break;
+			case Node::TYPE_VARIABLE_DECLARATION: {
+
+				VariableDeclarationNode *vd = static_cast<VariableDeclarationNode *>(statement);
+				for (int i = 0; i < vd->declarations.size(); i++) {
+					if (vd->declarations[i].initializer) {
+						vd->declarations.write[i].initializer = _optimize_expression(vd->declarations[i].initializer, p_bool_uniform_values);
+					}
+				}
+			} break;
+			case Node::TYPE_ARRAY_DECLARATION: {
+
+				ArrayDeclarationNode *ad = static_cast<ArrayDeclarationNode *>(statement);
+				for (int i = 0; i < ad->declarations.size(); i++) {
+					for (int j = 0; j < ad->declarations[i].initializer.size(); j++) {
+						ad->declarations.write[i].initializer.write[j] = _optimize_expression(ad->declarations[i].initializer[j], p_bool_uniform_values);
+					}
+				}
+			} break;
+			case Node::TYPE_BLOCK: {
+				_optimize_block(static_cast<BlockNode *>(statement), p_bool_uniform_values);
+			} break;
+			default: {
+			}
+		}
+
+		E = N;
+	}
+}
+
+void ShaderLanguage::_mark_used_varyings(Node *p_node, Set<StringName> &r_used) {
+
+	switch (p_node->type) {
+		case Node::TYPE_VARIABLE: {
+
+			VariableNode *vn = static_cast<VariableNode *>(p_node);
+			if (shader->varyings.has(vn->name))
+				r_used.insert(vn->name);
+		} break;
+		case Node::TYPE_ARRAY: {
+
+			ArrayNode *an = static_cast<ArrayNode *>(p_node);
+			if (shader->varyings.has(an->name))
+				r_used.insert(an->name);
+			if (an->index_expression)
+				_mark_used_varyings(an->index_expression, r_used);
+			if (an->call_expression)
+				_mark_used_varyings(an->call_expression, r_used);
+		} break;
+		case Node::TYPE_OPERATOR: {
+
+			OperatorNode *op = static_cast<OperatorNode *>(p_node);
+			for (int i = 0; i < op->arguments.size(); i++) {
+				_mark_used_varyings(op->arguments[i], r_used);
+			}
+		} break;
+		case Node::TYPE_MEMBER: {
+
+			MemberNode *mn = static_cast<MemberNode *>(p_node);
+			if (mn->owner)
+				_mark_used_varyings(mn->owner, r_used);
+		} break;
+		case Node::TYPE_CONTROL_FLOW: {
+
+			ControlFlowNode *cf = static_cast<ControlFlowNode *>(p_node);
+			for (int i = 0; i < cf->expressions.size(); i++) {
+				_mark_used_varyings(cf->expressions[i], r_used);
+			}
+			for (int i = 0; i < cf->blocks.size(); i++) {
+				_mark_used_varyings(cf->blocks[i], r_used);
+			}
+		} break;
+		case Node::TYPE_BLOCK: {
+
+			BlockNode *bn = static_cast<BlockNode *>(p_node);
+			for (List<Node *>::Element *E = bn->statements.front(); E; E = E->next()) {
+				_mark_used_varyings(E->get(), r_used);
+			}
+		} break;
+		case Node::TYPE_VARIABLE_DECLARATION: {
+
+			VariableDeclarationNode *vd = static_cast<VariableDeclarationNode *>(p_node);
+			for (int i = 0; i < vd->declarations.size(); i++) {
+				if (vd->declarations[i].initializer)
+					_mark_used_varyings(vd->declarations[i].initializer, r_used);
+			}
+		} break;
+		case Node::TYPE_ARRAY_DECLARATION: {
+
+			ArrayDeclarationNode *ad = static_cast<ArrayDeclarationNode *>(p_node);
+			for (int i = 0; i < ad->declarations.size(); i++) {
+				for (int j = 0; j < ad->declarations[i].initializer.size(); j++) {
+					_mark_used_varyings(ad->declarations[i].initializer[j], r_used);
+				}
+			}
+		} break;
+		default: {
+		}
+	}
+}
+
+void ShaderLanguage::optimize(const Map<StringName, bool> *p_bool_uniform_values) {
+
+	if (!shader)
+		return;
+
+	for (int i = 0; i < shader->functions.size(); i++) {
+		_optimize_block(shader->functions[i].function->body, p_bool_uniform_values);
+	}
+
+	//varyings no statement references anymore can be dropped entirely
+	Set<StringName> used_varyings;
+	for (int i = 0; i < shader->functions.size(); i++) {
+		_mark_used_varyings(shader->functions[i].function->body, used_varyings);
+	}
+
+	List<StringName> dead_varyings;
+	for (Map<StringName, ShaderNode::Varying>::Element *E = shader->varyings.front(); E; E = E->next()) {
+		if (!used_varyings.has(E->key()))
+			dead_varyings.push_back(E->key());
+	}
+
+	for (List<StringName>::Element *E = dead_varyings.front(); E; E = E->next()) {
+		shader->varyings.erase(E->get());
+	}
+}
+
 Error ShaderLanguage::_parse_block(BlockNode *p_block, const Map<StringName, BuiltInInfo> &p_builtin_types, bool p_just_one, bool p_can_break, bool p_can_continue) {
 
 	while (true) {
@@ -752,6 +752,10 @@ private:
 	Node *_parse_expression(BlockNode *p_block, const Map<StringName, BuiltInInfo> &p_builtin_types);
 	ShaderLanguage::Node *_reduce_expression(BlockNode *p_block, ShaderLanguage::Node *p_node);
 
+	Node *_optimize_expression(Node *p_node, const Map<StringName, bool> *p_bool_uniform_values);
+	void _optimize_block(BlockNode *p_block, const Map<StringName, bool> *p_bool_uniform_values);
+	void _mark_used_varyings(Node *p_node, Set<StringName> &r_used);
+
 	Node *_parse_and_reduce_expression(BlockNode *p_block, const Map<StringName, BuiltInInfo> &p_builtin_types);
 	Error _parse_block(BlockNode *p_block, const Map<StringName, BuiltInInfo> &p_builtin_types, bool p_just_one = false, bool p_can_break = false, bool p_can_continue = false);
 	String _get_shader_type_list(const Set<String> &p_shader_types) const;
@@ -768,6 +772,11 @@ public:
 
 	static String get_shader_type(const String &p_code);
 	Error compile(const String &p_code, const Map<StringName, FunctionInfo> &p_functions, const Vector<StringName> &p_render_modes, const Set<String> &p_shader_types);
+	//post-parse optimization: folds constant expressions, strips branches whose
+	//condition is known at compile time and drops varyings nothing references.
+	//p_bool_uniform_values optionally pins bool uniforms to fixed values so
+	//backends can emit specialized shader variants without the runtime branches.
+	void optimize(const Map<StringName, bool> *p_bool_uniform_values = NULL);
 	Error complete(const String &p_code, const Map<StringName, FunctionInfo> &p_functions, const Vector<StringName> &p_render_modes, const Set<String> &p_shader_types, List<ScriptCodeCompletionOption> *r_options, String &r_call_hint);
 
 	String get_error_text();
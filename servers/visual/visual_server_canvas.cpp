@@ -54,12 +54,13 @@ void _collect_ysort_children(VisualServerCanvas::Item *p_canvas_item, Transform2
 	VisualServerCanvas::Item **child_items = p_canvas_item->child_items.ptrw();
 	for (int i = 0; i < child_item_count; i++) {
 		if (child_items[i]->visible) {
+			child_items[i]->ysort_modulate = p_modulate;
+			child_items[i]->ysort_xform = p_transform;
+			child_items[i]->ysort_pos = p_transform.xform(child_items[i]->xform.elements[2]);
+			child_items[i]->material_owner = child_items[i]->use_parent_material ? p_material_owner : NULL;
+
 			if (r_items) {
 				r_items[r_index] = child_items[i];
-				child_items[i]->ysort_modulate = p_modulate;
-				child_items[i]->ysort_xform = p_transform;
-				child_items[i]->ysort_pos = p_transform.xform(child_items[i]->xform.elements[2]);
-				child_items[i]->material_owner = child_items[i]->use_parent_material ? p_material_owner : NULL;
 			}
 
 			r_index++;
@@ -128,19 +129,58 @@ void VisualServerCanvas::_render_canvas_item(Item *p_canvas_item, const Transfor
 
 	if (ci->sort_y) {
 
-		if (ci->ysort_children_count == -1) {
+		bool rebuild = ci->ysort_children_count == -1;
+
+		if (rebuild) {
 			ci->ysort_children_count = 0;
 			_collect_ysort_children(ci, Transform2D(), p_material_owner, Color(1, 1, 1, 1), NULL, ci->ysort_children_count);
+			ci->ysort_cache.resize(ci->ysort_children_count);
 		}
 
 		child_item_count = ci->ysort_children_count;
-		child_items = (Item **)alloca(child_item_count * sizeof(Item *));
+		child_items = ci->ysort_cache.ptrw();
+
+		if (rebuild) {
+
+			int i = 0;
+			_collect_ysort_children(ci, Transform2D(), p_material_owner, Color(1, 1, 1, 1), child_items, i);
+
+			SortArray<Item *, ItemPtrSort> sorter;
+			sorter.sort(child_items, child_item_count);
+		} else {
+
+			//same children as last frame, just refresh their transforms and modulates
+			int i = 0;
+			_collect_ysort_children(ci, Transform2D(), p_material_owner, Color(1, 1, 1, 1), NULL, i);
+
+			//the cache keeps last frame's order, which is mostly sorted already, so
+			//repair it in place unless the order changed too much for that to pay off
+			ItemPtrSort compare;
+
+			int inversions = 0;
+			for (int j = 1; j < child_item_count; j++) {
+				if (compare(child_items[j], child_items[j - 1])) {
+					inversions++;
+				}
+			}
 
-		int i = 0;
-		_collect_ysort_children(ci, Transform2D(), p_material_owner, Color(1, 1, 1, 1), child_items, i);
+			if (inversions > child_item_count / 8) {
 
-		SortArray<Item *, ItemPtrSort> sorter;
-		sorter.sort(child_items, child_item_count);
+				SortArray<Item *, ItemPtrSort> sorter;
+				sorter.sort(child_items, child_item_count);
+			} else if (inversions > 0) {
+
+				for (int j = 1; j < child_item_count; j++) {
+					Item *key = child_items[j];
+					int k = j - 1;
+					while (k >= 0 && compare(key, child_items[k])) {
+						child_items[k + 1] = child_items[k];
+						k--;
+					}
+					child_items[k + 1] = key;
+				}
+			}
+		}
 	}
 
 	if (ci->z_relative)
@@ -298,6 +338,47 @@ void VisualServerCanvas::render_canvas(Canvas *p_canvas, const Transform2D &p_tr
 	VSG::canvas_render->canvas_end();
 }
 
+void VisualServerCanvas::_item_changed(Item *p_item) {
+
+	if (!p_item->root_canvas.is_valid()) {
+
+		Item *item = p_item;
+		while (canvas_item_owner.owns(item->parent)) {
+			item = canvas_item_owner.get(item->parent);
+		}
+		p_item->root_canvas = item->parent; //still invalid for detached subtrees, resolved again next time
+	}
+
+	Canvas *canvas = canvas_owner.getornull(p_item->root_canvas);
+	if (canvas) {
+		canvas->version++;
+	}
+}
+
+void VisualServerCanvas::_invalidate_root_canvas(Item *p_item) {
+
+	p_item->root_canvas = RID();
+	for (int i = 0; i < p_item->child_items.size(); i++) {
+		_invalidate_root_canvas(p_item->child_items[i]);
+	}
+}
+
+void VisualServerCanvas::_light_changed(RasterizerCanvas::Light *p_light) {
+
+	Canvas *canvas = canvas_owner.getornull(p_light->canvas);
+	if (canvas) {
+		canvas->version++;
+	}
+}
+
+void VisualServerCanvas::_occluder_changed(RasterizerCanvas::LightOccluderInstance *p_occluder) {
+
+	Canvas *canvas = canvas_owner.getornull(p_occluder->canvas);
+	if (canvas) {
+		canvas->version++;
+	}
+}
+
 RID VisualServerCanvas::canvas_create() {
 
 	Canvas *canvas = memnew(Canvas);
@@ -317,12 +398,14 @@ void VisualServerCanvas::canvas_set_item_mirroring(RID p_canvas, RID p_item, con
 	int idx = canvas->find_item(canvas_item);
 	ERR_FAIL_COND(idx == -1);
 	canvas->child_items.write[idx].mirror = p_mirroring;
+	canvas->version++;
 }
 void VisualServerCanvas::canvas_set_modulate(RID p_canvas, const Color &p_color) {
 
 	Canvas *canvas = canvas_owner.get(p_canvas);
 	ERR_FAIL_COND(!canvas);
 	canvas->modulate = p_color;
+	canvas->version++;
 }
 
 void VisualServerCanvas::canvas_set_disable_scale(bool p_disable) {
@@ -336,6 +419,7 @@ void VisualServerCanvas::canvas_set_parent(RID p_canvas, RID p_parent, float p_s
 
 	canvas->parent = p_parent;
 	canvas->parent_scale = p_scale;
+	canvas->version++;
 }
 
 RID VisualServerCanvas::canvas_item_create() {
@@ -351,6 +435,8 @@ void VisualServerCanvas::canvas_item_set_parent(RID p_item, RID p_parent) {
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_item_changed(canvas_item); //the canvas it leaves, if any
+
 	if (canvas_item->parent.is_valid()) {
 
 		if (canvas_owner.owns(canvas_item->parent)) {
@@ -395,11 +481,15 @@ void VisualServerCanvas::canvas_item_set_parent(RID p_item, RID p_parent) {
 	}
 
 	canvas_item->parent = p_parent;
+
+	_invalidate_root_canvas(canvas_item);
+	_item_changed(canvas_item); //the canvas it joins
 }
 void VisualServerCanvas::canvas_item_set_visible(RID p_item, bool p_visible) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->visible = p_visible;
 
@@ -409,6 +499,7 @@ void VisualServerCanvas::canvas_item_set_light_mask(RID p_item, int p_mask) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->light_mask = p_mask;
 }
@@ -417,6 +508,7 @@ void VisualServerCanvas::canvas_item_set_transform(RID p_item, const Transform2D
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->xform = p_transform;
 }
@@ -424,6 +516,7 @@ void VisualServerCanvas::canvas_item_set_clip(RID p_item, bool p_clip) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->clip = p_clip;
 }
@@ -431,6 +524,7 @@ void VisualServerCanvas::canvas_item_set_distance_field_mode(RID p_item, bool p_
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->distance_field = p_enable;
 }
@@ -438,6 +532,7 @@ void VisualServerCanvas::canvas_item_set_custom_rect(RID p_item, bool p_custom_r
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->custom_rect = p_custom_rect;
 	canvas_item->rect = p_rect;
@@ -446,6 +541,7 @@ void VisualServerCanvas::canvas_item_set_modulate(RID p_item, const Color &p_col
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->modulate = p_color;
 }
@@ -453,6 +549,7 @@ void VisualServerCanvas::canvas_item_set_self_modulate(RID p_item, const Color &
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->self_modulate = p_color;
 }
@@ -461,6 +558,7 @@ void VisualServerCanvas::canvas_item_set_draw_behind_parent(RID p_item, bool p_e
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->behind = p_enable;
 }
@@ -469,6 +567,7 @@ void VisualServerCanvas::canvas_item_set_update_when_visible(RID p_item, bool p_
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->update_when_visible = p_update;
 }
@@ -477,8 +576,9 @@ void VisualServerCanvas::canvas_item_add_line(RID p_item, const Point2 &p_from,
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
-	Item::CommandLine *line = memnew(Item::CommandLine);
+	Item::CommandLine *line = canvas_item->alloc_command<Item::CommandLine>(Item::Command::TYPE_LINE);
 	ERR_FAIL_COND(!line);
 	line->color = p_color;
 	line->from = p_from;
@@ -487,7 +587,6 @@ void VisualServerCanvas::canvas_item_add_line(RID p_item, const Point2 &p_from,
 	line->antialiased = p_antialiased;
 	canvas_item->rect_dirty = true;
 
-	canvas_item->commands.push_back(line);
 }
 
 void VisualServerCanvas::canvas_item_add_polyline(RID p_item, const Vector<Point2> &p_points, const Vector<Color> &p_colors, float p_width, bool p_antialiased) {
@@ -496,7 +595,7 @@ void VisualServerCanvas::canvas_item_add_polyline(RID p_item, const Vector<Point
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
-	Item::CommandPolyLine *pline = memnew(Item::CommandPolyLine);
+	Item::CommandPolyLine *pline = canvas_item->alloc_command<Item::CommandPolyLine>(Item::Command::TYPE_POLYLINE);
 	ERR_FAIL_COND(!pline);
 
 	pline->antialiased = p_antialiased;
@@ -572,7 +671,6 @@ void VisualServerCanvas::canvas_item_add_polyline(RID p_item, const Vector<Point
 		}
 	}
 	canvas_item->rect_dirty = true;
-	canvas_item->commands.push_back(pline);
 }
 
 void VisualServerCanvas::canvas_item_add_multiline(RID p_item, const Vector<Point2> &p_points, const Vector<Color> &p_colors, float p_width, bool p_antialiased) {
@@ -581,7 +679,7 @@ void VisualServerCanvas::canvas_item_add_multiline(RID p_item, const Vector<Poin
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
-	Item::CommandPolyLine *pline = memnew(Item::CommandPolyLine);
+	Item::CommandPolyLine *pline = canvas_item->alloc_command<Item::CommandPolyLine>(Item::Command::TYPE_POLYLINE);
 	ERR_FAIL_COND(!pline);
 
 	pline->antialiased = false; //todo
@@ -596,43 +694,43 @@ void VisualServerCanvas::canvas_item_add_multiline(RID p_item, const Vector<Poin
 	}
 
 	canvas_item->rect_dirty = true;
-	canvas_item->commands.push_back(pline);
 }
 
 void VisualServerCanvas::canvas_item_add_rect(RID p_item, const Rect2 &p_rect, const Color &p_color) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
-	Item::CommandRect *rect = memnew(Item::CommandRect);
+	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>(Item::Command::TYPE_RECT);
 	ERR_FAIL_COND(!rect);
 	rect->modulate = p_color;
 	rect->rect = p_rect;
 	canvas_item->rect_dirty = true;
 
-	canvas_item->commands.push_back(rect);
 }
 
 void VisualServerCanvas::canvas_item_add_circle(RID p_item, const Point2 &p_pos, float p_radius, const Color &p_color) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
-	Item::CommandCircle *circle = memnew(Item::CommandCircle);
+	Item::CommandCircle *circle = canvas_item->alloc_command<Item::CommandCircle>(Item::Command::TYPE_CIRCLE);
 	ERR_FAIL_COND(!circle);
 	circle->color = p_color;
 	circle->pos = p_pos;
 	circle->radius = p_radius;
 
-	canvas_item->commands.push_back(circle);
 }
 
 void VisualServerCanvas::canvas_item_add_texture_rect(RID p_item, const Rect2 &p_rect, RID p_texture, bool p_tile, const Color &p_modulate, bool p_transpose, RID p_normal_map) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
-	Item::CommandRect *rect = memnew(Item::CommandRect);
+	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>(Item::Command::TYPE_RECT);
 	ERR_FAIL_COND(!rect);
 	rect->modulate = p_modulate;
 	rect->rect = p_rect;
@@ -660,15 +758,15 @@ void VisualServerCanvas::canvas_item_add_texture_rect(RID p_item, const Rect2 &p
 	rect->texture = p_texture;
 	rect->normal_map = p_normal_map;
 	canvas_item->rect_dirty = true;
-	canvas_item->commands.push_back(rect);
 }
 
 void VisualServerCanvas::canvas_item_add_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate, bool p_transpose, RID p_normal_map, bool p_clip_uv) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
-	Item::CommandRect *rect = memnew(Item::CommandRect);
+	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>(Item::Command::TYPE_RECT);
 	ERR_FAIL_COND(!rect);
 	rect->modulate = p_modulate;
 	rect->rect = p_rect;
@@ -709,15 +807,15 @@ void VisualServerCanvas::canvas_item_add_texture_rect_region(RID p_item, const R
 
 	canvas_item->rect_dirty = true;
 
-	canvas_item->commands.push_back(rect);
 }
 
 void VisualServerCanvas::canvas_item_add_nine_patch(RID p_item, const Rect2 &p_rect, const Rect2 &p_source, RID p_texture, const Vector2 &p_topleft, const Vector2 &p_bottomright, VS::NinePatchAxisMode p_x_axis_mode, VS::NinePatchAxisMode p_y_axis_mode, bool p_draw_center, const Color &p_modulate, RID p_normal_map) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
-	Item::CommandNinePatch *style = memnew(Item::CommandNinePatch);
+	Item::CommandNinePatch *style = canvas_item->alloc_command<Item::CommandNinePatch>(Item::Command::TYPE_NINEPATCH);
 	ERR_FAIL_COND(!style);
 	style->texture = p_texture;
 	style->normal_map = p_normal_map;
@@ -733,14 +831,14 @@ void VisualServerCanvas::canvas_item_add_nine_patch(RID p_item, const Rect2 &p_r
 	style->axis_y = p_y_axis_mode;
 	canvas_item->rect_dirty = true;
 
-	canvas_item->commands.push_back(style);
 }
 void VisualServerCanvas::canvas_item_add_primitive(RID p_item, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, RID p_texture, float p_width, RID p_normal_map) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
-	Item::CommandPrimitive *prim = memnew(Item::CommandPrimitive);
+	Item::CommandPrimitive *prim = canvas_item->alloc_command<Item::CommandPrimitive>(Item::Command::TYPE_PRIMITIVE);
 	ERR_FAIL_COND(!prim);
 	prim->texture = p_texture;
 	prim->normal_map = p_normal_map;
@@ -750,13 +848,13 @@ void VisualServerCanvas::canvas_item_add_primitive(RID p_item, const Vector<Poin
 	prim->width = p_width;
 	canvas_item->rect_dirty = true;
 
-	canvas_item->commands.push_back(prim);
 }
 
 void VisualServerCanvas::canvas_item_add_polygon(RID p_item, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, RID p_texture, RID p_normal_map, bool p_antialiased) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 #ifdef DEBUG_ENABLED
 	int pointcount = p_points.size();
 	ERR_FAIL_COND(pointcount < 3);
@@ -768,7 +866,7 @@ void VisualServerCanvas::canvas_item_add_polygon(RID p_item, const Vector<Point2
 	Vector<int> indices = Geometry::triangulate_polygon(p_points);
 	ERR_FAIL_COND_MSG(indices.empty(), "Invalid polygon data, triangulation failed.");
 
-	Item::CommandPolygon *polygon = memnew(Item::CommandPolygon);
+	Item::CommandPolygon *polygon = canvas_item->alloc_command<Item::CommandPolygon>(Item::Command::TYPE_POLYGON);
 	ERR_FAIL_COND(!polygon);
 	polygon->texture = p_texture;
 	polygon->normal_map = p_normal_map;
@@ -781,13 +879,13 @@ void VisualServerCanvas::canvas_item_add_polygon(RID p_item, const Vector<Point2
 	polygon->antialiasing_use_indices = false;
 	canvas_item->rect_dirty = true;
 
-	canvas_item->commands.push_back(polygon);
 }
 
 void VisualServerCanvas::canvas_item_add_triangle_array(RID p_item, const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, const Vector<int> &p_bones, const Vector<float> &p_weights, RID p_texture, int p_count, RID p_normal_map, bool p_antialiased, bool p_antialiasing_use_indices) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
 	int vertex_count = p_points.size();
 	ERR_FAIL_COND(vertex_count == 0);
@@ -812,7 +910,7 @@ void VisualServerCanvas::canvas_item_add_triangle_array(RID p_item, const Vector
 			count = indices.size();
 	}
 
-	Item::CommandPolygon *polygon = memnew(Item::CommandPolygon);
+	Item::CommandPolygon *polygon = canvas_item->alloc_command<Item::CommandPolygon>(Item::Command::TYPE_POLYGON);
 	ERR_FAIL_COND(!polygon);
 	polygon->texture = p_texture;
 	polygon->normal_map = p_normal_map;
@@ -827,27 +925,27 @@ void VisualServerCanvas::canvas_item_add_triangle_array(RID p_item, const Vector
 	polygon->antialiasing_use_indices = p_antialiasing_use_indices;
 	canvas_item->rect_dirty = true;
 
-	canvas_item->commands.push_back(polygon);
 }
 
 void VisualServerCanvas::canvas_item_add_set_transform(RID p_item, const Transform2D &p_transform) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
-	Item::CommandTransform *tr = memnew(Item::CommandTransform);
+	Item::CommandTransform *tr = canvas_item->alloc_command<Item::CommandTransform>(Item::Command::TYPE_TRANSFORM);
 	ERR_FAIL_COND(!tr);
 	tr->xform = p_transform;
 
-	canvas_item->commands.push_back(tr);
 }
 
 void VisualServerCanvas::canvas_item_add_mesh(RID p_item, const RID &p_mesh, const Transform2D &p_transform, const Color &p_modulate, RID p_texture, RID p_normal_map) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
-	Item::CommandMesh *m = memnew(Item::CommandMesh);
+	Item::CommandMesh *m = canvas_item->alloc_command<Item::CommandMesh>(Item::Command::TYPE_MESH);
 	ERR_FAIL_COND(!m);
 	m->mesh = p_mesh;
 	m->texture = p_texture;
@@ -855,14 +953,14 @@ void VisualServerCanvas::canvas_item_add_mesh(RID p_item, const RID &p_mesh, con
 	m->transform = p_transform;
 	m->modulate = p_modulate;
 
-	canvas_item->commands.push_back(m);
 }
 void VisualServerCanvas::canvas_item_add_particles(RID p_item, RID p_particles, RID p_texture, RID p_normal) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
-	Item::CommandParticles *part = memnew(Item::CommandParticles);
+	Item::CommandParticles *part = canvas_item->alloc_command<Item::CommandParticles>(Item::Command::TYPE_PARTICLES);
 	ERR_FAIL_COND(!part);
 	part->particles = p_particles;
 	part->texture = p_texture;
@@ -872,39 +970,39 @@ void VisualServerCanvas::canvas_item_add_particles(RID p_item, RID p_particles,
 	VSG::storage->particles_request_process(p_particles);
 
 	canvas_item->rect_dirty = true;
-	canvas_item->commands.push_back(part);
 }
 
 void VisualServerCanvas::canvas_item_add_multimesh(RID p_item, RID p_mesh, RID p_texture, RID p_normal_map) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
-	Item::CommandMultiMesh *mm = memnew(Item::CommandMultiMesh);
+	Item::CommandMultiMesh *mm = canvas_item->alloc_command<Item::CommandMultiMesh>(Item::Command::TYPE_MULTIMESH);
 	ERR_FAIL_COND(!mm);
 	mm->multimesh = p_mesh;
 	mm->texture = p_texture;
 	mm->normal_map = p_normal_map;
 
 	canvas_item->rect_dirty = true;
-	canvas_item->commands.push_back(mm);
 }
 
 void VisualServerCanvas::canvas_item_add_clip_ignore(RID p_item, bool p_ignore) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
-	Item::CommandClipIgnore *ci = memnew(Item::CommandClipIgnore);
+	Item::CommandClipIgnore *ci = canvas_item->alloc_command<Item::CommandClipIgnore>(Item::Command::TYPE_CLIP_IGNORE);
 	ERR_FAIL_COND(!ci);
 	ci->ignore = p_ignore;
 
-	canvas_item->commands.push_back(ci);
 }
 void VisualServerCanvas::canvas_item_set_sort_children_by_y(RID p_item, bool p_enable) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->sort_y = p_enable;
 
@@ -923,6 +1021,7 @@ void VisualServerCanvas::canvas_item_set_z_as_relative_to_parent(RID p_item, boo
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->z_relative = p_enable;
 }
@@ -931,6 +1030,7 @@ void VisualServerCanvas::canvas_item_attach_skeleton(RID p_item, RID p_skeleton)
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->skeleton = p_skeleton;
 }
@@ -939,6 +1039,7 @@ void VisualServerCanvas::canvas_item_set_copy_to_backbuffer(RID p_item, bool p_e
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 	if (bool(canvas_item->copy_back_buffer != NULL) != p_enable) {
 		if (p_enable) {
 			canvas_item->copy_back_buffer = memnew(RasterizerCanvas::Item::CopyBackBuffer);
@@ -958,6 +1059,7 @@ void VisualServerCanvas::canvas_item_clear(RID p_item) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->clear();
 }
@@ -965,6 +1067,7 @@ void VisualServerCanvas::canvas_item_set_draw_index(RID p_item, int p_index) {
 
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->index = p_index;
 
@@ -985,6 +1088,7 @@ void VisualServerCanvas::canvas_item_set_material(RID p_item, RID p_material) {
 
 	Item *canvas_item = canvas_item_owner.get(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->material = p_material;
 }
@@ -993,6 +1097,7 @@ void VisualServerCanvas::canvas_item_set_use_parent_material(RID p_item, bool p_
 
 	Item *canvas_item = canvas_item_owner.get(p_item);
 	ERR_FAIL_COND(!canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->use_parent_material = p_enable;
 }
@@ -1007,6 +1112,7 @@ void VisualServerCanvas::canvas_light_attach_to_canvas(RID p_light, RID p_canvas
 
 	RasterizerCanvas::Light *clight = canvas_light_owner.get(p_light);
 	ERR_FAIL_COND(!clight);
+	_light_changed(clight);
 
 	if (clight->canvas.is_valid()) {
 
@@ -1023,6 +1129,7 @@ void VisualServerCanvas::canvas_light_attach_to_canvas(RID p_light, RID p_canvas
 
 		Canvas *canvas = canvas_owner.get(clight->canvas);
 		canvas->lights.insert(clight);
+		canvas->version++;
 	}
 }
 
@@ -1030,6 +1137,7 @@ void VisualServerCanvas::canvas_light_set_enabled(RID p_light, bool p_enabled) {
 
 	RasterizerCanvas::Light *clight = canvas_light_owner.get(p_light);
 	ERR_FAIL_COND(!clight);
+	_light_changed(clight);
 
 	clight->enabled = p_enabled;
 }
@@ -1037,6 +1145,7 @@ void VisualServerCanvas::canvas_light_set_scale(RID p_light, float p_scale) {
 
 	RasterizerCanvas::Light *clight = canvas_light_owner.get(p_light);
 	ERR_FAIL_COND(!clight);
+	_light_changed(clight);
 
 	clight->scale = p_scale;
 }
@@ -1044,6 +1153,7 @@ void VisualServerCanvas::canvas_light_set_transform(RID p_light, const Transform
 
 	RasterizerCanvas::Light *clight = canvas_light_owner.get(p_light);
 	ERR_FAIL_COND(!clight);
+	_light_changed(clight);
 
 	clight->xform = p_transform;
 }
@@ -1051,6 +1161,7 @@ void VisualServerCanvas::canvas_light_set_texture(RID p_light, RID p_texture) {
 
 	RasterizerCanvas::Light *clight = canvas_light_owner.get(p_light);
 	ERR_FAIL_COND(!clight);
+	_light_changed(clight);
 
 	clight->texture = p_texture;
 }
@@ -1058,6 +1169,7 @@ void VisualServerCanvas::canvas_light_set_texture_offset(RID p_light, const Vect
 
 	RasterizerCanvas::Light *clight = canvas_light_owner.get(p_light);
 	ERR_FAIL_COND(!clight);
+	_light_changed(clight);
 
 	clight->texture_offset = p_offset;
 }
@@ -1065,6 +1177,7 @@ void VisualServerCanvas::canvas_light_set_color(RID p_light, const Color &p_colo
 
 	RasterizerCanvas::Light *clight = canvas_light_owner.get(p_light);
 	ERR_FAIL_COND(!clight);
+	_light_changed(clight);
 
 	clight->color = p_color;
 }
@@ -1072,6 +1185,7 @@ void VisualServerCanvas::canvas_light_set_height(RID p_light, float p_height) {
 
 	RasterizerCanvas::Light *clight = canvas_light_owner.get(p_light);
 	ERR_FAIL_COND(!clight);
+	_light_changed(clight);
 
 	clight->height = p_height;
 }
@@ -1079,6 +1193,7 @@ void VisualServerCanvas::canvas_light_set_energy(RID p_light, float p_energy) {
 
 	RasterizerCanvas::Light *clight = canvas_light_owner.get(p_light);
 	ERR_FAIL_COND(!clight);
+	_light_changed(clight);
 
 	clight->energy = p_energy;
 }
@@ -1086,6 +1201,7 @@ void VisualServerCanvas::canvas_light_set_z_range(RID p_light, int p_min_z, int
 
 	RasterizerCanvas::Light *clight = canvas_light_owner.get(p_light);
 	ERR_FAIL_COND(!clight);
+	_light_changed(clight);
 
 	clight->z_min = p_min_z;
 	clight->z_max = p_max_z;
@@ -1094,6 +1210,7 @@ void VisualServerCanvas::canvas_light_set_layer_range(RID p_light, int p_min_lay
 
 	RasterizerCanvas::Light *clight = canvas_light_owner.get(p_light);
 	ERR_FAIL_COND(!clight);
+	_light_changed(clight);
 
 	clight->layer_max = p_max_layer;
 	clight->layer_min = p_min_layer;
@@ -1102,6 +1219,7 @@ void VisualServerCanvas::canvas_light_set_item_cull_mask(RID p_light, int p_mask
 
 	RasterizerCanvas::Light *clight = canvas_light_owner.get(p_light);
 	ERR_FAIL_COND(!clight);
+	_light_changed(clight);
 
 	clight->item_mask = p_mask;
 }
@@ -1109,6 +1227,7 @@ void VisualServerCanvas::canvas_light_set_item_shadow_cull_mask(RID p_light, int
 
 	RasterizerCanvas::Light *clight = canvas_light_owner.get(p_light);
 	ERR_FAIL_COND(!clight);
+	_light_changed(clight);
 
 	clight->item_shadow_mask = p_mask;
 }
@@ -1116,6 +1235,7 @@ void VisualServerCanvas::canvas_light_set_mode(RID p_light, VS::CanvasLightMode
 
 	RasterizerCanvas::Light *clight = canvas_light_owner.get(p_light);
 	ERR_FAIL_COND(!clight);
+	_light_changed(clight);
 
 	clight->mode = p_mode;
 }
@@ -1124,6 +1244,7 @@ void VisualServerCanvas::canvas_light_set_shadow_enabled(RID p_light, bool p_ena
 
 	RasterizerCanvas::Light *clight = canvas_light_owner.get(p_light);
 	ERR_FAIL_COND(!clight);
+	_light_changed(clight);
 
 	if (clight->shadow_buffer.is_valid() == p_enabled)
 		return;
@@ -1166,6 +1287,7 @@ void VisualServerCanvas::canvas_light_set_shadow_filter(RID p_light, VS::CanvasL
 
 	RasterizerCanvas::Light *clight = canvas_light_owner.get(p_light);
 	ERR_FAIL_COND(!clight);
+	_light_changed(clight);
 
 	clight->shadow_filter = p_filter;
 }
@@ -1173,6 +1295,7 @@ void VisualServerCanvas::canvas_light_set_shadow_color(RID p_light, const Color
 
 	RasterizerCanvas::Light *clight = canvas_light_owner.get(p_light);
 	ERR_FAIL_COND(!clight);
+	_light_changed(clight);
 
 	clight->shadow_color = p_color;
 }
@@ -1181,6 +1304,7 @@ void VisualServerCanvas::canvas_light_set_shadow_smooth(RID p_light, float p_smo
 
 	RasterizerCanvas::Light *clight = canvas_light_owner.get(p_light);
 	ERR_FAIL_COND(!clight);
+	_light_changed(clight);
 	clight->shadow_smooth = p_smooth;
 }
 
@@ -1194,6 +1318,7 @@ void VisualServerCanvas::canvas_light_occluder_attach_to_canvas(RID p_occluder,
 
 	RasterizerCanvas::LightOccluderInstance *occluder = canvas_light_occluder_owner.get(p_occluder);
 	ERR_FAIL_COND(!occluder);
+	_occluder_changed(occluder);
 
 	if (occluder->canvas.is_valid()) {
 
@@ -1210,12 +1335,14 @@ void VisualServerCanvas::canvas_light_occluder_attach_to_canvas(RID p_occluder,
 
 		Canvas *canvas = canvas_owner.get(occluder->canvas);
 		canvas->occluders.insert(occluder);
+		canvas->version++;
 	}
 }
 void VisualServerCanvas::canvas_light_occluder_set_enabled(RID p_occluder, bool p_enabled) {
 
 	RasterizerCanvas::LightOccluderInstance *occluder = canvas_light_occluder_owner.get(p_occluder);
 	ERR_FAIL_COND(!occluder);
+	_occluder_changed(occluder);
 
 	occluder->enabled = p_enabled;
 }
@@ -1223,6 +1350,7 @@ void VisualServerCanvas::canvas_light_occluder_set_polygon(RID p_occluder, RID p
 
 	RasterizerCanvas::LightOccluderInstance *occluder = canvas_light_occluder_owner.get(p_occluder);
 	ERR_FAIL_COND(!occluder);
+	_occluder_changed(occluder);
 
 	if (occluder->polygon.is_valid()) {
 		LightOccluderPolygon *occluder_poly = canvas_light_occluder_polygon_owner.get(p_polygon);
@@ -1251,6 +1379,7 @@ void VisualServerCanvas::canvas_light_occluder_set_transform(RID p_occluder, con
 
 	RasterizerCanvas::LightOccluderInstance *occluder = canvas_light_occluder_owner.get(p_occluder);
 	ERR_FAIL_COND(!occluder);
+	_occluder_changed(occluder);
 
 	occluder->xform = p_xform;
 }
@@ -1258,6 +1387,7 @@ void VisualServerCanvas::canvas_light_occluder_set_light_mask(RID p_occluder, in
 
 	RasterizerCanvas::LightOccluderInstance *occluder = canvas_light_occluder_owner.get(p_occluder);
 	ERR_FAIL_COND(!occluder);
+	_occluder_changed(occluder);
 
 	occluder->light_mask = p_mask;
 }
@@ -1319,6 +1449,7 @@ void VisualServerCanvas::canvas_occluder_polygon_set_shape_as_lines(RID p_occlud
 	VSG::storage->canvas_light_occluder_set_polylines(occluder_poly->occluder, p_shape);
 	for (Set<RasterizerCanvas::LightOccluderInstance *>::Element *E = occluder_poly->owners.front(); E; E = E->next()) {
 		E->get()->aabb_cache = occluder_poly->aabb;
+		_occluder_changed(E->get());
 	}
 }
 
@@ -1329,6 +1460,7 @@ void VisualServerCanvas::canvas_occluder_polygon_set_cull_mode(RID p_occluder_po
 	occluder_poly->cull_mode = p_mode;
 	for (Set<RasterizerCanvas::LightOccluderInstance *>::Element *E = occluder_poly->owners.front(); E; E = E->next()) {
 		E->get()->cull_cache = p_mode;
+		_occluder_changed(E->get());
 	}
 }
 
@@ -1375,6 +1507,8 @@ bool VisualServerCanvas::free(RID p_rid) {
 		Item *canvas_item = canvas_item_owner.get(p_rid);
 		ERR_FAIL_COND_V(!canvas_item, true);
 
+		_item_changed(canvas_item);
+
 		if (canvas_item->parent.is_valid()) {
 
 			if (canvas_owner.owns(canvas_item->parent)) {
@@ -1414,8 +1548,10 @@ bool VisualServerCanvas::free(RID p_rid) {
 
 		if (canvas_light->canvas.is_valid()) {
 			Canvas *canvas = canvas_owner.get(canvas_light->canvas);
-			if (canvas)
+			if (canvas) {
 				canvas->lights.erase(canvas_light);
+				canvas->version++;
+			}
 		}
 
 		if (canvas_light->shadow_buffer.is_valid())
@@ -1443,6 +1579,7 @@ bool VisualServerCanvas::free(RID p_rid) {
 
 			Canvas *canvas = canvas_owner.get(occluder->canvas);
 			canvas->occluders.erase(occluder);
+			canvas->version++;
 		}
 
 		canvas_light_occluder_owner.free(p_rid);
@@ -39,6 +39,7 @@ public:
 	struct Item : public RasterizerCanvas::Item {
 
 		RID parent; // canvas it belongs to
+		RID root_canvas; // cached topmost canvas, resolved lazily for change tracking
 		List<Item *>::Element *E;
 		int z_index;
 		bool z_relative;
@@ -54,6 +55,9 @@ public:
 		Vector2 ysort_pos;
 
 		Vector<Item *> child_items;
+		// flattened y-sorted children in last frame's order, rebuilt when
+		// ysort_children_count is marked dirty and repaired incrementally otherwise
+		Vector<Item *> ysort_cache;
 
 		Item() {
 			children_order_dirty = true;
@@ -129,6 +133,7 @@ public:
 		Color modulate;
 		RID parent;
 		float parent_scale;
+		uint64_t version; //incremented on change, for on-demand viewport updates
 
 		int find_item(Item *p_item) {
 			for (int i = 0; i < child_items.size(); i++) {
@@ -147,6 +152,7 @@ public:
 			modulate = Color(1, 1, 1, 1);
 			children_order_dirty = true;
 			parent_scale = 1.0;
+			version = 1;
 		}
 	};
 
@@ -161,6 +167,11 @@ private:
 	void _render_canvas_item(Item *p_canvas_item, const Transform2D &p_transform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, RasterizerCanvas::Item **z_list, RasterizerCanvas::Item **z_last_list, Item *p_canvas_clip, Item *p_material_owner);
 	void _light_mask_canvas_items(int p_z, RasterizerCanvas::Item *p_canvas_item, RasterizerCanvas::Light *p_masked_lights);
 
+	void _item_changed(Item *p_item);
+	void _invalidate_root_canvas(Item *p_item);
+	void _light_changed(RasterizerCanvas::Light *p_light);
+	void _occluder_changed(RasterizerCanvas::LightOccluderInstance *p_occluder);
+
 	RasterizerCanvas::Item **z_list;
 	RasterizerCanvas::Item **z_last_list;
 
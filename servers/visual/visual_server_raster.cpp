@@ -30,6 +30,7 @@
 
 #include "visual_server_raster.h"
 
+#include "core/engine.h"
 #include "core/io/marshalls.h"
 #include "core/os/os.h"
 #include "core/project_settings.h"
@@ -103,6 +104,8 @@ void VisualServerRaster::draw(bool p_swap_buffers, double frame_step) {
 
 	VSG::rasterizer->begin_frame(frame_step);
 
+	VSG::scene->update_interpolation(Engine::get_singleton()->get_physics_interpolation_fraction());
+	VSG::scene->advance_frame_pass(); //new visibility stamp for everything culled below
 	VSG::scene->update_dirty_instances(); //update scene stuff
 
 	VSG::viewport->draw_viewports();
@@ -265,6 +265,7 @@ public:
 	BIND2RC(Color, multimesh_instance_get_custom_data, RID, int)
 
 	BIND2(multimesh_set_as_bulk_array, RID, const PoolVector<float> &)
+	BIND3(multimesh_set_buffer_region, RID, int, const PoolVector<float> &)
 
 	BIND2(multimesh_set_visible_instances, RID, int)
 	BIND1RC(int, multimesh_get_visible_instances, RID)
@@ -281,6 +282,7 @@ public:
 	BIND2(immediate_uv2, RID, const Vector2 &)
 	BIND1(immediate_end, RID)
 	BIND1(immediate_clear, RID)
+	BIND9(immediate_set_buffer, RID, PrimitiveType, const PoolVector<Vector3> &, const PoolVector<Vector3> &, const PoolVector<Plane> &, const PoolVector<Color> &, const PoolVector<Vector2> &, const PoolVector<Vector2> &, RID)
 	BIND2(immediate_set_material, RID, RID)
 	BIND1RC(RID, immediate_get_material, RID)
 
@@ -290,6 +292,7 @@ public:
 	BIND3(skeleton_allocate, RID, int, bool)
 	BIND1RC(int, skeleton_get_bone_count, RID)
 	BIND3(skeleton_bone_set_transform, RID, int, const Transform &)
+	BIND2(skeleton_set_bone_transforms, RID, const Vector<Transform> &)
 	BIND2RC(Transform, skeleton_bone_get_transform, RID, int)
 	BIND3(skeleton_bone_set_transform_2d, RID, int, const Transform2D &)
 	BIND2RC(Transform2D, skeleton_bone_get_transform_2d, RID, int)
@@ -482,6 +485,7 @@ public:
 	BIND2(viewport_set_msaa, RID, ViewportMSAA)
 	BIND2(viewport_set_hdr, RID, bool)
 	BIND2(viewport_set_usage, RID, ViewportUsage)
+	BIND2(viewport_set_depth_prepass, RID, ViewportDepthPrepassMode)
 
 	BIND2R(int, viewport_get_render_info, RID, ViewportRenderInfo)
 	BIND2(viewport_set_debug_draw, RID, ViewportDebugDraw)
@@ -530,6 +534,20 @@ public:
 	BIND3(scenario_set_reflection_atlas_size, RID, int, int)
 	BIND2(scenario_set_fallback_environment, RID, RID)
 
+	/* ROOMS AND PORTALS API */
+
+	BIND0R(RID, room_create)
+
+	BIND2(room_set_scenario, RID, RID)
+	BIND2(room_set_bounds, RID, const Vector<Plane> &)
+
+	BIND0R(RID, portal_create)
+
+	BIND2(portal_set_scenario, RID, RID)
+	BIND2(portal_set_geometry, RID, const Vector<Vector3> &)
+	BIND3(portal_set_rooms, RID, RID, RID)
+	BIND2(portal_set_enabled, RID, bool)
+
 	/* INSTANCING API */
 	BIND0R(RID, instance_create)
 
@@ -537,10 +555,16 @@ public:
 	BIND2(instance_set_scenario, RID, RID)
 	BIND2(instance_set_layer_mask, RID, uint32_t)
 	BIND2(instance_set_transform, RID, const Transform &)
+	BIND2(instance_set_interpolated, RID, bool)
+	BIND1(instance_reset_physics_interpolation, RID)
 	BIND2(instance_attach_object_instance_id, RID, ObjectID)
 	BIND3(instance_set_blend_shape_weight, RID, int, float)
 	BIND3(instance_set_surface_material, RID, int, RID)
 	BIND2(instance_set_visible, RID, bool)
+	BIND1RC(bool, instance_is_visible, RID)
+	BIND2(instance_set_occluder, RID, bool)
+	BIND3(instance_add_lod_level, RID, RID, float)
+	BIND1(instance_clear_lod_levels, RID)
 	BIND3(instance_set_use_lightmap, RID, RID, RID)
 
 	BIND2(instance_set_custom_aabb, RID, AABB)
@@ -30,7 +30,10 @@
 
 #include "visual_server_scene.h"
 
+#include "core/engine.h"
 #include "core/os/os.h"
+#include "core/os/worker_thread_pool.h"
+#include "core/tracepoints.h"
 #include "visual_server_globals.h"
 #include "visual_server_raster.h"
 
@@ -48,6 +51,7 @@ void VisualServerScene::camera_set_perspective(RID p_camera, float p_fovy_degree
 
 	Camera *camera = camera_owner.get(p_camera);
 	ERR_FAIL_COND(!camera);
+	camera->version++;
 	camera->type = Camera::PERSPECTIVE;
 	camera->fov = p_fovy_degrees;
 	camera->znear = p_z_near;
@@ -58,6 +62,7 @@ void VisualServerScene::camera_set_orthogonal(RID p_camera, float p_size, float
 
 	Camera *camera = camera_owner.get(p_camera);
 	ERR_FAIL_COND(!camera);
+	camera->version++;
 	camera->type = Camera::ORTHOGONAL;
 	camera->size = p_size;
 	camera->znear = p_z_near;
@@ -67,6 +72,7 @@ void VisualServerScene::camera_set_orthogonal(RID p_camera, float p_size, float
 void VisualServerScene::camera_set_frustum(RID p_camera, float p_size, Vector2 p_offset, float p_z_near, float p_z_far) {
 	Camera *camera = camera_owner.get(p_camera);
 	ERR_FAIL_COND(!camera);
+	camera->version++;
 	camera->type = Camera::FRUSTUM;
 	camera->size = p_size;
 	camera->offset = p_offset;
@@ -78,6 +84,7 @@ void VisualServerScene::camera_set_transform(RID p_camera, const Transform &p_tr
 
 	Camera *camera = camera_owner.get(p_camera);
 	ERR_FAIL_COND(!camera);
+	camera->version++;
 	camera->transform = p_transform.orthonormalized();
 }
 
@@ -85,6 +92,7 @@ void VisualServerScene::camera_set_cull_mask(RID p_camera, uint32_t p_layers) {
 
 	Camera *camera = camera_owner.get(p_camera);
 	ERR_FAIL_COND(!camera);
+	camera->version++;
 
 	camera->visible_layers = p_layers;
 }
@@ -93,6 +101,7 @@ void VisualServerScene::camera_set_environment(RID p_camera, RID p_env) {
 
 	Camera *camera = camera_owner.get(p_camera);
 	ERR_FAIL_COND(!camera);
+	camera->version++;
 	camera->env = p_env;
 }
 
@@ -100,9 +109,17 @@ void VisualServerScene::camera_set_use_vertical_aspect(RID p_camera, bool p_enab
 
 	Camera *camera = camera_owner.get(p_camera);
 	ERR_FAIL_COND(!camera);
+	camera->version++;
 	camera->vaspect = p_enable;
 }
 
+uint64_t VisualServerScene::camera_get_version(RID p_camera) const {
+
+	const Camera *camera = camera_owner.get(p_camera);
+	ERR_FAIL_COND_V(!camera, 0);
+	return camera->version;
+}
+
 /* SCENARIO API */
 
 void *VisualServerScene::_instance_pair(void *p_self, OctreeElementID, Instance *p_A, int, OctreeElementID, Instance *p_B, int) {
@@ -130,6 +147,7 @@ void *VisualServerScene::_instance_pair(void *p_self, OctreeElementID, Instance
 		if (geom->can_cast_shadows) {
 
 			light->shadow_dirty = true;
+			light->static_shadow_version++;
 		}
 		geom->lighting_dirty = true;
 
@@ -207,6 +225,7 @@ void VisualServerScene::_instance_unpair(void *p_self, OctreeElementID, Instance
 
 		if (geom->can_cast_shadows) {
 			light->shadow_dirty = true;
+			light->static_shadow_version++;
 		}
 		geom->lighting_dirty = true;
 
@@ -302,10 +321,353 @@ void VisualServerScene::scenario_set_reflection_atlas_size(RID p_scenario, int p
 	VSG::scene_render->reflection_atlas_set_subdivision(scenario->reflection_atlas, p_subdiv);
 }
 
+uint64_t VisualServerScene::scenario_get_version(RID p_scenario) const {
+
+	const Scenario *scenario = scenario_owner.get(p_scenario);
+	ERR_FAIL_COND_V(!scenario, 0);
+	return scenario->version;
+}
+
+/* ROOMS AND PORTALS API */
+
+void VisualServerScene::_rooms_mark_dirty(Scenario *p_scenario) {
+
+	p_scenario->rooms_dirty = true;
+	p_scenario->version++;
+}
+
+RID VisualServerScene::room_create() {
+
+	Room *room = memnew(Room);
+	ERR_FAIL_COND_V(!room, RID());
+	RID room_rid = room_owner.make_rid(room);
+	room->self = room_rid;
+
+	return room_rid;
+}
+
+void VisualServerScene::room_set_scenario(RID p_room, RID p_scenario) {
+
+	Room *room = room_owner.get(p_room);
+	ERR_FAIL_COND(!room);
+
+	if (room->scenario) {
+
+		while (room->static_instances.front()) {
+			_room_unbake_instance(room->static_instances.front()->get());
+		}
+
+		room->scenario->rooms.erase(room->scenario_item);
+		room->scenario_item = NULL;
+		_rooms_mark_dirty(room->scenario);
+		room->scenario = NULL;
+	}
+
+	if (p_scenario.is_valid()) {
+
+		Scenario *scenario = scenario_owner.get(p_scenario);
+		ERR_FAIL_COND(!scenario);
+
+		room->scenario = scenario;
+		room->scenario_item = scenario->rooms.push_back(room);
+		_rooms_mark_dirty(scenario);
+	}
+}
+
+void VisualServerScene::room_set_bounds(RID p_room, const Vector<Plane> &p_convex) {
+
+	Room *room = room_owner.get(p_room);
+	ERR_FAIL_COND(!room);
+
+	room->bounds = p_convex;
+	if (room->scenario)
+		_rooms_mark_dirty(room->scenario);
+}
+
+RID VisualServerScene::portal_create() {
+
+	Portal *portal = memnew(Portal);
+	ERR_FAIL_COND_V(!portal, RID());
+	RID portal_rid = portal_owner.make_rid(portal);
+	portal->self = portal_rid;
+
+	return portal_rid;
+}
+
+void VisualServerScene::portal_set_scenario(RID p_portal, RID p_scenario) {
+
+	Portal *portal = portal_owner.get(p_portal);
+	ERR_FAIL_COND(!portal);
+
+	if (portal->scenario) {
+
+		portal->scenario->portals.erase(portal->scenario_item);
+		portal->scenario_item = NULL;
+		portal->scenario->version++;
+		portal->scenario = NULL;
+	}
+
+	if (p_scenario.is_valid()) {
+
+		Scenario *scenario = scenario_owner.get(p_scenario);
+		ERR_FAIL_COND(!scenario);
+
+		portal->scenario = scenario;
+		portal->scenario_item = scenario->portals.push_back(portal);
+		scenario->version++;
+	}
+}
+
+void VisualServerScene::portal_set_geometry(RID p_portal, const Vector<Vector3> &p_points) {
+
+	Portal *portal = portal_owner.get(p_portal);
+	ERR_FAIL_COND(!portal);
+
+	portal->points = p_points;
+	if (portal->scenario)
+		portal->scenario->version++;
+}
+
+void VisualServerScene::portal_set_rooms(RID p_portal, RID p_room_a, RID p_room_b) {
+
+	Portal *portal = portal_owner.get(p_portal);
+	ERR_FAIL_COND(!portal);
+
+	//rooms are kept by RID so a freed room degrades to a sealed portal
+	portal->rooms[0] = p_room_a;
+	portal->rooms[1] = p_room_b;
+	if (portal->scenario)
+		portal->scenario->version++;
+}
+
+void VisualServerScene::portal_set_enabled(RID p_portal, bool p_enabled) {
+
+	Portal *portal = portal_owner.get(p_portal);
+	ERR_FAIL_COND(!portal);
+
+	portal->enabled = p_enabled;
+	if (portal->scenario)
+		portal->scenario->version++;
+}
+
+void VisualServerScene::_room_unbake_instance(Instance *p_instance) {
+
+	p_instance->room->static_instances.erase(p_instance->room_item);
+	p_instance->room = NULL;
+	p_instance->room_item = NULL;
+
+	if (p_instance->cull_index >= 0)
+		p_instance->scenario->cull_room_flags.write[p_instance->cull_index] = 0;
+}
+
+void VisualServerScene::_rooms_bake(Scenario *p_scenario) {
+
+	p_scenario->rooms_dirty = false;
+
+	for (List<Room *>::Element *E = p_scenario->rooms.front(); E; E = E->next()) {
+
+		Room *room = E->get();
+		while (room->static_instances.front()) {
+			_room_unbake_instance(room->static_instances.front()->get());
+		}
+	}
+
+	if (p_scenario->rooms.empty())
+		return;
+
+	update_dirty_instances(); //assignment needs settled AABBs
+
+	for (SelfList<Instance> *E = p_scenario->instances.first(); E; E = E->next()) {
+
+		Instance *instance = E->self();
+
+		if (!((1 << instance->base_type) & VS::INSTANCE_GEOMETRY_MASK))
+			continue; //lights and probes are always culled globally
+		if (instance->interpolated)
+			continue; //physics interpolated movers are dynamic by definition
+
+		Room *room = _room_find_point(p_scenario, instance->transformed_aabb.position + instance->transformed_aabb.size * 0.5);
+		if (!room)
+			continue;
+
+		instance->room = room;
+		instance->room_item = room->static_instances.push_back(instance);
+		if (instance->cull_index >= 0)
+			p_scenario->cull_room_flags.write[instance->cull_index] = 1;
+	}
+}
+
+VisualServerScene::Room *VisualServerScene::_room_find_point(Scenario *p_scenario, const Vector3 &p_point) const {
+
+	for (const List<Room *>::Element *E = p_scenario->rooms.front(); E; E = E->next()) {
+
+		Room *room = E->get();
+
+		int plane_count = room->bounds.size();
+		if (plane_count < 4)
+			continue; //not a closed hull
+
+		const Plane *planes = room->bounds.ptr();
+		bool inside = true;
+		for (int i = 0; i < plane_count; i++) {
+			if (planes[i].is_point_over(p_point)) {
+				inside = false;
+				break;
+			}
+		}
+
+		if (inside)
+			return room;
+	}
+
+	return NULL;
+}
+
+void VisualServerScene::_cull_room(Scenario *p_scenario, Room *p_room, const Vector3 &p_camera_pos, const Vector<Plane> &p_planes, uint32_t p_layer_mask, Instance **p_results, int p_max_results, int &r_count, int p_depth) {
+
+	if (p_room->cull_pass == p_scenario->room_cull_pass)
+		return; //already gathered through a shorter portal chain
+	p_room->cull_pass = p_scenario->room_cull_pass;
+
+	const Plane *planes = p_planes.ptr();
+	int plane_count = p_planes.size();
+
+	for (List<Instance *>::Element *E = p_room->static_instances.front(); E; E = E->next()) {
+
+		Instance *instance = E->get();
+
+		if (!instance->visible || !(instance->layer_mask & p_layer_mask))
+			continue;
+		if (!instance->transformed_aabb.intersects_convex_shape(planes, plane_count))
+			continue;
+		if (r_count == p_max_results)
+			return;
+		p_results[r_count++] = instance;
+	}
+
+	if (p_depth >= MAX_ROOM_CULL_DEPTH)
+		return;
+
+	for (List<Portal *>::Element *E = p_scenario->portals.front(); E; E = E->next()) {
+
+		Portal *portal = E->get();
+
+		if (!portal->enabled || portal->points.size() < 3)
+			continue;
+
+		Room *target = NULL;
+		if (portal->rooms[0] == p_room->self)
+			target = room_owner.getornull(portal->rooms[1]);
+		else if (portal->rooms[1] == p_room->self)
+			target = room_owner.getornull(portal->rooms[0]);
+
+		if (!target || target->cull_pass == p_scenario->room_cull_pass)
+			continue;
+
+		const Vector3 *points = portal->points.ptr();
+		int point_count = portal->points.size();
+
+		//the portal polygon must intersect the current (clipped) frustum
+		bool culled = false;
+		for (int i = 0; i < plane_count; i++) {
+
+			bool all_over = true;
+			for (int j = 0; j < point_count; j++) {
+				if (!planes[i].is_point_over(points[j])) {
+					all_over = false;
+					break;
+				}
+			}
+			if (all_over) {
+				culled = true;
+				break;
+			}
+		}
+
+		if (culled)
+			continue;
+
+		Plane portal_plane(points[0], points[1], points[2]);
+		if (Math::abs(portal_plane.distance_to(p_camera_pos)) < CMP_EPSILON) {
+			//camera is standing in the doorway, the portal narrows nothing
+			_cull_room(p_scenario, target, p_camera_pos, p_planes, p_layer_mask, p_results, p_max_results, r_count, p_depth + 1);
+			continue;
+		}
+
+		//clip the frustum for the next room: keep the current planes and
+		//add one plane per portal edge through the camera, plus the portal
+		//plane itself, so only what is visible through the hole survives
+
+		Vector<Plane> portal_planes = p_planes;
+
+		if (!portal_plane.is_point_over(p_camera_pos))
+			portal_plane = -portal_plane;
+		portal_planes.push_back(portal_plane); //rejects the camera side of the portal
+
+		Vector3 centroid;
+		for (int i = 0; i < point_count; i++) {
+			centroid += points[i];
+		}
+		centroid /= point_count;
+
+		for (int i = 0; i < point_count; i++) {
+
+			Plane edge_plane(p_camera_pos, points[i], points[(i + 1) % point_count]);
+			if (edge_plane.normal == Vector3())
+				continue; //degenerate edge
+			if (edge_plane.is_point_over(centroid))
+				edge_plane = -edge_plane; //outward, like the frustum planes
+			portal_planes.push_back(edge_plane);
+		}
+
+		_cull_room(p_scenario, target, p_camera_pos, portal_planes, p_layer_mask, p_results, p_max_results, r_count, p_depth + 1);
+	}
+}
+
+bool VisualServerScene::_cull_rooms(Scenario *p_scenario, const Vector3 &p_camera_pos, const Vector<Plane> &p_planes, uint32_t p_layer_mask, Instance **p_results, int p_max_results, int &r_count) {
+
+	Room *camera_room = _room_find_point(p_scenario, p_camera_pos);
+	if (!camera_room)
+		return false; //outside every room, fall back to plain frustum culling
+
+	p_scenario->room_cull_pass++;
+
+	r_count = 0;
+	_cull_room(p_scenario, camera_room, p_camera_pos, p_planes, p_layer_mask, p_results, p_max_results, r_count, 0);
+
+	//instances not baked into any room (dynamic objects, lights, probes)
+	//are culled against the plain camera frustum as before
+
+	int total = p_scenario->cull_instances.size();
+	const AABB *aabbs = p_scenario->cull_aabbs.ptr();
+	const uint32_t *masks = p_scenario->cull_masks.ptr();
+	const uint8_t *room_flags = p_scenario->cull_room_flags.ptr();
+	const Plane *planes = p_planes.ptr();
+	int plane_count = p_planes.size();
+
+	for (int i = 0; i < total; i++) {
+
+		if (room_flags[i])
+			continue;
+		if (!(masks[i] & p_layer_mask))
+			continue;
+		if (!aabbs[i].intersects_convex_shape(planes, plane_count))
+			continue;
+		if (r_count == p_max_results)
+			break;
+		p_results[r_count++] = p_scenario->cull_instances[i];
+	}
+
+	return true;
+}
+
 /* INSTANCING API */
 
 void VisualServerScene::_instance_queue_update(Instance *p_instance, bool p_update_aabb, bool p_update_materials) {
 
+	if (p_instance->scenario)
+		p_instance->scenario->version++;
+
 	if (p_update_aabb)
 		p_instance->update_aabb = true;
 	if (p_update_materials)
@@ -360,6 +722,7 @@ void VisualServerScene::instance_set_base(RID p_instance, RID p_base) {
 		if (scenario && instance->octree_id) {
 			scenario->octree.erase(instance->octree_id); //make dependencies generated by the octree go away
 			instance->octree_id = 0;
+			_cull_array_remove(instance);
 		}
 
 		switch (instance->base_type) {
@@ -508,11 +871,13 @@ void VisualServerScene::instance_set_scenario(RID p_instance, RID p_scenario) {
 
 	if (instance->scenario) {
 
+		instance->scenario->version++;
 		instance->scenario->instances.remove(&instance->scenario_item);
 
 		if (instance->octree_id) {
 			instance->scenario->octree.erase(instance->octree_id); //make dependencies generated by the octree go away
 			instance->octree_id = 0;
+			_cull_array_remove(instance);
 		}
 
 		switch (instance->base_type) {
@@ -542,6 +907,15 @@ void VisualServerScene::instance_set_scenario(RID p_instance, RID p_scenario) {
 			}
 		}
 
+		if (instance->occluder_item) {
+			instance->scenario->occluders.erase(instance->occluder_item);
+			instance->occluder_item = NULL;
+		}
+
+		if (instance->room) {
+			_room_unbake_instance(instance);
+		}
+
 		instance->scenario = NULL;
 	}
 
@@ -554,6 +928,10 @@ void VisualServerScene::instance_set_scenario(RID p_instance, RID p_scenario) {
 
 		scenario->instances.add(&instance->scenario_item);
 
+		if (instance->occluder) {
+			instance->occluder_item = scenario->occluders.push_back(instance);
+		}
+
 		switch (instance->base_type) {
 
 			case VS::INSTANCE_LIGHT: {
@@ -584,13 +962,14 @@ void VisualServerScene::instance_set_layer_mask(RID p_instance, uint32_t p_mask)
 	ERR_FAIL_COND(!instance);
 
 	instance->layer_mask = p_mask;
+	_cull_array_update_mask(instance);
 }
 void VisualServerScene::instance_set_transform(RID p_instance, const Transform &p_transform) {
 
 	Instance *instance = instance_owner.get(p_instance);
 	ERR_FAIL_COND(!instance);
 
-	if (instance->transform == p_transform)
+	if (!instance->interpolated && instance->transform == p_transform)
 		return; //must be checked to avoid worst evil
 
 #ifdef DEBUG_ENABLED
@@ -606,9 +985,59 @@ void VisualServerScene::instance_set_transform(RID p_instance, const Transform &
 	}
 
 #endif
+
+	if (instance->interpolated) {
+		//keep the previous physics tick's transform around, the render
+		//frames in between blend the two; only the first update of a tick
+		//pushes curr to prev, so several updates per tick behave
+		uint64_t tick = Engine::get_singleton()->get_physics_frames();
+		if (tick != instance->transform_tick) {
+			instance->transform_prev = instance->transform_curr;
+			instance->transform_tick = tick;
+		}
+		instance->transform_curr = p_transform;
+
+		if (!instance->interpolate_item.in_list()) {
+			_interpolate_list.add(&instance->interpolate_item);
+		}
+		return; //the real transform is applied in update_interpolation()
+	}
+
+	if (instance->room) {
+		//moved after the static bake, so it is dynamic: cull it globally from now on
+		_room_unbake_instance(instance);
+	}
+
 	instance->transform = p_transform;
 	_instance_queue_update(instance, true);
 }
+
+void VisualServerScene::instance_set_interpolated(RID p_instance, bool p_interpolated) {
+
+	Instance *instance = instance_owner.get(p_instance);
+	ERR_FAIL_COND(!instance);
+
+	if (instance->interpolated == p_interpolated)
+		return;
+
+	instance->interpolated = p_interpolated;
+	instance->transform_prev = instance->transform;
+	instance->transform_curr = instance->transform;
+	instance->transform_tick = Engine::get_singleton()->get_physics_frames();
+
+	if (!p_interpolated && instance->interpolate_item.in_list()) {
+		_interpolate_list.remove(&instance->interpolate_item);
+	}
+}
+
+void VisualServerScene::instance_reset_physics_interpolation(RID p_instance) {
+
+	Instance *instance = instance_owner.get(p_instance);
+	ERR_FAIL_COND(!instance);
+
+	//teleport: snap to the latest transform instead of blending across it
+	instance->transform_prev = instance->transform_curr;
+}
 void VisualServerScene::instance_attach_object_instance_id(RID p_instance, ObjectID p_id) {
 
 	Instance *instance = instance_owner.get(p_instance);
@@ -661,6 +1090,10 @@ void VisualServerScene::instance_set_visible(RID p_instance, bool p_visible) {
 		return;
 
 	instance->visible = p_visible;
+	_cull_array_update_mask(instance);
+
+	if (instance->scenario)
+		instance->scenario->version++;
 
 	switch (instance->base_type) {
 		case VS::INSTANCE_LIGHT: {
@@ -691,6 +1124,68 @@ void VisualServerScene::instance_set_visible(RID p_instance, bool p_visible) {
 		}
 	}
 }
+
+bool VisualServerScene::instance_is_visible(RID p_instance) const {
+
+	const Instance *instance = const_cast<VisualServerScene *>(this)->instance_owner.getornull(p_instance);
+	ERR_FAIL_COND_V(!instance, false);
+
+	//stamped during the camera cull of the last drawn frame; allow one frame
+	//of slack since scene-side queries run before the current frame is drawn
+	return instance->visible && instance->last_frame_pass + 1 >= frame_pass;
+}
+
+void VisualServerScene::instance_set_occluder(RID p_instance, bool p_enabled) {
+
+	Instance *instance = instance_owner.get(p_instance);
+	ERR_FAIL_COND(!instance);
+
+	if (instance->occluder == p_enabled)
+		return;
+
+	instance->occluder = p_enabled;
+
+	if (instance->scenario) {
+		if (p_enabled) {
+			instance->occluder_item = instance->scenario->occluders.push_back(instance);
+		} else if (instance->occluder_item) {
+			instance->scenario->occluders.erase(instance->occluder_item);
+			instance->occluder_item = NULL;
+		}
+	}
+}
+
+void VisualServerScene::instance_add_lod_level(RID p_instance, RID p_mesh, float p_distance) {
+
+	Instance *instance = instance_owner.get(p_instance);
+	ERR_FAIL_COND(!instance);
+	ERR_FAIL_COND(!p_mesh.is_valid());
+
+	Instance::LODLevel level;
+	level.mesh = p_mesh;
+	level.distance = p_distance;
+
+	//keep sorted by distance so selection is a single forward scan
+	int pos = instance->lod_levels.size();
+	for (int i = 0; i < instance->lod_levels.size(); i++) {
+		if (p_distance < instance->lod_levels[i].distance) {
+			pos = i;
+			break;
+		}
+	}
+
+	instance->lod_levels.insert(pos, level);
+}
+
+void VisualServerScene::instance_clear_lod_levels(RID p_instance) {
+
+	Instance *instance = instance_owner.get(p_instance);
+	ERR_FAIL_COND(!instance);
+
+	instance->lod_levels.clear();
+	instance->lod_mesh = RID();
+}
+
 inline bool is_geometry_instance(VisualServer::InstanceType p_type) {
 	return p_type == VS::INSTANCE_MESH || p_type == VS::INSTANCE_MULTIMESH || p_type == VS::INSTANCE_PARTICLES || p_type == VS::INSTANCE_IMMEDIATE;
 }
@@ -898,6 +1393,82 @@ void VisualServerScene::instance_geometry_set_draw_range(RID p_instance, float p
 void VisualServerScene::instance_geometry_set_as_instance_lod(RID p_instance, RID p_as_lod_of_instance) {
 }
 
+void VisualServerScene::_cull_array_add(Instance *p_instance, const AABB &p_aabb) {
+
+	Scenario *scenario = p_instance->scenario;
+
+	p_instance->cull_index = scenario->cull_instances.size();
+	scenario->cull_aabbs.push_back(p_aabb);
+	scenario->cull_masks.push_back(p_instance->visible ? p_instance->layer_mask : 0);
+	scenario->cull_instances.push_back(p_instance);
+	scenario->cull_room_flags.push_back(p_instance->room ? 1 : 0);
+}
+
+void VisualServerScene::_cull_array_move(Instance *p_instance, const AABB &p_aabb) {
+
+	ERR_FAIL_COND(p_instance->cull_index < 0);
+	p_instance->scenario->cull_aabbs.write[p_instance->cull_index] = p_aabb;
+}
+
+void VisualServerScene::_cull_array_update_mask(Instance *p_instance) {
+
+	if (p_instance->cull_index < 0)
+		return;
+	p_instance->scenario->cull_masks.write[p_instance->cull_index] = p_instance->visible ? p_instance->layer_mask : 0;
+}
+
+void VisualServerScene::_cull_array_remove(Instance *p_instance) {
+
+	if (p_instance->cull_index < 0)
+		return;
+
+	Scenario *scenario = p_instance->scenario;
+	int32_t index = p_instance->cull_index;
+	int32_t last = scenario->cull_instances.size() - 1;
+
+	if (index != last) {
+		//swap-remove, keep the arrays dense
+		scenario->cull_aabbs.write[index] = scenario->cull_aabbs[last];
+		scenario->cull_masks.write[index] = scenario->cull_masks[last];
+		scenario->cull_instances.write[index] = scenario->cull_instances[last];
+		scenario->cull_room_flags.write[index] = scenario->cull_room_flags[last];
+		scenario->cull_instances[index]->cull_index = index;
+	}
+
+	scenario->cull_aabbs.resize(last);
+	scenario->cull_masks.resize(last);
+	scenario->cull_instances.resize(last);
+	scenario->cull_room_flags.resize(last);
+	p_instance->cull_index = -1;
+}
+
+int VisualServerScene::_cull_convex_linear(Scenario *p_scenario, const Vector<Plane> &p_planes, uint32_t p_layer_mask, Instance **p_results, int p_max_results) const {
+
+	//linear sweep over the packed AABB/mask arrays; the layer mask test
+	//also rejects invisible instances (their mirrored mask is zero)
+
+	int total = p_scenario->cull_instances.size();
+	const AABB *aabbs = p_scenario->cull_aabbs.ptr();
+	const uint32_t *masks = p_scenario->cull_masks.ptr();
+	const Plane *planes = p_planes.ptr();
+	int plane_count = p_planes.size();
+
+	int count = 0;
+
+	for (int i = 0; i < total; i++) {
+
+		if (!(masks[i] & p_layer_mask))
+			continue;
+		if (!aabbs[i].intersects_convex_shape(planes, plane_count))
+			continue;
+		if (count == p_max_results)
+			break;
+		p_results[count++] = p_scenario->cull_instances[i];
+	}
+
+	return count;
+}
+
 void VisualServerScene::_update_instance(Instance *p_instance) {
 
 	p_instance->version++;
@@ -908,6 +1479,7 @@ void VisualServerScene::_update_instance(Instance *p_instance) {
 
 		VSG::scene_render->light_instance_set_transform(light->instance, p_instance->transform);
 		light->shadow_dirty = true;
+		light->static_shadow_version++;
 	}
 
 	if (p_instance->base_type == VS::INSTANCE_REFLECTION_PROBE) {
@@ -936,9 +1508,15 @@ void VisualServerScene::_update_instance(Instance *p_instance) {
 			for (List<Instance *>::Element *E = geom->lighting.front(); E; E = E->next()) {
 				InstanceLightData *light = static_cast<InstanceLightData *>(E->get()->base_data);
 				light->shadow_dirty = true;
+				if (p_instance->last_move_pass + STATIC_SHADOW_PASSES <= render_pass) {
+					//caster was part of the static shadow layer, which is now stale
+					light->static_shadow_version++;
+				}
 			}
 		}
 
+		p_instance->last_move_pass = render_pass;
+
 		if (!p_instance->lightmap_capture && geom->lightmap_captures.size()) {
 			//affected by lightmap captures, must update capture info!
 			_update_instance_lightmap_captures(p_instance);
@@ -982,6 +1560,7 @@ void VisualServerScene::_update_instance(Instance *p_instance) {
 
 		// not inside octree
 		p_instance->octree_id = p_instance->scenario->octree.create(p_instance, new_aabb, 0, pairable, base_type, pairable_mask);
+		_cull_array_add(p_instance, new_aabb);
 
 	} else {
 
@@ -991,6 +1570,7 @@ void VisualServerScene::_update_instance(Instance *p_instance) {
 		*/
 
 		p_instance->scenario->octree.move(p_instance->octree_id, new_aabb);
+		_cull_array_move(p_instance, new_aabb);
 	}
 }
 
@@ -1302,6 +1882,51 @@ void VisualServerScene::_update_instance_lightmap_captures(Instance *p_instance)
 	}
 }
 
+bool VisualServerScene::_light_static_shadow_valid(InstanceLightData *p_light) const {
+
+	if (p_light->cached_static_version != p_light->static_shadow_version)
+		return false;
+
+	//check for casters that moved after the cache was rendered but have settled since;
+	//they are part of the static layer now but missing from the cached one
+	for (const List<InstanceLightData::PairInfo>::Element *E = p_light->geometries.front(); E; E = E->next()) {
+
+		Instance *geometry = E->get().geometry;
+		if (!static_cast<InstanceGeometryData *>(geometry->base_data)->can_cast_shadows)
+			continue;
+		if (geometry->last_move_pass > p_light->cached_static_pass && geometry->last_move_pass + STATIC_SHADOW_PASSES <= render_pass)
+			return false;
+	}
+
+	return true;
+}
+
+void VisualServerScene::_render_shadow_pass_cached(InstanceLightData *p_light, RID p_shadow_atlas, int p_pass, bool p_static_valid, Instance **p_casters, int p_caster_count) {
+
+	//partition static casters to the front
+	int static_count = 0;
+	for (int i = 0; i < p_caster_count; i++) {
+		if (p_casters[i]->last_move_pass + STATIC_SHADOW_PASSES <= render_pass) {
+			SWAP(p_casters[i], p_casters[static_count]);
+			static_count++;
+		}
+	}
+
+	if (p_static_valid && VSG::scene_render->shadow_atlas_cache_shadow(p_shadow_atlas, p_light->instance, p_pass, false)) {
+		//static layer restored from the cache, only draw the dynamic casters on top of it
+		VSG::scene_render->render_shadow(p_light->instance, p_shadow_atlas, p_pass, (RasterizerScene::InstanceBase **)&p_casters[static_count], p_caster_count - static_count, false);
+		return;
+	}
+
+	//draw the static layer, cache it, then the dynamic casters on top
+	VSG::scene_render->render_shadow(p_light->instance, p_shadow_atlas, p_pass, (RasterizerScene::InstanceBase **)p_casters, static_count);
+	VSG::scene_render->shadow_atlas_cache_shadow(p_shadow_atlas, p_light->instance, p_pass, true);
+
+	if (p_caster_count > static_count) {
+		VSG::scene_render->render_shadow(p_light->instance, p_shadow_atlas, p_pass, (RasterizerScene::InstanceBase **)&p_casters[static_count], p_caster_count - static_count, false);
+	}
+}
+
 bool VisualServerScene::_light_instance_update_shadow(Instance *p_instance, const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, RID p_shadow_atlas, Scenario *p_scenario) {
 
 	InstanceLightData *light = static_cast<InstanceLightData *>(p_instance->base_data);
@@ -1311,6 +1936,10 @@ bool VisualServerScene::_light_instance_update_shadow(Instance *p_instance, cons
 
 	bool animated_material_found = false;
 
+	bool shadow_cache_supported = VSG::scene_render->is_shadow_atlas_static_cache_enabled(p_shadow_atlas);
+	bool static_valid = shadow_cache_supported && _light_static_shadow_valid(light);
+	bool used_static_cache = false;
+
 	switch (VSG::storage->light_get_type(p_instance->base)) {
 
 		case VS::LIGHT_DIRECTIONAL: {
@@ -1611,7 +2240,12 @@ bool VisualServerScene::_light_instance_update_shadow(Instance *p_instance, cons
 					}
 
 					VSG::scene_render->light_instance_set_shadow_transform(light->instance, CameraMatrix(), light_transform, radius, 0, i);
-					VSG::scene_render->render_shadow(light->instance, p_shadow_atlas, i, (RasterizerScene::InstanceBase **)instance_shadow_cull_result, cull_count);
+					if (shadow_cache_supported && shadow_mode == VS::LIGHT_OMNI_SHADOW_DUAL_PARABOLOID) {
+						_render_shadow_pass_cached(light, p_shadow_atlas, i, static_valid, instance_shadow_cull_result, cull_count);
+						used_static_cache = true;
+					} else {
+						VSG::scene_render->render_shadow(light->instance, p_shadow_atlas, i, (RasterizerScene::InstanceBase **)instance_shadow_cull_result, cull_count);
+					}
 				}
 			} else { //shadow cube
 
@@ -1701,11 +2335,21 @@ bool VisualServerScene::_light_instance_update_shadow(Instance *p_instance, cons
 			}
 
 			VSG::scene_render->light_instance_set_shadow_transform(light->instance, cm, light_transform, radius, 0, 0);
-			VSG::scene_render->render_shadow(light->instance, p_shadow_atlas, 0, (RasterizerScene::InstanceBase **)instance_shadow_cull_result, cull_count);
+			if (shadow_cache_supported) {
+				_render_shadow_pass_cached(light, p_shadow_atlas, 0, static_valid, instance_shadow_cull_result, cull_count);
+				used_static_cache = true;
+			} else {
+				VSG::scene_render->render_shadow(light->instance, p_shadow_atlas, 0, (RasterizerScene::InstanceBase **)instance_shadow_cull_result, cull_count);
+			}
 
 		} break;
 	}
 
+	if (used_static_cache && !static_valid) {
+		light->cached_static_version = light->static_shadow_version;
+		light->cached_static_pass = render_pass;
+	}
+
 	return animated_material_found;
 }
 
@@ -1713,6 +2357,9 @@ void VisualServerScene::render_camera(RID p_camera, RID p_scenario, Size2 p_view
 // render to mono camera
 #ifndef _3D_DISABLED
 
+	TRACE_SCOPE("render_camera");
+	MEM_DOMAIN_SCOPE(DOMAIN_RENDERING);
+
 	Camera *camera = camera_owner.getornull(p_camera);
 	ERR_FAIL_COND(!camera);
 
@@ -1844,6 +2491,114 @@ void VisualServerScene::render_camera(Ref<ARVRInterface> &p_interface, ARVRInter
 	_render_scene(cam_transform, camera_matrix, false, camera->env, p_scenario, p_shadow_atlas, RID(), -1);
 };
 
+void VisualServerScene::_classify_cull_chunk_task(void *p_userdata, uint32_t p_chunk) {
+
+	const CullClassifyData *data = (const CullClassifyData *)p_userdata;
+	uint32_t from = p_chunk * CULL_CHUNK_SIZE;
+	uint32_t to = MIN(from + CULL_CHUNK_SIZE, (uint32_t)data->scene->instance_cull_count);
+	data->scene->_classify_cull_chunk(data, from, to);
+}
+
+void VisualServerScene::_classify_cull_chunk(const CullClassifyData *p_data, uint32_t p_from, uint32_t p_to) {
+
+	//classify culled instances and do the per-instance work that touches no
+	//shared state (pairing list rebuilds, depth); runs concurrently over
+	//disjoint ranges, the shared-state work happens in the serial merge
+
+	for (uint32_t i = p_from; i < p_to; i++) {
+
+		Instance *ins = instance_cull_result[i];
+
+		uint8_t cull_class = CULL_CLASS_DISCARD;
+
+		if ((p_data->camera_layer_mask & ins->layer_mask) == 0) {
+
+			//failure
+		} else if (ins->base_type == VS::INSTANCE_LIGHT && ins->visible) {
+
+			cull_class = CULL_CLASS_LIGHT;
+		} else if (ins->base_type == VS::INSTANCE_REFLECTION_PROBE && ins->visible) {
+
+			cull_class = CULL_CLASS_REFLECTION_PROBE;
+		} else if (ins->base_type == VS::INSTANCE_GI_PROBE && ins->visible) {
+
+			cull_class = CULL_CLASS_GI_PROBE;
+		} else if (((1 << ins->base_type) & VS::INSTANCE_GEOMETRY_MASK) && ins->visible && ins->cast_shadows != VS::SHADOW_CASTING_SETTING_SHADOWS_ONLY) {
+
+			if (p_data->occlusion && p_data->occlusion->is_occluded(ins->transformed_aabb)) {
+				instance_cull_class[i] = CULL_CLASS_DISCARD;
+				continue;
+			}
+
+			cull_class = CULL_CLASS_GEOMETRY;
+
+			InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(ins->base_data);
+
+			if (geom->lighting_dirty) {
+				int l = 0;
+				//only called when lights AABB enter/exit this geometry
+				ins->light_instances.resize(geom->lighting.size());
+
+				for (List<Instance *>::Element *E = geom->lighting.front(); E; E = E->next()) {
+
+					InstanceLightData *light = static_cast<InstanceLightData *>(E->get()->base_data);
+
+					ins->light_instances.write[l++] = light->instance;
+				}
+
+				geom->lighting_dirty = false;
+			}
+
+			if (geom->reflection_dirty) {
+				int l = 0;
+				//only called when reflection probe AABB enter/exit this geometry
+				ins->reflection_probe_instances.resize(geom->reflection_probes.size());
+
+				for (List<Instance *>::Element *E = geom->reflection_probes.front(); E; E = E->next()) {
+
+					InstanceReflectionProbeData *reflection_probe = static_cast<InstanceReflectionProbeData *>(E->get()->base_data);
+
+					ins->reflection_probe_instances.write[l++] = reflection_probe->instance;
+				}
+
+				geom->reflection_dirty = false;
+			}
+
+			if (geom->gi_probes_dirty) {
+				int l = 0;
+				//only called when reflection probe AABB enter/exit this geometry
+				ins->gi_probe_instances.resize(geom->gi_probes.size());
+
+				for (List<Instance *>::Element *E = geom->gi_probes.front(); E; E = E->next()) {
+
+					InstanceGIProbeData *gi_probe = static_cast<InstanceGIProbeData *>(E->get()->base_data);
+
+					ins->gi_probe_instances.write[l++] = gi_probe->probe_instance;
+				}
+
+				geom->gi_probes_dirty = false;
+			}
+
+			ins->depth = p_data->near_plane.distance_to(ins->transform.origin);
+			ins->depth_layer = CLAMP(int(ins->depth * 16 / p_data->z_far), 0, 15);
+
+			if (ins->lod_levels.size()) {
+
+				RID lod_mesh;
+				for (int j = 0; j < ins->lod_levels.size(); j++) {
+
+					if (ins->depth < ins->lod_levels[j].distance)
+						break;
+					lod_mesh = ins->lod_levels[j].mesh;
+				}
+				ins->lod_mesh = lod_mesh;
+			}
+		}
+
+		instance_cull_class[i] = cull_class;
+	}
+}
+
 void VisualServerScene::_prepare_scene(const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, RID p_force_environment, uint32_t p_visible_layers, RID p_scenario, RID p_shadow_atlas, RID p_reflection_probe) {
 	// Note, in stereo rendering:
 	// - p_cam_transform will be a transform in the middle of our two eyes
@@ -1864,7 +2619,40 @@ void VisualServerScene::_prepare_scene(const Transform p_cam_transform, const Ca
 	float z_far = p_cam_projection.get_z_far();
 
 	/* STEP 2 - CULL */
-	instance_cull_count = scenario->octree.cull_convex(planes, instance_cull_result, MAX_INSTANCE_CULL);
+
+	if (scenario->rooms_dirty)
+		_rooms_bake(scenario);
+
+	//when rooms are set up and the camera is inside one, walk the portal
+	//graph with a per-portal clipped frustum; most static instances never
+	//even reach the frustum test, only visited rooms contribute
+	bool room_culled = false;
+	if (!scenario->rooms.empty())
+		room_culled = _cull_rooms(scenario, p_cam_transform.origin, planes, camera_layer_mask, instance_cull_result, MAX_INSTANCE_CULL, instance_cull_count);
+
+	if (!room_culled)
+		instance_cull_count = _cull_convex_linear(scenario, planes, camera_layer_mask, instance_cull_result, MAX_INSTANCE_CULL);
+
+	/* STEP 2.5 - RASTERIZE OCCLUDERS */
+
+	bool use_occlusion = false;
+
+	if (occlusion_buffer.is_enabled() && scenario->occluders.size()) {
+
+		occlusion_buffer.begin(p_cam_transform, p_cam_projection);
+
+		for (List<Instance *>::Element *E = scenario->occluders.front(); E; E = E->next()) {
+
+			Instance *occluder = E->get();
+			if (!occluder->visible)
+				continue;
+			if (!occluder->transformed_aabb.intersects_convex_shape(planes.ptr(), planes.size()))
+				continue;
+
+			occlusion_buffer.rasterize_box(occluder->transformed_aabb);
+			use_occlusion = true;
+		}
+	}
 	light_cull_count = 0;
 
 	reflection_probe_cull_count = 0;
@@ -1879,152 +2667,127 @@ void VisualServerScene::_prepare_scene(const Transform p_cam_transform, const Ca
 	*/
 
 	/* STEP 3 - PROCESS PORTALS, VALIDATE ROOMS */
-	//removed, will replace with culling
+	//done above as part of the cull, see _cull_rooms()
 
 	/* STEP 4 - REMOVE FURTHER CULLED OBJECTS, ADD LIGHTS */
 
-	for (int i = 0; i < instance_cull_count; i++) {
+	//classify in parallel chunks over the worker pool, then merge the
+	//results serially (shared lists, cull arrays, render state)
 
-		Instance *ins = instance_cull_result[i];
+	CullClassifyData cull_data;
+	cull_data.scene = this;
+	cull_data.near_plane = near_plane;
+	cull_data.z_far = z_far;
+	cull_data.camera_layer_mask = camera_layer_mask;
+	cull_data.occlusion = use_occlusion ? &occlusion_buffer : NULL;
 
-		bool keep = false;
+	if (instance_cull_count >= CULL_PARALLEL_THRESHOLD && WorkerThreadPool::get_singleton() && WorkerThreadPool::get_singleton()->get_thread_count() > 0) {
 
-		if ((camera_layer_mask & ins->layer_mask) == 0) {
+		uint32_t chunks = ((uint32_t)instance_cull_count + CULL_CHUNK_SIZE - 1) / CULL_CHUNK_SIZE;
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_group_task(&_classify_cull_chunk_task, &cull_data, chunks);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	} else {
 
-			//failure
-		} else if (ins->base_type == VS::INSTANCE_LIGHT && ins->visible) {
+		_classify_cull_chunk(&cull_data, 0, instance_cull_count);
+	}
 
-			if (light_cull_count < MAX_LIGHTS_CULLED) {
+	for (int i = 0; i < instance_cull_count; i++) {
 
-				InstanceLightData *light = static_cast<InstanceLightData *>(ins->base_data);
+		Instance *ins = instance_cull_result[i];
 
-				if (!light->geometries.empty()) {
-					//do not add this light if no geometry is affected by it..
-					light_cull_result[light_cull_count] = ins;
-					light_instance_cull_result[light_cull_count] = light->instance;
-					if (p_shadow_atlas.is_valid() && VSG::storage->light_has_shadow(ins->base)) {
-						VSG::scene_render->light_instance_mark_visible(light->instance); //mark it visible for shadow allocation later
-					}
+		bool keep = false;
 
-					light_cull_count++;
-				}
-			}
-		} else if (ins->base_type == VS::INSTANCE_REFLECTION_PROBE && ins->visible) {
+		switch (instance_cull_class[i]) {
 
-			if (reflection_probe_cull_count < MAX_REFLECTION_PROBES_CULLED) {
+			case CULL_CLASS_LIGHT: {
 
-				InstanceReflectionProbeData *reflection_probe = static_cast<InstanceReflectionProbeData *>(ins->base_data);
+				if (light_cull_count < MAX_LIGHTS_CULLED) {
 
-				if (p_reflection_probe != reflection_probe->instance) {
-					//avoid entering The Matrix
+					InstanceLightData *light = static_cast<InstanceLightData *>(ins->base_data);
 
-					if (!reflection_probe->geometries.empty()) {
+					if (!light->geometries.empty()) {
 						//do not add this light if no geometry is affected by it..
-
-						if (reflection_probe->reflection_dirty || VSG::scene_render->reflection_probe_instance_needs_redraw(reflection_probe->instance)) {
-							if (!reflection_probe->update_list.in_list()) {
-								reflection_probe->render_step = 0;
-								reflection_probe_render_list.add_last(&reflection_probe->update_list);
-							}
-
-							reflection_probe->reflection_dirty = false;
+						light_cull_result[light_cull_count] = ins;
+						light_instance_cull_result[light_cull_count] = light->instance;
+						if (p_shadow_atlas.is_valid() && VSG::storage->light_has_shadow(ins->base)) {
+							VSG::scene_render->light_instance_mark_visible(light->instance); //mark it visible for shadow allocation later
 						}
 
-						if (VSG::scene_render->reflection_probe_instance_has_reflection(reflection_probe->instance)) {
-							reflection_probe_instance_cull_result[reflection_probe_cull_count] = reflection_probe->instance;
-							reflection_probe_cull_count++;
-						}
+						light_cull_count++;
 					}
 				}
-			}
+			} break;
+			case CULL_CLASS_REFLECTION_PROBE: {
 
-		} else if (ins->base_type == VS::INSTANCE_GI_PROBE && ins->visible) {
+				if (reflection_probe_cull_count < MAX_REFLECTION_PROBES_CULLED) {
 
-			InstanceGIProbeData *gi_probe = static_cast<InstanceGIProbeData *>(ins->base_data);
-			if (!gi_probe->update_element.in_list()) {
-				gi_probe_update_list.add(&gi_probe->update_element);
-			}
+					InstanceReflectionProbeData *reflection_probe = static_cast<InstanceReflectionProbeData *>(ins->base_data);
 
-		} else if (((1 << ins->base_type) & VS::INSTANCE_GEOMETRY_MASK) && ins->visible && ins->cast_shadows != VS::SHADOW_CASTING_SETTING_SHADOWS_ONLY) {
+					if (p_reflection_probe != reflection_probe->instance) {
+						//avoid entering The Matrix
 
-			keep = true;
+						if (!reflection_probe->geometries.empty()) {
+							//do not add this light if no geometry is affected by it..
 
-			InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(ins->base_data);
+							if (reflection_probe->reflection_dirty || VSG::scene_render->reflection_probe_instance_needs_redraw(reflection_probe->instance)) {
+								if (!reflection_probe->update_list.in_list()) {
+									reflection_probe->render_step = 0;
+									reflection_probe_render_list.add_last(&reflection_probe->update_list);
+								}
 
-			if (ins->redraw_if_visible) {
-				VisualServerRaster::redraw_request();
-			}
+								reflection_probe->reflection_dirty = false;
+							}
 
-			if (ins->base_type == VS::INSTANCE_PARTICLES) {
-				//particles visible? process them
-				if (VSG::storage->particles_is_inactive(ins->base)) {
-					//but if nothing is going on, don't do it.
-					keep = false;
-				} else {
-					VSG::storage->particles_request_process(ins->base);
-					//particles visible? request redraw
-					VisualServerRaster::redraw_request();
+							if (VSG::scene_render->reflection_probe_instance_has_reflection(reflection_probe->instance)) {
+								reflection_probe_instance_cull_result[reflection_probe_cull_count] = reflection_probe->instance;
+								reflection_probe_cull_count++;
+							}
+						}
+					}
 				}
-			}
 
-			if (geom->lighting_dirty) {
-				int l = 0;
-				//only called when lights AABB enter/exit this geometry
-				ins->light_instances.resize(geom->lighting.size());
-
-				for (List<Instance *>::Element *E = geom->lighting.front(); E; E = E->next()) {
-
-					InstanceLightData *light = static_cast<InstanceLightData *>(E->get()->base_data);
+			} break;
+			case CULL_CLASS_GI_PROBE: {
 
-					ins->light_instances.write[l++] = light->instance;
+				InstanceGIProbeData *gi_probe = static_cast<InstanceGIProbeData *>(ins->base_data);
+				if (!gi_probe->update_element.in_list()) {
+					gi_probe_update_list.add(&gi_probe->update_element);
 				}
 
-				geom->lighting_dirty = false;
-			}
-
-			if (geom->reflection_dirty) {
-				int l = 0;
-				//only called when reflection probe AABB enter/exit this geometry
-				ins->reflection_probe_instances.resize(geom->reflection_probes.size());
+			} break;
+			case CULL_CLASS_GEOMETRY: {
 
-				for (List<Instance *>::Element *E = geom->reflection_probes.front(); E; E = E->next()) {
+				keep = true;
 
-					InstanceReflectionProbeData *reflection_probe = static_cast<InstanceReflectionProbeData *>(E->get()->base_data);
-
-					ins->reflection_probe_instances.write[l++] = reflection_probe->instance;
+				if (ins->redraw_if_visible) {
+					VisualServerRaster::redraw_request();
 				}
 
-				geom->reflection_dirty = false;
-			}
-
-			if (geom->gi_probes_dirty) {
-				int l = 0;
-				//only called when reflection probe AABB enter/exit this geometry
-				ins->gi_probe_instances.resize(geom->gi_probes.size());
-
-				for (List<Instance *>::Element *E = geom->gi_probes.front(); E; E = E->next()) {
-
-					InstanceGIProbeData *gi_probe = static_cast<InstanceGIProbeData *>(E->get()->base_data);
-
-					ins->gi_probe_instances.write[l++] = gi_probe->probe_instance;
+				if (ins->base_type == VS::INSTANCE_PARTICLES) {
+					//particles visible? process them
+					if (VSG::storage->particles_is_inactive(ins->base)) {
+						//but if nothing is going on, don't do it.
+						keep = false;
+					} else {
+						VSG::storage->particles_request_process(ins->base);
+						//particles visible? request redraw
+						VisualServerRaster::redraw_request();
+					}
 				}
-
-				geom->gi_probes_dirty = false;
-			}
-
-			ins->depth = near_plane.distance_to(ins->transform.origin);
-			ins->depth_layer = CLAMP(int(ins->depth * 16 / z_far), 0, 15);
+			} break;
 		}
 
 		if (!keep) {
 			// remove, no reason to keep
 			instance_cull_count--;
 			SWAP(instance_cull_result[i], instance_cull_result[instance_cull_count]);
+			SWAP(instance_cull_class[i], instance_cull_class[instance_cull_count]);
 			i--;
 			ins->last_render_pass = 0; // make invalid
 		} else {
 
 			ins->last_render_pass = render_pass;
+			ins->last_frame_pass = frame_pass; //visibility feedback for scene-side LOD
 		}
 	}
 
@@ -3437,6 +4200,7 @@ void VisualServerScene::_update_dirty_instance(Instance *p_instance) {
 				for (List<Instance *>::Element *E = geom->lighting.front(); E; E = E->next()) {
 					InstanceLightData *light = static_cast<InstanceLightData *>(E->get()->base_data);
 					light->shadow_dirty = true;
+					light->static_shadow_version++;
 				}
 
 				geom->can_cast_shadows = can_cast_shadows;
@@ -3454,6 +4218,39 @@ void VisualServerScene::_update_dirty_instance(Instance *p_instance) {
 	p_instance->update_materials = false;
 }
 
+void VisualServerScene::update_interpolation(float p_fraction) {
+
+	uint64_t tick = Engine::get_singleton()->get_physics_frames();
+
+	SelfList<Instance> *E = _interpolate_list.first();
+	while (E) {
+
+		SelfList<Instance> *N = E->next();
+		Instance *instance = E->self();
+
+		if (tick != instance->transform_tick) {
+			//no update arrived this tick, the object stopped moving; settle
+			//on the final transform so stale endpoints don't wobble
+			instance->transform_prev = instance->transform_curr;
+		}
+
+		Transform interp;
+		if (instance->transform_prev == instance->transform_curr) {
+			interp = instance->transform_curr;
+			_interpolate_list.remove(&instance->interpolate_item); //settled, nothing left to blend
+		} else {
+			interp = instance->transform_prev.interpolate_with(instance->transform_curr, p_fraction);
+		}
+
+		if (interp != instance->transform) {
+			instance->transform = interp;
+			_instance_queue_update(instance, true);
+		}
+
+		E = N;
+	}
+}
+
 void VisualServerScene::update_dirty_instances() {
 
 	VSG::storage->update_dirty_resources();
@@ -3480,11 +4277,33 @@ bool VisualServerScene::free(RID p_rid) {
 		while (scenario->instances.first()) {
 			instance_set_scenario(scenario->instances.first()->self()->self, RID());
 		}
+		while (scenario->rooms.front()) {
+			room_set_scenario(scenario->rooms.front()->get()->self, RID());
+		}
+		while (scenario->portals.front()) {
+			portal_set_scenario(scenario->portals.front()->get()->self, RID());
+		}
 		VSG::scene_render->free(scenario->reflection_probe_shadow_atlas);
 		VSG::scene_render->free(scenario->reflection_atlas);
 		scenario_owner.free(p_rid);
 		memdelete(scenario);
 
+	} else if (room_owner.owns(p_rid)) {
+
+		Room *room = room_owner.get(p_rid);
+
+		room_set_scenario(p_rid, RID()); //unbakes its instances, portals keep a RID and seal up
+		room_owner.free(p_rid);
+		memdelete(room);
+
+	} else if (portal_owner.owns(p_rid)) {
+
+		Portal *portal = portal_owner.get(p_rid);
+
+		portal_set_scenario(p_rid, RID());
+		portal_owner.free(p_rid);
+		memdelete(portal);
+
 	} else if (instance_owner.owns(p_rid)) {
 		// delete the instance
 
@@ -3500,6 +4319,10 @@ bool VisualServerScene::free(RID p_rid) {
 
 		update_dirty_instances(); //in case something changed this
 
+		if (instance->interpolate_item.in_list()) {
+			_interpolate_list.remove(&instance->interpolate_item);
+		}
+
 		instance_owner.free(p_rid);
 		memdelete(instance);
 	} else {
@@ -3521,7 +4344,12 @@ VisualServerScene::VisualServerScene() {
 #endif
 
 	render_pass = 1;
+	frame_pass = 1;
 	singleton = this;
+
+	int occlusion_size = GLOBAL_DEF("rendering/quality/occlusion/buffer_size", 0);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/quality/occlusion/buffer_size", PropertyInfo(Variant::INT, "rendering/quality/occlusion/buffer_size", PROPERTY_HINT_RANGE, "0,1024,1"));
+	occlusion_buffer.setup(occlusion_size);
 }
 
 VisualServerScene::~VisualServerScene() {
@@ -39,6 +39,7 @@
 #include "core/os/thread.h"
 #include "core/self_list.h"
 #include "servers/arvr/arvr_interface.h"
+#include "servers/visual/occlusion_buffer.h"
 
 class VisualServerScene {
 public:
@@ -49,9 +50,14 @@ public:
 		MAX_REFLECTION_PROBES_CULLED = 4096,
 		MAX_ROOM_CULL = 32,
 		MAX_EXTERIOR_PORTALS = 128,
+		MAX_ROOM_CULL_DEPTH = 8, //portal traversal depth from the camera room
+		CULL_CHUNK_SIZE = 64, //instances classified per worker pool task
+		CULL_PARALLEL_THRESHOLD = 256, //below this, classify on the render thread
+		STATIC_SHADOW_PASSES = 60, //render passes a caster must stay put before joining the static shadow layer
 	};
 
 	uint64_t render_pass;
+	uint64_t frame_pass; //incremented once per drawn frame, stamps camera-visible instances
 
 	static VisualServerScene *singleton;
 
@@ -75,8 +81,11 @@ public:
 
 		Transform transform;
 
+		uint64_t version; //incremented on change, for on-demand viewport updates
+
 		Camera() {
 
+			version = 1;
 			visible_layers = 0xFFFFFFFF;
 			fov = 70;
 			type = PERSPECTIVE;
@@ -98,10 +107,13 @@ public:
 	virtual void camera_set_cull_mask(RID p_camera, uint32_t p_layers);
 	virtual void camera_set_environment(RID p_camera, RID p_env);
 	virtual void camera_set_use_vertical_aspect(RID p_camera, bool p_enable);
+	uint64_t camera_get_version(RID p_camera) const;
 
 	/* SCENARIO API */
 
 	struct Instance;
+	struct Room;
+	struct Portal;
 
 	struct Scenario : RID_Data {
 
@@ -111,6 +123,7 @@ public:
 		Octree<Instance, true> octree;
 
 		List<Instance *> directional_lights;
+		List<Instance *> occluders;
 		RID environment;
 		RID fallback_environment;
 		RID reflection_probe_shadow_atlas;
@@ -118,7 +131,28 @@ public:
 
 		SelfList<Instance>::List instances;
 
-		Scenario() { debug = VS::SCENARIO_DEBUG_DISABLED; }
+		//structure-of-arrays mirror of the cull-relevant instance state,
+		//kept dense with swap-removal so the camera frustum test is a
+		//linear sweep instead of chasing Instance pointers
+		Vector<AABB> cull_aabbs;
+		Vector<uint32_t> cull_masks; //layer mask, zeroed while invisible
+		Vector<Instance *> cull_instances;
+		Vector<uint8_t> cull_room_flags; //nonzero when the instance is baked into a room
+
+		//rooms and portals
+		List<Room *> rooms;
+		List<Portal *> portals;
+		bool rooms_dirty; //static instances need (re)assignment to rooms
+		uint64_t room_cull_pass; //bumped per portal traversal, marks visited rooms
+
+		uint64_t version; //incremented on change, for on-demand viewport updates
+
+		Scenario() {
+			debug = VS::SCENARIO_DEBUG_DISABLED;
+			rooms_dirty = false;
+			room_cull_pass = 0;
+			version = 1;
+		}
 	};
 
 	mutable RID_Owner<Scenario> scenario_owner;
@@ -132,6 +166,63 @@ public:
 	virtual void scenario_set_environment(RID p_scenario, RID p_environment);
 	virtual void scenario_set_fallback_environment(RID p_scenario, RID p_environment);
 	virtual void scenario_set_reflection_atlas_size(RID p_scenario, int p_size, int p_subdiv);
+	uint64_t scenario_get_version(RID p_scenario) const;
+
+	/* ROOMS AND PORTALS API */
+
+	struct Room : RID_Data {
+
+		RID self;
+		Scenario *scenario;
+		List<Room *>::Element *scenario_item; //in Scenario::rooms
+
+		Vector<Plane> bounds; //convex hull, planes facing outwards
+		List<Instance *> static_instances; //baked assignment
+		uint64_t cull_pass; //last Scenario::room_cull_pass this room was visited on
+
+		Room() {
+			scenario = NULL;
+			scenario_item = NULL;
+			cull_pass = 0;
+		}
+	};
+
+	struct Portal : RID_Data {
+
+		RID self;
+		Scenario *scenario;
+		List<Portal *>::Element *scenario_item; //in Scenario::portals
+
+		Vector<Vector3> points; //convex polygon, world space
+		RID rooms[2]; //the two rooms this portal connects, kept by RID so a freed room seals it
+		bool enabled;
+
+		Portal() {
+			scenario = NULL;
+			scenario_item = NULL;
+			enabled = true;
+		}
+	};
+
+	mutable RID_Owner<Room> room_owner;
+	mutable RID_Owner<Portal> portal_owner;
+
+	virtual RID room_create();
+	virtual void room_set_scenario(RID p_room, RID p_scenario);
+	virtual void room_set_bounds(RID p_room, const Vector<Plane> &p_convex);
+
+	virtual RID portal_create();
+	virtual void portal_set_scenario(RID p_portal, RID p_scenario);
+	virtual void portal_set_geometry(RID p_portal, const Vector<Vector3> &p_points);
+	virtual void portal_set_rooms(RID p_portal, RID p_room_a, RID p_room_b);
+	virtual void portal_set_enabled(RID p_portal, bool p_enabled);
+
+	void _rooms_mark_dirty(Scenario *p_scenario);
+	void _rooms_bake(Scenario *p_scenario);
+	void _room_unbake_instance(Instance *p_instance);
+	Room *_room_find_point(Scenario *p_scenario, const Vector3 &p_point) const;
+	void _cull_room(Scenario *p_scenario, Room *p_room, const Vector3 &p_camera_pos, const Vector<Plane> &p_planes, uint32_t p_layer_mask, Instance **p_results, int p_max_results, int &r_count, int p_depth);
+	bool _cull_rooms(Scenario *p_scenario, const Vector3 &p_camera_pos, const Vector<Plane> &p_planes, uint32_t p_layer_mask, Instance **p_results, int p_max_results, int &r_count);
 
 	/* INSTANCING API */
 
@@ -145,6 +236,7 @@ public:
 		RID self;
 		//scenario stuff
 		OctreeElementID octree_id;
+		int32_t cull_index; //position in the scenario SoA cull arrays, -1 if not in them
 		Scenario *scenario;
 		SelfList<Instance> scenario_item;
 
@@ -152,6 +244,26 @@ public:
 		bool update_aabb;
 		bool update_materials;
 
+		bool occluder;
+		List<Instance *>::Element *occluder_item; //in Scenario::occluders
+
+		Room *room; //room this static instance was baked into, NULL when global
+		List<Instance *>::Element *room_item; //in Room::static_instances
+
+		//fixed timestep interpolation
+		bool interpolated;
+		Transform transform_prev;
+		Transform transform_curr;
+		uint64_t transform_tick; //physics tick transform_curr was set on
+		SelfList<Instance> interpolate_item;
+
+		struct LODLevel {
+			RID mesh;
+			float distance;
+		};
+
+		Vector<LODLevel> lod_levels; //sorted by distance, ascending
+
 		SelfList<Instance> update_item;
 
 		AABB aabb;
@@ -168,6 +280,7 @@ public:
 
 		uint64_t last_render_pass;
 		uint64_t last_frame_pass;
+		uint64_t last_move_pass; //render_pass of the last transform/data update, for the static shadow layer
 
 		uint64_t version; // changes to this, and changes to base increase version
 
@@ -185,14 +298,25 @@ public:
 
 		Instance() :
 				scenario_item(this),
-				update_item(this) {
+				update_item(this),
+				interpolate_item(this) {
 
 			octree_id = 0;
+			cull_index = -1;
 			scenario = NULL;
 
 			update_aabb = false;
 			update_materials = false;
 
+			occluder = false;
+			occluder_item = NULL;
+
+			room = NULL;
+			room_item = NULL;
+
+			interpolated = false;
+			transform_tick = 0;
+
 			extra_margin = 0;
 
 			object_id = 0;
@@ -205,6 +329,7 @@ public:
 
 			last_render_pass = 0;
 			last_frame_pass = 0;
+			last_move_pass = 0;
 			version = 1;
 			base_data = NULL;
 
@@ -221,6 +346,7 @@ public:
 	};
 
 	SelfList<Instance>::List _instance_update_list;
+	SelfList<Instance>::List _interpolate_list;
 	void _instance_queue_update(Instance *p_instance, bool p_update_aabb, bool p_update_materials = false);
 
 	struct InstanceGeometryData : public InstanceBaseData {
@@ -287,6 +413,10 @@ public:
 
 		bool shadow_dirty;
 
+		uint64_t static_shadow_version; //bumped when the static caster set or the light itself changes
+		uint64_t cached_static_version; //static_shadow_version the cached static layer was rendered with
+		uint64_t cached_static_pass; //render_pass the cached static layer was rendered at
+
 		List<PairInfo> geometries;
 
 		Instance *baked_light;
@@ -294,6 +424,9 @@ public:
 		InstanceLightData() {
 
 			shadow_dirty = true;
+			static_shadow_version = 1;
+			cached_static_version = 0;
+			cached_static_pass = 0;
 			D = NULL;
 			last_version = 0;
 			baked_light = NULL;
@@ -422,7 +555,35 @@ public:
 		}
 	};
 
+	enum CullClass {
+		CULL_CLASS_DISCARD,
+		CULL_CLASS_LIGHT,
+		CULL_CLASS_REFLECTION_PROBE,
+		CULL_CLASS_GI_PROBE,
+		CULL_CLASS_GEOMETRY,
+	};
+
+	struct CullClassifyData {
+		VisualServerScene *scene;
+		Plane near_plane;
+		float z_far;
+		uint32_t camera_layer_mask;
+		const OcclusionBuffer *occlusion; //NULL when no occluders were rasterized
+	};
+
+	static void _classify_cull_chunk_task(void *p_userdata, uint32_t p_chunk);
+	void _classify_cull_chunk(const CullClassifyData *p_data, uint32_t p_from, uint32_t p_to);
+
+	void _cull_array_add(Instance *p_instance, const AABB &p_aabb);
+	void _cull_array_move(Instance *p_instance, const AABB &p_aabb);
+	void _cull_array_update_mask(Instance *p_instance);
+	void _cull_array_remove(Instance *p_instance);
+	int _cull_convex_linear(Scenario *p_scenario, const Vector<Plane> &p_planes, uint32_t p_layer_mask, Instance **p_results, int p_max_results) const;
+
+	OcclusionBuffer occlusion_buffer;
+
 	int instance_cull_count;
+	uint8_t instance_cull_class[MAX_INSTANCE_CULL];
 	Instance *instance_cull_result[MAX_INSTANCE_CULL];
 	Instance *instance_shadow_cull_result[MAX_INSTANCE_CULL]; //used for generating shadowmaps
 	Instance *light_cull_result[MAX_LIGHTS_CULLED];
@@ -440,10 +601,16 @@ public:
 	virtual void instance_set_scenario(RID p_instance, RID p_scenario);
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask);
 	virtual void instance_set_transform(RID p_instance, const Transform &p_transform);
+	virtual void instance_set_interpolated(RID p_instance, bool p_interpolated);
+	virtual void instance_reset_physics_interpolation(RID p_instance);
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id);
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight);
 	virtual void instance_set_surface_material(RID p_instance, int p_surface, RID p_material);
 	virtual void instance_set_visible(RID p_instance, bool p_visible);
+	virtual bool instance_is_visible(RID p_instance) const;
+	virtual void instance_set_occluder(RID p_instance, bool p_enabled);
+	virtual void instance_add_lod_level(RID p_instance, RID p_mesh, float p_distance);
+	virtual void instance_clear_lod_levels(RID p_instance);
 	virtual void instance_set_use_lightmap(RID p_instance, RID p_lightmap_instance, RID p_lightmap);
 
 	virtual void instance_set_custom_aabb(RID p_instance, AABB p_aabb);
@@ -471,6 +638,8 @@ public:
 	_FORCE_INLINE_ void _update_instance_lightmap_captures(Instance *p_instance);
 
 	_FORCE_INLINE_ bool _light_instance_update_shadow(Instance *p_instance, const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, RID p_shadow_atlas, Scenario *p_scenario);
+	bool _light_static_shadow_valid(InstanceLightData *p_light) const;
+	void _render_shadow_pass_cached(InstanceLightData *p_light, RID p_shadow_atlas, int p_pass, bool p_static_valid, Instance **p_casters, int p_caster_count);
 
 	void _prepare_scene(const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, RID p_force_environment, uint32_t p_visible_layers, RID p_scenario, RID p_shadow_atlas, RID p_reflection_probe);
 	void _render_scene(const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, RID p_force_environment, RID p_scenario, RID p_shadow_atlas, RID p_reflection_probe, int p_reflection_probe_pass);
@@ -478,7 +647,9 @@ public:
 
 	void render_camera(RID p_camera, RID p_scenario, Size2 p_viewport_size, RID p_shadow_atlas);
 	void render_camera(Ref<ARVRInterface> &p_interface, ARVRInterface::Eyes p_eye, RID p_camera, RID p_scenario, Size2 p_viewport_size, RID p_shadow_atlas);
+	void advance_frame_pass() { frame_pass++; }
 	void update_dirty_instances();
+	void update_interpolation(float p_fraction);
 
 	//probes
 	struct GIProbeDataHeader {
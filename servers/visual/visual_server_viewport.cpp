@@ -292,12 +292,31 @@ void VisualServerViewport::draw_viewports() {
 
 		ERR_CONTINUE(!vp->render_target.is_valid());
 
-		bool visible = vp->viewport_to_screen_rect != Rect2() || vp->update_mode == VS::VIEWPORT_UPDATE_ALWAYS || vp->update_mode == VS::VIEWPORT_UPDATE_ONCE || (vp->update_mode == VS::VIEWPORT_UPDATE_WHEN_VISIBLE && VSG::storage->render_target_was_used(vp->render_target));
+		bool visible = vp->viewport_to_screen_rect != Rect2() || vp->update_mode == VS::VIEWPORT_UPDATE_ALWAYS || vp->update_mode == VS::VIEWPORT_UPDATE_ONCE || (vp->update_mode == VS::VIEWPORT_UPDATE_WHEN_VISIBLE && VSG::storage->render_target_was_used(vp->render_target)) || (vp->update_mode == VS::VIEWPORT_UPDATE_WHEN_CHANGED && VSG::storage->render_target_was_used(vp->render_target));
 		visible = visible && vp->size.x > 1 && vp->size.y > 1;
 
 		if (!visible)
 			continue;
 
+		if (vp->update_mode == VS::VIEWPORT_UPDATE_WHEN_CHANGED && vp->viewport_to_screen_rect == Rect2()) {
+			//sum of monotonic counters, so any change since the last render makes it differ
+			uint64_t content_version = vp->self_version;
+			if (vp->camera.is_valid()) {
+				content_version += VSG::scene->camera_get_version(vp->camera);
+			}
+			if (vp->scenario.is_valid()) {
+				content_version += VSG::scene->scenario_get_version(vp->scenario);
+			}
+			for (Map<RID, Viewport::CanvasData>::Element *E = vp->canvas_map.front(); E; E = E->next()) {
+				content_version += static_cast<VisualServerCanvas::Canvas *>(E->get().canvas)->version;
+			}
+
+			if (content_version == vp->last_content_version)
+				continue; //nothing changed, keep the last rendered frame
+
+			vp->last_content_version = content_version;
+		}
+
 		VSG::storage->render_target_clear_used(vp->render_target);
 
 		if (vp->use_arvr && arvr_interface.is_valid()) {
@@ -383,6 +402,7 @@ RID VisualServerViewport::viewport_create() {
 void VisualServerViewport::viewport_set_use_arvr(RID p_viewport, bool p_use_arvr) {
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	viewport->use_arvr = p_use_arvr;
 }
@@ -393,6 +413,7 @@ void VisualServerViewport::viewport_set_size(RID p_viewport, int p_width, int p_
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	viewport->size = Size2(p_width, p_height);
 	VSG::storage->render_target_set_size(viewport->render_target, p_width, p_height);
@@ -415,6 +436,7 @@ void VisualServerViewport::viewport_set_parent_viewport(RID p_viewport, RID p_pa
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	viewport->parent = p_parent_viewport;
 }
@@ -423,6 +445,7 @@ void VisualServerViewport::viewport_set_clear_mode(RID p_viewport, VS::ViewportC
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	viewport->clear_mode = p_clear_mode;
 }
@@ -447,6 +470,7 @@ void VisualServerViewport::viewport_attach_to_screen(RID p_viewport, const Rect2
 void VisualServerViewport::viewport_set_render_direct_to_screen(RID p_viewport, bool p_enable) {
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	if (p_enable == viewport->viewport_render_direct_to_screen)
 		return;
@@ -489,6 +513,7 @@ void VisualServerViewport::viewport_set_update_mode(RID p_viewport, VS::Viewport
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	viewport->update_mode = p_mode;
 }
@@ -496,6 +521,7 @@ void VisualServerViewport::viewport_set_vflip(RID p_viewport, bool p_enable) {
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	VSG::storage->render_target_set_flag(viewport->render_target, RasterizerStorage::RENDER_TARGET_VFLIP, p_enable);
 }
@@ -512,6 +538,7 @@ void VisualServerViewport::viewport_set_hide_scenario(RID p_viewport, bool p_hid
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	viewport->hide_scenario = p_hide;
 }
@@ -519,6 +546,7 @@ void VisualServerViewport::viewport_set_hide_canvas(RID p_viewport, bool p_hide)
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	viewport->hide_canvas = p_hide;
 }
@@ -526,6 +554,7 @@ void VisualServerViewport::viewport_set_disable_environment(RID p_viewport, bool
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	viewport->disable_environment = p_disable;
 }
@@ -534,6 +563,7 @@ void VisualServerViewport::viewport_set_disable_3d(RID p_viewport, bool p_disabl
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	viewport->disable_3d = p_disable;
 	//VSG::storage->render_target_set_flag(viewport->render_target, RasterizerStorage::RENDER_TARGET_NO_3D, p_disable);
@@ -544,6 +574,7 @@ void VisualServerViewport::viewport_set_keep_3d_linear(RID p_viewport, bool p_ke
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	viewport->keep_3d_linear = p_keep_3d_linear;
 	VSG::storage->render_target_set_flag(viewport->render_target, RasterizerStorage::RENDER_TARGET_KEEP_3D_LINEAR, p_keep_3d_linear);
@@ -553,6 +584,7 @@ void VisualServerViewport::viewport_attach_camera(RID p_viewport, RID p_camera)
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	viewport->camera = p_camera;
 }
@@ -560,6 +592,7 @@ void VisualServerViewport::viewport_set_scenario(RID p_viewport, RID p_scenario)
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	viewport->scenario = p_scenario;
 }
@@ -567,6 +600,7 @@ void VisualServerViewport::viewport_attach_canvas(RID p_viewport, RID p_canvas)
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	ERR_FAIL_COND(viewport->canvas_map.has(p_canvas));
 	VisualServerCanvas::Canvas *canvas = VSG::canvas->canvas_owner.getornull(p_canvas);
@@ -583,6 +617,7 @@ void VisualServerViewport::viewport_remove_canvas(RID p_viewport, RID p_canvas)
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	VisualServerCanvas::Canvas *canvas = VSG::canvas->canvas_owner.getornull(p_canvas);
 	ERR_FAIL_COND(!canvas);
@@ -594,6 +629,7 @@ void VisualServerViewport::viewport_set_canvas_transform(RID p_viewport, RID p_c
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	ERR_FAIL_COND(!viewport->canvas_map.has(p_canvas));
 	viewport->canvas_map[p_canvas].transform = p_offset;
@@ -602,6 +638,7 @@ void VisualServerViewport::viewport_set_transparent_background(RID p_viewport, b
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	VSG::storage->render_target_set_flag(viewport->render_target, RasterizerStorage::RENDER_TARGET_TRANSPARENT, p_enabled);
 	viewport->transparent_bg = p_enabled;
@@ -611,6 +648,7 @@ void VisualServerViewport::viewport_set_global_canvas_transform(RID p_viewport,
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	viewport->global_transform = p_transform;
 }
@@ -618,6 +656,7 @@ void VisualServerViewport::viewport_set_canvas_stacking(RID p_viewport, RID p_ca
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	ERR_FAIL_COND(!viewport->canvas_map.has(p_canvas));
 	viewport->canvas_map[p_canvas].layer = p_layer;
@@ -628,6 +667,7 @@ void VisualServerViewport::viewport_set_shadow_atlas_size(RID p_viewport, int p_
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	viewport->shadow_atlas_size = p_size;
 
@@ -638,6 +678,7 @@ void VisualServerViewport::viewport_set_shadow_atlas_quadrant_subdivision(RID p_
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	VSG::scene_render->shadow_atlas_set_quadrant_subdivision(viewport->shadow_atlas, p_quadrant, p_subdiv);
 }
@@ -646,6 +687,7 @@ void VisualServerViewport::viewport_set_msaa(RID p_viewport, VS::ViewportMSAA p_
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	VSG::storage->render_target_set_msaa(viewport->render_target, p_msaa);
 }
@@ -654,14 +696,26 @@ void VisualServerViewport::viewport_set_hdr(RID p_viewport, bool p_enabled) {
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	VSG::storage->render_target_set_flag(viewport->render_target, RasterizerStorage::RENDER_TARGET_HDR, p_enabled);
 }
 
+void VisualServerViewport::viewport_set_depth_prepass(RID p_viewport, VS::ViewportDepthPrepassMode p_mode) {
+
+	Viewport *viewport = viewport_owner.getornull(p_viewport);
+	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
+
+	VSG::storage->render_target_set_flag(viewport->render_target, RasterizerStorage::RENDER_TARGET_NO_DEPTH_PREPASS, p_mode == VS::VIEWPORT_DEPTH_PREPASS_DISABLED);
+	VSG::storage->render_target_set_flag(viewport->render_target, RasterizerStorage::RENDER_TARGET_FORCE_DEPTH_PREPASS, p_mode == VS::VIEWPORT_DEPTH_PREPASS_ENABLED);
+}
+
 void VisualServerViewport::viewport_set_usage(RID p_viewport, VS::ViewportUsage p_usage) {
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	switch (p_usage) {
 		case VS::VIEWPORT_USAGE_2D: {
@@ -711,6 +765,7 @@ void VisualServerViewport::viewport_set_debug_draw(RID p_viewport, VS::ViewportD
 
 	Viewport *viewport = viewport_owner.getornull(p_viewport);
 	ERR_FAIL_COND(!viewport);
+	viewport->self_version++;
 
 	viewport->debug_draw = p_draw;
 }
@@ -109,8 +109,13 @@ public:
 
 		Map<RID, CanvasData> canvas_map;
 
+		uint64_t self_version; //viewport configuration changes, for VIEWPORT_UPDATE_WHEN_CHANGED
+		uint64_t last_content_version; //combined content version at the last render
+
 		Viewport() {
 			update_mode = VS::VIEWPORT_UPDATE_WHEN_VISIBLE;
+			self_version = 1;
+			last_content_version = 0;
 			clear_mode = VS::VIEWPORT_CLEAR_ALWAYS;
 			transparent_bg = false;
 			disable_environment = false;
@@ -192,6 +197,7 @@ public:
 	void viewport_set_msaa(RID p_viewport, VS::ViewportMSAA p_msaa);
 	void viewport_set_hdr(RID p_viewport, bool p_enabled);
 	void viewport_set_usage(RID p_viewport, VS::ViewportUsage p_usage);
+	void viewport_set_depth_prepass(RID p_viewport, VS::ViewportDepthPrepassMode p_mode);
 
 	virtual int viewport_get_render_info(RID p_viewport, VS::ViewportRenderInfo p_info);
 	virtual void viewport_set_debug_draw(RID p_viewport, VS::ViewportDebugDraw p_draw);
@@ -79,8 +79,20 @@ void VisualServerWrapMT::thread_loop() {
 
 /* EVENT QUEUING */
 
+void VisualServerWrapMT::_flush_pending_transforms() const {
+
+	transform_batch_mutex->lock();
+	if (pending_transforms.size()) {
+		command_queue.push(visual_server, &VisualServer::instances_set_transform_bulk, pending_transforms);
+		pending_transforms.clear();
+	}
+	transform_batch_mutex->unlock();
+}
+
 void VisualServerWrapMT::sync() {
 
+	_flush_pending_transforms();
+
 	if (create_thread) {
 
 		atomic_increment(&draw_pending);
@@ -93,6 +105,8 @@ void VisualServerWrapMT::sync() {
 
 void VisualServerWrapMT::draw(bool p_swap_buffers, double frame_step) {
 
+	_flush_pending_transforms();
+
 	if (create_thread) {
 
 		atomic_increment(&draw_pending);
@@ -155,6 +169,8 @@ void VisualServerWrapMT::finish() {
 	viewport_free_cached_ids();
 	environment_free_cached_ids();
 	scenario_free_cached_ids();
+	room_free_cached_ids();
+	portal_free_cached_ids();
 	instance_free_cached_ids();
 	canvas_free_cached_ids();
 	canvas_item_free_cached_ids();
@@ -181,6 +197,7 @@ VisualServerWrapMT::VisualServerWrapMT(VisualServer *p_contained, bool p_create_
 	draw_pending = 0;
 	draw_thread_up = false;
 	alloc_mutex = Mutex::create();
+	transform_batch_mutex = Mutex::create();
 	pool_max_size = GLOBAL_GET("memory/limits/multithreaded_server/rid_pool_prealloc");
 
 	if (!p_create_thread) {
@@ -194,5 +211,6 @@ VisualServerWrapMT::~VisualServerWrapMT() {
 
 	memdelete(visual_server);
 	memdelete(alloc_mutex);
+	memdelete(transform_batch_mutex);
 	//finish();
 }
@@ -61,6 +61,14 @@ class VisualServerWrapMT : public VisualServer {
 
 	int pool_max_size;
 
+	enum {
+		TRANSFORM_BATCH_FLUSH_SIZE = 8192
+	};
+
+	mutable Mutex *transform_batch_mutex;
+	mutable Vector<BulkTransform> pending_transforms;
+	void _flush_pending_transforms() const;
+
 	//#define DEBUG_SYNC
 
 	static VisualServerWrapMT *singleton_mt;
@@ -201,6 +209,7 @@ public:
 	FUNC2RC(Color, multimesh_instance_get_custom_data, RID, int)
 
 	FUNC2(multimesh_set_as_bulk_array, RID, const PoolVector<float> &)
+	FUNC3(multimesh_set_buffer_region, RID, int, const PoolVector<float> &)
 
 	FUNC2(multimesh_set_visible_instances, RID, int)
 	FUNC1RC(int, multimesh_get_visible_instances, RID)
@@ -217,6 +226,7 @@ public:
 	FUNC2(immediate_uv2, RID, const Vector2 &)
 	FUNC1(immediate_end, RID)
 	FUNC1(immediate_clear, RID)
+	FUNC9(immediate_set_buffer, RID, PrimitiveType, const PoolVector<Vector3> &, const PoolVector<Vector3> &, const PoolVector<Plane> &, const PoolVector<Color> &, const PoolVector<Vector2> &, const PoolVector<Vector2> &, RID)
 	FUNC2(immediate_set_material, RID, RID)
 	FUNC1RC(RID, immediate_get_material, RID)
 
@@ -226,6 +236,7 @@ public:
 	FUNC3(skeleton_allocate, RID, int, bool)
 	FUNC1RC(int, skeleton_get_bone_count, RID)
 	FUNC3(skeleton_bone_set_transform, RID, int, const Transform &)
+	FUNC2(skeleton_set_bone_transforms, RID, const Vector<Transform> &)
 	FUNC2RC(Transform, skeleton_bone_get_transform, RID, int)
 	FUNC3(skeleton_bone_set_transform_2d, RID, int, const Transform2D &)
 	FUNC2RC(Transform2D, skeleton_bone_get_transform_2d, RID, int)
@@ -409,6 +420,7 @@ public:
 	FUNC2(viewport_set_msaa, RID, ViewportMSAA)
 	FUNC2(viewport_set_hdr, RID, bool)
 	FUNC2(viewport_set_usage, RID, ViewportUsage)
+	FUNC2(viewport_set_depth_prepass, RID, ViewportDepthPrepassMode)
 
 	//this passes directly to avoid stalling, but it's pretty dangerous, so don't call after freeing a viewport
 	virtual int viewport_get_render_info(RID p_viewport, ViewportRenderInfo p_info) {
@@ -452,17 +464,53 @@ public:
 	FUNC3(scenario_set_reflection_atlas_size, RID, int, int)
 	FUNC2(scenario_set_fallback_environment, RID, RID)
 
+	/* ROOMS AND PORTALS API */
+	FUNCRID(room)
+
+	FUNC2(room_set_scenario, RID, RID)
+	FUNC2(room_set_bounds, RID, const Vector<Plane> &)
+
+	FUNCRID(portal)
+
+	FUNC2(portal_set_scenario, RID, RID)
+	FUNC2(portal_set_geometry, RID, const Vector<Vector3> &)
+	FUNC3(portal_set_rooms, RID, RID, RID)
+	FUNC2(portal_set_enabled, RID, bool)
+
 	/* INSTANCING API */
 	FUNCRID(instance)
 
 	FUNC2(instance_set_base, RID, RID)
 	FUNC2(instance_set_scenario, RID, RID)
 	FUNC2(instance_set_layer_mask, RID, uint32_t)
-	FUNC2(instance_set_transform, RID, const Transform &)
+	virtual void instance_set_transform(RID p_instance, const Transform &p_transform) {
+		if (Thread::get_caller_id() != server_thread) {
+			// Batched: one bulk command is queued at sync/draw time instead
+			// of one queued command per moving instance.
+			BulkTransform bt;
+			bt.instance = p_instance;
+			bt.transform = p_transform;
+			transform_batch_mutex->lock();
+			pending_transforms.push_back(bt);
+			bool flush_now = pending_transforms.size() >= TRANSFORM_BATCH_FLUSH_SIZE;
+			transform_batch_mutex->unlock();
+			if (flush_now)
+				_flush_pending_transforms();
+		} else {
+			visual_server->instance_set_transform(p_instance, p_transform);
+		}
+	}
+	FUNC1(instances_set_transform_bulk, const Vector<BulkTransform> &)
+	FUNC2(instance_set_interpolated, RID, bool)
+	FUNC1(instance_reset_physics_interpolation, RID)
 	FUNC2(instance_attach_object_instance_id, RID, ObjectID)
 	FUNC3(instance_set_blend_shape_weight, RID, int, float)
 	FUNC3(instance_set_surface_material, RID, int, RID)
 	FUNC2(instance_set_visible, RID, bool)
+	FUNC1RC(bool, instance_is_visible, RID)
+	FUNC2(instance_set_occluder, RID, bool)
+	FUNC3(instance_add_lod_level, RID, RID, float)
+	FUNC1(instance_clear_lod_levels, RID)
 	FUNC3(instance_set_use_lightmap, RID, RID, RID)
 
 	FUNC2(instance_set_custom_aabb, RID, AABB)
@@ -473,9 +521,41 @@ public:
 	FUNC2(instance_set_extra_visibility_margin, RID, real_t)
 
 	// don't use these in a game!
-	FUNC2RC(Vector<ObjectID>, instances_cull_aabb, const AABB &, RID)
-	FUNC3RC(Vector<ObjectID>, instances_cull_ray, const Vector3 &, const Vector3 &, RID)
-	FUNC2RC(Vector<ObjectID>, instances_cull_convex, const Vector<Plane> &, RID)
+	// Hand-rolled versions of FUNC2RC/FUNC3RC that flush batched transforms
+	// first, so culling sees every transform set earlier this frame.
+	virtual Vector<ObjectID> instances_cull_aabb(const AABB &p_aabb, RID p_scenario = RID()) const {
+		if (Thread::get_caller_id() != server_thread) {
+			_flush_pending_transforms();
+			Vector<ObjectID> ret;
+			command_queue.push_and_ret(visual_server, &VisualServer::instances_cull_aabb, p_aabb, p_scenario, &ret);
+			SYNC_DEBUG
+			return ret;
+		} else {
+			return visual_server->instances_cull_aabb(p_aabb, p_scenario);
+		}
+	}
+	virtual Vector<ObjectID> instances_cull_ray(const Vector3 &p_from, const Vector3 &p_to, RID p_scenario = RID()) const {
+		if (Thread::get_caller_id() != server_thread) {
+			_flush_pending_transforms();
+			Vector<ObjectID> ret;
+			command_queue.push_and_ret(visual_server, &VisualServer::instances_cull_ray, p_from, p_to, p_scenario, &ret);
+			SYNC_DEBUG
+			return ret;
+		} else {
+			return visual_server->instances_cull_ray(p_from, p_to, p_scenario);
+		}
+	}
+	virtual Vector<ObjectID> instances_cull_convex(const Vector<Plane> &p_convex, RID p_scenario = RID()) const {
+		if (Thread::get_caller_id() != server_thread) {
+			_flush_pending_transforms();
+			Vector<ObjectID> ret;
+			command_queue.push_and_ret(visual_server, &VisualServer::instances_cull_convex, p_convex, p_scenario, &ret);
+			SYNC_DEBUG
+			return ret;
+		} else {
+			return visual_server->instances_cull_convex(p_convex, p_scenario);
+		}
+	}
 
 	FUNC3(instance_geometry_set_flag, RID, InstanceFlags, bool)
 	FUNC2(instance_geometry_set_cast_shadows_setting, RID, ShadowCastingSetting)
@@ -582,7 +662,14 @@ public:
 
 	/* FREE */
 
-	FUNC1(free, RID)
+	virtual void free(RID p_rid) {
+		if (Thread::get_caller_id() != server_thread) {
+			_flush_pending_transforms(); // Keep queued transforms ordered ahead of frees.
+			command_queue.push(visual_server, &VisualServer::free, p_rid);
+		} else {
+			visual_server->free(p_rid);
+		}
+	}
 
 	/* EVENT QUEUING */
 
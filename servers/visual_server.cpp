@@ -99,6 +99,13 @@ static Array to_array(const Vector<ObjectID> &ids) {
 	return a;
 }
 
+void VisualServer::instances_set_transform_bulk(const Vector<BulkTransform> &p_transforms) {
+
+	for (int i = 0; i < p_transforms.size(); i++) {
+		instance_set_transform(p_transforms[i].instance, p_transforms[i].transform);
+	}
+}
+
 Array VisualServer::_instances_cull_aabb_bind(const AABB &p_aabb, RID p_scenario) const {
 
 	Vector<ObjectID> ids = instances_cull_aabb(p_aabb, p_scenario);
@@ -124,6 +131,18 @@ Array VisualServer::_instances_cull_convex_bind(const Array &p_convex, RID p_sce
 	return to_array(ids);
 }
 
+void VisualServer::_room_set_bounds_bind(RID p_room, const Array &p_convex) {
+
+	Vector<Plane> planes;
+	for (int i = 0; i < p_convex.size(); ++i) {
+		Variant v = p_convex[i];
+		ERR_FAIL_COND(v.get_type() != Variant::PLANE);
+		planes.push_back(v);
+	}
+
+	room_set_bounds(p_room, planes);
+}
+
 RID VisualServer::get_test_texture() {
 
 	if (test_texture.is_valid()) {
@@ -1734,6 +1753,7 @@ void VisualServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("multimesh_set_visible_instances", "multimesh", "visible"), &VisualServer::multimesh_set_visible_instances);
 	ClassDB::bind_method(D_METHOD("multimesh_get_visible_instances", "multimesh"), &VisualServer::multimesh_get_visible_instances);
 	ClassDB::bind_method(D_METHOD("multimesh_set_as_bulk_array", "multimesh", "array"), &VisualServer::multimesh_set_as_bulk_array);
+	ClassDB::bind_method(D_METHOD("multimesh_set_buffer_region", "multimesh", "instance_from", "array"), &VisualServer::multimesh_set_buffer_region);
 #ifndef _3D_DISABLED
 	ClassDB::bind_method(D_METHOD("immediate_create"), &VisualServer::immediate_create);
 	ClassDB::bind_method(D_METHOD("immediate_begin", "immediate", "primitive", "texture"), &VisualServer::immediate_begin, DEFVAL(RID()));
@@ -1746,6 +1766,7 @@ void VisualServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("immediate_uv2", "immediate", "tex_uv"), &VisualServer::immediate_uv2);
 	ClassDB::bind_method(D_METHOD("immediate_end", "immediate"), &VisualServer::immediate_end);
 	ClassDB::bind_method(D_METHOD("immediate_clear", "immediate"), &VisualServer::immediate_clear);
+	ClassDB::bind_method(D_METHOD("immediate_set_buffer", "immediate", "primitive", "vertices", "normals", "tangents", "colors", "uvs", "uv2s", "texture"), &VisualServer::immediate_set_buffer, DEFVAL(RID()));
 	ClassDB::bind_method(D_METHOD("immediate_set_material", "immediate", "material"), &VisualServer::immediate_set_material);
 	ClassDB::bind_method(D_METHOD("immediate_get_material", "immediate"), &VisualServer::immediate_get_material);
 #endif
@@ -1892,6 +1913,7 @@ void VisualServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("viewport_set_msaa", "viewport", "msaa"), &VisualServer::viewport_set_msaa);
 	ClassDB::bind_method(D_METHOD("viewport_set_hdr", "viewport", "enabled"), &VisualServer::viewport_set_hdr);
 	ClassDB::bind_method(D_METHOD("viewport_set_usage", "viewport", "usage"), &VisualServer::viewport_set_usage);
+	ClassDB::bind_method(D_METHOD("viewport_set_depth_prepass", "viewport", "mode"), &VisualServer::viewport_set_depth_prepass);
 	ClassDB::bind_method(D_METHOD("viewport_get_render_info", "viewport", "info"), &VisualServer::viewport_get_render_info);
 	ClassDB::bind_method(D_METHOD("viewport_set_debug_draw", "viewport", "draw"), &VisualServer::viewport_set_debug_draw);
 
@@ -1923,6 +1945,15 @@ void VisualServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("scenario_set_reflection_atlas_size", "scenario", "size", "subdiv"), &VisualServer::scenario_set_reflection_atlas_size);
 	ClassDB::bind_method(D_METHOD("scenario_set_fallback_environment", "scenario", "environment"), &VisualServer::scenario_set_fallback_environment);
 
+	ClassDB::bind_method(D_METHOD("room_create"), &VisualServer::room_create);
+	ClassDB::bind_method(D_METHOD("room_set_scenario", "room", "scenario"), &VisualServer::room_set_scenario);
+	ClassDB::bind_method(D_METHOD("room_set_bounds", "room", "convex"), &VisualServer::_room_set_bounds_bind);
+	ClassDB::bind_method(D_METHOD("portal_create"), &VisualServer::portal_create);
+	ClassDB::bind_method(D_METHOD("portal_set_scenario", "portal", "scenario"), &VisualServer::portal_set_scenario);
+	ClassDB::bind_method(D_METHOD("portal_set_geometry", "portal", "points"), &VisualServer::portal_set_geometry);
+	ClassDB::bind_method(D_METHOD("portal_set_rooms", "portal", "room_a", "room_b"), &VisualServer::portal_set_rooms);
+	ClassDB::bind_method(D_METHOD("portal_set_enabled", "portal", "enabled"), &VisualServer::portal_set_enabled);
+
 #ifndef _3D_DISABLED
 
 	ClassDB::bind_method(D_METHOD("instance_create2", "base", "scenario"), &VisualServer::instance_create2);
@@ -1931,10 +1962,16 @@ void VisualServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("instance_set_scenario", "instance", "scenario"), &VisualServer::instance_set_scenario);
 	ClassDB::bind_method(D_METHOD("instance_set_layer_mask", "instance", "mask"), &VisualServer::instance_set_layer_mask);
 	ClassDB::bind_method(D_METHOD("instance_set_transform", "instance", "transform"), &VisualServer::instance_set_transform);
+	ClassDB::bind_method(D_METHOD("instance_set_interpolated", "instance", "interpolated"), &VisualServer::instance_set_interpolated);
+	ClassDB::bind_method(D_METHOD("instance_reset_physics_interpolation", "instance"), &VisualServer::instance_reset_physics_interpolation);
 	ClassDB::bind_method(D_METHOD("instance_attach_object_instance_id", "instance", "id"), &VisualServer::instance_attach_object_instance_id);
 	ClassDB::bind_method(D_METHOD("instance_set_blend_shape_weight", "instance", "shape", "weight"), &VisualServer::instance_set_blend_shape_weight);
 	ClassDB::bind_method(D_METHOD("instance_set_surface_material", "instance", "surface", "material"), &VisualServer::instance_set_surface_material);
 	ClassDB::bind_method(D_METHOD("instance_set_visible", "instance", "visible"), &VisualServer::instance_set_visible);
+	ClassDB::bind_method(D_METHOD("instance_is_visible", "instance"), &VisualServer::instance_is_visible);
+	ClassDB::bind_method(D_METHOD("instance_set_occluder", "instance", "enabled"), &VisualServer::instance_set_occluder);
+	ClassDB::bind_method(D_METHOD("instance_add_lod_level", "instance", "mesh", "distance"), &VisualServer::instance_add_lod_level);
+	ClassDB::bind_method(D_METHOD("instance_clear_lod_levels", "instance"), &VisualServer::instance_clear_lod_levels);
 	ClassDB::bind_method(D_METHOD("instance_set_use_lightmap", "instance", "lightmap_instance", "lightmap"), &VisualServer::instance_set_use_lightmap);
 	ClassDB::bind_method(D_METHOD("instance_set_custom_aabb", "instance", "aabb"), &VisualServer::instance_set_custom_aabb);
 	ClassDB::bind_method(D_METHOD("instance_attach_skeleton", "instance", "skeleton"), &VisualServer::instance_attach_skeleton);
@@ -2164,6 +2201,7 @@ void VisualServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(VIEWPORT_UPDATE_ONCE);
 	BIND_ENUM_CONSTANT(VIEWPORT_UPDATE_WHEN_VISIBLE);
 	BIND_ENUM_CONSTANT(VIEWPORT_UPDATE_ALWAYS);
+	BIND_ENUM_CONSTANT(VIEWPORT_UPDATE_WHEN_CHANGED);
 
 	BIND_ENUM_CONSTANT(VIEWPORT_CLEAR_ALWAYS);
 	BIND_ENUM_CONSTANT(VIEWPORT_CLEAR_NEVER);
@@ -2182,6 +2220,10 @@ void VisualServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(VIEWPORT_USAGE_3D);
 	BIND_ENUM_CONSTANT(VIEWPORT_USAGE_3D_NO_EFFECTS);
 
+	BIND_ENUM_CONSTANT(VIEWPORT_DEPTH_PREPASS_INHERIT);
+	BIND_ENUM_CONSTANT(VIEWPORT_DEPTH_PREPASS_DISABLED);
+	BIND_ENUM_CONSTANT(VIEWPORT_DEPTH_PREPASS_ENABLED);
+
 	BIND_ENUM_CONSTANT(VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME);
 	BIND_ENUM_CONSTANT(VIEWPORT_RENDER_INFO_VERTICES_IN_FRAME);
 	BIND_ENUM_CONSTANT(VIEWPORT_RENDER_INFO_MATERIAL_CHANGES_IN_FRAME);
@@ -2251,6 +2293,10 @@ void VisualServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(INFO_VIDEO_MEM_USED);
 	BIND_ENUM_CONSTANT(INFO_TEXTURE_MEM_USED);
 	BIND_ENUM_CONSTANT(INFO_VERTEX_MEM_USED);
+	BIND_ENUM_CONSTANT(INFO_GPU_SHADOW_TIME);
+	BIND_ENUM_CONSTANT(INFO_GPU_OPAQUE_TIME);
+	BIND_ENUM_CONSTANT(INFO_GPU_TRANSPARENT_TIME);
+	BIND_ENUM_CONSTANT(INFO_GPU_EFFECTS_TIME);
 
 	BIND_ENUM_CONSTANT(FEATURE_SHADERS);
 	BIND_ENUM_CONSTANT(FEATURE_MULTITHREADED);
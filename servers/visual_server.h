@@ -363,6 +363,7 @@ public:
 	virtual Color multimesh_instance_get_custom_data(RID p_multimesh, int p_index) const = 0;
 
 	virtual void multimesh_set_as_bulk_array(RID p_multimesh, const PoolVector<float> &p_array) = 0;
+	virtual void multimesh_set_buffer_region(RID p_multimesh, int p_instance_from, const PoolVector<float> &p_array) = 0;
 
 	virtual void multimesh_set_visible_instances(RID p_multimesh, int p_visible) = 0;
 	virtual int multimesh_get_visible_instances(RID p_multimesh) const = 0;
@@ -380,6 +381,7 @@ public:
 	virtual void immediate_uv2(RID p_immediate, const Vector2 &tex_uv) = 0;
 	virtual void immediate_end(RID p_immediate) = 0;
 	virtual void immediate_clear(RID p_immediate) = 0;
+	virtual void immediate_set_buffer(RID p_immediate, PrimitiveType p_primitive, const PoolVector<Vector3> &p_vertices, const PoolVector<Vector3> &p_normals, const PoolVector<Plane> &p_tangents, const PoolVector<Color> &p_colors, const PoolVector<Vector2> &p_uvs, const PoolVector<Vector2> &p_uv2s, RID p_texture = RID()) = 0;
 	virtual void immediate_set_material(RID p_immediate, RID p_material) = 0;
 	virtual RID immediate_get_material(RID p_immediate) const = 0;
 
@@ -389,6 +391,7 @@ public:
 	virtual void skeleton_allocate(RID p_skeleton, int p_bones, bool p_2d_skeleton = false) = 0;
 	virtual int skeleton_get_bone_count(RID p_skeleton) const = 0;
 	virtual void skeleton_bone_set_transform(RID p_skeleton, int p_bone, const Transform &p_transform) = 0;
+	virtual void skeleton_set_bone_transforms(RID p_skeleton, const Vector<Transform> &p_transforms) = 0;
 	virtual Transform skeleton_bone_get_transform(RID p_skeleton, int p_bone) const = 0;
 	virtual void skeleton_bone_set_transform_2d(RID p_skeleton, int p_bone, const Transform2D &p_transform) = 0;
 	virtual Transform2D skeleton_bone_get_transform_2d(RID p_skeleton, int p_bone) const = 0;
@@ -618,7 +621,8 @@ public:
 		VIEWPORT_UPDATE_DISABLED,
 		VIEWPORT_UPDATE_ONCE, //then goes to disabled, must be manually updated
 		VIEWPORT_UPDATE_WHEN_VISIBLE, // default
-		VIEWPORT_UPDATE_ALWAYS
+		VIEWPORT_UPDATE_ALWAYS,
+		VIEWPORT_UPDATE_WHEN_CHANGED, //only when a contained canvas, the scenario or the camera changed
 	};
 
 	virtual void viewport_set_update_mode(RID p_viewport, ViewportUpdateMode p_mode) = 0;
@@ -676,6 +680,14 @@ public:
 	virtual void viewport_set_hdr(RID p_viewport, bool p_enabled) = 0;
 	virtual void viewport_set_usage(RID p_viewport, ViewportUsage p_usage) = 0;
 
+	enum ViewportDepthPrepassMode {
+		VIEWPORT_DEPTH_PREPASS_INHERIT, //follow the project setting
+		VIEWPORT_DEPTH_PREPASS_DISABLED,
+		VIEWPORT_DEPTH_PREPASS_ENABLED,
+	};
+
+	virtual void viewport_set_depth_prepass(RID p_viewport, ViewportDepthPrepassMode p_mode) = 0;
+
 	enum ViewportRenderInfo {
 
 		VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME,
@@ -793,6 +805,18 @@ public:
 	virtual void scenario_set_reflection_atlas_size(RID p_scenario, int p_size, int p_subdiv) = 0;
 	virtual void scenario_set_fallback_environment(RID p_scenario, RID p_environment) = 0;
 
+	/* ROOMS AND PORTALS API */
+
+	virtual RID room_create() = 0;
+	virtual void room_set_scenario(RID p_room, RID p_scenario) = 0;
+	virtual void room_set_bounds(RID p_room, const Vector<Plane> &p_convex) = 0;
+
+	virtual RID portal_create() = 0;
+	virtual void portal_set_scenario(RID p_portal, RID p_scenario) = 0;
+	virtual void portal_set_geometry(RID p_portal, const Vector<Vector3> &p_points) = 0;
+	virtual void portal_set_rooms(RID p_portal, RID p_room_a, RID p_room_b) = 0;
+	virtual void portal_set_enabled(RID p_portal, bool p_enabled) = 0;
+
 	/* INSTANCING API */
 
 	enum InstanceType {
@@ -819,10 +843,26 @@ public:
 	virtual void instance_set_scenario(RID p_instance, RID p_scenario) = 0;
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask) = 0;
 	virtual void instance_set_transform(RID p_instance, const Transform &p_transform) = 0;
+
+	struct BulkTransform {
+		RID instance;
+		Transform transform;
+	};
+
+	// Frame-batched alternative to one instance_set_transform call per moving
+	// instance; the multithreaded wrapper submits the whole array as a single
+	// queued command.
+	virtual void instances_set_transform_bulk(const Vector<BulkTransform> &p_transforms);
+	virtual void instance_set_interpolated(RID p_instance, bool p_interpolated) = 0;
+	virtual void instance_reset_physics_interpolation(RID p_instance) = 0;
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id) = 0;
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight) = 0;
 	virtual void instance_set_surface_material(RID p_instance, int p_surface, RID p_material) = 0;
 	virtual void instance_set_visible(RID p_instance, bool p_visible) = 0;
+	virtual bool instance_is_visible(RID p_instance) const = 0;
+	virtual void instance_set_occluder(RID p_instance, bool p_enabled) = 0;
+	virtual void instance_add_lod_level(RID p_instance, RID p_mesh, float p_distance) = 0;
+	virtual void instance_clear_lod_levels(RID p_instance) = 0;
 
 	virtual void instance_set_use_lightmap(RID p_instance, RID p_lightmap_instance, RID p_lightmap) = 0;
 
@@ -841,6 +881,7 @@ public:
 	Array _instances_cull_aabb_bind(const AABB &p_aabb, RID p_scenario = RID()) const;
 	Array _instances_cull_ray_bind(const Vector3 &p_from, const Vector3 &p_to, RID p_scenario = RID()) const;
 	Array _instances_cull_convex_bind(const Array &p_convex, RID p_scenario = RID()) const;
+	void _room_set_bounds_bind(RID p_room, const Array &p_convex);
 
 	enum InstanceFlags {
 		INSTANCE_FLAG_USE_BAKED_LIGHT,
@@ -1015,6 +1056,10 @@ public:
 		INFO_VIDEO_MEM_USED,
 		INFO_TEXTURE_MEM_USED,
 		INFO_VERTEX_MEM_USED,
+		INFO_GPU_SHADOW_TIME, //per-pass GPU times of the last resolved frame, in microseconds
+		INFO_GPU_OPAQUE_TIME,
+		INFO_GPU_TRANSPARENT_TIME,
+		INFO_GPU_EFFECTS_TIME,
 	};
 
 	virtual int get_render_info(RenderInfo p_info) = 0;
@@ -1071,6 +1116,7 @@ VARIANT_ENUM_CAST(VisualServer::ViewportUpdateMode);
 VARIANT_ENUM_CAST(VisualServer::ViewportClearMode);
 VARIANT_ENUM_CAST(VisualServer::ViewportMSAA);
 VARIANT_ENUM_CAST(VisualServer::ViewportUsage);
+VARIANT_ENUM_CAST(VisualServer::ViewportDepthPrepassMode);
 VARIANT_ENUM_CAST(VisualServer::ViewportRenderInfo);
 VARIANT_ENUM_CAST(VisualServer::ViewportDebugDraw);
 VARIANT_ENUM_CAST(VisualServer::ScenarioDebugMode);